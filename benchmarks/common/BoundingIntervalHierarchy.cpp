@@ -0,0 +1,117 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "BoundingIntervalHierarchy.h"
+#include <random>
+#include <vector>
+
+namespace
+{
+struct BoxBounds
+{
+    void operator()(G3D::AABox const& box, G3D::AABox& out) const { out = box; }
+};
+
+struct BoxRayIntersection
+{
+    explicit BoxRayIntersection(std::vector<G3D::AABox> const& boxes) : Boxes(boxes) { }
+
+    bool operator()(G3D::Ray const& ray, uint32 entry, float& maxDist, bool /*stopAtFirst*/)
+    {
+        float distance = ray.intersectionTime(Boxes[entry]);
+        if (distance >= maxDist)
+            return false;
+
+        maxDist = distance;
+        return true;
+    }
+
+    std::vector<G3D::AABox> const& Boxes;
+};
+
+std::vector<G3D::AABox> MakeBoxes()
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> size(1.0f, 20.0f);
+    std::vector<G3D::AABox> boxes;
+    for (int i = 0; i < 4096; ++i)
+    {
+        G3D::Vector3 low(position(generator), position(generator), position(generator) * 0.1f);
+        boxes.emplace_back(low, low + G3D::Vector3(size(generator), size(generator), size(generator)));
+    }
+    return boxes;
+}
+
+std::vector<G3D::Ray> MakeRays()
+{
+    std::mt19937 generator(54321);
+    std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+    std::vector<G3D::Ray> rays;
+    for (int i = 0; i < 256; ++i)
+    {
+        G3D::Vector3 start(position(generator), position(generator), 50.0f);
+        G3D::Vector3 end(position(generator), position(generator), 0.0f);
+        rays.push_back(G3D::Ray::fromOriginAndDirection(start, (end - start).direction()));
+    }
+    return rays;
+}
+}
+
+TEST_CASE("BIH", "[benchmark][BIH]")
+{
+    std::vector<G3D::AABox> boxes = MakeBoxes();
+    std::vector<G3D::Ray> rays = MakeRays();
+
+    BENCHMARK("build 4096 boxes")
+    {
+        BIH tree;
+        tree.build(boxes, BoxBounds());
+        return tree.primCount();
+    };
+
+    BIH tree;
+    tree.build(boxes, BoxBounds());
+
+    BENCHMARK("intersectRay 256 rays, closest hit")
+    {
+        uint32 hits = 0;
+        for (G3D::Ray const& ray : rays)
+        {
+            BoxRayIntersection callback(boxes);
+            float maxDist = 2000.0f;
+            tree.intersectRay(ray, callback, maxDist);
+            hits += maxDist < 2000.0f;
+        }
+        return hits;
+    };
+
+    BENCHMARK("intersectRay 256 rays, first hit")
+    {
+        uint32 hits = 0;
+        for (G3D::Ray const& ray : rays)
+        {
+            BoxRayIntersection callback(boxes);
+            float maxDist = 2000.0f;
+            tree.intersectRay(ray, callback, maxDist, true);
+            hits += maxDist < 2000.0f;
+        }
+        return hits;
+    };
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "EventMap.h"
+
+TEST_CASE("EventMap", "[benchmark][EventMap]")
+{
+    BENCHMARK("schedule 32 events")
+    {
+        EventMap events;
+        for (uint32 i = 1; i <= 32; ++i)
+            events.ScheduleEvent(i, Milliseconds(i * 250), i % 4);
+        return events.Empty();
+    };
+
+    BENCHMARK("schedule, update and execute 32 events")
+    {
+        EventMap events;
+        for (uint32 i = 1; i <= 32; ++i)
+            events.ScheduleEvent(i, Milliseconds(i * 250), i % 4);
+
+        uint32 executed = 0;
+        for (uint32 tick = 0; tick < 100; ++tick)
+        {
+            events.Update(100);
+            while (uint32 eventId = events.ExecuteEvent())
+                executed += eventId;
+        }
+        return executed;
+    };
+
+    BENCHMARK("cancel event groups")
+    {
+        EventMap events;
+        for (uint32 i = 1; i <= 32; ++i)
+            events.ScheduleEvent(i, Milliseconds(i * 250), i % 4 + 1);
+
+        for (uint32 group = 1; group <= 4; ++group)
+            events.CancelEventGroup(group);
+        return events.Empty();
+    };
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Define.h"
+#include "FlatSet.h"
+#include <random>
+#include <vector>
+
+namespace
+{
+std::vector<uint32> MakeKeys(std::size_t count)
+{
+    std::mt19937 generator(12345);
+    std::uniform_int_distribution<uint32> distribution;
+    std::vector<uint32> keys(count);
+    for (uint32& key : keys)
+        key = distribution(generator);
+    return keys;
+}
+}
+
+TEST_CASE("FlatSet", "[benchmark][FlatSet]")
+{
+    std::vector<uint32> keys = MakeKeys(256);
+
+    BENCHMARK("insert 256 random keys")
+    {
+        Trinity::Containers::FlatSet<uint32> set;
+        for (uint32 key : keys)
+            set.insert(key);
+        return set.size();
+    };
+
+    Trinity::Containers::FlatSet<uint32> set;
+    for (uint32 key : keys)
+        set.insert(key);
+
+    BENCHMARK("find 256 keys")
+    {
+        std::size_t found = 0;
+        for (uint32 key : keys)
+            found += set.find(key) != set.end();
+        return found;
+    };
+
+    BENCHMARK_ADVANCED("erase 256 keys")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<Trinity::Containers::FlatSet<uint32>> sets(meter.runs(), set);
+        meter.measure([&](int run)
+        {
+            for (uint32 key : keys)
+                sets[run].erase(key);
+            return sets[run].size();
+        });
+    };
+}
@@ -0,0 +1,38 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "StringFormat.h"
+
+TEST_CASE("StringFormat", "[benchmark][StringFormat]")
+{
+    BENCHMARK("integers")
+    {
+        return Trinity::StringFormat("{} {} {}", 1234567, -42, uint64(0x0102030405060708));
+    };
+
+    BENCHMARK("floats")
+    {
+        return Trinity::StringFormat("X: {:.3f} Y: {:.3f} Z: {:.3f} O: {:.3f}", -8913.23f, 554.633f, 93.7944f, 0.675f);
+    };
+
+    BENCHMARK("strings")
+    {
+        return Trinity::StringFormat("{} ({}) instance {}", "Eastern Kingdoms", 0, 12345);
+    };
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ByteBuffer.h"
+
+TEST_CASE("ByteBuffer", "[benchmark][ByteBuffer]")
+{
+    BENCHMARK("append 1024 fields")
+    {
+        ByteBuffer buffer;
+        for (uint32 i = 0; i < 256; ++i)
+            buffer << uint32(i) << uint8(i) << uint64(i) << float(i);
+        return buffer.size();
+    };
+
+    BENCHMARK("AppendFixed 1024 fields")
+    {
+        ByteBuffer buffer;
+        for (uint32 i = 0; i < 256; ++i)
+            buffer.AppendFixed(uint32(i), uint8(i), uint64(i), float(i));
+        return buffer.size();
+    };
+
+    BENCHMARK("write 2048 bits")
+    {
+        ByteBuffer buffer;
+        for (uint32 i = 0; i < 1024; ++i)
+        {
+            buffer.WriteBit(i & 1);
+            buffer.WriteBits(i, 1);
+        }
+        buffer.FlushBits();
+        return buffer.size();
+    };
+
+    ByteBuffer filled;
+    for (uint32 i = 0; i < 256; ++i)
+        filled << uint32(i) << uint8(i) << uint64(i) << float(i);
+
+    BENCHMARK("read 1024 fields")
+    {
+        ByteBuffer buffer(filled);
+        uint64 sum = 0;
+        for (uint32 i = 0; i < 256; ++i)
+        {
+            sum += buffer.read<uint32>();
+            sum += buffer.read<uint8>();
+            sum += buffer.read<uint64>();
+            sum += uint64(buffer.read<float>());
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,66 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ObjectGuid.h"
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+std::vector<ObjectGuid> MakeGuids()
+{
+    std::vector<ObjectGuid> guids;
+    for (uint32 i = 0; i < 512; ++i)
+        guids.push_back(ObjectGuid::Create<HighGuid::Creature>(571, 24000 + i % 50, 500000 + i));
+    for (uint32 i = 0; i < 512; ++i)
+        guids.push_back(ObjectGuid::Create<HighGuid::Player>(100 + i));
+    return guids;
+}
+}
+
+TEST_CASE("ObjectGuid", "[benchmark][ObjectGuid]")
+{
+    std::vector<ObjectGuid> guids = MakeGuids();
+
+    BENCHMARK("hash 1024 guids")
+    {
+        std::size_t hash = 0;
+        for (ObjectGuid const& guid : guids)
+            hash ^= std::hash<ObjectGuid>()(guid);
+        return hash;
+    };
+
+    BENCHMARK("insert 1024 guids into GuidUnorderedSet")
+    {
+        GuidUnorderedSet set;
+        for (ObjectGuid const& guid : guids)
+            set.insert(guid);
+        return set.size();
+    };
+
+    GuidUnorderedSet set(guids.begin(), guids.end());
+
+    BENCHMARK("find 1024 guids in GuidUnorderedSet")
+    {
+        std::size_t found = 0;
+        for (ObjectGuid const& guid : guids)
+            found += set.contains(guid);
+        return found;
+    };
+}
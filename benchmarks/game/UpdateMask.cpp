@@ -0,0 +1,85 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "UpdateMask.h"
+#include <bit>
+
+namespace
+{
+template <uint32 Bits>
+uint32 ForEachSetBit(UpdateMask<Bits> const& mask)
+{
+    uint32 sum = 0;
+    for (uint32 blocksMaskIndex = 0; blocksMaskIndex < UpdateMask<Bits>::BlocksMaskCount; ++blocksMaskIndex)
+    {
+        for (uint32 blocksMask = mask.GetBlocksMask(blocksMaskIndex); blocksMask; blocksMask &= blocksMask - 1)
+        {
+            uint32 blockIndex = blocksMaskIndex * 32 + std::countr_zero(blocksMask);
+            for (uint32 block = mask.GetBlock(blockIndex); block; block &= block - 1)
+                sum += blockIndex * 32 + std::countr_zero(block);
+        }
+    }
+    return sum;
+}
+
+template <uint32 Bits>
+uint32 ForEachBit(UpdateMask<Bits> const& mask)
+{
+    uint32 sum = 0;
+    for (uint32 i = 0; i < Bits; ++i)
+        if (mask[i])
+            sum += i;
+    return sum;
+}
+}
+
+TEST_CASE("UpdateMask", "[benchmark][UpdateMask]")
+{
+    using Mask = UpdateMask<2048>;
+
+    Mask sparse;
+    for (uint32 i = 0; i < 2048; i += 97)
+        sparse.Set(i);
+
+    Mask dense;
+    for (uint32 i = 0; i < 2048; i += 3)
+        dense.Set(i);
+
+    BENCHMARK("iterate sparse mask by blocks")
+    {
+        return ForEachSetBit(sparse);
+    };
+
+    BENCHMARK("iterate sparse mask bit by bit")
+    {
+        return ForEachBit(sparse);
+    };
+
+    BENCHMARK("iterate dense mask by blocks")
+    {
+        return ForEachSetBit(dense);
+    };
+
+    BENCHMARK("intersect masks")
+    {
+        Mask changes = dense;
+        changes &= sparse;
+        return changes.IsAnySet();
+    };
+}
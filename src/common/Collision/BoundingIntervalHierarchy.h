@@ -316,6 +316,93 @@ class TC_COMMON_API BIH
             }
         }
 
+        // calls intersectCallback(entry) for every primitive in a leaf overlapping box, may include primitives whose own bounds do not
+        template<typename IsectCallback>
+        void intersectBox(G3D::AABox const& box, IsectCallback& intersectCallback) const
+        {
+            if (!bounds.intersects(box))
+                return;
+
+            G3D::Vector3 const& lo = box.low();
+            G3D::Vector3 const& hi = box.high();
+            StackNode stack[MAX_STACK_SIZE];
+            int stackPos = 0;
+            int node = 0;
+
+            while (true)
+            {
+                while (true)
+                {
+                    uint32 tn = tree[node];
+                    uint32 axis = (tn & (3 << 30)) >> 30;
+                    bool BVH2 = (tn & (1 << 29)) != 0;
+                    int offset = tn & ~(7 << 29);
+                    if (!BVH2)
+                    {
+                        if (axis < 3)
+                        {
+                            // "normal" interior node
+                            float tl = advstd::bit_cast<float>(tree[node + 1]);
+                            float tr = advstd::bit_cast<float>(tree[node + 2]);
+                            bool left = lo[axis] <= tl;
+                            bool right = hi[axis] >= tr;
+                            int rightNode = offset + 3;
+                            if (left && right)
+                            {
+                                // box is in both nodes, push back right node
+                                stack[stackPos].node = rightNode;
+                                stackPos++;
+                                node = offset;
+                                continue;
+                            }
+                            if (left)
+                            {
+                                node = offset;
+                                continue;
+                            }
+                            if (right)
+                            {
+                                node = rightNode;
+                                continue;
+                            }
+                            // box is between clip zones
+                            break;
+                        }
+                        else
+                        {
+                            // leaf - report all objects
+                            int n = tree[node + 1];
+                            while (n > 0)
+                            {
+                                intersectCallback(objects[offset]);
+                                --n;
+                                ++offset;
+                            }
+                            break;
+                        }
+                    }
+                    else // BVH2 node (empty space cut off left and right)
+                    {
+                        if (axis > 2)
+                            return; // should not happen
+                        float tl = advstd::bit_cast<float>(tree[node + 1]);
+                        float tr = advstd::bit_cast<float>(tree[node + 2]);
+                        node = offset;
+                        if (tl > hi[axis] || tr < lo[axis])
+                            break;
+                        continue;
+                    }
+                } // traversal loop
+
+                // stack is empty?
+                if (stackPos == 0)
+                    return;
+                // move back up the stack
+                stackPos--;
+                node = stack[stackPos].node;
+            }
+        }
+
         bool writeToFile(FILE* wf) const;
         bool readFromFile(FILE* rf);
 
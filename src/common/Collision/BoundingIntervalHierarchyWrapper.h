@@ -32,8 +32,9 @@ class BIHWrap
         const T* const* objects;
         RayCallback& _callback;
         uint32 objects_size;
+        bool didHit;
 
-        MDLCallback(RayCallback& callback, const T* const* objects_array, uint32 objects_size ) : objects(objects_array), _callback(callback), objects_size(objects_size) { }
+        MDLCallback(RayCallback& callback, const T* const* objects_array, uint32 objects_size ) : objects(objects_array), _callback(callback), objects_size(objects_size), didHit(false) { }
 
         /// Intersect ray
         bool operator() (const G3D::Ray& ray, uint32 idx, float& maxDist, bool /*stopAtFirst*/)
@@ -41,7 +42,11 @@ class BIHWrap
             if (idx >= objects_size)
                 return false;
             if (const T* obj = objects[idx])
-                return _callback(ray, *obj, maxDist/*, stopAtFirst*/);
+            {
+                bool hit = _callback(ray, *obj, maxDist/*, stopAtFirst*/);
+                didHit = didHit || hit;
+                return hit;
+            }
             return false;
         }
 
@@ -53,13 +58,24 @@ class BIHWrap
             if (const T* obj = objects[idx])
                 _callback(p, *obj);
         }
+
+        /// Intersect box
+        void operator() (uint32 idx)
+        {
+            if (idx >= objects_size)
+                return;
+            if (const T* obj = objects[idx])
+                _callback(*obj);
+        }
     };
 
     typedef G3D::Array<const T*> ObjArray;
 
     BIH m_tree;
+    // objects in m_tree, removed ones are left as nullptr until the next balance()
     ObjArray m_objects;
     G3D::Table<const T*, uint32> m_obj2Idx;
+    // objects inserted (or moved) since the last balance(), checked one by one next to m_tree
     G3D::Set<const T*> m_objects_to_push;
     int unbalanced_times;
 
@@ -92,25 +108,52 @@ public:
         m_objects.fastClear();
         m_obj2Idx.getKeys(m_objects);
         m_objects_to_push.getMembers(m_objects);
-        //assert that m_obj2Idx has all the keys
+        m_objects_to_push.clear();
+
+        m_obj2Idx.clear();
+        for (int i = 0; i < m_objects.size(); ++i)
+            m_obj2Idx.set(m_objects[i], uint32(i));
 
         m_tree.build(m_objects, BoundsFunc());
     }
 
+    bool isBalanced() const { return unbalanced_times == 0; }
+
+    // queries never rebuild the tree, objects not yet in it are checked one by one
     template<typename RayCallback>
     void intersectRay(const G3D::Ray& ray, RayCallback& intersectCallback, float& maxDist)
     {
-        balance();
         MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_objects.size());
         m_tree.intersectRay(ray, temp_cb, maxDist, true);
+        if (temp_cb.didHit)
+            return;
+
+        for (const T* obj : m_objects_to_push)
+            if (intersectCallback(ray, *obj, maxDist))
+                return;
     }
 
     template<typename IsectCallback>
     void intersectPoint(const G3D::Vector3& point, IsectCallback& intersectCallback)
     {
-        balance();
         MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
         m_tree.intersectPoint(point, callback);
+        for (const T* obj : m_objects_to_push)
+            intersectCallback(point, *obj);
+    }
+
+    template<typename IsectCallback>
+    void intersectBox(const G3D::AABox& box, IsectCallback& intersectCallback)
+    {
+        MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
+        m_tree.intersectBox(box, callback);
+        G3D::AABox bounds;
+        for (const T* obj : m_objects_to_push)
+        {
+            BoundsFunc::getBounds(*obj, bounds);
+            if (bounds.intersects(box))
+                intersectCallback(*obj);
+        }
     }
 };
 
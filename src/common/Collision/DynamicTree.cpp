@@ -32,6 +32,8 @@
 namespace {
 
 int CHECK_TREE_PERIOD = 200;
+// grid cells rebuilt per update, spreads rebuilding after heavy churn (sieges, transports) over several updates
+std::size_t MAX_BALANCED_CELLS_PER_UPDATE = 16;
 
 } // namespace
 
@@ -62,45 +64,27 @@ struct DynTreeImpl : public ParentTree/*, public Intersectable*/
     typedef ParentTree base;
 
     DynTreeImpl() :
-        rebalance_timer(CHECK_TREE_PERIOD),
-        unbalanced_times(0)
+        rebalance_timer(CHECK_TREE_PERIOD)
     {
     }
 
-    void insert(Model const& mdl)
-    {
-        base::insert(mdl);
-        ++unbalanced_times;
-    }
-
-    void remove(Model const& mdl)
-    {
-        base::remove(mdl);
-        ++unbalanced_times;
-    }
-
-    void balance()
-    {
-        base::balance();
-        unbalanced_times = 0;
-    }
-
+    // models inserted or moved since the last rebuild of their cells are queried without the cell BIH,
+    // so cells only need to be rebuilt to keep queries fast, not to keep them correct
     void update(uint32 difftime)
     {
-        if (empty())
+        if (isBalanced())
             return;
 
         rebalance_timer.Update(difftime);
         if (rebalance_timer.Passed())
         {
-            rebalance_timer.Reset(CHECK_TREE_PERIOD);
-            if (unbalanced_times > 0)
-                balance();
+            // keeps rebuilding on following updates until all cells are done
+            if (base::balance(MAX_BALANCED_CELLS_PER_UPDATE))
+                rebalance_timer.Reset(CHECK_TREE_PERIOD);
         }
     }
 
     TimeTracker rebalance_timer;
-    int unbalanced_times;
 };
 
 DynamicMapTree::DynamicMapTree() : impl(new DynTreeImpl()) { }
@@ -251,6 +235,54 @@ bool DynamicMapTree::isInLineOfSight(G3D::Vector3 const& startPos, G3D::Vector3
     return !callback.didHit();
 }
 
+void DynamicMapTree::isInLineOfSight(G3D::Vector3 const& startPos, std::span<G3D::Vector3 const> endPositions, std::span<bool> results, PhaseShift const& phaseShift) const
+{
+    ASSERT(endPositions.size() == results.size());
+
+    G3D::AABox batchBounds(startPos, startPos);
+    for (G3D::Vector3 const& endPos : endPositions)
+        batchBounds.merge(endPos);
+
+    std::vector<GameObjectModel const*> candidates;
+    auto collectCandidate = [&](GameObjectModel const& model)
+    {
+        if (!model.IsLosBlockingDisabled())
+            candidates.push_back(&model);
+    };
+    impl->intersectBox(batchBounds, collectCandidate);
+    if (candidates.empty())
+        return;
+
+    // models spanning several grid cells are found once per cell
+    std::ranges::sort(candidates);
+    candidates.erase(std::ranges::unique(candidates).begin(), candidates.end());
+
+    for (std::size_t i = 0; i < endPositions.size(); ++i)
+    {
+        if (!results[i])
+            continue;
+
+        float maxDist = (endPositions[i] - startPos).magnitude();
+        if (!G3D::fuzzyGt(maxDist, 0))
+            continue;
+
+        G3D::AABox rayBounds(startPos.min(endPositions[i]), startPos.max(endPositions[i]));
+        G3D::Ray r(startPos, (endPositions[i] - startPos) / maxDist);
+        for (GameObjectModel const* model : candidates)
+        {
+            if (!model->getBounds().intersects(rayBounds))
+                continue;
+
+            float distance = maxDist;
+            if (model->IntersectRay(r, distance, true, phaseShift, VMAP::ModelIgnoreFlags::Nothing))
+            {
+                results[i] = false;
+                break;
+            }
+        }
+    }
+}
+
 float DynamicMapTree::getHeight(float x, float y, float z, float maxSearchDist, PhaseShift const& phaseShift) const
 {
     G3D::Vector3 v(x, y, z);
@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "Optional.h"
+#include <span>
 
 namespace G3D
 {
@@ -46,6 +47,8 @@ public:
     ~DynamicMapTree();
 
     bool isInLineOfSight(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, PhaseShift const& phaseShift) const;
+    // clears results[i] if the line from startPos to endPositions[i] is blocked, the grid is only searched once for all of them
+    void isInLineOfSight(G3D::Vector3 const& startPos, std::span<G3D::Vector3 const> endPositions, std::span<bool> results, PhaseShift const& phaseShift) const;
     bool getIntersectionTime(G3D::Ray const& ray, G3D::Vector3 const& endPos, PhaseShift const& phaseShift, float& maxDist) const;
     bool getObjectHitPos(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, G3D::Vector3& resultHitPos, float modifyDist, PhaseShift const& phaseShift) const;
 
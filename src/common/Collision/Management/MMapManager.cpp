@@ -19,6 +19,8 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MMapDefines.h"
+#include <memory>
+#include <zlib.h>
 
 namespace MMAP
 {
@@ -178,15 +180,46 @@ namespace MMAP
 
         fseek(file, pos, SEEK_SET);
 
-        unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
-        ASSERT(data);
+        unsigned char* data = nullptr;
+        uint32 dataSize = fileHeader.size;
+        if (fileHeader.flags & MMAP_TILE_FLAG_COMPRESSED)
+        {
+            std::unique_ptr<Bytef[]> compressed = std::make_unique<Bytef[]>(fileHeader.size);
+            if (fileHeader.size <= sizeof(uint32) || fread(compressed.get(), fileHeader.size, 1, file) != 1)
+            {
+                TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:04}{:02}{:02}.mmtile", mapId, x, y);
+                fclose(file);
+                return false;
+            }
+
+            memcpy(&dataSize, compressed.get(), sizeof(uint32));
 
-        size_t result = fread(data, fileHeader.size, 1, file);
-        if (!result)
+            // decompress straight into the buffer that is handed over to detour
+            data = (unsigned char*)dtAlloc(dataSize, DT_ALLOC_PERM);
+            ASSERT(data);
+
+            uLongf uncompressedSize = dataSize;
+            if (uncompress(data, &uncompressedSize, compressed.get() + sizeof(uint32), fileHeader.size - sizeof(uint32)) != Z_OK || uncompressedSize != dataSize)
+            {
+                TC_LOG_ERROR("maps", "MMAP:loadMap: Could not decompress mmap {:04}{:02}{:02}.mmtile", mapId, x, y);
+                dtFree(data);
+                fclose(file);
+                return false;
+            }
+        }
+        else
         {
-            TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:04}{:02}{:02}.mmtile", mapId, x, y);
-            fclose(file);
-            return false;
+            data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
+            ASSERT(data);
+
+            size_t result = fread(data, fileHeader.size, 1, file);
+            if (!result)
+            {
+                TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:04}{:02}{:02}.mmtile", mapId, x, y);
+                dtFree(data);
+                fclose(file);
+                return false;
+            }
         }
 
         fclose(file);
@@ -195,9 +228,10 @@ namespace MMAP
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        if (dtStatusSucceed(mmap->navMesh->addTile(data, dataSize, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            mmap->pathCache.Clear();
             ++loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:04}[{:02}, {:02}] into {:04}[{:02}, {:02}]", mapId, x, y, mapId, header->x, header->y);
             return true;
@@ -271,6 +305,7 @@ namespace MMAP
         else
         {
             mmap->loadedTileRefs.erase(tileRefItr);
+            mmap->pathCache.Clear();
             --loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:04}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
             return true;
@@ -346,6 +381,66 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    NavMeshPathCache* MMapManager::GetPathCache(uint32 meshMapId)
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(meshMapId);
+        if (itr == loadedMMaps.end())
+            return nullptr;
+
+        return &itr->second->pathCache;
+    }
+
+    PooledNavMeshQuery MMapManager::AcquireNavMeshQuery(uint32 meshMapId)
+    {
+        auto itr = GetMMapData(meshMapId);
+        if (itr == loadedMMaps.end())
+            return {};
+
+        MMapData* mmap = itr->second;
+        {
+            std::lock_guard<std::mutex> lock(mmap->queryPoolLock);
+            if (!mmap->queryPool.empty())
+            {
+                dtNavMeshQuery* query = mmap->queryPool.back();
+                mmap->queryPool.pop_back();
+                return { mmap, query };
+            }
+        }
+
+        dtNavMeshQuery* query = dtAllocNavMeshQuery();
+        ASSERT(query);
+        if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
+        {
+            dtFreeNavMeshQuery(query);
+            TC_LOG_ERROR("maps", "MMAP:AcquireNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:04}", meshMapId);
+            return {};
+        }
+
+        TC_LOG_DEBUG("maps", "MMAP:AcquireNavMeshQuery: created pooled dtNavMeshQuery for mapId {:04}", meshMapId);
+        return { mmap, query };
+    }
+
+    PooledNavMeshQuery& PooledNavMeshQuery::operator=(PooledNavMeshQuery&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Release();
+            _data = std::exchange(other._data, nullptr);
+            _query = std::exchange(other._query, nullptr);
+        }
+        return *this;
+    }
+
+    void PooledNavMeshQuery::Release()
+    {
+        if (!_query)
+            return;
+
+        std::lock_guard<std::mutex> lock(_data->queryPoolLock);
+        _data->queryPool.push_back(std::exchange(_query, nullptr));
+        _data = nullptr;
+    }
+
     dtNavMeshQuery const* MMapManager::GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId)
     {
         auto itr = GetMMapData(meshMapId);
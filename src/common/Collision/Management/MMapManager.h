@@ -22,8 +22,11 @@
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
 #include "Hash.h"
+#include "NavMeshPathCache.h"
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 //  move map related classes
@@ -41,6 +44,9 @@ namespace MMAP
             for (NavMeshQuerySet::iterator i = navMeshQueries.begin(); i != navMeshQueries.end(); ++i)
                 dtFreeNavMeshQuery(i->second);
 
+            for (dtNavMeshQuery* query : queryPool)
+                dtFreeNavMeshQuery(query);
+
             if (navMesh)
                 dtFreeNavMesh(navMesh);
         }
@@ -48,10 +54,40 @@ namespace MMAP
         // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
         NavMeshQuerySet navMeshQueries;     // instanceId to query
 
+        // queries not bound to any instance, leased by PooledNavMeshQuery to whichever thread needs one
+        std::mutex queryPoolLock;
+        std::vector<dtNavMeshQuery*> queryPool;
+
+        // cleared every time a tile is added or removed
+        NavMeshPathCache pathCache;
+
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs;        // maps [map grid coords] to [dtTile]
     };
 
+    // exclusive use of a dtNavMeshQuery, it is returned to the pool of its navmesh when destroyed
+    class TC_COMMON_API PooledNavMeshQuery
+    {
+        public:
+            PooledNavMeshQuery() : _data(nullptr), _query(nullptr) { }
+            PooledNavMeshQuery(MMapData* data, dtNavMeshQuery* query) : _data(data), _query(query) { }
+            PooledNavMeshQuery(PooledNavMeshQuery const&) = delete;
+            PooledNavMeshQuery(PooledNavMeshQuery&& other) noexcept : _data(std::exchange(other._data, nullptr)), _query(std::exchange(other._query, nullptr)) { }
+            PooledNavMeshQuery& operator=(PooledNavMeshQuery const&) = delete;
+            PooledNavMeshQuery& operator=(PooledNavMeshQuery&& other) noexcept;
+            ~PooledNavMeshQuery() { Release(); }
+
+            dtNavMeshQuery* get() const { return _query; }
+            dtNavMeshQuery* operator->() const { return _query; }
+            explicit operator bool() const { return _query != nullptr; }
+
+        private:
+            void Release();
+
+            MMapData* _data;
+            dtNavMeshQuery* _query;
+    };
+
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
 
     // singleton class
@@ -71,7 +107,11 @@ namespace MMAP
 
             // the returned [dtNavMeshQuery const*] is NOT threadsafe
             dtNavMeshQuery const* GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
+            // safe to call from any thread, the navmesh itself must not have tiles added or removed while the query is in use
+            PooledNavMeshQuery AcquireNavMeshQuery(uint32 meshMapId);
             dtNavMesh const* GetNavMesh(uint32 mapId);
+            // safe to call from any thread
+            NavMeshPathCache* GetPathCache(uint32 meshMapId);
 
             uint32 getLoadedTilesCount() const { return loadedTiles; }
             uint32 getLoadedMapsCount() const { return uint32(loadedMMaps.size()); }
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NavMeshPathCache.h"
+#include "Hash.h"
+#include <algorithm>
+
+namespace MMAP
+{
+    std::size_t NavMeshPathCache::KeyHash::operator()(Key const& key) const
+    {
+        std::size_t hashVal = 0;
+        Trinity::hash_combine(hashVal, key.StartPoly);
+        Trinity::hash_combine(hashVal, key.EndPoly);
+        Trinity::hash_combine(hashVal, key.IncludeFlags);
+        Trinity::hash_combine(hashVal, key.ExcludeFlags);
+        return hashVal;
+    }
+
+    bool NavMeshPathCache::Find(Key const& key, dtPolyRef* path, uint32& pathSize, uint32 maxPathSize)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto itr = _index.find(key);
+        if (itr == _index.end())
+            return false;
+
+        std::vector<dtPolyRef> const& polys = itr->second->second;
+        if (polys.size() > maxPathSize)
+            return false;
+
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        std::copy(polys.begin(), polys.end(), path);
+        pathSize = uint32(polys.size());
+        return true;
+    }
+
+    void NavMeshPathCache::Store(Key const& key, dtPolyRef const* path, uint32 pathSize)
+    {
+        if (!_capacity || !pathSize)
+            return;
+
+        std::lock_guard<std::mutex> lock(_lock);
+        auto itr = _index.find(key);
+        if (itr != _index.end())
+        {
+            itr->second->second.assign(path, path + pathSize);
+            _entries.splice(_entries.begin(), _entries, itr->second);
+            return;
+        }
+
+        if (_entries.size() >= _capacity)
+        {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+
+        _entries.emplace_front(key, std::vector<dtPolyRef>(path, path + pathSize));
+        _index.emplace(key, _entries.begin());
+    }
+
+    void NavMeshPathCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _index.clear();
+        _entries.clear();
+    }
+
+    std::size_t NavMeshPathCache::GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _entries.size();
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_NAV_MESH_PATH_CACHE_H
+#define TRINITYCORE_NAV_MESH_PATH_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MMAP
+{
+    // Least recently used poly corridors found by dtNavMeshQuery::findPath, shared by everything pathing on one navmesh
+    // Corridors are reused regardless of where exactly inside the start and end polygons the path begins or ends
+    class TC_COMMON_API NavMeshPathCache
+    {
+        public:
+            static constexpr std::size_t DefaultCapacity = 512;
+
+            struct Key
+            {
+                dtPolyRef StartPoly = 0;
+                dtPolyRef EndPoly = 0;
+                uint16 IncludeFlags = 0;
+                uint16 ExcludeFlags = 0;
+
+                friend bool operator==(Key const& left, Key const& right) = default;
+            };
+
+            explicit NavMeshPathCache(std::size_t capacity = DefaultCapacity) : _capacity(capacity) { }
+
+            // copies the cached corridor into path, fails if none is cached or it does not fit into maxPathSize
+            bool Find(Key const& key, dtPolyRef* path, uint32& pathSize, uint32 maxPathSize);
+            void Store(Key const& key, dtPolyRef const* path, uint32 pathSize);
+
+            // cached corridors may no longer exist or be the shortest ones once tiles are added or removed
+            void Clear();
+
+            std::size_t GetSize() const;
+
+        private:
+            struct KeyHash
+            {
+                std::size_t operator()(Key const& key) const;
+            };
+
+            using EntryList = std::list<std::pair<Key, std::vector<dtPolyRef>>>;
+
+            mutable std::mutex _lock;
+            std::size_t _capacity;
+            EntryList _entries;                 // most recently used first
+            std::unordered_map<Key, EntryList::iterator, KeyHash> _index;
+    };
+}
+
+#endif // TRINITYCORE_NAV_MESH_PATH_CACHE_H
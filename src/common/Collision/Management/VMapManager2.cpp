@@ -57,6 +57,7 @@ namespace VMAP
         GetLiquidFlagsPtr = &GetLiquidFlagsDummy;
         IsVMAPDisabledForPtr = &IsVMAPDisabledForDummy;
         thread_safe_environment = true;
+        iPackTriangles = false;
     }
 
     VMapManager2::~VMapManager2()
@@ -181,6 +182,23 @@ namespace VMAP
         return true;
     }
 
+    void VMapManager2::isInLineOfSight(unsigned int mapId, G3D::Vector3 const& origin, std::span<G3D::Vector3 const> targets, std::span<bool> results, ModelIgnoreFlags ignoreFlags)
+    {
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+            return;
+
+        auto instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end() || !instanceTree->second)
+            return;
+
+        std::vector<Vector3> internalTargets;
+        internalTargets.reserve(targets.size());
+        for (Vector3 const& target : targets)
+            internalTargets.push_back(convertPositionToInternalRep(target.x, target.y, target.z));
+
+        instanceTree->second->isInLineOfSight(convertPositionToInternalRep(origin.x, origin.y, origin.z), internalTargets, results, ignoreFlags);
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
@@ -283,6 +301,9 @@ namespace VMAP
         }
         TC_LOG_DEBUG("maps", "VMapManager2: loading file '{}{}'", basepath, filename);
 
+        if (iPackTriangles)
+            worldmodel->Model.PackTriangles();
+
         model = worldmodel;
 
         return std::shared_ptr<WorldModel>(worldmodel, &worldmodel->Model);
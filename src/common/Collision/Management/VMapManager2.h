@@ -22,6 +22,7 @@
 #include "IVMapManager.h"
 #include <memory>
 #include <mutex>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -67,6 +68,7 @@ namespace VMAP
             InstanceTreeMap iInstanceMapTrees;
             std::unordered_map<uint32, uint32> iParentMapData;
             bool thread_safe_environment;
+            bool iPackTriangles;
             // Mutex for iLoadedModelFiles
             std::mutex LoadedModelFilesLock;
 
@@ -92,6 +94,8 @@ namespace VMAP
             void unloadMap(unsigned int mapId) override;
 
             bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) override ;
+            // clears results[i] if the line from origin to targets[i] is blocked, positions are in world coordinates
+            void isInLineOfSight(unsigned int mapId, G3D::Vector3 const& origin, std::span<G3D::Vector3 const> targets, std::span<bool> results, ModelIgnoreFlags ignoreFlags);
             /**
             fill the hit pos and return true, if an object was hit
             */
@@ -102,6 +106,11 @@ namespace VMAP
 
             bool getAreaAndLiquidData(uint32 mapId, float x, float y, float z, Optional<uint8> reqLiquidType, AreaAndLiquidData& data) const override;
 
+            /**
+            Precompute triangle edges of models loaded from now on, see GroupModel::PackTriangles
+            */
+            void setPackTriangles(bool pVal) { iPackTriangles = pVal; }
+
             std::shared_ptr<WorldModel> acquireModelInstance(std::string const& basepath, std::string const& filename);
             void releaseModelInstance(std::string const& filename);
 
@@ -24,6 +24,12 @@
 const uint32 MMAP_MAGIC = 0x4d4d4150; // 'MMAP'
 #define MMAP_VERSION 15
 
+enum MmapTileFlags : uint8
+{
+    MMAP_TILE_FLAG_NONE         = 0x0,
+    MMAP_TILE_FLAG_COMPRESSED   = 0x1   // data is a uint32 with the size of the detour tile followed by the zlib compressed tile, size is the size of both
+};
+
 struct MmapTileHeader
 {
     uint32 mmapMagic;
@@ -31,10 +37,11 @@ struct MmapTileHeader
     uint32 mmapVersion;
     uint32 size;
     char usesLiquids;
-    char padding[3];
+    uint8 flags;
+    char padding[2];
 
     MmapTileHeader() : mmapMagic(MMAP_MAGIC), dtVersion(DT_NAVMESH_VERSION),
-        mmapVersion(MMAP_VERSION), size(0), usesLiquids(true), padding() { }
+        mmapVersion(MMAP_VERSION), size(0), usesLiquids(true), flags(MMAP_TILE_FLAG_NONE), padding() { }
 };
 
 // All padding fields must be handled and initialized to ensure mmaps_generator will produce binary-identical *.mmtile files
@@ -44,6 +51,7 @@ static_assert(sizeof(MmapTileHeader) == sizeof(MmapTileHeader::mmapMagic) +
                                         sizeof(MmapTileHeader::mmapVersion) +
                                         sizeof(MmapTileHeader::size) +
                                         sizeof(MmapTileHeader::usesLiquids) +
+                                        sizeof(MmapTileHeader::flags) +
                                         sizeof(MmapTileHeader::padding), "MmapTileHeader has uninitialized padding fields");
 
 enum NavArea
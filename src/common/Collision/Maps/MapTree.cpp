@@ -130,6 +130,55 @@ namespace VMAP
 
         return true;
     }
+    //=========================================================
+
+    void StaticMapTree::isInLineOfSight(Vector3 const& origin, std::span<Vector3 const> targets, std::span<bool> results, ModelIgnoreFlags ignoreFlags) const
+    {
+        ASSERT(targets.size() == results.size());
+
+        G3D::AABox batchBounds(origin, origin);
+        for (Vector3 const& target : targets)
+            batchBounds.merge(target);
+
+        // every model any of the rays can hit is in a leaf overlapping the bounds of all rays
+        std::vector<uint32> candidates;
+        auto collectCandidate = [&](uint32 entry) { candidates.push_back(entry); };
+        iTree.intersectBox(batchBounds, collectCandidate);
+
+        for (std::size_t i = 0; i < targets.size(); ++i)
+        {
+            if (!results[i])
+                continue;
+
+            float maxDist = (targets[i] - origin).magnitude();
+            // same rules as the single ray version
+            if (maxDist == std::numeric_limits<float>::max() || !std::isfinite(maxDist))
+            {
+                results[i] = false;
+                continue;
+            }
+
+            if (maxDist < 1e-10f)
+                continue;
+
+            G3D::AABox rayBounds(origin.min(targets[i]), origin.max(targets[i]));
+            G3D::Ray ray = G3D::Ray::fromOriginAndDirection(origin, (targets[i] - origin) / maxDist);
+            for (uint32 entry : candidates)
+            {
+                ModelInstance const& model = iTreeValues[entry];
+                if (!model.getBounds().intersects(rayBounds))
+                    continue;
+
+                float distance = maxDist;
+                if (model.intersectRay(ray, distance, true, ignoreFlags))
+                {
+                    results[i] = false;
+                    break;
+                }
+            }
+        }
+    }
+
     //=========================================================
     /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
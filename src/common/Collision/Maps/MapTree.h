@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "BoundingIntervalHierarchy.h"
+#include <span>
 #include <unordered_map>
 
 namespace VMAP
@@ -71,6 +72,8 @@ namespace VMAP
             ~StaticMapTree();
 
             bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2, ModelIgnoreFlags ignoreFlags) const;
+            // clears results[i] if the line from origin to targets[i] is blocked, the tree is only walked once for all of them
+            void isInLineOfSight(G3D::Vector3 const& origin, std::span<G3D::Vector3 const> targets, std::span<bool> results, ModelIgnoreFlags ignoreFlags) const;
             bool getObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
             float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
             bool GetLocationInfo(const G3D::Vector3 &pos, LocationInfo &info) const;
@@ -32,14 +32,12 @@ template<> struct BoundsTrait<VMAP::GroupModel>
 
 namespace VMAP
 {
-    bool IntersectTriangle(MeshTriangle const& tri, std::vector<Vector3>::const_iterator points, G3D::Ray const& ray, float& distance)
+    bool IntersectTriangle(Vector3 const& v0, Vector3 const& e1, Vector3 const& e2, G3D::Ray const& ray, float& distance)
     {
         static const float EPS = 1e-5f;
 
         // See RTR2 ch. 13.7 for the algorithm.
 
-        const Vector3 e1 = points[tri.idx1] - points[tri.idx0];
-        const Vector3 e2 = points[tri.idx2] - points[tri.idx0];
         const Vector3 p(ray.direction().cross(e2));
         const float a = e1.dot(p);
 
@@ -49,7 +47,7 @@ namespace VMAP
         }
 
         const float f = 1.0f / a;
-        const Vector3 s(ray.origin() - points[tri.idx0]);
+        const Vector3 s(ray.origin() - v0);
         const float u = f * s.dot(p);
 
         if ((u < 0.0f) || (u > 1.0f)) {
@@ -82,6 +80,16 @@ namespace VMAP
         return false;
     }
 
+    bool IntersectTriangle(MeshTriangle const& tri, std::vector<Vector3>::const_iterator points, G3D::Ray const& ray, float& distance)
+    {
+        return IntersectTriangle(points[tri.idx0], points[tri.idx1] - points[tri.idx0], points[tri.idx2] - points[tri.idx0], ray, distance);
+    }
+
+    bool IntersectTriangle(PackedTriangle const& tri, G3D::Ray const& ray, float& distance)
+    {
+        return IntersectTriangle(tri.Vertex0, tri.Edge1, tri.Edge2, ray, distance);
+    }
+
     class TriBoundFunc
     {
         public:
@@ -290,7 +298,7 @@ namespace VMAP
 
     GroupModel::GroupModel(GroupModel const& other) :
         iBound(other.iBound), iMogpFlags(other.iMogpFlags), iGroupWMOID(other.iGroupWMOID),
-        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), iLiquid(nullptr)
+        vertices(other.vertices), triangles(other.triangles), packedTriangles(other.packedTriangles), meshTree(other.meshTree), iLiquid(nullptr)
     {
         if (other.iLiquid)
             iLiquid = new WmoLiquid(*other.iLiquid);
@@ -300,6 +308,7 @@ namespace VMAP
     {
         vertices = std::move(vert);
         triangles = std::move(tri);
+        packedTriangles.clear();
         TriBoundFunc bFunc(vertices);
         meshTree.build(triangles, bFunc);
     }
@@ -357,6 +366,7 @@ namespace VMAP
         uint32 chunkSize = 0;
         uint32 count = 0;
         triangles.clear();
+        packedTriangles.clear();
         vertices.clear();
         delete iLiquid;
         iLiquid = nullptr;
@@ -393,6 +403,29 @@ namespace VMAP
         return result;
     }
 
+    void GroupModel::PackTriangles()
+    {
+        packedTriangles.clear();
+        packedTriangles.reserve(triangles.size());
+        for (MeshTriangle const& tri : triangles)
+        {
+            Vector3 const& v0 = vertices[tri.idx0];
+            packedTriangles.push_back({ .Vertex0 = v0, .Edge1 = vertices[tri.idx1] - v0, .Edge2 = vertices[tri.idx2] - v0 });
+        }
+    }
+
+    struct GModelPackedRayCallback
+    {
+        GModelPackedRayCallback(std::vector<PackedTriangle> const& tris) : triangles(tris.data()), hit(false) { }
+        bool operator()(G3D::Ray const& ray, uint32 entry, float& distance, bool /*pStopAtFirstHit*/)
+        {
+            hit = IntersectTriangle(triangles[entry], ray, distance) || hit;
+            return hit;
+        }
+        PackedTriangle const* triangles;
+        bool hit;
+    };
+
     struct GModelRayCallback
     {
         GModelRayCallback(std::vector<MeshTriangle> const& tris, const std::vector<Vector3> &vert):
@@ -412,6 +445,13 @@ namespace VMAP
         if (triangles.empty())
             return false;
 
+        if (!packedTriangles.empty())
+        {
+            GModelPackedRayCallback callback(packedTriangles);
+            meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
+            return callback.hit;
+        }
+
         GModelRayCallback callback(triangles, vertices);
         meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
         return callback.hit;
@@ -481,6 +521,12 @@ namespace VMAP
         groupTree.build(groupModels, BoundsTrait<GroupModel>(), 1);
     }
 
+    void WorldModel::PackTriangles()
+    {
+        for (GroupModel& groupModel : groupModels)
+            groupModel.PackTriangles();
+    }
+
     struct WModelRayCallBack
     {
         WModelRayCallBack(std::vector<GroupModel> const& mod): models(mod.begin()), hit(false) { }
@@ -23,7 +23,9 @@
 #include <G3D/Ray.h>
 #include <G3D/BoundsTrait.h>
 #include <G3D/PositionTrait.h>
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 template<class Node>
 struct NodeCreator{
@@ -51,6 +53,8 @@ public:
 
     MemberTable memberTable;
     Node* nodes[CELL_NUMBER][CELL_NUMBER];
+    // nodes changed since their last balance
+    std::unordered_set<Node*> unbalancedNodes;
 
     RegularGrid2D()
     {
@@ -77,6 +81,7 @@ public:
                 Node& node = getGrid(x, y);
                 node.insert(value);
                 memberTable.emplace(&value, &node);
+                unbalancedNodes.insert(&node);
             }
         }
     }
@@ -84,19 +89,36 @@ public:
     void remove(const T& value)
     {
         for (auto& p : Trinity::Containers::MapEqualRange(memberTable, &value))
+        {
             p.second->remove(value);
+            unbalancedNodes.insert(p.second);
+        }
         // Remove the member
         memberTable.erase(&value);
     }
 
     void balance()
     {
-        for (int x = 0; x < CELL_NUMBER; ++x)
-            for (int y = 0; y < CELL_NUMBER; ++y)
-                if (Node* n = nodes[x][y])
-                    n->balance();
+        for (Node* n : unbalancedNodes)
+            n->balance();
+        unbalancedNodes.clear();
     }
 
+    // balances at most maxNodes nodes, returns true when no unbalanced nodes are left
+    bool balance(std::size_t maxNodes)
+    {
+        while (maxNodes-- && !unbalancedNodes.empty())
+        {
+            auto itr = unbalancedNodes.begin();
+            (*itr)->balance();
+            unbalancedNodes.erase(itr);
+        }
+
+        return unbalancedNodes.empty();
+    }
+
+    bool isBalanced() const { return unbalancedNodes.empty(); }
+
     bool contains(const T& value) const { return memberTable.count(&value) > 0; }
     bool empty() const { return memberTable.empty(); }
 
@@ -125,6 +147,22 @@ public:
         return *nodes[x][y];
     }
 
+    // objects spanning several cells are reported once per cell
+    template<typename IsectCallback>
+    void intersectBox(const G3D::AABox& box, IsectCallback& intersectCallback)
+    {
+        Cell low = Cell::ComputeCell(box.low().x, box.low().y);
+        Cell high = Cell::ComputeCell(box.high().x, box.high().y);
+        low.x = std::max(low.x, 0);
+        low.y = std::max(low.y, 0);
+        high.x = std::min(high.x, int(CELL_NUMBER) - 1);
+        high.y = std::min(high.y, int(CELL_NUMBER) - 1);
+        for (int x = low.x; x <= high.x; ++x)
+            for (int y = low.y; y <= high.y; ++y)
+                if (Node* node = nodes[x][y])
+                    node->intersectBox(box, intersectCallback);
+    }
+
     template<typename RayCallback>
     void intersectRay(const G3D::Ray& ray, RayCallback& intersectCallback, float max_dist)
     {
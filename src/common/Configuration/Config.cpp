@@ -24,6 +24,7 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/property_tree/ini_parser.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 #include <mutex>
@@ -36,9 +37,23 @@ namespace
     std::string _filename;
     std::vector<std::string> _additonalFiles;
     std::vector<std::string> _args;
-    bpt::ptree _config;
     std::mutex _configLock;
 
+    // readers load the current tree without locking, writers build a new one under _configLock and publish it whole
+    std::atomic<std::shared_ptr<bpt::ptree const>> _config = std::make_shared<bpt::ptree const>();
+    std::atomic<uint32> _configVersion = 0;
+
+    std::shared_ptr<bpt::ptree const> GetConfig()
+    {
+        return _config.load(std::memory_order_acquire);
+    }
+
+    void PublishConfig(bpt::ptree&& config)
+    {
+        _config.store(std::make_shared<bpt::ptree const>(std::move(config)), std::memory_order_release);
+        _configVersion.fetch_add(1, std::memory_order_release);
+    }
+
     bool LoadFile(std::string const& file, bpt::ptree& fullTree, std::string& error)
     {
         try
@@ -132,6 +147,50 @@ namespace
 
         return {};
     }
+
+    bool LoadInitialTree(std::string const& file, bpt::ptree& config, std::string& error)
+    {
+        bpt::ptree fullTree;
+        if (!LoadFile(file, fullTree, error))
+            return false;
+
+        // Since we're using only one section per config file, we skip the section and have direct property access
+        config = std::move(fullTree.begin()->second);
+        return true;
+    }
+
+    bool MergeAdditionalFile(std::string const& file, bpt::ptree& config, std::string& error)
+    {
+        bpt::ptree fullTree;
+        if (!LoadFile(file, fullTree, error))
+            return false;
+
+        for (bpt::ptree::value_type const& child : fullTree.begin()->second)
+            config.put_child(bpt::ptree::path_type(child.first, '/'), child.second);
+
+        return true;
+    }
+
+    std::vector<std::string> OverrideWithEnvVariables(bpt::ptree& config)
+    {
+        std::vector<std::string> overriddenKeys;
+
+        for (bpt::ptree::value_type& itr : config)
+        {
+            if (!itr.second.empty() || itr.first.empty())
+                continue;
+
+            Optional<std::string> envVar = EnvVarForIniKey(itr.first);
+            if (!envVar)
+                continue;
+
+            itr.second = bpt::ptree(*envVar);
+
+            overriddenKeys.push_back(itr.first);
+        }
+
+        return overriddenKeys;
+    }
 }
 
 bool ConfigMgr::LoadInitial(std::string file, std::vector<std::string> args,
@@ -142,26 +201,23 @@ bool ConfigMgr::LoadInitial(std::string file, std::vector<std::string> args,
     _filename = std::move(file);
     _args = std::move(args);
 
-    bpt::ptree fullTree;
-    if (!LoadFile(_filename, fullTree, error))
+    bpt::ptree config;
+    if (!LoadInitialTree(_filename, config, error))
         return false;
 
-    // Since we're using only one section per config file, we skip the section and have direct property access
-    _config = fullTree.begin()->second;
-
+    PublishConfig(std::move(config));
     return true;
 }
 
 bool ConfigMgr::LoadAdditionalFile(std::string file, bool keepOnReload, std::string& error)
 {
-    bpt::ptree fullTree;
-    if (!LoadFile(file, fullTree, error))
-        return false;
-
     std::lock_guard<std::mutex> lock(_configLock);
 
-    for (bpt::ptree::value_type const& child : fullTree.begin()->second)
-        _config.put_child(bpt::ptree::path_type(child.first, '/'), child.second);
+    bpt::ptree config = *GetConfig();
+    if (!MergeAdditionalFile(file, config, error))
+        return false;
+
+    PublishConfig(std::move(config));
 
     if (keepOnReload)
         _additonalFiles.emplace_back(std::move(file));
@@ -199,21 +255,10 @@ std::vector<std::string> ConfigMgr::OverrideWithEnvVariablesIfAny()
 {
     std::lock_guard<std::mutex> lock(_configLock);
 
-    std::vector<std::string> overriddenKeys;
-
-    for (bpt::ptree::value_type& itr: _config)
-    {
-        if (!itr.second.empty() || itr.first.empty())
-            continue;
-
-        Optional<std::string> envVar = EnvVarForIniKey(itr.first);
-        if (!envVar)
-            continue;
-
-        itr.second = bpt::ptree(*envVar);
-
-        overriddenKeys.push_back(itr.first);
-    }
+    bpt::ptree config = *GetConfig();
+    std::vector<std::string> overriddenKeys = OverrideWithEnvVariables(config);
+    if (!overriddenKeys.empty())
+        PublishConfig(std::move(config));
 
     return overriddenKeys;
 }
@@ -226,25 +271,38 @@ ConfigMgr* ConfigMgr::instance()
 
 bool ConfigMgr::Reload(std::vector<std::string>& errors)
 {
+    std::lock_guard<std::mutex> lock(_configLock);
+
+    // readers keep seeing the old values until every file is loaded, never a partially reloaded tree
+    bpt::ptree config;
     std::string error;
-    if (!LoadInitial(_filename, std::move(_args), error))
+    if (!LoadInitialTree(_filename, config, error))
+    {
         errors.push_back(std::move(error));
+        return false;
+    }
 
     for (std::string const& additionalFile : _additonalFiles)
-        if (!LoadAdditionalFile(additionalFile, false, error))
+        if (!MergeAdditionalFile(additionalFile, config, error))
             errors.push_back(std::move(error));
 
-    OverrideWithEnvVariablesIfAny();
+    OverrideWithEnvVariables(config);
+    PublishConfig(std::move(config));
 
     return errors.empty();
 }
 
+uint32 ConfigMgr::GetVersion() const
+{
+    return _configVersion.load(std::memory_order_acquire);
+}
+
 template<class T, class R>
 R ConfigMgr::GetValueDefault(std::string_view const& name, T def, bool quiet) const
 {
     try
     {
-        return _config.get<T>(bpt::ptree::path_type(std::string(name), '/'));
+        return GetConfig()->get<T>(bpt::ptree::path_type(std::string(name), '/'));
     }
     catch (bpt::ptree_bad_path const&)
     {
@@ -282,7 +340,7 @@ std::string ConfigMgr::GetValueDefault<std::string_view>(std::string_view const&
 {
     try
     {
-        return _config.get<std::string>(bpt::ptree::path_type(std::string(name), '/'));
+        return GetConfig()->get<std::string>(bpt::ptree::path_type(std::string(name), '/'));
     }
     catch (bpt::ptree_bad_path const&)
     {
@@ -357,11 +415,9 @@ std::vector<std::string> const& ConfigMgr::GetArguments() const
 
 std::vector<std::string> ConfigMgr::GetKeysByString(std::string const& name)
 {
-    std::lock_guard<std::mutex> lock(_configLock);
-
     std::vector<std::string> keys;
 
-    for (bpt::ptree::value_type const& child : _config)
+    for (bpt::ptree::value_type const& child : *GetConfig())
         if (child.first.starts_with(name))
             keys.push_back(child.first);
 
@@ -19,8 +19,10 @@
 #define TRINITYCORE_CONFIG_H
 
 #include "Define.h"
+#include <atomic>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 class TC_COMMON_API ConfigMgr
@@ -52,6 +54,9 @@ public:
     int64 GetInt64Default(std::string_view name, int64 def, bool quiet = false) const;
     float GetFloatDefault(std::string_view name, float def, bool quiet = false) const;
 
+    /// Incremented every time a changed configuration is published, the Get*Default functions read the published values without waiting for loading
+    uint32 GetVersion() const;
+
     std::string const& GetFilename();
     std::vector<std::string> const& GetArguments() const;
     std::vector<std::string> GetKeysByString(std::string const& name);
@@ -63,4 +68,56 @@ private:
 
 #define sConfigMgr ConfigMgr::instance()
 
+/**
+ * Pre-resolved option for values read at runtime, the string keyed lookup only runs again
+ * after the configuration was reloaded. Safe to use from any thread.
+ */
+template<typename T>
+class ConfigValue
+{
+    static_assert(std::is_same_v<T, bool> || std::is_same_v<T, int32> || std::is_same_v<T, int64> || std::is_same_v<T, float>,
+        "ConfigValue only supports the types ConfigMgr has getters for");
+
+public:
+    ConfigValue(std::string_view name, T def) : _name(name), _default(def), _value(def), _version(0) { }
+
+    ConfigValue(ConfigValue const&) = delete;
+    ConfigValue(ConfigValue&&) = delete;
+    ConfigValue& operator=(ConfigValue const&) = delete;
+    ConfigValue& operator=(ConfigValue&&) = delete;
+
+    T Get() const
+    {
+        uint32 version = sConfigMgr->GetVersion();
+        if (_version.load(std::memory_order_acquire) != version)
+        {
+            // concurrent callers may both resolve here, they store the same value
+            _value.store(Resolve(), std::memory_order_relaxed);
+            _version.store(version, std::memory_order_release);
+        }
+
+        return _value.load(std::memory_order_relaxed);
+    }
+
+    operator T() const { return Get(); }
+
+private:
+    T Resolve() const
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            return sConfigMgr->GetBoolDefault(_name, _default);
+        else if constexpr (std::is_same_v<T, int32>)
+            return sConfigMgr->GetIntDefault(_name, _default);
+        else if constexpr (std::is_same_v<T, int64>)
+            return sConfigMgr->GetInt64Default(_name, _default);
+        else
+            return sConfigMgr->GetFloatDefault(_name, _default);
+    }
+
+    std::string _name;
+    T _default;
+    mutable std::atomic<T> _value;
+    mutable std::atomic<uint32> _version;
+};
+
 #endif
@@ -0,0 +1,357 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_FLAT_HASH_MAP_H
+#define TRINITYCORE_FLAT_HASH_MAP_H
+
+#include "Define.h"
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Trinity::Containers
+{
+namespace Impl
+{
+struct FlatHashSetKeyOf
+{
+    template <class Value>
+    static Value const& Get(Value const& value) { return value; }
+};
+
+struct FlatHashMapKeyOf
+{
+    template <class Key, class T>
+    static Key const& Get(std::pair<Key, T> const& value) { return value.first; }
+};
+
+/**
+ * Open addressing hash table with linear probing, values are stored inline in one array
+ *
+ * Erasing leaves a tombstone and never moves other values, so erasing while iterating is safe
+ * Inserting can grow the table which invalidates all iterators and references
+ * Values must be default constructible, free slots hold default constructed values
+ */
+template <class Value, class Key, class KeyOf, class Hash, class KeyEqual>
+class FlatHashTable
+{
+    enum class SlotState : uint8
+    {
+        Empty,
+        Deleted,
+        Full
+    };
+
+public:
+    using key_type = Key;
+    using value_type = Value;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, Value const*, Value*>;
+        using reference = std::conditional_t<Const, Value const&, Value&>;
+        using TablePointer = std::conditional_t<Const, FlatHashTable const*, FlatHashTable*>;
+
+        Iterator() = default;
+        Iterator(TablePointer table, size_type index) : _table(table), _index(index) { SkipFreeSlots(); }
+
+        operator Iterator<true>() const requires (!Const) { return Iterator<true>(_table, _index); }
+
+        reference operator*() const { return _table->_values[_index]; }
+        pointer operator->() const { return &_table->_values[_index]; }
+
+        Iterator& operator++()
+        {
+            ++_index;
+            SkipFreeSlots();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(Iterator const& left, Iterator const& right) { return left._index == right._index; }
+
+    private:
+        friend FlatHashTable;
+
+        void SkipFreeSlots()
+        {
+            while (_index < _table->_states.size() && _table->_states[_index] != SlotState::Full)
+                ++_index;
+        }
+
+        TablePointer _table = nullptr;
+        size_type _index = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    iterator begin() { return iterator(this, 0); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator cbegin() const { return begin(); }
+
+    iterator end() { return iterator(this, _states.size()); }
+    const_iterator end() const { return const_iterator(this, _states.size()); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return _size == 0; }
+    size_type size() const { return _size; }
+    size_type capacity() const { return _states.size(); }
+
+    // keeps the allocated slots
+    void clear()
+    {
+        for (size_type i = 0; i < _states.size(); ++i)
+        {
+            if (_states[i] == SlotState::Full)
+                _values[i] = Value();
+
+            _states[i] = SlotState::Empty;
+        }
+
+        _size = 0;
+        _deleted = 0;
+    }
+
+    void reserve(size_type count)
+    {
+        size_type required = GetCapacityFor(count);
+        if (required > capacity())
+            Rehash(required);
+    }
+
+    iterator find(Key const& key)
+    {
+        size_type index = FindIndex(key);
+        return index != NotFound ? iterator(this, index) : end();
+    }
+
+    const_iterator find(Key const& key) const
+    {
+        size_type index = FindIndex(key);
+        return index != NotFound ? const_iterator(this, index) : end();
+    }
+
+    bool contains(Key const& key) const { return FindIndex(key) != NotFound; }
+    size_type count(Key const& key) const { return contains(key) ? 1 : 0; }
+
+    std::pair<iterator, bool> insert(Value const& value) { return Insert(Value(value)); }
+    std::pair<iterator, bool> insert(Value&& value) { return Insert(std::move(value)); }
+
+    template <class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return Insert(Value(std::forward<Args>(args)...)); }
+
+    size_type erase(Key const& key)
+    {
+        size_type index = FindIndex(key);
+        if (index == NotFound)
+            return 0;
+
+        EraseIndex(index);
+        return 1;
+    }
+
+    // returns the iterator following the erased value
+    iterator erase(const_iterator itr)
+    {
+        EraseIndex(itr._index);
+        return iterator(this, itr._index + 1);
+    }
+
+    iterator erase(iterator itr) { return erase(const_iterator(itr)); }
+
+    friend bool operator==(FlatHashTable const& left, FlatHashTable const& right)
+    {
+        if (left.size() != right.size())
+            return false;
+
+        for (Value const& value : left)
+        {
+            const_iterator itr = right.find(KeyOf::Get(value));
+            if (itr == right.end() || !(*itr == value))
+                return false;
+        }
+
+        return true;
+    }
+
+private:
+    static constexpr size_type NotFound = size_type(-1);
+    static constexpr size_type MinCapacity = 8;
+
+    // used and deleted slots never fill more than 7/8 of the table, probing always ends at an empty slot
+    static constexpr bool IsOverloaded(size_type usedSlots, size_type capacity) { return usedSlots * 8 > capacity * 7; }
+
+    static size_type GetCapacityFor(size_type count)
+    {
+        size_type capacity = MinCapacity;
+        while (IsOverloaded(count, capacity))
+            capacity *= 2;
+
+        return capacity;
+    }
+
+    // fibonacci hashing, takes the high bits so weak hashes with few varying low bits spread too
+    size_type GetHomeIndex(Key const& key) const
+    {
+        return size_type((uint64(Hash()(key)) * UI64LIT(0x9E3779B97F4A7C15)) >> _shift);
+    }
+
+    size_type FindIndex(Key const& key) const
+    {
+        if (_states.empty())
+            return NotFound;
+
+        size_type mask = _states.size() - 1;
+        for (size_type index = GetHomeIndex(key); ; index = (index + 1) & mask)
+        {
+            if (_states[index] == SlotState::Empty)
+                return NotFound;
+
+            if (_states[index] == SlotState::Full && KeyEqual()(KeyOf::Get(_values[index]), key))
+                return index;
+        }
+    }
+
+    std::pair<iterator, bool> Insert(Value&& value)
+    {
+        if (IsOverloaded(_size + _deleted + 1, _states.size()))
+            Rehash(GetCapacityFor((_size + 1) * 2));
+
+        Key const& key = KeyOf::Get(value);
+        size_type mask = _states.size() - 1;
+        size_type firstDeleted = NotFound;
+        for (size_type index = GetHomeIndex(key); ; index = (index + 1) & mask)
+        {
+            if (_states[index] == SlotState::Full)
+            {
+                if (KeyEqual()(KeyOf::Get(_values[index]), key))
+                    return { iterator(this, index), false };
+
+                continue;
+            }
+
+            if (_states[index] == SlotState::Deleted)
+            {
+                if (firstDeleted == NotFound)
+                    firstDeleted = index;
+
+                continue;
+            }
+
+            // the key is not in the table, reuse the first tombstone on the way
+            if (firstDeleted != NotFound)
+            {
+                index = firstDeleted;
+                --_deleted;
+            }
+
+            _values[index] = std::move(value);
+            _states[index] = SlotState::Full;
+            ++_size;
+            return { iterator(this, index), true };
+        }
+    }
+
+    void EraseIndex(size_type index)
+    {
+        _values[index] = Value();
+        _states[index] = SlotState::Deleted;
+        --_size;
+        ++_deleted;
+    }
+
+    void Rehash(size_type newCapacity)
+    {
+        std::vector<Value> oldValues = std::exchange(_values, std::vector<Value>(newCapacity));
+        std::vector<SlotState> oldStates = std::exchange(_states, std::vector<SlotState>(newCapacity, SlotState::Empty));
+        _shift = 64 - std::countr_zero(uint64(newCapacity));
+        _deleted = 0;
+
+        size_type mask = newCapacity - 1;
+        for (size_type i = 0; i < oldStates.size(); ++i)
+        {
+            if (oldStates[i] != SlotState::Full)
+                continue;
+
+            size_type index = GetHomeIndex(KeyOf::Get(oldValues[i]));
+            while (_states[index] != SlotState::Empty)
+                index = (index + 1) & mask;
+
+            _values[index] = std::move(oldValues[i]);
+            _states[index] = SlotState::Full;
+        }
+    }
+
+    std::vector<Value> _values;
+    std::vector<SlotState> _states;
+    size_type _size = 0;
+    size_type _deleted = 0;
+    int32 _shift = 64;
+};
+}
+
+template <class Key, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class FlatHashSet : public Impl::FlatHashTable<Key, Key, Impl::FlatHashSetKeyOf, Hash, KeyEqual>
+{
+};
+
+template <class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class FlatHashMap : public Impl::FlatHashTable<std::pair<Key, T>, Key, Impl::FlatHashMapKeyOf, Hash, KeyEqual>
+{
+    using Base = Impl::FlatHashTable<std::pair<Key, T>, Key, Impl::FlatHashMapKeyOf, Hash, KeyEqual>;
+
+public:
+    using mapped_type = T;
+    using typename Base::iterator;
+    using typename Base::const_iterator;
+
+    // args are only used when key is not in the map yet
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(Key const& key, Args&&... args)
+    {
+        iterator itr = this->find(key);
+        if (itr != this->end())
+            return { itr, false };
+
+        return this->emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    T& operator[](Key const& key) { return try_emplace(key).first->second; }
+};
+}
+
+#endif // TRINITYCORE_FLAT_HASH_MAP_H
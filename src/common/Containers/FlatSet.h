@@ -94,6 +94,9 @@ public:
 
     void clear() { _storage.clear(); }
 
+    // storage must already be sorted by Compare and must not contain duplicates
+    void replace(KeyContainer&& storage) { _storage = std::move(storage); }
+
     void shrink_to_fit() { _storage.shrink_to_fit(); }
 
     friend std::strong_ordering operator<=>(FlatSet const& left, FlatSet const& right) = default;
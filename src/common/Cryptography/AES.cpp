@@ -87,6 +87,38 @@ bool Trinity::Crypto::AES::Process(IV const& iv, uint8* data, size_t length, Tag
     return true;
 }
 
+bool Trinity::Crypto::AES::Process(IV const& iv, std::span<std::span<uint8> const> data, Tag& tag)
+{
+    if (!EVP_CipherInit_ex(_ctx, nullptr, nullptr, nullptr, iv.data(), -1))
+        return false;
+
+    int outLen;
+    for (std::span<uint8> chunk : data)
+    {
+        ASSERT(chunk.size() <= static_cast<size_t>(std::numeric_limits<int>::max()));
+        int len = static_cast<int>(chunk.size());
+        if (!EVP_CipherUpdate(_ctx, chunk.data(), &outLen, chunk.data(), len))
+            return false;
+
+        // GCM is a stream mode, every byte passed in is processed immediately
+        ASSERT(len == outLen);
+    }
+
+    if (!_encrypting && !EVP_CIPHER_CTX_ctrl(_ctx, EVP_CTRL_GCM_SET_TAG, sizeof(tag), tag))
+        return false;
+
+    uint8 finalBlock[1];
+    if (!EVP_CipherFinal_ex(_ctx, finalBlock, &outLen))
+        return false;
+
+    ASSERT(outLen == 0);
+
+    if (_encrypting && !EVP_CIPHER_CTX_ctrl(_ctx, EVP_CTRL_GCM_GET_TAG, sizeof(tag), tag))
+        return false;
+
+    return true;
+}
+
 bool Trinity::Crypto::AES::ProcessNoIntegrityCheck(IV const& iv, uint8* data, size_t partialLength)
 {
     ASSERT(!_encrypting, "Partial encryption is not allowed");
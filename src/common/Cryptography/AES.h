@@ -47,6 +47,8 @@ namespace Trinity::Crypto
         void Init(std::span<uint8 const> key);
 
         bool Process(IV const& iv, uint8* data, size_t length, Tag& tag);
+        // Processes several non-contiguous chunks as one message, the tag covers all of them
+        bool Process(IV const& iv, std::span<std::span<uint8> const> data, Tag& tag);
         bool ProcessNoIntegrityCheck(IV const& iv, uint8* data, size_t partialLength);
 
     private:
@@ -82,3 +82,41 @@ bool WorldPacketCrypt::EncryptSend(uint8* data, size_t length, Trinity::Crypto::
     ++_serverCounter;
     return true;
 }
+
+bool WorldPacketCrypt::EncryptSend(std::span<std::span<uint8> const> data, Trinity::Crypto::AES::Tag& tag)
+{
+    if (_initialized)
+    {
+        WorldPacketCryptIV iv{ _serverCounter, 0x52565253 };
+        if (!_serverEncrypt.Process(iv.Value, data, tag))
+            return false;
+    }
+    else
+        memset(tag, 0, sizeof(tag));
+
+    ++_serverCounter;
+    return true;
+}
+
+bool WorldPacketCrypt::EncryptSend(std::span<SendBatchEntry const> packets)
+{
+    if (!_initialized)
+    {
+        for (SendBatchEntry const& packet : packets)
+            memset(*packet.Tag, 0, sizeof(*packet.Tag));
+
+        _serverCounter += packets.size();
+        return true;
+    }
+
+    for (SendBatchEntry const& packet : packets)
+    {
+        WorldPacketCryptIV iv{ _serverCounter, 0x52565253 };
+        if (!_serverEncrypt.Process(iv.Value, packet.Data.data(), packet.Data.size(), *packet.Tag))
+            return false;
+
+        ++_serverCounter;
+    }
+
+    return true;
+}
@@ -25,12 +25,21 @@ class TC_COMMON_API WorldPacketCrypt
 public:
     using Key = std::array<uint8, 32>;
 
+    struct SendBatchEntry
+    {
+        std::span<uint8> Data;
+        Trinity::Crypto::AES::Tag* Tag;
+    };
+
     WorldPacketCrypt();
 
     void Init(Key const& key);
     bool PeekDecryptRecv(uint8* data, size_t length);
     bool DecryptRecv(uint8* data, size_t length, Trinity::Crypto::AES::Tag& tag);
     bool EncryptSend(uint8* data, size_t length, Trinity::Crypto::AES::Tag& tag);
+    bool EncryptSend(std::span<std::span<uint8> const> data, Trinity::Crypto::AES::Tag& tag);
+    // Encrypts consecutive packets in one pass, every packet is still a separate message with its own counter and tag
+    bool EncryptSend(std::span<SendBatchEntry const> packets);
 
     bool IsInitialized() const { return _initialized; }
 
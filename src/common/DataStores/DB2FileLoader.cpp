@@ -19,6 +19,7 @@
 #include "ByteConverter.h"
 #include "DB2Meta.h"
 #include "Errors.h"
+#include "LargePages.h"
 #include "StringFormat.h"
 #include <fmt/ranges.h>
 #include <limits>
@@ -254,7 +255,9 @@ private:
     DB2FileLoadInfo const* _loadInfo;
     DB2Header const* _header;
     std::unique_ptr<uint8[]> _data;
-    uint8* _stringTable;
+    // allocated separately from record data to be handed over as string pool by AutoProduceStrings
+    std::unique_ptr<char[]> _stringTableData;
+    char* _stringTable;
     std::unique_ptr<DB2SectionHeader[]> _sections;
     std::unique_ptr<DB2ColumnMeta[]> _columnMeta;
     std::unique_ptr<std::unique_ptr<DB2PalletValue[]>[]> _palletValues;
@@ -353,8 +356,10 @@ bool DB2FileLoaderRegularImpl::LoadTableData(DB2FileSource* source, uint32 secti
 {
     if (!_data)
     {
-        _data = std::make_unique<uint8[]>(_header->RecordSize * _header->RecordCount + _header->StringTableSize + 8);
-        _stringTable = &_data[_header->RecordSize * _header->RecordCount];
+        // packed fields of the last record are read as 8 bytes
+        _data = std::make_unique<uint8[]>(_header->RecordSize * _header->RecordCount + 8);
+        _stringTableData = std::make_unique<char[]>(_header->StringTableSize);
+        _stringTable = _stringTableData.get();
     }
 
     uint32 sectionDataStart = 0;
@@ -399,6 +404,7 @@ char* DB2FileLoaderRegularImpl::AutoProduceData(uint32& indexTableSize, char**&
     memset(indexTable, 0, maxi * sizeof(index_entry_t));
 
     char* dataTable = new char[(_header->RecordCount + _copyTable.size()) * recordsize];
+    Trinity::LargePages::Advise(dataTable, (_header->RecordCount + _copyTable.size()) * recordsize);
 
     uint32 offset = 0;
     uint32 recordIndex = 0;
@@ -528,8 +534,9 @@ char* DB2FileLoaderRegularImpl::AutoProduceStrings(char** indexTable, uint32 ind
     if (!_loadInfo->GetStringFieldCount(false))
         return nullptr;
 
-    char* stringPool = new char[_header->StringTableSize];
-    memcpy(stringPool, _stringTable, _header->StringTableSize);
+    // string pointers point directly into the string table, ownership is passed to the caller instead of copying it
+    // further calls on the same loader keep pointing into the table returned by the first one
+    char* stringPool = _stringTableData.release();
 
     uint32 y = 0;
 
@@ -585,13 +592,13 @@ char* DB2FileLoaderRegularImpl::AutoProduceStrings(char** indexTable, uint32 ind
                             break;
                         case FT_STRING:
                             if (char const* string = RecordGetString(rawRecord, x, z))
-                                reinterpret_cast<LocalizedString*>(&recordData[offset])->Str[locale] = stringPool + (string - reinterpret_cast<char const*>(_stringTable));
+                                reinterpret_cast<LocalizedString*>(&recordData[offset])->Str[locale] = string;
 
                             offset += sizeof(LocalizedString);
                             break;
                         case FT_STRING_NOT_LOCALIZED:
                             if (char const* string = RecordGetString(rawRecord, x, z))
-                                *reinterpret_cast<char**>(&recordData[offset]) = stringPool + (string - reinterpret_cast<char const*>(_stringTable));
+                                *reinterpret_cast<char const**>(&recordData[offset]) = string;
 
                             offset += sizeof(char*);
                             break;
@@ -798,8 +805,14 @@ char const* DB2FileLoaderRegularImpl::RecordGetString(uint8 const* record, uint3
 {
     uint32 fieldOffset = GetFieldOffset(field) + sizeof(uint32) * arrayIndex;
     uint32 stringOffset = RecordGetVarInt<uint32>(record, field, arrayIndex);
-    ASSERT(stringOffset < _header->RecordSize * _header->RecordCount + _header->StringTableSize);
-    return stringOffset ? reinterpret_cast<char const*>(record + fieldOffset + stringOffset) : nullptr;
+    if (!stringOffset)
+        return nullptr;
+
+    // offsets are relative to the field in the file, where the string table directly follows record data
+    std::size_t recordDataSize = std::size_t(_header->RecordSize) * _header->RecordCount;
+    std::size_t stringPosition = std::size_t(record - _data.get()) + fieldOffset + stringOffset;
+    ASSERT(stringPosition >= recordDataSize && stringPosition < recordDataSize + _header->StringTableSize);
+    return _stringTable + (stringPosition - recordDataSize);
 }
 
 template<typename T>
@@ -1065,6 +1078,7 @@ char* DB2FileLoaderSparseImpl::AutoProduceData(uint32& indexTableSize, char**& i
     memset(indexTable, 0, indexTableSize * sizeof(index_entry_t));
 
     char* dataTable = new char[(records + _copyTable.size()) * recordsize];
+    Trinity::LargePages::Advise(dataTable, (records + _copyTable.size()) * recordsize);
     memset(dataTable, 0, (records + _copyTable.size()) * recordsize);
 
     uint32 offset = 0;
@@ -1206,6 +1220,7 @@ char* DB2FileLoaderSparseImpl::AutoProduceStrings(char** indexTable, uint32 inde
     std::size_t stringTableSize = _totalRecordSize - (records * ((recordsize - (!_loadInfo->Meta->HasIndexFieldInData() ? 4 : 0)) - stringsInRecordSize - localizedStringsInRecordSize));
 
     char* stringTable = new char[stringTableSize];
+    Trinity::LargePages::Advise(stringTable, stringTableSize);
     memset(stringTable, 0, stringTableSize);
     char* stringPtr = stringTable;
 
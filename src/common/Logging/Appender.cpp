@@ -61,7 +61,7 @@ void Appender::write(LogMessage* message)
 
         if (flags & APPENDER_FLAGS_PREFIX_TIMESTAMP)
         {
-            message->prefix.append(message->getTimeStr());
+            LogMessage::appendTimeStr(message->prefix, message->mtime);
             message->prefix.append(1, ' ');
         }
 
@@ -46,6 +46,8 @@ class TC_COMMON_API Appender
         void write(LogMessage* message);
         static std::string_view getLogLevelString(LogLevel level);
         virtual void setRealmId(uint32 /*realmId*/) { }
+        // called after a batch of messages was written
+        virtual void flush() { }
 
     private:
         virtual void _write(LogMessage const* /*message*/) = 0;
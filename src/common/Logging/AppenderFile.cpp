@@ -95,10 +95,15 @@ void AppenderFile::_write(LogMessage const* message)
     fwrite(message->prefix.c_str(), 1, message->prefix.length(), logfile);
     fwrite(message->text.c_str(), 1, message->text.length(), logfile);
     fwrite("\n", 1, 1, logfile);
-    fflush(logfile);
     _fileSize += uint64(message->Size());
 }
 
+void AppenderFile::flush()
+{
+    if (logfile)
+        fflush(logfile);
+}
+
 FILE* AppenderFile::OpenFile(std::string const& filename, std::string const& mode, bool backup)
 {
     std::string fullName(_logDir + filename);
@@ -31,6 +31,7 @@ class TC_COMMON_API AppenderFile : public Appender
         ~AppenderFile();
         FILE* OpenFile(std::string const& name, std::string const& mode, bool backup);
         AppenderType getType() const override { return type; }
+        void flush() override;
 
     private:
         void CloseFile();
@@ -21,13 +21,13 @@
 #include "Config.h"
 #include "Errors.h"
 #include "LogMessage.h"
-#include "LogOperation.h"
 #include "Logger.h"
 #include "Strand.h"
 #include "StringConvert.h"
 #include "Util.h"
 
-Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), m_logsTimestamp('_' + GetTimestampStr()), _ioContext(nullptr), _strand(nullptr)
+Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), m_logsTimestamp('_' + GetTimestampStr()), _ioContext(nullptr), _strand(nullptr),
+    _queueProcessingScheduled(false)
 {
     RegisterAppender<AppenderConsole>();
     RegisterAppender<AppenderFile>();
@@ -219,26 +219,44 @@ void Log::RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn)
 
 void Log::OutMessageImpl(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept
 {
-    if (_ioContext)
-        Trinity::Asio::post(*_strand, LogOperation(logger, new LogMessage(level, filter, Trinity::StringVFormat(messageFormat, messageFormatArgs))));
-    else
+    Write(logger, std::make_unique<LogMessage>(level, filter, Trinity::StringVFormat(messageFormat, messageFormatArgs)));
+}
+
+void Log::OutCommandImpl(uint32 account, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept
+{
+    Write(GetLoggerByType("commands.gm"), std::make_unique<LogMessage>(LOG_LEVEL_INFO, "commands.gm", Trinity::StringVFormat(messageFormat, messageFormatArgs), Trinity::ToString(account)));
+}
+
+void Log::Write(Logger const* logger, std::unique_ptr<LogMessage> message) const noexcept
+{
+    if (!_ioContext)
     {
-        LogMessage msg(level, filter, Trinity::StringVFormat(messageFormat, messageFormatArgs));
-        logger->write(&msg);
+        logger->write(message.get());
+        logger->flush();
+        return;
     }
+
+    _queue.Enqueue(new LogOperation(logger, std::move(message)));
+
+    // only the first message since the strand last started draining the queue needs to post a handler
+    if (!_queueProcessingScheduled.exchange(true, std::memory_order_acq_rel))
+        Trinity::Asio::post(*_strand, [this] { ProcessQueuedMessages(); });
 }
 
-void Log::OutCommandImpl(uint32 account, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept
+void Log::ProcessQueuedMessages() const
 {
-    Logger const* logger = GetLoggerByType("commands.gm");
+    // cleared before draining, messages queued after this point schedule another run
+    _queueProcessingScheduled.exchange(false, std::memory_order_acq_rel);
 
-    if (_ioContext)
-        Trinity::Asio::post(*_strand, LogOperation(logger, new LogMessage(LOG_LEVEL_INFO, "commands.gm", Trinity::StringVFormat(messageFormat, messageFormatArgs), Trinity::ToString(account))));
-    else
+    LogOperation* operation;
+    while (_queue.Dequeue(operation))
     {
-        LogMessage msg(LOG_LEVEL_INFO, "commands.gm", Trinity::StringVFormat(messageFormat, messageFormatArgs), Trinity::ToString(account));
-        logger->write(&msg);
+        (*operation)();
+        delete operation;
     }
+
+    for (std::pair<uint8 const, std::unique_ptr<Appender>> const& appender : appenders)
+        appender.second->flush();
 }
 
 Logger const* Log::GetLoggerByType(std::string_view type) const
@@ -258,6 +276,30 @@ Logger const* Log::GetLoggerByType(std::string_view type) const
     return GetLoggerByType(parentLogger);
 }
 
+LoggerReference const* Log::GetLoggerReference(std::string_view filter) const
+{
+    std::lock_guard lock(_loggerReferencesLock);
+    auto itr = _loggerReferences.find(filter);
+    if (itr == _loggerReferences.end())
+    {
+        itr = _loggerReferences.try_emplace(std::string(filter)).first;
+        ResolveLoggerReference(itr->first, itr->second);
+    }
+
+    return &itr->second;
+}
+
+void Log::ResolveLoggerReference(std::string_view filter, LoggerReference& reference) const
+{
+    Logger const* logger = GetLoggerByType(filter);
+    LogLevel threshold = logger ? logger->getLogLevel() : LOG_LEVEL_DISABLED;
+    if (threshold == LOG_LEVEL_DISABLED)
+        threshold = LOG_LEVEL_INVALID;
+
+    reference.Resolved.store(logger, std::memory_order_relaxed);
+    reference.Threshold.store(threshold, std::memory_order_release);
+}
+
 std::string Log::GetTimestampStr()
 {
     return TimeToTimestampStr(time(nullptr));
@@ -283,6 +325,11 @@ bool Log::SetLogLevel(std::string const& name, int32 newLeveli, bool isLogger /*
 
         if (newLevel != LOG_LEVEL_DISABLED && newLevel < lowestLogLevel)
             lowestLogLevel = newLevel;
+
+        std::lock_guard lock(_loggerReferencesLock);
+        for (auto& [filter, reference] : _loggerReferences)
+            if (reference.Resolved.load(std::memory_order_relaxed) == it->second.get())
+                ResolveLoggerReference(filter, reference);
     }
     else
     {
@@ -304,15 +351,7 @@ void Log::OutCharDump(std::string const& str, uint32 accountId, uint64 guid, std
     std::string ss = Trinity::StringFormat("== START DUMP == (account: {} guid: {} name: {})\n{}\n== END DUMP ==\n", accountId, guid, name, str);
     std::string param = Trinity::StringFormat("{}_{}", guid, name);
 
-    Logger const* logger = GetLoggerByType("entities.player.dump");
-
-    if (_ioContext)
-        Trinity::Asio::post(*_strand, LogOperation(logger, new LogMessage(LOG_LEVEL_INFO, "entities.player.dump", std::move(ss), std::move(param))));
-    else
-    {
-        LogMessage msg(LOG_LEVEL_INFO, "entities.player.dump", std::move(ss), std::move(param));
-        logger->write(&msg);
-    }
+    Write(GetLoggerByType("entities.player.dump"), std::make_unique<LogMessage>(LOG_LEVEL_INFO, "entities.player.dump", std::move(ss), std::move(param)));
 }
 
 void Log::SetRealmId(uint32 id)
@@ -378,6 +417,9 @@ void Log::Initialize(Trinity::Asio::IoContext* ioContext)
 
 void Log::SetSynchronous()
 {
+    // write out whatever the logging strand did not get to before its io context stopped
+    ProcessQueuedMessages();
+
     delete _strand;
     _strand = nullptr;
     _ioContext = nullptr;
@@ -385,6 +427,13 @@ void Log::SetSynchronous()
 
 void Log::LoadFromConfig()
 {
+    std::lock_guard lock(_loggerReferencesLock);
+    for (auto& [filter, reference] : _loggerReferences)
+    {
+        reference.Threshold.store(LOG_LEVEL_INVALID, std::memory_order_relaxed);
+        reference.Resolved.store(nullptr, std::memory_order_relaxed);
+    }
+
     Close();
 
     lowestLogLevel = LOG_LEVEL_FATAL;
@@ -396,4 +445,7 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+
+    for (auto& [filter, reference] : _loggerReferences)
+        ResolveLoggerReference(filter, reference);
 }
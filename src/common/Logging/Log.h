@@ -21,8 +21,13 @@
 #include "Define.h"
 #include "AsioHacksFwd.h"
 #include "LogCommon.h"
+#include "LogOperation.h"
+#include "MPSCQueue.h"
 #include "StringFormat.h"
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -48,6 +53,25 @@ Appender* CreateAppender(uint8 id, std::string name, LogLevel level, AppenderFla
     return new AppenderImpl(id, std::move(name), level, flags, extraArgs);
 }
 
+// Logger resolved for one filter, owned by Log and updated in place on config reload and level changes
+struct LoggerReference
+{
+    // lowest level that gets written, LOG_LEVEL_INVALID if the filter has no enabled logger
+    std::atomic<LogLevel> Threshold{ LOG_LEVEL_INVALID };
+    std::atomic<Logger const*> Resolved{ nullptr };
+
+    Logger const* GetEnabledLogger(LogLevel level) const noexcept
+    {
+        if (level < Threshold.load(std::memory_order_acquire))
+            return nullptr;
+
+        return Resolved.load(std::memory_order_relaxed);
+    }
+};
+
+// Per call site cache of TC_LOG_* macros
+using LogCallSite = std::atomic<LoggerReference const*>;
+
 class TC_COMMON_API Log
 {
     private:
@@ -68,6 +92,26 @@ class TC_COMMON_API Log
         void Close();
         bool ShouldLog(std::string_view type, LogLevel level) const noexcept;
         Logger const* GetEnabledLogger(std::string_view type, LogLevel level) const noexcept;
+
+        // filters passed as string literals are resolved once per call site, checking the level afterwards is a single atomic load
+        template <size_t FilterSize>
+        Logger const* GetEnabledLogger(LogCallSite& callSite, char const(&filter)[FilterSize], LogLevel level) const noexcept
+        {
+            LoggerReference const* reference = callSite.load(std::memory_order_acquire);
+            if (!reference)
+            {
+                reference = GetLoggerReference({ std::begin(filter), (filter[FilterSize - 1] == '\0' ? FilterSize - 1 : FilterSize) });
+                callSite.store(reference, std::memory_order_release);
+            }
+
+            return reference->GetEnabledLogger(level);
+        }
+
+        template <typename StringOrStringView>
+        Logger const* GetEnabledLogger(LogCallSite& /*callSite*/, StringOrStringView const& filter, LogLevel level) const noexcept
+        {
+            return GetEnabledLogger(make_string_view(filter), level);
+        }
         bool SetLogLevel(std::string const& name, int32 level, bool isLogger = true);
 
         template<typename... Args>
@@ -129,6 +173,8 @@ class TC_COMMON_API Log
         static std::string GetTimestampStr();
 
         Logger const* GetLoggerByType(std::string_view type) const;
+        LoggerReference const* GetLoggerReference(std::string_view filter) const;
+        void ResolveLoggerReference(std::string_view filter, LoggerReference& reference) const;
         Appender* GetAppenderByName(std::string_view name);
         uint8 NextAppenderId();
         void CreateAppenderFromConfig(std::string const& name);
@@ -138,6 +184,8 @@ class TC_COMMON_API Log
         void RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn);
         void OutMessageImpl(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept;
         void OutCommandImpl(uint32 account, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept;
+        void Write(Logger const* logger, std::unique_ptr<LogMessage> message) const noexcept;
+        void ProcessQueuedMessages() const;
 
         std::unordered_map<uint8, AppenderCreatorFn> appenderFactory;
         std::unordered_map<uint8, std::unique_ptr<Appender>> appenders;
@@ -150,14 +198,24 @@ class TC_COMMON_API Log
 
         Trinity::Asio::IoContext* _ioContext;
         Trinity::Asio::Strand* _strand;
+
+        // messages waiting for the logging strand, drained in batches so that only
+        // the first message of a batch has to post a handler and appenders flush once per batch
+        mutable MPSCQueue<LogOperation, &LogOperation::QueueLink> _queue;
+        mutable std::atomic<bool> _queueProcessingScheduled;
+
+        // never erased, call sites keep pointers to them for the lifetime of the process
+        mutable std::mutex _loggerReferencesLock;
+        mutable std::map<std::string, LoggerReference, std::less<>> _loggerReferences;
 };
 
 #define sLog Log::instance()
 
 #define TC_LOG_MESSAGE_BODY_CORE(filterType__, level__, message__, ...)                                                         \
         do {                                                                                                                    \
+            static constinit LogCallSite logCallSite{ nullptr };                                                                \
             Log* logInstance = sLog;                                                                                            \
-            if (Logger const* loggerInstance = logInstance->GetEnabledLogger(Log::make_string_view((filterType__)), (level__))) \
+            if (Logger const* loggerInstance = logInstance->GetEnabledLogger(logCallSite, (filterType__), (level__)))           \
                 logInstance->OutMessageTo(loggerInstance, Log::make_string_view((filterType__)), (level__),                     \
                     Log::make_format_string_view((message__)), ## __VA_ARGS__);                                                 \
         } while (0)
@@ -174,17 +232,39 @@ class TC_COMMON_API Log
         __pragma(warning(pop))
 #endif
 
+// Messages below this level are compiled out of TC_LOG_TRACE ... TC_LOG_WARN
+// 1 = trace (keep everything), 2 = debug, 3 = info, 4 = warn, 5 = error
+#ifndef TRINITY_COMPILED_LOG_LEVEL
+#define TRINITY_COMPILED_LOG_LEVEL 1
+#endif
+
+#if TRINITY_COMPILED_LOG_LEVEL <= 1
 #define TC_LOG_TRACE(filterType__, message__, ...) \
     TC_LOG_MESSAGE_BODY(filterType__, LOG_LEVEL_TRACE, message__, ## __VA_ARGS__)
+#else
+#define TC_LOG_TRACE(filterType__, message__, ...) ((void)0)
+#endif
 
+#if TRINITY_COMPILED_LOG_LEVEL <= 2
 #define TC_LOG_DEBUG(filterType__, message__, ...) \
     TC_LOG_MESSAGE_BODY(filterType__, LOG_LEVEL_DEBUG, message__, ## __VA_ARGS__)
+#else
+#define TC_LOG_DEBUG(filterType__, message__, ...) ((void)0)
+#endif
 
+#if TRINITY_COMPILED_LOG_LEVEL <= 3
 #define TC_LOG_INFO(filterType__, message__, ...)  \
     TC_LOG_MESSAGE_BODY(filterType__, LOG_LEVEL_INFO, message__, ## __VA_ARGS__)
+#else
+#define TC_LOG_INFO(filterType__, message__, ...) ((void)0)
+#endif
 
+#if TRINITY_COMPILED_LOG_LEVEL <= 4
 #define TC_LOG_WARN(filterType__, message__, ...)  \
     TC_LOG_MESSAGE_BODY(filterType__, LOG_LEVEL_WARN, message__, ## __VA_ARGS__)
+#else
+#define TC_LOG_WARN(filterType__, message__, ...) ((void)0)
+#endif
 
 #define TC_LOG_ERROR(filterType__, message__, ...) \
     TC_LOG_MESSAGE_BODY(filterType__, LOG_LEVEL_ERROR, message__, ## __VA_ARGS__)
@@ -18,6 +18,7 @@
 #include "LogMessage.h"
 #include "StringFormat.h"
 #include "Util.h"
+#include <iterator>
 
 LogMessage::LogMessage(LogLevel _level, std::string_view _type, std::string _text)
     : level(_level), type(_type), text(std::move(_text)), mtime(time(nullptr))
@@ -30,10 +31,17 @@ LogMessage::LogMessage(LogLevel _level, std::string_view _type, std::string _tex
 }
 
 std::string LogMessage::getTimeStr(time_t time)
+{
+    std::string str;
+    appendTimeStr(str, time);
+    return str;
+}
+
+void LogMessage::appendTimeStr(std::string& str, time_t time)
 {
     tm aTm;
     localtime_r(&time, &aTm);
-    return Trinity::StringFormat("{:04}-{:02}-{:02}_{:02}:{:02}:{:02}", aTm.tm_year + 1900, aTm.tm_mon + 1, aTm.tm_mday, aTm.tm_hour, aTm.tm_min, aTm.tm_sec);
+    Trinity::StringFormatTo(std::back_inserter(str), "{:04}-{:02}-{:02}_{:02}:{:02}:{:02}", aTm.tm_year + 1900, aTm.tm_mon + 1, aTm.tm_mday, aTm.tm_hour, aTm.tm_min, aTm.tm_sec);
 }
 
 std::string LogMessage::getTimeStr() const
@@ -34,6 +34,9 @@ struct TC_COMMON_API LogMessage
     static std::string getTimeStr(time_t time);
     std::string getTimeStr() const;
 
+    ///@ Appends the same text as getTimeStr without a temporary string
+    static void appendTimeStr(std::string& str, time_t time);
+
     LogLevel const level;
     std::string const type;
     std::string const text;
@@ -19,7 +19,7 @@
 #include "LogMessage.h"
 #include "Logger.h"
 
-LogOperation::LogOperation(Logger const* _logger, LogMessage* _msg) : logger(_logger), msg(_msg)
+LogOperation::LogOperation(Logger const* _logger, std::unique_ptr<LogMessage> _msg) : logger(_logger), msg(std::move(_msg))
 {
 }
 
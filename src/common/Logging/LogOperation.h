@@ -19,23 +19,27 @@
 #define LOGOPERATION_H
 
 #include "Define.h"
+#include <atomic>
 #include <memory>
 
 class Logger;
 struct LogMessage;
 
+// Node of the lock free queue Log hands messages to the logging strand with
 class LogOperation
 {
     public:
-        LogOperation(Logger const* _logger, LogMessage* _msg);
+        LogOperation(Logger const* _logger, std::unique_ptr<LogMessage> _msg);
         LogOperation(LogOperation const&) = delete;
-        LogOperation(LogOperation&&) noexcept = default;
+        LogOperation(LogOperation&&) = delete;
         LogOperation& operator=(LogOperation const&) = delete;
-        LogOperation& operator=(LogOperation&&) noexcept = default;
+        LogOperation& operator=(LogOperation&&) = delete;
         ~LogOperation();
 
         void operator()() const;
 
+        std::atomic<LogOperation*> QueueLink;
+
     protected:
         Logger const* logger;
         std::unique_ptr<LogMessage> msg;
@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "LogCommon.h"
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -37,10 +38,11 @@ class TC_COMMON_API Logger
         LogLevel getLogLevel() const;
         void setLogLevel(LogLevel level);
         void write(LogMessage* message) const;
+        void flush() const;
 
     private:
         std::string name;
-        LogLevel level;
+        std::atomic<LogLevel> level;
         std::vector<Appender*> appenders;
 };
 
@@ -0,0 +1,49 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CpuTime.h"
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+#include <Windows.h>
+#else
+#include <ctime>
+#endif
+
+namespace Trinity
+{
+std::atomic<bool> CpuTimeScope::_enabled(false);
+
+std::chrono::nanoseconds GetThreadCpuTime()
+{
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return std::chrono::nanoseconds::zero();
+
+    // 100 nanosecond intervals
+    uint64 kernel = (uint64(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+    uint64 user = (uint64(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+    return std::chrono::nanoseconds((kernel + user) * 100);
+#else
+    timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+        return std::chrono::nanoseconds::zero();
+
+    return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+#endif
+}
+}
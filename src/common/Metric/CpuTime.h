@@ -0,0 +1,82 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_CPU_TIME_H
+#define TRINITYCORE_CPU_TIME_H
+
+#include "Define.h"
+#include <atomic>
+#include <chrono>
+
+namespace Trinity
+{
+/// CPU time consumed by the calling thread
+TC_COMMON_API std::chrono::nanoseconds GetThreadCpuTime();
+
+/**
+ * Cumulative CPU time spent in one piece of code, shared by all threads running it
+ */
+struct CpuTimeCounter
+{
+    void Add(std::chrono::nanoseconds time)
+    {
+        CpuTime.fetch_add(uint64(time.count()), std::memory_order_relaxed);
+        Calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Reset()
+    {
+        CpuTime.store(0, std::memory_order_relaxed);
+        Calls.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64> CpuTime{ 0 }; // nanoseconds
+    std::atomic<uint64> Calls{ 0 };
+};
+
+class TC_COMMON_API CpuTimeScope
+{
+public:
+    explicit CpuTimeScope(CpuTimeCounter& counter) : _counter(IsEnabled() ? &counter : nullptr)
+    {
+        if (_counter)
+            _start = GetThreadCpuTime();
+    }
+
+    ~CpuTimeScope()
+    {
+        if (_counter)
+            _counter->Add(GetThreadCpuTime() - _start);
+    }
+
+    CpuTimeScope(CpuTimeScope const&) = delete;
+    CpuTimeScope(CpuTimeScope&&) = delete;
+    CpuTimeScope& operator=(CpuTimeScope const&) = delete;
+    CpuTimeScope& operator=(CpuTimeScope&&) = delete;
+
+    static bool IsEnabled() { return _enabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+private:
+    CpuTimeCounter* _counter;
+    std::chrono::nanoseconds _start;
+
+    static std::atomic<bool> _enabled;
+};
+}
+
+#endif // TRINITYCORE_CPU_TIME_H
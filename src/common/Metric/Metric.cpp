@@ -22,6 +22,50 @@
 #include "Log.h"
 #include "Util.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <bit>
+
+struct MetricTimerAggregate
+{
+    // bucket i holds samples below 2^i microseconds, the last one everything above
+    static constexpr std::size_t BucketCount = 32;
+
+    void Add(uint64 microseconds)
+    {
+        ++Count;
+        Sum += microseconds;
+        Max = std::max(Max, microseconds);
+        ++Buckets[std::min<std::size_t>(std::bit_width(microseconds), BucketCount - 1)];
+    }
+
+    // upper bound of the bucket containing the requested percentile
+    uint64 GetPercentile(uint32 percentile) const
+    {
+        uint64 rank = (Count * percentile + 99) / 100;
+        uint64 seen = 0;
+        for (std::size_t i = 0; i < BucketCount; ++i)
+        {
+            seen += Buckets[i];
+            if (seen >= rank)
+                return std::min(uint64(1) << i, Max);
+        }
+
+        return Max;
+    }
+
+    uint64 Count = 0;
+    uint64 Sum = 0;
+    uint64 Max = 0;
+    std::array<uint32, BucketCount> Buckets = { };
+};
+
+struct MetricAggregationBuffer
+{
+    // only contended while a batch is being sent
+    std::mutex Lock;
+    std::string KeyBuffer;
+    // keyed by measurement and tags in line protocol format
+    std::map<std::string, MetricTimerAggregate, std::less<>> Timers;
+};
 
 void Metric::Initialize(std::string const& realmName, Trinity::Asio::IoContext& ioContext, std::function<void()> overallStatusLogger)
 {
@@ -66,6 +110,8 @@ void Metric::LoadFromConfigs()
         _overallStatusTimerInterval = 1;
     }
 
+    _aggregateTimers = sConfigMgr->GetBoolDefault("Metric.AggregateTimers", false);
+
     _thresholds.clear();
     std::vector<std::string> thresholdSettings = sConfigMgr->GetKeysByString("Metric.Threshold.");
     for (std::string const& thresholdSetting : thresholdSettings)
@@ -112,7 +158,7 @@ void Metric::Update()
     }
 }
 
-bool Metric::ShouldLog(std::string const& category, int64 value) const
+bool Metric::ShouldLog(std::string_view category, int64 value) const
 {
     auto threshold = _thresholds.find(category);
     if (threshold == _thresholds.end())
@@ -134,6 +180,81 @@ void Metric::LogEvent(std::string category, std::string title, std::string descr
     _queuedData.Enqueue(data);
 }
 
+MetricAggregationBuffer& Metric::GetAggregationBuffer()
+{
+    thread_local std::shared_ptr<MetricAggregationBuffer> buffer;
+    if (!buffer)
+    {
+        std::lock_guard lock(_aggregationBuffersLock);
+        buffer = std::make_shared<MetricAggregationBuffer>();
+        _aggregationBuffers.push_back(buffer);
+    }
+
+    return *buffer;
+}
+
+void Metric::AggregateTimer(std::string_view category, std::chrono::nanoseconds value, std::span<MetricTag const* const> tags)
+{
+    MetricAggregationBuffer& buffer = GetAggregationBuffer();
+    std::lock_guard lock(buffer.Lock);
+
+    buffer.KeyBuffer.assign(category);
+    for (MetricTag const* tag : tags)
+    {
+        if (tag->first.empty())
+            continue;
+
+        buffer.KeyBuffer += ',';
+        buffer.KeyBuffer += tag->first;
+        buffer.KeyBuffer += '=';
+        AppendInfluxDBTagValue(buffer.KeyBuffer, tag->second);
+    }
+
+    auto itr = buffer.Timers.find(std::string_view(buffer.KeyBuffer));
+    if (itr == buffer.Timers.end())
+        itr = buffer.Timers.try_emplace(buffer.KeyBuffer).first;
+
+    itr->second.Add(uint64(std::max<int64>(std::chrono::duration_cast<Microseconds>(value).count(), 0)));
+}
+
+void Metric::WriteAggregatedTimers(std::ostream& stream, bool& firstLine)
+{
+    using namespace std::chrono;
+
+    std::string timestamp = std::to_string(duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count());
+
+    std::lock_guard lock(_aggregationBuffersLock);
+    for (std::shared_ptr<MetricAggregationBuffer> const& buffer : _aggregationBuffers)
+    {
+        std::lock_guard bufferLock(buffer->Lock);
+        for (auto itr = buffer->Timers.begin(); itr != buffer->Timers.end();)
+        {
+            MetricTimerAggregate& timer = itr->second;
+            // forget series that stayed idle for a whole interval
+            if (!timer.Count)
+            {
+                itr = buffer->Timers.erase(itr);
+                continue;
+            }
+
+            if (!firstLine)
+                stream << "\n";
+
+            stream << itr->first;
+            if (!_realmName.empty())
+                stream << ",realm=" << _realmName;
+
+            stream << " count=" << timer.Count << "i,sum_us=" << timer.Sum << "i,max_us=" << timer.Max
+                << "i,p50_us=" << timer.GetPercentile(50) << "i,p95_us=" << timer.GetPercentile(95)
+                << "i,p99_us=" << timer.GetPercentile(99) << "i " << timestamp;
+
+            firstLine = false;
+            timer = MetricTimerAggregate();
+            ++itr;
+        }
+    }
+}
+
 void Metric::SendBatch()
 {
     using namespace std::chrono;
@@ -179,6 +300,8 @@ void Metric::SendBatch()
         delete data;
     }
 
+    WriteAggregatedTimers(batchedData, firstLoop);
+
     // Check if there's any data to send
     if (batchedData.tellp() == std::streampos(0))
     {
@@ -304,6 +427,17 @@ std::string Metric::FormatInfluxDBTagValue(std::string const& value)
     return StringReplaceAll(value, " ", "\\ ");
 }
 
+void Metric::AppendInfluxDBTagValue(std::string& result, std::string_view value)
+{
+    // same escaping as FormatInfluxDBTagValue without a temporary string
+    for (char c : value)
+    {
+        if (c == ' ')
+            result += '\\';
+        result += c;
+    }
+}
+
 std::string Metric::FormatInfluxDBValue(std::chrono::nanoseconds value)
 {
     return FormatInfluxDBValue(std::chrono::duration_cast<Milliseconds>(value).count());
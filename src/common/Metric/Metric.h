@@ -22,13 +22,17 @@
 #include "Duration.h"
 #include "MPSCQueue.h"
 #include "Optional.h"
+#include <array>
 #include <functional>
 #include <iosfwd>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace Trinity
 {
@@ -47,6 +51,8 @@ enum MetricDataType
 
 using MetricTag = std::pair<std::string, std::string>;
 
+struct MetricAggregationBuffer;
+
 struct MetricData
 {
     std::string Category;
@@ -82,13 +88,21 @@ private:
     std::string _databaseName;
     std::function<void()> _overallStatusLogger;
     std::string _realmName;
-    std::unordered_map<std::string, int64> _thresholds;
+    std::map<std::string, int64, std::less<>> _thresholds;
+    bool _aggregateTimers = false;
+
+    std::mutex _aggregationBuffersLock;
+    std::vector<std::shared_ptr<MetricAggregationBuffer>> _aggregationBuffers;
 
     bool Connect();
     void SendBatch();
     void ScheduleSend();
     void ScheduleOverallStatusLog();
 
+    MetricAggregationBuffer& GetAggregationBuffer();
+    void AggregateTimer(std::string_view category, std::chrono::nanoseconds value, std::span<MetricTag const* const> tags);
+    void WriteAggregatedTimers(std::ostream& stream, bool& firstLine);
+
     static std::string FormatInfluxDBValue(bool value);
     template <class T>
     static std::string FormatInfluxDBValue(T value);
@@ -99,6 +113,7 @@ private:
     static std::string FormatInfluxDBValue(std::chrono::nanoseconds value);
 
     static std::string FormatInfluxDBTagValue(std::string const& value);
+    static void AppendInfluxDBTagValue(std::string& result, std::string_view value);
 
     // ToDo: should format TagKey and FieldKey too in the same way as TagValue
 
@@ -114,7 +129,7 @@ public:
     void Initialize(std::string const& realmName, Trinity::Asio::IoContext& ioContext, std::function<void()> overallStatusLogger);
     void LoadFromConfigs();
     void Update();
-    bool ShouldLog(std::string const& category, int64 value) const;
+    bool ShouldLog(std::string_view category, int64 value) const;
 
     template<class T, class... TagsList>
     void LogValue(std::string category, T value, TagsList&&... tags)
@@ -144,6 +159,19 @@ public:
         _queuedData.Enqueue(data);
     }
 
+    // with Metric.AggregateTimers enabled samples are only counted per thread and sent as one histogram line per batch
+    template<class... TagsList>
+    void LogTimer(std::string_view category, std::chrono::nanoseconds value, TagsList&&... tags)
+    {
+        if (_aggregateTimers)
+        {
+            std::array<MetricTag const*, sizeof...(tags)> tagList = { &tags... };
+            AggregateTimer(category, value, tagList);
+        }
+        else
+            LogValue(std::string(category), value, std::forward<TagsList>(tags)...);
+    }
+
     void LogEvent(std::string category, std::string title, std::string description);
 
     void Unload();
@@ -227,16 +255,15 @@ Optional<MetricStopWatch<LoggerType>> MakeMetricStopWatch(LoggerType&& loggerFun
 #define TC_METRIC_TIMER(category, ...)                                                                           \
         auto TC_METRIC_UNIQUE_NAME(__tc_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start)            \
         {                                                                                                        \
-            sMetric->LogValue(category, std::chrono::steady_clock::now() - start, ##__VA_ARGS__);                \
+            sMetric->LogTimer(category, std::chrono::steady_clock::now() - start, ##__VA_ARGS__);                \
         });
 #  if defined WITH_DETAILED_METRICS
 #define TC_METRIC_DETAILED_TIMER(category, ...)                                                                  \
         auto TC_METRIC_UNIQUE_NAME(__tc_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start)            \
         {                                                                                                        \
             int64 duration = int64(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - start).count()); \
-            std::string category2 = category;                                                                    \
-            if (sMetric->ShouldLog(category2, duration))                                                         \
-                sMetric->LogValue(std::move(category2), duration, ##__VA_ARGS__);                                \
+            if (sMetric->ShouldLog(category, duration))                                                          \
+                sMetric->LogValue(category, duration, ##__VA_ARGS__);                                            \
         });
 #define TC_METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) TC_METRIC_TIMER(category, ##__VA_ARGS__)
 #define TC_METRIC_DETAILED_EVENT(category, title, description) TC_METRIC_EVENT(category, title, description)
@@ -0,0 +1,213 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Profiler.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <string_view>
+
+namespace Trinity
+{
+struct ProfilerZoneEvent
+{
+    char const* Name = nullptr;
+    Profiler::Clock::time_point Start;
+    Profiler::Clock::duration Duration;
+};
+
+struct ProfilerThreadBuffer
+{
+    explicit ProfilerThreadBuffer(uint32 threadIndex) : ThreadIndex(threadIndex), Events(Profiler::EventsPerThread) { }
+
+    void Clear()
+    {
+        std::lock_guard lock(Lock);
+        Next = 0;
+        Wrapped = false;
+    }
+
+    // only contended while a trace is being exported
+    std::mutex Lock;
+    uint32 ThreadIndex;
+    std::vector<ProfilerZoneEvent> Events;
+    std::size_t Next = 0;
+    bool Wrapped = false;
+};
+
+Profiler::Profiler() : _enabled(false)
+{
+}
+
+Profiler::~Profiler() = default;
+
+Profiler* Profiler::instance()
+{
+    static Profiler instance;
+    return &instance;
+}
+
+void Profiler::Start()
+{
+    {
+        std::lock_guard lock(_threadBuffersLock);
+        for (std::shared_ptr<ProfilerThreadBuffer> const& buffer : _threadBuffers)
+            buffer->Clear();
+
+        _startTime = Clock::now();
+    }
+
+    _enabled.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::Stop()
+{
+    _enabled.store(false, std::memory_order_relaxed);
+}
+
+ProfilerThreadBuffer& Profiler::GetThreadBuffer()
+{
+    thread_local std::shared_ptr<ProfilerThreadBuffer> buffer;
+    if (!buffer)
+    {
+        std::lock_guard lock(_threadBuffersLock);
+        buffer = std::make_shared<ProfilerThreadBuffer>(uint32(_threadBuffers.size() + 1));
+        _threadBuffers.push_back(buffer);
+    }
+
+    return *buffer;
+}
+
+void Profiler::RecordZone(char const* name, Clock::time_point start, Clock::time_point end)
+{
+    ProfilerThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard lock(buffer.Lock);
+    ProfilerZoneEvent& event = buffer.Events[buffer.Next];
+    event.Name = name;
+    event.Start = start;
+    event.Duration = end - start;
+    if (++buffer.Next == buffer.Events.size())
+    {
+        buffer.Next = 0;
+        buffer.Wrapped = true;
+    }
+}
+
+std::size_t Profiler::GetRecordedZoneCount() const
+{
+    std::size_t count = 0;
+    std::lock_guard lock(_threadBuffersLock);
+    for (std::shared_ptr<ProfilerThreadBuffer> const& buffer : _threadBuffers)
+    {
+        std::lock_guard bufferLock(buffer->Lock);
+        count += buffer->Wrapped ? buffer->Events.size() : buffer->Next;
+    }
+
+    return count;
+}
+
+std::string Profiler::BuildChromeTrace() const
+{
+    return BuildChromeTrace(Clock::time_point::min());
+}
+
+std::string Profiler::BuildChromeTrace(Clock::time_point from) const
+{
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    std::string trace = R"({"displayTimeUnit":"ms","traceEvents":[)";
+    bool first = true;
+
+    std::lock_guard lock(_threadBuffersLock);
+    // zones that began before the last Start() call are leftovers of a previous session
+    from = std::max(from, _startTime);
+    for (std::shared_ptr<ProfilerThreadBuffer> const& buffer : _threadBuffers)
+    {
+        std::lock_guard bufferLock(buffer->Lock);
+        std::size_t count = buffer->Wrapped ? buffer->Events.size() : buffer->Next;
+        std::size_t begin = buffer->Wrapped ? buffer->Next : 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ProfilerZoneEvent const& event = buffer->Events[(begin + i) % buffer->Events.size()];
+            if (event.Start < from)
+                continue;
+
+            if (!first)
+                trace += ',';
+
+            first = false;
+            // names are string literals chosen by us, no escaping required
+            trace += Trinity::StringFormat(R"({{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                event.Name, buffer->ThreadIndex,
+                std::chrono::duration_cast<Microseconds>(event.Start - from).count(),
+                std::chrono::duration_cast<Microseconds>(event.Duration).count());
+        }
+    }
+
+    trace += "]}";
+    return trace;
+}
+
+std::vector<ProfilerZoneSummary> Profiler::SummarizeZones(Clock::time_point from) const
+{
+    // the same literal can have a different address in every translation unit
+    std::map<std::string_view, ProfilerZoneSummary> zones;
+
+    std::lock_guard lock(_threadBuffersLock);
+    from = std::max(from, _startTime);
+    for (std::shared_ptr<ProfilerThreadBuffer> const& buffer : _threadBuffers)
+    {
+        std::lock_guard bufferLock(buffer->Lock);
+        std::size_t count = buffer->Wrapped ? buffer->Events.size() : buffer->Next;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ProfilerZoneEvent const& event = buffer->Events[i];
+            if (event.Start < from)
+                continue;
+
+            auto [itr, inserted] = zones.try_emplace(event.Name, ProfilerZoneSummary{ .Name = event.Name, .Count = 0, .Total = Clock::duration::zero(), .Max = Clock::duration::zero() });
+            ++itr->second.Count;
+            itr->second.Total += event.Duration;
+            itr->second.Max = std::max(itr->second.Max, event.Duration);
+        }
+    }
+
+    std::vector<ProfilerZoneSummary> summaries;
+    summaries.reserve(zones.size());
+    for (auto const& [name, summary] : zones)
+        summaries.push_back(summary);
+
+    std::ranges::sort(summaries, std::ranges::greater(), &ProfilerZoneSummary::Total);
+    return summaries;
+}
+
+bool Profiler::WriteChromeTrace(std::string const& fileName) const
+{
+    return WriteChromeTrace(fileName, Clock::time_point::min());
+}
+
+bool Profiler::WriteChromeTrace(std::string const& fileName, Clock::time_point from) const
+{
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+    if (!file)
+        return false;
+
+    file << BuildChromeTrace(from);
+    return file.good();
+}
+}
@@ -0,0 +1,129 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PROFILER_H
+#define TRINITYCORE_PROFILER_H
+
+#include "Define.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Trinity
+{
+struct ProfilerThreadBuffer;
+
+struct ProfilerZoneSummary
+{
+    char const* Name;
+    std::size_t Count;
+    std::chrono::steady_clock::duration Total;
+    std::chrono::steady_clock::duration Max;
+};
+
+/**
+ * Records named timing zones into per thread ring buffers while enabled
+ * and exports them in Chrome trace event format (chrome://tracing, Perfetto)
+ *
+ * Zone names must be string literals, only the pointer is stored
+ */
+class TC_COMMON_API Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t EventsPerThread = 16384;
+
+    static Profiler* instance();
+
+    Profiler(Profiler const&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(Profiler const&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    // discards previously recorded zones
+    void Start();
+    void Stop();
+    bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    void RecordZone(char const* name, Clock::time_point start, Clock::time_point end);
+
+    std::size_t GetRecordedZoneCount() const;
+    std::string BuildChromeTrace() const;
+    bool WriteChromeTrace(std::string const& fileName) const;
+
+    // only zones that began at or after from, the ring buffers keep recording while exporting
+    std::string BuildChromeTrace(Clock::time_point from) const;
+    bool WriteChromeTrace(std::string const& fileName, Clock::time_point from) const;
+
+    // totals per zone name of the zones that began at or after from, largest total first
+    std::vector<ProfilerZoneSummary> SummarizeZones(Clock::time_point from) const;
+
+private:
+    Profiler();
+    ~Profiler();
+
+    ProfilerThreadBuffer& GetThreadBuffer();
+
+    std::atomic<bool> _enabled;
+    Clock::time_point _startTime;
+
+    mutable std::mutex _threadBuffersLock;
+    std::vector<std::shared_ptr<ProfilerThreadBuffer>> _threadBuffers;
+};
+
+class ProfilerZone
+{
+public:
+    explicit ProfilerZone(char const* name) : _name(Profiler::instance()->IsEnabled() ? name : nullptr)
+    {
+        if (_name)
+            _start = Profiler::Clock::now();
+    }
+
+    ~ProfilerZone()
+    {
+        if (_name)
+            Profiler::instance()->RecordZone(_name, _start, Profiler::Clock::now());
+    }
+
+    ProfilerZone(ProfilerZone const&) = delete;
+    ProfilerZone(ProfilerZone&&) = delete;
+    ProfilerZone& operator=(ProfilerZone const&) = delete;
+    ProfilerZone& operator=(ProfilerZone&&) = delete;
+
+private:
+    char const* _name;
+    Profiler::Clock::time_point _start;
+};
+}
+
+#define sProfiler Trinity::Profiler::instance()
+
+#define TC_PROFILE_ZONE_CONCAT_(a, b) a##b
+#define TC_PROFILE_ZONE_CONCAT(a, b) TC_PROFILE_ZONE_CONCAT_(a, b)
+
+#ifdef WITHOUT_METRICS
+#define TC_PROFILE_ZONE(name) ((void)0)
+#else
+#define TC_PROFILE_ZONE(name) Trinity::ProfilerZone TC_PROFILE_ZONE_CONCAT(__tc_profiler_zone_, __LINE__)(name)
+#endif
+
+#endif // TRINITYCORE_PROFILER_H
@@ -0,0 +1,236 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_MPMC_QUEUE_H
+#define TRINITY_MPMC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+// Bounded lock free multi producer multi consumer queue based on Dmitry Vyukov's algorithm
+// https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+// Drop-in replacement for ProducerConsumerQueue, consumers spin for a while before parking on a condition variable
+template <typename T>
+class MPMCQueue
+{
+private:
+    static constexpr std::size_t CacheLineSize = 64;
+    static constexpr uint32_t SpinCountBeforePark = 256;
+
+    struct Cell
+    {
+        std::atomic<std::size_t> Sequence;
+        T Data;
+    };
+
+public:
+    explicit MPMCQueue(std::size_t capacity = 1024) : _shutdown(false), _sleepingConsumers(0)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+
+        _mask = size - 1;
+        _buffer = std::make_unique<Cell[]>(size);
+        for (std::size_t i = 0; i < size; ++i)
+            _buffer[i].Sequence.store(i, std::memory_order_relaxed);
+
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    MPMCQueue(MPMCQueue const&) = delete;
+    MPMCQueue& operator=(MPMCQueue const&) = delete;
+
+    // Returns false if the queue is full
+    bool TryPush(T const& value) { return Enqueue(value); }
+    bool TryPush(T&& value) { return Enqueue(std::move(value)); }
+
+    // Waits for free space if the queue is full
+    void Push(T const& value) { PushImpl(value); }
+    void Push(T&& value) { PushImpl(std::move(value)); }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    // approximate when called concurrently with Push/Pop
+    std::size_t Size() const
+    {
+        std::size_t enqueuePos = _enqueuePos.load(std::memory_order_acquire);
+        std::size_t dequeuePos = _dequeuePos.load(std::memory_order_acquire);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    bool Pop(T& value)
+    {
+        if (_shutdown.load(std::memory_order_acquire))
+            return false;
+
+        return Dequeue(value);
+    }
+
+    void WaitAndPop(T& value)
+    {
+        for (uint32_t i = 0; i < SpinCountBeforePark; ++i)
+        {
+            if (_shutdown.load(std::memory_order_acquire))
+                return;
+
+            if (Dequeue(value))
+                return;
+
+            std::this_thread::yield();
+        }
+
+        std::unique_lock<std::mutex> lock(_parkLock);
+        _sleepingConsumers.fetch_add(1, std::memory_order_relaxed);
+        // pairs with the fence in NotifyConsumer - either we see the element or producer sees us sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        while (!_shutdown.load(std::memory_order_acquire) && !Dequeue(value))
+            _parkCondition.wait(lock);
+
+        _sleepingConsumers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void Cancel()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_parkLock);
+            _shutdown.store(true, std::memory_order_release);
+        }
+
+        _parkCondition.notify_all();
+
+        DeletePendingPointers();
+    }
+
+private:
+    template <typename V>
+    bool Enqueue(V&& value)
+    {
+        Cell* cell;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &_buffer[pos & _mask];
+            std::size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = std::ptrdiff_t(sequence) - std::ptrdiff_t(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->Data = std::forward<V>(value);
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+
+        NotifyConsumer();
+        return true;
+    }
+
+    bool Dequeue(T& value)
+    {
+        Cell* cell;
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &_buffer[pos & _mask];
+            std::size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = std::ptrdiff_t(sequence) - std::ptrdiff_t(pos + 1);
+            if (diff == 0)
+            {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+        }
+
+        value = std::move(cell->Data);
+        cell->Sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename V>
+    void PushImpl(V&& value)
+    {
+        while (!Enqueue(std::forward<V>(value)))
+        {
+            if (_shutdown.load(std::memory_order_acquire))
+            {
+                if constexpr (std::is_pointer_v<T>)
+                    delete value;
+
+                return;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    void NotifyConsumer()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!_sleepingConsumers.load(std::memory_order_relaxed))
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(_parkLock);
+        }
+
+        _parkCondition.notify_one();
+    }
+
+    void DeletePendingPointers()
+    {
+        T value;
+        while (Dequeue(value))
+        {
+            if constexpr (std::is_pointer_v<T>)
+                delete value;
+        }
+    }
+
+    std::unique_ptr<Cell[]> _buffer;
+    std::size_t _mask;
+
+    alignas(CacheLineSize) std::atomic<std::size_t> _enqueuePos;
+    alignas(CacheLineSize) std::atomic<std::size_t> _dequeuePos;
+    alignas(CacheLineSize) std::atomic<bool> _shutdown;
+    std::atomic<uint32_t> _sleepingConsumers;
+
+    std::mutex _parkLock;
+    std::condition_variable _parkCondition;
+};
+
+#endif // TRINITY_MPMC_QUEUE_H
@@ -96,3 +96,43 @@ void SetProcessPriority(std::string const& logChannel, uint32 affinity, bool hig
     (void)highPriority;
 #endif
 }
+
+void SetCurrentThreadAffinity(std::string const& logChannel, uint32 affinity)
+{
+    if (!affinity)
+        return;
+
+#ifdef _WIN32 // Windows
+
+    ULONG_PTR appAff;
+    ULONG_PTR sysAff;
+
+    if (GetProcessAffinityMask(GetCurrentProcess(), &appAff, &sysAff))
+    {
+        // remove non accessible processors
+        ULONG_PTR currentAffinity = affinity & appAff;
+
+        if (!currentAffinity)
+            TC_LOG_ERROR(logChannel, "Thread processors bitmask (hex) {:x} are not accessible. Accessible processors bitmask (hex): {:x}", affinity, appAff);
+        else if (!SetThreadAffinityMask(GetCurrentThread(), currentAffinity))
+            TC_LOG_ERROR(logChannel, "Can't set thread processors (hex): {:x}", currentAffinity);
+    }
+
+#elif defined(__linux__) // Linux
+
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+
+    for (unsigned int i = 0; i < sizeof(affinity) * 8; ++i)
+        if (affinity & (1u << i))
+            CPU_SET(i, &mask);
+
+    // pid 0 only affects the calling thread
+    if (sched_setaffinity(0, sizeof(mask), &mask))
+        TC_LOG_ERROR(logChannel, "Can't set thread processors (hex): {:x}, error: {}", affinity, strerror(errno));
+
+#else
+    // Suppresses unused argument warning for all other platforms
+    (void)logChannel;
+#endif
+}
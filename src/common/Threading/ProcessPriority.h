@@ -26,4 +26,7 @@
 
 void TC_COMMON_API SetProcessPriority(std::string const& logChannel, uint32 affinity, bool highPriority);
 
+// Restricts the calling thread to processors in affinity bitmask, 0 leaves it unchanged
+void TC_COMMON_API SetCurrentThreadAffinity(std::string const& logChannel, uint32 affinity);
+
 #endif
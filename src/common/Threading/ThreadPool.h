@@ -20,7 +20,12 @@
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace Trinity
 {
@@ -35,6 +40,43 @@ public:
         return boost::asio::post(_impl, std::forward<T>(work));
     }
 
+    /// Queues work and returns a future for its result
+    template<typename T>
+    auto Submit(T&& work) -> std::future<std::invoke_result_t<std::decay_t<T>&>>
+    {
+        std::packaged_task<std::invoke_result_t<std::decay_t<T>&>()> task(std::forward<T>(work));
+        auto result = task.get_future();
+        PostWork(std::move(task));
+        return result;
+    }
+
+    /**
+     * Calls work(index) for every index in [0, count) and returns once all calls completed.
+     * The calling thread takes part, up to maxHelpers pool threads join it. Indexes are claimed one
+     * at a time so threads that finish early take over what is left instead of waiting for the others.
+     */
+    template<typename T>
+    void ParallelFor(std::size_t count, std::size_t maxHelpers, T&& work)
+    {
+        std::atomic<std::size_t> nextIndex = 0;
+        auto runIndexes = [&work, &nextIndex, count]
+        {
+            for (std::size_t i = nextIndex++; i < count; i = nextIndex++)
+                work(i);
+        };
+
+        std::size_t helperCount = count ? std::min(count - 1, maxHelpers) : 0;
+        std::vector<std::future<void>> helpers;
+        helpers.reserve(helperCount);
+        for (std::size_t i = 0; i < helperCount; ++i)
+            helpers.push_back(Submit(runIndexes));
+
+        runIndexes();
+
+        for (std::future<void>& helper : helpers)
+            helper.wait();
+    }
+
     void Join()
     {
         _impl.join();
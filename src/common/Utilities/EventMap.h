@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "Duration.h"
+#include <boost/container/small_vector.hpp>
 #include <map>
 #include <vector>
 
@@ -27,16 +28,20 @@ class TC_COMMON_API EventMap
 {
     /**
     * Internal storage type.
-    * Key: Time as TimePoint when the event should occur.
-    * Value: The event data as uint32.
+    * First: Time as TimePoint when the event should occur.
+    * Second: The event data as uint32.
     *
     * Structure of event data:
     * - Bit  0 - 15: Event Id.
     * - Bit 16 - 23: Group
     * - Bit 24 - 31: Phase
     * - Pattern: 0xPPGGEEEE
+    *
+    * Sorted in reverse execution order, the next event to occur is at the back.
+    * Events scheduled for the same time occur in the order they were scheduled.
+    * Typical scripts keep only a few events scheduled, these fit in the inline storage.
     */
-    typedef std::multimap<TimePoint, uint32> EventStore;
+    typedef boost::container::small_vector<std::pair<TimePoint, uint32>, 8> EventStore;
     typedef std::map<uint32 /*event data*/, std::vector<Milliseconds>> EventSeriesStore;
 
 public:
@@ -258,6 +263,14 @@ public:
     void ScheduleEventSeries(uint32 eventId, std::initializer_list<Milliseconds> series);
 
 private:
+    /**
+    * @name InsertEvent
+    * @brief Adds event data to the storage after all events scheduled for the same or an earlier time.
+    * @param time Time when the event should occur.
+    * @param eventData Full event data, including group and phase.
+    */
+    void InsertEvent(TimePoint time, uint32 eventData);
+
     /**
     * @name _time
     * @brief Internal timer.
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FrameArena.h"
+#include <algorithm>
+
+namespace
+{
+thread_local Trinity::FrameArena* CurrentFrameArena = nullptr;
+}
+
+namespace Trinity
+{
+FrameArena::FrameArena(std::size_t blockSize) : _currentBlock(0), _currentOffset(0), _blockSize(blockSize), _allocatedBytes(0)
+{
+}
+
+FrameArena::~FrameArena() = default;
+
+void* FrameArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    auto allocateFromCurrentBlock = [&]() -> void*
+    {
+        Block& block = _blocks[_currentBlock];
+        void* ptr = block.Data.get() + _currentOffset;
+        std::size_t space = block.Size - _currentOffset;
+        if (!std::align(alignment, size, ptr, space))
+            return nullptr;
+
+        _currentOffset = block.Size - space + size;
+        _allocatedBytes += size;
+        return ptr;
+    };
+
+    for (; _currentBlock < _blocks.size(); ++_currentBlock, _currentOffset = 0)
+        if (void* ptr = allocateFromCurrentBlock())
+            return ptr;
+
+    // oversized requests get a dedicated block
+    Block& block = _blocks.emplace_back();
+    block.Size = std::max(_blockSize, size + alignment);
+    block.Data = std::make_unique<std::byte[]>(block.Size);
+    _currentBlock = _blocks.size() - 1;
+    _currentOffset = 0;
+    return allocateFromCurrentBlock();
+}
+
+void FrameArena::Reset()
+{
+    // don't keep memory of unusual spikes around
+    std::erase_if(_blocks, [this](Block const& block) { return block.Size > _blockSize; });
+
+    _currentBlock = 0;
+    _currentOffset = 0;
+    _allocatedBytes = 0;
+}
+
+FrameArena* FrameArena::GetCurrent()
+{
+    return CurrentFrameArena;
+}
+
+FrameArenaScope::FrameArenaScope(FrameArena& arena) : _arena(arena), _previous(CurrentFrameArena)
+{
+    CurrentFrameArena = &_arena;
+}
+
+FrameArenaScope::~FrameArenaScope()
+{
+    CurrentFrameArena = _previous;
+    _arena.Reset();
+}
+}
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_FRAME_ARENA_H
+#define TRINITYCORE_FRAME_ARENA_H
+
+#include "Define.h"
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace Trinity
+{
+/**
+ * Bump allocator for temporaries that live no longer than one update.
+ * Individual deallocations are no-ops, all memory is reclaimed at once by Reset
+ * and the blocks are kept for the next update.
+ */
+class TC_COMMON_API FrameArena
+{
+public:
+    explicit FrameArena(std::size_t blockSize = 64 * 1024);
+    ~FrameArena();
+
+    FrameArena(FrameArena const&) = delete;
+    FrameArena(FrameArena&&) = delete;
+    FrameArena& operator=(FrameArena const&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+
+    void* Allocate(std::size_t size, std::size_t alignment);
+
+    // Invalidates everything allocated since last reset
+    void Reset();
+
+    std::size_t GetAllocatedBytes() const { return _allocatedBytes; }
+
+    // Arena of the innermost FrameArenaScope on calling thread, nullptr if there is none
+    static FrameArena* GetCurrent();
+
+private:
+    friend class FrameArenaScope;
+
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> Data;
+        std::size_t Size;
+    };
+
+    std::vector<Block> _blocks;
+    std::size_t _currentBlock;
+    std::size_t _currentOffset;
+    std::size_t _blockSize;
+    std::size_t _allocatedBytes;
+};
+
+// Makes arena current for FrameAllocator on this thread and resets it when leaving the scope
+class TC_COMMON_API FrameArenaScope
+{
+public:
+    explicit FrameArenaScope(FrameArena& arena);
+    ~FrameArenaScope();
+
+    FrameArenaScope(FrameArenaScope const&) = delete;
+    FrameArenaScope(FrameArenaScope&&) = delete;
+    FrameArenaScope& operator=(FrameArenaScope const&) = delete;
+    FrameArenaScope& operator=(FrameArenaScope&&) = delete;
+
+private:
+    FrameArena& _arena;
+    FrameArena* _previous;
+};
+
+/**
+ * Allocator binding to the current FrameArena at construction, falls back to the global heap when none is active.
+ * Containers using it must never outlive the FrameArenaScope they were created in.
+ */
+template <typename T>
+class FrameAllocator
+{
+public:
+    using value_type = T;
+
+    FrameAllocator() noexcept : _arena(FrameArena::GetCurrent()) { }
+
+    template <typename U>
+    FrameAllocator(FrameAllocator<U> const& other) noexcept : _arena(other._arena) { }
+
+    T* allocate(std::size_t count)
+    {
+        if (_arena)
+            return static_cast<T*>(_arena->Allocate(count * sizeof(T), alignof(T)));
+
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept
+    {
+        if (!_arena)
+            std::allocator<T>().deallocate(ptr, count);
+    }
+
+    template <typename U>
+    bool operator==(FrameAllocator<U> const& other) const noexcept { return _arena == other._arena; }
+
+private:
+    template <typename U>
+    friend class FrameAllocator;
+
+    FrameArena* _arena;
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+template <typename T>
+using FrameList = std::list<T, FrameAllocator<T>>;
+
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+using FrameUnorderedSet = std::unordered_set<T, Hash, KeyEqual, FrameAllocator<T>>;
+}
+
+#endif // TRINITYCORE_FRAME_ARENA_H
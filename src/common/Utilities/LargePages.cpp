@@ -0,0 +1,65 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LargePages.h"
+#include <atomic>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+std::atomic<bool> Enabled = false;
+
+#ifdef __linux__
+constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+#endif
+}
+
+namespace Trinity::LargePages
+{
+void SetEnabled(bool enabled) noexcept
+{
+    Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsEnabled() noexcept
+{
+    return Enabled.load(std::memory_order_relaxed);
+}
+
+void Advise(void* data, std::size_t size) noexcept
+{
+#ifdef __linux__
+    if (!IsEnabled() || !data)
+        return;
+
+    // only whole huge pages inside the allocation can be advised, the rest stays on regular pages
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(data) + HugePageSize - 1) & ~(HugePageSize - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(data) + size) & ~(HugePageSize - 1);
+    if (end <= begin)
+        return;
+
+    // failure only means the memory stays on regular pages
+    (void)madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+#else
+    (void)data;
+    (void)size;
+#endif
+}
+}
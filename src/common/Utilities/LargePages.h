@@ -0,0 +1,36 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LARGE_PAGES_H
+#define TRINITYCORE_LARGE_PAGES_H
+
+#include "Define.h"
+#include <cstddef>
+
+namespace Trinity::LargePages
+{
+    TC_COMMON_API void SetEnabled(bool enabled) noexcept;
+    TC_COMMON_API bool IsEnabled() noexcept;
+
+    /**
+     * Asks the kernel to back the huge page aligned part of a large, long lived allocation with transparent huge pages.
+     * Does nothing when disabled, for allocations smaller than a huge page and on platforms other than Linux.
+     */
+    TC_COMMON_API void Advise(void* data, std::size_t size) noexcept;
+}
+
+#endif // TRINITYCORE_LARGE_PAGES_H
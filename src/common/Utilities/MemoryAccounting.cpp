@@ -0,0 +1,78 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MemoryAccounting.h"
+#include <array>
+#include <atomic>
+
+namespace
+{
+// one cache line per domain, map threads allocate objects concurrently
+struct alignas(64) MemoryDomainCounters
+{
+    std::atomic<int64> LiveBytes;
+    std::atomic<uint64> Allocations;
+    std::atomic<uint64> AllocatedBytes;
+};
+
+std::array<MemoryDomainCounters, size_t(Trinity::MemoryDomain::Max)> Counters = { };
+}
+
+namespace Trinity::MemoryAccounting
+{
+void TrackAllocation(MemoryDomain domain, std::size_t bytes) noexcept
+{
+    MemoryDomainCounters& counters = Counters[size_t(domain)];
+    counters.LiveBytes.fetch_add(int64(bytes), std::memory_order_relaxed);
+    counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.AllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void TrackDeallocation(MemoryDomain domain, std::size_t bytes) noexcept
+{
+    Counters[size_t(domain)].LiveBytes.fetch_sub(int64(bytes), std::memory_order_relaxed);
+}
+
+MemoryDomainStats GetStats(MemoryDomain domain) noexcept
+{
+    MemoryDomainCounters const& counters = Counters[size_t(domain)];
+    MemoryDomainStats stats;
+    stats.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+    stats.Allocations = counters.Allocations.load(std::memory_order_relaxed);
+    stats.AllocatedBytes = counters.AllocatedBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::string_view GetDomainName(MemoryDomain domain) noexcept
+{
+    switch (domain)
+    {
+        case MemoryDomain::Objects:
+            return "objects";
+        case MemoryDomain::Grids:
+            return "grids";
+        case MemoryDomain::PacketPool:
+            return "packet_pool";
+        case MemoryDomain::ObjectMgr:
+            return "objectmgr";
+        default:
+            break;
+    }
+
+    return "unknown";
+}
+}
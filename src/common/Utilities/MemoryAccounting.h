@@ -0,0 +1,113 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MEMORY_ACCOUNTING_H
+#define TRINITYCORE_MEMORY_ACCOUNTING_H
+
+#include "Define.h"
+#include <memory>
+#include <new>
+#include <string_view>
+
+namespace Trinity
+{
+enum class MemoryDomain : uint8
+{
+    Objects,        // everything derived from Object, world objects and items
+    Grids,          // loaded map grids
+    PacketPool,     // packet buffer storage kept around for reuse
+    ObjectMgr,      // creature and gameobject templates and spawns
+
+    Max
+};
+
+struct MemoryDomainStats
+{
+    int64 LiveBytes = 0;
+    uint64 Allocations = 0;
+    uint64 AllocatedBytes = 0;
+};
+
+namespace MemoryAccounting
+{
+    TC_COMMON_API void TrackAllocation(MemoryDomain domain, std::size_t bytes) noexcept;
+    TC_COMMON_API void TrackDeallocation(MemoryDomain domain, std::size_t bytes) noexcept;
+
+    TC_COMMON_API MemoryDomainStats GetStats(MemoryDomain domain) noexcept;
+    TC_COMMON_API std::string_view GetDomainName(MemoryDomain domain) noexcept;
+}
+
+/**
+ * Allocator for standard containers that counts its memory towards a domain
+ */
+template <typename T, MemoryDomain Domain>
+class AccountedAllocator
+{
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = AccountedAllocator<U, Domain>;
+    };
+
+    AccountedAllocator() noexcept = default;
+
+    template <typename U>
+    AccountedAllocator(AccountedAllocator<U, Domain> const& /*other*/) noexcept { }
+
+    T* allocate(std::size_t count)
+    {
+        T* result = std::allocator<T>().allocate(count);
+        MemoryAccounting::TrackAllocation(Domain, count * sizeof(T));
+        return result;
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept
+    {
+        MemoryAccounting::TrackDeallocation(Domain, count * sizeof(T));
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    template <typename U>
+    friend bool operator==(AccountedAllocator const& /*left*/, AccountedAllocator<U, Domain> const& /*right*/) noexcept { return true; }
+};
+
+/**
+ * Base class counting heap allocated instances of derived classes towards a domain
+ * The sized delete receives the size of the most derived type as long as the destructor is virtual
+ */
+template <MemoryDomain Domain>
+struct AccountedObject
+{
+    static void* operator new(std::size_t size)
+    {
+        void* result = ::operator new(size);
+        MemoryAccounting::TrackAllocation(Domain, size);
+        return result;
+    }
+
+    static void operator delete(void* pointer, std::size_t size) noexcept
+    {
+        MemoryAccounting::TrackDeallocation(Domain, size);
+        ::operator delete(pointer, size);
+    }
+};
+}
+
+#endif // TRINITYCORE_MEMORY_ACCOUNTING_H
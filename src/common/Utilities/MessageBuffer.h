@@ -36,6 +36,11 @@ public:
     {
     }
 
+    // Takes ownership of already written data, all of it is treated as active
+    explicit MessageBuffer(std::vector<uint8>&& storage) noexcept : _wpos(storage.size()), _rpos(0), _storage(std::move(storage))
+    {
+    }
+
     MessageBuffer(MessageBuffer const& right) = default;
 
     MessageBuffer(MessageBuffer&& right) noexcept : _wpos(right._wpos), _rpos(right._rpos), _storage(std::move(right).Release()) { }
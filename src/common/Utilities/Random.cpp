@@ -67,6 +67,16 @@ Milliseconds randtime(Milliseconds min, Milliseconds max)
     return min + Milliseconds(urand(0, uint32(diff)));
 }
 
+void SetRandomSeed(uint32 seed)
+{
+    *GetRng() = SFMTRand(seed);
+}
+
+void ResetRandomSeed()
+{
+    *GetRng() = SFMTRand();
+}
+
 uint32 rand32()
 {
     return GetRng()->RandomUInt32();
@@ -46,6 +46,12 @@ TC_COMMON_API float rand_norm();
 /* Return a random float from 0.0 to 100.0 (exclusive). */
 TC_COMMON_API float rand_chance();
 
+/* Restart the random number sequence of the calling thread from seed, for reproducible benchmarks. */
+TC_COMMON_API void SetRandomSeed(uint32 seed);
+
+/* Reseed the random number generator of the calling thread from the system entropy source again. */
+TC_COMMON_API void ResetRandomSeed();
+
 /* Return a random number in the range 0..count (exclusive) with each value having a different chance of happening */
 TC_COMMON_API uint32 urandweighted(size_t count, double const* chances);
 
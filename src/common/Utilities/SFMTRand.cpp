@@ -36,6 +36,11 @@ SFMTRand::SFMTRand() noexcept
         sfmt_init_gen_rand(&_state, uint32(time(nullptr)));
 }
 
+SFMTRand::SFMTRand(uint32 seed) noexcept
+{
+    sfmt_init_gen_rand(&_state, seed);
+}
+
 uint32 SFMTRand::RandomUInt32() noexcept                            // Output random bits
 {
     return sfmt_genrand_uint32(&_state);
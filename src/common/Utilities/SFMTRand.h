@@ -28,6 +28,7 @@
 class SFMTRand {
 public:
     SFMTRand() noexcept;
+    explicit SFMTRand(uint32 seed) noexcept;
     uint32 RandomUInt32() noexcept; // Output random bits
     void* operator new(size_t size) noexcept { return ::operator new (size, std::align_val_t(alignof(SFMTRand)), std::nothrow); }
     void operator delete(void* ptr) noexcept { ::operator delete (ptr, std::align_val_t(alignof(SFMTRand)), std::nothrow); }
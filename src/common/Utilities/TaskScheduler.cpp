@@ -193,19 +193,24 @@ void TaskScheduler::Dispatch(success_t const& callback/* = nullptr*/)
 
 void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    container.emplace(std::move(task));
+    // tasks ending later are closer to the front, the new task goes in front of all tasks ending at the same time
+    auto where = std::partition_point(container.begin(), container.end(), [&task](TaskContainer const& other)
+    {
+        return Compare()(task, other);
+    });
+    container.insert(where, std::move(task));
 }
 
 auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    TaskContainer result = std::move(container.back());
+    container.pop_back();
     return result;
 }
 
 auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
 {
-    return *container.begin();
+    return container.back();
 }
 
 void TaskScheduler::TaskQueue::Clear()
@@ -215,26 +220,24 @@ void TaskScheduler::TaskQueue::Clear()
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-            itr = container.erase(itr);
-        else
-            ++itr;
+    std::erase_if(container, [&filter](TaskContainer const& task) { return filter(task); });
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
+    // walk in execution order so modified tasks ending at the same time keep their order when pushed again
     std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
+    for (auto itr = container.rbegin(); itr != container.rend(); ++itr)
         if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
-            ++itr;
+            cache.push_back(std::move(*itr));
+
+    if (cache.empty())
+        return;
+
+    std::erase_if(container, [](TaskContainer const& task) { return !task; });
 
-    container.insert(cache.begin(), cache.end());
+    for (TaskContainer& task : cache)
+        Push(std::move(task));
 }
 
 bool TaskScheduler::TaskQueue::IsEmpty() const
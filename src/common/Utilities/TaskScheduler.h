@@ -128,7 +128,9 @@ class TC_COMMON_API TaskScheduler
 
     class TC_COMMON_API TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        // Sorted in reverse execution order, the next task to run is at the back.
+        // Tasks ending at the same time run in the order they were pushed.
+        std::vector<TaskContainer> container;
 
     public:
         // Pushes the task in the container
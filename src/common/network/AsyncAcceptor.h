@@ -37,9 +37,16 @@ concept AcceptCallback = std::invocable<Callable, IoContextTcpSocket&&, uint32>;
 class AsyncAcceptor
 {
 public:
+#ifdef SO_REUSEPORT
+    static constexpr bool SupportsReusePort = true;
+    using reuse_port = boost::asio::detail::socket_option::boolean<BOOST_ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>;
+#else
+    static constexpr bool SupportsReusePort = false;
+#endif
+
     AsyncAcceptor(Asio::IoContext& ioContext, std::string const& bindIp, uint16 port) :
         _acceptor(ioContext), _endpoint(make_address(bindIp), port),
-        _socket(ioContext), _closed(false), _socketFactory([this] { return DefaultSocketFactory(); })
+        _socket(ioContext), _closed(false), _reusePort(false), _socketFactory([this] { return DefaultSocketFactory(); })
     {
     }
 
@@ -90,6 +97,19 @@ public:
         }
 #endif
 
+#ifdef SO_REUSEPORT
+        // lets several acceptors listen on the same endpoint, the kernel distributes incoming connections between them
+        if (_reusePort)
+        {
+            _acceptor.set_option(reuse_port(true), errorCode);
+            if (errorCode)
+            {
+                TC_LOG_INFO("network", "Failed to set reuse_port option on acceptor {}", errorCode.message());
+                return false;
+            }
+        }
+#endif
+
         // v6_only is enabled on some *BSD distributions by default
         // we want to allow both v4 and v6 connections to the same listener
         if (_endpoint.protocol() == boost::asio::ip::tcp::v6())
@@ -121,6 +141,8 @@ public:
         _acceptor.close(err);
     }
 
+    void SetReusePort(bool reusePort) { _reusePort = reusePort; }
+
     void SetSocketFactory(std::function<std::pair<IoContextTcpSocket*, uint32>()> func) { _socketFactory = std::move(func); }
 
 private:
@@ -130,6 +152,7 @@ private:
     boost::asio::ip::tcp::endpoint _endpoint;
     IoContextTcpSocket _socket;
     std::atomic<bool> _closed;
+    bool _reusePort;
     std::function<std::pair<IoContextTcpSocket*, uint32>()> _socketFactory;
 };
 }
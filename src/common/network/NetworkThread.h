@@ -92,6 +92,8 @@ public:
 
     Trinity::Net::IoContextTcpSocket* GetSocketForAccept() { return &_acceptSocket; }
 
+    Trinity::Asio::IoContext& GetIoContext() { return _ioContext; }
+
 protected:
     virtual void SocketAdded(std::shared_ptr<SocketType> const& /*sock*/) { }
     virtual void SocketRemoved(std::shared_ptr<SocketType> const& /*sock*/) { }
@@ -25,9 +25,12 @@
 #include "SocketConnectionInitializer.h"
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
+#include <span>
 #include <type_traits>
 
 #define READ_BLOCK_SIZE 4096
@@ -187,7 +190,7 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -240,8 +243,7 @@ protected:
         _isWritingAsync = true;
 
 #ifdef TC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()),
+        _socket.async_write_some(GatherWriteBuffers(),
             [self = this->shared_from_this()](boost::system::error_code const& error, std::size_t transferedBytes)
             {
                 self->WriteHandler(error, transferedBytes);
@@ -286,9 +288,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            ConsumeWriteBuffers(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -312,37 +312,34 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::span<boost::asio::const_buffer const> buffers = GatherWriteBuffers();
+        std::size_t bytesToSend = boost::asio::buffer_size(buffers);
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(buffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_openState == OpenState_Closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_openState == OpenState_Closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
-        {
-            queuedMessage.ReadCompleted(bytesSent);
+
+        ConsumeWriteBuffers(bytesSent);
+        if (bytesSent < bytesToSend) // now n > 0
             return AsyncProcessQueue();
-        }
 
-        _writeQueue.pop();
         if (_openState == OpenState_Closing && _writeQueue.empty())
             CloseSocket();
         return !_writeQueue.empty();
@@ -350,13 +347,42 @@ private:
 
 #endif
 
+    // Collects the front of the write queue into a single gathered (writev) write
+    std::span<boost::asio::const_buffer const> GatherWriteBuffers()
+    {
+        std::size_t count = 0;
+        for (MessageBuffer& buffer : _writeQueue)
+        {
+            if (count == _gatheredWriteBuffers.size())
+                break;
+
+            _gatheredWriteBuffers[count++] = boost::asio::const_buffer(buffer.GetReadPointer(), buffer.GetActiveSize());
+        }
+
+        return { _gatheredWriteBuffers.data(), count };
+    }
+
+    void ConsumeWriteBuffers(std::size_t bytes)
+    {
+        while (bytes > 0 && !_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            std::size_t consumed = std::min(bytes, buffer.GetActiveSize());
+            buffer.ReadCompleted(consumed);
+            bytes -= consumed;
+            if (!buffer.GetActiveSize())
+                _writeQueue.pop_front();
+        }
+    }
+
     Stream _socket;
 
     boost::asio::ip::address _remoteAddress;
     uint16 _remotePort = 0;
 
     MessageBuffer _readBuffer = MessageBuffer(READ_BLOCK_SIZE);
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    std::array<boost::asio::const_buffer, 64> _gatheredWriteBuffers;
 
     // Socket open state "enum" (not enum to enable integral std::atomic api)
     static constexpr uint8 OpenState_Open       = 0x0;
@@ -24,6 +24,7 @@
 #include "Socket.h"
 #include <boost/asio/ip/tcp.hpp>
 #include <memory>
+#include <vector>
 
 namespace Trinity::Net
 {
@@ -38,54 +39,78 @@ public:
 
     virtual ~SocketMgr()
     {
-        ASSERT(!_threads && !_acceptor && !_threadCount, "StopNetwork must be called prior to SocketMgr destruction");
+        ASSERT(!_threads && !_acceptor && _threadAcceptors.empty() && !_threadCount, "StopNetwork must be called prior to SocketMgr destruction");
     }
 
     virtual bool StartNetwork(Asio::IoContext& ioContext, std::string const& bindIp, uint16 port, int threadCount)
     {
         ASSERT(threadCount > 0);
 
-        std::unique_ptr<AsyncAcceptor> acceptor = nullptr;
-        try
-        {
-            acceptor = std::make_unique<AsyncAcceptor>(ioContext, bindIp, port);
-        }
-        catch (boost::system::system_error const& err)
-        {
-            TC_LOG_ERROR("network", "Exception caught in SocketMgr.StartNetwork ({}:{}): {}", bindIp, port, err.what());
-            return false;
-        }
-
-        if (!acceptor->Bind())
+        if (_reusePortListeners && !AsyncAcceptor::SupportsReusePort)
         {
-            TC_LOG_ERROR("network", "StartNetwork failed to bind socket acceptor");
-            return false;
+            TC_LOG_ERROR("network", "StartNetwork: SO_REUSEPORT is not supported on this platform, using a single listener for {}:{}", bindIp, port);
+            _reusePortListeners = false;
         }
 
-        _acceptor = std::move(acceptor);
         _threadCount = threadCount;
         _threads.reset(CreateThreads());
 
         ASSERT(_threads);
 
+        auto abortStart = [this]()
+        {
+            _acceptor = nullptr;
+            _threadAcceptors.clear();
+            _threads = nullptr;
+            _threadCount = 0;
+            return false;
+        };
+
+        if (!_reusePortListeners)
+        {
+            _acceptor = CreateAcceptor(ioContext, bindIp, port);
+            if (!_acceptor)
+                return abortStart();
+
+            _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
+        }
+        else
+        {
+            // every network thread listens on its own socket, accepted connections stay on the thread that accepted them
+            _threadAcceptors.reserve(_threadCount);
+            for (int32 i = 0; i < _threadCount; ++i)
+            {
+                std::unique_ptr<AsyncAcceptor> acceptor = CreateAcceptor(_threads[i].GetIoContext(), bindIp, port);
+                if (!acceptor)
+                    return abortStart();
+
+                acceptor->SetSocketFactory([this, i]() { return std::make_pair(_threads[i].GetSocketForAccept(), uint32(i)); });
+                _threadAcceptors.push_back(std::move(acceptor));
+            }
+        }
+
         for (int32 i = 0; i < _threadCount; ++i)
             _threads[i].Start();
 
-        _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
-
         return true;
     }
 
     virtual void StopNetwork()
     {
-        _acceptor->Close();
+        if (_acceptor)
+            _acceptor->Close();
 
         for (int32 i = 0; i < _threadCount; ++i)
             _threads[i].Stop();
 
         Wait();
 
+        // per thread listeners are only used by their own network thread, close them after it exits
+        for (std::unique_ptr<AsyncAcceptor>& acceptor : _threadAcceptors)
+            acceptor->Close();
+
         _acceptor = nullptr;
+        _threadAcceptors.clear();
         _threads = nullptr;
         _threadCount = 0;
     }
@@ -131,15 +156,50 @@ public:
     }
 
 protected:
-    SocketMgr() : _threadCount(0)
+    SocketMgr() : _threadCount(0), _reusePortListeners(false)
     {
     }
 
     virtual NetworkThread<SocketType>* CreateThreads() const = 0;
 
+    template <AcceptCallback Callback>
+    void AsyncAccept(Callback const& acceptCallback)
+    {
+        if (_acceptor)
+            _acceptor->AsyncAccept(Callback(acceptCallback));
+
+        for (std::unique_ptr<AsyncAcceptor>& acceptor : _threadAcceptors)
+            acceptor->AsyncAccept(Callback(acceptCallback));
+    }
+
+    std::unique_ptr<AsyncAcceptor> CreateAcceptor(Asio::IoContext& ioContext, std::string const& bindIp, uint16 port) const
+    {
+        std::unique_ptr<AsyncAcceptor> acceptor = nullptr;
+        try
+        {
+            acceptor = std::make_unique<AsyncAcceptor>(ioContext, bindIp, port);
+        }
+        catch (boost::system::system_error const& err)
+        {
+            TC_LOG_ERROR("network", "Exception caught in SocketMgr.StartNetwork ({}:{}): {}", bindIp, port, err.what());
+            return nullptr;
+        }
+
+        acceptor->SetReusePort(_reusePortListeners);
+        if (!acceptor->Bind())
+        {
+            TC_LOG_ERROR("network", "StartNetwork failed to bind socket acceptor");
+            return nullptr;
+        }
+
+        return acceptor;
+    }
+
     std::unique_ptr<AsyncAcceptor> _acceptor;
+    std::vector<std::unique_ptr<AsyncAcceptor>> _threadAcceptors;
     std::unique_ptr<NetworkThread<SocketType>[]> _threads;
     int32 _threadCount;
+    bool _reusePortListeners;
 };
 }
 
@@ -18,6 +18,7 @@
 #ifndef TRINITYCORE_SSL_STREAM_H
 #define TRINITYCORE_SSL_STREAM_H
 
+#include "Metric.h"
 #include "SocketConnectionInitializer.h"
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
@@ -33,7 +34,7 @@ struct SslHandshakeConnectionInitializer final : SocketConnectionInitializer
     void Start() override
     {
         _socket->underlying_stream().async_handshake(boost::asio::ssl::stream_base::server,
-            [socketRef = _socket->weak_from_this(), self = this->shared_from_this()](boost::system::error_code const& error)
+            [socketRef = _socket->weak_from_this(), self = this->shared_from_this(), start = std::chrono::steady_clock::now()](boost::system::error_code const& error)
             {
                 std::shared_ptr<SocketImpl> socket = static_pointer_cast<SocketImpl>(socketRef.lock());
                 if (!socket)
@@ -42,10 +43,15 @@ struct SslHandshakeConnectionInitializer final : SocketConnectionInitializer
                 if (error)
                 {
                     TC_LOG_ERROR("session", "{} SSL Handshake failed {}", socket->GetClientInfo(), error.message());
+                    TC_METRIC_VALUE("tls_handshake_failed", 1);
                     socket->CloseSocket();
                     return;
                 }
 
+                // includes network round trips, resumed sessions skip the certificate exchange and most of the key agreement cpu cost
+                TC_METRIC_VALUE("tls_handshake_time", uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()),
+                    TC_METRIC_TAG("type", socket->underlying_stream().is_session_reused() ? "resumed" : "full"));
+
                 if (self->next)
                     self->next->Start();
         });
@@ -135,6 +141,11 @@ public:
         return _sslSocket.async_handshake(type, std::forward<HandshakeHandlerType>(handler));
     }
 
+    bool is_session_reused()
+    {
+        return SSL_session_reused(_sslSocket.native_handle()) != 0;
+    }
+
     void set_server_name(std::string const& serverName, boost::system::error_code& error)
     {
         if (!SSL_set_tlsext_host_name(_sslSocket.native_handle(), serverName.c_str()))
@@ -23,6 +23,7 @@
 * authentication server
 */
 
+#include "AccountInfoCache.h"
 #include "AppenderDB.h"
 #include "Banner.h"
 #include "BigNumber.h"
@@ -36,6 +37,7 @@
 #include "Locales.h"
 #include "LoginRESTService.h"
 #include "Memory.h"
+#include "Metric.h"
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "ProcessPriority.h"
@@ -86,6 +88,7 @@ void StopDB();
 void SignalHandler(std::weak_ptr<Trinity::Asio::IoContext> ioContextRef, boost::system::error_code const& error, int signalNumber);
 void KeepDatabaseAliveHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> dbPingTimerRef, int32 dbPingInterval, boost::system::error_code const& error);
 void BanExpiryHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> banExpiryCheckTimerRef, int32 banExpiryCheckInterval, boost::system::error_code const& error);
+void MetricUpdateHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> metricUpdateTimerRef, boost::system::error_code const& error);
 variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile, fs::path& configDir, std::string& winServiceAction);
 
 int main(int argc, char** argv)
@@ -213,6 +216,8 @@ int main(int argc, char** argv)
         return 1;
     }
 
+    sAccountInfoCache.LoadConfig();
+
     if (!sLoginService.StartNetwork(*ioContext, httpBindIp, httpPort))
     {
         TC_LOG_ERROR("server.bnetserver", "Failed to initialize login service");
@@ -221,6 +226,17 @@ int main(int argc, char** argv)
 
     auto sLoginServiceHandle = Trinity::make_unique_ptr_with_deleter<&Battlenet::LoginRESTService::StopNetwork>(&sLoginService);
 
+    sMetric->Initialize("bnetserver", *ioContext, []()
+    {
+        TC_METRIC_VALUE("login_verify_queue_depth", uint64(sLoginService.GetVerificationQueueDepth()));
+        TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
+    });
+
+    auto sMetricHandle = Trinity::make_unique_ptr_with_deleter(sMetric, [](Metric* metric)
+    {
+        metric->Unload();
+    });
+
     // Start the listening port (acceptor) for auth connections
     int32 bnport = sConfigMgr->GetIntDefault("BattlenetPort", 1119);
     if (bnport <= 0 || bnport > 0xFFFF)
@@ -274,6 +290,14 @@ int main(int argc, char** argv)
         BanExpiryHandler(std::move(timerRef), banExpiryCheckInterval, error);
     });
 
+    // runs the overall status logger of the metric system
+    std::shared_ptr<Trinity::Asio::DeadlineTimer> metricUpdateTimer = std::make_shared<Trinity::Asio::DeadlineTimer>(*ioContext);
+    metricUpdateTimer->expires_after(1s);
+    metricUpdateTimer->async_wait([timerRef = std::weak_ptr(metricUpdateTimer)](boost::system::error_code const& error) mutable
+    {
+        MetricUpdateHandler(std::move(timerRef), error);
+    });
+
 #if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
     std::shared_ptr<Trinity::Asio::DeadlineTimer> serviceStatusWatchTimer;
     if (m_ServiceStatus != -1)
@@ -290,6 +314,7 @@ int main(int argc, char** argv)
     // Start the io service worker loop
     ioContext->run();
 
+    metricUpdateTimer->cancel();
     banExpiryCheckTimer->cancel();
     dbPingTimer->cancel();
 
@@ -369,6 +394,23 @@ void BanExpiryHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> banExpiryCheck
     }
 }
 
+void MetricUpdateHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> metricUpdateTimerRef, boost::system::error_code const& error)
+{
+    if (!error)
+    {
+        if (std::shared_ptr<Trinity::Asio::DeadlineTimer> metricUpdateTimer = metricUpdateTimerRef.lock())
+        {
+            sMetric->Update();
+
+            metricUpdateTimer->expires_after(1s);
+            metricUpdateTimer->async_wait([timerRef = std::move(metricUpdateTimerRef)](boost::system::error_code const& error) mutable
+            {
+                MetricUpdateHandler(std::move(timerRef), error);
+            });
+        }
+    }
+}
+
 #if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
 void ServiceStatusWatcher(std::weak_ptr<Trinity::Asio::DeadlineTimer> serviceStatusWatchTimerRef, std::weak_ptr<Trinity::Asio::IoContext> ioContextRef, boost::system::error_code const& error)
 {
@@ -21,6 +21,7 @@
 #include "AsyncCallbackProcessor.h"
 #include "BaseHttpSocket.h"
 #include "DatabaseEnvFwd.h"
+#include "LoginVerificationPool.h"
 #include "SRP6.h"
 
 namespace Battlenet
@@ -46,12 +47,14 @@ public:
 
     void SendResponse(Trinity::Net::Http::RequestContext& context) override { return _socket->SendResponse(context); }
     void QueueQuery(QueryCallback&& queryCallback);
+    void QueueVerification(LoginVerificationCallback&& verificationCallback);
     std::string GetClientInfo() const override { return _socket->GetClientInfo(); }
     LoginSessionState* GetSessionState() const override { return static_cast<LoginSessionState*>(_socket->GetSessionState()); }
 
 private:
     std::shared_ptr<Trinity::Net::Http::AbstractSocket> _socket;
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<LoginVerificationCallback> _verificationProcessor;
 };
 }
 
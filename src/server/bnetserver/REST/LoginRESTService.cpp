@@ -16,6 +16,7 @@
  */
 
 #include "LoginRESTService.h"
+#include "AccountInfoCache.h"
 #include "Base64.h"
 #include "Common.h"
 #include "Configuration/Config.h"
@@ -30,6 +31,16 @@
 #include "Timer.h"
 #include "Util.h"
 
+namespace
+{
+struct PasswordVerification
+{
+    std::unique_ptr<Trinity::Crypto::SRP::BnetSRP6Base> Srp;
+    bool PasswordCorrect = false;
+    Optional<std::string> ServerM2;
+};
+}
+
 namespace Battlenet
 {
 LoginRESTService& LoginRESTService::Instance()
@@ -65,7 +76,7 @@ bool LoginRESTService::StartNetwork(Trinity::Asio::IoContext& ioContext, std::st
         return HandlePostLogin(std::move(session), context);
     }, RequestHandlerFlag::DoNotLogRequestContent);
 
-    RegisterHandler(boost::beast::http::verb::post, "/bnetserver/login/srp/"sv, [](std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context)
+    RegisterHandler(boost::beast::http::verb::post, "/bnetserver/login/srp/"sv, [this](std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context)
     {
         return HandlePostLoginSrpChallenge(std::move(session), context);
     });
@@ -106,45 +117,77 @@ bool LoginRESTService::StartNetwork(Trinity::Asio::IoContext& ioContext, std::st
     }
 
     // set up form inputs
+    JSON::Login::FormInputs formInputs;
     JSON::Login::FormInput* input;
-    _formInputs.set_type(JSON::Login::LOGIN_FORM);
-    input = _formInputs.add_inputs();
+    formInputs.set_type(JSON::Login::LOGIN_FORM);
+    input = formInputs.add_inputs();
     input->set_input_id("account_name");
     input->set_type("text");
     input->set_label("E-mail");
     input->set_max_length(320);
 
-    input = _formInputs.add_inputs();
+    input = formInputs.add_inputs();
     input->set_input_id("password");
     input->set_type("password");
     input->set_label("Password");
     input->set_max_length(128);
 
-    input = _formInputs.add_inputs();
+    input = formInputs.add_inputs();
     input->set_input_id("log_in_submit");
     input->set_type("submit");
     input->set_label("Log In");
 
+    int32 battlenetPort = sConfigMgr->GetIntDefault("BattlenetPort", 1119);
+    auto renderResponses = [&](HostnameResponses& responses, std::string const& hostname)
+    {
+        formInputs.set_srp_url(Trinity::StringFormat("http{}://{}:{}/bnetserver/login/srp/", !SslContext::UsesDevWildcardCertificate() ? "s" : "",
+            hostname, _port));
+        responses.Form = ::JSON::Serialize(formInputs);
+        responses.Portal = Trinity::StringFormat("{}:{}", hostname, battlenetPort);
+    };
+
+    renderResponses(_externalResponses, _externalHostname);
+    renderResponses(_localResponses, _localHostname);
+
     _loginTicketDuration = sConfigMgr->GetIntDefault("LoginREST.TicketDuration"sv, 3600);
 
+    int32 verifyThreads = sConfigMgr->GetIntDefault("LoginREST.VerifyThreads"sv, 2);
+    int32 verifyQueueSize = sConfigMgr->GetIntDefault("LoginREST.VerifyQueueSize"sv, 500);
+    _verificationPool = std::make_unique<LoginVerificationPool>(std::size_t(std::max(verifyThreads, 0)), std::size_t(std::max(verifyQueueSize, 1)));
+
     MigrateLegacyPasswordHashes();
 
-    _acceptor->AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
+    AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
     {
         OnSocketOpen(std::move(sock), threadIndex);
     });
     return true;
 }
 
-std::string const& LoginRESTService::GetHostnameForClient(boost::asio::ip::address const& address) const
+void LoginRESTService::StopNetwork()
+{
+    HttpService::StopNetwork();
+
+    if (_verificationPool)
+        _verificationPool->Join();
+}
+
+bool LoginRESTService::IsLocalClient(boost::asio::ip::address const& address) const
 {
     if (Optional<std::size_t> addressIndex = Trinity::Net::SelectAddressForClient(address, _addresses))
-        return *addressIndex >= _firstLocalAddressIndex ? _localHostname : _externalHostname;
+        return *addressIndex >= _firstLocalAddressIndex;
 
-    if (address.is_loopback())
-        return _localHostname;
+    return address.is_loopback();
+}
 
-    return _externalHostname;
+std::string const& LoginRESTService::GetHostnameForClient(boost::asio::ip::address const& address) const
+{
+    return IsLocalClient(address) ? _localHostname : _externalHostname;
+}
+
+LoginRESTService::HostnameResponses const& LoginRESTService::GetResponsesForClient(boost::asio::ip::address const& address) const
+{
+    return IsLocalClient(address) ? _localResponses : _externalResponses;
 }
 
 std::string LoginRESTService::ExtractAuthorization(HttpRequest const& request)
@@ -175,12 +218,8 @@ std::string LoginRESTService::ExtractAuthorization(HttpRequest const& request)
 
 LoginRESTService::RequestHandlerResult LoginRESTService::HandleGetForm(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const
 {
-    JSON::Login::FormInputs form = _formInputs;
-    form.set_srp_url(Trinity::StringFormat("http{}://{}:{}/bnetserver/login/srp/", !SslContext::UsesDevWildcardCertificate() ? "s" : "",
-        GetHostnameForClient(session->GetRemoteIpAddress()), _port));
-
     context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-    context.response.body() = ::JSON::Serialize(form);
+    context.response.body() = GetResponsesForClient(session->GetRemoteIpAddress()).Form;
     return RequestHandlerResult::Handled;
 }
 
@@ -236,7 +275,7 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandleGetGameAccounts(s
 LoginRESTService::RequestHandlerResult LoginRESTService::HandleGetPortal(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const
 {
     context.response.set(boost::beast::http::field::content_type, "text/plain");
-    context.response.body() = Trinity::StringFormat("{}:{}", GetHostnameForClient(session->GetRemoteIpAddress()), sConfigMgr->GetIntDefault("BattlenetPort", 1119));
+    context.response.body() = GetResponsesForClient(session->GetRemoteIpAddress()).Portal;
     return RequestHandlerResult::Handled;
 }
 
@@ -266,6 +305,13 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::sh
         return "";
     };
 
+    // reject before spending a database query on a login that could not be verified anyway
+    if (_verificationPool->IsSaturated())
+    {
+        SetTooManyRequestsResponse(context);
+        return RequestHandlerResult::Handled;
+    }
+
     std::string login(getInputValue(loginForm.get(), "account_name"));
     Utf8ToUpperOnlyLatin(login);
 
@@ -273,7 +319,7 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::sh
     stmt->setString(0, login);
 
     session->QueueQuery(LoginDatabase.AsyncQuery(stmt)
-        .WithChainingPreparedCallback([this, session, context = std::move(context), loginForm = std::move(loginForm), getInputValue](QueryCallback& callback, PreparedQueryResult result) mutable
+        .WithPreparedCallback([this, session, context = std::move(context), loginForm = std::move(loginForm), getInputValue](PreparedQueryResult result) mutable
     {
         if (!result)
         {
@@ -287,8 +333,10 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::sh
 
         std::string login(getInputValue(loginForm.get(), "account_name"));
         Utf8ToUpperOnlyLatin(login);
-        bool passwordCorrect = false;
-        Optional<std::string> serverM2;
+
+        // owns the srp implementation while a pool thread uses it, returned to the session state afterwards
+        std::shared_ptr<PasswordVerification> verification = std::make_shared<PasswordVerification>();
+        std::function<void()> verificationJob;
 
         Field* fields = result->Fetch();
         uint32 accountId = fields[0].GetUInt32();
@@ -298,23 +346,28 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::sh
             std::string srpUsername = ByteArrayToHexStr(Trinity::Crypto::SHA256::GetDigestOf(login));
             Trinity::Crypto::SRP::Salt s = fields[2].GetBinary<Trinity::Crypto::SRP::SALT_LENGTH>();
             Trinity::Crypto::SRP::Verifier v = fields[3].GetBinary();
-            session->GetSessionState()->Srp = CreateSrpImplementation(version, SrpHashFunction::Sha256, srpUsername, s, v);
 
             std::string password(getInputValue(loginForm.get(), "password"));
             if (version == SrpVersion::v1)
                 Utf8ToUpperOnlyLatin(password);
 
-            passwordCorrect = session->GetSessionState()->Srp->CheckCredentials(srpUsername, password);
+            verificationJob = [verification, version, srpUsername = std::move(srpUsername), s, v = std::move(v), password = std::move(password)]
+            {
+                verification->Srp = CreateSrpImplementation(version, SrpHashFunction::Sha256, srpUsername, s, v);
+                verification->PasswordCorrect = verification->Srp && verification->Srp->CheckCredentials(srpUsername, password);
+            };
         }
         else
         {
-            BigNumber A(getInputValue(loginForm.get(), "public_A"));
-            BigNumber M1(getInputValue(loginForm.get(), "client_evidence_M1"));
-            if (Optional<BigNumber> sessionKey = session->GetSessionState()->Srp->VerifyClientEvidence(A, M1))
+            verification->Srp = std::move(session->GetSessionState()->Srp);
+            verificationJob = [verification, A = BigNumber(getInputValue(loginForm.get(), "public_A")), M1 = BigNumber(getInputValue(loginForm.get(), "client_evidence_M1"))]
             {
-                passwordCorrect = true;
-                serverM2 = session->GetSessionState()->Srp->CalculateServerEvidence(A, M1, *sessionKey).AsHexStr();
-            }
+                if (Optional<BigNumber> sessionKey = verification->Srp->VerifyClientEvidence(A, M1))
+                {
+                    verification->PasswordCorrect = true;
+                    verification->ServerM2 = verification->Srp->CalculateServerEvidence(A, M1, *sessionKey).AsHexStr();
+                }
+            };
         }
 
         uint32 failedLogins = fields[4].GetUInt32();
@@ -322,89 +375,112 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::sh
         uint32 loginTicketExpiry = fields[6].GetUInt32();
         bool isBanned = fields[7].GetUInt64() != 0;
 
-        if (!passwordCorrect)
+        Optional<LoginVerificationCallback> verificationCallback = _verificationPool->Enqueue(std::move(verificationJob));
+        if (!verificationCallback)
         {
-            if (!isBanned)
-            {
-                std::string ip_address = session->GetRemoteIpAddress().to_string();
-                uint32 maxWrongPassword = uint32(sConfigMgr->GetIntDefault("WrongPass.MaxCount", 0));
+            session->GetSessionState()->Srp = std::move(verification->Srp);
+            SetTooManyRequestsResponse(context);
+            session->SendResponse(context);
+            return;
+        }
 
-                if (sConfigMgr->GetBoolDefault("WrongPass.Logging", false))
-                    TC_LOG_DEBUG("server.http.login", "[{}, Account {}, Id {}] Attempted to connect with wrong password!", ip_address, login, accountId);
+        verificationCallback->AfterComplete([this, session, context = std::move(context), verification, login = std::move(login), accountId, failedLogins,
+            loginTicket = std::move(loginTicket), loginTicketExpiry, isBanned]() mutable
+        {
+            // a newer srp challenge of the same session replaces the one that was verified
+            if (!session->GetSessionState()->Srp)
+                session->GetSessionState()->Srp = std::move(verification->Srp);
 
-                if (maxWrongPassword)
+            if (!verification->PasswordCorrect)
+            {
+                if (!isBanned)
                 {
-                    LoginDatabaseTransaction trans = LoginDatabase.BeginTransaction();
-                    LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_FAILED_LOGINS);
-                    stmt->setUInt32(0, accountId);
-                    trans->Append(stmt);
-
-                    ++failedLogins;
+                    std::string ip_address = session->GetRemoteIpAddress().to_string();
+                    uint32 maxWrongPassword = uint32(sConfigMgr->GetIntDefault("WrongPass.MaxCount", 0));
 
-                    TC_LOG_DEBUG("server.http.login", "MaxWrongPass : {}, failed_login : {}", maxWrongPassword, accountId);
+                    if (sConfigMgr->GetBoolDefault("WrongPass.Logging", false))
+                        TC_LOG_DEBUG("server.http.login", "[{}, Account {}, Id {}] Attempted to connect with wrong password!", ip_address, login, accountId);
 
-                    if (failedLogins >= maxWrongPassword)
+                    if (maxWrongPassword)
                     {
-                        BanMode banType = BanMode(sConfigMgr->GetIntDefault("WrongPass.BanType", uint16(BanMode::BAN_IP)));
-                        int32 banTime = sConfigMgr->GetIntDefault("WrongPass.BanTime", 600);
+                        LoginDatabaseTransaction trans = LoginDatabase.BeginTransaction();
+                        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_FAILED_LOGINS);
+                        stmt->setUInt32(0, accountId);
+                        trans->Append(stmt);
+
+                        ++failedLogins;
+
+                        TC_LOG_DEBUG("server.http.login", "MaxWrongPass : {}, failed_login : {}", maxWrongPassword, accountId);
 
-                        if (banType == BanMode::BAN_ACCOUNT)
+                        if (failedLogins >= maxWrongPassword)
                         {
-                            stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_ACCOUNT_AUTO_BANNED);
+                            BanMode banType = BanMode(sConfigMgr->GetIntDefault("WrongPass.BanType", uint16(BanMode::BAN_IP)));
+                            int32 banTime = sConfigMgr->GetIntDefault("WrongPass.BanTime", 600);
+
+                            if (banType == BanMode::BAN_ACCOUNT)
+                            {
+                                stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_ACCOUNT_AUTO_BANNED);
+                                stmt->setUInt32(0, accountId);
+                            }
+                            else
+                            {
+                                stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_IP_AUTO_BANNED);
+                                stmt->setString(0, ip_address);
+                            }
+
+                            stmt->setUInt32(1, banTime);
+                            trans->Append(stmt);
+
+                            stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_RESET_FAILED_LOGINS);
                             stmt->setUInt32(0, accountId);
-                        }
-                        else
-                        {
-                            stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_IP_AUTO_BANNED);
-                            stmt->setString(0, ip_address);
+                            trans->Append(stmt);
                         }
 
-                        stmt->setUInt32(1, banTime);
-                        trans->Append(stmt);
-
-                        stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_RESET_FAILED_LOGINS);
-                        stmt->setUInt32(0, accountId);
-                        trans->Append(stmt);
+                        LoginDatabase.CommitTransaction(trans);
                     }
-
-                    LoginDatabase.CommitTransaction(trans);
                 }
-            }
 
-            JSON::Login::LoginResult loginResult;
-            loginResult.set_authentication_state(JSON::Login::DONE);
-
-            context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-            context.response.body() = ::JSON::Serialize(loginResult);
-            session->SendResponse(context);
-            return;
-        }
+                JSON::Login::LoginResult loginResult;
+                loginResult.set_authentication_state(JSON::Login::DONE);
 
-        if (loginTicket.empty() || loginTicketExpiry < time(nullptr))
-            loginTicket = "TC-" + ByteArrayToHexStr(Trinity::Crypto::GetRandomBytes<20>());
+                context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+                context.response.body() = ::JSON::Serialize(loginResult);
+                session->SendResponse(context);
+                return;
+            }
 
-        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_AUTHENTICATION);
-        stmt->setString(0, loginTicket);
-        stmt->setUInt32(1, time(nullptr) + _loginTicketDuration);
-        stmt->setUInt32(2, accountId);
-        callback.WithPreparedCallback([session, context = std::move(context), loginTicket = std::move(loginTicket), serverM2 = std::move(serverM2)](PreparedQueryResult) mutable
-        {
-            JSON::Login::LoginResult loginResult;
-            loginResult.set_authentication_state(JSON::Login::DONE);
-            loginResult.set_login_ticket(loginTicket);
-            if (serverM2)
-                loginResult.set_server_evidence_m2(*serverM2);
+            if (loginTicket.empty() || loginTicketExpiry < time(nullptr))
+                loginTicket = "TC-" + ByteArrayToHexStr(Trinity::Crypto::GetRandomBytes<20>());
 
-            context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-            context.response.body() = ::JSON::Serialize(loginResult);
-            session->SendResponse(context);
-        }).SetNextQuery(LoginDatabase.AsyncQuery(stmt));
+            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_AUTHENTICATION);
+            stmt->setString(0, loginTicket);
+            stmt->setUInt32(1, time(nullptr) + _loginTicketDuration);
+            stmt->setUInt32(2, accountId);
+            session->QueueQuery(LoginDatabase.AsyncQuery(stmt)
+                .WithPreparedCallback([session, context = std::move(context), loginTicket = std::move(loginTicket), serverM2 = std::move(verification->ServerM2)](PreparedQueryResult) mutable
+            {
+                // reused tickets got a new expiry time
+                sAccountInfoCache.Invalidate(loginTicket);
+
+                JSON::Login::LoginResult loginResult;
+                loginResult.set_authentication_state(JSON::Login::DONE);
+                loginResult.set_login_ticket(loginTicket);
+                if (serverM2)
+                    loginResult.set_server_evidence_m2(*serverM2);
+
+                context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+                context.response.body() = ::JSON::Serialize(loginResult);
+                session->SendResponse(context);
+            }));
+        });
+
+        session->QueueVerification(std::move(*verificationCallback));
     }));
 
     return RequestHandlerResult::Async;
 }
 
-LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChallenge(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context)
+LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChallenge(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const
 {
     JSON::Login::LoginForm loginForm;
     if (!::JSON::Deserialize(context.request.body(), &loginForm))
@@ -422,6 +498,12 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChall
         return RequestHandlerResult::Handled;
     }
 
+    if (_verificationPool->IsSaturated())
+    {
+        SetTooManyRequestsResponse(context);
+        return RequestHandlerResult::Handled;
+    }
+
     std::string login;
 
     for (int32 i = 0; i < loginForm.inputs_size(); ++i)
@@ -434,7 +516,7 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChall
     stmt->setString(0, login);
 
     session->QueueQuery(LoginDatabase.AsyncQuery(stmt)
-        .WithPreparedCallback([session, context = std::move(context), login = std::move(login)](PreparedQueryResult result) mutable
+        .WithPreparedCallback([this, session, context = std::move(context), login = std::move(login)](PreparedQueryResult result) mutable
     {
         if (!result)
         {
@@ -453,39 +535,58 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChall
         Trinity::Crypto::SRP::Salt s = fields[1].GetBinary<Trinity::Crypto::SRP::SALT_LENGTH>();
         Trinity::Crypto::SRP::Verifier v = fields[2].GetBinary();
 
-        session->GetSessionState()->Srp = CreateSrpImplementation(version, hashFunction, srpUsername, s, v);
-        if (!session->GetSessionState()->Srp)
+        // generating B is a modexp, done by the verification pool like the login itself
+        std::shared_ptr<PasswordVerification> verification = std::make_shared<PasswordVerification>();
+        Optional<LoginVerificationCallback> verificationCallback = _verificationPool->Enqueue([verification, version, hashFunction, srpUsername, s, v = std::move(v)]
         {
-            context.response.result(boost::beast::http::status::internal_server_error);
+            verification->Srp = CreateSrpImplementation(version, hashFunction, srpUsername, s, v);
+        });
+
+        if (!verificationCallback)
+        {
+            SetTooManyRequestsResponse(context);
             session->SendResponse(context);
             return;
         }
 
-        JSON::Login::SrpLoginChallenge challenge;
-        challenge.set_version(session->GetSessionState()->Srp->GetVersion());
-        challenge.set_iterations(session->GetSessionState()->Srp->GetXIterations());
-        challenge.set_modulus(session->GetSessionState()->Srp->GetN().AsHexStr());
-        challenge.set_generator(session->GetSessionState()->Srp->Getg().AsHexStr());
-        challenge.set_hash_function([=]
+        verificationCallback->AfterComplete([session, context = std::move(context), verification, hashFunction, srpUsername = std::move(srpUsername)]() mutable
         {
-            switch (hashFunction)
+            session->GetSessionState()->Srp = std::move(verification->Srp);
+            if (!session->GetSessionState()->Srp)
             {
-                case SrpHashFunction::Sha256:
-                    return "SHA-256";
-                case SrpHashFunction::Sha512:
-                    return "SHA-512";
-                default:
-                    break;
+                context.response.result(boost::beast::http::status::internal_server_error);
+                session->SendResponse(context);
+                return;
             }
-            return "";
-        }());
-        challenge.set_username(srpUsername);
-        challenge.set_salt(ByteArrayToHexStr(session->GetSessionState()->Srp->s));
-        challenge.set_public_b(session->GetSessionState()->Srp->B.AsHexStr());
 
-        context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-        context.response.body() = ::JSON::Serialize(challenge);
-        session->SendResponse(context);
+            JSON::Login::SrpLoginChallenge challenge;
+            challenge.set_version(session->GetSessionState()->Srp->GetVersion());
+            challenge.set_iterations(session->GetSessionState()->Srp->GetXIterations());
+            challenge.set_modulus(session->GetSessionState()->Srp->GetN().AsHexStr());
+            challenge.set_generator(session->GetSessionState()->Srp->Getg().AsHexStr());
+            challenge.set_hash_function([=]
+            {
+                switch (hashFunction)
+                {
+                    case SrpHashFunction::Sha256:
+                        return "SHA-256";
+                    case SrpHashFunction::Sha512:
+                        return "SHA-512";
+                    default:
+                        break;
+                }
+                return "";
+            }());
+            challenge.set_username(srpUsername);
+            challenge.set_salt(ByteArrayToHexStr(session->GetSessionState()->Srp->s));
+            challenge.set_public_b(session->GetSessionState()->Srp->B.AsHexStr());
+
+            context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+            context.response.body() = ::JSON::Serialize(challenge);
+            session->SendResponse(context);
+        });
+
+        session->QueueVerification(std::move(*verificationCallback));
     }));
 
     return RequestHandlerResult::Async;
@@ -515,6 +616,8 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostRefreshLoginT
                 stmt->setUInt32(0, uint32(now + _loginTicketDuration));
                 stmt->setString(1, ticket);
                 LoginDatabase.Execute(stmt);
+
+                sAccountInfoCache.Invalidate(ticket);
             }
             else
                 loginRefreshResult.set_is_expired(true);
@@ -530,6 +633,19 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostRefreshLoginT
     return RequestHandlerResult::Async;
 }
 
+void LoginRESTService::SetTooManyRequestsResponse(HttpRequestContext& context) const
+{
+    JSON::Login::LoginResult loginResult;
+    loginResult.set_authentication_state(JSON::Login::LOGIN);
+    loginResult.set_error_code("TOO_MANY_REQUESTS");
+    loginResult.set_error_message("Too many login attempts at this time. Please try again later.");
+
+    context.response.result(boost::beast::http::status::too_many_requests);
+    context.response.set(boost::beast::http::field::retry_after, std::to_string(_verificationPool->GetRetryAfter().count()));
+    context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+    context.response.body() = ::JSON::Serialize(loginResult);
+}
+
 std::unique_ptr<Trinity::Crypto::SRP::BnetSRP6Base> LoginRESTService::CreateSrpImplementation(SrpVersion version, SrpHashFunction hashFunction,
     std::string const& username, Trinity::Crypto::SRP::Salt const& salt, Trinity::Crypto::SRP::Verifier const& verifier)
 {
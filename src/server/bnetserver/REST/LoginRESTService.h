@@ -56,9 +56,11 @@ public:
     static LoginRESTService& Instance();
 
     bool StartNetwork(Trinity::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port, int32 threadCount = 1) override;
+    void StopNetwork() override;
 
     std::string const& GetHostnameForClient(boost::asio::ip::address const& address) const;
     uint16 GetPort() const { return _port; }
+    std::size_t GetVerificationQueueDepth() const { return _verificationPool ? _verificationPool->GetQueuedJobCount() : 0; }
 
     std::shared_ptr<Trinity::Net::Http::SessionState> CreateNewSessionState(boost::asio::ip::address const& address) override;
 
@@ -70,15 +72,29 @@ private:
     RequestHandlerResult HandleGetPortal(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const;
 
     RequestHandlerResult HandlePostLogin(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const;
-    static RequestHandlerResult HandlePostLoginSrpChallenge(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context);
+    RequestHandlerResult HandlePostLoginSrpChallenge(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const;
     RequestHandlerResult HandlePostRefreshLoginTicket(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const;
 
     static std::unique_ptr<Trinity::Crypto::SRP::BnetSRP6Base> CreateSrpImplementation(SrpVersion version, SrpHashFunction hashFunction,
         std::string const& username, Trinity::Crypto::SRP::Salt const& salt, Trinity::Crypto::SRP::Verifier const& verifier);
 
+    void SetTooManyRequestsResponse(HttpRequestContext& context) const;
+
     void MigrateLegacyPasswordHashes() const;
 
-    JSON::Login::FormInputs _formInputs;
+    bool IsLocalClient(boost::asio::ip::address const& address) const;
+
+    // Bodies of responses that only depend on which hostname is advertised to the client, rendered once at startup
+    struct HostnameResponses
+    {
+        std::string Form;
+        std::string Portal;
+    };
+
+    HostnameResponses const& GetResponsesForClient(boost::asio::ip::address const& address) const;
+
+    HostnameResponses _externalResponses;
+    HostnameResponses _localResponses;
     std::string _bindIP;
     uint16 _port;
     std::string _externalHostname;
@@ -86,6 +102,7 @@ private:
     std::vector<boost::asio::ip::address> _addresses;
     std::size_t _firstLocalAddressIndex; // index inside _addresses where the first local address can be found
     uint32 _loginTicketDuration;
+    std::unique_ptr<LoginVerificationPool> _verificationPool;
 };
 }
 
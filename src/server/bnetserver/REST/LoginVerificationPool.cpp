@@ -0,0 +1,108 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginVerificationPool.h"
+#include "Metric.h"
+#include <algorithm>
+
+namespace Battlenet
+{
+bool LoginVerificationCallback::InvokeIfReady()
+{
+    if (_future.wait_for(0s) != std::future_status::ready)
+        return false;
+
+    _future.get();
+    if (_callback)
+        _callback();
+
+    return true;
+}
+
+LoginVerificationPool::LoginVerificationPool(std::size_t threadCount, std::size_t maxQueuedJobs)
+    : _threadCount(threadCount), _maxQueuedJobs(std::max<std::size_t>(maxQueuedJobs, 1)), _queuedJobs(0), _averageJobTime(0)
+{
+    if (_threadCount)
+        _pool.emplace(_threadCount);
+}
+
+LoginVerificationPool::~LoginVerificationPool()
+{
+    Join();
+}
+
+Optional<LoginVerificationCallback> LoginVerificationPool::Enqueue(std::function<void()>&& job)
+{
+    std::size_t queuedJobs = _queuedJobs.load(std::memory_order_relaxed);
+    do
+    {
+        if (queuedJobs >= _maxQueuedJobs)
+        {
+            TC_METRIC_VALUE("login_verify_rejected", 1);
+            return {};
+        }
+    } while (!_queuedJobs.compare_exchange_weak(queuedJobs, queuedJobs + 1, std::memory_order_relaxed));
+
+    std::promise<void> promise;
+    LoginVerificationCallback callback(promise.get_future());
+    TimePoint queueTime = std::chrono::steady_clock::now();
+
+    if (!_pool)
+    {
+        RunJob(job, queueTime);
+        promise.set_value();
+        return callback;
+    }
+
+    _pool->PostWork([this, job = std::move(job), promise = std::move(promise), queueTime]() mutable
+    {
+        RunJob(job, queueTime);
+        promise.set_value();
+    });
+
+    return callback;
+}
+
+void LoginVerificationPool::Join()
+{
+    if (_pool)
+        _pool->Join();
+}
+
+Seconds LoginVerificationPool::GetRetryAfter() const
+{
+    Microseconds backlog = Microseconds(_averageJobTime.load(std::memory_order_relaxed) * int64(GetQueuedJobCount()) / int64(std::max<std::size_t>(_threadCount, 1)));
+    return std::clamp(std::chrono::ceil<Seconds>(backlog), Seconds(1), Seconds(60));
+}
+
+void LoginVerificationPool::RunJob(std::function<void()> const& job, TimePoint queueTime)
+{
+    TimePoint start = std::chrono::steady_clock::now();
+    job();
+    TimePoint end = std::chrono::steady_clock::now();
+
+    int64 jobTime = std::chrono::duration_cast<Microseconds>(end - start).count();
+    TC_METRIC_VALUE("login_verify_wait_time", uint64(std::chrono::duration_cast<Microseconds>(start - queueTime).count()));
+    TC_METRIC_VALUE("login_verify_time", uint64(jobTime));
+
+    // moving average over roughly the last 8 jobs, races between pool threads only lose a sample
+    int64 averageJobTime = _averageJobTime.load(std::memory_order_relaxed);
+    _averageJobTime.store(averageJobTime + (jobTime - averageJobTime) / 8, std::memory_order_relaxed);
+
+    _queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+}
+}
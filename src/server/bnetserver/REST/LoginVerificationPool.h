@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LOGIN_VERIFICATION_POOL_H
+#define TRINITYCORE_LOGIN_VERIFICATION_POOL_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "Optional.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <functional>
+#include <future>
+
+namespace Battlenet
+{
+class LoginVerificationCallback
+{
+public:
+    explicit LoginVerificationCallback(std::future<void>&& future) : _future(std::move(future)) { }
+    LoginVerificationCallback(LoginVerificationCallback&&) = default;
+
+    LoginVerificationCallback& operator=(LoginVerificationCallback&&) = default;
+
+    // invoked by the network thread of the session that queued the callback
+    void AfterComplete(std::function<void()> callback) &
+    {
+        _callback = std::move(callback);
+    }
+
+    bool InvokeIfReady();
+
+private:
+    std::future<void> _future;
+    std::function<void()> _callback;
+};
+
+inline bool InvokeAsyncCallbackIfReady(LoginVerificationCallback& callback) { return callback.InvokeIfReady(); }
+
+/**
+ * Runs the expensive parts of a login (SRP6 modexp, password hashing) away from the http network threads.
+ * The number of jobs waiting or running is bounded, callers reply with 429 Too Many Requests instead of
+ * queueing more logins than can be verified in a reasonable time.
+ */
+class LoginVerificationPool
+{
+public:
+    // threadCount 0 runs jobs on the calling thread, the callback is still invoked by the next session update
+    LoginVerificationPool(std::size_t threadCount, std::size_t maxQueuedJobs);
+    ~LoginVerificationPool();
+
+    LoginVerificationPool(LoginVerificationPool const&) = delete;
+    LoginVerificationPool(LoginVerificationPool&&) = delete;
+    LoginVerificationPool& operator=(LoginVerificationPool const&) = delete;
+    LoginVerificationPool& operator=(LoginVerificationPool&&) = delete;
+
+    Optional<LoginVerificationCallback> Enqueue(std::function<void()>&& job);
+
+    // finishes all queued jobs
+    void Join();
+
+    bool IsSaturated() const { return GetQueuedJobCount() >= _maxQueuedJobs; }
+    std::size_t GetQueuedJobCount() const { return _queuedJobs.load(std::memory_order_relaxed); }
+
+    /// Estimated time until the currently queued jobs are done, sent to rejected clients as Retry-After
+    Seconds GetRetryAfter() const;
+
+private:
+    void RunJob(std::function<void()> const& job, TimePoint queueTime);
+
+    Optional<Trinity::ThreadPool> _pool;
+    std::size_t _threadCount;
+    std::size_t _maxQueuedJobs;
+    std::atomic<std::size_t> _queuedJobs;
+    std::atomic<int64> _averageJobTime; // microseconds
+};
+}
+
+#endif // TRINITYCORE_LOGIN_VERIFICATION_POOL_H
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AccountInfoCache.h"
+#include "Config.h"
+#include <algorithm>
+
+Battlenet::AccountInfoCache& Battlenet::AccountInfoCache::Instance()
+{
+    static AccountInfoCache instance;
+    return instance;
+}
+
+void Battlenet::AccountInfoCache::LoadConfig()
+{
+    std::scoped_lock lock(_lock);
+    _duration = Seconds(std::max(sConfigMgr->GetIntDefault("AccountInfoCache.Duration", 5), 0));
+    _maxEntries = std::size_t(std::max(sConfigMgr->GetIntDefault("AccountInfoCache.MaxEntries", 10000), 1));
+    if (!IsEnabled())
+        _entries.clear();
+}
+
+std::shared_ptr<Battlenet::Session::AccountInfo const> Battlenet::AccountInfoCache::Get(std::string const& loginTicket)
+{
+    std::scoped_lock lock(_lock);
+    auto itr = _entries.find(loginTicket);
+    if (itr == _entries.end())
+        return nullptr;
+
+    if (itr->second.ExpiryTime < std::chrono::steady_clock::now())
+    {
+        _entries.erase(itr);
+        return nullptr;
+    }
+
+    return itr->second.AccountInfo;
+}
+
+void Battlenet::AccountInfoCache::Add(std::string const& loginTicket, std::shared_ptr<Session::AccountInfo const> accountInfo)
+{
+    std::scoped_lock lock(_lock);
+    if (!IsEnabled())
+        return;
+
+    TimePoint now = std::chrono::steady_clock::now();
+    if (_entries.size() >= _maxEntries)
+    {
+        RemoveExpiredEntries(now);
+        if (_entries.size() >= _maxEntries)
+            return;
+    }
+
+    _entries[loginTicket] = { .AccountInfo = std::move(accountInfo), .ExpiryTime = now + _duration };
+}
+
+void Battlenet::AccountInfoCache::Invalidate(std::string const& loginTicket)
+{
+    std::scoped_lock lock(_lock);
+    _entries.erase(loginTicket);
+}
+
+void Battlenet::AccountInfoCache::RemoveExpiredEntries(TimePoint now)
+{
+    std::erase_if(_entries, [now](std::pair<std::string const, Entry> const& entry) { return entry.second.ExpiryTime < now; });
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_ACCOUNT_INFO_CACHE_H
+#define TRINITYCORE_ACCOUNT_INFO_CACHE_H
+
+#include "Session.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace Battlenet
+{
+/**
+ * Keeps recently loaded account state by login ticket for a few seconds.
+ * Clients reconnecting with cached web credentials (and launchers retrying) verify the same ticket many times
+ * in a short period, this skips the login database for all of them but the first.
+ * The login REST service drops entries whenever it changes the ticket or its expiry.
+ */
+class AccountInfoCache
+{
+public:
+    static AccountInfoCache& Instance();
+
+    void LoadConfig();
+
+    bool IsEnabled() const { return _duration > 0s; }
+
+    std::shared_ptr<Session::AccountInfo const> Get(std::string const& loginTicket);
+    void Add(std::string const& loginTicket, std::shared_ptr<Session::AccountInfo const> accountInfo);
+    void Invalidate(std::string const& loginTicket);
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<Session::AccountInfo const> AccountInfo;
+        TimePoint ExpiryTime;
+    };
+
+    void RemoveExpiredEntries(TimePoint now);
+
+    std::mutex _lock;
+    std::unordered_map<std::string, Entry> _entries;
+    Milliseconds _duration = 0s;
+    std::size_t _maxEntries = 0;
+};
+}
+
+#define sAccountInfoCache Battlenet::AccountInfoCache::Instance()
+
+#endif // TRINITYCORE_ACCOUNT_INFO_CACHE_H
@@ -16,6 +16,7 @@
  */
 
 #include "Session.h"
+#include "AccountInfoCache.h"
 #include "AccountService.h"
 #include "AuthenticationService.h"
 #include "BattlenetRpcErrorCodes.h"
@@ -30,6 +31,7 @@
 #include "MapUtils.h"
 #include "ProtobufJSON.h"
 #include "QueryCallback.h"
+#include "QueryHolder.h"
 #include "RealmList.h"
 #include "RealmList.pb.h"
 #include "ServiceDispatcher.h"
@@ -82,7 +84,7 @@ void Battlenet::Session::GameAccountInfo::LoadResult(Field const* fields)
 }
 
 Battlenet::Session::Session(Trinity::Net::IoContextTcpSocket&& socket) : BaseSocket(std::move(socket), SslContext::instance()),
-    _accountInfo(new AccountInfo()), _gameAccountInfo(nullptr), _locale(),
+    _header(std::make_unique<Header>()), _accountInfo(new AccountInfo()), _gameAccountInfo(nullptr), _locale(),
     _os(), _build(0), _clientInfo(), _timezoneOffset(0min), _ipCountry(), _clientSecret(), _authed(false), _requestToken(0)
 {
     _headerLengthBuffer.Resize(2);
@@ -111,6 +113,7 @@ bool Battlenet::Session::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _queryHolderProcessor.ProcessReadyCallbacks();
 
     return true;
 }
@@ -286,41 +289,71 @@ uint32 Battlenet::Session::HandleGenerateWebCredentials(authentication::v1::Gene
     return ERROR_OK;
 }
 
+namespace
+{
+class AccountInfoQueryHolder : public LoginDatabaseQueryHolder
+{
+public:
+    enum
+    {
+        ACCOUNT_INFO,
+        CHARACTER_COUNTS,
+        LAST_PLAYED_CHARACTERS,
+
+        MAX
+    };
+
+    explicit AccountInfoQueryHolder(std::string const& loginTicket)
+    {
+        SetSize(MAX);
+
+        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_ACCOUNT_INFO);
+        stmt->setString(0, loginTicket);
+        SetPreparedQuery(ACCOUNT_INFO, stmt);
+
+        // only displayed in the realm list, may lag behind recent character changes
+        stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_CHARACTER_COUNTS_BY_LOGIN_TICKET);
+        stmt->setString(0, loginTicket);
+        SetPreparedQuery(CHARACTER_COUNTS, stmt);
+
+        stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_LAST_PLAYER_CHARACTERS_BY_LOGIN_TICKET);
+        stmt->setString(0, loginTicket);
+        SetPreparedQuery(LAST_PLAYED_CHARACTERS, stmt);
+    }
+};
+}
+
 uint32 Battlenet::Session::VerifyWebCredentials(std::string const& webCredentials, std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)>& continuation)
 {
     if (webCredentials.empty())
         return ERROR_DENIED;
 
-    LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_ACCOUNT_INFO);
-    stmt->setString(0, webCredentials);
-
     std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> asyncContinuation = std::move(continuation);
-    std::shared_ptr<AccountInfo> accountInfo = std::make_shared<AccountInfo>();
-    QueueQuery(LoginDatabase.AsyncQuery(stmt).WithChainingPreparedCallback([this, accountInfo, asyncContinuation](QueryCallback& callback, PreparedQueryResult result)
+    if (std::shared_ptr<AccountInfo const> accountInfo = sAccountInfoCache.Get(webCredentials))
     {
-        Battlenet::Services::Authentication asyncContinuationService(this);
-        NoData response;
+        OnAccountInfoLoaded(std::move(accountInfo), asyncContinuation);
+        return ERROR_OK;
+    }
+
+    // all account state is loaded in a single round trip to the database thread
+    std::shared_ptr<AccountInfoQueryHolder> holder = std::make_shared<AccountInfoQueryHolder>(webCredentials);
+    _queryHolderProcessor.AddCallback(LoginDatabase.DelayQueryHolder(holder)).AfterComplete([this, webCredentials, asyncContinuation](SQLQueryHolderBase const& baseHolder)
+    {
+        AccountInfoQueryHolder const& holder = static_cast<AccountInfoQueryHolder const&>(baseHolder);
+
+        PreparedQueryResult result = holder.GetPreparedResult(AccountInfoQueryHolder::ACCOUNT_INFO);
         if (!result)
         {
+            Battlenet::Services::Authentication asyncContinuationService(this);
+            NoData response;
             asyncContinuation(&asyncContinuationService, ERROR_DENIED, &response);
             return;
         }
 
+        std::shared_ptr<AccountInfo> accountInfo = std::make_shared<AccountInfo>();
         accountInfo->LoadResult(result);
 
-        if (accountInfo->LoginTicketExpiry < time(nullptr))
-        {
-            asyncContinuation(&asyncContinuationService, ERROR_TIMED_OUT, &response);
-            return;
-        }
-
-        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_CHARACTER_COUNTS_BY_BNET_ID);
-        stmt->setUInt32(0, accountInfo->Id);
-        callback.SetNextQuery(LoginDatabase.AsyncQuery(stmt));
-    })
-        .WithChainingPreparedCallback([accountInfo](QueryCallback& callback, PreparedQueryResult characterCountsResult)
-    {
-        if (characterCountsResult)
+        if (PreparedQueryResult characterCountsResult = holder.GetPreparedResult(AccountInfoQueryHolder::CHARACTER_COUNTS))
         {
             do
             {
@@ -331,13 +364,7 @@ uint32 Battlenet::Session::VerifyWebCredentials(std::string const& webCredential
             } while (characterCountsResult->NextRow());
         }
 
-        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_LAST_PLAYER_CHARACTERS);
-        stmt->setUInt32(0, accountInfo->Id);
-        callback.SetNextQuery(LoginDatabase.AsyncQuery(stmt));
-    })
-        .WithPreparedCallback([this, accountInfo, asyncContinuation](PreparedQueryResult lastPlayerCharactersResult)
-    {
-        if (lastPlayerCharactersResult)
+        if (PreparedQueryResult lastPlayerCharactersResult = holder.GetPreparedResult(AccountInfoQueryHolder::LAST_PLAYED_CHARACTERS))
         {
             do
             {
@@ -354,86 +381,99 @@ uint32 Battlenet::Session::VerifyWebCredentials(std::string const& webCredential
             } while (lastPlayerCharactersResult->NextRow());
         }
 
-        _accountInfo = accountInfo;
-        Battlenet::Services::Authentication asyncContinuationService(this);
-        NoData response;
+        sAccountInfoCache.Add(webCredentials, accountInfo);
+        OnAccountInfoLoaded(std::move(accountInfo), asyncContinuation);
+    });
 
-        std::string ip_address = GetRemoteIpAddress().to_string();
+    return ERROR_OK;
+}
 
-        // If the IP is 'locked', check that the player comes indeed from the correct IP address
-        if (_accountInfo->IsLockedToIP)
-        {
-            TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is locked to IP - '{}' is logging in from '{}'",
-                _accountInfo->Login, _accountInfo->LastIP, ip_address);
+void Battlenet::Session::OnAccountInfoLoaded(std::shared_ptr<AccountInfo const> accountInfo, std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> const& asyncContinuation)
+{
+    Battlenet::Services::Authentication asyncContinuationService(this);
+    NoData response;
 
-            if (_accountInfo->LastIP != ip_address)
-            {
-                asyncContinuation(&asyncContinuationService, ERROR_RISK_ACCOUNT_LOCKED, &response);
-                return;
-            }
-        }
-        else
-        {
-            if (IpLocationRecord const* location = sIPLocation->GetLocationRecord(ip_address))
-                _ipCountry = location->CountryCode;
+    if (accountInfo->LoginTicketExpiry < time(nullptr))
+    {
+        asyncContinuation(&asyncContinuationService, ERROR_TIMED_OUT, &response);
+        return;
+    }
 
-            TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is not locked to ip", _accountInfo->Login);
-            if (_accountInfo->LockCountry.empty() || _accountInfo->LockCountry == "00")
-                TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is not locked to country", _accountInfo->Login);
-            else if (!_accountInfo->LockCountry.empty() && !_ipCountry.empty())
-            {
-                TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is locked to country: '{}' Player country is '{}'",
-                    _accountInfo->Login, _accountInfo->LockCountry, _ipCountry);
-
-                if (_ipCountry != _accountInfo->LockCountry)
-                {
-                    asyncContinuation(&asyncContinuationService, ERROR_RISK_ACCOUNT_LOCKED, &response);
-                    return;
-                }
-            }
+    _accountInfo = std::move(accountInfo);
+
+    std::string ip_address = GetRemoteIpAddress().to_string();
+
+    // If the IP is 'locked', check that the player comes indeed from the correct IP address
+    if (_accountInfo->IsLockedToIP)
+    {
+        TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is locked to IP - '{}' is logging in from '{}'",
+            _accountInfo->Login, _accountInfo->LastIP, ip_address);
+
+        if (_accountInfo->LastIP != ip_address)
+        {
+            asyncContinuation(&asyncContinuationService, ERROR_RISK_ACCOUNT_LOCKED, &response);
+            return;
         }
+    }
+    else
+    {
+        if (IpLocationRecord const* location = sIPLocation->GetLocationRecord(ip_address))
+            _ipCountry = location->CountryCode;
 
-        // If the account is banned, reject the logon attempt
-        if (_accountInfo->IsBanned)
+        TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is not locked to ip", _accountInfo->Login);
+        if (_accountInfo->LockCountry.empty() || _accountInfo->LockCountry == "00")
+            TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is not locked to country", _accountInfo->Login);
+        else if (!_accountInfo->LockCountry.empty() && !_ipCountry.empty())
         {
-            if (_accountInfo->IsPermanenetlyBanned)
-            {
-                TC_LOG_DEBUG("session", "{} [Session::HandleVerifyWebCredentials] Banned account {} tried to login!", GetClientInfo(), _accountInfo->Login);
-                asyncContinuation(&asyncContinuationService, ERROR_GAME_ACCOUNT_BANNED, &response);
-                return;
-            }
-            else
+            TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is locked to country: '{}' Player country is '{}'",
+                _accountInfo->Login, _accountInfo->LockCountry, _ipCountry);
+
+            if (_ipCountry != _accountInfo->LockCountry)
             {
-                TC_LOG_DEBUG("session", "{} [Session::HandleVerifyWebCredentials] Temporarily banned account {} tried to login!", GetClientInfo(), _accountInfo->Login);
-                asyncContinuation(&asyncContinuationService, ERROR_GAME_ACCOUNT_SUSPENDED, &response);
+                asyncContinuation(&asyncContinuationService, ERROR_RISK_ACCOUNT_LOCKED, &response);
                 return;
             }
         }
+    }
 
-        authentication::v1::LogonResult logonResult;
-        logonResult.set_error_code(0);
-        logonResult.mutable_account_id()->set_low(_accountInfo->Id);
-        logonResult.mutable_account_id()->set_high(UI64LIT(0x100000000000000));
-        for (auto const& [id, gameAccountInfo] : accountInfo->GameAccounts)
+    // If the account is banned, reject the logon attempt
+    if (_accountInfo->IsBanned)
+    {
+        if (_accountInfo->IsPermanenetlyBanned)
         {
-            EntityId* gameAccountId = logonResult.add_game_account_id();
-            gameAccountId->set_low(gameAccountInfo.Id);
-            gameAccountId->set_high(UI64LIT(0x200000200576F57));
+            TC_LOG_DEBUG("session", "{} [Session::HandleVerifyWebCredentials] Banned account {} tried to login!", GetClientInfo(), _accountInfo->Login);
+            asyncContinuation(&asyncContinuationService, ERROR_GAME_ACCOUNT_BANNED, &response);
+            return;
+        }
+        else
+        {
+            TC_LOG_DEBUG("session", "{} [Session::HandleVerifyWebCredentials] Temporarily banned account {} tried to login!", GetClientInfo(), _accountInfo->Login);
+            asyncContinuation(&asyncContinuationService, ERROR_GAME_ACCOUNT_SUSPENDED, &response);
+            return;
         }
+    }
 
-        if (!_ipCountry.empty())
-            logonResult.set_geoip_country(_ipCountry);
+    authentication::v1::LogonResult logonResult;
+    logonResult.set_error_code(0);
+    logonResult.mutable_account_id()->set_low(_accountInfo->Id);
+    logonResult.mutable_account_id()->set_high(UI64LIT(0x100000000000000));
+    for (auto const& [id, gameAccountInfo] : _accountInfo->GameAccounts)
+    {
+        EntityId* gameAccountId = logonResult.add_game_account_id();
+        gameAccountId->set_low(gameAccountInfo.Id);
+        gameAccountId->set_high(UI64LIT(0x200000200576F57));
+    }
 
-        std::array<uint8, 64> k = Trinity::Crypto::GetRandomBytes<64>();
-        logonResult.set_session_key(k.data(), 64);
+    if (!_ipCountry.empty())
+        logonResult.set_geoip_country(_ipCountry);
 
-        _authed = true;
+    std::array<uint8, 64> k = Trinity::Crypto::GetRandomBytes<64>();
+    logonResult.set_session_key(k.data(), 64);
 
-        asyncContinuation(&asyncContinuationService, ERROR_OK, &response);
-        Service<authentication::v1::AuthenticationListener>(this).OnLogonComplete(&logonResult);
-    }));
+    _authed = true;
 
-    return ERROR_OK;
+    asyncContinuation(&asyncContinuationService, ERROR_OK, &response);
+    Service<authentication::v1::AuthenticationListener>(this).OnLogonComplete(&logonResult);
 }
 
 uint32 Battlenet::Session::HandleGetAccountState(account::v1::GetAccountStateRequest const* request, account::v1::GetAccountStateResponse* response)
@@ -603,14 +643,14 @@ uint32 Battlenet::Session::GetLastCharPlayed(std::unordered_map<std::string, Var
         auto lastPlayerChar = _gameAccountInfo->LastPlayedCharacters.find(subRegion->string_value());
         if (lastPlayerChar != _gameAccountInfo->LastPlayedCharacters.end())
         {
-            std::vector<uint8> compressed = sRealmList->GetRealmEntryJSON(lastPlayerChar->second.RealmId, _build, _gameAccountInfo->SecurityLevel);
+            RealmList::CompressedJson compressed = sRealmList->GetRealmEntryJSON(lastPlayerChar->second.RealmId, _build, _gameAccountInfo->SecurityLevel);
 
-            if (compressed.empty())
+            if (!compressed)
                 return ERROR_UTIL_SERVER_FAILED_TO_SERIALIZE_RESPONSE;
 
             Attribute* attribute = response->add_attribute();
             attribute->set_name("Param_RealmEntry");
-            attribute->mutable_value()->set_blob_value(compressed.data(), compressed.size());
+            attribute->mutable_value()->set_blob_value(compressed->data(), compressed->size());
 
             attribute = response->add_attribute();
             attribute->set_name("Param_CharacterName");
@@ -640,14 +680,14 @@ uint32 Battlenet::Session::GetRealmList(std::unordered_map<std::string, Variant
     if (Variant const* subRegion = Trinity::Containers::MapGetValuePtr(params, "Command_RealmListRequest_v1"))
         subRegionId = subRegion->string_value();
 
-    std::vector<uint8> compressed = sRealmList->GetRealmList(_build, _gameAccountInfo->SecurityLevel, subRegionId);
+    RealmList::CompressedJson realmList = sRealmList->GetRealmList(_build, _gameAccountInfo->SecurityLevel, subRegionId);
 
-    if (compressed.empty())
+    if (!realmList)
         return ERROR_UTIL_SERVER_FAILED_TO_SERIALIZE_RESPONSE;
 
     Attribute* attribute = response->add_attribute();
     attribute->set_name("Param_RealmList");
-    attribute->mutable_value()->set_blob_value(compressed.data(), compressed.size());
+    attribute->mutable_value()->set_blob_value(realmList->data(), realmList->size());
 
     ::JSON::RealmList::RealmCharacterCountList realmCharacterCounts;
     for (auto const& characterCount : _gameAccountInfo->CharacterCounts)
@@ -659,6 +699,7 @@ uint32 Battlenet::Session::GetRealmList(std::unordered_map<std::string, Variant
 
     std::string json = "JSONRealmCharacterCountList:" + ::JSON::Serialize(realmCharacterCounts);
 
+    std::vector<uint8> compressed;
     uLongf compressedLength = compressBound(json.length());
     compressed.resize(4 + compressedLength);
     *reinterpret_cast<uint32*>(compressed.data()) = json.length() + 1;
@@ -759,31 +800,27 @@ bool Battlenet::Session::ReadHeaderLengthHandler()
 
 bool Battlenet::Session::ReadHeaderHandler()
 {
-    Header header;
-    if (!header.ParseFromArray(_headerBuffer.GetReadPointer(), _headerBuffer.GetActiveSize()))
+    if (!_header->ParseFromArray(_headerBuffer.GetReadPointer(), _headerBuffer.GetActiveSize()))
         return false;
 
-    _packetBuffer.Resize(header.size());
+    _packetBuffer.Resize(_header->size());
     return true;
 }
 
 bool Battlenet::Session::ReadDataHandler()
 {
-    Header header;
-    bool parseSuccess = header.ParseFromArray(_headerBuffer.GetReadPointer(), _headerBuffer.GetActiveSize());
-    ASSERT(parseSuccess);
-
-    if (header.service_id() != 0xFE)
+    // header was already parsed in ReadHeaderHandler
+    if (_header->service_id() != 0xFE)
     {
-        sServiceDispatcher.Dispatch(this, header.service_hash(), header.token(), header.method_id(), std::move(_packetBuffer));
+        sServiceDispatcher.Dispatch(this, _header->service_hash(), _header->token(), _header->method_id(), std::move(_packetBuffer));
     }
     else
     {
-        auto itr = _responseCallbacks.find(header.token());
+        auto itr = _responseCallbacks.find(_header->token());
         if (itr != _responseCallbacks.end())
         {
             itr->second(std::move(_packetBuffer));
-            _responseCallbacks.erase(header.token());
+            _responseCallbacks.erase(itr);
         }
         else
             _packetBuffer.Reset();
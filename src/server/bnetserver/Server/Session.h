@@ -35,6 +35,7 @@ class ServiceBase;
 
 namespace bgs::protocol
 {
+class Header;
 class Variant;
 
 namespace account::v1
@@ -153,6 +154,7 @@ namespace Battlenet
         void AsyncWrite(MessageBuffer* packet);
 
         uint32 VerifyWebCredentials(std::string const& webCredentials, std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)>& continuation);
+        void OnAccountInfoLoaded(std::shared_ptr<AccountInfo const> accountInfo, std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> const& asyncContinuation);
 
         typedef uint32(Session::*ClientRequestHandler)(std::unordered_map<std::string, Variant const*> const&, game_utilities::v1::ClientResponse*);
         static std::unordered_map<std::string, ClientRequestHandler> const ClientRequestHandlers;
@@ -165,9 +167,10 @@ namespace Battlenet
         MessageBuffer _headerLengthBuffer;
         MessageBuffer _headerBuffer;
         MessageBuffer _packetBuffer;
+        std::unique_ptr<Header> _header;                    // Parsed _headerBuffer, reused once packet data arrives
 
-        std::shared_ptr<AccountInfo> _accountInfo;
-        GameAccountInfo* _gameAccountInfo;          // Points at selected game account (inside _gameAccounts)
+        std::shared_ptr<AccountInfo const> _accountInfo;    // Possibly shared with other sessions through AccountInfoCache
+        GameAccountInfo const* _gameAccountInfo;            // Points at selected game account (inside _accountInfo)
 
         std::string _locale;
         std::string _os;
@@ -182,6 +185,7 @@ namespace Battlenet
         bool _authed;
 
         QueryCallbackProcessor _queryProcessor;
+        AsyncCallbackProcessor<SQLQueryHolderCallback> _queryHolderProcessor;
 
         std::unordered_map<uint32, std::function<void(MessageBuffer)>> _responseCallbacks;
         uint32 _requestToken;
@@ -23,7 +23,7 @@ bool Battlenet::SessionManager::StartNetwork(Trinity::Asio::IoContext& ioContext
     if (!BaseSocketMgr::StartNetwork(ioContext, bindIp, port, threadCount))
         return false;
 
-    _acceptor->AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
+    AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
     {
         OnSocketOpen(std::move(sock), threadIndex);
     });
@@ -21,6 +21,7 @@
 #include "Memory.h"
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <openssl/ssl.h>
 #include <openssl/store.h>
 #include <openssl/ui.h>
 
@@ -158,9 +159,46 @@ bool Battlenet::SslContext::Initialize()
 
 #undef LOAD_CHECK
 
+    ConfigureSessionResumption(nativeContext);
+
     return true;
 }
 
+void Battlenet::SslContext::ConfigureSessionResumption(SSL_CTX* nativeContext)
+{
+    // reconnecting clients (and the launcher and game client sharing the same host) skip the full handshake
+    static constexpr std::string_view SessionIdContext = "bnetserver";
+    SSL_CTX_set_session_id_context(nativeContext, reinterpret_cast<unsigned char const*>(SessionIdContext.data()), SessionIdContext.length());
+
+    int32 sessionTimeout = std::max(sConfigMgr->GetIntDefault("Ssl.SessionTimeout", 3600), 0);
+    SSL_CTX_set_timeout(nativeContext, sessionTimeout);
+
+    int32 sessionCacheSize = std::max(sConfigMgr->GetIntDefault("Ssl.SessionCacheSize", 20480), 0);
+    if (sessionCacheSize > 0 && sessionTimeout > 0)
+    {
+        SSL_CTX_set_session_cache_mode(nativeContext, SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(nativeContext, sessionCacheSize);
+    }
+    else
+        SSL_CTX_set_session_cache_mode(nativeContext, SSL_SESS_CACHE_OFF);
+
+    // ticket keys are generated at startup, tickets issued before a restart fall back to a full handshake
+    if (sConfigMgr->GetBoolDefault("Ssl.SessionTickets", true) && sessionTimeout > 0)
+    {
+        SSL_CTX_clear_options(nativeContext, SSL_OP_NO_TICKET);
+        SSL_CTX_set_num_tickets(nativeContext, 1);
+    }
+    else
+    {
+        SSL_CTX_set_options(nativeContext, SSL_OP_NO_TICKET);
+        SSL_CTX_set_num_tickets(nativeContext, 0);
+    }
+
+    TC_LOG_INFO("server.ssl", "TLS session resumption: cache size {}, tickets {}, timeout {}s",
+        (SSL_CTX_get_session_cache_mode(nativeContext) & SSL_SESS_CACHE_SERVER) ? SSL_CTX_sess_get_cache_size(nativeContext) : 0,
+        (SSL_CTX_get_options(nativeContext) & SSL_OP_NO_TICKET) ? "disabled" : "enabled", sessionTimeout);
+}
+
 boost::asio::ssl::context& Battlenet::SslContext::instance()
 {
     static boost::asio::ssl::context context(boost::asio::ssl::context::tls);
@@ -32,6 +32,8 @@ namespace Battlenet
         static bool UsesDevWildcardCertificate() { return _usesDevWildcardCertificate; }
 
     private:
+        static void ConfigureSessionResumption(SSL_CTX* nativeContext);
+
         static bool _usesDevWildcardCertificate;
     };
 }
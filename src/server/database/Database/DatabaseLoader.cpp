@@ -20,8 +20,11 @@
 #include "DatabaseEnv.h"
 #include "DBUpdater.h"
 #include "Log.h"
+#include "Util.h"
 
+#include <future>
 #include <mysqld_error.h>
+#include <vector>
 
 DatabaseLoader::DatabaseLoader(std::string const& logger, uint32 const defaultUpdateMask)
     : _logger(logger), _autoSetup(sConfigMgr->GetBoolDefault("Updates.AutoSetup", true)),
@@ -53,7 +56,39 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
 
         uint8 const synchThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.SynchThreads", 1));
 
+        uint8 const priorityThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.PriorityWorkerThreads", 0));
+        if (priorityThreads > 32)
+        {
+            TC_LOG_ERROR(_logger, "{} database: invalid number of priority worker threads specified. "
+                "Please pick a value between 0 and 32.", name);
+            return false;
+        }
+
+        std::vector<std::string> replicaStrings;
+        std::string const replicaList = sConfigMgr->GetStringDefault(name + "Database.ReplicaInfo", "");
+        for (std::string_view replicaString : Trinity::Tokenize(replicaList, ',', false))
+        {
+            std::size_t const begin = replicaString.find_first_not_of(' ');
+            if (begin == std::string_view::npos)
+                continue;
+
+            replicaString.remove_prefix(begin);
+            replicaString.remove_suffix(replicaString.size() - replicaString.find_last_not_of(' ') - 1);
+            replicaStrings.emplace_back(replicaString);
+        }
+
+        uint8 const replicaThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.ReplicaWorkerThreads", 1));
+        if (!replicaStrings.empty() && (replicaThreads < 1 || replicaThreads > 32))
+        {
+            TC_LOG_ERROR(_logger, "{} database: invalid number of replica worker threads specified. "
+                "Please pick a value between 1 and 32.", name);
+            return false;
+        }
+
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetBatchWindow(Milliseconds(sConfigMgr->GetIntDefault(name + "Database.BatchWindow", 0)));
+        pool.SetPriorityThreads(priorityThreads);
+        pool.SetReplicas(replicaStrings, replicaThreads, Seconds(sConfigMgr->GetIntDefault(name + "Database.ReplicaMaxLag", 30)));
         if (uint32 error = pool.Open())
         {
             // Database does not exist
@@ -145,11 +180,17 @@ bool DatabaseLoader::OpenDatabases()
 
 bool DatabaseLoader::PopulateDatabases()
 {
+    if (sConfigMgr->GetBoolDefault("Updates.Concurrent", false))
+        return ProcessConcurrently(_populate);
+
     return Process(_populate);
 }
 
 bool DatabaseLoader::UpdateDatabases()
 {
+    if (sConfigMgr->GetBoolDefault("Updates.Concurrent", false))
+        return ProcessConcurrently(_update);
+
     return Process(_update);
 }
 
@@ -164,13 +205,7 @@ bool DatabaseLoader::Process(std::queue<Predicate>& queue)
     {
         if (!queue.front()())
         {
-            // Close all open databases which have a registered close operation
-            while (!_close.empty())
-            {
-                _close.top()();
-                _close.pop();
-            }
-
+            CloseDatabases();
             return false;
         }
 
@@ -179,6 +214,37 @@ bool DatabaseLoader::Process(std::queue<Predicate>& queue)
     return true;
 }
 
+bool DatabaseLoader::ProcessConcurrently(std::queue<Predicate>& queue)
+{
+    std::vector<std::future<bool>> results;
+    results.reserve(queue.size());
+    while (!queue.empty())
+    {
+        results.push_back(std::async(std::launch::async, std::move(queue.front())));
+        queue.pop();
+    }
+
+    bool success = true;
+    for (std::future<bool>& result : results)
+        if (!result.get())
+            success = false;
+
+    if (!success)
+        CloseDatabases();
+
+    return success;
+}
+
+void DatabaseLoader::CloseDatabases()
+{
+    // Close all open databases which have a registered close operation
+    while (!_close.empty())
+    {
+        _close.top()();
+        _close.pop();
+    }
+}
+
 template TC_DATABASE_API
 DatabaseLoader& DatabaseLoader::AddDatabase<LoginDatabaseConnection>(DatabaseWorkerPool<LoginDatabaseConnection>&, std::string const&);
 template TC_DATABASE_API
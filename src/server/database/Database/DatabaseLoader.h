@@ -67,6 +67,12 @@ private:
     // Returns false when there was an error.
     bool Process(std::queue<Predicate>& queue);
 
+    // Same as Process but invokes all functions at once, each on its own thread,
+    // and waits for all of them to finish.
+    bool ProcessConcurrently(std::queue<Predicate>& queue);
+
+    void CloseDatabases();
+
     std::string const _logger;
     bool const _autoSetup;
     uint32 const _updateFlags;
@@ -18,16 +18,18 @@
 #include "DatabaseWorkerPool.h"
 #include "AdhocStatement.h"
 #include "Common.h"
+#include "DeadlineTimer.h"
 #include "Errors.h"
+#include "Field.h"
 #include "IoContext.h"
 #include "Implementation/LoginDatabase.h"
 #include "Implementation/WorldDatabase.h"
 #include "Implementation/CharacterDatabase.h"
 #include "Implementation/HotfixDatabase.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLPreparedStatement.h"
 #include "PreparedStatement.h"
-#include "ProducerConsumerQueue.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
@@ -50,24 +52,36 @@
 #define MIN_MARIADB_CLIENT_VERSION 30003u
 #define MIN_MARIADB_CLIENT_VERSION_STRING "3.0.3"
 
+// Batches are sent early once they reach this many statements, keeps a single transaction from growing unbounded
+#define MAX_BATCH_SIZE 1000u
+
 namespace
 {
 #ifdef TRINITY_DEBUG
 template<typename Database>
 thread_local bool WarnSyncQueries = false;
 #endif
+
+char const* GetQueueLaneName(DatabaseQueuePriority priority)
+{
+    return priority == DatabaseQueuePriority::High ? "high" : "normal";
+}
 }
 
 template<typename T>
 struct DatabaseWorkerPool<T>::QueueSizeTracker
 {
-    explicit QueueSizeTracker(DatabaseWorkerPool* pool) : _pool(pool)
+    explicit QueueSizeTracker(DatabaseWorkerPool* pool, DatabaseQueuePriority priority = DatabaseQueuePriority::Normal)
+        : QueueSizeTracker(pool, GetQueueLaneName(priority)) { }
+
+    QueueSizeTracker(DatabaseWorkerPool* pool, char const* lane)
+        : _pool(pool), _lane(lane), _queuedAt(std::chrono::steady_clock::now())
     {
         ++_pool->_queueSize;
     }
 
-    QueueSizeTracker(QueueSizeTracker const& other) : _pool(other._pool) { ++_pool->_queueSize; }
-    QueueSizeTracker(QueueSizeTracker&& other) noexcept : _pool(std::exchange(other._pool, nullptr)) { }
+    QueueSizeTracker(QueueSizeTracker const& other) : _pool(other._pool), _lane(other._lane), _queuedAt(other._queuedAt) { ++_pool->_queueSize; }
+    QueueSizeTracker(QueueSizeTracker&& other) noexcept : _pool(std::exchange(other._pool, nullptr)), _lane(other._lane), _queuedAt(other._queuedAt) { }
 
     QueueSizeTracker& operator=(QueueSizeTracker const& other)
     {
@@ -81,6 +95,8 @@ struct DatabaseWorkerPool<T>::QueueSizeTracker
                     ++other._pool->_queueSize;
             }
             _pool = other._pool;
+            _lane = other._lane;
+            _queuedAt = other._queuedAt;
         }
         return *this;
     }
@@ -94,6 +110,8 @@ struct DatabaseWorkerPool<T>::QueueSizeTracker
                     --_pool->_queueSize;
             }
             _pool = std::exchange(other._pool, nullptr);
+            _lane = other._lane;
+            _queuedAt = other._queuedAt;
         }
         return *this;
     }
@@ -104,13 +122,37 @@ struct DatabaseWorkerPool<T>::QueueSizeTracker
             --_pool->_queueSize;
     }
 
+    //! Called by the worker thread when it begins executing the task
+    void RecordQueueWait() const
+    {
+        TC_METRIC_VALUE("db_queue_wait", std::chrono::steady_clock::now() - _queuedAt,
+            TC_METRIC_TAG("db", _pool->GetDatabaseName()),
+            TC_METRIC_TAG("lane", _lane));
+    }
+
 private:
     DatabaseWorkerPool* _pool;
+    char const* _lane;
+    std::chrono::steady_clock::time_point _queuedAt;
+};
+
+template <class T>
+struct DatabaseWorkerPool<T>::Replica
+{
+    explicit Replica(std::string const& infoString) : ConnectionInfo(infoString), Healthy(false) { }
+
+    MySQLConnectionInfo ConnectionInfo;
+    //! Queue shared by the worker threads of this replica, not set when it could not be connected to
+    std::unique_ptr<Trinity::Asio::IoContext> IoContext;
+    //! Owned by _connections[IDX_ASYNC_REPLICA]
+    std::vector<T*> Connections;
+    //! Not healthy until the first replication status check succeeded
+    std::atomic<bool> Healthy;
 };
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool()
-    : _async_threads(0), _synch_threads(0)
+    : _async_threads(0), _synch_threads(0), _priority_threads(0), _nextReplica(0), _replica_threads(0), _replicaMaxLag(0), _batchWindow(0)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -138,16 +180,30 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string const& infoString,
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetReplicas(std::vector<std::string> const& infoStrings, uint8 threadsPerReplica, Seconds maxLag)
+{
+    _replicas.clear();
+    for (std::string const& infoString : infoStrings)
+        _replicas.push_back(std::make_unique<Replica>(infoString));
+
+    _replica_threads = threadsPerReplica;
+    _replicaMaxLag = maxLag;
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
     WPFatal(_connectionInfo.get(), "Connection info was not set!");
 
     TC_LOG_INFO("sql.driver", "Opening DatabasePool '{}'. "
-        "Asynchronous connections: {}, synchronous connections: {}.",
-        GetDatabaseName(), _async_threads, _synch_threads);
+        "Asynchronous connections: {}, synchronous connections: {}, priority connections: {}.",
+        GetDatabaseName(), _async_threads, _synch_threads, _priority_threads);
 
     _ioContext = std::make_unique<Trinity::Asio::IoContext>(_async_threads);
+    _batchTimer = std::make_unique<Trinity::Asio::DeadlineTimer>(_ioContext->get_executor());
+    if (_priority_threads)
+        _priorityIoContext = std::make_unique<Trinity::Asio::IoContext>(_priority_threads);
 
     uint32 error = OpenConnections(IDX_ASYNC, _async_threads);
 
@@ -156,15 +212,48 @@ uint32 DatabaseWorkerPool<T>::Open()
 
     error = OpenConnections(IDX_SYNCH, _synch_threads);
 
+    if (error)
+        return error;
+
+    error = OpenConnections(IDX_ASYNC_PRIORITY, _priority_threads);
+
     if (error)
         return error;
 
     for (std::unique_ptr<T> const& connection : _connections[IDX_ASYNC])
         connection->StartWorkerThread(_ioContext.get());
 
+    for (std::unique_ptr<T> const& connection : _connections[IDX_ASYNC_PRIORITY])
+        connection->StartWorkerThread(_priorityIoContext.get());
+
+    //! Replicas are optional, one that can not be reached is skipped and its reads are executed by the primary server
+    for (std::unique_ptr<Replica> const& replica : _replicas)
+    {
+        std::size_t const firstConnection = _connections[IDX_ASYNC_REPLICA].size();
+        if (OpenConnections(IDX_ASYNC_REPLICA, _replica_threads, &replica->ConnectionInfo))
+        {
+            TC_LOG_ERROR("sql.driver", "DatabasePool '{}': could not connect to read replica {}:{}, its reads are executed by the primary server.",
+                GetDatabaseName(), replica->ConnectionInfo.host, replica->ConnectionInfo.port_or_socket);
+            continue;
+        }
+
+        replica->IoContext = std::make_unique<Trinity::Asio::IoContext>(_replica_threads);
+        for (std::size_t i = firstConnection; i < _connections[IDX_ASYNC_REPLICA].size(); ++i)
+        {
+            T* connection = _connections[IDX_ASYNC_REPLICA][i].get();
+            connection->StartWorkerThread(replica->IoContext.get());
+            replica->Connections.push_back(connection);
+        }
+
+        boost::asio::post(replica->IoContext->get_executor(), [this, replica = replica.get()]
+        {
+            CheckReplica(*replica);
+        });
+    }
+
     TC_LOG_INFO("sql.driver", "DatabasePool '{}' opened successfully. "
         "{} total connections running.", GetDatabaseName(),
-        (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size()));
+        (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size() + _connections[IDX_ASYNC_PRIORITY].size() + _connections[IDX_ASYNC_REPLICA].size()));
 
     return 0;
 }
@@ -174,13 +263,47 @@ void DatabaseWorkerPool<T>::Close()
 {
     TC_LOG_INFO("sql.driver", "Closing down DatabasePool '{}'.", GetDatabaseName());
 
+    //! Don't lose statements still waiting for their batch window to expire
+    if (_ioContext && !_connections[IDX_ASYNC].empty())
+    {
+        std::unique_lock<std::mutex> lock(_batchLock);
+        if (SQLTransaction<T> batch = std::exchange(_batch, nullptr))
+        {
+            _batchTimer->cancel();
+            lock.unlock();
+
+            boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, batch]
+            {
+                ExecuteBatch(batch);
+            })).wait();
+        }
+    }
+
     if (_ioContext)
         _ioContext->stop();
 
+    if (_priorityIoContext)
+        _priorityIoContext->stop();
+
+    for (std::unique_ptr<Replica> const& replica : _replicas)
+        if (replica->IoContext)
+            replica->IoContext->stop();
+
     //! Closes the actualy MySQL connection.
     _connections[IDX_ASYNC].clear();
+    _connections[IDX_ASYNC_PRIORITY].clear();
+    _connections[IDX_ASYNC_REPLICA].clear();
+
+    for (std::unique_ptr<Replica> const& replica : _replicas)
+    {
+        replica->Connections.clear();
+        replica->IoContext.reset();
+        replica->Healthy = false;
+    }
 
+    _batchTimer.reset();
     _ioContext.reset();
+    _priorityIoContext.reset();
 
     TC_LOG_INFO("sql.driver", "Asynchronous connections on DatabasePool '{}' terminated. "
                 "Proceeding with synchronous connections.",
@@ -265,10 +388,32 @@ PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
 }
 
 template <class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql)
+QueryResult DatabaseWorkerPool<T>::QueryStreamed(char const* sql)
+{
+    // unlocked by the result
+    T* connection = GetFreeConnection();
+    return QueryResult(connection->QueryStreamed(sql));
+}
+
+template <class T>
+PreparedQueryResult DatabaseWorkerPool<T>::QueryStreamed(PreparedStatement<T>* stmt)
+{
+    // unlocked by the result
+    T* connection = GetFreeConnection();
+    PreparedQueryResult ret(connection->QueryStreamed(stmt));
+
+    //! Delete proxy-class. Not needed anymore
+    delete stmt;
+
+    return ret;
+}
+
+template <class T>
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql, DatabaseQueuePriority priority /*= DatabaseQueuePriority::Normal*/)
 {
-    std::future<QueryResult> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, sql = std::string(sql), tracker = QueueSizeTracker(this)]
+    std::future<QueryResult> result = boost::asio::post(GetIoContext(priority)->get_executor(), boost::asio::use_future([this, sql = std::string(sql), tracker = QueueSizeTracker(this, priority)]
     {
+        tracker.RecordQueueWait();
         T* conn = GetAsyncConnectionForCurrentThread();
         return BasicStatementTask::Query(conn, sql.c_str());
     }));
@@ -276,10 +421,27 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql)
 }
 
 template <class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt, DatabaseQueuePriority priority /*= DatabaseQueuePriority::Normal*/)
+{
+    std::future<PreparedQueryResult> result = boost::asio::post(GetIoContext(priority)->get_executor(), boost::asio::use_future([this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this, priority)]
+    {
+        tracker.RecordQueueWait();
+        T* conn = GetAsyncConnectionForCurrentThread();
+        return PreparedStatementTask::Query(conn, stmt.get());
+    }));
+    return QueryCallback(std::move(result));
+}
+
+template <class T>
+QueryCallback DatabaseWorkerPool<T>::AsyncReplicaQuery(PreparedStatement<T>* stmt)
 {
-    std::future<PreparedQueryResult> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
+    Replica* replica = SelectReplica();
+    if (!replica)
+        return AsyncQuery(stmt);
+
+    std::future<PreparedQueryResult> result = boost::asio::post(replica->IoContext->get_executor(), boost::asio::use_future([this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this, "replica")]
     {
+        tracker.RecordQueueWait();
         T* conn = GetAsyncConnectionForCurrentThread();
         return PreparedStatementTask::Query(conn, stmt.get());
     }));
@@ -287,10 +449,11 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 }
 
 template <class T>
-SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, DatabaseQueuePriority priority /*= DatabaseQueuePriority::Normal*/)
 {
-    std::future<void> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, holder, tracker = QueueSizeTracker(this)]
+    std::future<void> result = boost::asio::post(GetIoContext(priority)->get_executor(), boost::asio::use_future([this, holder, tracker = QueueSizeTracker(this, priority)]
     {
+        tracker.RecordQueueWait();
         T* conn = GetAsyncConnectionForCurrentThread();
         SQLQueryHolderTask::Execute(conn, holder.get());
     }));
@@ -325,6 +488,7 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
 
     boost::asio::post(_ioContext->get_executor(), [this, transaction, tracker = QueueSizeTracker(this)]
     {
+        tracker.RecordQueueWait();
         T* conn = GetAsyncConnectionForCurrentThread();
         TransactionTask::Execute(conn, transaction);
     });
@@ -352,6 +516,7 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 
     std::future<bool> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, transaction, tracker = QueueSizeTracker(this)]
     {
+        tracker.RecordQueueWait();
         T* conn = GetAsyncConnectionForCurrentThread();
         return TransactionTask::Execute(conn, transaction);
     }));
@@ -431,6 +596,37 @@ void DatabaseWorkerPool<T>::KeepAlive()
             conn->Ping();
         });
     }
+
+    auto const priorityCount = _connections[IDX_ASYNC_PRIORITY].size();
+    for (uint8 i = 0; i < priorityCount; ++i)
+    {
+        boost::asio::post(_priorityIoContext->get_executor(), [this, tracker = QueueSizeTracker(this, DatabaseQueuePriority::High)]
+        {
+            T* conn = GetAsyncConnectionForCurrentThread();
+            conn->Ping();
+        });
+    }
+
+    //! The replication status check doubles as keep alive for the connection executing it
+    for (std::unique_ptr<Replica> const& replica : _replicas)
+    {
+        if (!replica->IoContext)
+            continue;
+
+        boost::asio::post(replica->IoContext->get_executor(), [this, replica = replica.get()]
+        {
+            CheckReplica(*replica);
+        });
+
+        for (std::size_t i = 1; i < replica->Connections.size(); ++i)
+        {
+            boost::asio::post(replica->IoContext->get_executor(), [this]
+            {
+                T* conn = GetAsyncConnectionForCurrentThread();
+                conn->Ping();
+            });
+        }
+    }
 }
 
 #ifdef TRINITY_DEBUG
@@ -442,19 +638,23 @@ void DatabaseWorkerPool<T>::WarnAboutSyncQueries([[maybe_unused]] bool warn)
 #endif
 
 template <class T>
-uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConnections)
+uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConnections, MySQLConnectionInfo* connectionInfo /*= nullptr*/)
 {
+    if (!connectionInfo)
+        connectionInfo = _connectionInfo.get();
+
+    std::size_t const previousSize = _connections[type].size();
     for (uint8 i = 0; i < numConnections; ++i)
     {
         // Create the connection
-        constexpr std::array<ConnectionFlags, IDX_SIZE> flags = { { CONNECTION_ASYNC, CONNECTION_SYNCH } };
+        constexpr std::array<ConnectionFlags, IDX_SIZE> flags = { { CONNECTION_ASYNC, CONNECTION_SYNCH, CONNECTION_ASYNC, CONNECTION_ASYNC } };
 
-        std::unique_ptr<T> connection = std::make_unique<T>(*_connectionInfo, flags[type]);
+        std::unique_ptr<T> connection = std::make_unique<T>(*connectionInfo, flags[type]);
 
         if (uint32 error = connection->Open())
         {
             // Failed to open a connection or invalid version, abort and cleanup
-            _connections[type].clear();
+            _connections[type].resize(previousSize);
             return error;
         }
 #ifndef LIBMARIADB
@@ -469,6 +669,7 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
             TC_LOG_ERROR("sql.driver", "TrinityCore does not support MariaDB versions below " MIN_MARIADB_SERVER_VERSION_STRING " (found id {}, need id >= {}), please update your MySQL server", connection->GetServerVersion(), MIN_MARIADB_SERVER_VERSION);
 #endif
 
+            _connections[type].resize(previousSize);
             return 1;
         }
         else
@@ -529,23 +730,187 @@ T* DatabaseWorkerPool<T>::GetAsyncConnectionForCurrentThread() const
         if (connection->GetWorkerThreadId() == id)
             return connection.get();
 
+    for (auto&& connection : _connections[IDX_ASYNC_PRIORITY])
+        if (connection->GetWorkerThreadId() == id)
+            return connection.get();
+
+    for (auto&& connection : _connections[IDX_ASYNC_REPLICA])
+        if (connection->GetWorkerThreadId() == id)
+            return connection.get();
+
+    return nullptr;
+}
+
+template <class T>
+Trinity::Asio::IoContext* DatabaseWorkerPool<T>::GetIoContext(DatabaseQueuePriority priority) const
+{
+    if (priority == DatabaseQueuePriority::High && _priorityIoContext)
+        return _priorityIoContext.get();
+
+    return _ioContext.get();
+}
+
+template <class T>
+typename DatabaseWorkerPool<T>::Replica* DatabaseWorkerPool<T>::SelectReplica()
+{
+    if (_replicas.empty())
+        return nullptr;
+
+    uint32 const start = _nextReplica++;
+    for (std::size_t i = 0; i < _replicas.size(); ++i)
+    {
+        Replica* replica = _replicas[(start + i) % _replicas.size()].get();
+        if (replica->IoContext && replica->Healthy)
+            return replica;
+    }
+
     return nullptr;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::CheckReplica(Replica& replica)
+{
+    T* conn = GetAsyncConnectionForCurrentThread();
+
+    // MySQL 8.0.22 and MariaDB 10.5.1 renamed the statement, MySQL 8.4 removed the old name
+    uint32 const serverVersion = conn->GetServerVersion();
+    bool const replicaSyntax = serverVersion >= 100000 ? serverVersion >= 100501 : serverVersion >= 80022;
+
+    bool healthy = false;
+    std::unique_ptr<ResultSet> status(conn->Query(replicaSyntax ? "SHOW REPLICA STATUS" : "SHOW SLAVE STATUS"));
+    if (!status)
+    {
+        // query failed, server unreachable or missing REPLICATION CLIENT privilege
+    }
+    else if (!status->GetRowCount() || !status->NextRow())
+    {
+        // not an asynchronous replica (copy of the primary or group replication member), nothing to lag behind
+        healthy = true;
+    }
+    else
+    {
+        for (uint32 i = 0; i < status->GetFieldCount(); ++i)
+        {
+            std::string_view column = status->GetFieldMetadata(i).Alias;
+            if (column != "Seconds_Behind_Source" && column != "Seconds_Behind_Master")
+                continue;
+
+            // NULL while replication is stopped
+            Field const& lag = (*status)[i];
+            if (!lag.IsNull())
+            {
+                healthy = Seconds(lag.GetUInt64()) <= _replicaMaxLag;
+                TC_METRIC_VALUE("db_replica_lag", lag.GetUInt64(),
+                    TC_METRIC_TAG("db", GetDatabaseName()),
+                    TC_METRIC_TAG("replica", replica.ConnectionInfo.host));
+            }
+            break;
+        }
+    }
+
+    if (replica.Healthy.exchange(healthy) != healthy)
+    {
+        if (healthy)
+            TC_LOG_INFO("sql.driver", "DatabasePool '{}': read replica {}:{} is healthy, replica safe reads are executed by it.",
+                GetDatabaseName(), replica.ConnectionInfo.host, replica.ConnectionInfo.port_or_socket);
+        else
+            TC_LOG_WARN("sql.driver", "DatabasePool '{}': read replica {}:{} is unavailable or lags behind more than {} seconds, its reads are executed by the primary server.",
+                GetDatabaseName(), replica.ConnectionInfo.host, replica.ConnectionInfo.port_or_socket, _replicaMaxLag.count());
+    }
+}
+
 template <class T>
 char const* DatabaseWorkerPool<T>::GetDatabaseName() const
 {
     return _connectionInfo->database.c_str();
 }
 
+template <class T>
+template <typename Statement>
+void DatabaseWorkerPool<T>::AppendToBatch(Statement statement)
+{
+    std::lock_guard<std::mutex> lock(_batchLock);
+    ++_queueSize;
+
+    if (!_batch)
+    {
+        _batch = std::make_shared<Transaction<T>>();
+        _batchTimer->expires_after(_batchWindow);
+        _batchTimer->async_wait([this](boost::system::error_code const& error)
+        {
+            if (!error)
+                FlushBatch();
+        });
+    }
+
+    _batch->Append(statement);
+    if (_batch->GetSize() >= MAX_BATCH_SIZE)
+    {
+        _batchTimer->cancel();
+        boost::asio::post(_ioContext->get_executor(), [this, batch = std::exchange(_batch, nullptr)]
+        {
+            ExecuteBatch(batch);
+        });
+    }
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::FlushBatch()
+{
+    SQLTransaction<T> batch;
+    {
+        std::lock_guard<std::mutex> lock(_batchLock);
+        batch = std::exchange(_batch, nullptr);
+    }
+
+    if (!batch)
+        return;
+
+    boost::asio::post(_ioContext->get_executor(), [this, batch = std::move(batch)]
+    {
+        ExecuteBatch(batch);
+    });
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ExecuteBatch(SQLTransaction<T> const& batch)
+{
+    T* conn = GetAsyncConnectionForCurrentThread();
+    std::size_t const batchSize = batch->GetSize();
+
+    if (batchSize == 1)
+        std::visit([conn](auto&& data) { conn->Execute(TransactionData::ToExecutable(data)); }, batch->m_queries.front().query);
+    else if (int errorCode = conn->ExecuteTransaction(batch))
+    {
+        if (errorCode == ER_LOCK_DEADLOCK)
+            TransactionTask::Execute(conn, batch);
+        else
+        {
+            //! Statements were enqueued independently, one failing must not discard the others
+            TC_LOG_WARN("sql.sql", "Batch of {} statements failed, executing them one by one.", batchSize);
+            for (TransactionData const& query : batch->m_queries)
+                std::visit([conn](auto&& data) { conn->Execute(TransactionData::ToExecutable(data)); }, query.query);
+        }
+    }
+
+    _queueSize -= batchSize;
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::Execute(char const* sql)
 {
     if (!sql)
         return;
 
+    if (_batchWindow > 0ms)
+    {
+        AppendToBatch(sql);
+        return;
+    }
+
     boost::asio::post(_ioContext->get_executor(), [this, sql = std::string(sql), tracker = QueueSizeTracker(this)]
     {
+        tracker.RecordQueueWait();
         T* conn = GetAsyncConnectionForCurrentThread();
         BasicStatementTask::Execute(conn, sql.c_str());
     });
@@ -554,8 +919,15 @@ void DatabaseWorkerPool<T>::Execute(char const* sql)
 template <class T>
 void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
 {
+    if (_batchWindow > 0ms)
+    {
+        AppendToBatch(stmt);
+        return;
+    }
+
     boost::asio::post(_ioContext->get_executor(), [this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
     {
+        tracker.RecordQueueWait();
         T* conn = GetAsyncConnectionForCurrentThread();
         PreparedStatementTask::Execute(conn, stmt.get());
     });
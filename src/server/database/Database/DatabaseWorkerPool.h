@@ -21,14 +21,25 @@
 #include "AsioHacksFwd.h"
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include "Duration.h"
 #include "StringFormat.h"
 #include <array>
 #include <atomic>
+#include <mutex>
 #include <string>
 #include <vector>
 
 struct MySQLConnectionInfo;
 
+//! Selects the queue asynchronous work is posted to
+enum class DatabaseQueuePriority : uint8
+{
+    Normal,
+    //! Latency sensitive reads (player login, authentication), executed by reserved connections
+    //! when the pool has priority worker threads. Falls back to the normal queue otherwise.
+    High
+};
+
 template <class T>
 class DatabaseWorkerPool
 {
@@ -37,6 +48,8 @@ class DatabaseWorkerPool
         {
             IDX_ASYNC,
             IDX_SYNCH,
+            IDX_ASYNC_PRIORITY,
+            IDX_ASYNC_REPLICA,
             IDX_SIZE
         };
 
@@ -48,6 +61,19 @@ class DatabaseWorkerPool
 
         void SetConnectionInfo(std::string const& infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+        //! Sets for how long one-way statements enqueued with Execute are collected before being sent
+        //! to the server together in a single transaction. 0 executes every statement on its own.
+        void SetBatchWindow(Milliseconds batchWindow) { _batchWindow = batchWindow; }
+
+        //! Sets how many additional asynchronous connections only execute work posted with DatabaseQueuePriority::High.
+        //! Must be called before Open.
+        void SetPriorityThreads(uint8 priorityThreads) { _priority_threads = priorityThreads; }
+
+        //! Sets the read replicas used by AsyncReplicaQuery, each one gets threadsPerReplica asynchronous connections.
+        //! Replicas replicating more than maxLag behind the primary server are skipped until they catch up.
+        //! Must be called before Open.
+        void SetReplicas(std::vector<std::string> const& infoStrings, uint8 threadsPerReplica, Seconds maxLag);
+
         uint32 Open();
 
         void Close();
@@ -141,24 +167,37 @@ class DatabaseWorkerPool
         //! Statement must be prepared with CONNECTION_SYNCH flag.
         PreparedQueryResult Query(PreparedStatement<T>* stmt);
 
+        //! Directly executes an SQL query that will block the calling thread until the first row arrives, remaining rows
+        //! are fetched while the result is iterated instead of being buffered up front. Meant for large loads at startup.
+        //! The connection stays reserved until all rows were read or the result is destroyed, which must happen
+        //! on the calling thread. Do not run other synchronous queries on this pool in the meantime.
+        //! GetRowCount() returns the number of rows read so far.
+        QueryResult QueryStreamed(char const* sql);
+        PreparedQueryResult QueryStreamed(PreparedStatement<T>* stmt);
+
         /**
             Asynchronous query (with resultset) methods.
         */
 
         //! Enqueues a query in string format that will set the value of the QueryResultFuture return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
-        QueryCallback AsyncQuery(char const* sql);
+        QueryCallback AsyncQuery(char const* sql, DatabaseQueuePriority priority = DatabaseQueuePriority::Normal);
 
         //! Enqueues a query in prepared format that will set the value of the PreparedQueryResultFuture return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Statement must be prepared with CONNECTION_ASYNC flag.
-        QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
+        QueryCallback AsyncQuery(PreparedStatement<T>* stmt, DatabaseQueuePriority priority = DatabaseQueuePriority::Normal);
+
+        //! Same as AsyncQuery, but executed by one of the read replicas when the pool has a healthy one.
+        //! Only for reads that tolerate replication lag, the result may not contain recent writes of the primary server.
+        //! Statement must be prepared with CONNECTION_ASYNC flag.
+        QueryCallback AsyncReplicaQuery(PreparedStatement<T>* stmt);
 
         //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
         //! return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-        SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
+        SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, DatabaseQueuePriority priority = DatabaseQueuePriority::Normal);
 
         /**
             Transaction context methods.
@@ -202,6 +241,7 @@ class DatabaseWorkerPool
         void EscapeString(std::string& str);
 
         //! Keeps all our MySQL connections alive, prevent the server from disconnecting us.
+        //! Also checks the replication lag of read replicas.
         void KeepAlive();
 
 #ifdef TRINITY_DEBUG
@@ -213,7 +253,10 @@ class DatabaseWorkerPool
         size_t QueueSize() const;
 
     private:
-        uint32 OpenConnections(InternalIndex type, uint8 numConnections);
+        struct Replica;
+
+        //! Opens connections to connectionInfo, the primary server when not set
+        uint32 OpenConnections(InternalIndex type, uint8 numConnections, MySQLConnectionInfo* connectionInfo = nullptr);
 
         unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
@@ -223,18 +266,51 @@ class DatabaseWorkerPool
 
         T* GetAsyncConnectionForCurrentThread() const;
 
+        //! Queue of the requested lane, the normal queue when the pool has no priority worker threads
+        Trinity::Asio::IoContext* GetIoContext(DatabaseQueuePriority priority) const;
+
+        //! Picks the next healthy read replica, round robin. nullptr when there is none
+        Replica* SelectReplica();
+
+        //! Updates the health state of a replica from its replication status, must run on one of its worker threads
+        void CheckReplica(Replica& replica);
+
         char const* GetDatabaseName() const;
 
+        //! Adds a one-way statement to the pending batch, scheduling its execution when the batch is new
+        template <typename Statement>
+        void AppendToBatch(Statement statement);
+
+        //! Posts the pending batch to the async worker threads
+        void FlushBatch();
+
+        //! Executes all statements of a batch in one transaction, falling back to executing them one by one if it fails
+        void ExecuteBatch(SQLTransaction<T> const& batch);
+
         struct QueueSizeTracker;
         friend QueueSizeTracker;
 
         //! Queue shared by async worker threads.
         std::unique_ptr<Trinity::Asio::IoContext> _ioContext;
+        //! Queue of DatabaseQueuePriority::High work, shared by priority worker threads.
+        std::unique_ptr<Trinity::Asio::IoContext> _priorityIoContext;
         std::atomic<size_t> _queueSize;
         std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
         std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
         std::vector<uint8> _preparedStatementSize;
-        uint8 _async_threads, _synch_threads;
+        uint8 _async_threads, _synch_threads, _priority_threads;
+
+        //! Read replicas used by AsyncReplicaQuery, each with its own queue
+        std::vector<std::unique_ptr<Replica>> _replicas;
+        std::atomic<uint32> _nextReplica;
+        uint8 _replica_threads;
+        Seconds _replicaMaxLag;
+
+        //! One-way statements collected during the current batch window
+        std::mutex _batchLock;
+        SQLTransaction<T> _batch;
+        std::unique_ptr<Trinity::Asio::DeadlineTimer> _batchTimer;
+        Milliseconds _batchWindow;
 };
 
 #endif
@@ -122,8 +122,8 @@ enum LoginDatabaseStatements : uint32
     LOGIN_UPD_BNET_LAST_LOGIN_INFO,
     LOGIN_UPD_BNET_GAME_ACCOUNT_LOGIN_INFO,
     LOGIN_SEL_BNET_CHARACTER_COUNTS_BY_ACCOUNT_ID,
-    LOGIN_SEL_BNET_CHARACTER_COUNTS_BY_BNET_ID,
-    LOGIN_SEL_BNET_LAST_PLAYER_CHARACTERS,
+    LOGIN_SEL_BNET_CHARACTER_COUNTS_BY_LOGIN_TICKET,
+    LOGIN_SEL_BNET_LAST_PLAYER_CHARACTERS_BY_LOGIN_TICKET,
     LOGIN_DEL_BNET_LAST_PLAYER_CHARACTERS,
     LOGIN_INS_BNET_LAST_PLAYER_CHARACTERS,
     LOGIN_INS_BNET_ACCOUNT,
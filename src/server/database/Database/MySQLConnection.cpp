@@ -326,7 +326,7 @@ bool MySQLConnection::_Query(PreparedStatementBase* stmt, MySQLPreparedStatement
 
     m_mStmt->ClearParameters();
 
-    *pResult = reinterpret_cast<MySQLResult*>(mysql_stmt_result_metadata(msql_STMT));
+    *pResult = m_mStmt->GetResultMetadata();
     *pRowCount = mysql_stmt_num_rows(msql_STMT);
     *pFieldCount = mysql_stmt_field_count(msql_STMT);
 
@@ -349,7 +349,31 @@ ResultSet* MySQLConnection::Query(char const* sql)
     return new ResultSet(result, fields, rowCount, fieldCount);
 }
 
-bool MySQLConnection::_Query(const char* sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount)
+ResultSet* MySQLConnection::QueryStreamed(char const* sql)
+{
+    MySQLResult* result = nullptr;
+    MySQLField* fields = nullptr;
+    uint64 rowCount = 0;
+    uint32 fieldCount = 0;
+
+    if (!sql || !_Query(sql, &result, &fields, &rowCount, &fieldCount, true))
+    {
+        Unlock();
+        return nullptr;
+    }
+
+    // unlocks the connection when done
+    ResultSet* resultSet = new ResultSet(result, fields, rowCount, fieldCount, this);
+    if (!resultSet->NextRow())
+    {
+        delete resultSet;
+        return nullptr;
+    }
+
+    return resultSet;
+}
+
+bool MySQLConnection::_Query(const char* sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount, bool streamed /*= false*/)
 {
     if (!m_Mysql)
         return false;
@@ -364,22 +388,23 @@ bool MySQLConnection::_Query(const char* sql, MySQLResult** pResult, MySQLField*
             TC_LOG_ERROR("sql.sql", "[{}] {}", lErrno, mysql_error(m_Mysql));
 
             if (_HandleMySQLErrno(lErrno))      // If it returns true, an error was handled successfully (i.e. reconnection)
-                return _Query(sql, pResult, pFields, pRowCount, pFieldCount);    // We try again
+                return _Query(sql, pResult, pFields, pRowCount, pFieldCount, streamed);    // We try again
 
             return false;
         }
         else
             TC_LOG_DEBUG("sql.sql", "[{} ms] SQL: {}", getMSTimeDiff(_s, getMSTime()), sql);
 
-        *pResult = reinterpret_cast<MySQLResult*>(mysql_store_result(m_Mysql));
-        *pRowCount = mysql_affected_rows(m_Mysql);
+        // streamed results do not know their row count until all rows were read
+        *pResult = reinterpret_cast<MySQLResult*>(streamed ? mysql_use_result(m_Mysql) : mysql_store_result(m_Mysql));
+        *pRowCount = streamed ? 0 : mysql_affected_rows(m_Mysql);
         *pFieldCount = mysql_field_count(m_Mysql);
     }
 
     if (!*pResult )
         return false;
 
-    if (!*pRowCount)
+    if (!streamed && !*pRowCount)
     {
         mysql_free_result(*pResult);
         return false;
@@ -542,6 +567,33 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
     return new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
 }
 
+PreparedResultSet* MySQLConnection::QueryStreamed(PreparedStatementBase* stmt)
+{
+    MySQLPreparedStatement* mysqlStmt = nullptr;
+    MySQLResult* result = nullptr;
+    uint64 rowCount = 0;
+    uint32 fieldCount = 0;
+
+    if (!_Query(stmt, &mysqlStmt, &result, &rowCount, &fieldCount) || !result)
+    {
+        if (mysqlStmt)
+            mysql_stmt_free_result(mysqlStmt->GetSTMT());
+
+        Unlock();
+        return nullptr;
+    }
+
+    // fetches the first row and unlocks the connection when done
+    PreparedResultSet* resultSet = new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount, this);
+    if (!resultSet->GetRowCount())
+    {
+        delete resultSet;
+        return nullptr;
+    }
+
+    return resultSet;
+}
+
 bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, uint8 attempts /*= 5*/)
 {
     switch (errNo)
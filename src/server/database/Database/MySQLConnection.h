@@ -52,6 +52,8 @@ class TC_DATABASE_API MySQLConnection
 {
     template <class T> friend class DatabaseWorkerPool;
     friend class PingOperation;
+    friend class ResultSet;
+    friend class PreparedResultSet;
 
     public:
         MySQLConnection(MySQLConnectionInfo& connInfo, ConnectionFlags connectionFlags);
@@ -66,7 +68,11 @@ class TC_DATABASE_API MySQLConnection
         bool Execute(PreparedStatementBase* stmt);
         ResultSet* Query(char const* sql);
         PreparedResultSet* Query(PreparedStatementBase* stmt);
-        bool _Query(char const* sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
+        /// Fetches rows from the server while the result is iterated, the connection must be locked by the calling thread
+        /// and is unlocked by the result once all rows were read or it is destroyed. Returns nullptr (and unlocks) if there are no rows
+        ResultSet* QueryStreamed(char const* sql);
+        PreparedResultSet* QueryStreamed(PreparedStatementBase* stmt);
+        bool _Query(char const* sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount, bool streamed = false);
         bool _Query(PreparedStatementBase* stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
 
         void BeginTransaction();
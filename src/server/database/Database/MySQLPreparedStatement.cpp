@@ -38,7 +38,8 @@ template<> struct MySQLType<float> : std::integral_constant<enum_field_types, MY
 template<> struct MySQLType<double> : std::integral_constant<enum_field_types, MYSQL_TYPE_DOUBLE> { };
 
 MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string queryString) :
-    m_stmt(nullptr), m_Mstmt(stmt), m_bind(nullptr), m_queryString(std::move(queryString))
+    m_stmt(nullptr), m_Mstmt(stmt), m_bind(nullptr), m_resultMetadata(nullptr), m_resultMetadataFetched(false),
+    m_queryString(std::move(queryString))
 {
     /// Initialize variable parameters
     m_paramCount = mysql_stmt_param_count(stmt);
@@ -46,6 +47,13 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string quer
     m_bind = new MySQLBind[m_paramCount];
     memset(m_bind, 0, sizeof(MySQLBind) * m_paramCount);
 
+    /// Large enough for every fixed size parameter type, only strings and binary values can need more
+    m_paramBuffers.resize(m_paramCount);
+    for (std::vector<char>& buffer : m_paramBuffers)
+        buffer.resize(sizeof(MYSQL_TIME));
+
+    m_paramLengths.resize(m_paramCount);
+
     /// "If set to 1, causes mysql_stmt_store_result() to update the metadata MYSQL_FIELD->max_length value."
     MySQLBool bool_tmp = MySQLBool(1);
     mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &bool_tmp);
@@ -59,10 +67,23 @@ MySQLPreparedStatement::~MySQLPreparedStatement()
         delete[] m_Mstmt->bind->length;
         delete[] m_Mstmt->bind->is_null;
     }
+    if (m_resultMetadata)
+        mysql_free_result(m_resultMetadata);
     mysql_stmt_close(m_Mstmt);
     delete[] m_bind;
 }
 
+MySQLResult* MySQLPreparedStatement::GetResultMetadata()
+{
+    if (!m_resultMetadataFetched)
+    {
+        m_resultMetadata = reinterpret_cast<MySQLResult*>(mysql_stmt_result_metadata(m_Mstmt));
+        m_resultMetadataFetched = true;
+    }
+
+    return m_resultMetadata;
+}
+
 void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 {
     m_stmt = stmt;     // Cross reference them for debug output
@@ -84,14 +105,18 @@ void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 
 void MySQLPreparedStatement::ClearParameters()
 {
+    // parameter buffers are kept for the next execution
     for (uint32 i=0; i < m_paramCount; ++i)
-    {
-        delete m_bind[i].length;
-        m_bind[i].length = nullptr;
-        delete[] (char*) m_bind[i].buffer;
-        m_bind[i].buffer = nullptr;
         m_paramsSet[i] = false;
-    }
+}
+
+char* MySQLPreparedStatement::GetParameterBuffer(uint8 index, std::size_t size)
+{
+    std::vector<char>& buffer = m_paramBuffers[index];
+    if (buffer.size() < size)
+        buffer.resize(size);
+
+    return buffer.data();
 }
 
 static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 paramCount)
@@ -115,11 +140,9 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::nullptr_t)
     m_paramsSet[index] = true;
     MYSQL_BIND* param = &m_bind[index];
     param->buffer_type = MYSQL_TYPE_NULL;
-    delete[] static_cast<char *>(param->buffer);
     param->buffer = nullptr;
     param->buffer_length = 0;
     param->is_null_value = 1;
-    delete param->length;
     param->length = nullptr;
 }
 
@@ -136,8 +159,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, T value)
     MYSQL_BIND* param = &m_bind[index];
     uint32 len = uint32(sizeof(T));
     param->buffer_type = MySQLType<T>::value;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
+    param->buffer = GetParameterBuffer(index, len);
     param->buffer_length = 0;
     param->is_null_value = 0;
     param->length = nullptr;               // Only != NULL for strings
@@ -153,12 +175,11 @@ void MySQLPreparedStatement::SetParameter(uint8 index, SystemTimePoint value)
     MYSQL_BIND* param = &m_bind[index];
     uint32 len = sizeof(MYSQL_TIME);
     param->buffer_type = MYSQL_TYPE_DATETIME;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
+    param->buffer = GetParameterBuffer(index, len);
     param->buffer_length = len;
     param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
+    m_paramLengths[index] = len;
+    param->length = &m_paramLengths[index];
 
     std::chrono::year_month_day ymd(time_point_cast<std::chrono::days>(value));
     std::chrono::hh_mm_ss hms(duration_cast<std::chrono::microseconds>(value - std::chrono::sys_days(ymd)));
@@ -180,12 +201,11 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
     MYSQL_BIND* param = &m_bind[index];
     uint32 len = uint32(value.size());
     param->buffer_type = MYSQL_TYPE_VAR_STRING;
-    delete [] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
+    param->buffer = GetParameterBuffer(index, len);
     param->buffer_length = len;
     param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
+    m_paramLengths[index] = len;
+    param->length = &m_paramLengths[index];
 
     memcpy(param->buffer, value.c_str(), len);
 }
@@ -197,12 +217,11 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::vector<uint8> const&
     MYSQL_BIND* param = &m_bind[index];
     uint32 len = uint32(value.size());
     param->buffer_type = MYSQL_TYPE_BLOB;
-    delete [] static_cast<char *>(param->buffer);
-    param->buffer = new char[len];
+    param->buffer = GetParameterBuffer(index, len);
     param->buffer_length = len;
     param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
+    m_paramLengths[index] = len;
+    param->length = &m_paramLengths[index];
 
     memcpy(param->buffer, value.data(), len);
 }
@@ -54,9 +54,14 @@ class TC_DATABASE_API MySQLPreparedStatement
 
         MySQLStmt* GetSTMT() { return m_Mstmt; }
         MySQLBind* GetBind() { return m_bind; }
+        //! Result metadata, fetched on first use and owned by this object. Its fields are shared with the
+        //! statement handle and updated by every mysql_stmt_store_result. nullptr for statements without result set
+        MySQLResult* GetResultMetadata();
         PreparedStatementBase* m_stmt;
         void ClearParameters();
         void AssertValidIndex(uint8 index);
+        //! Storage for the value of a parameter, reused by all executions and only grown when a larger value is bound
+        char* GetParameterBuffer(uint8 index, std::size_t size);
         std::string getQueryString() const;
 
     private:
@@ -64,6 +69,10 @@ class TC_DATABASE_API MySQLPreparedStatement
         uint32 m_paramCount;
         std::vector<bool> m_paramsSet;
         MySQLBind* m_bind;
+        std::vector<std::vector<char>> m_paramBuffers;
+        std::vector<unsigned long> m_paramLengths;
+        MySQLResult* m_resultMetadata;
+        bool m_resultMetadataFetched;
         std::string const m_queryString;
 
         MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
@@ -20,14 +20,19 @@
 #include "Field.h"
 #include "FieldValueConverters.h"
 #include "Log.h"
+#include "MySQLConnection.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
 #include <chrono>
 #include <cstring>
+#include <limits>
 
 namespace
 {
-static uint32 SizeForType(MYSQL_FIELD* field)
+// row buffer size for string and blob columns of streamed results, longer values are fetched separately
+constexpr uint32 StreamedStringBufferSize = 1024;
+
+static uint32 SizeForType(MYSQL_FIELD* field, bool streamed)
 {
     switch (field->type)
     {
@@ -59,6 +64,9 @@ static uint32 SizeForType(MYSQL_FIELD* field)
         case MYSQL_TYPE_BLOB:
         case MYSQL_TYPE_STRING:
         case MYSQL_TYPE_VAR_STRING:
+            // max_length is only known once the entire result is stored
+            if (streamed)
+                return uint32(std::min<unsigned long>(field->length, StreamedStringBufferSize)) + 1;
             return field->max_length + 1;
 
         case MYSQL_TYPE_DECIMAL:
@@ -393,11 +401,12 @@ void InitializeDatabaseFieldMetadata(QueryResultFieldMetadata* meta, MySQLField
 }
 }
 
-ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount) :
+ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection /*= nullptr*/) :
 _rowCount(rowCount),
 _fieldCount(fieldCount),
 _result(result),
-_fields(fields)
+_fields(fields),
+_streamConnection(streamConnection)
 {
     _fieldMetadata.resize(_fieldCount);
     _fieldIndexByAlias.reserve(_fieldCount);
@@ -412,13 +421,15 @@ _fields(fields)
     }
 }
 
-PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount) :
+PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection /*= nullptr*/) :
 m_rowCount(rowCount),
 m_rowPosition(0),
 m_fieldCount(fieldCount),
 m_rBind(nullptr),
 m_stmt(stmt),
-m_metadataResult(result)
+m_metadataResult(result),
+m_streamConnection(streamConnection),
+m_streamed(streamConnection != nullptr)
 {
     if (!m_metadataResult)
         return;
@@ -441,8 +452,8 @@ m_metadataResult(result)
     memset(m_rBind, 0, sizeof(MySQLBind) * m_fieldCount);
     memset(m_length, 0, sizeof(unsigned long) * m_fieldCount);
 
-    //- This is where we store the (entire) resultset
-    if (mysql_stmt_store_result(m_stmt))
+    //- This is where we store the (entire) resultset, streamed results fetch one row at a time instead
+    if (!m_streamed && mysql_stmt_store_result(m_stmt))
     {
         TC_LOG_WARN("sql.sql", "{}:mysql_stmt_store_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
         delete[] m_rBind;
@@ -451,7 +462,7 @@ m_metadataResult(result)
         return;
     }
 
-    m_rowCount = mysql_stmt_num_rows(m_stmt);
+    m_rowCount = m_streamed ? 0 : mysql_stmt_num_rows(m_stmt);
 
     //- This is where we prepare the buffer based on metadata
     MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
@@ -460,7 +471,7 @@ m_metadataResult(result)
     std::size_t rowSize = 0;
     for (uint32 i = 0; i < m_fieldCount; ++i)
     {
-        uint32 size = SizeForType(&field[i]);
+        uint32 size = SizeForType(&field[i], m_streamed);
         rowSize += size;
 
         InitializeDatabaseFieldMetadata(&m_fieldMetadata[i], &field[i], i, true);
@@ -476,7 +487,8 @@ m_metadataResult(result)
         m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
     }
 
-    char* dataBuffer = new char[rowSize * m_rowCount];
+    // rows are fetched one at a time into this buffer, values are then packed into m_rowData
+    char* dataBuffer = new char[rowSize];
     for (uint32 i = 0, offset = 0; i < m_fieldCount; ++i)
     {
         m_rBind[i].buffer = dataBuffer + offset;
@@ -494,18 +506,38 @@ m_metadataResult(result)
         return;
     }
 
+    if (m_streamed)
+    {
+        m_rows.resize(m_fieldCount);
+        m_streamOverflow.resize(m_fieldCount);
+        for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+            m_rows[fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
+
+        if (FetchStreamedRow())
+            m_rowCount = 1;
+        else
+            EndStreaming();
+
+        return;
+    }
+
     m_rows.resize(std::size_t(m_rowCount) * m_fieldCount);
+
+    // offset of each value in m_rowData, pointers are only assigned once it stops growing
+    std::vector<std::size_t> valueOffsets(m_rows.size());
     while (_NextRow())
     {
         for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
         {
-            m_rows[std::size_t(m_rowPosition) * m_fieldCount + fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
+            std::size_t cellIndex = std::size_t(m_rowPosition) * m_fieldCount + fIndex;
+            m_rows[cellIndex].SetMetadata(&m_fieldMetadata[fIndex]);
 
             unsigned long buffer_length = m_rBind[fIndex].buffer_length;
             unsigned long fetched_length = *m_rBind[fIndex].length;
             if (!*m_rBind[fIndex].is_null)
             {
-                void* buffer = m_stmt->bind[fIndex].buffer;
+                char const* buffer = static_cast<char const*>(m_rBind[fIndex].buffer);
+                std::size_t offset = m_rowData.size();
                 switch (m_rBind[fIndex].buffer_type)
                 {
                     case MYSQL_TYPE_TINY_BLOB:
@@ -514,34 +546,45 @@ m_metadataResult(result)
                     case MYSQL_TYPE_BLOB:
                     case MYSQL_TYPE_STRING:
                     case MYSQL_TYPE_VAR_STRING:
+                    {
                         // warning - the string will not be null-terminated if there is no space for it in the buffer
                         // when mysql_stmt_fetch returned MYSQL_DATA_TRUNCATED
                         // we cannot blindly null-terminate the data either as it may be retrieved as binary blob and not specifically a string
                         // in this case using Field::GetCString will result in garbage
                         // TODO: remove Field::GetCString and use std::string_view in C++17
+                        std::size_t copied = std::min<std::size_t>(fetched_length, buffer_length);
+                        m_rowData.insert(m_rowData.end(), buffer, buffer + copied);
                         if (fetched_length < buffer_length)
-                            *((char*)buffer + fetched_length) = '\0';
+                            m_rowData.push_back('\0');
                         break;
+                    }
                     default:
+                    {
+                        // fixed size values are read in place, keep them aligned
+                        std::size_t alignment = std::clamp<std::size_t>(buffer_length, 1, 8);
+                        offset = (offset + alignment - 1) & ~(alignment - 1);
+                        m_rowData.resize(offset);
+                        m_rowData.insert(m_rowData.end(), buffer, buffer + buffer_length);
                         break;
+                    }
                 }
 
-                m_rows[std::size_t(m_rowPosition) * m_fieldCount + fIndex].SetValue(
-                    (char const*)buffer,
-                    fetched_length);
-
-                // move buffer pointer to next part
-                m_stmt->bind[fIndex].buffer = (char*)buffer + rowSize;
+                valueOffsets[cellIndex] = offset;
+                m_rows[cellIndex].SetValue(nullptr, fetched_length);
             }
             else
             {
-                m_rows[std::size_t(m_rowPosition) * m_fieldCount + fIndex].SetValue(
-                    nullptr,
-                    *m_rBind[fIndex].length);
+                valueOffsets[cellIndex] = std::numeric_limits<std::size_t>::max();
+                m_rows[cellIndex].SetValue(nullptr, fetched_length);
             }
         }
         m_rowPosition++;
     }
+
+    for (std::size_t cellIndex = 0; cellIndex < std::size_t(m_rowPosition) * m_fieldCount; ++cellIndex)
+        if (valueOffsets[cellIndex] != std::numeric_limits<std::size_t>::max())
+            m_rows[cellIndex].SetValue(m_rowData.data() + valueOffsets[cellIndex], m_rows[cellIndex]._length);
+
     m_rowPosition = 0;
 
     /// All data is buffered, let go of mysql c api structures
@@ -555,6 +598,7 @@ ResultSet::~ResultSet()
 
 PreparedResultSet::~PreparedResultSet()
 {
+    EndStreaming();
     CleanUp();
 }
 
@@ -581,11 +625,28 @@ bool ResultSet::NextRow()
     for (uint32 i = 0; i < _fieldCount; i++)
         _currentRow[i].SetValue(row[i], lengths[i]);
 
+    // streamed results count their rows while reading them
+    if (_streamConnection)
+        ++_rowCount;
+
     return true;
 }
 
 bool PreparedResultSet::NextRow()
 {
+    /// Streamed results overwrite their only row with the next one from the server
+    if (m_streamed)
+    {
+        if (m_streamConnection && FetchStreamedRow())
+        {
+            ++m_rowCount;
+            return true;
+        }
+
+        EndStreaming();
+        return false;
+    }
+
     /// Only updates the m_rowPosition so upper level code knows in which element
     /// of the rows vector to look
     if (++m_rowPosition >= m_rowCount)
@@ -605,6 +666,79 @@ bool PreparedResultSet::_NextRow()
     return retval == 0 || retval == MYSQL_DATA_TRUNCATED;
 }
 
+bool PreparedResultSet::FetchStreamedRow()
+{
+    int retval = mysql_stmt_fetch(m_stmt);
+    if (retval == MYSQL_NO_DATA)
+        return false;
+
+    if (retval != 0 && retval != MYSQL_DATA_TRUNCATED)
+    {
+        TC_LOG_WARN("sql.sql", "{}:mysql_stmt_fetch, cannot fetch streamed row from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
+        return false;
+    }
+
+    for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+    {
+        unsigned long fetched_length = *m_rBind[fIndex].length;
+        if (*m_rBind[fIndex].is_null)
+        {
+            m_rows[fIndex].SetValue(nullptr, fetched_length);
+            continue;
+        }
+
+        char* buffer = static_cast<char*>(m_rBind[fIndex].buffer);
+        switch (m_rBind[fIndex].buffer_type)
+        {
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+            case MYSQL_TYPE_STRING:
+            case MYSQL_TYPE_VAR_STRING:
+                if (fetched_length >= m_rBind[fIndex].buffer_length)
+                {
+                    // value did not fit in the row buffer, fetch it again into storage large enough for it
+                    std::vector<char>& overflow = m_streamOverflow[fIndex];
+                    overflow.resize(fetched_length + 1);
+
+                    unsigned long length = 0;
+                    MySQLBind bind = m_rBind[fIndex];
+                    bind.buffer = overflow.data();
+                    bind.buffer_length = fetched_length + 1;
+                    bind.length = &length;
+                    if (mysql_stmt_fetch_column(m_stmt, &bind, fIndex, 0))
+                    {
+                        TC_LOG_WARN("sql.sql", "{}:mysql_stmt_fetch_column, cannot fetch streamed column {} from MySQL server. Error: {}", __FUNCTION__, fIndex, mysql_stmt_error(m_stmt));
+                        return false;
+                    }
+
+                    buffer = overflow.data();
+                }
+
+                buffer[fetched_length] = '\0';
+                break;
+            default:
+                break;
+        }
+
+        m_rows[fIndex].SetValue(buffer, fetched_length);
+    }
+
+    return true;
+}
+
+void PreparedResultSet::EndStreaming()
+{
+    if (!m_streamConnection)
+        return;
+
+    /// Discards rows that were not read
+    mysql_stmt_free_result(m_stmt);
+    m_streamConnection->Unlock();
+    m_streamConnection = nullptr;
+}
+
 void ResultSet::CleanUp()
 {
     if (_currentRow)
@@ -618,13 +752,16 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    if (_streamConnection)
+    {
+        _streamConnection->Unlock();
+        _streamConnection = nullptr;
+    }
 }
 
 void PreparedResultSet::CleanUp()
 {
-    if (m_metadataResult)
-        mysql_free_result(m_metadataResult);
-
     if (m_rBind)
     {
         delete[](char*)m_rBind->buffer;
@@ -24,6 +24,8 @@
 #include <unordered_map>
 #include <vector>
 
+class MySQLConnection;
+
 namespace Trinity::DB
 {
 struct FieldLookupByAliasKey
@@ -49,7 +51,7 @@ using FieldAliasToIndexMap = std::unordered_map<FieldLookupByAliasKey, std::size
 class TC_DATABASE_API ResultSet
 {
     public:
-        ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+        ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection = nullptr);
         ~ResultSet();
 
         bool NextRow();
@@ -74,6 +76,7 @@ class TC_DATABASE_API ResultSet
         void CleanUp();
         MySQLResult* _result;
         MySQLField* _fields;
+        MySQLConnection* _streamConnection;     ///< Set while rows are fetched from the server on demand, unlocked in CleanUp
 
         ResultSet(ResultSet const& right) = delete;
         ResultSet& operator=(ResultSet const& right) = delete;
@@ -82,7 +85,7 @@ class TC_DATABASE_API ResultSet
 class TC_DATABASE_API PreparedResultSet
 {
     public:
-        PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
+        PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection = nullptr);
         ~PreparedResultSet();
 
         bool NextRow();
@@ -100,6 +103,7 @@ class TC_DATABASE_API PreparedResultSet
         std::vector<QueryResultFieldMetadata> m_fieldMetadata;
         Trinity::DB::FieldAliasToIndexMap m_fieldIndexByAlias;
         std::vector<Field> m_rows;
+        std::vector<char> m_rowData;    ///< Values of all rows packed back to back, m_rows point into it
         uint64 m_rowCount;
         uint64 m_rowPosition;
         uint32 m_fieldCount;
@@ -107,10 +111,15 @@ class TC_DATABASE_API PreparedResultSet
     private:
         MySQLBind* m_rBind;
         MySQLStmt* m_stmt;
-        MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
+        MySQLResult* m_metadataResult;    ///< Field metadata, owned by the MySQLPreparedStatement
+        MySQLConnection* m_streamConnection;    ///< Set while rows are fetched from the server on demand
+        bool m_streamed;
+        std::vector<std::vector<char>> m_streamOverflow;    ///< Storage for streamed values larger than the row buffer
 
         void CleanUp();
         bool _NextRow();
+        bool FetchStreamedRow();
+        void EndStreaming();
 
         PreparedResultSet(PreparedResultSet const& right) = delete;
         PreparedResultSet& operator=(PreparedResultSet const& right) = delete;
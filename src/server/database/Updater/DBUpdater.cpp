@@ -28,9 +28,11 @@
 #include <boost/filesystem/operations.hpp>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 
 std::string DBUpdaterUtil::GetCorrectedMySQLExecutable()
 {
+    std::lock_guard lock(corrected_path_lock());
     if (!corrected_path().empty())
         return corrected_path();
     else
@@ -46,6 +48,7 @@ bool DBUpdaterUtil::CheckExecutable()
         if (!exe.empty() && is_regular_file(exe))
         {
             // Correct the path to the cli
+            std::lock_guard lock(corrected_path_lock());
             corrected_path() = absolute(exe).generic_string();
             return true;
         }
@@ -64,6 +67,13 @@ std::string& DBUpdaterUtil::corrected_path()
     return path;
 }
 
+// databases can be updated concurrently
+std::mutex& DBUpdaterUtil::corrected_path_lock()
+{
+    static std::mutex lock;
+    return lock;
+}
+
 // Auth Database
 template<>
 std::string DBUpdater<LoginDatabaseConnection>::GetConfigEntry()
@@ -250,9 +260,14 @@ bool DBUpdater<T>::Update(DatabaseWorkerPool<T>& pool)
         return false;
     }
 
+    std::string hashCacheFile = sConfigMgr->GetStringDefault("Updates.HashCacheDirectory", "");
+    if (!hashCacheFile.empty())
+        hashCacheFile = (Path(hashCacheFile) / (pool.GetConnectionInfo()->database + ".hashcache")).generic_string();
+
     UpdateFetcher updateFetcher(sourceDirectory, [&](std::string const& query) { DBUpdater<T>::Apply(pool, query); },
         [&](Path const& file) { DBUpdater<T>::ApplyFile(pool, file); },
-            [&](std::string const& query) -> QueryResult { return DBUpdater<T>::Retrieve(pool, query); });
+            [&](std::string const& query) -> QueryResult { return DBUpdater<T>::Retrieve(pool, query); },
+                hashCacheFile);
 
     UpdateResult result;
     try
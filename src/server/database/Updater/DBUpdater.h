@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -55,6 +56,7 @@ public:
 
 private:
     static std::string& corrected_path();
+    static std::mutex& corrected_path_lock();
 };
 
 template <class T>
@@ -40,9 +40,10 @@ struct UpdateFetcher::DirectoryEntry
 UpdateFetcher::UpdateFetcher(Path const& sourceDirectory,
     std::function<void(std::string const&)> const& apply,
     std::function<void(Path const& path)> const& applyFile,
-    std::function<QueryResult(std::string const&)> const& retrieve) :
+    std::function<QueryResult(std::string const&)> const& retrieve,
+    std::string const& hashCacheFile /*= ""*/) :
         _sourceDirectory(std::make_unique<Path>(sourceDirectory)), _apply(apply), _applyFile(applyFile),
-        _retrieve(retrieve)
+        _retrieve(retrieve), _hashCacheFile(hashCacheFile)
 {
 }
 
@@ -170,6 +171,69 @@ std::string UpdateFetcher::ReadSQLUpdate(boost::filesystem::path const& file) co
     return update;
 }
 
+UpdateFetcher::HashCacheStorage UpdateFetcher::LoadHashCache() const
+{
+    HashCacheStorage cache;
+    if (_hashCacheFile.empty())
+        return cache;
+
+    std::ifstream in(_hashCacheFile);
+    if (!in.is_open())
+        return cache;
+
+    // <size> <last write time> <hash> <path>
+    HashCacheEntry entry;
+    std::string file;
+    while (in >> entry.size >> entry.lastWriteTime >> entry.hash && in.get() == ' ' && std::getline(in, file))
+        cache[file] = entry;
+
+    TC_LOG_DEBUG("sql.updates", "Loaded {} cached update hashes from \"{}\".", cache.size(), _hashCacheFile);
+    return cache;
+}
+
+void UpdateFetcher::SaveHashCache(HashCacheStorage const& cache) const
+{
+    if (_hashCacheFile.empty())
+        return;
+
+    // written to a temporary file first, a partially written cache is never used
+    std::string const tempFile = _hashCacheFile + ".tmp";
+    {
+        std::ofstream out(tempFile, std::ios::out | std::ios::trunc);
+        for (auto const& [file, entry] : cache)
+            out << entry.size << ' ' << entry.lastWriteTime << ' ' << entry.hash << ' ' << file << '\n';
+
+        if (!out)
+        {
+            TC_LOG_WARN("sql.updates", "Failed to write update hash cache \"{}\".", tempFile);
+            return;
+        }
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::rename(tempFile, _hashCacheFile, error);
+    if (error)
+        TC_LOG_WARN("sql.updates", "Failed to replace update hash cache \"{}\": {}", _hashCacheFile, error.message());
+}
+
+std::string UpdateFetcher::GetHash(Path const& file, HashCacheStorage const& cache, HashCacheStorage& usedCache, bool& changed) const
+{
+    if (_hashCacheFile.empty())
+        return ByteArrayToHexStr(Trinity::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(file)));
+
+    std::string const key = file.generic_string();
+    uint64 const size = file_size(file);
+    int64 const lastWriteTime = last_write_time(file);
+
+    auto itr = cache.find(key);
+    if (itr != cache.end() && itr->second.size == size && itr->second.lastWriteTime == lastWriteTime)
+        return usedCache.emplace(key, itr->second).first->second.hash;
+
+    changed = true;
+    HashCacheEntry entry = { size, lastWriteTime, ByteArrayToHexStr(Trinity::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(file))) };
+    return usedCache.insert_or_assign(key, std::move(entry)).first->second.hash;
+}
+
 UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
                                    bool const allowRehash,
                                    bool const archivedRedundancy,
@@ -193,6 +257,11 @@ UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
     for (auto const& [name, appliedFile] : applied)
         hashToName.try_emplace(appliedFile.hash, name);
 
+    // Hashes of files that were not modified since the last start are not calculated again
+    HashCacheStorage const hashCache = LoadHashCache();
+    HashCacheStorage usedHashCache;
+    bool hashCacheChanged = false;
+
     size_t importedUpdates = 0;
 
     for (auto const& availableQuery : available)
@@ -222,7 +291,7 @@ UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
         }
 
         // Calculate a Sha1 hash based on query content.
-        std::string const hash = ByteArrayToHexStr(Trinity::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(availableQuery.first)));
+        std::string const hash = GetHash(availableQuery.first, hashCache, usedHashCache, hashCacheChanged);
 
         UpdateMode mode = MODE_APPLY;
 
@@ -316,6 +385,10 @@ UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
             ++importedUpdates;
     }
 
+    // Also drops files that no longer exist or were skipped
+    if (hashCacheChanged || usedHashCache.size() != hashCache.size())
+        SaveHashCache(usedHashCache);
+
     // Cleanup up orphaned entries (if enabled)
     if (!applied.empty())
     {
@@ -55,7 +55,8 @@ public:
     UpdateFetcher(Path const& updateDirectory,
         std::function<void(std::string const&)> const& apply,
         std::function<void(Path const& path)> const& applyFile,
-        std::function<QueryResult(std::string const&)> const& retrieve);
+        std::function<QueryResult(std::string const&)> const& retrieve,
+        std::string const& hashCacheFile = "");
     ~UpdateFetcher();
 
     UpdateResult Update(bool const redundancyChecks, bool const allowRehash,
@@ -121,10 +122,19 @@ private:
         using is_transparent = int;
     };
 
+    // Hash of an update file, only valid as long as the file has this size and modification time
+    struct HashCacheEntry
+    {
+        uint64 size;
+        int64 lastWriteTime;
+        std::string hash;
+    };
+
     typedef std::set<LocaleFileEntry, PathCompare> LocaleFileStorage;
     typedef std::unordered_map<std::string, std::string> HashToFileNameStorage;
     typedef std::unordered_map<std::string, AppliedFileEntry> AppliedFileStorage;
     typedef std::vector<UpdateFetcher::DirectoryEntry> DirectoryStorage;
+    typedef std::unordered_map<std::string, HashCacheEntry> HashCacheStorage;
 
     LocaleFileStorage GetFileList() const;
     void FillFileListRecursively(Path const& path, LocaleFileStorage& storage,
@@ -135,6 +145,12 @@ private:
 
     std::string ReadSQLUpdate(Path const& file) const;
 
+    HashCacheStorage LoadHashCache() const;
+    void SaveHashCache(HashCacheStorage const& cache) const;
+    // Returns the cached hash of the file when it was not modified since, calculates it otherwise.
+    // All looked up files are added to usedCache.
+    std::string GetHash(Path const& file, HashCacheStorage const& cache, HashCacheStorage& usedCache, bool& changed) const;
+
     uint32 Apply(Path const& path) const;
 
     void UpdateEntry(AppliedFileEntry const& entry, uint32 const speed = 0) const;
@@ -148,6 +164,7 @@ private:
     std::function<void(std::string const&)> const _apply;
     std::function<void(Path const& path)> const _applyFile;
     std::function<QueryResult(std::string const&)> const _retrieve;
+    std::string const _hashCacheFile;
 };
 
 #endif // UpdateFetcher_h__
@@ -252,15 +252,13 @@ void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint3
     }
     else
     {
-        for (SmartScriptHolder& event : mEvents)
+        // SMART_EVENT_LINK events are not indexed, they are only processed by the event linking to them
+        auto events = std::ranges::equal_range(mEventIndexByType, uint32(e), {}, [&](uint32 index) { return mEvents[index].GetEventType(); });
+        for (uint32 index : events)
         {
-            SMART_EVENT eventType = SMART_EVENT(event.GetEventType());
-            if (eventType == SMART_EVENT_LINK)//special handling
-                continue;
-
-            if (eventType == e)
-                if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
-                    ProcessEvent(event, unit, var0, var1, bvar, spell, gob, varString);
+            SmartScriptHolder& event = mEvents[index];
+            if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
+                ProcessEvent(event, unit, var0, var1, bvar, spell, gob, varString);
         }
     }
 
@@ -295,6 +293,40 @@ struct MultiActionResult : Scripting::v2::ActionResult<void>
 };
 }
 
+namespace
+{
+// Takes a target list from the pool for the current scope (reusing its capacity) and returns it emptied
+class PooledObjectVector
+{
+public:
+    explicit PooledObjectVector(std::vector<ObjectVector>& pool) : _pool(pool)
+    {
+        if (!_pool.empty())
+        {
+            _vector = std::move(_pool.back());
+            _pool.pop_back();
+        }
+    }
+
+    ~PooledObjectVector()
+    {
+        _vector.clear();
+        _pool.push_back(std::move(_vector));
+    }
+
+    PooledObjectVector(PooledObjectVector const&) = delete;
+    PooledObjectVector(PooledObjectVector&&) = delete;
+    PooledObjectVector& operator=(PooledObjectVector const&) = delete;
+    PooledObjectVector& operator=(PooledObjectVector&&) = delete;
+
+    ObjectVector& operator*() { return _vector; }
+
+private:
+    std::vector<ObjectVector>& _pool;
+    ObjectVector _vector;
+};
+}
+
 void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob, std::string_view varString)
 {
     e.runOnce = true; //used for repeat check
@@ -315,7 +347,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     if (Unit* tempInvoker = GetLastInvoker())
         TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: Invoker: {} {}", tempInvoker->GetName(), tempInvoker->GetGUID());
 
-    ObjectVector targets;
+    PooledObjectVector targetList(mTargetListPool);
+    ObjectVector& targets = *targetList;
     GetTargets(targets, e, Coalesce<WorldObject>(unit, gob));
 
     switch (e.GetActionType())
@@ -1667,7 +1700,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            ObjectVector casters;
+            PooledObjectVector casterList(mTargetListPool);
+            ObjectVector& casters = *casterList;
             GetTargets(casters, CreateSmartEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, 0, 0, 0, SMART_ACTION_NONE, 0, 0, 0, 0, 0, 0, 0, (SMARTAI_TARGETS)e.action.crossCast.targetType, e.action.crossCast.targetParam1, e.action.crossCast.targetParam2, e.action.crossCast.targetParam3, e.action.crossCast.targetParam4, e.action.param_string, 0), unit);
 
             std::shared_ptr<MultiActionResult<SpellCastResult>> waitEvent = CreateTimedActionListWaitEventFor<void, MultiActionResult<SpellCastResult>>(e, casters.size()* targets.size());
@@ -2820,7 +2854,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 break;
             }
 
-            std::vector<Creature*> creatures;
+            std::vector<Creature*>& creatures = mCreatureSearchResult;
+            creatures.clear();
             ref->GetCreatureListWithOptionsInGrid(creatures, static_cast<float>(e.target.unitRange.maxDist), {
                 .CreatureId = e.target.unitRange.creature ? Optional<uint32>(e.target.unitRange.creature) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
@@ -2837,13 +2872,14 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<Creature*> creatures;
+            std::vector<Creature*>& creatures = mCreatureSearchResult;
+            creatures.clear();
             baseObject->GetCreatureListWithOptionsInGrid(creatures, static_cast<float>(e.target.unitDistance.dist), {
                 .CreatureId = e.target.unitDistance.creature ? Optional<uint32>(e.target.unitDistance.creature) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
             });
 
-            targets = { creatures.begin(), creatures.end() };
+            targets.assign(creatures.begin(), creatures.end());
 
             if (e.target.unitDistance.maxSize)
                 Trinity::Containers::RandomResize(targets, e.target.unitDistance.maxSize);
@@ -2862,7 +2898,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 break;
             }
 
-            std::vector<GameObject*> gameObjects;
+            std::vector<GameObject*>& gameObjects = mGameObjectSearchResult;
+            gameObjects.clear();
             ref->GetGameObjectListWithOptionsInGrid(gameObjects, static_cast<float>(e.target.goRange.maxDist), {
                 .GameObjectId = e.target.goRange.entry ? Optional<uint32>(e.target.goRange.entry) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
@@ -2879,13 +2916,14 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<GameObject*> gameObjects;
+            std::vector<GameObject*>& gameObjects = mGameObjectSearchResult;
+            gameObjects.clear();
             baseObject->GetGameObjectListWithOptionsInGrid(gameObjects, static_cast<float>(e.target.goDistance.dist), {
                 .GameObjectId = e.target.goDistance.entry ? Optional<uint32>(e.target.goDistance.entry) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
             });
 
-            targets = { gameObjects.begin(), gameObjects.end() };
+            targets.assign(gameObjects.begin(), gameObjects.end());
 
             if (e.target.goDistance.maxSize)
                 Trinity::Containers::RandomResize(targets, e.target.goDistance.maxSize);
@@ -2924,7 +2962,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<Player*> players;
+            std::vector<Player*>& players = mPlayerSearchResult;
+            players.clear();
             baseObject->GetPlayerListInGrid(players, static_cast<float>(e.target.playerRange.maxDist));
             std::ranges::copy_if(players, std::back_inserter(targets), [&](Player const* target) { return !baseObject->IsWithinDist(target, static_cast<float>(e.target.playerRange.minDist)); });
             break;
@@ -2934,9 +2973,10 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<Player*> players;
+            std::vector<Player*>& players = mPlayerSearchResult;
+            players.clear();
             baseObject->GetPlayerListInGrid(players, static_cast<float>(e.target.playerDistance.dist));
-            targets = { players.begin(), players.end() };
+            targets.assign(players.begin(), players.end());
             break;
         }
         case SMART_TARGET_STORED:
@@ -3559,7 +3599,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 case SMART_TARGET_PLAYER_RANGE:
                 case SMART_TARGET_PLAYER_DISTANCE:
                 {
-                    ObjectVector targets;
+                    PooledObjectVector targetList(mTargetListPool);
+                    ObjectVector& targets = *targetList;
                     GetTargets(targets, e);
 
                     auto unitTargetItr = std::ranges::find_if(targets, [this, &e](WorldObject* target)
@@ -3815,9 +3856,21 @@ void SmartScript::InstallEvents()
     {
         mEvents.insert(mEvents.end(), std::move_iterator(mInstallEvents.begin()), std::move_iterator(mInstallEvents.end()));
         mInstallEvents.clear();
+        BuildEventTypeIndex();
     }
 }
 
+void SmartScript::BuildEventTypeIndex()
+{
+    mEventIndexByType.clear();
+    mEventIndexByType.reserve(mEvents.size());
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+        if (mEvents[i].GetEventType() != SMART_EVENT_LINK)
+            mEventIndexByType.push_back(i);
+
+    std::ranges::stable_sort(mEventIndexByType, {}, [&](uint32 index) { return mEvents[index].GetEventType(); });
+}
+
 void SmartScript::RemoveStoredEvent(uint32 id)
 {
     if (!mStoredEvents.empty())
@@ -3887,6 +3940,7 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        BuildEventTypeIndex();
         mEventSortingRequired = false;
     }
 
@@ -4016,6 +4070,8 @@ void SmartScript::FillScript(SmartAIEventList&& e, WorldObject* obj, AreaTrigger
         mAllEventFlags |= scriptholder.event.event_flags;
         mEvents.push_back(std::move(scriptholder));
     }
+
+    BuildEventTypeIndex();
 }
 
 void SmartScript::GetScript()
@@ -113,6 +113,8 @@ class TC_GAME_API SmartScript
         void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
         SmartAIEventList mEvents;
+        // positions in mEvents ordered by event type, within a type events keep their mEvents (priority) order
+        std::vector<uint32> mEventIndexByType;
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         ObjectGuid mTimedActionListInvoker;
@@ -149,7 +151,15 @@ class TC_GAME_API SmartScript
 
         ObjectVectorMap _storedTargets;
 
+        // emptied target lists kept for reuse by ProcessAction, one per nesting level
+        std::vector<ObjectVector> mTargetListPool;
+        // scratch buffers for grid searches in GetTargets, results are copied out before any script code runs
+        mutable std::vector<Creature*> mCreatureSearchResult;
+        mutable std::vector<GameObject*> mGameObjectSearchResult;
+        mutable std::vector<Player*> mPlayerSearchResult;
+
         void InstallEvents();
+        void BuildEventTypeIndex();
 
         void RemoveStoredEvent(uint32 id);
 };
@@ -194,7 +194,8 @@ QueryCallback Battlenet::AccountMgr::GetIdByGameAccountAsync(uint32 gameAccountI
 {
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_ACCOUNT_ID_BY_GAME_ACCOUNT);
     stmt->setUInt32(0, gameAccountId);
-    return LoginDatabase.AsyncQuery(stmt);
+    // game accounts never move to another battle.net account
+    return LoginDatabase.AsyncReplicaQuery(stmt);
 }
 
 uint8 Battlenet::AccountMgr::GetMaxIndex(uint32 accountId)
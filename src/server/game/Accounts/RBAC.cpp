@@ -43,7 +43,7 @@ RBACPermission::~RBACPermission() = default;
 
 RBACData::RBACData(uint32 id, std::string const& name, int32 realmId, uint8 secLevel):
     _id(id), _name(name), _realmId(realmId), _secLevel(secLevel),
-    _grantedPerms(), _deniedPerms(), _globalPerms()
+    _grantedPerms(), _deniedPerms(), _globalPerms(), _globalPermsMask()
 {
 }
 
@@ -243,6 +243,10 @@ void RBACData::CalculateNewPermissions()
     RBACPermissionContainer revoked = GetDeniedPermissions();
     ExpandPermissions(revoked);
     RemovePermissions(_globalPerms, revoked);
+
+    _globalPermsMask.assign(_globalPerms.empty() ? 0 : *_globalPerms.rbegin() + 1, false);
+    for (uint32 permission : _globalPerms)
+        _globalPermsMask[permission] = true;
 }
 
 void RBACData::AddPermissions(RBACPermissionContainer const& permsFrom, RBACPermissionContainer& permsTo)
@@ -290,6 +294,7 @@ void RBACData::ClearData()
     _grantedPerms.clear();
     _deniedPerms.clear();
     _globalPerms.clear();
+    _globalPermsMask.clear();
 }
 
 }
@@ -45,6 +45,7 @@
 #include <string>
 #include <set>
 #include <map>
+#include <vector>
 
 namespace rbac
 {
@@ -840,7 +841,7 @@ class TC_GAME_API RBACData
          */
         bool HasPermission(uint32 permission) const
         {
-            return _globalPerms.contains(permission);
+            return permission < _globalPermsMask.size() && _globalPermsMask[permission];
         }
 
         // Functions enabled to be used by command system
@@ -1018,6 +1019,7 @@ class TC_GAME_API RBACData
         RBACPermissionContainer _grantedPerms;             ///> Granted permissions
         RBACPermissionContainer _deniedPerms;              ///> Denied permissions
         RBACPermissionContainer _globalPerms;              ///> Calculated permissions
+        std::vector<bool> _globalPermsMask;                ///> Calculated permissions indexed by permission id, for HasPermission
 };
 
 }
@@ -200,6 +200,28 @@ bool AchievementMgr::IsCompletedAchievement(AchievementEntry const* entry)
     return IsCompletedCriteriaTree(tree);
 }
 
+// Called after entry was earned, retires its criteria that are not part of any other unearned achievement
+void AchievementMgr::RetireCompletedCriteria(AchievementEntry const* entry)
+{
+    CriteriaTree const* tree = sCriteriaMgr->GetCriteriaTree(entry->CriteriaTree);
+    if (!tree)
+        return;
+
+    CriteriaMgr::WalkCriteriaTree(tree, [this](CriteriaTree const* node)
+    {
+        if (!node->Criteria || IsCriteriaRetired(node->Criteria->ID))
+            return;
+
+        // same conditions as CanUpdateCriteriaTree rejecting every tree of the criteria
+        if (CriteriaTreeList const* trees = sCriteriaMgr->GetCriteriaTreesByCriteria(node->Criteria->ID))
+            for (CriteriaTree const* criteriaTree : *trees)
+                if (criteriaTree->Achievement && !HasAchieved(criteriaTree->Achievement->ID))
+                    return;
+
+        RetireCriteria(node->Criteria->ID);
+    });
+}
+
 bool AchievementMgr::RequiredAchievementSatisfied(uint32 achievementId) const
 {
     return HasAchieved(achievementId);
@@ -270,6 +292,9 @@ void PlayerAchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, Pre
                         _owner->SetTitle(titleEntry);
 
         } while (achievementResult->NextRow());
+
+        for (auto const& [achievementId, _] : _completedAchievements)
+            RetireCompletedCriteria(sAchievementStore.AssertEntry(achievementId));
     }
 
     if (criteriaResult)
@@ -484,6 +509,7 @@ void PlayerAchievementMgr::CompletedAchievement(AchievementEntry const* achievem
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.Date = GameTime::GetGameTime();
     ca.Changed = true;
+    RetireCompletedCriteria(achievement);
 
     if (achievement->Flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
         sAchievementMgr->SetRealmCompleted(achievement);
@@ -753,6 +779,9 @@ void GuildAchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, Prep
 
             _achievementPoints += achievement->Points;
         } while (achievementResult->NextRow());
+
+        for (auto const& [achievementId, _] : _completedAchievements)
+            RetireCompletedCriteria(sAchievementStore.AssertEntry(achievementId));
     }
 
     if (criteriaResult)
@@ -954,6 +983,7 @@ void GuildAchievementMgr::CompletedAchievement(AchievementEntry const* achieveme
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.Date = GameTime::GetGameTime();
     ca.Changed = true;
+    RetireCompletedCriteria(achievement);
 
     if (achievement->Flags & ACHIEVEMENT_FLAG_SHOW_GUILD_MEMBERS)
     {
@@ -1361,7 +1391,7 @@ void AchievementGlobalMgr::LoadRewardLocales()
         }
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         AchievementRewardLocale& data = _achievementRewardLocales[id];
@@ -456,6 +456,7 @@ void CriteriaHandler::Reset()
         SendCriteriaProgressRemoved(criteriaprogress.first);
 
     _criteriaProgress.clear();
+    _retiredCriteria.clear();
 }
 
 /**
@@ -489,7 +490,8 @@ void CriteriaHandler::UpdateCriteria(CriteriaType type, uint64 miscValue1 /*= 0*
 
     CriteriaList const& criteriaList = GetCriteriaByType(type, uint32(miscValue1));
     for (Criteria const* criteria : criteriaList)
-        UpdateCriteria(criteria, miscValue1, miscValue2, miscValue3, ref, referencePlayer);
+        if (!IsCriteriaRetired(criteria->ID))
+            UpdateCriteria(criteria, miscValue1, miscValue2, miscValue3, ref, referencePlayer);
 }
 
 void CriteriaHandler::UpdateCriteria(Criteria const* criteria, uint64 miscValue1, uint64 miscValue2, uint64 miscValue3, WorldObject const* ref, Player* referencePlayer)
@@ -1074,6 +1076,14 @@ void CriteriaHandler::RemoveCriteriaProgress(Criteria const* criteria)
     criteriaProgress->second.Changed = true;
 }
 
+void CriteriaHandler::RetireCriteria(uint32 criteriaId)
+{
+    if (criteriaId >= _retiredCriteria.size())
+        _retiredCriteria.resize(criteriaId + 1);
+
+    _retiredCriteria[criteriaId] = true;
+}
+
 bool CriteriaHandler::IsCompletedCriteriaTree(CriteriaTree const* tree)
 {
     if (!CanCompleteCriteriaTree(tree))
@@ -311,8 +311,13 @@ protected:
     virtual std::string GetOwnerInfo() const = 0;
     virtual CriteriaList const& GetCriteriaByType(CriteriaType type, uint32 asset) const = 0;
 
+    // Retired criteria can never be updated again (every criteria tree using them is finished) and are skipped without evaluating any requirements
+    bool IsCriteriaRetired(uint32 criteriaId) const { return criteriaId < _retiredCriteria.size() && _retiredCriteria[criteriaId]; }
+    void RetireCriteria(uint32 criteriaId);
+
     CriteriaProgressMap _criteriaProgress;
     std::unordered_map<uint32 /*criteriaID*/, Milliseconds /*time left*/> _startedCriteria;
+    std::vector<bool> _retiredCriteria;
 };
 
 class TC_GAME_API CriteriaMgr
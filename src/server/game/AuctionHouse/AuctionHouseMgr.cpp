@@ -690,8 +690,9 @@ void AuctionHouseMgr::PendingAuctionProcess(Player* player)
         do
         {
             PendingAuctionInfo const& pendingAuction = *itrAH;
-            if (AuctionPosting* auction = GetAuctionsById(pendingAuction.AuctionHouseId)->GetAuction(pendingAuction.AuctionId))
-                auction->EndTime = GameTime::GetSystemTime();
+            AuctionHouseObject* auctionHouse = GetAuctionsById(pendingAuction.AuctionHouseId);
+            if (AuctionPosting* auction = auctionHouse->GetAuction(pendingAuction.AuctionId))
+                auctionHouse->SetAuctionEndTime(auction, GameTime::GetSystemTime());
 
             CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_AUCTION_EXPIRATION);
             stmt->setUInt32(0, uint32(GameTime::GetGameTime()));
@@ -733,8 +734,9 @@ void AuctionHouseMgr::UpdatePendingAuctions()
             CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
             for (PendingAuctionInfo const& pendingAuction : itr->second.Auctions)
             {
-                if (AuctionPosting* auction = GetAuctionsById(pendingAuction.AuctionHouseId)->GetAuction(pendingAuction.AuctionId))
-                    auction->EndTime = GameTime::GetSystemTime();
+                AuctionHouseObject* auctionHouse = GetAuctionsById(pendingAuction.AuctionHouseId);
+                if (AuctionPosting* auction = auctionHouse->GetAuction(pendingAuction.AuctionId))
+                    auctionHouse->SetAuctionEndTime(auction, GameTime::GetSystemTime());
 
                 CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_AUCTION_EXPIRATION);
                 stmt->setUInt32(0, uint32(GameTime::GetGameTime()));
@@ -749,10 +751,14 @@ void AuctionHouseMgr::UpdatePendingAuctions()
 
 void AuctionHouseMgr::Update()
 {
-    mHordeAuctions.Update();
-    mAllianceAuctions.Update();
-    mNeutralAuctions.Update();
-    mGoblinAuctions.Update();
+    // expiration of all auction houses is written in a single transaction
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    mHordeAuctions.Update(trans);
+    mAllianceAuctions.Update(trans);
+    mNeutralAuctions.Update(trans);
+    mGoblinAuctions.Update(trans);
+    if (trans->GetSize())
+        CharacterDatabase.CommitTransaction(trans);
 
     TimePoint now = GameTime::Now();
     if (now >= _playerThrottleObjectsCleanupTime)
@@ -853,6 +859,7 @@ void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionP
     AuctionsBucketKey key = AuctionsBucketKey::ForItem(auction.Items[0]);
     auto [bucketItr, isNew] = _buckets.try_emplace(key);
     AuctionsBucketData* bucket = &bucketItr->second;
+    _bucketSearchCache.clear();
     if (isNew)
     {
         // we don't have any item for this key yet, create new bucket
@@ -860,6 +867,8 @@ void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionP
 
         ItemTemplate const* itemTemplate = auction.Items[0]->GetTemplate();
         bucket->ItemClass = itemTemplate->GetClass();
+        bucket->ClassIndexSlot = _bucketsByClass[bucket->ItemClass].size();
+        _bucketsByClass[bucket->ItemClass].push_back(bucket);
         bucket->ItemSubClass = itemTemplate->GetSubClass();
         bucket->InventoryType = itemTemplate->GetInventoryType();
         bucket->RequiredLevel = auction.Items[0]->GetRequiredLevel();
@@ -980,6 +989,7 @@ void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionP
     for (ObjectGuid bidder : auction.BidderHistory)
         _playerBidderAuctions.emplace(bidder, auction.Id);
 
+    _auctionsByEndTime.emplace(auction.EndTime, auction.Id);
     AuctionPosting* addedAuction = &(_itemsByAuctionId[auction.Id] = std::move(auction));
 
     WorldPackets::AuctionHouse::AuctionSortDef priceSort{ AuctionHouseSortOrder::Price, false };
@@ -993,6 +1003,8 @@ std::map<uint32, AuctionPosting>::node_type AuctionHouseObject::RemoveAuction(Ch
     std::map<uint32, AuctionPosting>::iterator* auctionItr /*= nullptr*/)
 {
     AuctionsBucketData* bucket = auction->Bucket;
+    _bucketSearchCache.clear();
+    _auctionsByEndTime.erase({ auction->EndTime, auction->Id });
 
     std::erase(bucket->Auctions, auction);
     if (!bucket->Auctions.empty())
@@ -1051,6 +1063,12 @@ std::map<uint32, AuctionPosting>::node_type AuctionHouseObject::RemoveAuction(Ch
     else
     {
         auction->Bucket = nullptr;
+
+        std::vector<AuctionsBucketData*>& classBuckets = _bucketsByClass[bucket->ItemClass];
+        classBuckets[bucket->ClassIndexSlot] = classBuckets.back();
+        classBuckets[bucket->ClassIndexSlot]->ClassIndexSlot = bucket->ClassIndexSlot;
+        classBuckets.pop_back();
+
         _buckets.erase(bucket->Key);
     }
 
@@ -1073,10 +1091,20 @@ std::map<uint32, AuctionPosting>::node_type AuctionHouseObject::RemoveAuction(Ch
         return _itemsByAuctionId.extract(auction->Id);
 }
 
-void AuctionHouseObject::Update()
+void AuctionHouseObject::SetAuctionEndTime(AuctionPosting* auction, SystemTimePoint endTime)
+{
+    _auctionsByEndTime.erase({ auction->EndTime, auction->Id });
+    auction->EndTime = endTime;
+    _auctionsByEndTime.emplace(auction->EndTime, auction->Id);
+}
+
+void AuctionHouseObject::Update(CharacterDatabaseTransaction trans)
 {
     SystemTimePoint curTime = GameTime::GetSystemTime();
     TimePoint curTimeSteady = GameTime::Now();
+    // minimum prices and quantities shown in cached results are refreshed once per update
+    _bucketSearchCache.clear();
+
     ///- Handle expired auctions
 
     // Clear expired throttled players
@@ -1096,23 +1124,11 @@ void AuctionHouseObject::Update()
             ++itr;
     }
 
-    if (_itemsByAuctionId.empty())
-        return;
-
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-
-    for (auto it = _itemsByAuctionId.begin(); it != _itemsByAuctionId.end();)
+    // only visit auctions expired on next update
+    while (!_auctionsByEndTime.empty() && _auctionsByEndTime.begin()->first <= curTime + 1min)
     {
-        AuctionPosting* auction = &it->second;
-        ///- filter auctions expired on next update
-        if (auction->EndTime > curTime + 1min)
-        {
-            ++it;
-            continue;
-        }
-
-        std::map<uint32, AuctionPosting>::node_type removedAuctionNode = RemoveAuction(trans, auction, &it);
-        auction = &removedAuctionNode.mapped();
+        std::map<uint32, AuctionPosting>::node_type removedAuctionNode = RemoveAuction(trans, &_itemsByAuctionId.at(_auctionsByEndTime.begin()->second));
+        AuctionPosting* auction = &removedAuctionNode.mapped();
 
         ///- Either cancel the auction if there was no bidder
         if (auction->Bidder.IsEmpty())
@@ -1131,16 +1147,63 @@ void AuctionHouseObject::Update()
             SendAuctionWon(auction, nullptr, trans);
         }
     }
+}
 
-    // Run DB changes
-    CharacterDatabase.CommitTransaction(trans);
+namespace
+{
+// cached browse results are dropped at once when this many were collected since auctions last changed
+constexpr std::size_t MAX_BUCKET_SEARCH_CACHE_SIZE = 1024;
+
+std::string BuildBucketSearchCacheKey(LocaleConstant locale, std::wstring const& name, uint8 minLevel, uint8 maxLevel, EnumFlag<AuctionHouseFilterMask> filters,
+    Optional<AuctionSearchClassFilters> const& classFilters, uint32 offset, std::span<WorldPackets::AuctionHouse::AuctionSortDef const> sorts)
+{
+    std::string key;
+    auto append = [&key](auto value)
+    {
+        key.append(reinterpret_cast<char const*>(&value), sizeof(value));
+    };
+
+    append(uint8(locale));
+    append(minLevel);
+    append(maxLevel);
+    append(filters.AsUnderlyingType());
+    append(offset);
+    append(uint8(sorts.size()));
+    for (WorldPackets::AuctionHouse::AuctionSortDef const& sort : sorts)
+    {
+        append(uint8(sort.SortOrder));
+        append(sort.ReverseSort);
+    }
+
+    append(classFilters.has_value());
+    if (classFilters)
+    {
+        for (uint32 itemClass = 0; itemClass < MAX_ITEM_CLASS; ++itemClass)
+        {
+            AuctionSearchClassFilters::SubclassFilter const& subclassFilter = classFilters->Classes[itemClass];
+            if (subclassFilter.SubclassMask == AuctionSearchClassFilters::FILTER_SKIP_CLASS)
+                continue;
+
+            append(uint8(itemClass));
+            append(subclassFilter.SubclassMask);
+            if (subclassFilter.SubclassMask != AuctionSearchClassFilters::FILTER_SKIP_SUBCLASS)
+                for (uint32 itemSubClass = 0; itemSubClass < MAX_ITEM_SUBCLASS_TOTAL; ++itemSubClass)
+                    if (subclassFilter.SubclassMask & (1 << itemSubClass))
+                        append(subclassFilter.InvTypes[itemSubClass]);
+        }
+    }
+
+    // name last, its length is not stored
+    key.append(reinterpret_cast<char const*>(name.data()), name.size() * sizeof(wchar_t));
+    return key;
+}
 }
 
 void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionListBucketsResult& listBucketsResult, Player const* player,
     std::wstring const& name, uint8 minLevel, uint8 maxLevel, EnumFlag<AuctionHouseFilterMask> filters, Optional<AuctionSearchClassFilters> const& classFilters,
     std::span<uint8 const> knownPetBits, uint8 maxKnownPetLevel, uint32 offset, std::span<WorldPackets::AuctionHouse::AuctionSortDef const> sorts) const
 {
-    std::unordered_set<uint32> knownAppearanceIds;
+    boost::dynamic_bitset<uint32> knownAppearanceIds;
     boost::dynamic_bitset<uint8> knownPetSpecies;
     // prepare uncollected filter for more efficient searches
     if (filters.HasFlag(AuctionHouseFilterMask::UncollectedOnly))
@@ -1151,31 +1214,50 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
             knownPetSpecies.resize(sBattlePetSpeciesStore.GetNumRows());
     }
 
+    std::string cacheKey;
+    // uncollected and usable filters depend on the searching player
+    bool const cacheable = !filters.HasFlag(AuctionHouseFilterMask::UncollectedOnly) && !filters.HasFlag(AuctionHouseFilterMask::UsableOnly);
+    if (cacheable)
+    {
+        cacheKey = BuildBucketSearchCacheKey(player->GetSession()->GetSessionDbcLocale(), name, minLevel, maxLevel, filters, classFilters, offset, sorts);
+        if (BucketSearchResult const* cachedResult = Trinity::Containers::MapGetValuePtr(_bucketSearchCache, cacheKey))
+        {
+            for (AuctionsBucketData const* resultBucket : cachedResult->Buckets)
+            {
+                listBucketsResult.Buckets.emplace_back();
+                WorldPackets::AuctionHouse::BucketInfo& bucketInfo = listBucketsResult.Buckets.back();
+                resultBucket->BuildBucketInfo(&bucketInfo, player);
+            }
+
+            listBucketsResult.HasMoreResults = cachedResult->HasMoreResults;
+            return;
+        }
+    }
+
     AuctionsResultBuilder<AuctionsBucketData> builder(offset, player->GetSession()->GetSessionDbcLocale(), sorts, AuctionHouseResultLimits::Browse);
 
-    for (std::pair<AuctionsBucketKey const, AuctionsBucketData> const& bucket : _buckets)
+    auto addIfMatching = [&](AuctionsBucketData const* bucketData)
     {
-        AuctionsBucketData const* bucketData = &bucket.second;
         if (!name.empty())
         {
             if (filters.HasFlag(AuctionHouseFilterMask::ExactMatch))
             {
                 if (bucketData->FullName[player->GetSession()->GetSessionDbcLocale()] != name)
-                    continue;
+                    return;
             }
             else
                 if (bucketData->FullName[player->GetSession()->GetSessionDbcLocale()].find(name) == std::wstring::npos)
-                    continue;
+                    return;
         }
 
         if (minLevel && bucketData->RequiredLevel < minLevel)
-            continue;
+            return;
 
         if (maxLevel && bucketData->RequiredLevel > maxLevel)
-            continue;
+            return;
 
         if (!filters.HasFlag(bucketData->QualityMask))
-            continue;
+            return;
 
         if (classFilters)
         {
@@ -1184,15 +1266,15 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
             // if we want this class and did not specify and subclasses, its set to FILTER_SKIP_SUBCLASS
             // otherwise full restrictions apply
             if (classFilters->Classes[bucketData->ItemClass].SubclassMask == AuctionSearchClassFilters::FILTER_SKIP_CLASS)
-                continue;
+                return;
 
             if (classFilters->Classes[bucketData->ItemClass].SubclassMask != AuctionSearchClassFilters::FILTER_SKIP_SUBCLASS)
             {
                 if (!(classFilters->Classes[bucketData->ItemClass].SubclassMask & (1 << bucketData->ItemSubClass)))
-                    continue;
+                    return;
 
                 if (!(classFilters->Classes[bucketData->ItemClass].InvTypes[bucketData->ItemSubClass] & (UI64LIT(1) << bucketData->InventoryType)))
-                    continue;
+                    return;
             }
         }
 
@@ -1206,7 +1288,7 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
                 {
                     if (ItemModifiedAppearanceEntry const* itemModifiedAppearance = sItemModifiedAppearanceStore.LookupEntry(bucketAppearance.first))
                     {
-                        if (!knownAppearanceIds.contains(itemModifiedAppearance->ItemAppearanceID))
+                        if (itemModifiedAppearance->ItemAppearanceID >= knownAppearanceIds.size() || !knownAppearanceIds.test(itemModifiedAppearance->ItemAppearanceID))
                         {
                             hasAll = false;
                             break;
@@ -1215,34 +1297,34 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
                 }
 
                 if (hasAll)
-                    continue;
+                    return;
             }
             // caged pets
-            else if (bucket.first.BattlePetSpeciesId)
+            else if (bucketData->Key.BattlePetSpeciesId)
             {
-                if (knownPetSpecies.test(bucket.first.BattlePetSpeciesId))
-                    continue;
+                if (knownPetSpecies.test(bucketData->Key.BattlePetSpeciesId))
+                    return;
             }
             // toys
-            else if (sDB2Manager.IsToyItem(bucket.first.ItemId))
+            else if (sDB2Manager.IsToyItem(bucketData->Key.ItemId))
             {
-                if (player->GetSession()->GetCollectionMgr()->HasToy(bucket.first.ItemId))
-                    continue;
+                if (player->GetSession()->GetCollectionMgr()->HasToy(bucketData->Key.ItemId))
+                    return;
             }
             // mounts
             // recipes
             // pet items
             else if (bucketData->ItemClass == ITEM_CLASS_CONSUMABLE || bucketData->ItemClass == ITEM_CLASS_RECIPE || bucketData->ItemClass == ITEM_CLASS_MISCELLANEOUS)
             {
-                ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucket.first.ItemId));
+                ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucketData->Key.ItemId));
                 if (itemTemplate->Effects.size() >= 2 && (itemTemplate->Effects[0]->SpellID == 483 || itemTemplate->Effects[0]->SpellID == 55884))
                 {
                     if (player->HasSpell(itemTemplate->Effects[1]->SpellID))
-                        continue;
+                        return;
 
                     if (BattlePetSpeciesEntry const* battlePetSpecies = BattlePets::BattlePetMgr::GetBattlePetSpeciesBySpell(itemTemplate->Effects[1]->SpellID))
                         if (knownPetSpecies.test(battlePetSpecies->ID))
-                            continue;
+                            return;
                 }
             }
         }
@@ -1250,21 +1332,21 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
         if (filters.HasFlag(AuctionHouseFilterMask::UsableOnly))
         {
             if (bucketData->RequiredLevel && player->GetLevel() < bucketData->RequiredLevel)
-                continue;
+                return;
 
-            if (player->CanUseItem(sObjectMgr->GetItemTemplate(bucket.first.ItemId), true) != EQUIP_ERR_OK)
-                continue;
+            if (player->CanUseItem(sObjectMgr->GetItemTemplate(bucketData->Key.ItemId), true) != EQUIP_ERR_OK)
+                return;
 
             // cannot learn caged pets whose level exceeds highest level of currently owned pet
             if (bucketData->MinBattlePetLevel && bucketData->MinBattlePetLevel > maxKnownPetLevel)
-                continue;
+                return;
         }
 
         if (filters.HasFlag(AuctionHouseFilterMask::CurrentExpansionOnly))
         {
-            ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucket.first.ItemId));
+            ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucketData->Key.ItemId));
             if (itemTemplate->GetRequiredExpansion() != sWorld->getIntConfig(CONFIG_EXPANSION))
-                continue;
+                return;
         }
 
         // TODO: this one needs to access loot history to know highest item level for every inventory type
@@ -1273,6 +1355,30 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
         //}
 
         builder.AddItem(bucketData);
+    };
+
+    if (classFilters)
+    {
+        // only visit buckets of requested item classes
+        for (uint32 itemClass = 0; itemClass < MAX_ITEM_CLASS; ++itemClass)
+            if (classFilters->Classes[itemClass].SubclassMask != AuctionSearchClassFilters::FILTER_SKIP_CLASS)
+                for (AuctionsBucketData const* bucketData : _bucketsByClass[itemClass])
+                    addIfMatching(bucketData);
+    }
+    else
+    {
+        for (std::pair<AuctionsBucketKey const, AuctionsBucketData> const& bucket : _buckets)
+            addIfMatching(&bucket.second);
+    }
+
+    BucketSearchResult* result = nullptr;
+    if (cacheable)
+    {
+        if (_bucketSearchCache.size() >= MAX_BUCKET_SEARCH_CACHE_SIZE)
+            _bucketSearchCache.clear();
+
+        result = &_bucketSearchCache[std::move(cacheKey)];
+        result->HasMoreResults = builder.HasMoreResults();
     }
 
     for (AuctionsBucketData const* resultBucket : builder.GetResultRange())
@@ -1280,6 +1386,8 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
         listBucketsResult.Buckets.emplace_back();
         WorldPackets::AuctionHouse::BucketInfo& bucketInfo = listBucketsResult.Buckets.back();
         resultBucket->BuildBucketInfo(&bucketInfo, player);
+        if (result)
+            result->Buckets.push_back(resultBucket);
     }
 
     listBucketsResult.HasMoreResults = builder.HasMoreResults();
@@ -1433,24 +1541,48 @@ void AuctionHouseObject::BuildReplicate(WorldPackets::AuctionHouse::AuctionRepli
         throttleItr->second.Global = sAuctionMgr->GenerateReplicationId();
     }
 
-    if (_itemsByAuctionId.empty() || !count)
+    UpdateReplicateSnapshot(curTime);
+
+    if (_replicateSnapshot.AuctionIds.empty() || !count)
         return;
 
-    auto itr = _itemsByAuctionId.upper_bound(cursor);
-    for (; itr != _itemsByAuctionId.end(); ++itr)
-    {
-        AuctionPosting const& auction = itr->second;
+    // pages are sliced out of the shared snapshot, SerializedItems stays valid until the next call
+    std::size_t first = std::ranges::upper_bound(_replicateSnapshot.AuctionIds, cursor) - _replicateSnapshot.AuctionIds.begin();
+    std::size_t last = first + std::min<std::size_t>(count, _replicateSnapshot.AuctionIds.size() - first);
+    count -= last - first;
 
-        replicateResponse.Items.emplace_back();
-        WorldPackets::AuctionHouse::AuctionItem& auctionItem = replicateResponse.Items.back();
+    replicateResponse.SerializedItems = std::span(_replicateSnapshot.Data).subspan(_replicateSnapshot.Offsets[first], _replicateSnapshot.Offsets[last] - _replicateSnapshot.Offsets[first]);
+    replicateResponse.SerializedItemCount = last - first;
+    replicateResponse.ChangeNumberGlobal = throttleItr->second.Global;
+    replicateResponse.ChangeNumberCursor = throttleItr->second.Cursor = last != first ? _replicateSnapshot.AuctionIds[last - 1] : 0;
+    replicateResponse.ChangeNumberTombstone = throttleItr->second.Tombstone = !count ? _replicateSnapshot.AuctionIds.back() : 0;
+}
+
+void AuctionHouseObject::UpdateReplicateSnapshot(TimePoint curTime)
+{
+    if (curTime < _replicateSnapshot.BuildTime + Seconds(sWorld->getIntConfig(CONFIG_AUCTION_REPLICATE_SNAPSHOT_INTERVAL)))
+        return;
+
+    _replicateSnapshot.BuildTime = curTime;
+    _replicateSnapshot.AuctionIds.clear();
+    _replicateSnapshot.Offsets.clear();
+    _replicateSnapshot.Data.clear();
+
+    // reuse storage of previous snapshot
+    ByteBuffer data(std::move(_replicateSnapshot.Data));
+    for (auto const& [auctionId, auction] : _itemsByAuctionId)
+    {
+        WorldPackets::AuctionHouse::AuctionItem auctionItem;
         auction.BuildAuctionItem(&auctionItem, false, true, true, auction.Bidder.IsEmpty());
-        if (!--count)
-            break;
+
+        _replicateSnapshot.AuctionIds.push_back(auctionId);
+        _replicateSnapshot.Offsets.push_back(data.wpos());
+        data << auctionItem;
+        data.FlushBits();
     }
 
-    replicateResponse.ChangeNumberGlobal = throttleItr->second.Global;
-    replicateResponse.ChangeNumberCursor = throttleItr->second.Cursor = !replicateResponse.Items.empty() ? replicateResponse.Items.back().AuctionID : 0;
-    replicateResponse.ChangeNumberTombstone = throttleItr->second.Tombstone = !count ? _itemsByAuctionId.rbegin()->first : 0;
+    _replicateSnapshot.Offsets.push_back(data.wpos());
+    _replicateSnapshot.Data = std::move(data).Release();
 }
 
 uint64 AuctionHouseObject::CalculateAuctionHouseCut(uint64 bidAmount) const
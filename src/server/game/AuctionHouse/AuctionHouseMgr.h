@@ -25,9 +25,13 @@
 #include "ItemTemplate.h"
 #include "ObjectGuid.h"
 #include "Optional.h"
+#include <array>
 #include <map>
+#include <set>
 #include <span>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 class Item;
 class Player;
@@ -204,6 +208,7 @@ struct AuctionsBucketData
     uint8 MinBattlePetLevel = 0;
     uint8 MaxBattlePetLevel = 0;
     std::array<std::wstring, TOTAL_LOCALES> FullName = { };
+    std::size_t ClassIndexSlot = 0; // position in AuctionHouseObject::_bucketsByClass
 
     std::vector<AuctionPosting*> Auctions;
 
@@ -295,7 +300,10 @@ public:
     std::map<uint32, AuctionPosting>::node_type RemoveAuction(CharacterDatabaseTransaction trans, AuctionPosting* auction,
         std::map<uint32, AuctionPosting>::iterator* auctionItr = nullptr);
 
-    void Update();
+    // must be used instead of modifying AuctionPosting::EndTime directly for auctions added to this auction house
+    void SetAuctionEndTime(AuctionPosting* auction, SystemTimePoint endTime);
+
+    void Update(CharacterDatabaseTransaction trans);
 
     void BuildListBuckets(WorldPackets::AuctionHouse::AuctionListBucketsResult& listBucketsResult, Player const* player,
         std::wstring const& name, uint8 minLevel, uint8 maxLevel, EnumFlag<AuctionHouseFilterMask> filters, Optional<AuctionSearchClassFilters> const& classFilters,
@@ -333,8 +341,19 @@ private:
     AuctionHouseEntry const* _auctionHouse;
 
     std::map<uint32, AuctionPosting> _itemsByAuctionId; // ordered for replicate
+    std::set<std::pair<SystemTimePoint, uint32>> _auctionsByEndTime; // expiry index
     std::unordered_map<uint32, AuctionPosting> _soldItemsById;
     std::map<AuctionsBucketKey, AuctionsBucketData> _buckets; // ordered for search by itemid only
+    std::array<std::vector<AuctionsBucketData*>, MAX_ITEM_CLASS> _bucketsByClass;
+
+    struct BucketSearchResult
+    {
+        std::vector<AuctionsBucketData const*> Buckets;
+        bool HasMoreResults = false;
+    };
+
+    // browse results for searches not depending on searching player, dropped whenever buckets change
+    mutable std::unordered_map<std::string, BucketSearchResult> _bucketSearchCache;
     std::unordered_map<ObjectGuid, CommodityQuote> _commodityQuotes;
 
     std::unordered_multimap<ObjectGuid, uint32> _playerOwnedAuctions;
@@ -343,6 +362,19 @@ private:
     // Map of throttled players for GetAll, and throttle expiry time
     // Stored here, rather than player object to maintain persistence after logout
     std::unordered_map<ObjectGuid, PlayerReplicateThrottleData> _replicateThrottleMap;
+
+    // Serialized replicate response items shared by all players scanning this auction house
+    struct ReplicateSnapshot
+    {
+        TimePoint BuildTime = TimePoint::min();
+        std::vector<uint32> AuctionIds;
+        std::vector<std::size_t> Offsets; // start of each auction in Data, followed by end of data
+        std::vector<uint8> Data;
+    };
+
+    void UpdateReplicateSnapshot(TimePoint curTime);
+
+    ReplicateSnapshot _replicateSnapshot;
 };
 
 class TC_GAME_API AuctionHouseMgr
@@ -28,6 +28,7 @@
 #include "Log.h"
 #include "MapManager.h"
 #include "MapUtils.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "SharedDefines.h"
@@ -124,9 +125,11 @@ void BattlegroundMgr::Update(uint32 diff)
     // update scheduled queues
     if (!m_QueueUpdateScheduler.empty())
     {
+        TC_METRIC_TIMER("battleground_queue_update_time", TC_METRIC_TAG("type", "Scheduled"));
         std::vector<ScheduledQueueUpdate> scheduled;
         std::swap(scheduled, m_QueueUpdateScheduler);
 
+        TC_METRIC_VALUE("battleground_queue_updates", uint64(scheduled.size()), TC_METRIC_TAG("type", "Scheduled"));
         for (auto& [arenaMMRating, bgQueueTypeId, bracket_id] : scheduled)
             GetBattlegroundQueue(bgQueueTypeId).BattlegroundQueueUpdate(diff, bracket_id, arenaMMRating);
     }
@@ -139,13 +142,25 @@ void BattlegroundMgr::Update(uint32 diff)
         {
             // forced update for rated arenas (scan all, but skipped non rated)
             TC_LOG_TRACE("bg.arena", "BattlegroundMgr: UPDATING ARENA QUEUES");
+            TC_METRIC_TIMER("battleground_queue_update_time", TC_METRIC_TAG("type", "Rated arena"));
+            uint64 updatedBrackets = 0;
             for (uint8 teamSize : { ARENA_TYPE_2v2, ARENA_TYPE_3v3, ARENA_TYPE_5v5 })
             {
                 BattlegroundQueueTypeId ratedArenaQueueId = BGQueueTypeId(BATTLEGROUND_AA, BattlegroundQueueIdType::Arena, true, teamSize);
+                BattlegroundQueue& ratedArenaQueue = GetBattlegroundQueue(ratedArenaQueueId);
                 for (int bracket = BG_BRACKET_ID_FIRST; bracket < MAX_BATTLEGROUND_BRACKETS; ++bracket)
-                    GetBattlegroundQueue(ratedArenaQueueId).BattlegroundQueueUpdate(diff, BattlegroundBracketId(bracket), 0);
+                {
+                    // brackets without changes since their last evaluation cannot produce a new match
+                    if (!ratedArenaQueue.IsRatedArenaUpdateNeeded(BattlegroundBracketId(bracket)))
+                        continue;
+
+                    ratedArenaQueue.BattlegroundQueueUpdate(diff, BattlegroundBracketId(bracket), 0);
+                    ++updatedBrackets;
+                }
             }
 
+            TC_METRIC_VALUE("battleground_queue_updates", updatedBrackets, TC_METRIC_TAG("type", "Rated arena"));
+
             m_NextRatedArenaUpdate = sWorld->getIntConfig(CONFIG_ARENA_RATED_UPDATE_TIMER);
         }
         else
@@ -36,6 +36,12 @@
 
 BattlegroundQueue::BattlegroundQueue(BattlegroundQueueTypeId queueId) : m_queueId(queueId)
 {
+    for (uint32 i = 0; i < MAX_BATTLEGROUND_BRACKETS; ++i)
+    {
+        m_RatedArenaUpdateNeeded[i] = true;
+        m_NextRatingDiscardTime[i] = 0;
+    }
+
     for (uint32 i = 0; i < PVP_TEAMS_COUNT; ++i)
     {
         for (uint32 j = 0; j < MAX_BATTLEGROUND_BRACKETS; ++j)
@@ -189,6 +195,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player const* leader, Group const* g
     //add GroupInfo to m_QueuedGroups
     {
         m_QueuedGroups[bracketId][index].push_back(ginfo);
+        m_RatedArenaUpdateNeeded[bracketId] = true;
 
         //announce to world, this code needs mutex
         if (!m_queueId.Rated && !isPremade && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
@@ -372,6 +379,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     if (group->Players.empty())
     {
         m_QueuedGroups[bracket_id][index].erase(group_itr);
+        m_RatedArenaUpdateNeeded[bracket_id] = true;
         delete group;
         return;
     }
@@ -878,6 +886,20 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundBra
         // 0 is on (automatic update call) and we must set it to team's with longest wait time
         if (!arenaRating)
         {
+            // this evaluation covers all changes so far, next one is only needed when a team stops being limited by rating difference
+            m_RatedArenaUpdateNeeded[bracket_id] = false;
+            m_NextRatingDiscardTime[bracket_id] = 0;
+            uint32 now = GameTime::GetGameTimeMS();
+            for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
+            {
+                for (GroupQueueInfo const* queuedTeam : m_QueuedGroups[bracket_id][i])
+                {
+                    uint32 discardTime = queuedTeam->JoinTime + sBattlegroundMgr->GetRatingDiscardTimer();
+                    if (discardTime > now && (!m_NextRatingDiscardTime[bracket_id] || discardTime < m_NextRatingDiscardTime[bracket_id]))
+                        m_NextRatingDiscardTime[bracket_id] = discardTime;
+                }
+            }
+
             GroupQueueInfo* front1 = nullptr;
             GroupQueueInfo* front2 = nullptr;
             if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty())
@@ -992,10 +1014,24 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundBra
 
             TC_LOG_DEBUG("bg.battleground", "Starting rated arena match!");
             arena->StartBattleground();
+
+            // remaining teams may be able to form another match
+            m_RatedArenaUpdateNeeded[bracket_id] = true;
         }
     }
 }
 
+bool BattlegroundQueue::IsRatedArenaUpdateNeeded(BattlegroundBracketId bracket_id) const
+{
+    if (m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty() && m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
+        return false;
+
+    if (m_RatedArenaUpdateNeeded[bracket_id])
+        return true;
+
+    return m_NextRatingDiscardTime[bracket_id] && m_NextRatingDiscardTime[bracket_id] <= GameTime::GetGameTimeMS();
+}
+
 /*********************************************************/
 /***            BATTLEGROUND QUEUE EVENTS              ***/
 /*********************************************************/
@@ -72,6 +72,7 @@ class TC_GAME_API BattlegroundQueue
         ~BattlegroundQueue();
 
         void BattlegroundQueueUpdate(uint32 diff, BattlegroundBracketId bracket_id, uint32 minRating = 0);
+        bool IsRatedArenaUpdateNeeded(BattlegroundBracketId bracket_id) const;
         void UpdateEvents(uint32 diff);
 
         void FillPlayersToBG(Battleground* bg, BattlegroundBracketId bracket_id);
@@ -131,6 +132,10 @@ class TC_GAME_API BattlegroundQueue
         uint32 m_WaitTimeLastPlayer[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
         uint32 m_SumOfWaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
+        // periodic rated arena updates only evaluate brackets that changed since their last full evaluation
+        bool m_RatedArenaUpdateNeeded[MAX_BATTLEGROUND_BRACKETS];
+        uint32 m_NextRatingDiscardTime[MAX_BATTLEGROUND_BRACKETS]; // when next queued team stops being limited by rating difference, 0 if none
+
         // Event handler
         EventProcessor m_events;
 };
@@ -23,12 +23,32 @@
 #include "Player.h"
 #include "Timer.h"
 #include "World.h"
+#include <string_view>
 #include <unordered_map>
 
 namespace
 {
     std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    // keys point into CharacterCacheEntry::Name of the mapped entry, entries must be removed before their name is changed or they are destroyed
+    std::unordered_map<std::string_view, CharacterCacheEntry*> _characterCacheByNameStore;
+
+    void AddToNameStore(CharacterCacheEntry& data)
+    {
+        // a previous owner of this name that was not removed keeps its own key storage, repoint it to this entry's string
+        auto [itr, inserted] = _characterCacheByNameStore.try_emplace(data.Name, &data);
+        if (!inserted)
+        {
+            _characterCacheByNameStore.erase(itr);
+            _characterCacheByNameStore.emplace(data.Name, &data);
+        }
+    }
+
+    void RemoveFromNameStore(CharacterCacheEntry const& data)
+    {
+        auto itr = _characterCacheByNameStore.find(data.Name);
+        if (itr != _characterCacheByNameStore.end() && itr->second == &data)
+            _characterCacheByNameStore.erase(itr);
+    }
 }
 
 CharacterCache::CharacterCache()
@@ -68,6 +88,7 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
+    _characterCacheByNameStore.clear();
     _characterCacheStore.clear();
     uint32 oldMSTime = getMSTime();
 
@@ -78,6 +99,9 @@ void CharacterCache::LoadCharacterCacheStorage()
         return;
     }
 
+    _characterCacheStore.reserve(result->GetRowCount());
+    _characterCacheByNameStore.reserve(result->GetRowCount());
+
     do
     {
         Field* fields = result->Fetch();
@@ -94,6 +118,9 @@ Modifying functions
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level, bool isDeleted)
 {
     CharacterCacheEntry& data = _characterCacheStore[guid];
+    if (!data.Guid.IsEmpty() && !data.IsDeleted)
+        RemoveFromNameStore(data);
+
     data.Guid = guid;
     data.Name = name;
     data.AccountId = accountId;
@@ -108,13 +135,22 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accou
 
     // Fill Name to Guid Store
     if (!isDeleted)
-        _characterCacheByNameStore[name] = &data;
+        AddToNameStore(data);
 }
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    auto itr = _characterCacheStore.find(guid);
+    if (itr == _characterCacheStore.end())
+    {
+        _characterCacheByNameStore.erase(name);
+        return;
+    }
+
+    if (!itr->second.IsDeleted)
+        RemoveFromNameStore(itr->second);
+
+    _characterCacheStore.erase(itr);
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
@@ -123,7 +159,9 @@ void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string con
     if (itr == _characterCacheStore.end())
         return;
 
-    std::string oldName = itr->second.Name;
+    if (!itr->second.IsDeleted)
+        RemoveFromNameStore(itr->second);
+
     itr->second.Name = name;
 
     if (gender)
@@ -137,8 +175,8 @@ void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string con
     sWorld->SendGlobalMessage(invalidatePlayer.Write());
 
     // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    if (!itr->second.IsDeleted)
+        AddToNameStore(itr->second);
 }
 
 void CharacterCache::UpdateCharacterGender(ObjectGuid const& guid, uint8 gender)
@@ -193,13 +231,14 @@ void CharacterCache::UpdateCharacterInfoDeleted(ObjectGuid const& guid, bool del
     if (itr == _characterCacheStore.end())
         return;
 
-    if (deleted)
-        _characterCacheByNameStore.erase(itr->second.Name);
-    else
-        _characterCacheByNameStore[name] = &itr->second;
+    if (!itr->second.IsDeleted)
+        RemoveFromNameStore(itr->second);
 
     itr->second.Name = name;
     itr->second.IsDeleted = deleted;
+
+    if (!deleted)
+        AddToNameStore(itr->second);
 }
 
 /*
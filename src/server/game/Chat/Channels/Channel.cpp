@@ -213,6 +213,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
 
     PlayerInfo& playerInfo = _playersStore[guid];
     playerInfo.SetInvisible(!player->isGMVisible());
+    AddMember(player, playerInfo);
 
     /*
     YouJoinedAppend appender;
@@ -296,6 +297,7 @@ void Channel::LeaveChannel(Player* player, bool send, bool suspend)
 
     PlayerInfo& info = _playersStore.at(guid);
     bool changeowner = info.IsOwner();
+    RemoveMember(info);
     _playersStore.erase(guid);
 
     if (_announceEnabled && !player->GetSession()->HasPermission(rbac::RBAC_PERM_SILENTLY_JOIN_CHANNEL))
@@ -395,6 +397,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
         SendToAll(builder);
     }
 
+    RemoveMember(_playersStore.at(victim));
     _playersStore.erase(victim);
     bad->LeftChannel(this);
 
@@ -984,26 +987,64 @@ void Channel::SetMute(ObjectGuid const& guid, bool set)
     }
 }
 
+void Channel::AddMember(Player const* player, PlayerInfo& info)
+{
+    info.MemberLocale = player->GetSession()->GetSessionDbLocaleIndex();
+    std::vector<Player const*>& members = _membersByLocale[info.MemberLocale];
+    info.MemberIndex = members.size();
+    members.push_back(player);
+}
+
+void Channel::RemoveMember(PlayerInfo const& info)
+{
+    std::vector<Player const*>& members = _membersByLocale[info.MemberLocale];
+    if (info.MemberIndex + 1 != members.size())
+    {
+        members[info.MemberIndex] = members.back();
+        _playersStore.at(members[info.MemberIndex]->GetGUID()).MemberIndex = info.MemberIndex;
+    }
+
+    members.pop_back();
+}
+
+// builds the packet once per locale that has members passing the filter
+template <class Builder, class Filter>
+void Channel::SendToMembers(Builder& builder, Filter const& filter) const
+{
+    using LocalizedAction = std::remove_pointer_t<decltype(builder(LocaleConstant{}))>;
+
+    for (uint8 locale = LOCALE_enUS; locale < TOTAL_LOCALES; ++locale)
+    {
+        std::unique_ptr<LocalizedAction> action;
+        for (Player const* player : _membersByLocale[locale])
+        {
+            if (!filter(player))
+                continue;
+
+            if (!action)
+                action.reset(builder(LocaleConstant(locale)));
+
+            (*action)(player);
+        }
+    }
+}
+
 template <class Builder>
 void Channel::SendToAll(Builder& builder, ObjectGuid const& guid, ObjectGuid const& accountGuid) const
 {
-    Trinity::LocalizedDo<Builder> localizer(builder);
-
-    for (PlayerContainer::value_type const& i : _playersStore)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
-            if (guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid))
-                localizer(player);
+    SendToMembers(builder, [&](Player const* player)
+    {
+        return guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid);
+    });
 }
 
 template <class Builder>
 void Channel::SendToAllButOne(Builder& builder, ObjectGuid const& who) const
 {
-    Trinity::LocalizedDo<Builder> localizer(builder);
-
-    for (PlayerContainer::value_type const& i : _playersStore)
-        if (i.first != who)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
-                localizer(player);
+    SendToMembers(builder, [&](Player const* player)
+    {
+        return player->GetGUID() != who;
+    });
 }
 
 template <class Builder>
@@ -1019,10 +1060,8 @@ template <class Builder>
 void Channel::SendToAllWithAddon(Builder& builder, std::string const& addonPrefix, ObjectGuid const& guid /*= ObjectGuid::Empty*/,
     ObjectGuid const& accountGuid /*= ObjectGuid::Empty*/) const
 {
-    Trinity::LocalizedDo<Builder> localizer(builder);
-
-    for (PlayerContainer::value_type const& i : _playersStore)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
-            if (player->GetSession()->IsAddonRegistered(addonPrefix) && (guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid)))
-                localizer(player);
+    SendToMembers(builder, [&](Player const* player)
+    {
+        return player->GetSession()->IsAddonRegistered(addonPrefix) && (guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid));
+    });
 }
@@ -20,9 +20,11 @@
 
 #include "Common.h"
 #include "ObjectGuid.h"
+#include <array>
 #include <ctime>
 #include <map>
 #include <unordered_set>
+#include <vector>
 
 class Player;
 struct AreaTableEntry;
@@ -152,6 +154,10 @@ class TC_GAME_API Channel
                 RemoveFlag(MEMBER_FLAG_MUTED);
         }
 
+        // position in Channel::_membersByLocale
+        LocaleConstant MemberLocale = LOCALE_enUS;
+        std::size_t MemberIndex = 0;
+
     private:
         uint8 _flags = MEMBER_FLAG_NONE;
         bool _invisible = false;
@@ -229,6 +235,12 @@ class TC_GAME_API Channel
         void SetOwnership(bool ownership) { _ownershipEnabled = ownership; }
 
     private:
+        void AddMember(Player const* player, PlayerInfo& info);
+        void RemoveMember(PlayerInfo const& info);
+
+        template <class Builder, class Filter>
+        void SendToMembers(Builder& builder, Filter const& filter) const;
+
         template <class Builder>
         void SendToAll(Builder& builder, ObjectGuid const& guid = ObjectGuid::Empty, ObjectGuid const& accountGuid = ObjectGuid::Empty) const;
 
@@ -271,6 +283,7 @@ class TC_GAME_API Channel
         std::string _channelName;
         std::string _channelPassword;
         PlayerContainer _playersStore;
+        std::array<std::vector<Player const*>, TOTAL_LOCALES> _membersByLocale; // players of _playersStore, members are removed before logging out
         BannedContainer _bannedStore;
 
         AreaTableEntry const* _zoneEntry;
@@ -110,11 +110,10 @@ bool ChatHandler::HasLowerSecurityAccount(WorldSession* target, uint32 target_ac
 
 void ChatHandler::SendSysMessage(std::string_view str, bool escapeCharacters)
 {
-    std::string msg(str);
-
-    // Replace every "|" with "||" in msg
-    if (escapeCharacters)
-        StringReplaceAll(&msg, "|"sv, "||"sv);
+    // Replace every "|" with "||" in msg, only copies the text when there is something to escape
+    std::string msg;
+    if (escapeCharacters && str.find('|') != std::string_view::npos)
+        str = msg = StringReplaceAll(str, "|"sv, "||"sv);
 
     WorldPackets::Chat::Chat packet;
     for (std::string_view line : Trinity::Tokenize(str, '\n', true))
@@ -154,6 +153,11 @@ std::string ChatHandler::StringVPrintf(std::string_view messageFormat, fmt::prin
     return fmt::vsprintf<char>(messageFormat, messageFormatArgs);
 }
 
+void ChatHandler::StringVPrintfTo(fmt::memory_buffer& buffer, std::string_view messageFormat, fmt::printf_args messageFormatArgs)
+{
+    fmt::detail::vprintf(buffer, fmt::string_view(messageFormat), messageFormatArgs);
+}
+
 bool ChatHandler::_ParseCommands(std::string_view text)
 {
     if (Trinity::ChatCommands::TryExecuteCommand(*this, text))
@@ -57,16 +57,19 @@ class TC_GAME_API ChatHandler
 
         void SendSysMessage(uint32 entry);
 
+        // formatted into inline storage, only messages longer than it allocate before the packet is built
         template<typename... Args>
         void PSendSysMessage(char const* fmt, Args&&... args)
         {
-            SendSysMessage(StringVPrintf(fmt, fmt::make_printf_args(std::forward<Args>(args)...)));
+            fmt::memory_buffer message;
+            StringVPrintfTo(message, fmt, fmt::make_printf_args(std::forward<Args>(args)...));
+            SendSysMessage(std::string_view(message.data(), message.size()));
         }
 
         template<typename... Args>
         void PSendSysMessage(uint32 entry, Args&&... args)
         {
-            SendSysMessage(PGetParseString(entry, std::forward<Args>(args)...));
+            PSendSysMessage(GetTrinityString(entry), std::forward<Args>(args)...);
         }
 
         template<typename... Args>
@@ -82,6 +85,7 @@ class TC_GAME_API ChatHandler
         }
 
         static std::string StringVPrintf(std::string_view messageFormat, fmt::printf_args messageFormatArgs);
+        static void StringVPrintfTo(fmt::memory_buffer& buffer, std::string_view messageFormat, fmt::printf_args messageFormatArgs);
 
         bool _ParseCommands(std::string_view text);
         virtual bool ParseCommands(std::string_view text);
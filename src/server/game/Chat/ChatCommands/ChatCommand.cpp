@@ -26,6 +26,7 @@
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "WorldSession.h"
+#include <algorithm>
 
 using ChatSubCommandMap = std::map<std::string_view, Trinity::Impl::ChatCommands::ChatCommandNode, StringCompareLessI_T>;
 
@@ -127,13 +128,25 @@ void Trinity::Impl::ChatCommands::ChatCommandNode::ResolveNames(std::string name
         TC_LOG_WARN("sql.sql", "Table `command` is missing help text for command '{}'.", name);
 
     _name = name;
+    _subCommandPermissions.clear();
     for (auto& [subToken, cmd] : _subCommands)
     {
         std::string subName(name);
         subName.push_back(COMMAND_DELIMITER);
         subName.append(subToken);
         cmd.ResolveNames(subName);
+
+        if (cmd._invoker)
+            _subCommandPermissions.push_back(cmd._permission);
+        _subCommandPermissions.insert(_subCommandPermissions.end(), cmd._subCommandPermissions.begin(), cmd._subCommandPermissions.end());
     }
+
+    // visibility checks only need to know which permissions unlock something below this node, not where
+    auto permissionKey = [](CommandPermissions const& permission) { return std::make_pair(permission.RequiredPermission, permission.AllowConsole); };
+    std::ranges::sort(_subCommandPermissions, {}, permissionKey);
+    auto [first, last] = std::ranges::unique(_subCommandPermissions, {}, permissionKey);
+    _subCommandPermissions.erase(first, last);
+    _subCommandPermissions.shrink_to_fit();
 }
 
 static void LogCommandUsage(WorldSession const& session, uint32 permission, std::string_view cmdStr)
@@ -469,9 +482,13 @@ bool Trinity::Impl::ChatCommands::ChatCommandNode::IsInvokerVisible(ChatHandler
 
 bool Trinity::Impl::ChatCommands::ChatCommandNode::HasVisibleSubCommands(ChatHandler const& who) const
 {
-    for (auto it = _subCommands.begin(); it != _subCommands.end(); ++it)
-        if (it->second.IsVisible(who))
+    for (CommandPermissions const& permission : _subCommandPermissions)
+    {
+        if (who.IsConsole() && (permission.AllowConsole == Trinity::ChatCommands::Console::No))
+            continue;
+        if (who.HasPermission(permission.RequiredPermission))
             return true;
+    }
     return false;
 }
 
@@ -196,7 +196,7 @@ namespace Trinity::Impl::ChatCommands
             static void SendCommandHelpFor(ChatHandler& handler, std::string_view cmd);
             static std::vector<std::string> GetAutoCompletionsFor(ChatHandler const& handler, std::string_view cmd);
 
-            ChatCommandNode() : _name{}, _invoker {}, _permission{}, _help{}, _subCommands{} {}
+            ChatCommandNode() : _name{}, _invoker {}, _permission{}, _help{}, _subCommands{}, _subCommandPermissions{} {}
 
         private:
             static std::map<std::string_view, ChatCommandNode, StringCompareLessI_T> const& GetTopLevelMap();
@@ -217,6 +217,7 @@ namespace Trinity::Impl::ChatCommands
             CommandPermissions _permission;
             std::variant<std::monostate, TrinityStrings, std::string> _help;
             std::map<std::string_view, ChatCommandNode, StringCompareLessI_T> _subCommands;
+            std::vector<CommandPermissions> _subCommandPermissions; // distinct permissions of all invokers below this node, filled by ResolveNames
     };
 }
 
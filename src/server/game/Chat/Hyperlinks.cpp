@@ -19,14 +19,15 @@
 #include "Common.h"
 #include "DB2Stores.h"
 #include "Errors.h"
+#include "GameTime.h"
 #include "ItemTemplate.h"
 #include "ObjectMgr.h"
 #include "QuestDef.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
-#include "StringFormat.h"
 #include "World.h"
+#include <charconv>
 
 using namespace Trinity::Hyperlinks;
 
@@ -160,6 +161,16 @@ static bool IsCreatureNameValid(uint32 creatureId, std::string_view text)
     return false;
 }
 
+// Matches "<name> (<detail>)" without building the expected string
+static bool IsNameWithDetailValid(std::string_view text, std::string_view name, std::string_view detail)
+{
+    return text.length() == name.length() + detail.length() + 3
+        && text.starts_with(name)
+        && text.substr(name.length(), 2) == " ("sv
+        && text.substr(name.length() + 2, detail.length()) == detail
+        && text.back() == ')';
+}
+
 template <>
 struct LinkValidator<LinkTags::spell>
 {
@@ -561,12 +572,11 @@ struct LinkValidator<LinkTags::keystone>
         text.remove_prefix(validateStartPos);
         text.remove_prefix(2); // skip ": " too
 
+        std::array<char, 10> levelBuffer;
+        std::string_view level(levelBuffer.data(), std::to_chars(levelBuffer.data(), levelBuffer.data() + levelBuffer.size(), data.Level).ptr);
         for (LocaleConstant i = LOCALE_enUS; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
-        {
-            std::string expectedText = Trinity::StringFormat("{} ({})", data.Map->Name[i], data.Level);
-            if (expectedText == text)
+            if (IsNameWithDetailValid(text, data.Map->Name[i], level))
                 return true;
-        }
         return false;
     }
 
@@ -767,12 +777,12 @@ struct LinkValidator<LinkTags::transmogset>
 {
     static bool IsTextValid(TransmogSetEntry const* set, std::string_view text)
     {
+        ItemNameDescriptionEntry const* itemNameDescription = sItemNameDescriptionStore.LookupEntry(set->ItemNameDescriptionID);
         for (LocaleConstant i = LOCALE_enUS; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
         {
-            if (ItemNameDescriptionEntry const* itemNameDescription = sItemNameDescriptionStore.LookupEntry(set->ItemNameDescriptionID))
+            if (itemNameDescription)
             {
-                std::string expectedText = Trinity::StringFormat("{} ({})", set->Name[i], itemNameDescription->Description[i]);
-                if (expectedText.c_str() == text)
+                if (IsNameWithDetailValid(text, set->Name[i], itemNameDescription->Description[i]))
                     return true;
             }
             else if (set->Name[i] == text)
@@ -877,6 +887,63 @@ static bool ValidateLinkInfo(HyperlinkInfo const& info)
     return false;
 }
 
+namespace
+{
+// Remembers recently validated links of the calling thread, repeated links (trade channel spam) skip parsing their data and the store lookups
+class ValidatedLinkCache
+{
+public:
+    static constexpr std::size_t Size = 64;
+    static constexpr time_t Lifetime = 30;
+
+    Optional<bool> Find(std::string_view link, std::size_t hash, int32 severity, time_t now) const
+    {
+        Entry const& entry = _entries[hash % Size];
+        if (entry.Hash != hash || entry.Severity != severity || entry.ExpireTime <= now || entry.Link != link)
+            return {};
+
+        return entry.Valid;
+    }
+
+    void Store(std::string_view link, std::size_t hash, int32 severity, time_t now, bool valid)
+    {
+        Entry& entry = _entries[hash % Size];
+        entry.Link.assign(link); // reuses the capacity of the previous link in this slot
+        entry.Hash = hash;
+        entry.Severity = severity;
+        entry.ExpireTime = now + Lifetime;
+        entry.Valid = valid;
+    }
+
+private:
+    struct Entry
+    {
+        std::string Link;
+        std::size_t Hash = 0;
+        int32 Severity = 0;
+        time_t ExpireTime = 0;
+        bool Valid = false;
+    };
+
+    std::array<Entry, Size> _entries;
+};
+
+thread_local ValidatedLinkCache LinkCache;
+
+bool ValidateLink(std::string_view link, HyperlinkInfo const& info)
+{
+    std::size_t hash = std::hash<std::string_view>()(link);
+    int32 severity = static_cast<int32>(sWorld->getIntConfig(CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY));
+    time_t now = GameTime::GetGameTime();
+    if (Optional<bool> valid = LinkCache.Find(link, hash, severity, now))
+        return *valid;
+
+    bool valid = ValidateLinkInfo(info);
+    LinkCache.Store(link, hash, severity, now, valid);
+    return valid;
+}
+}
+
 // Validates all hyperlinks and control sequences contained in str
 bool Trinity::Hyperlinks::CheckAllLinks(std::string_view str)
 {
@@ -912,8 +979,13 @@ bool Trinity::Hyperlinks::CheckAllLinks(std::string_view str)
                 continue;
             }
 
-            HyperlinkInfo info = ParseSingleHyperlink(str.substr(pos));
-            if (!info || !ValidateLinkInfo(info))
+            std::string_view link = str.substr(pos);
+            HyperlinkInfo info = ParseSingleHyperlink(link);
+            if (!info)
+                return false;
+
+            link.remove_suffix(info.tail.length());
+            if (!ValidateLink(link, info))
                 return false;
 
             // tag is fine, find the next one
@@ -222,8 +222,18 @@ std::string LanguageMgr::Translate(std::string const& msg, uint32 language, Loca
 
     std::string result;
     result.reserve(textToTranslate.length());
-    for (std::string_view str : Trinity::Tokenize(textToTranslate, ' ', false))
+
+    // words are walked in place and the wide string buffer is shared by all of them
+    std::wstring wstrSourceWord;
+    std::string_view remaining(textToTranslate);
+    while (!remaining.empty())
     {
+        std::size_t wordEnd = remaining.find(' ');
+        std::string_view str = remaining.substr(0, wordEnd);
+        remaining.remove_prefix(wordEnd != std::string_view::npos ? wordEnd + 1 : remaining.length());
+        if (str.empty())
+            continue;
+
         uint32 wordLen = std::min(18u, uint32(str.length()));
         if (LanguageMgr::WordList const* wordGroup = FindWordGroup(language, wordLen))
         {
@@ -250,7 +260,6 @@ std::string LanguageMgr::Translate(std::string const& msg, uint32 language, Loca
                 }
                 default:
                 {
-                    std::wstring wstrSourceWord;
                     if (Utf8toWStr(str, wstrSourceWord))
                     {
                         size_t length = std::min(wstrSourceWord.length(), strlen(replacementWord));
@@ -123,7 +123,10 @@ bool PvPCombatReference::Update(uint32 tdiff)
 
 void PvPCombatReference::RefreshTimer()
 {
-    _combatTimer = PVP_COMBAT_TIMEOUT;
+    // first's manager subtracts the time elapsed since its last check from all its timers at once
+    CombatManager& mgr = first->GetCombatManager();
+    _combatTimer = PVP_COMBAT_TIMEOUT + mgr._pvpTimersElapsed;
+    mgr._nextPvPTimerCheck = std::min(mgr._nextPvPTimerCheck, _combatTimer);
 }
 
 CombatManager::CombatManager(Unit* owner) : _owner(owner)
@@ -138,17 +141,43 @@ CombatManager::~CombatManager()
 
 void CombatManager::Update(uint32 tdiff)
 {
-    auto it = _pvpRefs.begin(), end = _pvpRefs.end();
-    while (it != end)
+    if (_nextPvPTimerCheck == NO_PVP_TIMER_CHECK)
+        return;
+
+    _pvpTimersElapsed += tdiff;
+    if (_pvpTimersElapsed < _nextPvPTimerCheck)
+        return;
+
+    uint32 const elapsed = _pvpTimersElapsed;
+    _pvpTimersElapsed = 0;
+    _nextPvPTimerCheck = NO_PVP_TIMER_CHECK;
+
+    // advance all timers first, ending combat runs AI hooks that can start or refresh combat
+    std::vector<ObjectGuid> expiredRefs;
+    for (auto const& [guid, ref] : _pvpRefs)
     {
-        PvPCombatReference* const ref = it->second;
-        if (ref->first == _owner && !ref->Update(tdiff)) // only update if we're the first unit involved (otherwise double decrement)
+        if (ref->first != _owner) // only update if we're the first unit involved (otherwise double decrement)
+            continue;
+
+        if (!ref->Update(elapsed))
         {
-            it = _pvpRefs.erase(it), end = _pvpRefs.end(); // remove it from our refs first to prevent invalidation
-            ref->EndCombat(); // this will remove it from the other side
+            ref->_combatTimer = 0;
+            expiredRefs.push_back(guid);
         }
         else
-            ++it;
+            _nextPvPTimerCheck = std::min(_nextPvPTimerCheck, ref->_combatTimer);
+    }
+
+    for (ObjectGuid const& guid : expiredRefs)
+    {
+        auto it = _pvpRefs.find(guid);
+        // skip refs that were ended, replaced or refreshed by an earlier EndCombat
+        if (it == _pvpRefs.end() || it->second->first != _owner || it->second->_combatTimer)
+            continue;
+
+        PvPCombatReference* const ref = it->second;
+        _pvpRefs.erase(it); // remove it from our refs first to prevent invalidation
+        ref->EndCombat(); // this will remove it from the other side
     }
 }
 
@@ -210,7 +239,11 @@ bool CombatManager::SetInCombatWith(Unit* who, bool addSecondUnitSuppressed)
     // ...then create new reference
     CombatReference* ref;
     if (_owner->IsControlledByPlayer() && who->IsControlledByPlayer())
-        ref = new PvPCombatReference(_owner, who);
+    {
+        PvPCombatReference* pvpRef = new PvPCombatReference(_owner, who);
+        pvpRef->RefreshTimer();
+        ref = pvpRef;
+    }
     else
         ref = new CombatReference(_owner, who);
 
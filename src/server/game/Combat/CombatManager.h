@@ -20,6 +20,7 @@
 
 #include "Common.h"
 #include "ObjectGuid.h"
+#include <limits>
 #include <unordered_map>
 
 class Unit;
@@ -142,6 +143,11 @@ class TC_GAME_API CombatManager
         std::unordered_map<ObjectGuid, CombatReference*> _pveRefs;
         std::unordered_map<ObjectGuid, PvPCombatReference*> _pvpRefs;
 
+        // timers of pvp refs owned by this manager (first == _owner) are only advanced when one of them may have expired
+        uint32 _pvpTimersElapsed = 0;                   // time not yet subtracted from owned pvp ref timers
+        uint32 _nextPvPTimerCheck = NO_PVP_TIMER_CHECK; // lower bound of the smallest owned pvp ref timer
+        static constexpr uint32 NO_PVP_TIMER_CHECK = std::numeric_limits<uint32>::max();
+
     friend struct CombatReference;
     friend struct PvPCombatReference;
 };
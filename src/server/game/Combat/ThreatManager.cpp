@@ -161,12 +161,16 @@ public:
 
 void ThreatReference::HeapNotifyIncreased()
 {
-    _mgr._sortedThreatList->increase(static_cast<ThreatReferenceImpl*>(this)->_handle);
+    if (!_heapIncreasePending && !_heapDecreasePending)
+        _mgr._pendingHeapUpdates.push_back(this);
+    _heapIncreasePending = true;
 }
 
 void ThreatReference::HeapNotifyDecreased()
 {
-    _mgr._sortedThreatList->decrease(static_cast<ThreatReferenceImpl*>(this)->_handle);
+    if (!_heapIncreasePending && !_heapDecreasePending)
+        _mgr._pendingHeapUpdates.push_back(this);
+    _heapDecreasePending = true;
 }
 
 /*static*/ bool ThreatManager::CanHaveThreatList(Unit const* who)
@@ -306,6 +310,7 @@ Trinity::IteratorPair<ThreatManager::ThreatListIterator, std::nullptr_t> ThreatM
 
 Trinity::IteratorPair<ThreatManager::ThreatListIterator, std::nullptr_t> ThreatManager::GetSortedThreatList() const
 {
+    ApplyPendingHeapUpdates();
     auto itr = _sortedThreatList->ordered_begin();
     auto end = _sortedThreatList->ordered_end();
     std::function<ThreatReference const* ()> generator = [itr, end]() mutable -> ThreatReference const*
@@ -322,6 +327,7 @@ std::vector<ThreatReference*> ThreatManager::GetModifiableThreatList()
 {
     std::vector<ThreatReference*> list;
     list.reserve(_myThreatListEntries.size());
+    ApplyPendingHeapUpdates();
     for (auto it = _sortedThreatList->ordered_begin(), end = _sortedThreatList->ordered_end(); it != end; ++it)
         list.push_back(const_cast<ThreatReference*>(*it));
     return list;
@@ -490,6 +496,7 @@ void ThreatManager::MatchUnitThreatToHighestThreat(Unit* target)
     if (_sortedThreatList->empty())
         return;
 
+    ApplyPendingHeapUpdates();
     auto it = _sortedThreatList->ordered_begin(), end = _sortedThreatList->ordered_end();
     ThreatReference const* highest = *it;
     if (!highest->IsAvailable())
@@ -612,6 +619,7 @@ ThreatReference const* ThreatManager::ReselectVictim()
     ThreatReference const* oldVictimRef = _currentVictimRef;
     if (oldVictimRef && oldVictimRef->IsOffline())
         oldVictimRef = nullptr;
+    ApplyPendingHeapUpdates();
     // in 99% of cases - we won't need to actually look at anything beyond the first element
     ThreatReference const* highest = _sortedThreatList->top();
     // if the highest reference is offline, the entire list is offline, and we indicate this
@@ -886,12 +894,43 @@ void ThreatManager::SendThreatListToClients(bool newHighest) const
     }
 }
 
+void ThreatManager::ApplyPendingHeapUpdates() const
+{
+    if (_pendingHeapUpdates.empty())
+        return;
+
+    // increases only cut nodes away from their parents, do them first
+    // decreased nodes are then moved to the root list together with their children and the heap is consolidated once
+    ThreatReference* lastDecreased = nullptr;
+    for (ThreatReference* ref : _pendingHeapUpdates)
+    {
+        if (ref->_heapDecreasePending)
+            lastDecreased = ref;
+        else
+            _sortedThreatList->increase(static_cast<ThreatReferenceImpl*>(ref)->_handle);
+        ref->_heapIncreasePending = false;
+    }
+
+    for (ThreatReference* ref : _pendingHeapUpdates)
+    {
+        if (ref->_heapDecreasePending && ref != lastDecreased)
+            _sortedThreatList->update_lazy(static_cast<ThreatReferenceImpl*>(ref)->_handle);
+        ref->_heapDecreasePending = false;
+    }
+
+    if (lastDecreased)
+        _sortedThreatList->update(static_cast<ThreatReferenceImpl*>(lastDecreased)->_handle);
+
+    _pendingHeapUpdates.clear();
+}
+
 void ThreatManager::PutThreatListRef(ObjectGuid const& guid, ThreatReference* ref)
 {
     _needClientUpdate = true;
     auto& inMap = _myThreatListEntries[guid];
     ASSERT(!inMap, "Duplicate threat reference at %p being inserted on %s for %s - memory leak!", ref, _owner->GetGUID().ToString().c_str(), guid.ToString().c_str());
     inMap = ref;
+    ApplyPendingHeapUpdates();
     static_cast<ThreatReferenceImpl*>(ref)->_handle = _sortedThreatList->push(ref);
 }
 
@@ -902,6 +941,7 @@ void ThreatManager::PurgeThreatListRef(ObjectGuid const& guid)
         return;
     ThreatReference* ref = it->second;
     _myThreatListEntries.erase(it);
+    ApplyPendingHeapUpdates();
     _sortedThreatList->erase(static_cast<ThreatReferenceImpl*>(ref)->_handle);
 
     if (_fixateRef == ref)
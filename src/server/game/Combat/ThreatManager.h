@@ -205,6 +205,11 @@ class TC_GAME_API ThreatManager
         std::unique_ptr<Heap> _sortedThreatList;
         std::unordered_map<ObjectGuid, ThreatReference*> _myThreatListEntries;
 
+        // threat changes only mark references, heap positions are fixed once before the heap order is needed
+        // repeated threat changes of one reference between reads (every damage/heal event) become a single heap update
+        void ApplyPendingHeapUpdates() const;
+        mutable std::vector<ThreatReference*> _pendingHeapUpdates;
+
         // AI notifies are delayed to ensure we are in a consistent state before we call out to arbitrary logic
         // threat references might register themselves here when ::UpdateOffline() is called - MAKE SURE THIS IS PROCESSED JUST BEFORE YOU EXIT THREATMANAGER LOGIC
         void ProcessAIUpdates();
@@ -290,7 +295,7 @@ class TC_GAME_API ThreatReference
 
         explicit ThreatReference(ThreatManager* mgr, Unit* victim) :
             _owner(reinterpret_cast<Creature*>(mgr->_owner)), _mgr(*mgr), _victim(victim),
-            _baseAmount(0.0f), _tempModifier(0), _taunted(TAUNT_STATE_NONE)
+            _baseAmount(0.0f), _tempModifier(0), _taunted(TAUNT_STATE_NONE), _heapIncreasePending(false), _heapDecreasePending(false)
         {
             _online = ONLINE_STATE_OFFLINE;
         }
@@ -311,6 +316,8 @@ class TC_GAME_API ThreatReference
         float _baseAmount;
         int32 _tempModifier; // Temporary effects (auras with SPELL_AURA_MOD_TOTAL_THREAT) - set from victim's threatmanager in ThreatManager::UpdateMyTempModifiers
         TauntState _taunted;
+        bool _heapIncreasePending;
+        bool _heapDecreasePending;
 
     public:
         ThreatReference(ThreatReference const&) = delete;
@@ -56,9 +56,59 @@
 #include "WorldSession.h"
 #include "WorldStateMgr.h"
 #include "WowTime.h"
+#include <algorithm>
 #include <random>
 #include <sstream>
 
+namespace
+{
+// Conditions that only read fields of the object or map, checked before the rest of their group
+bool IsCheapConditionType(ConditionTypes type)
+{
+    switch (type)
+    {
+        case CONDITION_NONE:
+        case CONDITION_ZONEID:
+        case CONDITION_TEAM:
+        case CONDITION_CLASS:
+        case CONDITION_RACE:
+        case CONDITION_GENDER:
+        case CONDITION_MAPID:
+        case CONDITION_AREAID:
+        case CONDITION_CREATURE_TYPE:
+        case CONDITION_LEVEL:
+        case CONDITION_OBJECT_ENTRY_GUID:
+        case CONDITION_TYPE_MASK:
+        case CONDITION_ALIVE:
+        case CONDITION_DIFFICULTY_ID:
+        case CONDITION_GAMEMASTER:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Groups conditions by ElseGroup and moves cheap checks to the front of each group
+// all conditions of a group must match so the order inside it does not change the result
+void SortConditionList(ConditionContainer& conditions)
+{
+    std::ranges::stable_sort(conditions, [](Condition const& left, Condition const& right)
+    {
+        if (left.ElseGroup != right.ElseGroup)
+            return left.ElseGroup < right.ElseGroup;
+
+        auto cost = [](Condition const& condition)
+        {
+            if (condition.ReferenceId)
+                return 2;
+
+            return !condition.ScriptId && IsCheapConditionType(condition.ConditionType) ? 0 : 1;
+        };
+        return cost(left) < cost(right);
+    });
+}
+}
+
 char const* const ConditionMgr::StaticSourceTypeData[CONDITION_SOURCE_TYPE_MAX_DB_ALLOWED] =
 {
     "None",
@@ -1008,13 +1058,68 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionContainer cons
     return mask;
 }
 
+bool ConditionMgr::IsObjectMeetToCondition(ConditionSourceInfo& sourceInfo, Condition const& condition) const
+{
+    TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} val1: {}", condition.ToString(), condition.ConditionValue1);
+    if (condition.ReferenceId)//handle reference
+    {
+        auto ref = ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].find({ condition.ReferenceId, 0, 0 });
+        if (ref == ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].end())
+        {
+            TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
+                condition.ToString(), condition.ReferenceId); // checked at loading, should never happen
+            return true;
+        }
+
+        bool condMeets = IsObjectMeetToConditionList(sourceInfo, *ref->second);
+        if (condition.NegativeCondition)
+            condMeets = !condMeets;
+
+        return condMeets;
+    }
+
+    //handle normal condition
+    return condition.Meets(sourceInfo);
+}
+
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
+{
+    // lists loaded from db are sorted by ElseGroup (see SortConditionList), every group is checked in a single pass
+    // and the first one that matches ends the check
+    if (!std::ranges::is_sorted(conditions, {}, &Condition::ElseGroup))
+        return IsObjectMeetToUnsortedConditionList(sourceInfo, conditions);
+
+    for (auto groupBegin = conditions.begin(); groupBegin != conditions.end();)
+    {
+        uint32 elseGroup = groupBegin->ElseGroup;
+        auto groupEnd = std::find_if(groupBegin, conditions.end(), [elseGroup](Condition const& condition) { return condition.ElseGroup != elseGroup; });
+
+        bool hasLoadedCondition = false;
+        bool groupMeets = true;
+        for (auto itr = groupBegin; itr != groupEnd && groupMeets; ++itr)
+        {
+            if (!itr->isLoaded())
+                continue;
+
+            hasLoadedCondition = true;
+            groupMeets = IsObjectMeetToCondition(sourceInfo, *itr);
+        }
+
+        if (hasLoadedCondition && groupMeets)
+            return true;
+
+        groupBegin = groupEnd;
+    }
+
+    return false;
+}
+
+bool ConditionMgr::IsObjectMeetToUnsortedConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
 {
     //     groupId, groupCheckPassed
     std::map<uint32, bool> elseGroupStore;
     for (Condition const& condition : conditions)
     {
-        TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} val1: {}", condition.ToString(), condition.ConditionValue1);
         if (condition.isLoaded())
         {
             //! Find ElseGroup in ElseGroupStore
@@ -1022,30 +1127,8 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
             if (!itr->second) //! If another condition in this group was unmatched before this, don't bother checking (the group is false anyway)
                 continue;
 
-            if (condition.ReferenceId)//handle reference
-            {
-                auto ref = ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].find({ condition.ReferenceId, 0, 0 });
-                if (ref != ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].end())
-                {
-                    bool condMeets = IsObjectMeetToConditionList(sourceInfo, *ref->second);
-                    if (condition.NegativeCondition)
-                        condMeets = !condMeets;
-
-                    if (!condMeets)
-                        itr->second = false;
-                }
-                else
-                {
-                    TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
-                        condition.ToString(), condition.ReferenceId); // checked at loading, should never happen
-                }
-
-            }
-            else //handle normal condition
-            {
-                if (!condition.Meets(sourceInfo))
-                    itr->second = false;
-            }
+            if (!IsObjectMeetToCondition(sourceInfo, condition))
+                itr->second = false;
         }
     }
     for (std::map<uint32, bool>::const_iterator i = elseGroupStore.begin(); i != elseGroupStore.end(); ++i)
@@ -1414,6 +1497,10 @@ void ConditionMgr::LoadConditions(bool isReload)
     }
     while (result->NextRow());
 
+    for (ConditionsByEntryMap& conditionsByEntry : ConditionStore)
+        for (auto&& [id, conditions] : conditionsByEntry)
+            SortConditionList(*conditions);
+
     for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_CREATURE_LOOT_TEMPLATE])
         addToLootTemplate(id, conditions, LootTemplates_Creature.GetLootForConditionFill(id.SourceGroup));
 
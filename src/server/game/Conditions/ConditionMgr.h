@@ -362,6 +362,8 @@ class TC_GAME_API ConditionMgr
         void addToPhases(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
         void addToGraveyardData(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
         bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        bool IsObjectMeetToUnsortedConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        bool IsObjectMeetToCondition(ConditionSourceInfo& sourceInfo, Condition const& condition) const;
 
         static void LogUselessConditionValue(Condition const* cond, uint8 index, uint32 value);
         static void LogUselessConditionValue(Condition const* cond, uint8 index, std::string_view value);
@@ -16,6 +16,8 @@
  */
 
 #include "DB2Stores.h"
+#include "ByteBuffer.h"
+#include "Config.h"
 #include "Containers.h"
 #include "DB2LoadInfo.h"
 #include "DatabaseEnv.h"
@@ -26,6 +28,7 @@
 #include "MapUtils.h"
 #include "Random.h"
 #include "Regex.h"
+#include "ThreadPool.h"
 #include "Timer.h"
 #include "Util.h"
 #include "World.h"
@@ -37,6 +40,7 @@
 #include <numeric>
 #include <cctype>
 #include <cmath>
+#include <future>
 
 DB2Storage<AchievementEntry>                    sAchievementStore("Achievement.db2", &AchievementLoadInfo::Instance);
 DB2Storage<Achievement_CategoryEntry>           sAchievementCategoryStore("Achievement_Category.db2", &AchievementCategoryLoadInfo::Instance);
@@ -458,6 +462,7 @@ namespace
     std::array<HotfixBlobMap, TOTAL_LOCALES> _hotfixBlob;
     std::unordered_multimap<uint32 /*tableHash*/, AllowedHotfixOptionalData> _allowedHotfixOptionalData;
     std::array<std::map<HotfixBlobKey, std::vector<DB2Manager::HotfixOptionalData>>, TOTAL_LOCALES> _hotfixOptionalData;
+    std::array<HotfixBlobMap, TOTAL_LOCALES> _hotfixRecordData;
 
     AreaGroupMemberContainer _areaGroupMembers;
     ArtifactPowersContainer _artifactPowers;
@@ -545,7 +550,7 @@ namespace
 }
 
 void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector<std::string>& errlist, StorageMap& stores, DB2StorageBase* storage, std::string const& db2Path,
-    LocaleConstant defaultLocale, std::size_t cppRecordSize)
+    std::string const& snapshotPath, LocaleConstant defaultLocale, std::size_t cppRecordSize)
 {
     // validate structure
     {
@@ -578,50 +583,84 @@ void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector<std::s
             storage->GetFileName().c_str(), loadInfo->Meta->GetRecordSize(), cppRecordSize);
     }
 
-    try
+    // file data is keyed by the size and modification time of every file it was loaded from
+    std::string snapshotFileName;
+    std::vector<DB2SnapshotSource> snapshotSources;
+    if (!snapshotPath.empty())
     {
-        storage->Load(db2Path + localeNames[defaultLocale] + '/', defaultLocale);
-    }
-    catch (std::system_error const& e)
-    {
-        if (e.code() == std::errc::no_such_file_or_directory)
+        snapshotFileName = snapshotPath + storage->GetFileName() + ".snapshot";
+        for (LocaleConstant i = LOCALE_enUS; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
         {
-            errlist.push_back(Trinity::StringFormat("File {}{}/{} does not exist", db2Path, localeNames[defaultLocale], storage->GetFileName()));
+            if (defaultLocale != i && !availableDb2Locales[i])
+                continue;
+
+            boost::filesystem::path sourceFile = db2Path + localeNames[i] + '/' + storage->GetFileName();
+            boost::system::error_code error;
+            DB2SnapshotSource& source = snapshotSources.emplace_back();
+            source.Locale = i;
+            source.FileSize = boost::filesystem::file_size(sourceFile, error);
+            if (error)
+                source.FileSize = 0;
+
+            source.LastWriteTime = boost::filesystem::last_write_time(sourceFile, error);
+            if (error)
+                source.LastWriteTime = 0;
         }
-        else
-            throw;
     }
-    catch (std::exception const& e)
-    {
-        errlist.emplace_back(e.what());
-        return;
-    }
-
-    // load additional data and enUS strings from db
-    storage->LoadFromDB();
 
-    for (LocaleConstant i = LOCALE_enUS; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
+    if (snapshotFileName.empty() || !storage->LoadSnapshot(snapshotFileName, snapshotSources))
     {
-        if (defaultLocale == i || !availableDb2Locales[i])
-            continue;
+        std::size_t previousErrors = errlist.size();
 
         try
         {
-            storage->LoadStringsFrom((db2Path + localeNames[i] + '/'), i);
+            storage->Load(db2Path + localeNames[defaultLocale] + '/', defaultLocale);
         }
         catch (std::system_error const& e)
         {
-            if (e.code() != std::errc::no_such_file_or_directory)
+            if (e.code() == std::errc::no_such_file_or_directory)
+            {
+                errlist.push_back(Trinity::StringFormat("File {}{}/{} does not exist", db2Path, localeNames[defaultLocale], storage->GetFileName()));
+            }
+            else
                 throw;
-
-            // locale db2 files are optional, do not error if nothing is found
         }
         catch (std::exception const& e)
         {
             errlist.emplace_back(e.what());
+            return;
+        }
+
+        // database records overwrite file records in place, locale strings from files can be loaded before them
+        for (LocaleConstant i = LOCALE_enUS; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
+        {
+            if (defaultLocale == i || !availableDb2Locales[i])
+                continue;
+
+            try
+            {
+                storage->LoadStringsFrom((db2Path + localeNames[i] + '/'), i);
+            }
+            catch (std::system_error const& e)
+            {
+                if (e.code() != std::errc::no_such_file_or_directory)
+                    throw;
+
+                // locale db2 files are optional, do not error if nothing is found
+            }
+            catch (std::exception const& e)
+            {
+                errlist.emplace_back(e.what());
+            }
         }
+
+        if (!snapshotFileName.empty() && errlist.size() == previousErrors && !storage->SaveSnapshot(snapshotFileName, snapshotSources))
+            TC_LOG_ERROR("server.loading", "Could not write DB2 snapshot {}", snapshotFileName);
     }
 
+    // load additional data and enUS strings from db
+    storage->LoadFromDB();
+
     for (LocaleConstant i = LOCALE_koKR; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
         if (availableDb2Locales[i])
             storage->LoadStringsFromDB(i);
@@ -649,7 +688,7 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
         while (db2PathItr != end)
         {
             LocaleConstant locale = GetLocaleByName(db2PathItr->path().filename().string());
-            if (IsValidLocale(locale) && (sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) || locale == defaultLocale))
+            if (IsValidLocale(locale) && ((sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && sWorld->IsLocaleLoaded(locale)) || locale == defaultLocale))
                 foundLocales[locale] = true;
 
             ++db2PathItr;
@@ -660,9 +699,47 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
     if (!availableDb2Locales[defaultLocale])
         return 0;
 
+    std::string snapshotPath = sConfigMgr->GetStringDefault("DB2.SnapshotDir"sv, ""sv);
+    if (!snapshotPath.empty())
+    {
+        if (snapshotPath.back() != '/' && snapshotPath.back() != '\\')
+            snapshotPath.push_back('/');
+
+        boost::system::error_code error;
+        boost::filesystem::create_directories(snapshotPath, error);
+        if (error)
+        {
+            TC_LOG_ERROR("server.loading", "Could not create DB2.SnapshotDir {}: {}, DB2 snapshots disabled", snapshotPath, error.message());
+            snapshotPath.clear();
+        }
+    }
+
+    struct PendingLoadResult
+    {
+        std::vector<std::string> Errors;
+        StorageMap Stores;
+    };
+
+    std::vector<std::future<PendingLoadResult>> pendingLoads;
+    std::unique_ptr<Trinity::ThreadPool> loadPool;
+    if (uint32 loadThreads = sWorld->getIntConfig(CONFIG_LOAD_THREADS))
+        loadPool = std::make_unique<Trinity::ThreadPool>(loadThreads);
+
     auto LOAD_DB2 = [&]<typename T>(DB2Storage<T>& store)
     {
-        LoadDB2(availableDb2Locales, loadErrors, _stores, &store, db2Path, defaultLocale, sizeof(T));
+        if (!loadPool)
+        {
+            LoadDB2(availableDb2Locales, loadErrors, _stores, &store, db2Path, snapshotPath, defaultLocale, sizeof(T));
+            return;
+        }
+
+        // stores do not reference each other until IndexLoadedStores, results are merged in load order once all files are decoded
+        pendingLoads.push_back(loadPool->Submit([&availableDb2Locales, &db2Path, &snapshotPath, defaultLocale, storage = &store]
+        {
+            PendingLoadResult result;
+            LoadDB2(availableDb2Locales, result.Errors, result.Stores, storage, db2Path, snapshotPath, defaultLocale, sizeof(T));
+            return result;
+        }));
     };
 
     LOAD_DB2(sAchievementStore);
@@ -1022,6 +1099,13 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
     LOAD_DB2(sWorldMapOverlayStore);
     LOAD_DB2(sWorldStateExpressionStore);
 
+    for (std::future<PendingLoadResult>& pendingLoad : pendingLoads)
+    {
+        PendingLoadResult result = pendingLoad.get();
+        std::ranges::move(result.Errors, std::back_inserter(loadErrors));
+        _stores.merge(result.Stores);
+    }
+
     // error checks
     if (!loadErrors.empty())
     {
@@ -1941,6 +2025,56 @@ void DB2Manager::LoadHotfixOptionalData(uint32 localeMask)
     TC_LOG_INFO("server.loading", ">> Loaded {} hotfix optional data records in {} ms", hotfixOptionalDataCount, GetMSTimeDiffToNow(oldMSTime));
 }
 
+void DB2Manager::InitializeHotfixRecordData(uint32 localeMask)
+{
+    uint32 oldMSTime = getMSTime();
+
+    for (HotfixBlobMap& recordData : _hotfixRecordData)
+        recordData.clear();
+
+    uint32 count = 0;
+    ByteBuffer buffer;
+    for (auto const& [pushId, push] : _hotfixData)
+    {
+        for (HotfixRecord const& hotfixRecord : push.Records)
+        {
+            if (hotfixRecord.HotfixStatus != HotfixRecord::Status::Valid)
+                continue;
+
+            DB2StorageBase const* storage = GetStorage(hotfixRecord.TableHash);
+            if (!storage || !storage->HasRecord(uint32(hotfixRecord.RecordID)))
+                continue;
+
+            for (uint32 locale = 0; locale < TOTAL_LOCALES; ++locale)
+            {
+                if (!(localeMask & (1 << locale)) || !(hotfixRecord.AvailableLocalesMask & (1 << locale)))
+                    continue;
+
+                auto [recordData, inserted] = _hotfixRecordData[locale].try_emplace({ hotfixRecord.TableHash, hotfixRecord.RecordID });
+                if (!inserted)
+                    continue;
+
+                buffer.clear();
+                storage->WriteRecord(uint32(hotfixRecord.RecordID), LocaleConstant(locale), buffer);
+
+                if (std::vector<HotfixOptionalData> const* optionalDataEntries = GetHotfixOptionalData(hotfixRecord.TableHash, hotfixRecord.RecordID, LocaleConstant(locale)))
+                {
+                    for (HotfixOptionalData const& optionalData : *optionalDataEntries)
+                    {
+                        buffer << uint32(optionalData.Key);
+                        buffer.append(optionalData.Data.data(), optionalData.Data.size());
+                    }
+                }
+
+                recordData->second.assign(buffer.data(), buffer.data() + buffer.size());
+                ++count;
+            }
+        }
+    }
+
+    TC_LOG_INFO("server.loading", ">> Serialized {} hotfix records in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+}
+
 uint32 DB2Manager::GetHotfixCount() const
 {
     return _hotfixData.size();
@@ -1958,6 +2092,13 @@ std::vector<uint8> const* DB2Manager::GetHotfixBlobData(uint32 tableHash, int32
     return Trinity::Containers::MapGetValuePtr(_hotfixBlob[locale], std::make_pair(tableHash, recordId));
 }
 
+std::vector<uint8> const* DB2Manager::GetHotfixRecordData(uint32 tableHash, int32 recordId, LocaleConstant locale) const
+{
+    ASSERT(IsValidLocale(locale), "Locale %u is invalid locale", uint32(locale));
+
+    return Trinity::Containers::MapGetValuePtr(_hotfixRecordData[locale], std::make_pair(tableHash, recordId));
+}
+
 std::vector<DB2Manager::HotfixOptionalData> const* DB2Manager::GetHotfixOptionalData(uint32 tableHash, int32 recordId, LocaleConstant locale) const
 {
     ASSERT(IsValidLocale(locale), "Locale %u is invalid locale", uint32(locale));
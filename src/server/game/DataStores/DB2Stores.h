@@ -435,9 +435,12 @@ public:
     void LoadHotfixData(uint32 localeMask);
     void LoadHotfixBlob(uint32 localeMask);
     void LoadHotfixOptionalData(uint32 localeMask);
+    // serializes every valid hotfixed record once per locale, must run after all code that modifies db2 records
+    void InitializeHotfixRecordData(uint32 localeMask);
     uint32 GetHotfixCount() const;
     HotfixContainer const& GetHotfixData() const;
     std::vector<uint8> const* GetHotfixBlobData(uint32 tableHash, int32 recordId, LocaleConstant locale) const;
+    std::vector<uint8> const* GetHotfixRecordData(uint32 tableHash, int32 recordId, LocaleConstant locale) const;
     std::vector<HotfixOptionalData> const* GetHotfixOptionalData(uint32 tableHash, int32 recordId, LocaleConstant locale) const;
 
     uint32 GetEmptyAnimStateID() const;
@@ -29,6 +29,7 @@
 #include "LFGQueue.h"
 #include "Log.h"
 #include "Map.h"
+#include "MapManager.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Player.h"
@@ -1040,6 +1041,11 @@ uint32 LFGMgr::AddProposal(LfgProposal& proposal)
 {
     proposal.id = ++m_lfgProposalId;
     ProposalsStore[m_lfgProposalId] = proposal;
+
+    // load terrain while players are accepting, the instance is created once everyone did
+    if (LFGDungeonData const* dungeon = GetLFGDungeon(proposal.dungeonId))
+        sMapMgr->PrewarmInstanceMap(dungeon->map, dungeon->x, dungeon->y);
+
     return m_lfgProposalId;
 }
 
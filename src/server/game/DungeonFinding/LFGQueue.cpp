@@ -19,35 +19,27 @@
 #include "Containers.h"
 #include "GameTime.h"
 #include "Group.h"
+#include "Hash.h"
 #include "LFGMgr.h"
 #include "Log.h"
+#include "MapUtils.h"
 #include <sstream>
 
 namespace lfg
 {
 
-/**
-   Given a list of guids returns the concatenation using | as delimiter
-
-   @param[in]     check list of guids
-   @returns Concatenated string
-*/
-std::string ConcatenateGuids(GuidList const& check)
+bool LfgCompatibilityKey::Contains(uint32 slot) const
 {
-    if (check.empty())
-        return "";
-
-    // need the guids in order to avoid duplicates
-    GuidSet guids(check.begin(), check.end());
-
-    std::ostringstream o;
+    return std::binary_search(slots.begin(), slots.begin() + size, slot);
+}
 
-    GuidSet::const_iterator it = guids.begin();
-    o << it->ToHexString();
-    for (++it; it != guids.end(); ++it)
-        o << '|' << it->ToHexString();
+std::size_t LfgCompatibilityKeyHash::operator()(LfgCompatibilityKey const& key) const
+{
+    std::size_t hashVal = 0;
+    for (uint8 i = 0; i < key.size; ++i)
+        Trinity::hash_combine(hashVal, key.slots[i]);
 
-    return o.str();
+    return hashVal;
 }
 
 char const* GetCompatibleString(LfgCompatibility compatibles)
@@ -146,15 +138,15 @@ void LFGQueue::RemoveFromQueue(ObjectGuid guid)
     RemoveFromCurrentQueue(guid);
     RemoveFromCompatibles(guid);
 
-    std::string sguid = guid.ToHexString();
+    uint32 const* slot = Trinity::Containers::MapGetValuePtr(QueueSlotsByGuid, guid);
 
     LfgQueueDataContainer::iterator itDelete = QueueDataStore.end();
     for (LfgQueueDataContainer::iterator itr = QueueDataStore.begin(); itr != QueueDataStore.end(); ++itr)
         if (itr->first != guid)
         {
-            if (std::string::npos != itr->second.bestCompatible.find(sguid))
+            if (slot && itr->second.bestCompatible.Contains(*slot))
             {
-                itr->second.bestCompatible.clear();
+                itr->second.bestCompatible = {};
                 FindBestCompatibleInQueue(itr);
             }
         }
@@ -163,6 +155,8 @@ void LFGQueue::RemoveFromQueue(ObjectGuid guid)
 
     if (itDelete != QueueDataStore.end())
         QueueDataStore.erase(itDelete);
+
+    ReleaseQueueSlot(guid);
 }
 
 void LFGQueue::AddToNewQueue(ObjectGuid guid)
@@ -193,6 +187,7 @@ void LFGQueue::RemoveFromCurrentQueue(ObjectGuid guid)
 void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
 {
     QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+    AcquireQueueSlot(guid);
     AddToQueue(guid);
 }
 
@@ -201,6 +196,94 @@ void LFGQueue::RemoveQueueData(ObjectGuid guid)
     LfgQueueDataContainer::iterator it = QueueDataStore.find(guid);
     if (it != QueueDataStore.end())
         QueueDataStore.erase(it);
+
+    ReleaseQueueSlot(guid);
+}
+
+/**
+   Assigns a queue slot to the given guid, slots are used instead of guids to identify cached compatibilities
+
+   @param[in]     guid Guid being queued
+   @return Slot of the guid
+*/
+uint32 LFGQueue::AcquireQueueSlot(ObjectGuid guid)
+{
+    auto [itr, isNew] = QueueSlotsByGuid.try_emplace(guid, 0);
+    if (!isNew)
+        return itr->second;
+
+    if (QueueSlotStore.empty())
+        QueueSlotStore.emplace_back();
+
+    if (!FreeQueueSlots.empty())
+    {
+        itr->second = FreeQueueSlots.back();
+        FreeQueueSlots.pop_back();
+    }
+    else
+    {
+        itr->second = QueueSlotStore.size();
+        QueueSlotStore.emplace_back();
+    }
+
+    QueueSlotStore[itr->second].guid = guid;
+    return itr->second;
+}
+
+void LFGQueue::ReleaseQueueSlot(ObjectGuid guid)
+{
+    auto itr = QueueSlotsByGuid.find(guid);
+    if (itr == QueueSlotsByGuid.end())
+        return;
+
+    // cached compatibilities must not outlive the slot, it will be reused by another guid
+    RemoveFromCompatibles(guid);
+
+    QueueSlotStore[itr->second].guid.Clear();
+    FreeQueueSlots.push_back(itr->second);
+    QueueSlotsByGuid.erase(itr);
+}
+
+/**
+   Builds the compatibility cache key of a list of guids
+
+   @param[in]     check list of guids
+   @return Key of the guids, invalid if any of them is not queued
+*/
+LfgCompatibilityKey LFGQueue::BuildCompatibilityKey(GuidList const& check) const
+{
+    LfgCompatibilityKey key;
+    if (check.size() > key.slots.size())
+        return key;
+
+    for (ObjectGuid guid : check)
+    {
+        uint32 const* slot = Trinity::Containers::MapGetValuePtr(QueueSlotsByGuid, guid);
+        if (!slot)
+            return {};
+
+        key.slots[key.size++] = *slot;
+    }
+
+    // need the slots in order to avoid duplicates
+    std::sort(key.slots.begin(), key.slots.begin() + key.size);
+    key.size = std::unique(key.slots.begin(), key.slots.begin() + key.size) - key.slots.begin();
+    std::fill(key.slots.begin() + key.size, key.slots.end(), 0);
+    return key;
+}
+
+std::string LFGQueue::GetCompatibilityKeyString(LfgCompatibilityKey const& key) const
+{
+    std::ostringstream o;
+    for (uint8 i = 0; i < key.size; ++i)
+    {
+        if (i)
+            o << '|';
+
+        o << QueueSlotStore[key.slots[i]].guid.ToHexString();
+    }
+
+    return o.str();
 }
 
 void LFGQueue::UpdateWaitTimeAvg(int32 waitTime, uint32 dungeonId)
@@ -238,41 +321,71 @@ void LFGQueue::UpdateWaitTimeDps(int32 waitTime, uint32 dungeonId)
 */
 void LFGQueue::RemoveFromCompatibles(ObjectGuid guid)
 {
-    std::string strGuid = guid.ToHexString();
+    uint32 const* slot = Trinity::Containers::MapGetValuePtr(QueueSlotsByGuid, guid);
+    if (!slot)
+        return;
 
     TC_LOG_DEBUG("lfg.queue.data.compatibles.remove", "Removing {}", guid.ToString());
-    for (LfgCompatibleContainer::iterator itNext = CompatibleMapStore.begin(); itNext != CompatibleMapStore.end();)
+    std::vector<LfgCompatibilityKey> keys = std::move(QueueSlotStore[*slot].compatibleKeys);
+    QueueSlotStore[*slot].compatibleKeys.clear();
+    for (LfgCompatibilityKey const& key : keys)
     {
-        LfgCompatibleContainer::iterator it = itNext++;
-        if (std::string::npos != it->first.find(strGuid))
-            CompatibleMapStore.erase(it);
+        CompatibleMapStore.erase(key);
+        for (uint8 i = 0; i < key.size; ++i)
+            if (key.slots[i] != *slot)
+                std::erase(QueueSlotStore[key.slots[i]].compatibleKeys, key);
     }
 }
 
+/**
+   Finds or creates the compatibility cache entry of a list of guids
+
+   @param[in]     key Queue slots of the guids
+   @return Cache entry, nullptr if the key cannot be cached
+*/
+LfgCompatibilityData* LFGQueue::GetOrCreateCompatibilityData(LfgCompatibilityKey const& key)
+{
+    if (!key.IsValid())
+        return nullptr;
+
+    // guids may have left the queue while their combination was being checked
+    for (uint8 i = 0; i < key.size; ++i)
+        if (QueueSlotStore[key.slots[i]].guid.IsEmpty())
+            return nullptr;
+
+    auto [itr, isNew] = CompatibleMapStore.try_emplace(key);
+    if (isNew)
+        for (uint8 i = 0; i < key.size; ++i)
+            QueueSlotStore[key.slots[i]].compatibleKeys.push_back(key);
+
+    return &itr->second;
+}
+
 /**
    Stores the compatibility of a list of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     key Queue slots of the guids
    @param[in]     compatibles type of compatibility
 */
-void LFGQueue::SetCompatibles(std::string const& key, LfgCompatibility compatibles)
+void LFGQueue::SetCompatibles(LfgCompatibilityKey const& key, LfgCompatibility compatibles)
 {
-    LfgCompatibilityData& data = CompatibleMapStore[key];
-    data.compatibility = compatibles;
+    if (LfgCompatibilityData* data = GetOrCreateCompatibilityData(key))
+        data->compatibility = compatibles;
 }
 
-void LFGQueue::SetCompatibilityData(std::string const& key, LfgCompatibilityData const& data)
+void LFGQueue::SetCompatibilityData(LfgCompatibilityKey const& key, LfgCompatibilityData const& data)
 {
-    CompatibleMapStore[key] = data;
+    if (LfgCompatibilityData* storedData = GetOrCreateCompatibilityData(key))
+        *storedData = data;
 }
 
 /**
    Get the compatibility of a group of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     key Queue slots of the guids
    @return LfgCompatibility type of compatibility
 */
-LfgCompatibility LFGQueue::GetCompatibles(std::string const& key)
+LfgCompatibility LFGQueue::GetCompatibles(LfgCompatibilityKey const& key)
 {
     LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
     if (itr != CompatibleMapStore.end())
@@ -281,7 +394,7 @@ LfgCompatibility LFGQueue::GetCompatibles(std::string const& key)
     return LFG_COMPATIBILITY_PENDING;
 }
 
-LfgCompatibilityData* LFGQueue::GetCompatibilityData(std::string const& key)
+LfgCompatibilityData* LFGQueue::GetCompatibilityData(LfgCompatibilityKey const& key)
 {
     LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
     if (itr != CompatibleMapStore.end())
@@ -324,8 +437,8 @@ uint8 LFGQueue::FindGroups()
 */
 LfgCompatibility LFGQueue::FindNewGroups(GuidList& check, GuidList& all)
 {
-    std::string strGuids = ConcatenateGuids(check);
-    LfgCompatibility compatibles = GetCompatibles(strGuids);
+    LfgCompatibilityKey key = BuildCompatibilityKey(check);
+    LfgCompatibility compatibles = GetCompatibles(key);
 
     TC_LOG_DEBUG("lfg.queue.match.check", "Guids: ({}): {} - all({})", GetDetailedMatchRoles(check), GetCompatibleString(compatibles), GetDetailedMatchRoles(all));
     if (compatibles == LFG_COMPATIBILITY_PENDING) // Not previously cached, calculate
@@ -334,7 +447,7 @@ LfgCompatibility LFGQueue::FindNewGroups(GuidList& check, GuidList& all)
     if (compatibles == LFG_COMPATIBLES_BAD_STATES && sLFGMgr->AllQueued(check))
     {
         TC_LOG_DEBUG("lfg.queue.match.check", "Guids: ({}) compatibles (cached) changed from bad states to match", GetDetailedMatchRoles(check));
-        SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
+        SetCompatibles(key, LFG_COMPATIBLES_MATCH);
         return LFG_COMPATIBLES_MATCH;
     }
 
@@ -362,7 +475,7 @@ LfgCompatibility LFGQueue::FindNewGroups(GuidList& check, GuidList& all)
 */
 LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
 {
-    std::string strGuids = ConcatenateGuids(check);
+    LfgCompatibilityKey key = BuildCompatibilityKey(check);
     LfgProposal proposal;
     LfgDungeonSet proposalDungeons;
     LfgGroupsMap proposalGroups;
@@ -385,8 +498,8 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         LfgCompatibility child_compatibles = CheckCompatibility(check);
         if (child_compatibles < LFG_COMPATIBLES_WITH_LESS_PLAYERS) // Group not compatible
         {
-            TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) child {} not compatibles", strGuids, GetDetailedMatchRoles(check));
-            SetCompatibles(strGuids, child_compatibles);
+            TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) child {} not compatibles", GetCompatibilityKeyString(key), GetDetailedMatchRoles(check));
+            SetCompatibles(key, child_compatibles);
             return child_compatibles;
         }
         check.push_front(frontGuid);
@@ -430,22 +543,22 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         data.roles = itQueue->second.roles;
         LFGMgr::CheckGroupRoles(data.roles);
 
-        UpdateBestCompatibleInQueue(itQueue, strGuids, data.roles);
-        SetCompatibilityData(strGuids, data);
+        UpdateBestCompatibleInQueue(itQueue, key, data.roles);
+        SetCompatibilityData(key, data);
         return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
     }
 
     if (numLfgGroups > 1)
     {
         TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) More than one Lfggroup ({})", GetDetailedMatchRoles(check), numLfgGroups);
-        SetCompatibles(strGuids, LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS);
+        SetCompatibles(key, LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS);
         return LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS;
     }
 
     if (numPlayers > MAX_GROUP_SIZE)
     {
         TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Too many players ({})", GetDetailedMatchRoles(check), numPlayers);
-        SetCompatibles(strGuids, LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS);
+        SetCompatibles(key, LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS);
         return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
     }
 
@@ -473,7 +586,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         if (uint8 playersize = numPlayers - proposalRoles.size())
         {
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) not compatible, {} players are ignoring each other", GetDetailedMatchRoles(check), playersize);
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_HAS_IGNORES);
+            SetCompatibles(key, LFG_INCOMPATIBLES_HAS_IGNORES);
             return LFG_INCOMPATIBLES_HAS_IGNORES;
         }
 
@@ -485,7 +598,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
                 o << ", " << it->first.ToHexString() << ": " << GetRolesString(it->second);
 
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Roles not compatible{}", GetDetailedMatchRoles(check), o.str());
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_ROLES);
+            SetCompatibles(key, LFG_INCOMPATIBLES_NO_ROLES);
             return LFG_INCOMPATIBLES_NO_ROLES;
         }
 
@@ -505,7 +618,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         if (proposalDungeons.empty())
         {
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) No compatible dungeons{}", GetDetailedMatchRoles(check), o.str());
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_DUNGEONS);
+            SetCompatibles(key, LFG_INCOMPATIBLES_NO_DUNGEONS);
             return LFG_INCOMPATIBLES_NO_DUNGEONS;
         }
     }
@@ -526,9 +639,9 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         data.roles = proposalRoles;
 
         for (GuidList::const_iterator itr = check.begin(); itr != check.end(); ++itr)
-            UpdateBestCompatibleInQueue(QueueDataStore.find(*itr), strGuids, data.roles);
+            UpdateBestCompatibleInQueue(QueueDataStore.find(*itr), key, data.roles);
 
-        SetCompatibilityData(strGuids, data);
+        SetCompatibilityData(key, data);
         return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
     }
 
@@ -539,7 +652,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
     if (!sLFGMgr->AllQueued(check))
     {
         TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Group MATCH but can't create proposal!", GetDetailedMatchRoles(check));
-        SetCompatibles(strGuids, LFG_COMPATIBLES_BAD_STATES);
+        SetCompatibles(key, LFG_COMPATIBLES_BAD_STATES);
         return LFG_COMPATIBLES_BAD_STATES;
     }
 
@@ -581,7 +694,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
     sLFGMgr->AddProposal(proposal);
 
     TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) MATCH! Group formed", GetDetailedMatchRoles(check));
-    SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
+    SetCompatibles(key, LFG_COMPATIBLES_MATCH);
     return LFG_COMPATIBLES_MATCH;
 }
 
@@ -623,7 +736,7 @@ void LFGQueue::UpdateQueueTimers(uint8 queueId, time_t currTime)
                 break;
         }
 
-        if (queueinfo.bestCompatible.empty())
+        if (!queueinfo.bestCompatible.IsValid())
             FindBestCompatibleInQueue(itQueue);
 
         LfgQueueStatusData queueData(queueId, dungeonId, waitTime, wtAvg, wtTank, wtHealer, wtDps, queuedTime, queueinfo.tanks, queueinfo.healers, queueinfo.dps);
@@ -677,7 +790,7 @@ std::string LFGQueue::DumpCompatibleInfo(bool full /* = false */) const
     if (full)
         for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
         {
-            o << "(" << itr->first << "): " << GetCompatibleString(itr->second.compatibility);
+            o << "(" << GetCompatibilityKeyString(itr->first) << "): " << GetCompatibleString(itr->second.compatibility);
             if (!itr->second.roles.empty())
             {
                 o << " (";
@@ -700,30 +813,27 @@ std::string LFGQueue::DumpCompatibleInfo(bool full /* = false */) const
 void LFGQueue::FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue)
 {
     TC_LOG_DEBUG("lfg.queue.compatibles.find", "{}", itrQueue->first.ToString());
-    std::string sguid = itrQueue->first.ToHexString();
+    uint32 const* slot = Trinity::Containers::MapGetValuePtr(QueueSlotsByGuid, itrQueue->first);
+    if (!slot)
+        return;
 
-    for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
-        if (itr->second.compatibility == LFG_COMPATIBLES_WITH_LESS_PLAYERS &&
-            std::string::npos != itr->first.find(sguid))
-        {
+    for (LfgCompatibilityKey const& key : QueueSlotStore[*slot].compatibleKeys)
+    {
+        LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.find(key);
+        if (itr != CompatibleMapStore.end() && itr->second.compatibility == LFG_COMPATIBLES_WITH_LESS_PLAYERS)
             UpdateBestCompatibleInQueue(itrQueue, itr->first, itr->second.roles);
-        }
+    }
 }
 
-void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles)
+void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, LfgCompatibilityKey const& key, LfgRolesMap const& roles)
 {
     LfgQueueData& queueData = itrQueue->second;
 
-    uint8 storedSize = queueData.bestCompatible.empty() ? 0 :
-        std::count(queueData.bestCompatible.begin(), queueData.bestCompatible.end(), '|') + 1;
-
-    uint8 size = std::count(key.begin(), key.end(), '|') + 1;
-
-    if (size <= storedSize)
+    if (key.size <= queueData.bestCompatible.size)
         return;
 
     TC_LOG_DEBUG("lfg.queue.compatibles.update", "Changed ({}) to ({}) as best compatible group for {}",
-        queueData.bestCompatible, key, itrQueue->first.ToString());
+        GetCompatibilityKeyString(queueData.bestCompatible), GetCompatibilityKeyString(key), itrQueue->first.ToString());
 
     queueData.bestCompatible = key;
     queueData.tanks = LFG_TANKS_NEEDED;
@@ -19,7 +19,10 @@
 #define _LFGQUEUE_H
 
 #include "LFG.h"
+#include <array>
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 namespace lfg
 {
@@ -38,6 +41,23 @@ enum LfgCompatibility
     LFG_COMPATIBLES_MATCH                                  // Must be the last one
 };
 
+/// Queue slots of a combination of queued guids in ascending order, used as compatibility cache key
+struct LfgCompatibilityKey
+{
+    std::array<uint32, LFG_TANKS_NEEDED + LFG_HEALERS_NEEDED + LFG_DPS_NEEDED> slots = { };
+    uint8 size = 0;                                        ///< Number of used slots, 0 for combinations that cannot be cached
+
+    bool IsValid() const { return size != 0; }
+    bool Contains(uint32 slot) const;
+
+    bool operator==(LfgCompatibilityKey const& right) const = default;
+};
+
+struct LfgCompatibilityKeyHash
+{
+    std::size_t operator()(LfgCompatibilityKey const& key) const;
+};
+
 struct LfgCompatibilityData
 {
     LfgCompatibilityData(): compatibility(LFG_COMPATIBILITY_PENDING) { }
@@ -65,7 +85,14 @@ struct LfgQueueData
     uint8 dps;                                             ///< Dps needed
     LfgDungeonSet dungeons;                                ///< Selected Player/Group Dungeon/s
     LfgRolesMap roles;                                     ///< Selected Player Role/s
-    std::string bestCompatible;                            ///< Best compatible combination of people queued
+    LfgCompatibilityKey bestCompatible;                    ///< Best compatible combination of people queued
+};
+
+/// Small integer id of a queued guid, used to build compatibility keys
+struct LfgQueueSlot
+{
+    ObjectGuid guid;
+    std::vector<LfgCompatibilityKey> compatibleKeys;       ///< Cached compatibility entries containing this slot
 };
 
 struct LfgWaitTime
@@ -76,7 +103,7 @@ struct LfgWaitTime
 };
 
 typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
-typedef std::map<std::string, LfgCompatibilityData> LfgCompatibleContainer;
+typedef std::unordered_map<LfgCompatibilityKey, LfgCompatibilityData, LfgCompatibilityKeyHash> LfgCompatibleContainer;
 typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
 
 /**
@@ -123,14 +150,20 @@ class TC_GAME_API LFGQueue
         void RemoveFromNewQueue(ObjectGuid guid);
         void RemoveFromCurrentQueue(ObjectGuid guid);
 
-        void SetCompatibles(std::string const& key, LfgCompatibility compatibles);
-        LfgCompatibility GetCompatibles(std::string const& key);
+        uint32 AcquireQueueSlot(ObjectGuid guid);
+        void ReleaseQueueSlot(ObjectGuid guid);
+        LfgCompatibilityKey BuildCompatibilityKey(GuidList const& check) const;
+        std::string GetCompatibilityKeyString(LfgCompatibilityKey const& key) const;
+
+        LfgCompatibilityData* GetOrCreateCompatibilityData(LfgCompatibilityKey const& key);
+        void SetCompatibles(LfgCompatibilityKey const& key, LfgCompatibility compatibles);
+        LfgCompatibility GetCompatibles(LfgCompatibilityKey const& key);
         void RemoveFromCompatibles(ObjectGuid guid);
 
-        void SetCompatibilityData(std::string const& key, LfgCompatibilityData const& compatibles);
-        LfgCompatibilityData* GetCompatibilityData(std::string const& key);
+        void SetCompatibilityData(LfgCompatibilityKey const& key, LfgCompatibilityData const& compatibles);
+        LfgCompatibilityData* GetCompatibilityData(LfgCompatibilityKey const& key);
         void FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
-        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles);
+        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, LfgCompatibilityKey const& key, LfgRolesMap const& roles);
 
         LfgCompatibility FindNewGroups(GuidList& check, GuidList& all);
         LfgCompatibility CheckCompatibility(GuidList check);
@@ -138,6 +171,9 @@ class TC_GAME_API LFGQueue
         // Queue
         LfgQueueDataContainer QueueDataStore;              ///< Queued groups
         LfgCompatibleContainer CompatibleMapStore;         ///< Compatible dungeons
+        std::vector<LfgQueueSlot> QueueSlotStore;          ///< Queued guids by slot, slot 0 is never used
+        std::unordered_map<ObjectGuid, uint32> QueueSlotsByGuid; ///< Slot of each queued guid
+        std::vector<uint32> FreeQueueSlots;                ///< Released slots for reuse
 
         LfgWaitTimesContainer waitTimesAvgStore;           ///< Average wait time to find a group queuing as multiple roles
         LfgWaitTimesContainer waitTimesTankStore;          ///< Average wait time to find a group queuing as tank
@@ -46,6 +46,7 @@
 #include "ZoneScript.h"
 #include "advstd.h"
 #include <bit>
+#include <iterator>
 
 AreaTrigger::AreaTrigger() : WorldObject(false), MapObject(), _spawnId(0), _aurEff(nullptr),
     _duration(0), _totalDuration(0), _verticesUpdatePreviousOrientation(std::numeric_limits<float>::infinity()),
@@ -853,18 +854,27 @@ void AreaTrigger::SearchUnitInBoundedPlane(UF::AreaTriggerBoundedPlane const& bo
 
 void AreaTrigger::HandleUnitEnterExit(std::vector<Unit*> const& newTargetList)
 {
-    GuidUnorderedSet exitUnits(std::move(_insideUnits));
+    GuidVector insideUnits;
+    insideUnits.reserve(newTargetList.size());
 
     std::vector<Unit*> enteringUnits;
 
     for (Unit* unit : newTargetList)
     {
-        if (exitUnits.erase(unit->GetGUID()) == 0) // erase(key_type) returns number of elements erased
+        if (!_insideUnits.contains(unit->GetGUID()))
             enteringUnits.push_back(unit);
 
-        _insideUnits.insert(unit->GetGUID());
+        insideUnits.push_back(unit->GetGUID());
     }
 
+    std::ranges::sort(insideUnits);
+
+    // both lists are sorted, units that left are found in a single pass
+    GuidVector exitUnits;
+    std::ranges::set_difference(_insideUnits, insideUnits, std::back_inserter(exitUnits));
+
+    _insideUnits.replace(std::move(insideUnits));
+
     // Handle after _insideUnits have been reinserted so we can use GetInsideUnits() in hooks
     for (Unit* unit : enteringUnits)
     {
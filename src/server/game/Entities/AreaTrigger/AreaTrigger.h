@@ -22,6 +22,7 @@
 #include "GridObject.h"
 #include "MapObject.h"
 #include "AreaTriggerTemplate.h"
+#include "FlatSet.h"
 
 class AuraEffect;
 class AreaTriggerAI;
@@ -163,7 +164,7 @@ class TC_GAME_API AreaTrigger final : public WorldObject, public GridObject<Area
         void SetDuration(int32 newDuration);
         void Delay(int32 delaytime) { SetDuration(GetDuration() - delaytime); }
 
-        GuidUnorderedSet const& GetInsideUnits() const { return _insideUnits; }
+        Trinity::Containers::FlatSet<ObjectGuid> const& GetInsideUnits() const { return _insideUnits; }
 
         AreaTriggerCreateProperties const* GetCreateProperties() const { return _areaTriggerCreateProperties; }
         AreaTriggerTemplate const* GetTemplate() const { return _areaTriggerTemplate; }
@@ -253,7 +254,7 @@ class TC_GAME_API AreaTrigger final : public WorldObject, public GridObject<Area
 
         AreaTriggerCreateProperties const* _areaTriggerCreateProperties;
         AreaTriggerTemplate const* _areaTriggerTemplate;
-        GuidUnorderedSet _insideUnits;
+        Trinity::Containers::FlatSet<ObjectGuid> _insideUnits;
 
         std::unique_ptr<AreaTriggerAI> _ai;
 };
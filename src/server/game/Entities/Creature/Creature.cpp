@@ -169,7 +169,7 @@ void CreatureTemplate::InitializeQueryData()
 {
     for (uint8 loc = LOCALE_enUS; loc < TOTAL_LOCALES; ++loc)
     {
-        if (!sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && loc != DEFAULT_LOCALE)
+        if (!sWorld->IsLocaleLoaded(LocaleConstant(loc)))
             continue;
 
         QueryData[loc] = BuildQueryData(static_cast<LocaleConstant>(loc), DIFFICULTY_NONE);
@@ -323,7 +323,8 @@ Creature::Creature(bool isWorldObject) : Unit(isWorldObject), MapObject(), m_Pla
     m_AlreadyCallAssistance(false), m_AlreadySearchedAssistance(false), m_cannotReachTarget(false), m_cannotReachTimer(0),
     m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_homePosition(), m_transportHomePosition(),
     m_creatureInfo(nullptr), m_creatureData(nullptr), m_creatureDifficulty(nullptr), m_stringIds(), _waypointPathId(0), _currentWaypointNodeInfo(0, 0),
-    m_formation(nullptr), m_triggerJustAppeared(true), m_respawnCompatibilityMode(false), _aggroGracePeriodExpired(false), _lastDamagedTime(0),
+    m_formation(nullptr), m_triggerJustAppeared(true), m_respawnCompatibilityMode(false),
+    _updateLod(CreatureUpdateLod::Full), _lodAccumulatedDiff(0), _lodCheckTimer(0), _aggroGracePeriodExpired(false), _lastDamagedTime(0),
     _regenerateHealth(true), _creatureImmunitiesId(0), _gossipMenuId(0), _sparringHealthPct(0)
 {
     m_regenTimer = CREATURE_REGEN_INTERVAL;
@@ -751,6 +752,84 @@ void Creature::ApplyAllStaticFlags(CreatureStaticFlagsHolder const& flags)
     m_updateFlag.NoBirthAnim = flags.HasFlag(CREATURE_STATIC_FLAG_4_NO_BIRTH_ANIM);
 }
 
+namespace
+{
+// any player, dead ones still see the creature
+class NearestObserverCheck
+{
+public:
+    NearestObserverCheck(WorldObject const* obj, float range) : _obj(obj), _range(range) { }
+
+    bool operator()(Player* player)
+    {
+        if (!_obj->IsWithinDist(player, _range))
+            return false;
+
+        _range = _obj->GetDistance(player);
+        return true;
+    }
+
+private:
+    WorldObject const* _obj;
+    float _range;
+};
+
+constexpr int32 UPDATE_LOD_CHECK_INTERVAL = 1000;
+}
+
+bool Creature::IsExemptFromUpdateLod() const
+{
+    return isActiveObject() || IsEngaged() || GetCharmerOrOwnerGUID().IsPlayer() || GetVehicleKit() || GetScriptId() || !GetAIName().empty();
+}
+
+CreatureUpdateLod Creature::SelectUpdateLod() const
+{
+    if (IsExemptFromUpdateLod())
+        return CreatureUpdateLod::Full;
+
+    float activationRange = GetGridActivationRange();
+    Player* observer = nullptr;
+    NearestObserverCheck check(this, activationRange);
+    Trinity::PlayerLastSearcher<NearestObserverCheck> searcher(this, observer, check);
+    Cell::VisitWorldObjects(this, searcher, activationRange);
+
+    if (observer && IsWithinDist(observer, GetVisibilityRange()))
+        return CreatureUpdateLod::Full;
+
+    if (observer || !sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_DORMANT_INTERVAL))
+        return sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_REDUCED_INTERVAL) ? CreatureUpdateLod::Reduced : CreatureUpdateLod::Full;
+
+    return CreatureUpdateLod::Dormant;
+}
+
+bool Creature::PrepareLodUpdate(uint32 diff, uint32& updateDiff)
+{
+    _lodAccumulatedDiff += diff;
+
+    uint32 interval = 0;
+    if (_updateLod == CreatureUpdateLod::Reduced)
+        interval = sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_REDUCED_INTERVAL);
+    else if (_updateLod == CreatureUpdateLod::Dormant)
+        interval = sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_DORMANT_INTERVAL);
+
+    // getting engaged or scripted activity must not wait for the next slow update
+    if (_lodAccumulatedDiff < interval && !IsExemptFromUpdateLod())
+        return false;
+
+    updateDiff = _lodAccumulatedDiff;
+    _lodAccumulatedDiff = 0;
+
+    // slower tiers are checked on each of their updates so approaching players are noticed quickly
+    _lodCheckTimer -= int32(updateDiff);
+    if (_updateLod != CreatureUpdateLod::Full || _lodCheckTimer <= 0)
+    {
+        _updateLod = SelectUpdateLod();
+        _lodCheckTimer = UPDATE_LOD_CHECK_INTERVAL;
+    }
+
+    return true;
+}
+
 void Creature::Update(uint32 diff)
 {
     if (IsAIEnabled() && m_triggerJustAppeared && m_deathState != DEAD)
@@ -1855,6 +1934,19 @@ bool Creature::CreateFromProto(ObjectGuid::LowType guidlow, uint32 entry, Creatu
 
 bool Creature::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool allowDuplicate)
 {
+    CreatureData const* data = sObjectMgr->GetCreatureData(spawnId);
+    if (!data)
+    {
+        TC_LOG_ERROR("sql.sql", "Creature (SpawnID {}) not found in table `creature`, can't load. ", spawnId);
+        return false;
+    }
+
+    return LoadFromDB(data, map, addToMap, allowDuplicate);
+}
+
+bool Creature::LoadFromDB(CreatureData const* data, Map* map, bool addToMap, bool allowDuplicate)
+{
+    ObjectGuid::LowType spawnId = data->spawnId;
     if (!allowDuplicate)
     {
         // If an alive instance of this spawnId is already found, skip creation
@@ -1885,13 +1977,6 @@ bool Creature::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap,
         }
     }
 
-    CreatureData const* data = sObjectMgr->GetCreatureData(spawnId);
-    if (!data)
-    {
-        TC_LOG_ERROR("sql.sql", "Creature (SpawnID {}) not found in table `creature`, can't load. ", spawnId);
-        return false;
-    }
-
     m_spawnId = spawnId;
 
     m_respawnCompatibilityMode = ((data->spawnGroupData->flags & SPAWNGROUP_FLAG_COMPATIBILITY_MODE) != 0);
@@ -1951,6 +2036,9 @@ bool Creature::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap,
 
     SetSpawnHealth();
 
+    if (InstanceMap* instance = map->ToInstanceMap())
+        instance->RestoreHibernatedState(this);
+
     SelectWildBattlePetLevel();
 
     // checked at creature_template loading
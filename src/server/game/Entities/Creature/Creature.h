@@ -71,6 +71,13 @@ enum class VendorDataTypeFlags : int32
 
 DEFINE_ENUM_FLAG(VendorDataTypeFlags);
 
+enum class CreatureUpdateLod : uint8
+{
+    Full,       // a player is within visibility range
+    Reduced,    // only within grid activation range of a player
+    Dormant     // cell is kept active by something else
+};
+
 static constexpr uint8 WILD_BATTLE_PET_DEFAULT_LEVEL = 1;
 static constexpr size_t CREATURE_TAPPERS_SOFT_CAP = 5;
 
@@ -112,6 +119,10 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         void Update(uint32 time) override;                         // overwrited Unit::Update
         void Heartbeat() override;
 
+        // creatures no player can see are updated less often with the accumulated diff
+        // returns false if this map update skips the creature, otherwise the diff to pass to Update
+        bool PrepareLodUpdate(uint32 diff, uint32& updateDiff);
+
         void GetRespawnPosition(float &x, float &y, float &z, float* ori = nullptr, float* dist = nullptr) const;
         bool IsSpawnedOnTransport() const { return m_creatureData && m_creatureData->mapId != GetMapId(); }
 
@@ -287,6 +298,7 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         void setDeathState(DeathState s) override;                   // override virtual Unit::setDeathState
 
         bool LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool allowDuplicate);
+        bool LoadFromDB(CreatureData const* data, Map* map, bool addToMap, bool allowDuplicate);
         void SaveToDB();
                                                             // overriden in Pet
         virtual void SaveToDB(uint32 mapid, std::vector<Difficulty> const& spawnDifficulties);
@@ -583,6 +595,13 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         bool m_triggerJustAppeared;
         bool m_respawnCompatibilityMode;
 
+        bool IsExemptFromUpdateLod() const;
+        CreatureUpdateLod SelectUpdateLod() const;
+
+        CreatureUpdateLod _updateLod;
+        uint32 _lodAccumulatedDiff;
+        int32 _lodCheckTimer;
+
         bool _aggroGracePeriodExpired;
 
         /* Spell focus system */
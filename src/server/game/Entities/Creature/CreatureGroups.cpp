@@ -19,12 +19,15 @@
 #include "Creature.h"
 #include "CreatureAI.h"
 #include "DatabaseEnv.h"
+#include "G3DPosition.hpp"
 #include "Log.h"
 #include "Map.h"
 #include "MapUtils.h"
 #include "MotionMaster.h"
+#include "MoveSpline.h"
 #include "MovementGenerator.h"
 #include "ObjectMgr.h"
+#include "PathGenerator.h"
 #include "ZoneScript.h"
 
 FormationMgr::FormationMgr() = default;
@@ -296,6 +299,34 @@ void CreatureGroup::LeaderStartedMoving()
     }
 }
 
+FormationLeaderMovement const* CreatureGroup::GetLeaderMovement()
+{
+    if (!_leader || _leader->movespline->Finalized())
+        return nullptr;
+
+    // members updated between two leader updates launch from the same leader state, predict it only once for all of them
+    if (_leaderMovement.SplineId == _leader->movespline->GetId() && _leaderMovement.LeaderPosition == _leader->GetPosition())
+        return &_leaderMovement;
+
+    _leaderMovement.SplineId = _leader->movespline->GetId();
+    _leaderMovement.LeaderPosition = _leader->GetPosition();
+    _leaderMovement.RelativeAngle = _leader->GetRelativeAngle(Vector3ToPosition(_leader->movespline->CurrentDestination()));
+
+    // travel distance covered by the leader during a 1650ms member spline
+    float travelDist = _leader->movespline->Velocity() * 1.65f;
+
+    _leaderMovement.Destination = _leader->GetPosition();
+    _leader->MovePositionToFirstCollision(_leaderMovement.Destination, travelDist, _leaderMovement.RelativeAngle);
+
+    // single navmesh validation for the whole formation, members close to their slot follow the leader in a straight line when it passes
+    PathGenerator path(_leader);
+    bool result = path.CalculatePath(_leaderMovement.Destination.GetPositionX(), _leaderMovement.Destination.GetPositionY(), _leaderMovement.Destination.GetPositionZ());
+    _leaderMovement.HasDirectPath = result && path.GetPath().size() <= 2
+        && !(path.GetPathType() & ~(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH));
+
+    return &_leaderMovement;
+}
+
 bool CreatureGroup::CanLeaderStartMoving() const
 {
     for (auto const& [member, _] : _members)
@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "ObjectGuid.h"
+#include "Position.h"
 #include <unordered_map>
 
 enum GroupAIFlags
@@ -34,7 +35,6 @@ enum GroupAIFlags
 class Creature;
 class CreatureGroup;
 class Unit;
-struct Position;
 
 struct FormationInfo
 {
@@ -70,6 +70,16 @@ class TC_GAME_API FormationMgr
         void AddFormationMember(ObjectGuid::LowType spawnId, float followAng, float followDist, ObjectGuid::LowType leaderSpawnId, uint32 groupAI);
 };
 
+// Predicted position of a moving formation leader, shared by all members launching on the same leader spline
+struct FormationLeaderMovement
+{
+    uint32 SplineId = 0;
+    Position LeaderPosition;
+    Position Destination;
+    float RelativeAngle = 0.f;
+    bool HasDirectPath = false;     // navmesh allows walking straight from the leader to Destination
+};
+
 class TC_GAME_API CreatureGroup
 {
     private:
@@ -82,6 +92,8 @@ class TC_GAME_API CreatureGroup
         bool _formed;
         bool _engaging;
 
+        FormationLeaderMovement _leaderMovement;
+
     public:
         //Group cannot be created empty
         explicit CreatureGroup(ObjectGuid::LowType leaderSpawnId);
@@ -103,6 +115,7 @@ class TC_GAME_API CreatureGroup
         void FormationReset(bool dismiss);
 
         void LeaderStartedMoving();
+        FormationLeaderMovement const* GetLeaderMovement();
         void MemberEngagingTarget(Creature* member, Unit* target);
         bool CanLeaderStartMoving() const;
 
@@ -54,6 +54,7 @@
 #include "SpellMgr.h"
 #include "Transport.h"
 #include "Util.h"
+#include "ViewerDependentValues.h"
 #include "Vignette.h"
 #include "World.h"
 #include <G3D/Box.h>
@@ -65,7 +66,7 @@ void GameObjectTemplate::InitializeQueryData()
 {
     for (uint8 loc = LOCALE_enUS; loc < TOTAL_LOCALES; ++loc)
     {
-        if (!sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && loc != DEFAULT_LOCALE)
+        if (!sWorld->IsLocaleLoaded(LocaleConstant(loc)))
             continue;
 
         QueryData[loc] = BuildQueryData(static_cast<LocaleConstant>(loc));
@@ -1941,7 +1942,7 @@ void GameObject::SaveToDB(uint32 mapid, std::vector<Difficulty> const& spawnDiff
     WorldDatabase.CommitTransaction(trans);
 }
 
-bool GameObject::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool)
+bool GameObject::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool allowDuplicate)
 {
     GameObjectData const* data = sObjectMgr->GetGameObjectData(spawnId);
     if (!data)
@@ -1950,6 +1951,12 @@ bool GameObject::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap
         return false;
     }
 
+    return LoadFromDB(data, map, addToMap, allowDuplicate);
+}
+
+bool GameObject::LoadFromDB(GameObjectData const* data, Map* map, bool addToMap, bool)
+{
+    ObjectGuid::LowType spawnId = data->spawnId;
     uint32 entry = data->id;
     //uint32 map_id = data->mapid;                          // already used before call
 
@@ -3997,6 +4004,8 @@ void GameObject::EnableCollision(bool enable)
         GetMap()->InsertGameObjectModel(*m_model);*/
 
     m_model->EnableCollision(enable);
+    if (IsInWorld())
+        GetMap()->InvalidateLineOfSightCache();
 }
 
 void GameObject::UpdateModel()
@@ -4063,6 +4072,11 @@ void GameObject::BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags,
         m_gameObjectData->WriteUpdate(*data, flags, this, target);
 }
 
+bool GameObject::HasViewerDependentValuesUpdate() const
+{
+    return UF::HasViewerDependentChanges(*m_objectData) || UF::HasViewerDependentChanges(*m_gameObjectData);
+}
+
 void GameObject::BuildValuesUpdateForPlayerWithMask(UpdateData* data, UF::ObjectData::Mask const& requestedObjectMask,
     UF::GameObjectData::Mask const& requestedGameObjectMask, Player const* target) const
 {
@@ -171,6 +171,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
     protected:
         void BuildValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
         void BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
+        bool HasViewerDependentValuesUpdate() const override;
         void ClearUpdateMask(bool remove) override;
 
     public:
@@ -228,6 +229,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         void SaveToDB();
         void SaveToDB(uint32 mapid, std::vector<Difficulty> const& spawnDifficulties);
         bool LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool = true); // arg4 is unused, only present to match the signature on Creature
+        bool LoadFromDB(GameObjectData const* data, Map* map, bool addToMap, bool = true);
         static bool DeleteFromDB(ObjectGuid::LowType spawnId);
 
         ObjectGuid GetCreatorGUID() const override { return m_gameObjectData->CreatedBy; }
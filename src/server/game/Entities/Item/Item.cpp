@@ -494,9 +494,6 @@ Item::Item()
     m_lootGenerated = false;
     mb_in_trade = false;
 
-    m_paidMoney = 0;
-    m_paidExtendedCost = 0;
-
     m_randomBonusListId = 0;
     m_gemScalingLevels = { };
 
@@ -1255,6 +1252,10 @@ void Item::SetItemRandomBonusList(ItemRandomBonusListId bonusListId)
 
 void Item::SetState(ItemUpdateState state, Player* forplayer)
 {
+    // item changes reported to the owner include entry changes (gift wrapping) and removals
+    if (forplayer)
+        forplayer->InvalidateItemEntryIndex();
+
     if (uState == ITEM_NEW && state == ITEM_REMOVED)
     {
         // pretend the item never existed
@@ -1771,7 +1772,7 @@ bool Item::IsBindedNotWith(Player const* player) const
         return false;
 
     if (IsBOPTradeable())
-        if (allowedGUIDs.find(player->GetGUID()) != allowedGUIDs.end())
+        if (_tradeState && _tradeState->AllowedLooters.contains(player->GetGUID()))
             return false;
 
     // BOA item case
@@ -1932,9 +1933,14 @@ void Item::SetNotRefundable(Player* owner, bool changestate /*= true*/, Characte
     if (changestate)
         SetState(ITEM_CHANGED, owner);
 
-    SetRefundRecipient(ObjectGuid::Empty);
-    SetPaidMoney(0);
-    SetPaidExtendedCost(0);
+    if (_tradeState)
+    {
+        _tradeState->RefundRecipient.Clear();
+        _tradeState->PaidMoney = 0;
+        _tradeState->PaidExtendedCost = 0;
+        if (_tradeState->AllowedLooters.empty())
+            _tradeState.reset();
+    }
     DeleteRefundDataFromDB(trans);
 
     owner->DeleteRefundReference(GetGUID());
@@ -1955,17 +1961,19 @@ bool Item::IsRefundExpired() const
 void Item::SetSoulboundTradeable(GuidSet const& allowedLooters)
 {
     SetItemFlag(ITEM_FIELD_FLAG_BOP_TRADEABLE);
-    allowedGUIDs = allowedLooters;
+    ModifyTradeState().AllowedLooters = allowedLooters;
 }
 
 void Item::ClearSoulboundTradeable(Player* currentOwner)
 {
     RemoveItemFlag(ITEM_FIELD_FLAG_BOP_TRADEABLE);
-    if (allowedGUIDs.empty())
+    if (!_tradeState || _tradeState->AllowedLooters.empty())
         return;
 
     currentOwner->GetSession()->GetCollectionMgr()->AddItemAppearance(this);
-    allowedGUIDs.clear();
+    _tradeState->AllowedLooters.clear();
+    if (!_tradeState->RefundRecipient && !_tradeState->PaidMoney && !_tradeState->PaidExtendedCost)
+        _tradeState.reset();
     SetState(ITEM_CHANGED, currentOwner);
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_BOP_TRADE);
     stmt->setUInt64(0, GetGUID().GetCounter());
@@ -350,13 +350,13 @@ class TC_GAME_API Item : public Object
 
         // Item Refund system
         void SetNotRefundable(Player* owner, bool changestate = true, CharacterDatabaseTransaction* trans = nullptr, bool addToCollection = true);
-        void SetRefundRecipient(ObjectGuid const& guid) { m_refundRecipient = guid; }
-        void SetPaidMoney(uint64 money) { m_paidMoney = money; }
-        void SetPaidExtendedCost(uint32 iece) { m_paidExtendedCost = iece; }
+        void SetRefundRecipient(ObjectGuid const& guid) { ModifyTradeState().RefundRecipient = guid; }
+        void SetPaidMoney(uint64 money) { ModifyTradeState().PaidMoney = money; }
+        void SetPaidExtendedCost(uint32 iece) { ModifyTradeState().PaidExtendedCost = iece; }
 
-        ObjectGuid const& GetRefundRecipient() const { return m_refundRecipient; }
-        uint64 GetPaidMoney() const { return m_paidMoney; }
-        uint32 GetPaidExtendedCost() const { return m_paidExtendedCost; }
+        ObjectGuid const& GetRefundRecipient() const { return _tradeState ? _tradeState->RefundRecipient : ObjectGuid::Empty; }
+        uint64 GetPaidMoney() const { return _tradeState ? _tradeState->PaidMoney : 0; }
+        uint32 GetPaidExtendedCost() const { return _tradeState ? _tradeState->PaidExtendedCost : 0; }
 
         uint32 GetPlayedTime() const;
         bool IsRefundExpired() const;
@@ -450,10 +450,24 @@ class TC_GAME_API Item : public Object
         ItemUpdateState uState;
         int16 uQueuePos;
         bool mb_in_trade;                                   // true if item is currently in trade-window
-        ObjectGuid m_refundRecipient;
-        uint64 m_paidMoney;
-        uint32 m_paidExtendedCost;
-        GuidSet allowedGUIDs;
+
+        // refund and soulbound trade data, only recently bought or looted items have it so it lives outside of the item itself
+        struct TradeState
+        {
+            ObjectGuid RefundRecipient;
+            uint64 PaidMoney = 0;
+            uint32 PaidExtendedCost = 0;
+            GuidSet AllowedLooters;
+        };
+
+        TradeState& ModifyTradeState()
+        {
+            if (!_tradeState)
+                _tradeState = std::make_unique<TradeState>();
+            return *_tradeState;
+        }
+
+        std::unique_ptr<TradeState> _tradeState;
         ItemRandomBonusListId m_randomBonusListId;          // store separately to easily find which bonus list is the one randomly given for stat rerolling
         ObjectGuid m_childItem;
         std::array<uint32, MAX_ITEM_PROTO_SOCKETS> m_gemScalingLevels;
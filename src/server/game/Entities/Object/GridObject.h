@@ -25,11 +25,31 @@ template<class T>
 class GridObject
 {
     public:
-        virtual ~GridObject() { }
+        virtual ~GridObject()
+        {
+            if (IsInGrid())
+                _gridRef.getTarget()->GetPositionIndex().Remove(&_gridRef);
+        }
 
         bool IsInGrid() const { return _gridRef.isValid(); }
-        void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); }
-        void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); }
+        void AddToGrid(GridRefManager<T>& m)
+        {
+            ASSERT(!IsInGrid());
+            _gridRef.link(&m, (T*)this);
+            m.GetPositionIndex().Insert(&_gridRef, ((T*)this)->GetPositionX(), ((T*)this)->GetPositionY());
+        }
+        void RemoveFromGrid()
+        {
+            ASSERT(IsInGrid());
+            _gridRef.getTarget()->GetPositionIndex().Remove(&_gridRef);
+            _gridRef.unlink();
+        }
+        // refreshes the position stored in the cell position index, must be called after relocating an object that is in grid
+        void UpdateGridPosition()
+        {
+            if (IsInGrid())
+                _gridRef.getTarget()->GetPositionIndex().Relocate(&_gridRef, ((T*)this)->GetPositionX(), ((T*)this)->GetPositionY());
+        }
     private:
         GridReference<T> _gridRef;
 };
@@ -139,6 +139,8 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
     if (!target)
         return;
 
+    InvalidateSentValues();
+
     uint8 updateType = m_isNewObject ? UPDATETYPE_CREATE_OBJECT2 : UPDATETYPE_CREATE_OBJECT;
     uint8 objectType = m_objectTypeId;
     CreateObjectBits flags = m_updateFlag;
@@ -197,18 +199,42 @@ void Object::SendUpdateToPlayer(Player* player)
     WorldPacket packet;
 
     if (player->HaveAtClient(this))
+    {
+        InvalidateSentValues();
         BuildValuesUpdateBlockForPlayer(&upd, player);
+    }
     else
         BuildCreateUpdateBlockForPlayer(&upd, player);
     upd.BuildPacket(&packet);
     player->SendDirectMessage(&packet);
 }
 
-void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player const* target) const
+void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player const* target, ValuesUpdateBlockCache* cache /*= nullptr*/) const
 {
     ByteBuffer& buf = PrepareValuesUpdateBuffer(data);
 
-    EnumFlag<UF::UpdateFieldFlag> fieldFlags = GetUpdateFieldFlagsFor(target);
+    UF::UpdateFieldFlag fieldFlags = GetUpdateFieldFlagsFor(target);
+    // values sent to a player about itself also contain ActivePlayerData
+    if (!cache || target == this || HasViewerDependentValuesUpdate())
+    {
+        BuildValuesUpdateBlockContents(buf, fieldFlags, target);
+        data->AddUpdateBlock();
+        return;
+    }
+
+    auto itr = std::ranges::find(cache->Blocks, fieldFlags, &std::pair<UF::UpdateFieldFlag, ByteBuffer>::first);
+    if (itr == cache->Blocks.end())
+    {
+        itr = cache->Blocks.emplace(cache->Blocks.end(), fieldFlags, ByteBuffer());
+        BuildValuesUpdateBlockContents(itr->second, fieldFlags, target);
+    }
+
+    buf.append(itr->second);
+    data->AddUpdateBlock();
+}
+
+void Object::BuildValuesUpdateBlockContents(ByteBuffer& buf, EnumFlag<UF::UpdateFieldFlag> fieldFlags, Player const* target) const
+{
     std::size_t sizePos = buf.wpos();
     buf << uint32(0);
     buf << uint8(fieldFlags.HasFlag(UF::UpdateFieldFlag::Owner));
@@ -222,12 +248,12 @@ void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player const* tar
 
     BuildValuesUpdate(&buf, fieldFlags, target);
     buf.put<uint32>(sizePos, buf.wpos() - sizePos - 4);
-
-    data->AddUpdateBlock();
 }
 
 void Object::BuildValuesUpdateBlockForPlayerWithFlag(UpdateData* data, UF::UpdateFieldFlag flags, Player const* target) const
 {
+    InvalidateSentValues();
+
     ByteBuffer& buf = PrepareValuesUpdateBuffer(data);
 
     std::size_t sizePos = buf.wpos();
@@ -727,10 +753,10 @@ void Object::ClearUpdateMask(bool remove)
     }
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) const
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateBlockCache* cache /*= nullptr*/) const
 {
     UpdateDataMapType::iterator iter = data_map.try_emplace(player, player->GetMapId()).first;
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first, cache);
 }
 
 std::string Object::GetDebugInfo() const
@@ -1129,7 +1155,13 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, LineOfSightChecks che
     else
         GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, x, y, z);
 
-    return GetMap()->isInLineOfSight(GetPhaseShift(), x, y, z, ox, oy, oz, checks, ignoreFlags);
+    LineOfSightCache::Ray ray{ x, y, z, ox, oy, oz };
+    if (std::optional<bool> cached = GetMap()->FindCachedLineOfSight(this, obj, checks, ignoreFlags, ray))
+        return *cached;
+
+    bool result = GetMap()->isInLineOfSight(GetPhaseShift(), x, y, z, ox, oy, oz, checks, ignoreFlags);
+    GetMap()->CacheLineOfSight(this, obj, checks, ignoreFlags, ray, result);
+    return result;
 }
 
 void WorldObject::GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z) const
@@ -1686,19 +1718,21 @@ void WorldObject::SendMessageToSetInRange(WorldPacket const* data, float dist, b
 {
     Trinity::PacketSenderRef sender(data);
     Trinity::MessageDistDeliverer<Trinity::PacketSenderRef> notifier(this, sender, dist);
-    Cell::VisitWorldObjects(this, notifier, dist);
+    notifier.Deliver(dist);
 }
 
 void WorldObject::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
 {
     Trinity::PacketSenderRef sender(data);
     Trinity::MessageDistDeliverer<Trinity::PacketSenderRef> notifier(this, sender, GetVisibilityRange(), false, skipped_rcvr);
-    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
+    notifier.Deliver(GetVisibilityRange());
 }
 
 struct CombatLogSender
 {
     WorldPackets::CombatLog::CombatLogServerPacket const* i_message;
+    mutable std::shared_ptr<WorldPacket const> i_fullLogPacket;
+    mutable std::shared_ptr<WorldPacket const> i_basicLogPacket;
 
     explicit CombatLogSender(WorldPackets::CombatLog::CombatLogServerPacket* msg)
         : i_message(msg)
@@ -1709,12 +1743,37 @@ struct CombatLogSender
     void operator()(Player const* player) const
     {
         if (player->IsAdvancedCombatLoggingEnabled())
-            player->SendDirectMessage(i_message->GetFullLogPacket());
+            player->SendDirectMessage(Trinity::GetSharedPacket(i_fullLogPacket, i_message->GetFullLogPacket()));
         else
-            player->SendDirectMessage(i_message->GetBasicLogPacket());
+            player->SendDirectMessage(Trinity::GetSharedPacket(i_basicLogPacket, i_message->GetBasicLogPacket()));
     }
 };
 
+namespace
+{
+thread_local CombatLogBatch* ActiveCombatLogBatch = nullptr;
+
+struct CombatLogReceiverCollector
+{
+    std::vector<Player const*>& i_receivers;
+
+    void operator()(Player const* player) const
+    {
+        i_receivers.push_back(player);
+    }
+};
+}
+
+CombatLogBatch::CombatLogBatch() : _previous(ActiveCombatLogBatch), _source(nullptr)
+{
+    ActiveCombatLogBatch = this;
+}
+
+CombatLogBatch::~CombatLogBatch()
+{
+    ActiveCombatLogBatch = _previous;
+}
+
 void WorldObject::SendCombatLogMessage(WorldPackets::CombatLog::CombatLogServerPacket* combatLog) const
 {
     CombatLogSender combatLogSender(combatLog);
@@ -1722,8 +1781,26 @@ void WorldObject::SendCombatLogMessage(WorldPackets::CombatLog::CombatLogServerP
     if (Player const* self = ToPlayer())
         combatLogSender(self);
 
+    if (CombatLogBatch* batch = ActiveCombatLogBatch)
+    {
+        if (batch->_source != this)
+        {
+            batch->_source = this;
+            batch->_receivers.clear();
+
+            CombatLogReceiverCollector collector{ batch->_receivers };
+            Trinity::MessageDistDeliverer<CombatLogReceiverCollector> notifier(this, collector, GetVisibilityRange());
+            notifier.Deliver(GetVisibilityRange());
+        }
+
+        for (Player const* receiver : batch->_receivers)
+            combatLogSender(receiver);
+
+        return;
+    }
+
     Trinity::MessageDistDeliverer<CombatLogSender> notifier(this, combatLogSender, GetVisibilityRange());
-    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
+    notifier.Deliver(GetVisibilityRange());
 }
 
 void WorldObject::SetMap(Map* map)
@@ -3671,6 +3748,7 @@ struct WorldObjectClientDestroyWork
 
         object->DestroyForPlayer(player);
         player->m_clientGUIDs.erase(object->GetGUID());
+        object->RemoveClientViewer(player->GetGUID());
     }
 };
 
@@ -3697,18 +3775,21 @@ struct WorldObjectChangeAccumulator
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
     GuidUnorderedSet plr_list;
+    ValuesUpdateBlockCache i_valuesUpdateCache;
     WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d) : i_updateDatas(d), i_object(obj) { }
 
     void operator()(Player* player)
     {
         // Only send update once to a player
         if (player->HaveAtClient(&i_object) && plr_list.insert(player->GetGUID()).second)
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+            i_object.BuildFieldsUpdate(player, i_updateDatas, &i_valuesUpdateCache);
     }
 };
 
 void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
 {
+    DiscardUnchangedValues();
+
     WorldObjectChangeAccumulator notifier(*this, data_map);
     WorldObjectVisibleChangeVisitor visitor(notifier);
     //we must build packets for all visible players
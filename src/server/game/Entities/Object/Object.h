@@ -23,6 +23,7 @@
 #include "Errors.h"
 #include "EventProcessor.h"
 #include "MapDefines.h"
+#include "MemoryAccounting.h"
 #include "ModelIgnoreFlags.h"
 #include "MovementInfo.h"
 #include "ObjectDefines.h"
@@ -80,6 +81,12 @@ namespace WorldPackets
 
 typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
 
+// Values update blocks built during one Object::BuildUpdate call, shared by all receivers with the same UF::UpdateFieldFlag
+struct ValuesUpdateBlockCache
+{
+    std::vector<std::pair<UF::UpdateFieldFlag, ByteBuffer>> Blocks;
+};
+
 struct CreateObjectBits
 {
     bool NoBirthAnim : 1;
@@ -181,7 +188,7 @@ namespace UF
 float const DEFAULT_COLLISION_HEIGHT = 2.03128f; // Most common value in dbc
 static constexpr Milliseconds const HEARTBEAT_INTERVAL = 5s + 200ms;
 
-class TC_GAME_API Object
+class TC_GAME_API Object : public Trinity::AccountedObject<Trinity::MemoryDomain::Objects>
 {
     public:
         virtual ~Object();
@@ -211,12 +218,17 @@ class TC_GAME_API Object
         virtual void BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) const;
         void SendUpdateToPlayer(Player* player);
 
-        void BuildValuesUpdateBlockForPlayer(UpdateData* data, Player const* target) const;
+        void BuildValuesUpdateBlockForPlayer(UpdateData* data, Player const* target, ValuesUpdateBlockCache* cache = nullptr) const;
         void BuildValuesUpdateBlockForPlayerWithFlag(UpdateData* data, UF::UpdateFieldFlag flags, Player const* target) const;
         void BuildDestroyUpdateBlock(UpdateData* data) const;
         void BuildOutOfRangeUpdateBlock(UpdateData* data) const;
         ByteBuffer& PrepareValuesUpdateBuffer(UpdateData* data) const;
 
+        // drops fields that were changed back to the value every viewer already has from the pending values update
+        virtual void DiscardUnchangedValues() { }
+        // must be called whenever values are sent to some viewers only, they may no longer match the values sent to everyone else
+        virtual void InvalidateSentValues() const { }
+
         virtual void DestroyForPlayer(Player* target) const;
         void SendOutOfRangeForPlayer(Player* target) const;
 
@@ -230,7 +242,7 @@ class TC_GAME_API Object
         bool IsDestroyedObject() const { return m_isDestroyedObject; }
         void SetDestroyedObject(bool destroyed) { m_isDestroyedObject = destroyed; }
         virtual void BuildUpdate(UpdateDataMapType&) { }
-        void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
+        void BuildFieldsUpdate(Player*, UpdateDataMapType &, ValuesUpdateBlockCache* cache = nullptr) const;
 
         inline bool IsWorldObject() const { return isType(TYPEMASK_WORLDOBJECT); }
         static WorldObject* ToWorldObject(Object* o) { return o ? o->ToWorldObject() : nullptr; }
@@ -429,6 +441,9 @@ class TC_GAME_API Object
 
         void BuildMovementUpdate(ByteBuffer* data, CreateObjectBits flags, Player const* target) const;
         virtual UF::UpdateFieldFlag GetUpdateFieldFlagsFor(Player const* target) const;
+        // true if the pending values update contains fields that are serialized differently for each receiver (see ViewerDependentValues.h)
+        virtual bool HasViewerDependentValuesUpdate() const { return true; }
+        void BuildValuesUpdateBlockContents(ByteBuffer& buf, EnumFlag<UF::UpdateFieldFlag> fieldFlags, Player const* target) const;
         virtual void BuildValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const = 0;
         virtual void BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const = 0;
         static void BuildEntityFragments(ByteBuffer* data, std::span<WowCS::EntityFragment const> fragments);
@@ -637,6 +652,29 @@ struct CanSeeOrDetectExtraArgs
     bool AlertCheck = false;
 };
 
+/**
+ * While alive, combat log messages sent by the same object on this thread are delivered to the receivers
+ * found for the first of them instead of searching receivers for every message (i.e. one spell hitting many targets)
+ */
+class TC_GAME_API CombatLogBatch
+{
+public:
+    CombatLogBatch();
+    ~CombatLogBatch();
+
+    CombatLogBatch(CombatLogBatch const&) = delete;
+    CombatLogBatch(CombatLogBatch&&) = delete;
+    CombatLogBatch& operator=(CombatLogBatch const&) = delete;
+    CombatLogBatch& operator=(CombatLogBatch&&) = delete;
+
+private:
+    friend class WorldObject;
+
+    CombatLogBatch* _previous;
+    WorldObject const* _source;
+    std::vector<Player const*> _receivers;
+};
+
 class TC_GAME_API WorldObject : public Object, public WorldLocation
 {
     protected:
@@ -743,6 +781,11 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
 
         void SendCombatLogMessage(WorldPackets::CombatLog::CombatLogServerPacket* combatLog) const;
 
+        // players that have this object at client (may also contain players that no longer do, they are removed when found)
+        void AddClientViewer(ObjectGuid const& playerGuid) { _clientViewers.insert(playerGuid); }
+        void RemoveClientViewer(ObjectGuid const& playerGuid) { _clientViewers.erase(playerGuid); }
+        GuidFlatSet& GetClientViewers() const { return _clientViewers; }
+
         virtual uint8 GetLevelForTarget(WorldObject const* /*target*/) const { return 1; }
 
         void PlayDistanceSound(uint32 soundId, Player const* target = nullptr) const;
@@ -982,6 +1025,8 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
 
         uint16 m_notifyflags;
 
+        mutable GuidFlatSet _clientViewers;
+
         ObjectGuid _privateObjectOwner;
 
         std::unique_ptr<SmoothPhasing> _smoothPhasing;
@@ -75,6 +75,7 @@ enum NotifyFlags
     NOTIFY_NONE                     = 0x00,
     NOTIFY_AI_RELOCATION            = 0x01,
     NOTIFY_VISIBILITY_CHANGED       = 0x02,
+    NOTIFY_VISIBILITY_FULL_RANGE    = 0x04,     // visibility changed for another reason than movement, search the whole visibility distance
     NOTIFY_ALL                      = 0xFF
 };
 
@@ -18,7 +18,6 @@
 #include "ObjectGuid.h"
 #include "ByteBuffer.h"
 #include "Errors.h"
-#include "Hash.h"
 #include "RealmList.h"
 #include "StringFormat.h"
 #include "Util.h"
@@ -767,14 +766,6 @@ ObjectGuid ObjectGuid::FromString(std::string_view guidString)
     return Info.Parse(guidString);
 }
 
-std::size_t ObjectGuid::GetHash() const
-{
-    std::size_t hashVal = 0;
-    Trinity::hash_combine(hashVal, _data[0]);
-    Trinity::hash_combine(hashVal, _data[1]);
-    return hashVal;
-}
-
 std::array<uint8, 16> ObjectGuid::GetRawValue() const
 {
     std::array<uint8, 16> raw;
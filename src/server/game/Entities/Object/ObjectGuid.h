@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "EnumFlag.h"
+#include "FlatHashMap.h"
 #include "StringFormatFwd.h"
 #include "advstd.h"
 #include <array>
@@ -357,7 +358,19 @@ class TC_GAME_API ObjectGuid
         std::string ToString() const;
         std::string ToHexString() const;
         static ObjectGuid FromString(std::string_view guidString);
-        std::size_t GetHash() const;
+
+        // the high half carries type, map and entry and the low half the counter, both need mixing
+        // before a table takes its bucket from the low or high bits of the hash
+        std::size_t GetHash() const
+        {
+            uint64 hash = _data[0] ^ (_data[1] * UI64LIT(0x9E3779B97F4A7C15));
+            hash ^= hash >> 32;
+            hash *= UI64LIT(0xD6E8FEB86659FD93);
+            hash ^= hash >> 32;
+            hash *= UI64LIT(0xD6E8FEB86659FD93);
+            hash ^= hash >> 32;
+            return std::size_t(hash);
+        }
 
         template <HighGuid type, std::enable_if_t<ObjectGuidTraits<type>::Format::value == ObjectGuidFormatType::Null, int32> = 0> static constexpr ObjectGuid Create() { return ObjectGuidFactory::CreateNull(); }
         template <HighGuid type, std::enable_if_t<ObjectGuidTraits<type>::Format::value == ObjectGuidFormatType::Uniq, int32> = 0> static constexpr ObjectGuid Create(LowType id) { return ObjectGuidFactory::CreateUniq(id); }
@@ -393,6 +406,7 @@ using GuidSet = std::set<ObjectGuid>;
 using GuidList = std::list<ObjectGuid>;
 using GuidVector = std::vector<ObjectGuid>;
 using GuidUnorderedSet = std::unordered_set<ObjectGuid>;
+using GuidFlatSet = Trinity::Containers::FlatHashSet<ObjectGuid>;
 
 TC_GAME_API ByteBuffer& operator<<(ByteBuffer& buf, ObjectGuid const& guid);
 TC_GAME_API ByteBuffer& operator>>(ByteBuffer& buf, ObjectGuid&       guid);
@@ -37,6 +37,19 @@ void UpdateData::AddOutOfRangeGUID(ObjectGuid guid)
     m_outOfRangeGUIDs.insert(guid);
 }
 
+void UpdateData::Merge(UpdateData&& other)
+{
+    if (m_blockCount)
+        m_data.append(other.m_data);
+    else
+        m_data = std::move(other.m_data);
+
+    m_blockCount += other.m_blockCount;
+    m_destroyGUIDs.merge(other.m_destroyGUIDs);
+    m_outOfRangeGUIDs.merge(other.m_outOfRangeGUIDs);
+    other.Clear();
+}
+
 bool UpdateData::BuildPacket(WorldPacket* packet)
 {
     ASSERT(packet->empty());                                // shouldn't happen
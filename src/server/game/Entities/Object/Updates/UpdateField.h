@@ -577,6 +577,25 @@ namespace UF
             _changesMask.Set(Bit);
         }
 
+        template<typename Derived, typename T, int32 BlockBit, uint32 Bit>
+        bool HasChanged(UpdateField<T, BlockBit, Bit>(Derived::*)) const
+        {
+            static_assert(std::is_base_of_v<Base, Derived>, "Given field argument must belong to the same structure as this HasChangesMask");
+
+            return _changesMask[Bit];
+        }
+
+        template<typename Derived, typename T, std::size_t Size, uint32 Bit, int32 FirstElementBit>
+        bool HasChanged(UpdateFieldArray<T, Size, Bit, FirstElementBit>(Derived::*), uint32 index) const
+        {
+            static_assert(std::is_base_of_v<Base, Derived>, "Given field argument must belong to the same structure as this HasChangesMask");
+
+            if constexpr (FirstElementBit >= 0 && !std::is_base_of_v<IsUpdateFieldHolderTag, T>)
+                return _changesMask[FirstElementBit + index];
+            else
+                return _changesMask[Bit];
+        }
+
         template<typename Derived, typename T, int32 BlockBit, uint32 Bit>
         void ClearChanged(UpdateField<T, BlockBit, Bit>(Derived::*))
         {
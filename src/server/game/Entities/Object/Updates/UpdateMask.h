@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include <algorithm>
+#include <array>
 #include <cstring> // std::memset
 
 namespace UpdateMaskHelpers
@@ -39,16 +40,9 @@ public:
     {
     }
 
-    constexpr UpdateMask(std::array<uint32, BlockCount> const& init)
+    constexpr UpdateMask(std::array<uint32, BlockCount> const& init) : _blocksMask(), _blocks(init)
     {
-        _blocksMask.back() = 0; // only last value of blocksMask will not be written fully
-        for (uint32 block = 0; block < BlockCount; ++block)
-        {
-            if ((_blocks[block] = init[block]) != 0)
-                _blocksMask[UpdateMaskHelpers::GetBlockIndex(block)] |= UpdateMaskHelpers::GetBlockFlag(block);
-            else
-                _blocksMask[UpdateMaskHelpers::GetBlockIndex(block)] &= ~UpdateMaskHelpers::GetBlockFlag(block);
-        }
+        UpdateBlocksMask();
     }
 
     constexpr uint32 GetBlocksMask(uint32 index) const
@@ -112,13 +106,10 @@ public:
 
     constexpr UpdateMask& operator&=(UpdateMask const& right)
     {
-        for (uint32 i = 0; i < BlocksMaskCount; ++i)
-            _blocksMask[i] &= right._blocksMask[i];
-
         for (uint32 i = 0; i < BlockCount; ++i)
-            if (!(_blocks[i] &= right._blocks[i]))
-                _blocksMask[UpdateMaskHelpers::GetBlockIndex(i)] &= ~UpdateMaskHelpers::GetBlockFlag(i);
+            _blocks[i] &= right._blocks[i];
 
+        UpdateBlocksMask();
         return *this;
     }
 
@@ -134,6 +125,14 @@ public:
     }
 
 private:
+    // no branches, lets the compiler vectorize masking done for every receiver of an object update
+    constexpr void UpdateBlocksMask()
+    {
+        _blocksMask = { };
+        for (uint32 block = 0; block < BlockCount; ++block)
+            _blocksMask[UpdateMaskHelpers::GetBlockIndex(block)] |= uint32(_blocks[block] != 0) << (block % 32u);
+    }
+
     std::array<uint32, BlocksMaskCount> _blocksMask;
     std::array<uint32, BlockCount> _blocks;
 };
@@ -669,6 +669,36 @@ public:
         return startTime;
     }
 };
+
+// Changes mask bits of fields written through ViewerDependentValue in WriteUpdate (UpdateFields.cpp), must be kept in sync with it
+// Values updates changing none of them are identical for all receivers with the same UpdateFieldFlag
+template<typename Mask>
+constexpr Mask MakeViewerDependentChangesMask(std::initializer_list<uint32> bits)
+{
+    Mask mask;
+    for (uint32 bit : bits)
+        mask.Set(bit);
+    return mask;
+}
+
+inline bool HasViewerDependentChanges(ObjectData const& data)
+{
+    static constexpr ObjectData::Mask ViewerDependentFields = MakeViewerDependentChangesMask<ObjectData::Mask>({ 1, 2 });
+    return (data.GetChangesMask() & ViewerDependentFields).IsAnySet();
+}
+
+inline bool HasViewerDependentChanges(UnitData const& data)
+{
+    static constexpr UnitData::Mask ViewerDependentFields = MakeViewerDependentChangesMask<UnitData::Mask>(
+        { 2, 6, 7, 8, 9, 10, 11, 12, 44, 45, 46, 47, 48, 49, 85, 116 });
+    return (data.GetChangesMask() & ViewerDependentFields).IsAnySet();
+}
+
+inline bool HasViewerDependentChanges(GameObjectData const& data)
+{
+    static constexpr GameObjectData::Mask ViewerDependentFields = MakeViewerDependentChangesMask<GameObjectData::Mask>({ 1, 6, 7, 8, 9, 12, 15 });
+    return (data.GetChangesMask() & ViewerDependentFields).IsAnySet();
+}
 }
 
 #endif // ViewerDependentValues_h__
@@ -352,8 +352,32 @@ void CollectionMgr::CheckHeirloomUpgrades(Item* item)
 
 void CollectionMgr::LoadMounts()
 {
-    for (auto const& m : _mounts)
-        AddMount(m.first, m.second, false, false);
+    Player* player = _owner->GetPlayer();
+    if (!player)
+        return;
+
+    auto learnMount = [player](uint32 spellId)
+    {
+        MountEntry const* mount = sDB2Manager.GetMount(spellId);
+        if (!mount)
+            return;
+
+        if (!ConditionMgr::IsPlayerMeetingCondition(player, mount->PlayerConditionID))
+            return;
+
+        if (!player->HasSpell(spellId))
+            player->LearnSpell(spellId, true);
+    };
+
+    // Whole collection is sent in a single full update with the initial login packets, only learn the spells here
+    for (auto const& [spellId, flags] : _mounts)
+    {
+        learnMount(spellId);
+
+        MountDefinitionMap::const_iterator itr = FactionSpecificMounts.find(spellId);
+        if (itr != FactionSpecificMounts.end() && _mounts.emplace(itr->second, flags).second)
+            learnMount(itr->second);
+    }
 }
 
 void CollectionMgr::LoadAccountMounts(PreparedQueryResult result)
@@ -808,13 +832,13 @@ std::unordered_set<ObjectGuid> CollectionMgr::GetItemsProvidingTemporaryAppearan
     return std::unordered_set<ObjectGuid>();
 }
 
-std::unordered_set<uint32> CollectionMgr::GetAppearanceIds() const
+boost::dynamic_bitset<uint32> CollectionMgr::GetAppearanceIds() const
 {
-    std::unordered_set<uint32> appearances;
+    boost::dynamic_bitset<uint32> appearances(sItemAppearanceStore.GetNumRows());
     std::size_t id = _appearances->find_first();
     while (id != boost::dynamic_bitset<uint32>::npos)
     {
-        appearances.insert(sItemModifiedAppearanceStore.AssertEntry(id)->ItemAppearanceID);
+        appearances.set(sItemModifiedAppearanceStore.AssertEntry(id)->ItemAppearanceID);
         id = _appearances->find_next(id);
     }
 
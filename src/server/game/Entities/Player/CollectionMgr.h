@@ -166,8 +166,8 @@ public:
     // returns pair<hasAppearance, isTemporary>
     std::pair<bool, bool> HasItemAppearance(uint32 itemModifiedAppearanceId) const;
     std::unordered_set<ObjectGuid> GetItemsProvidingTemporaryAppearance(uint32 itemModifiedAppearanceId) const;
-    // returns ItemAppearance::ID, not ItemModifiedAppearance::ID
-    std::unordered_set<uint32> GetAppearanceIds() const;
+    // returns bitset indexed by ItemAppearance::ID, not ItemModifiedAppearance::ID
+    boost::dynamic_bitset<uint32> GetAppearanceIds() const;
 
     void SetAppearanceIsFavorite(uint32 itemModifiedAppearanceId, bool apply);
     void SendFavoriteAppearances() const;
@@ -5304,6 +5304,12 @@ float Player::GetExpertiseDodgeOrParryReduction(WeaponAttackType attType) const
 void Player::ApplyRatingMod(CombatRating combatRating, int32 value, bool apply)
 {
     m_baseRatingValue[combatRating] += (apply ? value : -value);
+    if (IsDeferringStatUpdates())
+    {
+        m_pendingRatingUpdates.set(combatRating);
+        return;
+    }
+
     UpdateRating(combatRating);
 }
 
@@ -6238,7 +6244,7 @@ void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool s
 
     Trinity::PacketSenderRef sender(data);
     Trinity::MessageDistDeliverer<Trinity::PacketSenderRef> notifier(this, sender, dist);
-    Cell::VisitWorldObjects(this, notifier, dist);
+    notifier.Deliver(dist);
 }
 
 void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool self, bool own_team_only, bool required3dDist /*= false*/) const
@@ -6248,7 +6254,7 @@ void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool s
 
     Trinity::PacketSenderRef sender(data);
     Trinity::MessageDistDeliverer<Trinity::PacketSenderRef> notifier(this, sender, dist, own_team_only, nullptr, required3dDist);
-    Cell::VisitWorldObjects(this, notifier, dist);
+    notifier.Deliver(dist);
 }
 
 void Player::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
@@ -6260,7 +6266,7 @@ void Player::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcv
     // update: replaced by GetMap()->GetVisibilityDistance()
     Trinity::PacketSenderRef sender(data);
     Trinity::MessageDistDeliverer<Trinity::PacketSenderRef> notifier(this, sender, GetVisibilityRange(), false, skipped_rcvr);
-    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
+    notifier.Deliver(GetVisibilityRange());
 }
 
 void Player::SendDirectMessage(WorldPacket const* data) const
@@ -6268,6 +6274,11 @@ void Player::SendDirectMessage(WorldPacket const* data) const
     m_session->SendPacket(data);
 }
 
+void Player::SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const
+{
+    m_session->SendPacket(data);
+}
+
 void Player::SendCinematicStart(uint32 CinematicSequenceId) const
 {
     WorldPackets::Misc::TriggerCinematic packet;
@@ -7922,6 +7933,9 @@ void Player::_ApplyItemBonuses(Item* item, uint8 slot, bool apply)
     if (slot >= REAGENT_BAG_SLOT_END || !proto)
         return;
 
+    // items change many stats and ratings at once, each affected value is updated once after all of them
+    DeferredStatUpdateScope deferredStatUpdates(this);
+
     uint32 itemLevel = item->GetItemLevel(this);
     float combatRatingMultiplier = 1.0f;
     if (GtCombatRatingsMultByILvl const* ratingMult = sCombatRatingsMultByILvlGameTable.GetRow(itemLevel))
@@ -9534,6 +9548,19 @@ uint32 Player::GetItemCount(uint32 item, bool inBankAlso, Item* skipItem) const
         location |= ItemSearchLocation::Bank;
 
     uint32 count = 0;
+    if (!countGems)
+    {
+        ForEachItemWithEntry(item, location, [&count, skipItem](Item* pItem)
+        {
+            if (pItem != skipItem)
+                count += pItem->GetCount();
+
+            return ItemSearchCallbackResult::Continue;
+        });
+
+        return count;
+    }
+
     ForEachItem(location, [&count, item, skipItem, countGems](Item* pItem)
     {
         if (pItem != skipItem)
@@ -9868,6 +9895,7 @@ void Player::SetInventorySlotCount(uint8 slots)
     }
 
     SetUpdateFieldValue(m_values.ModifyValue(&Player::m_activePlayerData).ModifyValue(&UF::ActivePlayerData::NumBackpackSlots), slots);
+    InvalidateItemEntryIndex();
 }
 
 bool Player::HasItemCount(uint32 item, uint32 count, bool inBankAlso) const
@@ -9877,9 +9905,9 @@ bool Player::HasItemCount(uint32 item, uint32 count, bool inBankAlso) const
         location |= ItemSearchLocation::Bank;
 
     uint32 currentCount = 0;
-    return !ForEachItem(location, [item, count, &currentCount](Item* pItem)
+    return !ForEachItemWithEntry(item, location, [count, &currentCount](Item* pItem)
     {
-        if (pItem->GetEntry() == item && !pItem->IsInTrade())
+        if (!pItem->IsInTrade())
         {
             currentCount += pItem->GetCount();
             if (currentCount >= count)
@@ -11479,6 +11507,8 @@ Item* Player::_StoreItem(uint16 pos, Item* pItem, uint32 count, bool clone, bool
         else
             pBag->StoreItem(slot, pItem, update);
 
+        InvalidateItemEntryIndex();
+
         if (IsInWorld() && update)
         {
             pItem->AddToWorld();
@@ -11828,6 +11858,7 @@ void Player::VisualizeItem(uint8 slot, Item* pItem)
         GetName(), GetGUID().ToString(), slot, pItem->GetEntry());
 
     m_items[slot] = pItem;
+    InvalidateItemEntryIndex();
     SetInvSlot(slot, pItem->GetGUID());
     pItem->SetContainedIn(GetGUID());
     pItem->SetOwnerGUID(GetGUID());
@@ -11905,6 +11936,7 @@ void Player::RemoveItem(uint8 bag, uint8 slot, bool update)
             }
 
             m_items[slot] = nullptr;
+            InvalidateItemEntryIndex();
             SetInvSlot(slot, ObjectGuid::Empty);
 
             if (slot < EQUIPMENT_SLOT_END)
@@ -11917,6 +11949,7 @@ void Player::RemoveItem(uint8 bag, uint8 slot, bool update)
         else if (Bag* pBag = GetBagByPos(bag))
             pBag->RemoveItem(slot, update);
 
+        InvalidateItemEntryIndex();
         pItem->SetContainedIn(ObjectGuid::Empty);
         // pItem->SetUInt64Value(ITEM_FIELD_OWNER, 0); not clear owner at remove (it will be set at store). This used in mail and auction code
         pItem->SetSlot(NULL_SLOT);
@@ -12053,6 +12086,8 @@ void Player::DestroyItem(uint8 bag, uint8 slot, bool update)
         else if (Bag* pBag = GetBagByPos(bag))
             pBag->RemoveItem(slot, update);
 
+        InvalidateItemEntryIndex();
+
         // Delete rolled money / loot from db.
         // MUST be done before RemoveFromWorld() or GetTemplate() fails
         if (pProto->HasFlag(ITEM_FLAG_HAS_LOOT))
@@ -12334,15 +12369,10 @@ void Player::DestroyConjuredItems(bool update)
 Item* Player::GetItemByEntry(uint32 entry, ItemSearchLocation where /*= ItemSearchLocation::Default */) const
 {
     Item* result = nullptr;
-    ForEachItem(where, [&result, entry](Item* item)
+    ForEachItemWithEntry(entry, where, [&result](Item* item)
     {
-        if (item->GetEntry() == entry)
-        {
-            result = item;
-            return ItemSearchCallbackResult::Stop;
-        }
-
-        return ItemSearchCallbackResult::Continue;
+        result = item;
+        return ItemSearchCallbackResult::Stop;
     });
     return result;
 }
@@ -12354,16 +12384,37 @@ std::vector<Item*> Player::GetItemListByEntry(uint32 entry, bool inBankAlso) con
         location |= ItemSearchLocation::Bank;
 
     std::vector<Item*> itemList = std::vector<Item*>();
-    ForEachItem(location, [&itemList, entry](Item* item)
+    ForEachItemWithEntry(entry, location, [&itemList](Item* item)
     {
-        if (item->GetEntry() == entry)
-            itemList.push_back(item);
-
+        itemList.push_back(item);
         return ItemSearchCallbackResult::Continue;
     });
     return itemList;
 }
 
+std::span<Player::ItemEntryIndexEntry const> Player::GetItemEntryIndex(uint32 entry) const
+{
+    if (!_itemEntryIndexValid)
+    {
+        _itemEntryIndex.clear();
+
+        // one pass per location keeps ForEachItem order within each entry after the stable sort
+        for (ItemSearchLocation location : { ItemSearchLocation::Equipment, ItemSearchLocation::Inventory, ItemSearchLocation::Bank, ItemSearchLocation::ReagentBank })
+        {
+            ForEachItem(location, [this, location](Item* item)
+            {
+                _itemEntryIndex.push_back({ .Entry = item->GetEntry(), .Location = location, .StoredItem = item });
+                return ItemSearchCallbackResult::Continue;
+            });
+        }
+
+        std::ranges::stable_sort(_itemEntryIndex, {}, &ItemEntryIndexEntry::Entry);
+        _itemEntryIndexValid = true;
+    }
+
+    return std::ranges::equal_range(_itemEntryIndex, entry, {}, &ItemEntryIndexEntry::Entry);
+}
+
 void Player::DestroyItemCount(Item* pItem, uint32 &count, bool update)
 {
     if (!pItem)
@@ -12813,6 +12864,7 @@ void Player::SwapItem(uint16 src, uint16 dst)
                     fullBag->RemoveItem(i, true);
                     emptyBag->StoreItem(count, bagItem, true);
                     bagItem->SetState(ITEM_CHANGED, this);
+                    InvalidateItemEntryIndex();
 
                     ++count;
                 }
@@ -15143,7 +15195,7 @@ void Player::RewardQuest(Quest const* quest, LootItemType rewardType, uint32 rew
     UpdateCriteria(CriteriaType::CompleteAnyReplayQuest, 1);
 
     // make full db save
-    SaveToDB(false);
+    ScheduleSave();
 
     if (quest->HasFlag(QUEST_FLAGS_FLAGS_PVP))
     {
@@ -16150,7 +16202,7 @@ void Player::SkipQuests(std::vector<uint32> const& questIds)
     UpdateVisibleObjectInteractions(true, false, true, true);
 
     // make full db save
-    SaveToDB(false);
+    ScheduleSave();
 
     if (updateVisibility)
         UpdateObjectVisibility();
@@ -16577,6 +16629,11 @@ void Player::CurrencyChanged(uint32 currencyId, int32 change)
 void Player::UpdateQuestObjectiveProgress(QuestObjectiveType objectiveType, int32 objectId, int64 addCount, ObjectGuid victimGuid /*= ObjectGuid::Empty*/,
     std::vector<QuestObjective const*>* updatedObjectives /*= nullptr*/, std::function<bool(QuestObjective const*)> const* objectiveFilter /*= nullptr*/)
 {
+    // most credit events (kills, loot, currency changes) don't match any objective of active quests
+    auto matchingObjectives = Trinity::Containers::MapEqualRange(m_questObjectiveStatus, { objectiveType, objectId });
+    if (matchingObjectives.begin() == matchingObjectives.end())
+        return;
+
     bool anyObjectiveChangedCompletionState = false;
     bool updatePhaseShift = false;
     bool updateZoneAuras = false;
@@ -16608,7 +16665,7 @@ void Player::UpdateQuestObjectiveProgress(QuestObjectiveType objectiveType, int3
         }
     }
 
-    for (QuestObjectiveStatusMap::value_type const& objectiveItr : Trinity::Containers::MapEqualRange(m_questObjectiveStatus, { objectiveType, objectId }))
+    for (QuestObjectiveStatusMap::value_type const& objectiveItr : matchingObjectives)
     {
         uint32 questId = objectiveItr.second.QuestStatusItr->first;
         Quest const* quest = sObjectMgr->GetQuestTemplate(questId);
@@ -20146,9 +20203,13 @@ void Player::SaveToDB(LoginDatabaseTransaction loginTransaction, CharacterDataba
     CharacterDatabasePreparedStatement* stmt = nullptr;
     uint8 index = 0;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_FISHINGSTEPS);
-    stmt->setUInt64(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    bool const saveFishingSteps = UpdateSaveSectionSnapshot(PLAYER_SAVE_SECTION_FISHING_STEPS);
+    if (saveFishingSteps)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_FISHINGSTEPS);
+        stmt->setUInt64(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+    }
 
     auto finiteAlways = [](float f) { return std::isfinite(f) ? f : 0.0f; };
 
@@ -20465,7 +20526,7 @@ void Player::SaveToDB(LoginDatabaseTransaction loginTransaction, CharacterDataba
 
     trans->Append(stmt);
 
-    if (m_fishingSteps != 0)
+    if (saveFishingSteps && m_fishingSteps != 0)
     {
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_FISHINGSTEPS);
         index = 0;
@@ -20545,6 +20606,120 @@ void Player::SaveToDB(LoginDatabaseTransaction loginTransaction, CharacterDataba
         pet->SavePetToDB(PET_SAVE_AS_CURRENT);
 }
 
+std::vector<uint8> Player::BuildSaveSectionSnapshot(PlayerSaveSection section) const
+{
+    ByteBuffer snapshot;
+    switch (section)
+    {
+        case PLAYER_SAVE_SECTION_FISHING_STEPS:
+            snapshot << uint8(m_fishingSteps);
+            break;
+        case PLAYER_SAVE_SECTION_BG_DATA:
+            snapshot << uint32(m_bgData.bgInstanceID);
+            snapshot << uint16(m_bgData.bgTeam);
+            snapshot << uint16(m_bgData.joinPos.GetMapId());
+            snapshot << float(m_bgData.joinPos.GetPositionX());
+            snapshot << float(m_bgData.joinPos.GetPositionY());
+            snapshot << float(m_bgData.joinPos.GetPositionZ());
+            snapshot << float(m_bgData.joinPos.GetOrientation());
+            snapshot << uint32(m_bgData.taxiPath[0]);
+            snapshot << uint32(m_bgData.taxiPath[1]);
+            snapshot << uint32(m_bgData.mountSpell);
+            snapshot << uint64(m_bgData.queueId.GetPacked());
+            break;
+        case PLAYER_SAVE_SECTION_GLYPHS:
+            for (uint8 spec = 0; spec < MAX_SPECIALIZATIONS; ++spec)
+            {
+                std::vector<uint32> const& glyphs = GetGlyphs(spec);
+                snapshot << uint32(glyphs.size());
+                for (uint32 glyphId : glyphs)
+                    snapshot << uint32(glyphId);
+            }
+            break;
+        case PLAYER_SAVE_SECTION_TALENTS:
+            for (uint8 group = 0; group < MAX_SPECIALIZATIONS; ++group)
+            {
+                std::vector<uint32> talentIds;
+                for (auto const& [talentId, state] : *GetTalentMap(group))
+                    if (state != PLAYERSPELL_REMOVED)
+                        talentIds.push_back(talentId);
+
+                std::sort(talentIds.begin(), talentIds.end());
+                snapshot << uint32(talentIds.size());
+                for (uint32 talentId : talentIds)
+                    snapshot << uint32(talentId);
+
+                for (uint32 pvpTalentId : GetPvpTalentMap(group))
+                    snapshot << uint32(pvpTalentId);
+            }
+            break;
+        case PLAYER_SAVE_SECTION_INSTANCE_TIME_RESTRICTIONS:
+            for (auto const& [instanceId, releaseTime] : _instanceResetTimes)
+                snapshot << uint32(instanceId) << int64(releaseTime);
+            break;
+        case PLAYER_SAVE_SECTION_CUF_PROFILES:
+            for (std::unique_ptr<CUFProfile> const& profile : _CUFProfiles)
+            {
+                snapshot << uint8(profile != nullptr);
+                if (!profile)
+                    continue;
+
+                snapshot << profile->ProfileName;
+                snapshot << uint16(profile->FrameHeight);
+                snapshot << uint16(profile->FrameWidth);
+                snapshot << uint8(profile->SortBy);
+                snapshot << uint8(profile->HealthText);
+                snapshot << uint32(profile->BoolOptions.to_ulong());
+                snapshot << uint8(profile->TopPoint);
+                snapshot << uint8(profile->BottomPoint);
+                snapshot << uint8(profile->LeftPoint);
+                snapshot << uint16(profile->TopOffset);
+                snapshot << uint16(profile->BottomOffset);
+                snapshot << uint16(profile->LeftOffset);
+            }
+            break;
+        case PLAYER_SAVE_SECTION_BANK_TAB_SETTINGS:
+            for (UF::BankTabSettings const& tabSetting : m_activePlayerData->CharacterBankTabSettings)
+            {
+                snapshot << *tabSetting.Name;
+                snapshot << *tabSetting.Icon;
+                snapshot << *tabSetting.Description;
+                snapshot << int32(*tabSetting.DepositFlags);
+            }
+            break;
+        default:
+            break;
+    }
+
+    return std::move(snapshot).Release();
+}
+
+bool Player::UpdateSaveSectionSnapshot(PlayerSaveSection section)
+{
+    std::vector<uint8> snapshot = BuildSaveSectionSnapshot(section);
+    Optional<std::vector<uint8>>& saved = _saveSectionSnapshots[section];
+    if (saved && *saved == snapshot)
+        return false;
+
+    saved = std::move(snapshot);
+    return true;
+}
+
+void Player::ScheduleSave()
+{
+    uint32 const coalesceDelay = sWorld->getIntConfig(CONFIG_PLAYER_SAVE_COALESCE_DELAY);
+
+    // periodic saves disabled, nothing to coalesce with
+    if (!coalesceDelay || !m_nextSave)
+    {
+        SaveToDB(false);
+        return;
+    }
+
+    // m_nextSave is reset by SaveToDB, requests until then are written by the same save
+    m_nextSave = std::min(m_nextSave, coalesceDelay);
+}
+
 // fast save function for item/money cheating preventing - save only inventory and money state
 void Player::SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans)
 {
@@ -20851,6 +21026,9 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
 
 void Player::_SaveCUFProfiles(CharacterDatabaseTransaction trans)
 {
+    if (!UpdateSaveSectionSnapshot(PLAYER_SAVE_SECTION_CUF_PROFILES))
+        return;
+
     CharacterDatabasePreparedStatement* stmt;
     for (uint8 i = 0; i < MAX_CUF_PROFILES; ++i)
     {
@@ -21435,8 +21613,11 @@ void Player::_SavePlayerData(CharacterDatabaseTransaction trans)
     _playerDataFlagsNeedSave.clear();
 }
 
-void Player::_SaveCharacterBankTabSettings(CharacterDatabaseTransaction trans) const
+void Player::_SaveCharacterBankTabSettings(CharacterDatabaseTransaction trans)
 {
+    if (!UpdateSaveSectionSnapshot(PLAYER_SAVE_SECTION_BANK_TAB_SETTINGS))
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHARACTER_BANK_TAB_SETTINGS);
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -22028,7 +22209,7 @@ void Player::SendChatMessageToSetInRange(ChatMsg chatMsg, Language language, std
 
     // Send to players
     Trinity::MessageDistDeliverer<Trinity::LocalizedDo<Trinity::CustomChatTextBuilder>> notifier(this, localizer, range, false, nullptr, true);
-    Cell::VisitWorldObjects(this, notifier, range);
+    notifier.Deliver(range);
 }
 
 void Player::Say(uint32 textId, WorldObject const* target /*= nullptr*/)
@@ -24290,6 +24471,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
                 target->DestroyForPlayer(this);
 
             m_clientGUIDs.erase(target->GetGUID());
+            target->RemoveClientViewer(GetGUID());
 
             #ifdef TRINITY_DEBUG
                 TC_LOG_DEBUG("maps", "Object {} out of range for player {}. Distance = {}", target->GetGUID().ToString(), GetGUID().ToString(), GetDistance(target));
@@ -24302,6 +24484,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
         {
             target->SendUpdateToPlayer(this);
             m_clientGUIDs.insert(target->GetGUID());
+            target->AddClientViewer(GetGUID());
 
             #ifdef TRINITY_DEBUG
                 TC_LOG_DEBUG("maps", "Object {} is visible now for player {}. Distance = {}", target->GetGUID().ToString(), GetGUID().ToString(), GetDistance(target));
@@ -24337,6 +24520,7 @@ void Player::UpdateTriggerVisibility()
             creature->ForceUpdateFieldChange(creature->m_values.ModifyValue(&Unit::m_unitData).ModifyValue(&UF::UnitData::DisplayID));
             creature->ForceUpdateFieldChange(creature->m_values.ModifyValue(&Unit::m_unitData).ModifyValue(&UF::UnitData::Flags));
             creature->ForceUpdateFieldChange(creature->m_values.ModifyValue(&Unit::m_unitData).ModifyValue(&UF::UnitData::Flags2));
+            creature->InvalidateSentValues();
             creature->BuildValuesUpdateBlockForPlayer(&udata, this);
         }
         else if (itr->IsAnyTypeGameObject())
@@ -24403,6 +24587,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObjec
                 target->BuildDestroyUpdateBlock(&data);
 
             m_clientGUIDs.erase(target->GetGUID());
+            target->RemoveClientViewer(GetGUID());
 
             #ifdef TRINITY_DEBUG
                 TC_LOG_DEBUG("maps", "Object {} is out of range for player {}. Distance = {}", target->GetGUID().ToString(), GetGUID().ToString(), GetDistance(target));
@@ -24415,6 +24600,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObjec
         {
             target->BuildCreateUpdateBlockForPlayer(&data, this);
             m_clientGUIDs.insert(target->GetGUID());
+            target->AddClientViewer(GetGUID());
             visibleNow.insert(target);
 
             #ifdef TRINITY_DEBUG
@@ -24440,7 +24626,7 @@ void Player::UpdateObjectVisibility(bool forced)
         return;
 
     if (!forced)
-        AddToNotify(NOTIFY_VISIBILITY_CHANGED);
+        AddToNotify(NOTIFY_VISIBILITY_CHANGED | NOTIFY_VISIBILITY_FULL_RANGE);
     else
     {
         Unit::UpdateObjectVisibility(true);
@@ -27894,6 +28080,9 @@ void Player::_SaveEquipmentSets(CharacterDatabaseTransaction trans)
 
 void Player::_SaveBGData(CharacterDatabaseTransaction trans)
 {
+    if (!UpdateSaveSectionSnapshot(PLAYER_SAVE_SECTION_BG_DATA))
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_BGDATA);
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -27986,8 +28175,11 @@ void Player::_LoadGlyphs(PreparedQueryResult result)
     } while (result->NextRow());
 }
 
-void Player::_SaveGlyphs(CharacterDatabaseTransaction trans) const
+void Player::_SaveGlyphs(CharacterDatabaseTransaction trans)
 {
+    if (!UpdateSaveSectionSnapshot(PLAYER_SAVE_SECTION_GLYPHS))
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_GLYPHS);
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -28206,6 +28398,9 @@ void Player::_LoadTraits(PreparedQueryResult configsResult, PreparedQueryResult
 
 void Player::_SaveTalents(CharacterDatabaseTransaction trans)
 {
+    if (!UpdateSaveSectionSnapshot(PLAYER_SAVE_SECTION_TALENTS))
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_TALENT);
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -29650,6 +29845,9 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
     if (_instanceResetTimes.empty())
         return;
 
+    if (!UpdateSaveSectionSnapshot(PLAYER_SAVE_SECTION_INSTANCE_TIME_RESTRICTIONS))
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->setUInt32(0, GetSession()->GetAccountId());
     trans->Append(stmt);
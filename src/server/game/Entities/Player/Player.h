@@ -33,6 +33,7 @@
 #include "PlayerTaxi.h"
 #include "QuestDef.h"
 #include "SceneMgr.h"
+#include <span>
 #include <variant>
 
 struct AccessRequirement;
@@ -960,6 +961,19 @@ enum PlayerDelayedOperations
     DELAYED_END
 };
 
+// Sections that have no per row state and would otherwise be rewritten in full on every save
+enum PlayerSaveSection : uint8
+{
+    PLAYER_SAVE_SECTION_FISHING_STEPS,
+    PLAYER_SAVE_SECTION_BG_DATA,
+    PLAYER_SAVE_SECTION_GLYPHS,
+    PLAYER_SAVE_SECTION_TALENTS,
+    PLAYER_SAVE_SECTION_INSTANCE_TIME_RESTRICTIONS,
+    PLAYER_SAVE_SECTION_CUF_PROFILES,
+    PLAYER_SAVE_SECTION_BANK_TAB_SETTINGS,
+    MAX_PLAYER_SAVE_SECTIONS
+};
+
 // Player summoning auto-decline time (in secs)
 #define MAX_PLAYER_SUMMON_DELAY                   (2*MINUTE)
 // Maximum money amount : 2^31 - 1
@@ -1382,6 +1396,38 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
             return true;
         }
 
+        /**
+         * @brief Iterate over the items with given entry in the player storage, in the same order as ForEachItem
+         * Served from an entry index that is rebuilt on first use after any inventory change
+         */
+        template <typename T>
+        bool ForEachItemWithEntry(uint32 entry, ItemSearchLocation location, T callback) const
+        {
+            EnumFlag<ItemSearchLocation> flag = location;
+            for (ItemEntryIndexEntry const& indexed : GetItemEntryIndex(entry))
+                if (flag.HasFlag(indexed.Location))
+                    if (callback(indexed.StoredItem) == ItemSearchCallbackResult::Stop)
+                        return false;
+
+            return true;
+        }
+
+        // must be called whenever an item enters, leaves or changes entry inside the ForEachItem locations
+        void InvalidateItemEntryIndex() { _itemEntryIndexValid = false; }
+
+    private:
+        struct ItemEntryIndexEntry
+        {
+            uint32 Entry;
+            ItemSearchLocation Location;
+            Item* StoredItem;
+        };
+
+        std::span<ItemEntryIndexEntry const> GetItemEntryIndex(uint32 entry) const;
+
+        mutable std::vector<ItemEntryIndexEntry> _itemEntryIndex;
+        mutable bool _itemEntryIndexValid = false;
+
     public:
         void UpdateAverageItemLevelTotal();
         void UpdateAverageItemLevelEquipped();
@@ -1798,6 +1844,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         void SaveToDB(bool create = false);
         void SaveToDB(LoginDatabaseTransaction loginTransaction, CharacterDatabaseTransaction trans, bool create = false);
+        // saves now or brings the next periodic save forward to PlayerSave.CoalesceDelay, sharing it with other requests in that time
+        void ScheduleSave();
         void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
 
         static void SaveCustomizations(CharacterDatabaseTransaction trans, ObjectGuid::LowType guid,
@@ -2470,6 +2518,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void SendInitWorldStates(uint32 zoneId, uint32 areaId);
         void SendUpdateWorldState(uint32 variable, uint32 value, bool hidden = false) const;
         void SendDirectMessage(WorldPacket const* data) const;
+        void SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const;
 
         void SendAurasForTarget(Unit* target) const;
 
@@ -2602,9 +2651,13 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         uint8 GetStartLevel(uint8 race, uint8 playerClass, Optional<int32> characterTemplateId) const;
 
         // currently visible objects at player client
-        GuidUnorderedSet m_clientGUIDs;
+        GuidFlatSet m_clientGUIDs;
         GuidUnorderedSet m_visibleTransports;
 
+        // relocation visibility updates since the last one that searched the whole visibility distance, see Map::GetVisibilityNotifySearchRadius
+        uint32 m_visibilityNotifyPass = 0;
+        Position m_lastFullRangeVisibilityNotifyPosition;
+
         bool HaveAtClient(Object const* u) const;
 
         bool IsNeverVisibleFor(WorldObject const* seer, bool allowServersideObjects = false) const override;
@@ -3076,7 +3129,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void _SaveStoredAuraTeleportLocations(CharacterDatabaseTransaction trans);
         void _SaveEquipmentSets(CharacterDatabaseTransaction trans);
         void _SaveBGData(CharacterDatabaseTransaction trans);
-        void _SaveGlyphs(CharacterDatabaseTransaction trans) const;
+        void _SaveGlyphs(CharacterDatabaseTransaction trans);
         void _SaveTalents(CharacterDatabaseTransaction trans);
         void _SaveTraits(CharacterDatabaseTransaction trans);
         void _SaveStats(CharacterDatabaseTransaction trans) const;
@@ -3084,7 +3137,11 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void _SaveCurrency(CharacterDatabaseTransaction trans);
         void _SaveCUFProfiles(CharacterDatabaseTransaction trans);
         void _SavePlayerData(CharacterDatabaseTransaction trans);
-        void _SaveCharacterBankTabSettings(CharacterDatabaseTransaction trans) const;
+        void _SaveCharacterBankTabSettings(CharacterDatabaseTransaction trans);
+
+        std::vector<uint8> BuildSaveSectionSnapshot(PlayerSaveSection section) const;
+        // Returns false if the section did not change since it was last saved, otherwise remembers its current state
+        bool UpdateSaveSectionSnapshot(PlayerSaveSection section);
 
         /*********************************************************/
         /***              ENVIRONMENTAL SYSTEM                 ***/
@@ -3105,6 +3162,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         Team m_team;
         uint32 m_nextSave;
         bool m_customizationsChanged;
+        std::array<Optional<std::vector<uint8>>, MAX_PLAYER_SAVE_SECTIONS> _saveSectionSnapshots;
         std::array<ChatFloodThrottle, ChatFloodThrottle::MAX> m_chatFloodData;
         Difficulty m_dungeonDifficulty;
         Difficulty m_raidDifficulty;
@@ -3150,6 +3208,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         std::array<float, BASEMOD_END> m_auraBaseFlatMod;
         std::array<float, BASEMOD_END> m_auraBasePctMod;
         std::array<int16, MAX_COMBAT_RATING> m_baseRatingValue;
+        std::bitset<MAX_COMBAT_RATING> m_pendingRatingUpdates;
         uint32 m_baseSpellPower;
         uint32 m_baseManaRegen;
         uint32 m_baseHealthRegen;
@@ -3233,7 +3292,15 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         std::array<std::unique_ptr<CUFProfile>, MAX_CUF_PROFILES> _CUFProfiles;
 
+    protected:
+        void ApplyDeferredStatUpdates(std::bitset<UNIT_MOD_END>& pendingUnitMods) override;
+
     private:
+        // updates a primary stat and the values depending only on that stat
+        void UpdateStatValue(Stats stat);
+        // updates the values depending on every primary stat
+        void UpdateStatDependents(bool meleeAttackPower, bool rangedAttackPower);
+
         // internal common parts for CanStore/StoreItem functions
         InventoryResult CanStoreItem_InSpecificSlot(uint8 bag, uint8 slot, ItemPosCountVec& dest, ItemTemplate const* pProto, uint32& count, bool swap, Item* pSrcItem) const;
         InventoryResult CanStoreItem_InBag(uint8 bag, ItemPosCountVec& dest, ItemTemplate const* pProto, uint32& count, bool merge, bool non_specialized, Item* pSrcItem, uint8 skip_bag, uint8 skip_slot) const;
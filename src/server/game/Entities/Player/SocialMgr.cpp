@@ -77,6 +77,9 @@ bool PlayerSocial::AddToSocialList(ObjectGuid const& friendGuid, ObjectGuid cons
         CharacterDatabase.Execute(stmt);
     }
 
+    if (flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr->AddFriendLister(friendGuid, GetPlayerGUID());
+
     if (flag & SOCIAL_FLAG_IGNORED)
         _ignoredAccounts.insert(accountGuid);
 
@@ -89,6 +92,9 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid const& friendGuid, SocialFlag
     if (itr == _playerSocialMap.end())
         return;
 
+    if (itr->second.Flags & flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr->RemoveFriendLister(friendGuid, GetPlayerGUID());
+
     itr->second.Flags &= ~flag;
 
     if (!itr->second.Flags)
@@ -217,6 +223,35 @@ SocialMgr* SocialMgr::instance()
     return &instance;
 }
 
+void SocialMgr::RemovePlayerSocial(ObjectGuid const& guid)
+{
+    SocialMap::iterator itr = _socialMap.find(guid);
+    if (itr == _socialMap.end())
+        return;
+
+    for (PlayerSocial::PlayerSocialMap::value_type const& contact : itr->second._playerSocialMap)
+        if (contact.second.Flags & SOCIAL_FLAG_FRIEND)
+            RemoveFriendLister(contact.first, guid);
+
+    _socialMap.erase(itr);
+}
+
+void SocialMgr::AddFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid)
+{
+    _friendListers[friendGuid].insert(listerGuid);
+}
+
+void SocialMgr::RemoveFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid)
+{
+    auto itr = _friendListers.find(friendGuid);
+    if (itr == _friendListers.end())
+        return;
+
+    itr->second.erase(listerGuid);
+    if (itr->second.empty())
+        _friendListers.erase(itr);
+}
+
 void SocialMgr::GetFriendInfo(Player* player, ObjectGuid const& friendGUID, FriendInfo& friendInfo)
 {
     if (!player)
@@ -292,26 +327,26 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket const* pack
 {
     ASSERT(player);
 
+    auto listers = _friendListers.find(player->GetGUID());
+    if (listers == _friendListers.end())
+        return;
+
     AccountTypes gmSecLevel = AccountTypes(sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST));
-    for (SocialMap::const_iterator itr = _socialMap.begin(); itr != _socialMap.end(); ++itr)
+    for (ObjectGuid const& listerGuid : listers->second)
     {
-        PlayerSocial::PlayerSocialMap::const_iterator itr2 = itr->second._playerSocialMap.find(player->GetGUID());
-        if (itr2 != itr->second._playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND) != 0)
-        {
-            Player* target = ObjectAccessor::FindPlayer(itr->first);
-            if (!target)
-                continue;
+        Player* target = ObjectAccessor::FindPlayer(listerGuid);
+        if (!target)
+            continue;
 
-            WorldSession* session = target->GetSession();
-            if (!session->HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS) && player->GetSession()->GetSecurity() > gmSecLevel)
-                continue;
+        WorldSession* session = target->GetSession();
+        if (!session->HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS) && player->GetSession()->GetSecurity() > gmSecLevel)
+            continue;
 
-            if (target->GetTeam() != player->GetTeam() && !session->HasPermission(rbac::RBAC_PERM_TWO_SIDE_WHO_LIST))
-                continue;
+        if (target->GetTeam() != player->GetTeam() && !session->HasPermission(rbac::RBAC_PERM_TWO_SIDE_WHO_LIST))
+            continue;
 
-            if (player->IsVisibleGloballyFor(target))
-                session->SendPacket(packet);
-        }
+        if (player->IsVisibleGloballyFor(target))
+            session->SendPacket(packet);
     }
 }
 
@@ -331,6 +366,8 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid const
 
             uint8 flag = fields[2].GetUInt8();
             social->_playerSocialMap[friendGuid] = FriendInfo(friendAccountGuid, flag, fields[3].GetString());
+            if (flag & SOCIAL_FLAG_FRIEND)
+                AddFriendLister(friendGuid, guid);
             if (flag & SOCIAL_FLAG_IGNORED)
                 social->_ignoredAccounts.insert(friendAccountGuid);
         }
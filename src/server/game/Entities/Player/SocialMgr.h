@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <unordered_map>
 
 class Player;
 class WorldPacket;
@@ -145,6 +146,8 @@ class SocialMgr
         SocialMgr();
         ~SocialMgr();
 
+        friend class PlayerSocial;
+
     public:
         SocialMgr(SocialMgr const&) = delete;
         SocialMgr(SocialMgr&&) = delete;
@@ -154,7 +157,7 @@ class SocialMgr
         static SocialMgr* instance();
 
         // Misc
-        void RemovePlayerSocial(ObjectGuid const& guid) { _socialMap.erase(guid); }
+        void RemovePlayerSocial(ObjectGuid const& guid);
 
         static void GetFriendInfo(Player* player, ObjectGuid const& friendGUID, FriendInfo& friendInfo);
 
@@ -166,8 +169,14 @@ class SocialMgr
         PlayerSocial* LoadFromDB(PreparedQueryResult result, ObjectGuid const& guid);
 
     private:
+        void AddFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid);
+        void RemoveFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid);
+
         typedef std::map<ObjectGuid, PlayerSocial> SocialMap;
         SocialMap _socialMap;
+
+        // reverse index of _socialMap friend entries - friend guid -> guids of loaded players that have it on their friend list
+        std::unordered_map<ObjectGuid, GuidUnorderedSet> _friendListers;
 };
 
 #define sSocialMgr SocialMgr::instance()
@@ -17,6 +17,7 @@
 
 #include "TaxiPathGraph.h"
 #include "DB2Stores.h"
+#include "Hash.h"
 #include "MapUtils.h"
 #include "ObjectMgr.h"
 #include "Player.h"
@@ -24,33 +25,16 @@
 #include <boost/graph/depth_first_search.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/property_map/transform_value_property_map.hpp>
+#include <list>
+#include <memory>
+#include <mutex>
 
 namespace
 {
 struct EdgeCost
 {
-    TaxiNodesEntry const* To;
+    std::size_t ToVertex;
     uint32 Distance;
-    uint32 EvaluateDistance(Player const* player) const
-    {
-        bool isVisibleForFaction = [&]
-        {
-            switch (player->GetTeam())
-            {
-                case HORDE: return To->GetFlags().HasFlag(TaxiNodeFlags::ShowOnHordeMap);
-                case ALLIANCE: return To->GetFlags().HasFlag(TaxiNodeFlags::ShowOnAllianceMap);
-                default: break;
-            }
-            return false;
-        }();
-        if (!isVisibleForFaction)
-            return std::numeric_limits<uint16>::max();
-
-        if (!ConditionMgr::IsPlayerMeetingCondition(player, To->ConditionID))
-            return std::numeric_limits<uint16>::max();
-
-        return Distance;
-    }
 };
 
 typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS, boost::property<boost::vertex_index_t, uint32>, boost::property<boost::edge_weight_t, EdgeCost>> Graph;
@@ -62,6 +46,120 @@ typedef std::pair<vertex_descriptor, vertex_descriptor> edge;
 Graph m_graph;
 std::vector<TaxiNodesEntry const*> m_nodesByVertex;
 std::unordered_map<uint32, vertex_descriptor> m_verticesByNode;
+std::vector<vertex_descriptor> m_conditionalVertices;   // nodes with a player condition, their results are part of the route cache key
+
+// Everything that decides which nodes a player can fly through
+struct ShortestPathTreeKey
+{
+    vertex_descriptor From;
+    Team PlayerTeam;
+    std::vector<bool> MetConditions;    // indexed like m_conditionalVertices
+
+    bool operator==(ShortestPathTreeKey const& right) const = default;
+};
+
+struct ShortestPathTreeKeyHash
+{
+    std::size_t operator()(ShortestPathTreeKey const& key) const
+    {
+        std::size_t hashVal = 0;
+        Trinity::hash_combine(hashVal, key.From);
+        Trinity::hash_combine(hashVal, key.PlayerTeam);
+        Trinity::hash_combine(hashVal, key.MetConditions);
+        return hashVal;
+    }
+};
+
+// predecessor of every vertex on the shortest path from the key's source vertex
+using ShortestPathTree = std::vector<vertex_descriptor>;
+
+// Least recently used shortest path trees, shared by all map update threads
+class ShortestPathTreeCache
+{
+public:
+    static constexpr std::size_t MaxSize = 256;
+
+    std::shared_ptr<ShortestPathTree const> Get(ShortestPathTreeKey const& key)
+    {
+        std::lock_guard lock(_lock);
+        auto itr = _entriesByKey.find(key);
+        if (itr == _entriesByKey.end())
+            return nullptr;
+
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        return itr->second->second;
+    }
+
+    void Add(ShortestPathTreeKey const& key, std::shared_ptr<ShortestPathTree const> tree)
+    {
+        std::lock_guard lock(_lock);
+        if (_entriesByKey.contains(key))
+            return;
+
+        _entries.emplace_front(key, std::move(tree));
+        _entriesByKey.emplace(key, _entries.begin());
+        if (_entries.size() > MaxSize)
+        {
+            _entriesByKey.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+    }
+
+private:
+    using EntryList = std::list<std::pair<ShortestPathTreeKey, std::shared_ptr<ShortestPathTree const>>>;
+
+    std::mutex _lock;
+    EntryList _entries;
+    std::unordered_map<ShortestPathTreeKey, EntryList::iterator, ShortestPathTreeKeyHash> _entriesByKey;
+};
+
+ShortestPathTreeCache m_shortestPathTrees;
+
+bool IsVisibleForTeam(TaxiNodesEntry const* node, Team team)
+{
+    switch (team)
+    {
+        case HORDE: return node->GetFlags().HasFlag(TaxiNodeFlags::ShowOnHordeMap);
+        case ALLIANCE: return node->GetFlags().HasFlag(TaxiNodeFlags::ShowOnAllianceMap);
+        default: break;
+    }
+    return false;
+}
+
+std::shared_ptr<ShortestPathTree const> ComputeShortestPathTree(ShortestPathTreeKey const& key)
+{
+    std::vector<bool> passableVertices(m_nodesByVertex.size());
+    for (std::size_t i = 0; i < m_nodesByVertex.size(); ++i)
+        passableVertices[i] = IsVisibleForTeam(m_nodesByVertex[i], key.PlayerTeam);
+
+    for (std::size_t i = 0; i < m_conditionalVertices.size(); ++i)
+        if (!key.MetConditions[i])
+            passableVertices[m_conditionalVertices[i]] = false;
+
+    std::shared_ptr<ShortestPathTree> p = std::make_shared<ShortestPathTree>(boost::num_vertices(m_graph));
+    std::vector<uint32> d(boost::num_vertices(m_graph));
+
+    boost::dijkstra_shortest_paths(m_graph, key.From,
+        boost::predecessor_map(boost::make_iterator_property_map(p->begin(), boost::get(boost::vertex_index, m_graph)))
+        .distance_map(boost::make_iterator_property_map(d.begin(), boost::get(boost::vertex_index, m_graph)))
+        .vertex_index_map(boost::get(boost::vertex_index, m_graph))
+        .distance_compare(std::less<uint32>())
+        .distance_combine(boost::closed_plus<uint32>())
+        .distance_inf(std::numeric_limits<uint32>::max())
+        .distance_zero(0)
+        .visitor(boost::dijkstra_visitor<boost::null_visitor>())
+        .weight_map(boost::make_transform_value_property_map(
+            [&passableVertices](EdgeCost const& edgeCost) -> uint32
+            {
+                if (!passableVertices[edgeCost.ToVertex])
+                    return std::numeric_limits<uint16>::max();
+
+                return edgeCost.Distance;
+            },
+            boost::get(boost::edge_weight, m_graph))));
+
+    return p;
+}
 
 void GetTaxiMapPosition(DBCPosition3D const& position, int32 mapId, DBCPosition2D* uiMapPosition, uint32* uiMapId)
 {
@@ -92,7 +190,7 @@ void AddVerticeAndEdgeFromNodeInfo(TaxiNodesEntry const* from, TaxiNodesEntry co
         TaxiPathNodeList const& nodes = sTaxiPathNodesByPath[pathId];
         if (nodes.size() < 2)
         {
-            edges.emplace_back(edge(fromVertexID, toVertexID), EdgeCost{ to, 0xFFFF });
+            edges.emplace_back(edge(fromVertexID, toVertexID), EdgeCost{ toVertexID, 0xFFFF });
             return;
         }
 
@@ -127,7 +225,7 @@ void AddVerticeAndEdgeFromNodeInfo(TaxiNodesEntry const* from, TaxiNodesEntry co
         if (dist > 0xFFFF)
             dist = 0xFFFF;
 
-        edges.emplace_back(edge(fromVertexID, toVertexID), EdgeCost{ to, dist });
+        edges.emplace_back(edge(fromVertexID, toVertexID), EdgeCost{ toVertexID, dist });
     }
 }
 
@@ -193,6 +291,10 @@ void TaxiPathGraph::Initialize()
         edge_descriptor e = boost::add_edge(edges[j].first.first, edges[j].first.second, m_graph).first;
         weightmap[e] = edges[j].second;
     }
+
+    for (vertex_descriptor v = 0; v < m_nodesByVertex.size(); ++v)
+        if (m_nodesByVertex[v]->ConditionID)
+            m_conditionalVertices.push_back(v);
 }
 
 std::size_t TaxiPathGraph::GetCompleteNodeRoute(TaxiNodesEntry const* from, TaxiNodesEntry const* to, Player const* player, std::vector<uint32>& shortestPath)
@@ -219,21 +321,20 @@ std::size_t TaxiPathGraph::GetCompleteNodeRoute(TaxiNodesEntry const* from, Taxi
         vertex_descriptor const* toVertexId = GetVertexIDFromNodeID(to);
         if (fromVertexId && toVertexId)
         {
-            std::vector<vertex_descriptor> p(boost::num_vertices(m_graph));
-            std::vector<uint32> d(boost::num_vertices(m_graph));
-
-            boost::dijkstra_shortest_paths(m_graph, *fromVertexId,
-                boost::predecessor_map(boost::make_iterator_property_map(p.begin(), boost::get(boost::vertex_index, m_graph)))
-                .distance_map(boost::make_iterator_property_map(d.begin(), boost::get(boost::vertex_index, m_graph)))
-                .vertex_index_map(boost::get(boost::vertex_index, m_graph))
-                .distance_compare(std::less<uint32>())
-                .distance_combine(boost::closed_plus<uint32>())
-                .distance_inf(std::numeric_limits<uint32>::max())
-                .distance_zero(0)
-                .visitor(boost::dijkstra_visitor<boost::null_visitor>())
-                .weight_map(boost::make_transform_value_property_map(
-                    [player](EdgeCost const& edgeCost) { return edgeCost.EvaluateDistance(player); },
-                    boost::get(boost::edge_weight, m_graph))));
+            // routes only differ by team and the node conditions the player meets, players sharing those share the search result
+            ShortestPathTreeKey key{ .From = *fromVertexId, .PlayerTeam = player->GetTeam() };
+            key.MetConditions.reserve(m_conditionalVertices.size());
+            for (vertex_descriptor v : m_conditionalVertices)
+                key.MetConditions.push_back(ConditionMgr::IsPlayerMeetingCondition(player, m_nodesByVertex[v]->ConditionID));
+
+            std::shared_ptr<ShortestPathTree const> predecessors = m_shortestPathTrees.Get(key);
+            if (!predecessors)
+            {
+                predecessors = ComputeShortestPathTree(key);
+                m_shortestPathTrees.Add(key, predecessors);
+            }
+
+            ShortestPathTree const& p = *predecessors;
 
             // found a path to the goal
             for (vertex_descriptor v = *toVertexId; ; v = p[v])
@@ -701,20 +701,35 @@ void Transport::TeleportPassengersAndHideTransport(uint32 newMapid)
 
 void Transport::UpdatePassengerPositions(PassengerSet const& passengers)
 {
+    if (passengers.empty())
+        return;
+
+    // every passenger is relocated inside one island update lock and with the same transport rotation
+    std::unique_lock<std::recursive_mutex> lock = GetMap()->LockForIslandUpdate();
+
+    float transportO = GetTransportOrientation();
+    float cosO = std::cos(transportO);
+    float sinO = std::sin(transportO);
     for (WorldObject* passenger : passengers)
     {
-        float x, y, z, o;
-        passenger->m_movementInfo.transport.pos.GetPosition(x, y, z, o);
-        CalculatePassengerPosition(x, y, z, &o);
+        float offsetX, offsetY, offsetZ, offsetO;
+        passenger->m_movementInfo.transport.pos.GetPosition(offsetX, offsetY, offsetZ, offsetO);
+
+        // same transform as TransportBase::CalculatePassengerPosition
+        float x = GetPositionX() + offsetX * cosO - offsetY * sinO;
+        float y = GetPositionY() + offsetY * cosO + offsetX * sinO;
+        float z = GetPositionZ() + offsetZ;
+        float o = Position::NormalizeOrientation(transportO + offsetO);
         UpdatePassengerPosition(GetMap(), passenger, x, y, z, o, true);
     }
 }
 
 void Transport::BuildUpdate(UpdateDataMapType& data_map)
 {
+    ValuesUpdateBlockCache valuesUpdateCache;
     for (MapReference const& playerReference : GetMap()->GetPlayers())
         if (playerReference.GetSource()->InSamePhase(this))
-            BuildFieldsUpdate(playerReference.GetSource(), data_map);
+            BuildFieldsUpdate(playerReference.GetSource(), data_map, &valuesUpdateCache);
 
     ClearUpdateMask(true);
 }
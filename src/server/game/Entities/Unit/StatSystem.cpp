@@ -104,6 +104,13 @@ int32 Unit::GetCreatePowerValue(Powers power) const
 #######################################*/
 
 bool Player::UpdateStats(Stats stat)
+{
+    UpdateStatValue(stat);
+    UpdateStatDependents(stat == STAT_STRENGTH || stat == STAT_AGILITY, stat == STAT_AGILITY);
+    return true;
+}
+
+void Player::UpdateStatValue(Stats stat)
 {
     // value = ((base_value * base_pct) + total_value) * total_pct
     float value  = GetTotalStatValue(stat);
@@ -132,19 +139,54 @@ bool Player::UpdateStats(Stats stat)
         default:
             break;
     }
+}
 
-    if (stat == STAT_STRENGTH)
-        UpdateAttackPowerAndDamage(false);
-    else if (stat == STAT_AGILITY)
-    {
+void Player::UpdateStatDependents(bool meleeAttackPower, bool rangedAttackPower)
+{
+    if (meleeAttackPower)
         UpdateAttackPowerAndDamage(false);
+    if (rangedAttackPower)
         UpdateAttackPowerAndDamage(true);
-    }
 
     UpdateArmor();
     UpdateSpellDamageAndHealingBonus();
     UpdateManaRegen();
-    return true;
+}
+
+void Player::ApplyDeferredStatUpdates(std::bitset<UNIT_MOD_END>& pendingUnitMods)
+{
+    // values shared by all primary stats are updated once for all changed stats
+    bool statChanged = false;
+    bool meleeAttackPower = false;
+    bool rangedAttackPower = false;
+    for (uint8 i = STAT_STRENGTH; i < MAX_STATS; ++i)
+    {
+        if (!pendingUnitMods.test(UNIT_MOD_STAT_START + i))
+            continue;
+
+        pendingUnitMods.reset(UNIT_MOD_STAT_START + i);
+        UpdateStatValue(Stats(i));
+        statChanged = true;
+        meleeAttackPower = meleeAttackPower || i == STAT_STRENGTH || i == STAT_AGILITY;
+        rangedAttackPower = rangedAttackPower || i == STAT_AGILITY;
+    }
+
+    if (statChanged)
+    {
+        if (meleeAttackPower)
+            pendingUnitMods.reset(UNIT_MOD_ATTACK_POWER);
+        if (rangedAttackPower)
+            pendingUnitMods.reset(UNIT_MOD_ATTACK_POWER_RANGED);
+        pendingUnitMods.reset(UNIT_MOD_ARMOR);
+        UpdateStatDependents(meleeAttackPower, rangedAttackPower);
+    }
+
+    Unit::ApplyDeferredStatUpdates(pendingUnitMods);
+
+    std::bitset<MAX_COMBAT_RATING> pendingRatings = std::exchange(m_pendingRatingUpdates, {});
+    for (uint8 cr = 0; cr < MAX_COMBAT_RATING; ++cr)
+        if (pendingRatings.test(cr))
+            UpdateRating(CombatRating(cr));
 }
 
 void Player::ApplySpellPowerBonus(int32 amount, bool apply)
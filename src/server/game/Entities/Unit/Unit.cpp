@@ -85,6 +85,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "VehiclePackets.h"
+#include "ViewerDependentValues.h"
 #include "Vignette.h"
 #include "VignettePackets.h"
 #include "World.h"
@@ -338,6 +339,7 @@ Unit::Unit(bool isWorldObject) :
     m_auraUpdateIterator = m_ownedAuras.end();
 
     m_canModifyStats = false;
+    m_statUpdateDeferrals = 0;
 
     for (uint8 i = 0; i < UNIT_MOD_END; ++i)
     {
@@ -800,9 +802,7 @@ bool Unit::HasBreakableByDamageCrowdControlAura(Unit* excludeCasterChannel) cons
 
 /*static*/ AuraEffectVector Unit::CopyAuraEffectList(Unit::AuraEffectList const& list)
 {
-    AuraEffectVector effects;
-    std::copy(list.begin(), list.end(), std::back_inserter(effects));
-    return effects;
+    return AuraEffectVector(list.begin(), list.end());
 }
 
 /*static*/ uint32 Unit::DealDamage(Unit* attacker, Unit* victim, uint32 damage, CleanDamage const* cleanDamage, DamageEffectType damagetype, SpellSchoolMask damageSchoolMask, SpellInfo const* spellProto, bool durabilityLoss)
@@ -1878,8 +1878,19 @@ void Unit::HandleEmoteCommand(Emote emoteId, Player* target /*=nullptr*/, Trinit
 
     // We're going to call functions which can modify content of the list during iteration over it's elements
     // Let's copy the list so we can prevent iterator invalidation
-    AuraEffectVector vSchoolAbsorbCopy = CopyAuraEffectList(damageInfo.GetVictim()->GetAuraEffectsByType(SPELL_AURA_SCHOOL_ABSORB));
-    std::sort(vSchoolAbsorbCopy.begin(), vSchoolAbsorbCopy.end(), Trinity::AbsorbAuraOrderPred());
+    // school mask of an aura effect never changes, only copy (and sort) the ones that can absorb this damage
+    auto copyAuraEffectsForSchool = [&](AuraType auraType)
+    {
+        AuraEffectVector effects;
+        for (AuraEffect* aurEff : damageInfo.GetVictim()->GetAuraEffectsByType(auraType))
+            if (aurEff->GetMiscValue() & damageInfo.GetSchoolMask())
+                effects.push_back(aurEff);
+        return effects;
+    };
+
+    AuraEffectVector vSchoolAbsorbCopy = copyAuraEffectsForSchool(SPELL_AURA_SCHOOL_ABSORB);
+    if (vSchoolAbsorbCopy.size() > 1)
+        std::sort(vSchoolAbsorbCopy.begin(), vSchoolAbsorbCopy.end(), Trinity::AbsorbAuraOrderPred());
 
     // absorb without mana cost
     for (auto itr = vSchoolAbsorbCopy.begin(); (itr != vSchoolAbsorbCopy.end()) && (damageInfo.GetDamage() > 0); ++itr)
@@ -1889,8 +1900,6 @@ void Unit::HandleEmoteCommand(Emote emoteId, Player* target /*=nullptr*/, Trinit
         AuraApplication const* aurApp = absorbAurEff->GetBase()->GetApplicationOfTarget(damageInfo.GetVictim()->GetGUID());
         if (!aurApp)
             continue;
-        if (!(absorbAurEff->GetMiscValue() & damageInfo.GetSchoolMask()))
-            continue;
 
         // get amount which can be still absorbed by the aura
         int32 currentAbsorb = absorbAurEff->GetAmount();
@@ -1948,7 +1957,7 @@ void Unit::HandleEmoteCommand(Emote emoteId, Player* target /*=nullptr*/, Trinit
     }
 
     // absorb by mana cost
-    AuraEffectVector vManaShieldCopy = CopyAuraEffectList(damageInfo.GetVictim()->GetAuraEffectsByType(SPELL_AURA_MANA_SHIELD));
+    AuraEffectVector vManaShieldCopy = copyAuraEffectsForSchool(SPELL_AURA_MANA_SHIELD);
     for (auto itr = vManaShieldCopy.begin(); (itr != vManaShieldCopy.end()) && (damageInfo.GetDamage() > 0); ++itr)
     {
         AuraEffect* absorbAurEff = *itr;
@@ -1956,9 +1965,6 @@ void Unit::HandleEmoteCommand(Emote emoteId, Player* target /*=nullptr*/, Trinit
         AuraApplication const* aurApp = absorbAurEff->GetBase()->GetApplicationOfTarget(damageInfo.GetVictim()->GetGUID());
         if (!aurApp)
             continue;
-        // check damage school mask
-        if (!(absorbAurEff->GetMiscValue() & damageInfo.GetSchoolMask()))
-            continue;
 
         // get amount which can be still absorbed by the aura
         int32 currentAbsorb = absorbAurEff->GetAmount();
@@ -2029,7 +2035,7 @@ void Unit::HandleEmoteCommand(Emote emoteId, Player* target /*=nullptr*/, Trinit
     {
         // We're going to call functions which can modify content of the list during iteration over it's elements
         // Let's copy the list so we can prevent iterator invalidation
-        AuraEffectVector vSplitDamagePctCopy = CopyAuraEffectList(damageInfo.GetVictim()->GetAuraEffectsByType(SPELL_AURA_SPLIT_DAMAGE_PCT));
+        AuraEffectVector vSplitDamagePctCopy = copyAuraEffectsForSchool(SPELL_AURA_SPLIT_DAMAGE_PCT);
         for (auto itr = vSplitDamagePctCopy.begin(); itr != vSplitDamagePctCopy.end() && damageInfo.GetDamage() > 0; ++itr)
         {
             // Check if aura was removed during iteration - we don't need to work on such auras
@@ -2037,10 +2043,6 @@ void Unit::HandleEmoteCommand(Emote emoteId, Player* target /*=nullptr*/, Trinit
             if (!aurApp)
                 continue;
 
-            // check damage school mask
-            if (!((*itr)->GetMiscValue() & damageInfo.GetSchoolMask()))
-                continue;
-
             // Damage can be splitted only if aura has an alive caster
             Unit* caster = (*itr)->GetCaster();
             if (!caster || (caster == damageInfo.GetVictim()) || !caster->IsInWorld() || !caster->IsAlive())
@@ -3500,6 +3502,10 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint32 effMask)
         AddInterruptMask(aurSpellInfo->AuraInterruptFlags, aurSpellInfo->AuraInterruptFlags2);
     }
 
+    if (SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(aurSpellInfo))
+        m_procAuras.push_back({ .Application = aurApp, .ProcFlags = procEntry->ProcFlags,
+            .CheckOnEveryEvent = aurSpellInfo->HasAttribute(SPELL_ATTR0_PROC_FAILURE_BURNS_CHARGE) || aurSpellInfo->HasAttribute(SPELL_ATTR2_PROC_COOLDOWN_ON_FAILURE) });
+
     if (AuraStateType aState = aura->GetSpellInfo()->GetAuraState())
         m_auraStateAuras.insert(AuraStateAurasMap::value_type(aState, aurApp));
 
@@ -3605,6 +3611,8 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
         UpdateInterruptMask();
     }
 
+    std::erase_if(m_procAuras, [aurApp](ProcAuraApplication const& procAura) { return procAura.Application == aurApp; });
+
     bool auraStateFound = false;
     AuraStateType auraState = aura->GetSpellInfo()->GetAuraState();
     if (auraState)
@@ -4974,7 +4982,9 @@ int32 Unit::GetTotalAuraModifier(AuraType auraType, std::function<bool(AuraEffec
         {
             // Check if the Aura Effect has a the Same Effect Stack Rule and if so, use the highest amount of that SpellGroup
             // If the Aura Effect does not have this Stack Rule, it returns false so we can add to the multiplier as usual
-            if (!sSpellMgr->AddSameEffectStackRuleSpellGroups(aurEff->GetSpellInfo(), static_cast<uint32>(auraType), aurEff->GetAmount(), sameEffectSpellGroup))
+            if (SpellGroup group = SpellGroup(aurEff->GetSameEffectStackRuleGroup()))
+                SpellMgr::AddSameEffectStackRuleSpellGroupAmount(group, aurEff->GetAmount(), sameEffectSpellGroup);
+            else
                 modifier += aurEff->GetAmount();
         }
     }
@@ -5001,7 +5011,9 @@ float Unit::GetTotalAuraMultiplier(AuraType auraType, std::function<bool(AuraEff
         {
             // Check if the Aura Effect has a the Same Effect Stack Rule and if so, use the highest amount of that SpellGroup
             // If the Aura Effect does not have this Stack Rule, it returns false so we can add to the multiplier as usual
-            if (!sSpellMgr->AddSameEffectStackRuleSpellGroups(aurEff->GetSpellInfo(), static_cast<uint32>(auraType), aurEff->GetAmount(), sameEffectSpellGroup))
+            if (SpellGroup group = SpellGroup(aurEff->GetSameEffectStackRuleGroup()))
+                SpellMgr::AddSameEffectStackRuleSpellGroupAmount(group, aurEff->GetAmount(), sameEffectSpellGroup);
+            else
                 AddPct(multiplier, aurEff->GetAmount());
         }
     }
@@ -5563,13 +5575,17 @@ void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage const* log)
 void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* info)
 {
     AuraEffect const* aura = info->auraEff;
-    WorldPackets::CombatLog::SpellPeriodicAuraLog data;
-    data.TargetGUID = GetGUID();
-    data.CasterGUID = aura->GetCasterGUID();
-    data.SpellID = aura->GetId();
-    data.LogData.Initialize(this);
+    WorldPackets::CombatLog::SpellPeriodicAuraLog immediateData;
+    WorldPackets::CombatLog::SpellPeriodicAuraLog* data = aura->GetBase()->GetPendingPeriodicAuraLog(this);
+    if (!data)
+    {
+        data = &immediateData;
+        data->TargetGUID = GetGUID();
+        data->CasterGUID = aura->GetCasterGUID();
+        data->SpellID = aura->GetId();
+    }
 
-    WorldPackets::CombatLog::PeriodicAuraLogEffect& spellLogEffect = data.Effects.emplace_back();
+    WorldPackets::CombatLog::PeriodicAuraLogEffect& spellLogEffect = data->Effects.emplace_back();
     spellLogEffect.Effect = aura->GetAuraType();
     spellLogEffect.Amount = info->damage;
     spellLogEffect.OriginalDamage = info->originalDamage;
@@ -5585,7 +5601,12 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* info)
         if (contentTuningParams.GenerateDataForUnits(caster, this))
             spellLogEffect.ContentTuning = contentTuningParams;
 
-    SendCombatLogMessage(&data);
+    // batched logs are sent by the aura after all of its effects ticked
+    if (data == &immediateData)
+    {
+        data->LogData.Initialize(this);
+        SendCombatLogMessage(data);
+    }
 }
 
 void Unit::SendSpellDamageResist(Unit* target, uint32 spellId)
@@ -9496,6 +9517,12 @@ void Unit::UpdateUnitMod(UnitMods unitMod)
     if (!CanModifyStats())
         return;
 
+    if (IsDeferringStatUpdates())
+    {
+        m_pendingUnitModUpdates.set(unitMod);
+        return;
+    }
+
     switch (unitMod)
     {
         case UNIT_MOD_STAT_STRENGTH:
@@ -9553,6 +9580,25 @@ void Unit::UpdateUnitMod(UnitMods unitMod)
     }
 }
 
+void Unit::EndDeferredStatUpdates()
+{
+    ASSERT(m_statUpdateDeferrals);
+    if (--m_statUpdateDeferrals)
+        return;
+
+    std::bitset<UNIT_MOD_END> pendingUnitMods = std::exchange(m_pendingUnitModUpdates, {});
+    ApplyDeferredStatUpdates(pendingUnitMods);
+}
+
+void Unit::ApplyDeferredStatUpdates(std::bitset<UNIT_MOD_END>& pendingUnitMods)
+{
+    for (std::size_t unitMod = 0; unitMod < pendingUnitMods.size(); ++unitMod)
+        if (pendingUnitMods.test(unitMod))
+            UpdateUnitMod(UnitMods(unitMod));
+
+    pendingUnitMods.reset();
+}
+
 void Unit::UpdateDamageDoneMods(WeaponAttackType attackType, int32 /*skipEnchantSlot = -1*/)
 {
     UnitMods unitMod;
@@ -10376,8 +10422,18 @@ void Unit::GetProcAurasTriggeredOnEvent(AuraApplicationProcContainer& aurasTrigg
     // or generate one on our own
     else
     {
-        for (AuraApplicationMap::iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
-            processAuraApplication(itr->second);
+        // auras without spell_proc data never proc and auras whose proc flags do not match fail without side effects
+        // indexed loop, procs may apply new auras
+        std::size_t firstTriggeringProc = aurasTriggeringProc.size();
+        for (std::size_t i = 0; i < m_procAuras.size(); ++i)
+            if (m_procAuras[i].CheckOnEveryEvent || (m_procAuras[i].ProcFlags & eventInfo.GetTypeMask()))
+                processAuraApplication(m_procAuras[i].Application);
+
+        // keep the order of applied auras map
+        std::stable_sort(aurasTriggeringProc.begin() + firstTriggeringProc, aurasTriggeringProc.end(), [](auto const& left, auto const& right)
+        {
+            return left.second->GetBase()->GetId() < right.second->GetBase()->GetId();
+        });
     }
 }
 
@@ -13932,6 +13988,43 @@ UF::UpdateFieldFlag Unit::GetUpdateFieldFlagsFor(Player const* target) const
     return flags;
 }
 
+bool Unit::HasViewerDependentValuesUpdate() const
+{
+    return UF::HasViewerDependentChanges(*m_objectData) || UF::HasViewerDependentChanges(*m_unitData);
+}
+
+void Unit::DiscardUnchangedValues()
+{
+    if (!m_values.HasChanged(TYPEID_UNIT))
+        return;
+
+    // repeated writes already collapse into the latest value, this catches values that went back to what viewers have
+    UF::UnitData& unitData = const_cast<UF::UnitData&>(*m_unitData);
+    auto discardIfUnchanged = [](auto& sentValue, auto currentValue, bool changed)
+    {
+        if (!changed)
+            return false;
+
+        if (sentValue == currentValue)
+            return true;
+
+        sentValue = currentValue;
+        return false;
+    };
+
+    if (discardIfUnchanged(_sentValues.Health, *m_unitData->Health, unitData.HasChanged(&UF::UnitData::Health)))
+        unitData.ClearChanged(&UF::UnitData::Health);
+
+    for (uint32 i = 0; i < MAX_POWERS_PER_CLASS; ++i)
+        if (discardIfUnchanged(_sentValues.Power[i], m_unitData->Power[i], unitData.HasChanged(&UF::UnitData::Power, i)))
+            unitData.ClearChanged(&UF::UnitData::Power, i);
+}
+
+void Unit::InvalidateSentValues() const
+{
+    _sentValues = { };
+}
+
 void Unit::DestroyForPlayer(Player* target) const
 {
     if (Battleground* bg = target->GetBattleground())
@@ -27,6 +27,7 @@
 #include "UnitDefines.h"
 #include "Util.h"
 #include <array>
+#include <bitset>
 #include <forward_list>
 #include <map>
 #include <memory>
@@ -1539,6 +1540,10 @@ class TC_GAME_API Unit : public WorldObject
         Stats GetStatByAuraGroup(UnitMods unitMod) const;
         bool CanModifyStats() const { return m_canModifyStats; }
         void SetCanModifyStats(bool modifyStats) { m_canModifyStats = modifyStats; }
+        // unit mod updates requested between these calls are coalesced and run once when the outermost deferral ends
+        void BeginDeferredStatUpdates() { ++m_statUpdateDeferrals; }
+        void EndDeferredStatUpdates();
+        bool IsDeferringStatUpdates() const { return m_statUpdateDeferrals != 0; }
         virtual bool UpdateStats(Stats stat) = 0;
         virtual bool UpdateAllStats() = 0;
         virtual void UpdateResistances(uint32 school);
@@ -1859,12 +1864,19 @@ class TC_GAME_API Unit : public WorldObject
 
         std::string GetDebugInfo() const override;
 
+        void DiscardUnchangedValues() override;
+        void InvalidateSentValues() const override;
+
         UF::UpdateField<UF::UnitData, int32(WowCS::EntityFragment::CGObject), TYPEID_UNIT> m_unitData;
 
     protected:
         explicit Unit (bool isWorldObject);
 
+        // runs the updates coalesced while stat updates were deferred, consumed bits are cleared
+        virtual void ApplyDeferredStatUpdates(std::bitset<UNIT_MOD_END>& pendingUnitMods);
+
         UF::UpdateFieldFlag GetUpdateFieldFlagsFor(Player const* target) const override;
+        bool HasViewerDependentValuesUpdate() const override;
 
         void DestroyForPlayer(Player* target) const override;
         void ClearUpdateMask(bool remove) override;
@@ -1910,6 +1922,14 @@ class TC_GAME_API Unit : public WorldObject
         std::array<AuraEffectList, TOTAL_AURAS> m_modAuras;
         AuraList m_scAuras;                        // cast singlecast auras
         AuraApplicationList m_interruptableAuras;  // auras which have interrupt mask applied on unit
+
+        struct ProcAuraApplication
+        {
+            AuraApplication* Application;
+            ProcFlagsInit ProcFlags;
+            bool CheckOnEveryEvent;                // failing to proc burns a charge or starts the proc cooldown
+        };
+        std::vector<ProcAuraApplication> m_procAuras;  // applied auras with spell_proc data, in application order
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
         EnumFlag<SpellAuraInterruptFlags> m_interruptMask;
         EnumFlag<SpellAuraInterruptFlags2> m_interruptMask2;
@@ -1918,6 +1938,8 @@ class TC_GAME_API Unit : public WorldObject
         float m_auraPctModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_PCT_END];
         float m_weaponDamage[MAX_ATTACK][2];
         bool m_canModifyStats;
+        uint32 m_statUpdateDeferrals;
+        std::bitset<UNIT_MOD_END> m_pendingUnitModUpdates;
 
         VisibleAuraContainer m_visibleAuras;
         Trinity::Containers::FlatSet<AuraApplication*, VisibleAuraSlotCompare> m_visibleAurasToUpdate;
@@ -2029,6 +2051,31 @@ class TC_GAME_API Unit : public WorldObject
         PositionUpdateInfo _positionUpdateInfo;
 
         bool _isCombatDisallowed;
+
+        // frequently rewritten fields as last sent to every viewer, nullopt when unknown
+        struct SentValues
+        {
+            Optional<int64> Health;
+            std::array<Optional<int32>, MAX_POWERS_PER_CLASS> Power;
+        };
+
+        mutable SentValues _sentValues;
+};
+
+// Coalesces the stat updates caused by several stat modifier changes into one update of every affected value
+class DeferredStatUpdateScope
+{
+public:
+    explicit DeferredStatUpdateScope(Unit* unit) : _unit(unit) { _unit->BeginDeferredStatUpdates(); }
+    ~DeferredStatUpdateScope() { _unit->EndDeferredStatUpdates(); }
+
+    DeferredStatUpdateScope(DeferredStatUpdateScope const&) = delete;
+    DeferredStatUpdateScope(DeferredStatUpdateScope&&) = delete;
+    DeferredStatUpdateScope& operator=(DeferredStatUpdateScope const&) = delete;
+    DeferredStatUpdateScope& operator=(DeferredStatUpdateScope&&) = delete;
+
+private:
+    Unit* _unit;
 };
 
 #endif
@@ -25,19 +25,28 @@ namespace Vignettes
 {
 namespace
 {
-void UpdatePosition(VignetteData& vignette, WorldObject const* owner)
+bool UpdatePosition(VignetteData& vignette, WorldObject const* owner)
 {
+    bool changed = vignette.Position.GetExactDistSq(owner) > 0.0f;
     vignette.Position = owner->GetPosition();
     if (WmoLocation const* wmoLocation = owner->GetCurrentWmo())
     {
+        changed = changed || vignette.WMOGroupID != wmoLocation->GroupId || vignette.WMODoodadPlacementID != wmoLocation->UniqueId;
         vignette.WMOGroupID = wmoLocation->GroupId;
         vignette.WMODoodadPlacementID = wmoLocation->UniqueId;
     }
+
+    return changed;
 }
 
-void UpdateHealth(VignetteData& vignette, Unit const* owner)
+bool UpdateHealth(VignetteData& vignette, Unit const* owner)
 {
-    vignette.HealthPercent = float(owner->GetHealth()) / float(owner->GetMaxHealth()); // converted to percentage in lua
+    float healthPercent = float(owner->GetHealth()) / float(owner->GetMaxHealth()); // converted to percentage in lua
+    if (vignette.HealthPercent == healthPercent)
+        return false;
+
+    vignette.HealthPercent = healthPercent;
+    return true;
 }
 
 template<WorldPackets::Vignette::VignetteDataSet WorldPackets::Vignette::VignetteUpdate::* Field>
@@ -98,11 +107,20 @@ std::unique_ptr<VignetteData> Create(VignetteEntry const* vignetteData, WorldObj
     return vignette;
 }
 
+bool VignetteData::HasPlayerRequirements() const
+{
+    return Data->VisibleTrackingQuestID || Data->PlayerConditionID;
+}
+
 void Update(VignetteData& vignette, WorldObject const* owner)
 {
-    UpdatePosition(vignette, owner);
+    bool changed = UpdatePosition(vignette, owner);
     if (Unit const* unitOwner = owner->ToUnit())
-        UpdateHealth(vignette, unitOwner);
+        changed = UpdateHealth(vignette, unitOwner) || changed;
+
+    // players getting in range receive the vignette from Player::SendInitialVisiblePackets, only changes need to be sent
+    if (!changed)
+        return;
 
     if (vignette.Data->IsInfiniteAOI())
         vignette.NeedUpdate = true;
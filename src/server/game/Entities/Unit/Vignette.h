@@ -46,6 +46,9 @@ struct VignetteData
     bool NeedUpdate = false;
 
     void FillPacket(WorldPackets::Vignette::VignetteDataSet& dataSet) const;
+
+    // quest or player condition requirements, visibility has to be checked per player
+    bool HasPlayerRequirements() const;
 };
 
 std::unique_ptr<VignetteData> Create(VignetteEntry const* vignetteData, WorldObject const* owner);
@@ -1171,22 +1171,34 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         return;
     }
 
-    for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
+    std::unordered_map<uint32, std::vector<CreatureData const*>> creaturesByMap;
+    for (ObjectGuid::LowType spawnId : mGameEventCreatureGuids[internal_event_id])
     {
         // Add to correct cell
-        if (CreatureData const* data = sObjectMgr->GetCreatureData(*itr))
+        if (CreatureData const* data = sObjectMgr->GetCreatureData(spawnId))
         {
             sObjectMgr->AddCreatureToGrid(data);
+            creaturesByMap[data->mapId].push_back(data);
+        }
+    }
 
-            // Spawn if necessary (loaded grids only)
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr, data](Map* map)
+    // Spawn if necessary (loaded grids only), visiting the maps once per map id instead of once per spawn
+    for (auto const& [mapId, spawns] : creaturesByMap)
+    {
+        sMapMgr->DoForAllMapsWithMapId(mapId, [&spawns](Map* map)
+        {
+            CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+            for (CreatureData const* data : spawns)
             {
-                map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, *itr);
+                map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, data->spawnId, trans);
                 // We use spawn coords to spawn
                 if (map->IsGridLoaded(data->spawnPoint))
-                    Creature::CreateCreatureFromDB(*itr, map);
-            });
-        }
+                    Creature::CreateCreatureFromDB(data->spawnId, map);
+            }
+
+            if (trans->GetSize())
+                CharacterDatabase.CommitTransaction(trans);
+        });
     }
 
     if (internal_event_id >= int32(mGameEventGameobjectGuids.size()))
@@ -1196,21 +1208,30 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         return;
     }
 
-    for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
+    std::unordered_map<uint32, std::vector<GameObjectData const*>> gameobjectsByMap;
+    for (ObjectGuid::LowType spawnId : mGameEventGameobjectGuids[internal_event_id])
     {
         // Add to correct cell
-        if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
+        if (GameObjectData const* data = sObjectMgr->GetGameObjectData(spawnId))
         {
             sObjectMgr->AddGameobjectToGrid(data);
-            // Spawn if necessary (loaded grids only)
-            // this base map checked as non-instanced and then only existed
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr, data](Map* map)
+            gameobjectsByMap[data->mapId].push_back(data);
+        }
+    }
+
+    // Spawn if necessary (loaded grids only)
+    for (auto const& [mapId, spawns] : gameobjectsByMap)
+    {
+        sMapMgr->DoForAllMapsWithMapId(mapId, [&spawns](Map* map)
+        {
+            CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+            for (GameObjectData const* data : spawns)
             {
-                map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, *itr);
+                map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, data->spawnId, trans);
                 // We use current coords to unspawn, not spawn coords since creature can have changed grid
                 if (map->IsGridLoaded(data->spawnPoint))
                 {
-                    if (GameObject* go = GameObject::CreateGameObjectFromDB(*itr, map, false))
+                    if (GameObject* go = GameObject::CreateGameObjectFromDB(data->spawnId, map, false))
                     {
                         /// @todo find out when it is add to map
                         if (go->isSpawnedByDefault())
@@ -1220,8 +1241,11 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
                         }
                     }
                 }
-            });
-        }
+            }
+
+            if (trans->GetSize())
+                CharacterDatabase.CommitTransaction(trans);
+        });
     }
 
     if (internal_event_id >= int32(mGameEventPoolIds.size()))
@@ -1254,28 +1278,40 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         return;
     }
 
-    for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
+    std::unordered_map<uint32, std::vector<ObjectGuid::LowType>> creaturesByMap;
+    for (ObjectGuid::LowType spawnId : mGameEventCreatureGuids[internal_event_id])
     {
         // check if it's needed by another event, if so, don't remove
-        if (event_id > 0 && hasCreatureActiveEventExcept(*itr, event_id))
+        if (event_id > 0 && hasCreatureActiveEventExcept(spawnId, event_id))
             continue;
         // Remove the creature from grid
-        if (CreatureData const* data = sObjectMgr->GetCreatureData(*itr))
+        if (CreatureData const* data = sObjectMgr->GetCreatureData(spawnId))
         {
             sObjectMgr->RemoveCreatureFromGrid(data);
+            creaturesByMap[data->mapId].push_back(spawnId);
+        }
+    }
 
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr](Map* map)
+    for (auto const& [mapId, spawnIds] : creaturesByMap)
+    {
+        sMapMgr->DoForAllMapsWithMapId(mapId, [&spawnIds](Map* map)
+        {
+            CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+            for (ObjectGuid::LowType spawnId : spawnIds)
             {
-                map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, *itr);
-                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = creatureBounds.first; itr2 != creatureBounds.second;)
+                map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, spawnId, trans);
+                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(spawnId);
+                for (auto itr = creatureBounds.first; itr != creatureBounds.second;)
                 {
-                    Creature* creature = itr2->second;
-                    ++itr2;
+                    Creature* creature = itr->second;
+                    ++itr;
                     creature->AddObjectToRemoveList();
                 }
-            });
-        }
+            }
+
+            if (trans->GetSize())
+                CharacterDatabase.CommitTransaction(trans);
+        });
     }
 
     if (internal_event_id < 0 || internal_event_id >= int32(mGameEventGameobjectGuids.size()))
@@ -1285,28 +1321,40 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         return;
     }
 
-    for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
+    std::unordered_map<uint32, std::vector<ObjectGuid::LowType>> gameobjectsByMap;
+    for (ObjectGuid::LowType spawnId : mGameEventGameobjectGuids[internal_event_id])
     {
         // check if it's needed by another event, if so, don't remove
-        if (event_id >0 && hasGameObjectActiveEventExcept(*itr, event_id))
+        if (event_id > 0 && hasGameObjectActiveEventExcept(spawnId, event_id))
             continue;
         // Remove the gameobject from grid
-        if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
+        if (GameObjectData const* data = sObjectMgr->GetGameObjectData(spawnId))
         {
             sObjectMgr->RemoveGameobjectFromGrid(data);
+            gameobjectsByMap[data->mapId].push_back(spawnId);
+        }
+    }
 
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr](Map* map)
+    for (auto const& [mapId, spawnIds] : gameobjectsByMap)
+    {
+        sMapMgr->DoForAllMapsWithMapId(mapId, [&spawnIds](Map* map)
+        {
+            CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+            for (ObjectGuid::LowType spawnId : spawnIds)
             {
-                map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, *itr);
-                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = gameobjectBounds.first; itr2 != gameobjectBounds.second;)
+                map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, spawnId, trans);
+                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(spawnId);
+                for (auto itr = gameobjectBounds.first; itr != gameobjectBounds.second;)
                 {
-                    GameObject* go = itr2->second;
-                    ++itr2;
+                    GameObject* go = itr->second;
+                    ++itr;
                     go->AddObjectToRemoveList();
                 }
-            });
-        }
+            }
+
+            if (trans->GetSize())
+                CharacterDatabase.CommitTransaction(trans);
+        });
     }
 
     if (internal_event_id < 0 || internal_event_id >= int32(mGameEventPoolIds.size()))
@@ -1630,14 +1678,14 @@ class GameEventAIHookWorker
 public:
     GameEventAIHookWorker(uint16 eventId, bool activate) : _eventId(eventId), _activate(activate) { }
 
-    void Visit(std::unordered_map<ObjectGuid, Creature*>& creatureMap)
+    void Visit(Trinity::Containers::FlatHashMap<ObjectGuid, Creature*>& creatureMap)
     {
         for (auto const& p : creatureMap)
             if (p.second->IsInWorld() && p.second->IsAIEnabled())
                 p.second->AI()->OnGameEvent(_activate, _eventId);
     }
 
-    void Visit(std::unordered_map<ObjectGuid, GameObject*>& gameObjectMap)
+    void Visit(Trinity::Containers::FlatHashMap<ObjectGuid, GameObject*>& gameObjectMap)
     {
         for (auto const& p : gameObjectMap)
             if (p.second->IsInWorld())
@@ -1645,7 +1693,7 @@ public:
     }
 
     template<class T>
-    void Visit(std::unordered_map<ObjectGuid, T*>&) { }
+    void Visit(Trinity::Containers::FlatHashMap<ObjectGuid, T*>&) { }
 
 private:
     uint16 _eventId;
@@ -130,6 +130,8 @@ void GarrisonMap::InitVisibilityDistance()
     //init visibility distance for instances
     m_VisibleDistance = sWorld->getFloatConfig(CONFIG_MAX_VISIBILITY_DISTANCE_INSTANCE);
     m_VisibilityNotifyPeriod = sWorld->getIntConfig(CONFIG_VISIBILITY_NOTIFY_PERIOD_INSTANCE);
+    m_VisibilityNotifyNearDistance = sWorld->getFloatConfig(CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_INSTANCE);
+    m_VisibilityNotifyMidDistance = sWorld->getFloatConfig(CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_INSTANCE);
 }
 
 bool GarrisonMap::AddPlayerToMap(Player* player, bool initPlayer /*= true*/)
@@ -26,6 +26,7 @@
 #include "SpellMgr.h"
 #include "Timer.h"
 #include <cmath>
+#include <set>
 
 template <>
 struct std::hash<AreaTriggerId>
@@ -41,7 +42,7 @@ struct std::hash<AreaTriggerId>
 
 namespace
 {
-    typedef std::unordered_map<uint32/*cell_id*/, std::set<ObjectGuid::LowType>> AtCellObjectGuidsMap;
+    typedef std::unordered_map<uint32/*cell_id*/, std::vector<ObjectGuid::LowType>> AtCellObjectGuidsMap;
     typedef std::unordered_map<std::pair<uint32 /*mapId*/, Difficulty>, AtCellObjectGuidsMap> AtMapObjectGuids;
 
     AtMapObjectGuids _areaTriggerSpawnsByLocation;
@@ -412,7 +413,7 @@ void AreaTriggerDataStore::LoadAreaTriggerSpawns()
             // Add the trigger to a map::cell map, which is later used by GridLoader to query
             CellCoord cellCoord = Trinity::ComputeCellCoord(spawn.spawnPoint.GetPositionX(), spawn.spawnPoint.GetPositionY());
             for (Difficulty difficulty : difficulties)
-                _areaTriggerSpawnsByLocation[{ spawn.mapId, difficulty }][cellCoord.GetId()].insert(spawnId);
+                _areaTriggerSpawnsByLocation[{ spawn.mapId, difficulty }][cellCoord.GetId()].push_back(spawnId);
         } while (templates->NextRow());
     }
 
@@ -429,7 +430,7 @@ AreaTriggerCreateProperties const* AreaTriggerDataStore::GetAreaTriggerCreatePro
     return Trinity::Containers::MapGetValuePtr(_areaTriggerCreateProperties, areaTriggerCreatePropertiesId);
 }
 
-std::set<ObjectGuid::LowType> const* AreaTriggerDataStore::GetAreaTriggersForMapAndCell(uint32 mapId, Difficulty difficulty, uint32 cellId) const
+std::vector<ObjectGuid::LowType> const* AreaTriggerDataStore::GetAreaTriggersForMapAndCell(uint32 mapId, Difficulty difficulty, uint32 cellId) const
 {
     if (auto* atForMapAndDifficulty = Trinity::Containers::MapGetValuePtr(_areaTriggerSpawnsByLocation, { mapId, difficulty }))
         return Trinity::Containers::MapGetValuePtr(*atForMapAndDifficulty, cellId);
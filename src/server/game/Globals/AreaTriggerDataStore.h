@@ -20,7 +20,7 @@
 
 #include "Define.h"
 #include "ObjectGuid.h"
-#include <set>
+#include <vector>
 
 class AreaTriggerTemplate;
 class AreaTriggerCreateProperties;
@@ -36,7 +36,7 @@ public:
     void LoadAreaTriggerTemplates();
     void LoadAreaTriggerSpawns();
 
-    std::set<ObjectGuid::LowType> const* GetAreaTriggersForMapAndCell(uint32 mapId, Difficulty difficulty, uint32 cellId) const;
+    std::vector<ObjectGuid::LowType> const* GetAreaTriggersForMapAndCell(uint32 mapId, Difficulty difficulty, uint32 cellId) const;
     AreaTriggerSpawn const* GetAreaTriggerSpawn(ObjectGuid::LowType spawnId) const;
     AreaTriggerTemplate const* GetAreaTriggerTemplate(AreaTriggerId const& areaTriggerId) const;
     AreaTriggerCreateProperties const* GetAreaTriggerCreateProperties(AreaTriggerCreatePropertiesId const& areaTriggerCreatePropertiesId) const;
@@ -27,6 +27,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "Transport.h"
+#include <array>
 #include <mutex>
 
 template<class T>
@@ -36,25 +37,32 @@ void HashMapHolder<T>::Insert(T* o)
         "Only Player can be registered in global HashMapHolder");
 
     std::unique_lock<std::shared_mutex> lock(*GetLock());
-
     GetContainer()[o->GetGUID()] = o;
+
+    Shard& shard = GetShard(o->GetGUID());
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    shard.Objects[o->GetGUID()] = o;
 }
 
 template<class T>
 void HashMapHolder<T>::Remove(T* o)
 {
     std::unique_lock<std::shared_mutex> lock(*GetLock());
-
     GetContainer().erase(o->GetGUID());
+
+    Shard& shard = GetShard(o->GetGUID());
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    shard.Objects.erase(o->GetGUID());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
+    Shard& shard = GetShard(guid);
+    std::shared_lock<std::shared_mutex> lock(shard.Lock);
 
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    typename MapType::iterator itr = shard.Objects.find(guid);
+    return (itr != shard.Objects.end()) ? itr->second : nullptr;
 }
 
 template<class T>
@@ -71,20 +79,30 @@ std::shared_mutex* HashMapHolder<T>::GetLock()
     return &_lock;
 }
 
+template<class T>
+auto HashMapHolder<T>::GetShard(ObjectGuid const& guid) -> Shard&
+{
+    static std::array<Shard, ShardCount> _shards;
+    return _shards[std::hash<ObjectGuid>()(guid) % ShardCount];
+}
+
 template class TC_GAME_API HashMapHolder<Player>;
 
 namespace PlayerNameMapHolder
 {
     typedef std::unordered_map<std::string, Player*> MapType;
     static MapType PlayerNameMap;
+    static std::shared_mutex PlayerNameMapLock;
 
     void Insert(Player* p)
     {
+        std::unique_lock<std::shared_mutex> lock(PlayerNameMapLock);
         PlayerNameMap[p->GetName()] = p;
     }
 
     void Remove(Player* p)
     {
+        std::unique_lock<std::shared_mutex> lock(PlayerNameMapLock);
         PlayerNameMap.erase(p->GetName());
     }
 
@@ -94,6 +112,7 @@ namespace PlayerNameMapHolder
         if (!normalizePlayerName(charName))
             return nullptr;
 
+        std::shared_lock<std::shared_mutex> lock(PlayerNameMapLock);
         auto itr = PlayerNameMap.find(charName);
         return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
     }
@@ -45,7 +45,10 @@ class TC_GAME_API HashMapHolder
 
 public:
 
-    typedef std::unordered_map<ObjectGuid, T*> MapType;
+    typedef Trinity::Containers::FlatHashMap<ObjectGuid, T*> MapType;
+
+    // Find only locks the shard owning the guid so lookups from different threads rarely contend
+    static constexpr std::size_t ShardCount = 16;
 
     static void Insert(T* o);
 
@@ -55,7 +58,17 @@ public:
 
     static MapType& GetContainer();
 
+    // guards GetContainer(), only needed to iterate all objects
     static std::shared_mutex* GetLock();
+
+private:
+    struct alignas(64) Shard
+    {
+        std::shared_mutex Lock;
+        MapType Objects;
+    };
+
+    static Shard& GetShard(ObjectGuid const& guid);
 };
 
 namespace ObjectAccessor
@@ -270,7 +270,7 @@ void ObjectMgr::LoadCreatureLocales()
         std::string_view localeName = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         CreatureLocale& data = _creatureLocaleStore[id];
@@ -305,7 +305,7 @@ void ObjectMgr::LoadGossipMenuItemsLocales()
         std::string_view localeName = fields[2].GetStringView();
 
         LocaleConstant locale   = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         GossipMenuItemsLocale& data = _gossipMenuItemsLocaleStore[std::make_pair(menuId, optionId)];
@@ -335,7 +335,7 @@ void ObjectMgr::LoadPointOfInterestLocales()
         std::string_view localeName = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         PointOfInterestLocale& data = _pointOfInterestLocaleStore[id];
@@ -2121,8 +2121,8 @@ void ObjectMgr::LoadCreatures()
 {
     uint32 oldMSTime = getMSTime();
 
-    //                                               0              1   2    3           4           5           6            7        8             9              10
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id, map, position_x, position_y, position_z, orientation, modelid, equipment_id, spawntimesecs, wander_distance, "
+    //                                                       0              1   2    3           4           5           6            7        8             9              10
+    QueryResult result = WorldDatabase.QueryStreamed("SELECT creature.guid, id, map, position_x, position_y, position_z, orientation, modelid, equipment_id, spawntimesecs, wander_distance, "
     //   11               12            13            14                 15          16           17                18                   19                    20
         "currentwaypoint, curHealthPct, MovementType, spawnDifficulties, eventEntry, poolSpawnId, creature.npcflag, creature.unit_flags, creature.unit_flags2, creature.unit_flags3, "
     //   21                      22                23                   24                       25                   26
@@ -2144,8 +2144,6 @@ void ObjectMgr::LoadCreatures()
 
     PhaseShift phaseShift;
 
-    _creatureDataStore.reserve(result->GetRowCount());
-
     do
     {
         Field* fields = result->Fetch();
@@ -2413,6 +2411,49 @@ CellObjectGuidsMap const* ObjectMgr::GetMapObjectGuids(uint32 mapid, Difficulty
     return Trinity::Containers::MapGetValuePtr(_mapObjectGuidsStore, { mapid, spawnMode });
 }
 
+CellSpawnTemplatePtr ObjectMgr::GetCellSpawnTemplate(uint32 mapid, Difficulty spawnMode, uint32 cell_id)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(_cellSpawnTemplateLock);
+        if (auto const* cells = Trinity::Containers::MapGetValuePtr(_cellSpawnTemplateStore, { mapid, spawnMode }))
+            if (auto itr = cells->find(cell_id); itr != cells->end())
+                return itr->second;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(_cellSpawnTemplateLock);
+    auto [itr, inserted] = _cellSpawnTemplateStore[{ mapid, spawnMode }].try_emplace(cell_id);
+    if (!inserted)
+        return itr->second;
+
+    // cells without spawns keep an empty entry so they are not looked up again
+    CellObjectGuids const* cellGuids = GetCellObjectGuids(mapid, spawnMode, cell_id);
+    if (!cellGuids)
+        return nullptr;
+
+    std::shared_ptr<CellSpawnTemplate> cellTemplate = std::make_shared<CellSpawnTemplate>();
+    cellTemplate->creatures.reserve(cellGuids->creatures.size());
+    for (ObjectGuid::LowType spawnId : cellGuids->creatures)
+        if (CreatureData const* data = GetCreatureData(spawnId))
+            cellTemplate->creatures.push_back(data);
+
+    cellTemplate->gameobjects.reserve(cellGuids->gameobjects.size());
+    for (ObjectGuid::LowType spawnId : cellGuids->gameobjects)
+        if (GameObjectData const* data = GetGameObjectData(spawnId))
+            cellTemplate->gameobjects.push_back(data);
+
+    itr->second = std::move(cellTemplate);
+    return itr->second;
+}
+
+void ObjectMgr::InvalidateCellSpawnTemplates(SpawnData const* data, uint32 cellId)
+{
+    // maps still loading from the old template keep it alive until they finish
+    std::unique_lock<std::shared_mutex> lock(_cellSpawnTemplateLock);
+    for (Difficulty difficulty : data->spawnDifficulties)
+        if (auto* cells = Trinity::Containers::MapGetValuePtr(_cellSpawnTemplateStore, { data->mapId, difficulty }))
+            cells->erase(cellId);
+}
+
 bool ObjectMgr::HasPersonalSpawns(uint32 mapid, Difficulty spawnMode, uint32 phaseId) const
 {
     return Trinity::Containers::MapGetValuePtr(_mapPersonalObjectGuidsStore, { mapid, spawnMode, phaseId }) != nullptr;
@@ -2426,6 +2467,24 @@ CellObjectGuids const* ObjectMgr::GetCellPersonalObjectGuids(uint32 mapid, Diffi
     return nullptr;
 }
 
+namespace
+{
+// spawns are loaded ordered by guid, inserting at load appends to the end
+void InsertCellGuid(CellGuidSet& cellGuids, ObjectGuid::LowType spawnId)
+{
+    auto itr = std::ranges::lower_bound(cellGuids, spawnId);
+    if (itr == cellGuids.end() || *itr != spawnId)
+        cellGuids.insert(itr, spawnId);
+}
+
+void EraseCellGuid(CellGuidSet& cellGuids, ObjectGuid::LowType spawnId)
+{
+    auto itr = std::ranges::lower_bound(cellGuids, spawnId);
+    if (itr != cellGuids.end() && *itr == spawnId)
+        cellGuids.erase(itr);
+}
+}
+
 template<CellGuidSet CellObjectGuids::*guids>
 void ObjectMgr::AddSpawnDataToGrid(SpawnData const* data)
 {
@@ -2434,12 +2493,14 @@ void ObjectMgr::AddSpawnDataToGrid(SpawnData const* data)
     if (!isPersonalPhase)
     {
         for (Difficulty difficulty : data->spawnDifficulties)
-            (_mapObjectGuidsStore[{ data->mapId, difficulty }][cellId].*guids).insert(data->spawnId);
+            InsertCellGuid(_mapObjectGuidsStore[{ data->mapId, difficulty }][cellId].*guids, data->spawnId);
+
+        InvalidateCellSpawnTemplates(data, cellId);
     }
     else
     {
         for (Difficulty difficulty : data->spawnDifficulties)
-            (_mapPersonalObjectGuidsStore[{ data->mapId, difficulty, data->phaseId }][cellId].*guids).insert(data->spawnId);
+            InsertCellGuid(_mapPersonalObjectGuidsStore[{ data->mapId, difficulty, data->phaseId }][cellId].*guids, data->spawnId);
     }
 }
 
@@ -2451,12 +2512,14 @@ void ObjectMgr::RemoveSpawnDataFromGrid(SpawnData const* data)
     if (!isPersonalPhase)
     {
         for (Difficulty difficulty : data->spawnDifficulties)
-            (_mapObjectGuidsStore[{ data->mapId, difficulty }][cellId].*guids).erase(data->spawnId);
+            EraseCellGuid(_mapObjectGuidsStore[{ data->mapId, difficulty }][cellId].*guids, data->spawnId);
+
+        InvalidateCellSpawnTemplates(data, cellId);
     }
     else
     {
         for (Difficulty difficulty : data->spawnDifficulties)
-            (_mapPersonalObjectGuidsStore[{ data->mapId, difficulty, data->phaseId }][cellId].*guids).erase(data->spawnId);
+            EraseCellGuid(_mapPersonalObjectGuidsStore[{ data->mapId, difficulty, data->phaseId }][cellId].*guids, data->spawnId);
     }
 }
 
@@ -2474,8 +2537,8 @@ void ObjectMgr::LoadGameObjects()
 {
     uint32 oldMSTime = getMSTime();
 
-    //                                                0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+    //                                                        0                1   2    3           4           5           6
+    QueryResult result = WorldDatabase.QueryStreamed("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
     //   7          8          9          10         11             12            13     14                 15          16
         "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnDifficulties, eventEntry, poolSpawnId, "
     //   17             18       19          20              21          22
@@ -2496,8 +2559,6 @@ void ObjectMgr::LoadGameObjects()
 
     PhaseShift phaseShift;
 
-    _gameObjectDataStore.reserve(result->GetRowCount());
-
     do
     {
         Field* fields = result->Fetch();
@@ -5419,7 +5480,7 @@ void ObjectMgr::LoadQuestTemplateLocale()
         std::string_view localeName     = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         QuestTemplateLocale& data = _questTemplateLocaleStore[id];
@@ -5455,7 +5516,7 @@ void ObjectMgr::LoadQuestObjectivesLocale()
         std::string_view localeName         = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         QuestObjectivesLocale& data = _questObjectivesLocaleStore[id];
@@ -5508,7 +5569,7 @@ void ObjectMgr::LoadQuestGreetingLocales()
         std::string_view localeName = fields[2].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         QuestGreetingLocale& data = _questGreetingLocaleStore[type][id];
@@ -5538,7 +5599,7 @@ void ObjectMgr::LoadQuestOfferRewardLocale()
         std::string_view localeName = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         QuestOfferRewardLocale& data = _questOfferRewardLocaleStore[id];
@@ -5566,7 +5627,7 @@ void ObjectMgr::LoadQuestRequestItemsLocale()
         std::string_view localeName = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         QuestRequestItemsLocale& data = _questRequestItemsLocaleStore[id];
@@ -6203,7 +6264,7 @@ void ObjectMgr::LoadPageTexts()
     TC_LOG_INFO("server.loading", ">> Loaded {} page texts in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
-PageText const* ObjectMgr::GetPageText(uint32 pageEntry)
+PageText const* ObjectMgr::GetPageText(uint32 pageEntry) const
 {
     PageTextContainer::const_iterator itr = _pageTextStore.find(pageEntry);
     if (itr != _pageTextStore.end())
@@ -6212,6 +6273,39 @@ PageText const* ObjectMgr::GetPageText(uint32 pageEntry)
     return nullptr;
 }
 
+WorldPacket ObjectMgr::BuildPageTextQueryData(uint32 pageEntry, LocaleConstant locale) const
+{
+    WorldPackets::Query::QueryPageTextResponse response;
+    response.PageTextID = pageEntry;
+
+    uint32 pageID = pageEntry;
+    while (pageID)
+    {
+        PageText const* pageText = GetPageText(pageID);
+        if (!pageText)
+            break;
+
+        WorldPackets::Query::QueryPageTextResponse::PageTextInfo& page = response.Pages.emplace_back();
+        page.ID = pageID;
+        page.NextPageID = pageText->NextPageID;
+        page.Text = pageText->Text;
+        page.PlayerConditionID = pageText->PlayerConditionID;
+        page.Flags = pageText->Flags;
+
+        if (locale != LOCALE_enUS)
+            if (PageTextLocale const* pageTextLocale = GetPageTextLocale(pageID))
+                GetLocaleString(pageTextLocale->Text, locale, page.Text);
+
+        pageID = pageText->NextPageID;
+    }
+
+    response.Allow = !response.Pages.empty();
+
+    response.Write();
+    response.ShrinkToFit();
+    return response.Move();
+}
+
 void ObjectMgr::LoadPageTextLocales()
 {
     uint32 oldMSTime = getMSTime();
@@ -6231,7 +6325,7 @@ void ObjectMgr::LoadPageTextLocales()
         std::string_view localeName = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         PageTextLocale& data = _pageTextLocaleStore[id];
@@ -7541,7 +7635,7 @@ void ObjectMgr::LoadGameObjectLocales()
         std::string_view localeName = fields[1].GetStringView();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         GameObjectLocale& data = _gameObjectLocaleStore[id];
@@ -9461,7 +9555,7 @@ void ObjectMgr::LoadTrainers()
             std::string localeName = fields[1].GetString();
 
             LocaleConstant locale = GetLocaleByName(localeName);
-            if (!IsValidLocale(locale) || !sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) || locale == LOCALE_enUS)
+            if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
                 continue;
 
             if (Trainer::Trainer* trainer = Trinity::Containers::MapGetValuePtr(_trainers, trainerId))
@@ -11062,6 +11156,20 @@ void ObjectMgr::InitializeQueriesData(QueryDataGroup mask)
         for (auto& poiWrapperPair : _questPOIStore)
             pool.PostWork([poi = &poiWrapperPair.second]() { poi->InitializeQueryData(); });
 
+    // Initialize Query Data for page texts
+    if (mask & QUERY_DATA_PAGE_TEXTS)
+    {
+        for (auto& [pageEntry, pageText] : _pageTextStore)
+        {
+            pool.PostWork([this, pageEntry, pageText = &pageText]()
+            {
+                for (uint8 loc = LOCALE_enUS; loc < TOTAL_LOCALES; ++loc)
+                    if (sWorld->IsLocaleLoaded(LocaleConstant(loc)))
+                        pageText->QueryData[loc] = BuildPageTextQueryData(pageEntry, LocaleConstant(loc));
+            });
+        }
+    }
+
     pool.Join();
 
     TC_LOG_INFO("server.loading", ">> Initialized query cache data in {} ms", GetMSTimeDiffToNow(oldMSTime));
@@ -11505,7 +11613,7 @@ void ObjectMgr::LoadPlayerChoicesLocale()
             }
 
             LocaleConstant locale = GetLocaleByName(localeName);
-            if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+            if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
                 continue;
 
             PlayerChoiceLocale& data = _playerChoiceLocales[choiceId];
@@ -11546,7 +11654,7 @@ void ObjectMgr::LoadPlayerChoicesLocale()
             }
 
             LocaleConstant locale = GetLocaleByName(localeName);
-            if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+            if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
                 continue;
 
             PlayerChoiceResponseLocale& data = itr->second.Responses[responseId];
@@ -25,6 +25,7 @@
 #include "GameObjectData.h"
 #include "ItemTemplate.h"
 #include "IteratorPair.h"
+#include "MemoryAccounting.h"
 #include "MovementDefines.h"
 #include "NPCHandler.h"
 #include "ObjectDefines.h"
@@ -42,7 +43,10 @@
 #include <atomic>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 class Item;
 class Unit;
@@ -65,6 +69,8 @@ struct PageText
     uint32 NextPageID;
     int32 PlayerConditionID;
     uint8 Flags;
+
+    WorldPacket QueryData[TOTAL_LOCALES];   // response for queries starting at this page, including all following pages
 };
 
 enum SummonerType
@@ -476,7 +482,8 @@ struct AccessRequirement
     std::string questFailedText;
 };
 
-typedef std::set<ObjectGuid::LowType> CellGuidSet;
+// sorted by spawn id, contiguous so loading a grid walks the spawns of each cell linearly
+typedef std::vector<ObjectGuid::LowType> CellGuidSet;
 struct CellObjectGuids
 {
     CellGuidSet creatures;
@@ -486,16 +493,30 @@ typedef std::unordered_map<uint32/*cell_id*/, CellObjectGuids> CellObjectGuidsMa
 typedef std::unordered_map<std::pair<uint32 /*mapId*/, Difficulty>, CellObjectGuidsMap> MapObjectGuids;
 typedef std::map<std::tuple<uint32/*mapId*/, Difficulty, uint32 /*phaseId*/>, CellObjectGuidsMap> MapPersonalObjectGuids;
 
+// spawn data of one cell resolved once and shared by every instance of the map loading it
+// never modified after creation, changing the spawns of a cell replaces the whole template
+struct CellSpawnTemplate
+{
+    std::vector<CreatureData const*> creatures;
+    std::vector<GameObjectData const*> gameobjects;
+};
+typedef std::shared_ptr<CellSpawnTemplate const> CellSpawnTemplatePtr;
+typedef std::unordered_map<std::pair<uint32 /*mapId*/, Difficulty>, std::unordered_map<uint32 /*cell_id*/, CellSpawnTemplatePtr>> MapCellSpawnTemplates;
+
 struct TrinityString
 {
     std::vector<std::string> Content;
 };
 
+// the largest stores, counted towards MemoryDomain::ObjectMgr
+template <typename Key, typename Value>
+using ObjectMgrStore = std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>, Trinity::AccountedAllocator<std::pair<Key const, Value>, Trinity::MemoryDomain::ObjectMgr>>;
+
 typedef std::map<ObjectGuid, ObjectGuid> LinkedRespawnContainer;
-typedef std::unordered_map<uint32, CreatureTemplate> CreatureTemplateContainer;
+typedef ObjectMgrStore<uint32, CreatureTemplate> CreatureTemplateContainer;
 typedef std::unordered_map<uint32, CreatureAddon> CreatureTemplateAddonContainer;
 typedef std::unordered_map<uint32, std::vector<float>> CreatureTemplateSparringContainer;
-typedef std::unordered_map<ObjectGuid::LowType, CreatureData> CreatureDataContainer;
+typedef ObjectMgrStore<ObjectGuid::LowType, CreatureData> CreatureDataContainer;
 typedef std::unordered_map<ObjectGuid::LowType, CreatureAddon> CreatureAddonContainer;
 typedef std::unordered_map<uint16, CreatureBaseStats> CreatureBaseStatsContainer;
 typedef std::unordered_map<uint8, EquipmentInfo> EquipmentInfoContainerInternal;
@@ -505,10 +526,10 @@ typedef std::unordered_map<std::pair<uint32, Difficulty>, std::vector<uint32>> C
 typedef std::unordered_map<uint32, std::vector<int32>> CreatureQuestCurrenciesMap;
 typedef std::unordered_map<std::pair<ObjectGuid::LowType, Difficulty>, CreatureStaticFlagsOverride> CreatureStaticFlagsOverrideMap;
 typedef std::unordered_map<uint32, DestructibleHitpoint> DestructibleHitpointContainer;
-typedef std::unordered_map<uint32, GameObjectTemplate> GameObjectTemplateContainer;
+typedef ObjectMgrStore<uint32, GameObjectTemplate> GameObjectTemplateContainer;
 typedef std::unordered_map<uint32, GameObjectTemplateAddon> GameObjectTemplateAddonContainer;
 typedef std::unordered_map<ObjectGuid::LowType, GameObjectOverride> GameObjectOverrideContainer;
-typedef std::unordered_map<ObjectGuid::LowType, GameObjectData> GameObjectDataContainer;
+typedef ObjectMgrStore<ObjectGuid::LowType, GameObjectData> GameObjectDataContainer;
 typedef std::unordered_map<ObjectGuid::LowType, GameObjectAddon> GameObjectAddonContainer;
 typedef std::unordered_map<uint32, std::vector<uint32>> GameObjectQuestItemMap;
 typedef std::unordered_map<uint32, SpawnGroupTemplateData> SpawnGroupDataContainer;
@@ -959,6 +980,7 @@ enum QueryDataGroup
     QUERY_DATA_ITEMS = 0x04,
     QUERY_DATA_QUESTS = 0x08,
     QUERY_DATA_POIS = 0x10,
+    QUERY_DATA_PAGE_TEXTS = 0x20,
 
     QUERY_DATA_ALL = 0xFF
 };
@@ -1286,7 +1308,8 @@ class TC_GAME_API ObjectMgr
         void LoadGameObjectForQuests();
 
         void LoadPageTexts();
-        PageText const* GetPageText(uint32 pageEntry);
+        PageText const* GetPageText(uint32 pageEntry) const;
+        WorldPacket BuildPageTextQueryData(uint32 pageEntry, LocaleConstant locale) const;
 
         void LoadPlayerInfo();
         void LoadPetLevelInfo();
@@ -1399,6 +1422,9 @@ class TC_GAME_API ObjectMgr
 
         CellObjectGuidsMap const* GetMapObjectGuids(uint32 mapid, Difficulty spawnMode);
 
+        // built on first use, safe to call from map threads
+        CellSpawnTemplatePtr GetCellSpawnTemplate(uint32 mapid, Difficulty spawnMode, uint32 cell_id);
+
         bool HasPersonalSpawns(uint32 mapid, Difficulty spawnMode, uint32 phaseId) const;
         CellObjectGuids const* GetCellPersonalObjectGuids(uint32 mapid, Difficulty spawnMode, uint32 phaseId, uint32 cell_id) const;
 
@@ -1795,6 +1821,8 @@ class TC_GAME_API ObjectMgr
         template<CellGuidSet CellObjectGuids::*guids>
         void RemoveSpawnDataFromGrid(SpawnData const* data);
 
+        void InvalidateCellSpawnTemplates(SpawnData const* data, uint32 cellId);
+
         MailLevelRewardContainer _mailLevelRewardStore;
 
         CreatureBaseStatsContainer _creatureBaseStatsStore;
@@ -1822,6 +1850,8 @@ class TC_GAME_API ObjectMgr
 
         MapObjectGuids _mapObjectGuidsStore;
         MapPersonalObjectGuids _mapPersonalObjectGuidsStore;
+        MapCellSpawnTemplates _cellSpawnTemplateStore;
+        std::shared_mutex _cellSpawnTemplateLock;
         CreatureDataContainer _creatureDataStore;
         CreatureTemplateContainer _creatureTemplateStore;
         CreatureModelContainer _creatureModelStore;
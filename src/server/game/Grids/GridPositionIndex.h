@@ -0,0 +1,104 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GRIDPOSITIONINDEX_H
+#define _GRIDPOSITIONINDEX_H
+
+#include "Define.h"
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+template<class OBJECT>
+class GridReference;
+
+/*
+  Contiguous copy of the 2d positions of all objects linked to a GridRefManager
+  Range searches scan the position arrays in blocks of 64 without branching
+  (vectorizable) and only dereference objects that passed the distance filter
+  Positions are refreshed by GridObject::UpdateGridPosition after map relocations
+*/
+template<class OBJECT>
+class GridPositionIndex
+{
+    public:
+        void Insert(GridReference<OBJECT>* ref, float x, float y)
+        {
+            ref->_positionIndexSlot = uint32(_refs.size());
+            _refs.push_back(ref);
+            _x.push_back(x);
+            _y.push_back(y);
+        }
+
+        // the last element takes the place of the removed one
+        void Remove(GridReference<OBJECT>* ref)
+        {
+            uint32 slot = ref->_positionIndexSlot;
+            GridReference<OBJECT>* last = _refs.back();
+            _refs[slot] = last;
+            _x[slot] = _x.back();
+            _y[slot] = _y.back();
+            last->_positionIndexSlot = slot;
+            _refs.pop_back();
+            _x.pop_back();
+            _y.pop_back();
+        }
+
+        void Relocate(GridReference<OBJECT> const* ref, float x, float y)
+        {
+            _x[ref->_positionIndexSlot] = x;
+            _y[ref->_positionIndexSlot] = y;
+        }
+
+        // calls worker(OBJECT*) for every object within radius (2d) of x, y until it returns false
+        // returns false if the search was stopped by worker
+        // worker must not add or remove objects from this container
+        template<class Worker>
+        bool VisitInRange(float x, float y, float radius, Worker&& worker) const
+        {
+            float const radiusSq = radius * radius;
+            std::size_t const size = _refs.size();
+            for (std::size_t blockBegin = 0; blockBegin < size; blockBegin += 64)
+            {
+                std::size_t const blockEnd = std::min(size, blockBegin + 64);
+                uint64 inRange = 0;
+                for (std::size_t i = blockBegin; i < blockEnd; ++i)
+                {
+                    float dx = _x[i] - x;
+                    float dy = _y[i] - y;
+                    inRange |= uint64(dx * dx + dy * dy <= radiusSq) << (i - blockBegin);
+                }
+
+                while (inRange)
+                {
+                    std::size_t i = blockBegin + std::countr_zero(inRange);
+                    inRange &= inRange - 1;
+                    if (!worker(_refs[i]->GetSource()))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+    private:
+        std::vector<GridReference<OBJECT>*> _refs;
+        std::vector<float> _x;
+        std::vector<float> _y;
+};
+
+#endif
@@ -18,6 +18,7 @@
 #ifndef _GRIDREFMANAGER
 #define _GRIDREFMANAGER
 
+#include "GridPositionIndex.h"
 #include "RefManager.h"
 
 template<class OBJECT>
@@ -26,6 +27,12 @@ class GridReference;
 template<class OBJECT>
 class GridRefManager : public RefManager<GridReference<OBJECT>>
 {
+public:
+    GridPositionIndex<OBJECT>& GetPositionIndex() { return _positionIndex; }
+    GridPositionIndex<OBJECT> const& GetPositionIndex() const { return _positionIndex; }
+
+private:
+    GridPositionIndex<OBJECT> _positionIndex;
 };
 
 template <typename ObjectType>
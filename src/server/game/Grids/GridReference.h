@@ -18,11 +18,15 @@
 #ifndef _GRIDREFERENCE_H
 #define _GRIDREFERENCE_H
 
+#include "Define.h"
 #include "LinkedReference/Reference.h"
 
 template<class OBJECT>
 class GridRefManager;
 
+template<class OBJECT>
+class GridPositionIndex;
+
 template<class OBJECT>
 class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT, GridReference<OBJECT>>
 {
@@ -48,5 +52,9 @@ class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT, GridRefer
     public:
         GridReference() = default;
         ~GridReference() { this->unlink(); }
+
+    private:
+        friend GridPositionIndex<OBJECT>;
+        uint32 _positionIndexSlot = 0;
 };
 #endif
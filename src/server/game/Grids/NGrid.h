@@ -24,6 +24,7 @@
 #include "Grid.h"
 #include "GridRefManager.h"
 #include "GridReference.h"
+#include "MemoryAccounting.h"
 #include "Timer.h"
 
 #define DEFAULT_VISIBILITY_NOTIFY_PERIOD      1000
@@ -66,7 +67,7 @@ uint32 N,
 class WORLD_OBJECT_CONTAINER,
 class GRID_OBJECT_CONTAINER
 >
-class NGrid
+class NGrid : public Trinity::AccountedObject<Trinity::MemoryDomain::Grids>
 {
     public:
         typedef Grid<WORLD_OBJECT_CONTAINER, GRID_OBJECT_CONTAINER> GridType;
@@ -22,26 +22,38 @@
 #include "ObjectAccessor.h"
 #include "Transport.h"
 #include "UpdateData.h"
+#include "World.h"
 #include "WorldPacket.h"
+#include <algorithm>
+#include <iterator>
 
 using namespace Trinity;
 
-VisibleNotifier::VisibleNotifier(Player& player): i_player(player), i_data(player.GetMapId()), vis_guids(player.m_clientGUIDs)
+VisibleNotifier::VisibleNotifier(Player& player, bool keepNotVisited /*= false*/): i_player(player), i_data(player.GetMapId()),
+    i_clientGuids(player.m_clientGUIDs.begin(), player.m_clientGUIDs.end()), i_keepNotVisited(keepNotVisited)
 {
+    i_visitedGuids.reserve(i_clientGuids.size());
 }
 
 VisibleNotifier::~VisibleNotifier() = default;
 
 void VisibleNotifier::SendToSelf()
 {
-    // at this moment i_clientGUIDs have guids that not iterate at grid level checks
-    // but exist one case when this possible and object not out of range: transports
+    // guids that were at client but not visited at grid level checks, both lists sorted so one merge finds them all
+    std::ranges::sort(i_clientGuids);
+    std::ranges::sort(i_visitedGuids);
+    GuidVector notVisitedGuids;
+    std::ranges::set_difference(i_clientGuids, i_visitedGuids, std::back_inserter(notVisitedGuids));
+
+    // not visited objects are out of range except in one case: transports
     if (Transport* transport = dynamic_cast<Transport*>(i_player.GetTransport()))
     {
         for (WorldObject* passenger : transport->GetPassengers())
         {
-            if (vis_guids.erase(passenger->GetGUID()) > 0)
+            auto notVisitedItr = std::ranges::lower_bound(notVisitedGuids, passenger->GetGUID());
+            if (notVisitedItr != notVisitedGuids.end() && *notVisitedItr == passenger->GetGUID())
             {
+                notVisitedGuids.erase(notVisitedItr);
                 switch (passenger->GetTypeId())
                 {
                     case TYPEID_GAMEOBJECT:
@@ -68,7 +80,10 @@ void VisibleNotifier::SendToSelf()
         }
     }
 
-    for (ObjectGuid const& outOfRangeGuid : vis_guids)
+    if (i_keepNotVisited)
+        notVisitedGuids.clear();
+
+    for (ObjectGuid const& outOfRangeGuid : notVisitedGuids)
     {
         i_player.m_clientGUIDs.erase(outOfRangeGuid);
         i_data.AddOutOfRangeGUID(outOfRangeGuid);
@@ -128,15 +143,20 @@ inline void CreatureUnitRelocationWorker(Creature* c, Unit* u)
     if (!u->IsAlive() || !c->IsAlive() || c == u || u->IsInFlight())
         return;
 
-    if (!c->HasUnitState(UNIT_STATE_SIGHTLESS))
-    {
-        if (c->IsAIEnabled() && c->CanSeeOrDetect(u, { .DistanceCheck = true }))
-            c->AI()->MoveInLineOfSight_Safe(u);
-        else
-            if (u->GetTypeId() == TYPEID_PLAYER && u->HasStealthAura() && c->IsAIEnabled()
-                && c->CanSeeOrDetect(u, { .DistanceCheck = true, .AlertCheck = true }))
-                c->AI()->TriggerAlert(u);
-    }
+    if (c->HasUnitState(UNIT_STATE_SIGHTLESS) || !c->IsAIEnabled())
+        return;
+
+    // relocation notifiers visit cells in visibility range, most units there are far outside of creature sight
+    // same 2d distance CanSeeOrDetect checks for creatures, tested before its phase, condition and detection lookups
+    float maxDist = c->m_SightDistance + c->GetCombatReach() + u->GetCombatReach();
+    if (c->GetExactDist2dSq(u) > maxDist * maxDist)
+        return;
+
+    if (c->CanSeeOrDetect(u, { .DistanceCheck = true }))
+        c->AI()->MoveInLineOfSight_Safe(u);
+    else if (u->GetTypeId() == TYPEID_PLAYER && u->HasStealthAura()
+        && c->CanSeeOrDetect(u, { .DistanceCheck = true, .AlertCheck = true }))
+        c->AI()->TriggerAlert(u);
 }
 
 void PlayerRelocationNotifier::Visit(PlayerMapType &m)
@@ -145,7 +165,7 @@ void PlayerRelocationNotifier::Visit(PlayerMapType &m)
     {
         Player* player = iter->GetSource();
 
-        vis_guids.erase(player->GetGUID());
+        i_visitedGuids.push_back(player->GetGUID());
 
         i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
 
@@ -164,7 +184,7 @@ void PlayerRelocationNotifier::Visit(CreatureMapType &m)
     {
         Creature* c = iter->GetSource();
 
-        vis_guids.erase(c->GetGUID());
+        i_visitedGuids.push_back(c->GetGUID());
 
         i_player.UpdateVisibilityOf(c, i_data, i_visibleNow);
 
@@ -232,8 +252,17 @@ void DelayedUnitRelocation::Visit(PlayerMapType &m)
         if (player != viewPoint && !viewPoint->IsPositionValid())
             continue;
 
-        PlayerRelocationNotifier relocate(*player);
-        Cell::VisitAllObjects(viewPoint, relocate, i_radius, false);
+        if (!i_budget.RemainingPlayers)
+        {
+            i_budget.DeferredViewPoints.insert(viewPoint);
+            continue;
+        }
+
+        --i_budget.RemainingPlayers;
+
+        Optional<float> searchRadius = i_map.GetVisibilityNotifySearchRadius(player);
+        PlayerRelocationNotifier relocate(*player, searchRadius.has_value());
+        Cell::VisitAllObjects(viewPoint, relocate, searchRadius.value_or(i_radius), false);
         relocate.SendToSelf();
     }
 }
@@ -279,12 +308,30 @@ MessageDistDeliverer::VisitObject(Player* player)
 }
 */
 
+ObjectUpdater::ObjectUpdater(const uint32 diff) : i_timeDiff(diff),
+    i_creatureUpdateLod(sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_REDUCED_INTERVAL) || sWorld->getIntConfig(CONFIG_CREATURE_UPDATE_LOD_DORMANT_INTERVAL))
+{
+}
+
 template<class T>
 void ObjectUpdater::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
-        if (iter->GetSource()->IsInWorld())
+    {
+        if (!iter->GetSource()->IsInWorld())
+            continue;
+
+        if constexpr (std::is_same_v<T, Creature>)
+        {
+            uint32 updateDiff;
+            if (i_creatureUpdateLod && !iter->GetSource()->PrepareLodUpdate(i_timeDiff, updateDiff))
+                continue;
+
+            iter->GetSource()->Update(i_creatureUpdateLod ? updateDiff : i_timeDiff);
+        }
+        else
             iter->GetSource()->Update(i_timeDiff);
+    }
 }
 
 bool AnyDeadUnitObjectInRangeCheck::operator()(Player* u)
@@ -50,9 +50,11 @@ namespace Trinity
         Player &i_player;
         UpdateData i_data;
         std::set<WorldObject*> i_visibleNow;
-        GuidUnorderedSet vis_guids;
+        GuidVector i_clientGuids;                           // at client when the pass started
+        GuidVector i_visitedGuids;                          // found by the grid visit, diffed against i_clientGuids in SendToSelf
+        bool i_keepNotVisited;                              // only part of the visibility distance is visited, objects outside of it stay visible
 
-        VisibleNotifier(Player &player);
+        VisibleNotifier(Player &player, bool keepNotVisited = false);
         ~VisibleNotifier();
         template<class T> void Visit(GridRefManager<T> &m);
         void SendToSelf(void);
@@ -76,7 +78,7 @@ namespace Trinity
 
     struct TC_GAME_API PlayerRelocationNotifier : public VisibleNotifier
     {
-        PlayerRelocationNotifier(Player &player) : VisibleNotifier(player) { }
+        PlayerRelocationNotifier(Player &player, bool keepNotVisited) : VisibleNotifier(player, keepNotVisited) { }
 
         template<class T> void Visit(GridRefManager<T> &m) { VisibleNotifier::Visit(m); }
         void Visit(CreatureMapType &);
@@ -92,14 +94,22 @@ namespace Trinity
         void Visit(PlayerMapType &);
     };
 
+    struct VisibilityNotifyBudget
+    {
+        uint32 RemainingPlayers = std::numeric_limits<uint32>::max();
+        // view points of players that keep their notify flags until a later update
+        std::unordered_set<WorldObject const*> DeferredViewPoints;
+    };
+
     struct TC_GAME_API DelayedUnitRelocation
     {
         Map &i_map;
         Cell &cell;
         CellCoord &p;
         const float i_radius;
-        DelayedUnitRelocation(Cell &c, CellCoord &pair, Map &map, float radius) :
-            i_map(map), cell(c), p(pair), i_radius(radius) { }
+        VisibilityNotifyBudget &i_budget;
+        DelayedUnitRelocation(Cell &c, CellCoord &pair, Map &map, float radius, VisibilityNotifyBudget &budget) :
+            i_map(map), cell(c), p(pair), i_radius(radius), i_budget(budget) { }
         template<class T> void Visit(GridRefManager<T> &) { }
         void Visit(CreatureMapType &);
         void Visit(PlayerMapType   &);
@@ -145,15 +155,25 @@ namespace Trinity
         void Visit(ConversationMapType &m) { updateObjects<Conversation>(m); }
     };
 
+    // Copies a broadcast packet once on first use, all recipient sockets then reference that copy
+    inline std::shared_ptr<WorldPacket const> const& GetSharedPacket(std::shared_ptr<WorldPacket const>& shared, WorldPacket const* packet)
+    {
+        if (!shared)
+            shared = std::make_shared<WorldPacket const>(*packet);
+
+        return shared;
+    }
+
     struct PacketSenderRef
     {
         WorldPacket const* Data;
+        mutable std::shared_ptr<WorldPacket const> SharedData;
 
         PacketSenderRef(WorldPacket const* message) : Data(message) { }
 
         void operator()(Player const* player) const
         {
-            player->SendDirectMessage(Data);
+            player->SendDirectMessage(GetSharedPacket(SharedData, Data));
         }
     };
 
@@ -161,10 +181,11 @@ namespace Trinity
     struct PacketSenderOwning
     {
         Packet Data;
+        mutable std::shared_ptr<WorldPacket const> SharedData;
 
         void operator()(Player const* player) const
         {
-            player->SendDirectMessage(Data.GetRawPacket());
+            player->SendDirectMessage(GetSharedPacket(SharedData, Data.GetRawPacket()));
         }
     };
 
@@ -194,6 +215,10 @@ namespace Trinity
         void Visit(DynamicObjectMapType &m) const;
         template<class SKIP> void Visit(GridRefManager<SKIP> &) const { }
 
+        // sends to receivers found by a grid search or, if enabled, by checking players that have the source at client
+        void Deliver(float dist) const;
+        void VisitClientViewers() const;
+
         void SendPacket(Player const* player) const
         {
             // never send packet to self
@@ -238,7 +263,8 @@ namespace Trinity
     struct ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff) { }
+        bool i_creatureUpdateLod;
+        explicit ObjectUpdater(const uint32 diff);
         template<class T> void Visit(GridRefManager<T> &m);
         void Visit(PlayerMapType &) { }
         void Visit(CorpseMapType &) { }
@@ -371,6 +397,22 @@ namespace Trinity
             }
         }
 
+        // same as Visit but only checks objects within radius (2d) of x, y found through the cell position index
+        template<class T>
+        void VisitInRange(GridRefManager<T>& m, float x, float y, float radius)
+        {
+            if constexpr (MapTypeMaskCheck::IsStatic)
+            {
+                if constexpr (MapTypeMaskCheck::Includes(GridMapTypeMaskForType<T>::value))
+                    VisitInRangeImpl(m, x, y, radius);
+            }
+            else
+            {
+                if (i_mapTypeMask.Includes(GridMapTypeMaskForType<T>::value))
+                    VisitInRangeImpl(m, x, y, radius);
+            }
+        }
+
     protected:
         template<typename Container>
         WorldObjectSearcherBase(PhaseShift const& phaseShift, Container& result, Check& check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
@@ -379,6 +421,31 @@ namespace Trinity
     private:
         template<class T>
         void VisitImpl(GridRefManager<T>&);
+
+        template<class T>
+        void VisitInRangeImpl(GridRefManager<T>&, float x, float y, float radius);
+
+        // returns false when the search is finished
+        template<class T>
+        bool VisitObject(T* object);
+    };
+
+    // Adapter for TypeContainerVisitor, restricts a searcher to objects within radius of x, y (instead of entire cells)
+    template<class Searcher>
+    struct WorldObjectInRangeSearcher
+    {
+        Searcher& i_searcher;
+        float i_x;
+        float i_y;
+        float i_radius;
+
+        WorldObjectInRangeSearcher(Searcher& searcher, float x, float y, float radius) : i_searcher(searcher), i_x(x), i_y(y), i_radius(radius) { }
+
+        template<class T>
+        void Visit(GridRefManager<T>& m)
+        {
+            i_searcher.VisitInRange(m, i_x, i_y, i_radius);
+        }
     };
 
     template<class Work, class MapTypeMaskCheck = DynamicGridMapTypeMaskCheck>
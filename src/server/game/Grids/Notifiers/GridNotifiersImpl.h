@@ -19,9 +19,12 @@
 #define TRINITY_GRIDNOTIFIERSIMPL_H
 
 #include "GridNotifiers.h"
+#include "CellImpl.h"
 #include "Corpse.h"
+#include "ObjectAccessor.h"
 #include "Player.h"
 #include "UpdateData.h"
+#include "World.h"
 #include "WorldSession.h"
 
 template<class T>
@@ -29,7 +32,7 @@ inline void Trinity::VisibleNotifier::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
-        vis_guids.erase(iter->GetSource()->GetGUID());
+        i_visitedGuids.push_back(iter->GetSource()->GetGUID());
         i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
     }
 }
@@ -105,6 +108,50 @@ void Trinity::MessageDistDeliverer<PacketSender>::Visit(DynamicObjectMapType& m)
     }
 }
 
+template<typename PacketSender>
+void Trinity::MessageDistDeliverer<PacketSender>::Deliver(float dist) const
+{
+    if (sWorld->getBoolConfig(CONFIG_VISIBILITY_BROADCAST_TO_CLIENT_VIEWERS))
+        VisitClientViewers();
+    else
+        Cell::VisitWorldObjects(i_source, *this, dist);
+}
+
+template<typename PacketSender>
+void Trinity::MessageDistDeliverer<PacketSender>::VisitClientViewers() const
+{
+    // every player that would be found by grid search must have the source at client (checked in SendPacket)
+    // distance and phase are checked for the object the player is seeing through, same as grid search would
+    GuidFlatSet& viewers = i_source->GetClientViewers();
+    for (auto itr = viewers.begin(); itr != viewers.end();)
+    {
+        Player* player = ObjectAccessor::GetPlayer(i_source->GetMap(), *itr);
+        if (!player || !player->HaveAtClient(i_source))
+        {
+            itr = viewers.erase(itr);
+            continue;
+        }
+
+        ++itr;
+
+        WorldObject const* viewPoint = player;
+        if (player->m_seer != player && !player->GetVehicle())
+        {
+            viewPoint = player->m_seer;
+            if (!viewPoint || (!viewPoint->IsUnit() && !viewPoint->IsDynObject()))
+                continue;
+        }
+
+        if (!viewPoint->InSamePhase(*i_phaseShift))
+            continue;
+
+        if ((!required3dDist ? viewPoint->GetExactDist2dSq(i_source) : viewPoint->GetExactDistSq(i_source)) > i_distSq)
+            continue;
+
+        SendPacket(player);
+    }
+}
+
 template<typename PacketSender>
 void Trinity::MessageDistDelivererToHostile<PacketSender>::Visit(PlayerMapType& m) const
 {
@@ -188,18 +235,36 @@ inline void Trinity::WorldObjectSearcherBase<Check, Result, MapTypeMaskCheck>::V
         return;
 
     for (GridReference<T> const& ref : m)
-    {
-        if (!ref.GetSource()->InSamePhase(*i_phaseShift))
-            continue;
+        if (!VisitObject(ref.GetSource()))
+            return;
+}
 
-        if (i_check(ref.GetSource()))
-        {
-            this->Insert(ref.GetSource());
+template <class Check, class Result, class MapTypeMaskCheck>
+template <class T>
+inline void Trinity::WorldObjectSearcherBase<Check, Result, MapTypeMaskCheck>::VisitInRangeImpl(GridRefManager<T>& m, float x, float y, float radius)
+{
+    if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
+        return;
 
-            if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
-                return;
-        }
+    m.GetPositionIndex().VisitInRange(x, y, radius, [this](T* object) { return VisitObject(object); });
+}
+
+template <class Check, class Result, class MapTypeMaskCheck>
+template <class T>
+inline bool Trinity::WorldObjectSearcherBase<Check, Result, MapTypeMaskCheck>::VisitObject(T* object)
+{
+    if (!object->InSamePhase(*i_phaseShift))
+        return true;
+
+    if (i_check(object))
+    {
+        this->Insert(object);
+
+        if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
+            return false;
     }
+
+    return true;
 }
 
 template<typename Localizer>
@@ -27,10 +27,13 @@
 #include "GameObject.h"
 #include "GameTime.h"
 #include "Log.h"
+#include "MapManager.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "PhasingHandler.h"
 #include "SceneObject.h"
+#include "ThreadPool.h"
+#include "World.h"
 
 void ObjectGridEvacuator::Visit(CreatureMapType &m)
 {
@@ -100,19 +103,31 @@ void AddObjectHelper(CellCoord &cell, GridRefManager<T> &m, uint32 &count, Map*
     ++count;
 }
 
-template <class T>
-void LoadHelper(CellGuidSet const& guid_set, CellCoord& cell, GridRefManager<T>& m, uint32& count, Map* map, uint32 phaseId = 0, Optional<ObjectGuid> phaseOwner = {})
+inline ObjectGuid::LowType GetSpawnId(ObjectGuid::LowType spawnId) { return spawnId; }
+inline ObjectGuid::LowType GetSpawnId(SpawnData const* data) { return data->spawnId; }
+
+// spawns are either spawn ids or spawn data already resolved by a CellSpawnTemplate
+template <class T, class SpawnContainer>
+void LoadHelper(SpawnContainer const& spawns, CellCoord& cell, GridRefManager<T>& m, uint32& count, Map* map, uint32 phaseId = 0, Optional<ObjectGuid> phaseOwner = {}, std::vector<T*>* preconstructed = nullptr)
 {
-    for (CellGuidSet::const_iterator i_guid = guid_set.begin(); i_guid != guid_set.end(); ++i_guid)
+    for (auto const& spawn : spawns)
     {
         // Don't spawn at all if there's a respawn timer
-        ObjectGuid::LowType guid = *i_guid;
+        ObjectGuid::LowType guid = GetSpawnId(spawn);
         if (!map->ShouldBeSpawnedOnGridLoad<T>(guid))
             continue;
 
-        T* obj = new T;
+        T* obj;
+        if (preconstructed && !preconstructed->empty())
+        {
+            obj = preconstructed->back();
+            preconstructed->pop_back();
+        }
+        else
+            obj = new T;
+
         //TC_LOG_INFO("misc", "DEBUG: LoadHelper from table: {} for (guid: {}) Loading", table, guid);
-        if (!obj->LoadFromDB(guid, map, false, phaseOwner.has_value() /*allowDuplicate*/))
+        if (!obj->LoadFromDB(spawn, map, false, phaseOwner.has_value() /*allowDuplicate*/))
         {
             delete obj;
             continue;
@@ -131,15 +146,15 @@ void LoadHelper(CellGuidSet const& guid_set, CellCoord& cell, GridRefManager<T>&
 void ObjectGridLoader::Visit(GameObjectMapType& m)
 {
     CellCoord cellCoord = i_cell.GetCellCoord();
-    if (CellObjectGuids const* cell_guids = sObjectMgr->GetCellObjectGuids(i_map->GetId(), i_map->GetDifficultyID(), cellCoord.GetId()))
-        LoadHelper(cell_guids->gameobjects, cellCoord, m, i_gameObjects, i_map);
+    if (CellSpawnTemplatePtr cellTemplate = sObjectMgr->GetCellSpawnTemplate(i_map->GetId(), i_map->GetDifficultyID(), cellCoord.GetId()))
+        LoadHelper(cellTemplate->gameobjects, cellCoord, m, i_gameObjects, i_map, 0, {}, &_preconstructedGameObjects);
 }
 
 void ObjectGridLoader::Visit(CreatureMapType &m)
 {
     CellCoord cellCoord = i_cell.GetCellCoord();
-    if (CellObjectGuids const* cell_guids = sObjectMgr->GetCellObjectGuids(i_map->GetId(), i_map->GetDifficultyID(), cellCoord.GetId()))
-        LoadHelper(cell_guids->creatures, cellCoord, m, i_creatures, i_map);
+    if (CellSpawnTemplatePtr cellTemplate = sObjectMgr->GetCellSpawnTemplate(i_map->GetId(), i_map->GetDifficultyID(), cellCoord.GetId()))
+        LoadHelper(cellTemplate->creatures, cellCoord, m, i_creatures, i_map, 0, {}, &_preconstructedCreatures);
 }
 
 void ObjectGridLoader::Visit(AreaTriggerMapType& m)
@@ -168,8 +183,56 @@ void ObjectWorldLoader::Visit(CorpseMapType& /*m*/)
     }
 }
 
+void ObjectGridLoader::PreconstructObjects()
+{
+    Trinity::ThreadPool* pool = sMapMgr->GetGridLoadPool();
+    if (!pool)
+        return;
+
+    // upper bound, spawns skipped because of respawn timers leave their objects unused
+    std::size_t creatureCount = 0;
+    std::size_t gameObjectCount = 0;
+    Cell cell = i_cell;
+    for (uint32 x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
+    {
+        cell.data.Part.cell_x = x;
+        for (uint32 y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
+        {
+            cell.data.Part.cell_y = y;
+            if (CellSpawnTemplatePtr cellTemplate = sObjectMgr->GetCellSpawnTemplate(i_map->GetId(), i_map->GetDifficultyID(), cell.GetCellCoord().GetId()))
+            {
+                creatureCount += cellTemplate->creatures.size();
+                gameObjectCount += cellTemplate->gameobjects.size();
+            }
+        }
+    }
+
+    std::size_t const objectCount = creatureCount + gameObjectCount;
+    if (objectCount < sWorld->getIntConfig(CONFIG_MAP_GRID_LOAD_MIN_OBJECTS))
+        return;
+
+    _preconstructedCreatures.resize(creatureCount);
+    _preconstructedGameObjects.resize(gameObjectCount);
+
+    // constructors only initialize the object itself, everything touching the map or spawn data runs in LoadFromDB on the map thread
+    std::size_t chunkCount = std::min<std::size_t>(objectCount, sWorld->getIntConfig(CONFIG_MAP_GRID_LOAD_THREADS) + 1);
+    pool->ParallelFor(chunkCount, chunkCount - 1, [this, objectCount, creatureCount, chunkCount](std::size_t chunk)
+    {
+        std::size_t end = objectCount * (chunk + 1) / chunkCount;
+        for (std::size_t i = objectCount * chunk / chunkCount; i < end; ++i)
+        {
+            if (i < creatureCount)
+                _preconstructedCreatures[i] = new Creature();
+            else
+                _preconstructedGameObjects[i - creatureCount] = new GameObject();
+        }
+    });
+}
+
 void ObjectGridLoader::LoadN(void)
 {
+    PreconstructObjects();
+
     i_gameObjects = 0; i_creatures = 0; i_corpses = 0;
     i_cell.data.Part.cell_y = 0;
     for (uint32 x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
@@ -193,6 +256,14 @@ void ObjectGridLoader::LoadN(void)
             }
         }
     }
+    for (Creature* creature : _preconstructedCreatures)
+        delete creature;
+    _preconstructedCreatures.clear();
+
+    for (GameObject* gameObject : _preconstructedGameObjects)
+        delete gameObject;
+    _preconstructedGameObjects.clear();
+
     TC_LOG_DEBUG("maps", "{} GameObjects, {} Creatures, {} AreaTrriggers, and {} Corpses/Bones loaded for grid {} on map {}",
         i_gameObjects, i_creatures, i_areaTriggers, i_corpses, i_grid.GetGridId(), i_map->GetId());
 }
@@ -240,6 +311,13 @@ void ObjectGridUnloader::Visit(GridRefManager<T> &m)
         //Example: Flame Leviathan Turret 33139 is summoned when a creature is deleted
         /// @todo Check if that script has the correct logic. Do we really need to summons something before deleting?
         obj->CleanupsBeforeDelete();
+        if (_reclaimList)
+        {
+            obj->RemoveFromGrid();
+            _reclaimList->push_back(obj);
+            continue;
+        }
+
         ///- object will get delinked from the manager when deleted
         delete obj;
     }
@@ -22,7 +22,10 @@
 #include "Define.h"
 #include "GridDefines.h"
 #include "ObjectGuid.h"
+#include <vector>
 
+class Creature;
+class GameObject;
 class MapObject;
 class ObjectGuid;
 class ObjectWorldLoader;
@@ -69,6 +72,13 @@ class TC_GAME_API ObjectGridLoader : public ObjectGridLoaderBase
         void Visit(ConversationMapType&) const { }
 
         void LoadN();
+
+    private:
+        // constructs the objects of all spawns in the grid on the grid load helper threads, taken by Visit instead of allocating one by one
+        void PreconstructObjects();
+
+        std::vector<Creature*> _preconstructedCreatures;
+        std::vector<GameObject*> _preconstructedGameObjects;
 };
 
 class TC_GAME_API PersonalPhaseGridLoader : public ObjectGridLoaderBase
@@ -121,7 +131,13 @@ class ObjectGridCleaner
 class ObjectGridUnloader
 {
     public:
+        // with a reclaim list objects are only removed from the grid and deleted later by the map
+        explicit ObjectGridUnloader(std::vector<WorldObject*>* reclaimList = nullptr) : _reclaimList(reclaimList) { }
+
         void Visit(CorpseMapType& /*m*/) { }    // corpses are deleted with Map
         template<class T> void Visit(GridRefManager<T> &m);
+
+    private:
+        std::vector<WorldObject*>* _reclaimList;
 };
 #endif
@@ -945,15 +945,22 @@ void Group::UpdatePlayerOutOfRange(Player const* player) const
     if (!player || !player->IsInWorld())
         return;
 
-    WorldPackets::Party::PartyMemberFullState packet;
-    packet.Initialize(player);
-    packet.Write();
-
+    // the full state is expensive to build (auras, pet, phases), only do it once somebody can't see the player
+    Optional<WorldPackets::Party::PartyMemberFullState> packet;
     for (GroupReference const& itr : GetMembers())
     {
         Player const* member = itr.GetSource();
-        if (member != player && (!member->IsInMap(player) || !member->IsWithinDist(player, member->GetSightRange(), false)))
-            member->SendDirectMessage(packet.GetRawPacket());
+        if (member == player || (member->IsInMap(player) && member->IsWithinDist(player, member->GetSightRange(), false)))
+            continue;
+
+        if (!packet)
+        {
+            packet.emplace();
+            packet->Initialize(player);
+            packet->Write();
+        }
+
+        member->SendDirectMessage(packet->GetRawPacket());
     }
 }
 
@@ -85,29 +85,36 @@ void Guild::SendSaveEmblemResult(WorldSession* session, GuildEmblemError errCode
 // LogHolder
 template <typename Entry>
 Guild::LogHolder<Entry>::LogHolder()
-    : m_maxRecords(sWorld->getIntConfig(std::is_same_v<Entry, BankEventLogEntry> ? CONFIG_GUILD_BANK_EVENT_LOG_COUNT : CONFIG_GUILD_EVENT_LOG_COUNT)), m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
+    : m_maxRecords(sWorld->getIntConfig(std::is_same_v<Entry, BankEventLogEntry> ? CONFIG_GUILD_BANK_EVENT_LOG_COUNT : CONFIG_GUILD_EVENT_LOG_COUNT)),
+    m_log(m_maxRecords), m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED)), m_unsavedCount(0)
 { }
 
 template <typename Entry> template <typename... Ts>
 void Guild::LogHolder<Entry>::LoadEvent(Ts&&... args)
 {
-    Entry const& newEntry = m_log.emplace_front(std::forward<Ts>(args)...);
+    m_log.push_front(Entry(std::forward<Ts>(args)...));
     if (m_nextGUID == uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
-        m_nextGUID = newEntry.GetGUID();
+        m_nextGUID = m_log.front().GetGUID();
 }
 
 template <typename Entry> template <typename... Ts>
-Entry& Guild::LogHolder<Entry>::AddEvent(CharacterDatabaseTransaction trans, Ts&&... args)
+Entry& Guild::LogHolder<Entry>::AddEvent(Ts&&... args)
 {
-    // Check max records limit
-    if (!CanInsert())
-        m_log.pop_front();
+    // Overwrites the oldest event when max records limit is reached
+    m_log.push_back(Entry(std::forward<Ts>(args)...));
 
-    // Add event to list
-    Entry& entry = m_log.emplace_back(std::forward<Ts>(args)...);
-    // Save to DB
-    entry.SaveToDB(trans);
-    return entry;
+    // Entries reuse guid slots in DB, unsaved events pushed out of the ring before a save don't need to be written at all
+    m_unsavedCount = std::min<uint32>(m_unsavedCount + 1, m_log.size());
+    return m_log.back();
+}
+
+template <typename Entry>
+void Guild::LogHolder<Entry>::SaveToDB(CharacterDatabaseTransaction trans)
+{
+    for (auto itr = m_log.end() - m_unsavedCount; itr != m_log.end(); ++itr)
+        itr->SaveToDB(trans);
+
+    m_unsavedCount = 0;
 }
 
 template <typename Entry>
@@ -883,11 +890,11 @@ Item* Guild::PlayerMoveItemData::StoreItem(CharacterDatabaseTransaction trans, I
     return pItem;
 }
 
-void Guild::PlayerMoveItemData::LogBankEvent(CharacterDatabaseTransaction trans, MoveItemData* pFrom, uint32 count) const
+void Guild::PlayerMoveItemData::LogBankEvent(MoveItemData* pFrom, uint32 count) const
 {
     ASSERT(pFrom);
     // Bank -> Char
-    m_pGuild->_LogBankEvent(trans, GUILD_BANK_LOG_WITHDRAW_ITEM, pFrom->GetContainer(), m_pPlayer->GetGUID().GetCounter(),
+    m_pGuild->_LogBankEvent(GUILD_BANK_LOG_WITHDRAW_ITEM, pFrom->GetContainer(), m_pPlayer->GetGUID().GetCounter(),
         pFrom->GetItem()->GetEntry(), count);
 }
 
@@ -969,16 +976,16 @@ Item* Guild::BankMoveItemData::StoreItem(CharacterDatabaseTransaction trans, Ite
     return pLastItem;
 }
 
-void Guild::BankMoveItemData::LogBankEvent(CharacterDatabaseTransaction trans, MoveItemData* pFrom, uint32 count) const
+void Guild::BankMoveItemData::LogBankEvent(MoveItemData* pFrom, uint32 count) const
 {
     ASSERT(pFrom->GetItem());
     if (pFrom->IsBank())
         // Bank -> Bank
-        m_pGuild->_LogBankEvent(trans, GUILD_BANK_LOG_MOVE_ITEM, pFrom->GetContainer(), m_pPlayer->GetGUID().GetCounter(),
+        m_pGuild->_LogBankEvent(GUILD_BANK_LOG_MOVE_ITEM, pFrom->GetContainer(), m_pPlayer->GetGUID().GetCounter(),
             pFrom->GetItem()->GetEntry(), count, m_container);
     else
         // Char -> Bank
-        m_pGuild->_LogBankEvent(trans, GUILD_BANK_LOG_DEPOSIT_ITEM, m_container, m_pPlayer->GetGUID().GetCounter(),
+        m_pGuild->_LogBankEvent(GUILD_BANK_LOG_DEPOSIT_ITEM, m_container, m_pPlayer->GetGUID().GetCounter(),
             pFrom->GetItem()->GetEntry(), count);
 }
 
@@ -1273,6 +1280,11 @@ void Guild::SaveToDB()
 
     GetAchievementMgr().SaveToDB(trans);
 
+    m_eventLog.SaveToDB(trans);
+    for (LogHolder<BankEventLogEntry>& bankEventLog : m_bankEventLog)
+        bankEventLog.SaveToDB(trans);
+    m_newsLog.SaveToDB(trans);
+
     CharacterDatabase.CommitTransaction(trans);
 }
 
@@ -1666,7 +1678,7 @@ void Guild::HandleBuyBankTab(WorldSession* session, uint8 tabId)
         return;
 
     // Log guild bank event
-    _LogBankEvent(trans, GUILD_BANK_LOG_BUY_TAB, tabId, player->GetGUID().GetCounter(), tabCost);
+    _LogBankEvent(GUILD_BANK_LOG_BUY_TAB, tabId, player->GetGUID().GetCounter(), tabCost);
 
     _CreateNewBankTab(trans);
 
@@ -2066,7 +2078,7 @@ void Guild::HandleMemberDepositMoney(WorldSession* session, uint64 amount, bool
         player->SaveInventoryAndGoldToDB(trans);
     }
 
-    _LogBankEvent(trans, cashFlow ? GUILD_BANK_LOG_CASH_FLOW_DEPOSIT : GUILD_BANK_LOG_DEPOSIT_MONEY, uint8(0), player->GetGUID().GetCounter(), amount);
+    _LogBankEvent(cashFlow ? GUILD_BANK_LOG_CASH_FLOW_DEPOSIT : GUILD_BANK_LOG_DEPOSIT_MONEY, uint8(0), player->GetGUID().GetCounter(), amount);
     CharacterDatabase.CommitTransaction(trans);
 
     SendEventBankMoneyChanged();
@@ -2118,7 +2130,7 @@ bool Guild::HandleMemberWithdrawMoney(WorldSession* session, uint64 amount, bool
     _ModifyBankMoney(trans, amount, false);
 
     // Log guild bank event
-    _LogBankEvent(trans, repair ? GUILD_BANK_LOG_REPAIR_MONEY : GUILD_BANK_LOG_WITHDRAW_MONEY, uint8(0), player->GetGUID().GetCounter(), amount);
+    _LogBankEvent(repair ? GUILD_BANK_LOG_REPAIR_MONEY : GUILD_BANK_LOG_WITHDRAW_MONEY, uint8(0), player->GetGUID().GetCounter(), amount);
     CharacterDatabase.CommitTransaction(trans);
 
     SendEventBankMoneyChanged();
@@ -2189,7 +2201,7 @@ void Guild::HandleGuildRequestChallengeUpdate(WorldSession* session) const
 
 void Guild::SendEventLog(WorldSession* session) const
 {
-    std::list<EventLogEntry> const& eventLog = m_eventLog.GetGuildLog();
+    LogHolder<EventLogEntry>::Container const& eventLog = m_eventLog.GetGuildLog();
 
     WorldPackets::Guild::GuildEventLogQueryResults packet;
     packet.Entry.reserve(eventLog.size());
@@ -2204,7 +2216,7 @@ void Guild::SendEventLog(WorldSession* session) const
 
 void Guild::SendNewsUpdate(WorldSession* session) const
 {
-    std::list<NewsLogEntry> const& newsLog = m_newsLog.GetGuildLog();
+    LogHolder<NewsLogEntry>::Container const& newsLog = m_newsLog.GetGuildLog();
 
     WorldPackets::Guild::GuildNews packet;
     packet.NewsEvents.reserve(newsLog.size());
@@ -2225,7 +2237,7 @@ void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < _GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS)
     {
-        std::list<BankEventLogEntry> const& bankEventLog = m_bankEventLog[tabId].GetGuildLog();
+        LogHolder<BankEventLogEntry>::Container const& bankEventLog = m_bankEventLog[tabId].GetGuildLog();
 
         WorldPackets::Guild::GuildBankLogQueryResults packet;
         packet.Tab = int32(tabId);
@@ -2714,7 +2726,8 @@ bool Guild::Validate()
         _SetLeader(trans, *leader);
 
     // Check config if multiple guildmasters are allowed
-    if (!sConfigMgr->GetBoolDefault("Guild.AllowMultipleGuildMaster", false))
+    static ConfigValue<bool> const allowMultipleGuildMaster("Guild.AllowMultipleGuildMaster", false);
+    if (!allowMultipleGuildMaster.Get())
         for (auto& [guid, member] : m_members)
             if (member.GetRankId() == GuildRankId::GuildMaster && !member.IsSamePlayer(m_leaderGuid))
                 member.ChangeRank(trans, GetRankInfo(GuildRankOrder(1))->GetId());
@@ -3393,15 +3406,13 @@ inline bool Guild::_MemberHasTabRights(ObjectGuid guid, uint8 tabId, int32 right
 // Add new event log record
 inline void Guild::_LogEvent(GuildEventLogTypes eventType, ObjectGuid::LowType playerGuid1, ObjectGuid::LowType playerGuid2, uint8 newRank)
 {
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-    m_eventLog.AddEvent(trans, m_id, m_eventLog.GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank);
-    CharacterDatabase.CommitTransaction(trans);
+    m_eventLog.AddEvent(m_id, m_eventLog.GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank);
 
     sScriptMgr->OnGuildEvent(this, uint8(eventType), playerGuid1, playerGuid2, newRank);
 }
 
 // Add new bank event log record
-void Guild::_LogBankEvent(CharacterDatabaseTransaction trans, GuildBankEventLogTypes eventType, uint8 tabId, ObjectGuid::LowType lowguid, uint64 itemOrMoney, uint16 itemStackCount, uint8 destTabId)
+void Guild::_LogBankEvent(GuildBankEventLogTypes eventType, uint8 tabId, ObjectGuid::LowType lowguid, uint64 itemOrMoney, uint16 itemStackCount, uint8 destTabId)
 {
     if (tabId > GUILD_BANK_MAX_TABS)
         return;
@@ -3417,7 +3428,7 @@ void Guild::_LogBankEvent(CharacterDatabaseTransaction trans, GuildBankEventLogT
         dbTabId = GUILD_BANK_MONEY_LOGS_TAB;
     }
     LogHolder<BankEventLogEntry>& pLog = m_bankEventLog[tabId];
-    pLog.AddEvent(trans, m_id, pLog.GetNextGUID(), eventType, dbTabId, lowguid, itemOrMoney, itemStackCount, destTabId);
+    pLog.AddEvent(m_id, pLog.GetNextGUID(), eventType, dbTabId, lowguid, itemOrMoney, itemStackCount, destTabId);
 
     sScriptMgr->OnGuildBankEvent(this, uint8(eventType), tabId, lowguid, itemOrMoney, itemStackCount, destTabId);
 }
@@ -3518,9 +3529,9 @@ InventoryResult Guild::_DoItemsMove(MoveItemData* pSrc, MoveItemData* pDest, boo
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     // 3. Log bank events
-    pDest->LogBankEvent(trans, pSrc, pSrcItem->GetCount());
+    pDest->LogBankEvent(pSrc, pSrcItem->GetCount());
     if (swap)
-        pSrc->LogBankEvent(trans, pDest, pDestItem->GetCount());
+        pSrc->LogBankEvent(pDest, pDestItem->GetCount());
 
     // 4. Remove item from source
     pSrc->RemoveItem(trans, pDest, splitedAmount);
@@ -3764,9 +3775,7 @@ void Guild::ResetTimes(bool weekly)
 
 void Guild::AddGuildNews(uint8 type, ObjectGuid guid, uint32 flags, uint32 value)
 {
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-    NewsLogEntry& news = m_newsLog.AddEvent(trans, m_id, m_newsLog.GetNextGUID(), GuildNews(type), guid, flags, value);
-    CharacterDatabase.CommitTransaction(trans);
+    NewsLogEntry& news = m_newsLog.AddEvent(m_id, m_newsLog.GetNextGUID(), GuildNews(type), guid, flags, value);
 
     BroadcastWorker([&](Player const* receiver)
     {
@@ -3791,7 +3800,7 @@ void Guild::UpdateCriteria(CriteriaType type, uint64 miscValue1, uint64 miscValu
 
 void Guild::HandleNewsSetSticky(WorldSession* session, uint32 newsId, bool sticky)
 {
-    std::list<NewsLogEntry>& newsLog = m_newsLog.GetGuildLog();
+    LogHolder<NewsLogEntry>::Container& newsLog = m_newsLog.GetGuildLog();
     auto itr = newsLog.begin();
     while (itr != newsLog.end() && itr->GetGUID() != newsId)
         ++itr;
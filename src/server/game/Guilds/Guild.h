@@ -26,6 +26,7 @@
 #include "RaceMask.h"
 #include "SharedDefines.h"
 #include "UniqueTrackablePtr.h"
+#include <boost/circular_buffer.hpp>
 #include <set>
 #include <unordered_map>
 
@@ -539,31 +540,39 @@ class TC_GAME_API Guild
         };
 
         // Class encapsulating work with events collection
+        // Events are kept in a fixed capacity ring, the oldest entry is overwritten when full
         template <typename Entry>
         class LogHolder
         {
             public:
+                using Container = boost::circular_buffer<Entry>;
+
                 LogHolder();
 
                 // Checks if new log entry can be added to holder
-                bool CanInsert() const { return m_log.size() < m_maxRecords; }
+                bool CanInsert() const { return !m_log.full(); }
 
                 // Adds event from DB to collection
                 template <typename... Ts>
                 void LoadEvent(Ts&&... args);
 
-                // Adds new event to collection and saves it to DB
+                // Adds new event to collection, it is written to DB by the next SaveToDB call
                 template <typename... Ts>
-                Entry& AddEvent(CharacterDatabaseTransaction trans, Ts&&... args);
+                Entry& AddEvent(Ts&&... args);
+
+                // Writes events added since the last call
+                void SaveToDB(CharacterDatabaseTransaction trans);
 
                 uint32 GetNextGUID();
-                std::list<Entry>& GetGuildLog() { return m_log; }
-                std::list<Entry> const& GetGuildLog() const { return m_log; }
+                Container& GetGuildLog() { return m_log; }
+                Container const& GetGuildLog() const { return m_log; }
 
             private:
-                std::list<Entry> m_log;
                 uint32 const m_maxRecords;
+                Container m_log;
                 uint32 m_nextGUID;
+                // number of newest entries not yet written to DB, never exceeds m_log.size()
+                uint32 m_unsavedCount;
         };
 
         // Class encapsulating guild rank data
@@ -674,7 +683,7 @@ class TC_GAME_API Guild
                 // Saves item to container
                 virtual Item* StoreItem(CharacterDatabaseTransaction trans, Item* pItem) = 0;
                 // Log bank event
-                virtual void LogBankEvent(CharacterDatabaseTransaction trans, MoveItemData* pFrom, uint32 count) const = 0;
+                virtual void LogBankEvent(MoveItemData* pFrom, uint32 count) const = 0;
                 // Log GM action
                 virtual void LogAction(MoveItemData* pFrom) const;
                 // Copy slots id from position vector
@@ -708,7 +717,7 @@ class TC_GAME_API Guild
                 bool InitItem() override;
                 void RemoveItem(CharacterDatabaseTransaction trans, MoveItemData* pOther, uint32 splitedAmount = 0) override;
                 Item* StoreItem(CharacterDatabaseTransaction trans, Item* pItem) override;
-                void LogBankEvent(CharacterDatabaseTransaction trans, MoveItemData* pFrom, uint32 count) const override;
+                void LogBankEvent(MoveItemData* pFrom, uint32 count) const override;
 
             protected:
                 InventoryResult CanStore(Item* pItem, bool swap) override;
@@ -726,7 +735,7 @@ class TC_GAME_API Guild
                 bool HasWithdrawRights(MoveItemData* pOther) const override;
                 void RemoveItem(CharacterDatabaseTransaction trans, MoveItemData* pOther, uint32 splitedAmount) override;
                 Item* StoreItem(CharacterDatabaseTransaction trans, Item* pItem) override;
-                void LogBankEvent(CharacterDatabaseTransaction trans, MoveItemData* pFrom, uint32 count) const override;
+                void LogBankEvent(MoveItemData* pFrom, uint32 count) const override;
                 void LogAction(MoveItemData* pFrom) const override;
 
             protected:
@@ -971,7 +980,7 @@ class TC_GAME_API Guild
         bool _MemberHasTabRights(ObjectGuid guid, uint8 tabId, int32 rights) const;
 
         void _LogEvent(GuildEventLogTypes eventType, ObjectGuid::LowType playerGuid1, ObjectGuid::LowType playerGuid2 = UI64LIT(0), uint8 newRank = 0);
-        void _LogBankEvent(CharacterDatabaseTransaction trans, GuildBankEventLogTypes eventType, uint8 tabId, ObjectGuid::LowType playerGuid, uint64 itemOrMoney, uint16 itemStackCount = 0, uint8 destTabId = 0);
+        void _LogBankEvent(GuildBankEventLogTypes eventType, uint8 tabId, ObjectGuid::LowType playerGuid, uint64 itemOrMoney, uint16 itemStackCount = 0, uint8 destTabId = 0);
 
         Item* _GetItem(uint8 tabId, uint8 slotId) const;
         void _RemoveItem(CharacterDatabaseTransaction trans, uint8 tabId, uint8 slotId);
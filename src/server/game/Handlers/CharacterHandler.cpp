@@ -486,10 +486,6 @@ void WorldSession::HandleCharEnum(CharacterDatabaseQueryHolder const& holder)
 
 void WorldSession::HandleCharEnumOpcode(WorldPackets::Character::EnumCharacters& /*enumCharacters*/)
 {
-    // remove expired bans
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
-    CharacterDatabase.Execute(stmt);
-
     /// get all the data necessary for loading all characters (along with their pets) on the account
     std::shared_ptr<EnumCharactersQueryHolder> holder = std::make_shared<EnumCharactersQueryHolder>();
     if (!holder->Initialize(GetAccountId(), sWorld->getBoolConfig(CONFIG_DECLINED_NAMES_USED), false))
@@ -498,7 +494,7 @@ void WorldSession::HandleCharEnumOpcode(WorldPackets::Character::EnumCharacters&
         return;
     }
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& result)
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder, DatabaseQueuePriority::High)).AfterComplete([this](SQLQueryHolderBase const& result)
     {
         HandleCharEnum(static_cast<EnumCharactersQueryHolder const&>(result));
     });
@@ -514,7 +510,7 @@ void WorldSession::HandleCharUndeleteEnumOpcode(WorldPackets::Character::EnumCha
         return;
     }
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& result)
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder, DatabaseQueuePriority::High)).AfterComplete([this](SQLQueryHolderBase const& result)
     {
         HandleCharEnum(static_cast<EnumCharactersQueryHolder const&>(result));
     });
@@ -1124,7 +1120,7 @@ void WorldSession::HandleContinuePlayerLogin()
     // client will respond to SMSG_RESUME_COMMS with CMSG_QUEUED_MESSAGES_END
     RegisterTimeSync(SPECIAL_RESUME_COMMS_TIME_SYNC_COUNTER);
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder, DatabaseQueuePriority::High)).AfterComplete([this](SQLQueryHolderBase const& holder)
     {
         HandlePlayerLogin(static_cast<LoginQueryHolder const&>(holder));
     });
@@ -31,7 +31,13 @@ void WorldSession::HandleDBQueryBulk(WorldPackets::Hotfix::DBQueryBulk& dbQuery)
         dbReply.TableHash = dbQuery.TableHash;
         dbReply.RecordID = record.RecordID;
 
-        if (store && store->HasRecord(record.RecordID))
+        if (std::vector<uint8> const* recordData = sDB2Manager.GetHotfixRecordData(dbQuery.TableHash, record.RecordID, GetSessionDbcLocale()))
+        {
+            dbReply.Status = DB2Manager::HotfixRecord::Status::Valid;
+            dbReply.Timestamp = GameTime::GetGameTime();
+            dbReply.Data.append(recordData->data(), recordData->size());
+        }
+        else if (store && store->HasRecord(record.RecordID))
         {
             dbReply.Status = DB2Manager::HotfixRecord::Status::Valid;
             dbReply.Timestamp = GameTime::GetGameTime();
@@ -91,7 +97,12 @@ void WorldSession::HandleHotfixRequest(WorldPackets::Hotfix::HotfixRequest& hotf
                 if (hotfixRecord.HotfixStatus == DB2Manager::HotfixRecord::Status::Valid)
                 {
                     DB2StorageBase const* storage = sDB2Manager.GetStorage(hotfixRecord.TableHash);
-                    if (storage && storage->HasRecord(uint32(hotfixRecord.RecordID)))
+                    if (std::vector<uint8> const* recordData = sDB2Manager.GetHotfixRecordData(hotfixRecord.TableHash, hotfixRecord.RecordID, GetSessionDbcLocale()))
+                    {
+                        hotfixData.Size = recordData->size();
+                        hotfixQueryResponse.HotfixContent.append(recordData->data(), recordData->size());
+                    }
+                    else if (storage && storage->HasRecord(uint32(hotfixRecord.RecordID)))
                     {
                         std::size_t pos = hotfixQueryResponse.HotfixContent.size();
                         storage->WriteRecord(uint32(hotfixRecord.RecordID), GetSessionDbcLocale(), hotfixQueryResponse.HotfixContent);
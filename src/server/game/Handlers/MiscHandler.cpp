@@ -1124,6 +1124,8 @@ void WorldSession::HandleObjectUpdateRescuedOpcode(WorldPackets::Misc::ObjectUpd
     // Client received values update after destroying object
     // re-register object in m_clientGUIDs to send DestroyObject on next visibility update
     _player->m_clientGUIDs.insert(objectUpdateRescued.ObjectGUID);
+    if (WorldObject* object = ObjectAccessor::GetWorldObject(*_player, objectUpdateRescued.ObjectGUID))
+        object->AddClientViewer(_player->GetGUID());
 }
 
 void WorldSession::HandleSaveCUFProfiles(WorldPackets::Misc::SaveCUFProfiles& packet)
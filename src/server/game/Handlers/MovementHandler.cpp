@@ -458,7 +458,11 @@ void WorldSession::HandleMovementOpcode(OpcodeClient opcode, MovementInfo& movem
 
     WorldPackets::Movement::MoveUpdate moveUpdate;
     moveUpdate.Status = &mover->m_movementInfo;
-    mover->SendMessageToSet(moveUpdate.Write(), _player);
+    moveUpdate.Write();
+    if (mover->GetMap()->IsMovementRelayBatched())
+        mover->GetMap()->QueueMovementRelay(mover, _player, moveUpdate.Move());
+    else
+        mover->SendMessageToSet(moveUpdate.GetRawPacket(), _player);
 
     if (plrMover)                                            // nothing is charmed, or player charmed
     {
@@ -431,7 +431,11 @@ public:
 
     PersistentInstanceScriptValue& operator=(T value)
     {
-        _value = WrapValue(value);
+        std::variant<int64, double> newValue = WrapValue(value);
+        if (newValue == _value)
+            return *this;
+
+        _value = std::move(newValue);
         NotifyValueChanged();
         return *this;
     }
@@ -434,37 +434,55 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
 }
 
 // Rolls an item from the group, returns NULL if all miss their chances
+// Invalid entries are skipped in place, this runs for every group on every kill and must not allocate
 LootStoreItem const* LootTemplate::LootGroup::Roll(uint16 lootMode, Player const* personalLooter /*= nullptr*/) const
 {
-    auto getValidLoot = [](LootStoreItemList const& items, uint16 lootMode, Player const* personalLooter)
-    {
-        std::vector<LootStoreItem const*> possibleLoot;
-        possibleLoot.resize(items.size());
-        std::ranges::transform(items, possibleLoot.begin(), [](std::unique_ptr<LootStoreItem> const& i) { return i.get(); });
-        Trinity::Containers::EraseIf(possibleLoot, LootGroupInvalidSelector(lootMode, personalLooter));
-        return possibleLoot;
-    };
-
-    std::vector<LootStoreItem const*> possibleLoot = getValidLoot(ExplicitlyChanced, lootMode, personalLooter);
+    LootGroupInvalidSelector isInvalid(lootMode, personalLooter);
 
-    if (!possibleLoot.empty())                              // First explicitly chanced entries are checked
+    if (!ExplicitlyChanced.empty())                         // First explicitly chanced entries are checked
     {
         float roll = rand_chance();
 
-        for (LootStoreItem const* item : possibleLoot)      // check each explicitly chanced entry in the template and modify its chance based on quality.
+        for (std::unique_ptr<LootStoreItem> const& item : ExplicitlyChanced) // check each explicitly chanced entry in the template and modify its chance based on quality.
         {
+            if (isInvalid(item.get()))
+                continue;
+
             if (item->chance >= 100.0f)
-                return item;
+                return item.get();
 
             roll -= item->chance;
             if (roll < 0)
-                return item;
+                return item.get();
         }
     }
 
-    possibleLoot = getValidLoot(EqualChanced, lootMode, personalLooter);
-    if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
+    if (!EqualChanced.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
+    {
+        if (!personalLooter)
+        {
+            // lootmode check is cheap, count valid entries first and pick one of them
+            std::size_t validCount = std::ranges::count_if(EqualChanced, [&](std::unique_ptr<LootStoreItem> const& item) { return !isInvalid(item.get()); });
+            if (!validCount)
+                return nullptr;
+
+            std::size_t selected = urand(0, uint32(validCount - 1));
+            for (std::unique_ptr<LootStoreItem> const& item : EqualChanced)
+                if (!isInvalid(item.get()) && !selected--)
+                    return item.get();
+        }
+        else
+        {
+            // usability checks are not cheap, select uniformly in a single pass
+            LootStoreItem const* selected = nullptr;
+            uint32 validCount = 0;
+            for (std::unique_ptr<LootStoreItem> const& item : EqualChanced)
+                if (!isInvalid(item.get()) && !urand(0, validCount++))
+                    selected = item.get();
+
+            return selected;
+        }
+    }
 
     return nullptr;                                         // Empty drop from the group
 }
@@ -194,16 +194,42 @@ void MailDraft::SendReturnToSender(uint32 sender_acc, ObjectGuid::LowType sender
 
 void MailDraft::SendMailTo(CharacterDatabaseTransaction trans, MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked, uint32 deliver_delay)
 {
-    Player* pReceiver = receiver.GetPlayer();               // can be NULL
     Player* pSender = sender.GetMailMessageType() == MAIL_NORMAL ? ObjectAccessor::FindPlayer(ObjectGuid::Create<HighGuid::Player>(sender.GetSenderId())) : nullptr;
 
+    sendMail(trans, receiver, sender, pSender, checked, GameTime::GetGameTime() + deliver_delay);
+}
+
+void MailDraft::SendMailTo(CharacterDatabaseTransaction trans, std::span<MailReceiver const> receivers, MailSender const& sender, MailCheckMask checked, uint32 deliver_delay)
+{
+    // attached items have a single owner, only template items can be generated for each receiver
+    ASSERT(m_items.empty(), "MailDraft::SendMailTo can not send attached items to multiple receivers");
+
+    Player* pSender = sender.GetMailMessageType() == MAIL_NORMAL ? ObjectAccessor::FindPlayer(ObjectGuid::Create<HighGuid::Player>(sender.GetSenderId())) : nullptr;
+    time_t deliver_time = GameTime::GetGameTime() + deliver_delay;
+    bool templateItemsNeed = m_mailTemplateItemsNeed;
+    uint64 money = m_money;
+
+    for (MailReceiver const& receiver : receivers)
+    {
+        m_mailTemplateItemsNeed = templateItemsNeed;
+        m_money = money;
+
+        sendMail(trans, receiver, sender, pSender, checked, deliver_time);
+
+        // ownership of generated items was passed to the receiver (or they were deleted)
+        m_items.clear();
+    }
+}
+
+void MailDraft::sendMail(CharacterDatabaseTransaction trans, MailReceiver const& receiver, MailSender const& sender, Player const* pSender, MailCheckMask checked, time_t deliver_time)
+{
+    Player* pReceiver = receiver.GetPlayer();               // can be NULL
+
     if (pReceiver)
         prepareItems(pReceiver, trans);                            // generate mail template items
 
     uint64 mailId = sObjectMgr->GenerateMailID();
 
-    time_t deliver_time = GameTime::GetGameTime() + deliver_delay;
-
     //expire time if COD 3 days, if no COD 30 days, if auction sale pending 1 hour
     uint32 expire_delay;
 
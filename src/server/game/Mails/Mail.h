@@ -22,6 +22,7 @@
 #include "DatabaseEnvFwd.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <span>
 
 struct CalendarEvent;
 class AuctionHouseObject;
@@ -148,8 +149,11 @@ class TC_GAME_API MailDraft
     public:                                                 // finishers
         void SendReturnToSender(uint32 sender_acc, ObjectGuid::LowType sender_guid, ObjectGuid::LowType receiver_guid, CharacterDatabaseTransaction trans);
         void SendMailTo(CharacterDatabaseTransaction trans, MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked = MAIL_CHECK_MASK_NONE, uint32 deliver_delay = 0);
+        // sends a copy to every receiver inside trans, for system mail without attached items (template items are generated for each online receiver)
+        void SendMailTo(CharacterDatabaseTransaction trans, std::span<MailReceiver const> receivers, MailSender const& sender, MailCheckMask checked = MAIL_CHECK_MASK_NONE, uint32 deliver_delay = 0);
 
     private:
+        void sendMail(CharacterDatabaseTransaction trans, MailReceiver const& receiver, MailSender const& sender, Player const* pSender, MailCheckMask checked, time_t deliver_time);
         void deleteIncludedItems(CharacterDatabaseTransaction trans, bool inDB = false);
         void prepareItems(Player* receiver, CharacterDatabaseTransaction trans);                // called from SendMailTo for generate mailTemplateBase items
 
@@ -17,10 +17,18 @@
 
 #include "GridMap.h"
 #include "DB2Stores.h"
+#include "Errors.h"
 #include "GridDefines.h"
 #include "Log.h"
+#include "Memory.h"
+#include "Position.h"
 #include <G3D/Plane.h>
 #include <G3D/Ray.h>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 // *****************************
 // Grid function
@@ -57,108 +65,194 @@ GridMap::~GridMap()
     unloadData();
 }
 
-GridMap::LoadResult GridMap::loadData(char const* filename)
+class GridMapFileReader
+{
+public:
+    explicit GridMapFileReader(FILE* file) : _file(file), _mapping(nullptr), _mappingSize(0), _position(0) { }
+    GridMapFileReader(uint8 const* mapping, std::size_t mappingSize) : _file(nullptr), _mapping(mapping), _mappingSize(mappingSize), _position(0) { }
+
+    bool Seek(uint32 offset)
+    {
+        if (_file)
+            return fseek(_file, offset, SEEK_SET) == 0;
+
+        if (offset > _mappingSize)
+            return false;
+
+        _position = offset;
+        return true;
+    }
+
+    template <typename T>
+    bool Read(T* dest, std::size_t count)
+    {
+        if (_file)
+            return fread(dest, sizeof(T), count, _file) == count;
+
+        if (_mappingSize - _position < sizeof(T) * count)
+            return false;
+
+        memcpy(dest, _mapping + _position, sizeof(T) * count);
+        _position += sizeof(T) * count;
+        return true;
+    }
+
+    // points directly into the mapped file when the data is suitably aligned, otherwise allocates a copy
+    template <typename T>
+    T* ReadArray(std::size_t count)
+    {
+        if (_mapping && _mappingSize - _position >= sizeof(T) * count && reinterpret_cast<uintptr_t>(_mapping + _position) % alignof(T) == 0)
+        {
+            T* data = reinterpret_cast<T*>(const_cast<uint8*>(_mapping + _position));
+            _position += sizeof(T) * count;
+            return data;
+        }
+
+        T* data = new T[count];
+        if (!Read(data, count))
+        {
+            delete[] data;
+            return nullptr;
+        }
+
+        return data;
+    }
+
+private:
+    FILE* _file;
+    uint8 const* _mapping;
+    std::size_t _mappingSize;
+    std::size_t _position;
+};
+
+GridMap::LoadResult GridMap::loadData(char const* filename, bool useMemoryMapping /*= false*/)
 {
     // Unload old data if exist
     unloadData();
 
-    map_fileheader header;
+    if (useMemoryMapping)
+    {
+        try
+        {
+            boost::interprocess::file_mapping file(filename, boost::interprocess::read_only);
+            _mappedFile = std::make_unique<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+        }
+        catch (boost::interprocess::interprocess_exception const&)
+        {
+            // fall back to regular reads, this also reports missing files
+            _mappedFile = nullptr;
+        }
+
+        if (_mappedFile)
+        {
+            GridMapFileReader reader(static_cast<uint8 const*>(_mappedFile->get_address()), _mappedFile->get_size());
+            return loadDataImpl(filename, reader);
+        }
+    }
+
     // Not return error if file not found
-    FILE* in = fopen(filename, "rb");
+    auto in = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(filename, "rb"));
     if (!in)
         return LoadResult::FileDoesNotExist;
 
-    if (fread(&header, sizeof(header), 1, in) != 1)
-    {
-        fclose(in);
+    GridMapFileReader reader(in.get());
+    return loadDataImpl(filename, reader);
+}
+
+GridMap::LoadResult GridMap::loadDataImpl(char const* filename, GridMapFileReader& reader)
+{
+    map_fileheader header;
+    if (!reader.Read(&header, 1))
         return LoadResult::InvalidFile;
-    }
 
     if (header.mapMagic == MapMagic && header.versionMagic == MapVersionMagic)
     {
         // load up area data
-        if (header.areaMapOffset && !loadAreaData(in, header.areaMapOffset, header.areaMapSize))
+        if (header.areaMapOffset && !loadAreaData(reader, header.areaMapOffset, header.areaMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map area data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
         // load up height data
-        if (header.heightMapOffset && !loadHeightData(in, header.heightMapOffset, header.heightMapSize))
+        if (header.heightMapOffset && !loadHeightData(reader, header.heightMapOffset, header.heightMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map height data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
         // load up liquid data
-        if (header.liquidMapOffset && !loadLiquidData(in, header.liquidMapOffset, header.liquidMapSize))
+        if (header.liquidMapOffset && !loadLiquidData(reader, header.liquidMapOffset, header.liquidMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map liquids data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
         // loadup holes data (if any. check header.holesOffset)
-        if (header.holesSize && !loadHolesData(in, header.holesOffset, header.holesSize))
+        if (header.holesSize && !loadHolesData(reader, header.holesOffset, header.holesSize))
         {
             TC_LOG_ERROR("maps", "Error loading map holes data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
-        fclose(in);
         return LoadResult::Ok;
     }
 
     TC_LOG_ERROR("maps", "Map file '{}' is from an incompatible map version ({} v{}), {} v{} is expected. Please pull your source, recompile tools and recreate maps using the updated mapextractor, then replace your old map files with new files. If you still have problems search on forum for error TCE00018.",
         filename, std::string_view(header.mapMagic.data(), 4), header.versionMagic, std::string_view(MapMagic.data(), 4), MapVersionMagic);
-    fclose(in);
     return LoadResult::InvalidFile;
 }
 
+template <typename T>
+void GridMap::freeData(T*& data)
+{
+    // arrays pointing into the file mapping are released together with it
+    if (_mappedFile)
+    {
+        uint8 const* begin = static_cast<uint8 const*>(_mappedFile->get_address());
+        uint8 const* address = reinterpret_cast<uint8 const*>(data);
+        if (address >= begin && address < begin + _mappedFile->get_size())
+        {
+            data = nullptr;
+            return;
+        }
+    }
+
+    delete[] data;
+    data = nullptr;
+}
+
 void GridMap::unloadData()
 {
-    delete[] _areaMap;
-    delete[] m_V9;
-    delete[] m_V8;
+    freeData(_areaMap);
+    freeData(m_V9);
+    freeData(m_V8);
     delete[] _minHeightPlanes;
-    delete[] _liquidEntry;
-    delete[] _liquidFlags;
-    delete[] _liquidMap;
-    delete[] _holes;
-    _areaMap = nullptr;
-    m_V9 = nullptr;
-    m_V8 = nullptr;
+    freeData(_liquidEntry);
+    freeData(_liquidFlags);
+    freeData(_liquidMap);
+    freeData(_holes);
     _minHeightPlanes = nullptr;
-    _liquidEntry = nullptr;
-    _liquidFlags = nullptr;
-    _liquidMap  = nullptr;
-    _holes = nullptr;
+    _mappedFile = nullptr;
     _gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
-bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadAreaData(GridMapFileReader& reader, uint32 offset, uint32 /*size*/)
 {
     map_areaHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.areaMagic != MapAreaMagic)
+    if (!reader.Seek(offset) || !reader.Read(&header, 1) || header.areaMagic != MapAreaMagic)
         return false;
 
     _gridArea = header.gridArea;
     if (!header.flags.HasFlag(map_areaHeaderFlags::NoArea))
     {
-        _areaMap = new uint16[16 * 16];
-        if (fread(_areaMap, sizeof(uint16), 16*16, in) != 16*16)
+        _areaMap = reader.ReadArray<uint16>(16*16);
+        if (!_areaMap)
             return false;
     }
     return true;
 }
 
-bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHeightData(GridMapFileReader& reader, uint32 offset, uint32 /*size*/)
 {
     map_heightHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.heightMagic != MapHeightMagic)
+    if (!reader.Seek(offset) || !reader.Read(&header, 1) || header.heightMagic != MapHeightMagic)
         return false;
 
     _gridHeight = header.gridHeight;
@@ -166,30 +260,27 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         if (header.flags.HasFlag(map_heightHeaderFlags::HeightAsInt16))
         {
-            m_uint16_V9 = new uint16 [129*129];
-            m_uint16_V8 = new uint16 [128*128];
-            if (fread(m_uint16_V9, sizeof(uint16), 129*129, in) != 129*129 ||
-                fread(m_uint16_V8, sizeof(uint16), 128*128, in) != 128*128)
+            m_uint16_V9 = reader.ReadArray<uint16>(129*129);
+            m_uint16_V8 = m_uint16_V9 ? reader.ReadArray<uint16>(128*128) : nullptr;
+            if (!m_uint16_V9 || !m_uint16_V8)
                 return false;
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             _gridGetHeight = &GridMap::getHeightFromUint16;
         }
         else if (header.flags.HasFlag(map_heightHeaderFlags::HeightAsInt8))
         {
-            m_uint8_V9 = new uint8 [129*129];
-            m_uint8_V8 = new uint8 [128*128];
-            if (fread(m_uint8_V9, sizeof(uint8), 129*129, in) != 129*129 ||
-                fread(m_uint8_V8, sizeof(uint8), 128*128, in) != 128*128)
+            m_uint8_V9 = reader.ReadArray<uint8>(129*129);
+            m_uint8_V8 = m_uint8_V9 ? reader.ReadArray<uint8>(128*128) : nullptr;
+            if (!m_uint8_V9 || !m_uint8_V8)
                 return false;
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             _gridGetHeight = &GridMap::getHeightFromUint8;
         }
         else
         {
-            m_V9 = new float [129*129];
-            m_V8 = new float [128*128];
-            if (fread(m_V9, sizeof(float), 129*129, in) != 129*129 ||
-                fread(m_V8, sizeof(float), 128*128, in) != 128*128)
+            m_V9 = reader.ReadArray<float>(129*129);
+            m_V8 = m_V9 ? reader.ReadArray<float>(128*128) : nullptr;
+            if (!m_V9 || !m_V8)
                 return false;
             _gridGetHeight = &GridMap::getHeightFromFloat;
         }
@@ -201,8 +292,8 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         std::array<int16, 9> maxHeights;
         std::array<int16, 9> minHeights;
-        if (fread(maxHeights.data(), sizeof(int16), maxHeights.size(), in) != maxHeights.size() ||
-            fread(minHeights.data(), sizeof(int16), minHeights.size(), in) != minHeights.size())
+        if (!reader.Read(maxHeights.data(), maxHeights.size()) ||
+            !reader.Read(minHeights.data(), minHeights.size()))
             return false;
 
         static uint32 constexpr indices[8][3] =
@@ -242,12 +333,10 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     return true;
 }
 
-bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadLiquidData(GridMapFileReader& reader, uint32 offset, uint32 /*size*/)
 {
     map_liquidHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.liquidMagic != MapLiquidMagic)
+    if (!reader.Seek(offset) || !reader.Read(&header, 1) || header.liquidMagic != MapLiquidMagic)
         return false;
 
     _liquidGlobalEntry = header.liquidType;
@@ -260,30 +349,30 @@ bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
 
     if (!header.flags.HasFlag(map_liquidHeaderFlags::NoType))
     {
-        _liquidEntry = new uint16[16*16];
-        if (fread(_liquidEntry, sizeof(uint16), 16*16, in) != 16*16)
+        _liquidEntry = reader.ReadArray<uint16>(16*16);
+        if (!_liquidEntry)
             return false;
 
-        _liquidFlags = new map_liquidHeaderTypeFlags[16*16];
-        if (fread(_liquidFlags, sizeof(map_liquidHeaderTypeFlags), 16*16, in) != 16*16)
+        _liquidFlags = reader.ReadArray<map_liquidHeaderTypeFlags>(16*16);
+        if (!_liquidFlags)
             return false;
     }
     if (!header.flags.HasFlag(map_liquidHeaderFlags::NoHeight))
     {
-        _liquidMap = new float[uint32(_liquidWidth) * uint32(_liquidHeight)];
-        if (fread(_liquidMap, sizeof(float), _liquidWidth*_liquidHeight, in) != (uint32(_liquidWidth) * uint32(_liquidHeight)))
+        _liquidMap = reader.ReadArray<float>(uint32(_liquidWidth) * uint32(_liquidHeight));
+        if (!_liquidMap)
             return false;
     }
     return true;
 }
 
-bool GridMap::loadHolesData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHolesData(GridMapFileReader& reader, uint32 offset, uint32 /*size*/)
 {
-    if (fseek(in, offset, SEEK_SET) != 0)
+    if (!reader.Seek(offset))
         return false;
 
-    _holes = new uint8[16 * 16 * 8];
-    if (fread(_holes, sizeof(uint8), 16 * 16 * 8, in) != 16 * 16 * 8)
+    _holes = reader.ReadArray<uint8>(16 * 16 * 8);
+    if (!_holes)
         return false;
 
     return true;
@@ -306,10 +395,11 @@ float GridMap::getHeightFromFlat(float /*x*/, float /*y*/) const
     return _gridHeight;
 }
 
-float GridMap::getHeightFromFloat(float x, float y) const
+template <typename T>
+float GridMap::getHeightFromGrid(T const* V9, T const* V8, float x, float y) const
 {
-    if (!m_V8 || !m_V9)
-        return _gridHeight;
+    // integer grids are interpolated before being scaled into the float range
+    using Value = std::conditional_t<std::is_floating_point_v<T>, float, int32>;
 
     x = MAP_RESOLUTION * (CENTER_GRID_ID - x/SIZE_OF_GRIDS);
     y = MAP_RESOLUTION * (CENTER_GRID_ID - y/SIZE_OF_GRIDS);
@@ -339,16 +429,17 @@ float GridMap::getHeightFromFloat(float x, float y) const
     // 2 - solve linear equation from triangle points
     // Calculate coefficients for solve h = a*x + b*y + c
 
-    float a, b, c;
+    Value a, b, c;
+    T const* V9_h1_ptr = &V9[x_int*128 + x_int + y_int];
+    Value h5 = 2 * Value(V8[x_int*128 + y_int]);
     // Select triangle:
     if (x+y < 1)
     {
         if (x > y)
         {
             // 1 triangle (h1, h2, h5 points)
-            float h1 = m_V9[(x_int)*129 + y_int];
-            float h2 = m_V9[(x_int+1)*129 + y_int];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Value h1 = V9_h1_ptr[  0];
+            Value h2 = V9_h1_ptr[129];
             a = h2-h1;
             b = h5-h1-h2;
             c = h1;
@@ -356,9 +447,8 @@ float GridMap::getHeightFromFloat(float x, float y) const
         else
         {
             // 2 triangle (h1, h3, h5 points)
-            float h1 = m_V9[x_int*129 + y_int  ];
-            float h3 = m_V9[x_int*129 + y_int+1];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Value h1 = V9_h1_ptr[0];
+            Value h3 = V9_h1_ptr[1];
             a = h5 - h1 - h3;
             b = h3 - h1;
             c = h1;
@@ -369,9 +459,8 @@ float GridMap::getHeightFromFloat(float x, float y) const
         if (x > y)
         {
             // 3 triangle (h2, h4, h5 points)
-            float h2 = m_V9[(x_int+1)*129 + y_int  ];
-            float h4 = m_V9[(x_int+1)*129 + y_int+1];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Value h2 = V9_h1_ptr[129];
+            Value h4 = V9_h1_ptr[130];
             a = h2 + h4 - h5;
             b = h4 - h2;
             c = h5 - h4;
@@ -379,86 +468,48 @@ float GridMap::getHeightFromFloat(float x, float y) const
         else
         {
             // 4 triangle (h3, h4, h5 points)
-            float h3 = m_V9[(x_int)*129 + y_int+1];
-            float h4 = m_V9[(x_int+1)*129 + y_int+1];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Value h3 = V9_h1_ptr[  1];
+            Value h4 = V9_h1_ptr[130];
             a = h4 - h3;
             b = h3 + h4 - h5;
             c = h5 - h4;
         }
     }
+
     // Calculate height
-    return a * x + b * y + c;
+    if constexpr (std::is_floating_point_v<T>)
+        return a * x + b * y + c;
+    else
+        return (float)((a * x) + (b * y) + c)*_gridIntHeightMultiplier + _gridHeight;
 }
 
-float GridMap::getHeightFromUint8(float x, float y) const
+template <typename T>
+void GridMap::getHeightsFromGrid(T const* V9, T const* V8, std::span<Position const> points, std::span<float> heights) const
 {
-    if (!m_uint8_V8 || !m_uint8_V9)
-        return _gridHeight;
+    if (!V9 || !V8)
+    {
+        std::ranges::fill(heights, _gridHeight);
+        return;
+    }
 
-    x = MAP_RESOLUTION * (CENTER_GRID_ID - x/SIZE_OF_GRIDS);
-    y = MAP_RESOLUTION * (CENTER_GRID_ID - y/SIZE_OF_GRIDS);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        heights[i] = getHeightFromGrid(V9, V8, points[i].GetPositionX(), points[i].GetPositionY());
+}
 
-    int x_int = (int)x;
-    int y_int = (int)y;
-    x -= x_int;
-    y -= y_int;
-    x_int&=(MAP_RESOLUTION - 1);
-    y_int&=(MAP_RESOLUTION - 1);
+float GridMap::getHeightFromFloat(float x, float y) const
+{
+    if (!m_V8 || !m_V9)
+        return _gridHeight;
 
-    if (isHole(x_int, y_int))
-        return INVALID_HEIGHT;
+    return getHeightFromGrid(m_V9, m_V8, x, y);
+}
 
-    int32 a, b, c;
-    uint8 *V9_h1_ptr = &m_uint8_V9[x_int*128 + x_int + y_int];
-    if (x+y < 1)
-    {
-        if (x > y)
-        {
-            // 1 triangle (h1, h2, h5 points)
-            int32 h1 = V9_h1_ptr[  0];
-            int32 h2 = V9_h1_ptr[129];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h2-h1;
-            b = h5-h1-h2;
-            c = h1;
-        }
-        else
-        {
-            // 2 triangle (h1, h3, h5 points)
-            int32 h1 = V9_h1_ptr[0];
-            int32 h3 = V9_h1_ptr[1];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h5 - h1 - h3;
-            b = h3 - h1;
-            c = h1;
-        }
-    }
-    else
-    {
-        if (x > y)
-        {
-            // 3 triangle (h2, h4, h5 points)
-            int32 h2 = V9_h1_ptr[129];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h2 + h4 - h5;
-            b = h4 - h2;
-            c = h5 - h4;
-        }
-        else
-        {
-            // 4 triangle (h3, h4, h5 points)
-            int32 h3 = V9_h1_ptr[  1];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h4 - h3;
-            b = h3 + h4 - h5;
-            c = h5 - h4;
-        }
-    }
-    // Calculate height
-    return (float)((a * x) + (b * y) + c)*_gridIntHeightMultiplier + _gridHeight;
+float GridMap::getHeightFromUint8(float x, float y) const
+{
+    if (!m_uint8_V8 || !m_uint8_V9)
+        return _gridHeight;
+
+    return getHeightFromGrid(m_uint8_V9, m_uint8_V8, x, y);
 }
 
 float GridMap::getHeightFromUint16(float x, float y) const
@@ -466,69 +517,22 @@ float GridMap::getHeightFromUint16(float x, float y) const
     if (!m_uint16_V8 || !m_uint16_V9)
         return _gridHeight;
 
-    x = MAP_RESOLUTION * (CENTER_GRID_ID - x/SIZE_OF_GRIDS);
-    y = MAP_RESOLUTION * (CENTER_GRID_ID - y/SIZE_OF_GRIDS);
-
-    int x_int = (int)x;
-    int y_int = (int)y;
-    x -= x_int;
-    y -= y_int;
-    x_int&=(MAP_RESOLUTION - 1);
-    y_int&=(MAP_RESOLUTION - 1);
-
-    if (isHole(x_int, y_int))
-        return INVALID_HEIGHT;
+    return getHeightFromGrid(m_uint16_V9, m_uint16_V8, x, y);
+}
 
-    int32 a, b, c;
-    uint16 *V9_h1_ptr = &m_uint16_V9[x_int*128 + x_int + y_int];
-    if (x+y < 1)
-    {
-        if (x > y)
-        {
-            // 1 triangle (h1, h2, h5 points)
-            int32 h1 = V9_h1_ptr[  0];
-            int32 h2 = V9_h1_ptr[129];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h2-h1;
-            b = h5-h1-h2;
-            c = h1;
-        }
-        else
-        {
-            // 2 triangle (h1, h3, h5 points)
-            int32 h1 = V9_h1_ptr[0];
-            int32 h3 = V9_h1_ptr[1];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h5 - h1 - h3;
-            b = h3 - h1;
-            c = h1;
-        }
-    }
+void GridMap::getHeights(std::span<Position const> points, std::span<float> heights) const
+{
+    ASSERT(points.size() == heights.size());
+
+    // resolve the storage format once for the whole batch instead of once per point
+    if (_gridGetHeight == &GridMap::getHeightFromFloat)
+        getHeightsFromGrid(m_V9, m_V8, points, heights);
+    else if (_gridGetHeight == &GridMap::getHeightFromUint16)
+        getHeightsFromGrid(m_uint16_V9, m_uint16_V8, points, heights);
+    else if (_gridGetHeight == &GridMap::getHeightFromUint8)
+        getHeightsFromGrid(m_uint8_V9, m_uint8_V8, points, heights);
     else
-    {
-        if (x > y)
-        {
-            // 3 triangle (h2, h4, h5 points)
-            int32 h2 = V9_h1_ptr[129];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h2 + h4 - h5;
-            b = h4 - h2;
-            c = h5 - h4;
-        }
-        else
-        {
-            // 4 triangle (h3, h4, h5 points)
-            int32 h3 = V9_h1_ptr[  1];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h4 - h3;
-            b = h3 + h4 - h5;
-            c = h5 - h4;
-        }
-    }
-    // Calculate height
-    return (float)((a * x) + (b * y) + c)*_gridIntHeightMultiplier + _gridHeight;
+        std::ranges::fill(heights, _gridHeight);
 }
 
 bool GridMap::isHole(int row, int col) const
@@ -22,9 +22,14 @@
 #include "MapDefines.h"
 #include "Optional.h"
 #include <cstdio>
+#include <memory>
+#include <span>
 
+class GridMapFileReader;
 struct LiquidData;
+struct Position;
 enum ZLiquidStatus : uint32;
+namespace boost::interprocess { class mapped_region; }
 namespace G3D { class Plane; }
 
 class TC_GAME_API GridMap
@@ -65,10 +70,16 @@ class TC_GAME_API GridMap
 
     uint8* _holes;
 
-    bool loadAreaData(FILE* in, uint32 offset, uint32 size);
-    bool loadHeightData(FILE* in, uint32 offset, uint32 size);
-    bool loadLiquidData(FILE* in, uint32 offset, uint32 size);
-    bool loadHolesData(FILE* in, uint32 offset, uint32 size);
+    // when set, data arrays may point directly into the mapped file
+    std::unique_ptr<boost::interprocess::mapped_region> _mappedFile;
+
+    template <typename T>
+    void freeData(T*& data);
+
+    bool loadAreaData(GridMapFileReader& reader, uint32 offset, uint32 size);
+    bool loadHeightData(GridMapFileReader& reader, uint32 offset, uint32 size);
+    bool loadLiquidData(GridMapFileReader& reader, uint32 offset, uint32 size);
+    bool loadHolesData(GridMapFileReader& reader, uint32 offset, uint32 size);
     bool isHole(int row, int col) const;
 
     // Get height functions and pointers
@@ -79,6 +90,11 @@ class TC_GAME_API GridMap
     float getHeightFromUint8(float x, float y) const;
     float getHeightFromFlat(float x, float y) const;
 
+    template <typename T>
+    float getHeightFromGrid(T const* V9, T const* V8, float x, float y) const;
+    template <typename T>
+    void getHeightsFromGrid(T const* V9, T const* V8, std::span<Position const> points, std::span<float> heights) const;
+
 public:
     GridMap();
     ~GridMap();
@@ -90,14 +106,18 @@ public:
         InvalidFile
     };
 
-    LoadResult loadData(char const* filename);
+    LoadResult loadData(char const* filename, bool useMemoryMapping = false);
     void unloadData();
 
     uint16 getArea(float x, float y) const;
     float getHeight(float x, float y) const { return (this->*_gridGetHeight)(x, y); }
+    void getHeights(std::span<Position const> points, std::span<float> heights) const;
     float getMinHeight(float x, float y) const;
     float getLiquidLevel(float x, float y) const;
     ZLiquidStatus GetLiquidStatus(float x, float y, float z, Optional<map_liquidHeaderTypeFlags> ReqLiquidType, LiquidData* data = nullptr, float collisionHeight = 2.03128f) const; // DEFAULT_COLLISION_HEIGHT in Object.h
+
+private:
+    LoadResult loadDataImpl(char const* filename, GridMapFileReader& reader);
 };
 
 #endif // TRINITY_GRID_MAP_H
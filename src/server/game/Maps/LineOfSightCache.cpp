@@ -0,0 +1,47 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSightCache.h"
+#include "Hash.h"
+
+std::size_t LineOfSightCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hash = 0;
+    Trinity::hash_combine(hash, key.Source);
+    Trinity::hash_combine(hash, key.Target);
+    Trinity::hash_combine(hash, key.Checks);
+    Trinity::hash_combine(hash, key.IgnoreFlags);
+    return hash;
+}
+
+std::optional<bool> LineOfSightCache::Find(ObjectGuid const& source, ObjectGuid const& target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, Ray const& ray)
+{
+    auto itr = _entries.find({ source, target, checks, ignoreFlags });
+    if (itr == _entries.end() || !(itr->second.CheckedRay == ray))
+    {
+        ++_misses;
+        return {};
+    }
+
+    ++_hits;
+    return itr->second.Result;
+}
+
+void LineOfSightCache::Store(ObjectGuid const& source, ObjectGuid const& target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, Ray const& ray, bool result)
+{
+    _entries.insert_or_assign(Key{ source, target, checks, ignoreFlags }, Entry{ ray, result });
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+#define TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+
+#include "ModelIgnoreFlags.h"
+#include "ObjectGuid.h"
+#include "SharedDefines.h"
+#include <optional>
+#include <unordered_map>
+
+/*
+ * Remembers results of WorldObject::IsWithinLOSInMap during a single Map::Update.
+ * Entries store the ray used for the check, moving either object changes the ray and makes the entry miss.
+ * Anything that changes collision (gameobject models, phases) must clear the whole cache.
+ */
+class TC_GAME_API LineOfSightCache
+{
+public:
+    struct Ray
+    {
+        float X1, Y1, Z1;
+        float X2, Y2, Z2;
+
+        friend bool operator==(Ray const&, Ray const&) = default;
+    };
+
+    std::optional<bool> Find(ObjectGuid const& source, ObjectGuid const& target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, Ray const& ray);
+    void Store(ObjectGuid const& source, ObjectGuid const& target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, Ray const& ray, bool result);
+    void Clear() { _entries.clear(); }
+
+    std::size_t GetSize() const { return _entries.size(); }
+    uint64 GetHits() const { return _hits; }
+    uint64 GetMisses() const { return _misses; }
+    void ResetCounters() { _hits = 0; _misses = 0; }
+
+private:
+    struct Key
+    {
+        ObjectGuid Source;
+        ObjectGuid Target;
+        LineOfSightChecks Checks;
+        VMAP::ModelIgnoreFlags IgnoreFlags;
+
+        friend bool operator==(Key const&, Key const&) = default;
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Entry
+    {
+        Ray CheckedRay;
+        bool Result;
+    };
+
+    std::unordered_map<Key, Entry, KeyHash> _entries;
+    uint64 _hits = 0;
+    uint64 _misses = 0;
+};
+
+#endif // TRINITYCORE_LINE_OF_SIGHT_CACHE_H
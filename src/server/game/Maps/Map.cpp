@@ -37,19 +37,24 @@
 #include "InstanceScript.h"
 #include "Log.h"
 #include "MapManager.h"
+#include "MapUpdateIslands.h"
 #include "MapUtils.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MotionMaster.h"
+#include "MoveSpline.h"
 #include "ObjectAccessor.h"
 #include "ObjectGridLoader.h"
 #include "ObjectMgr.h"
+#include "PathGenerator.h"
 #include "Pet.h"
 #include "PhasingHandler.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "SpellAuras.h"
 #include "TerrainMgr.h"
+#include "ThreadPool.h"
 #include "Transport.h"
 #include "VMapFactory.h"
 #include "VMapManager2.h"
@@ -90,6 +95,8 @@ struct RespawnInfoWithHandle : RespawnInfo
 
 Map::~Map()
 {
+    ReclaimUnloadedObjects(_unloadedObjects.size());
+
     // Delete all waiting spawns, else there will be a memory leak
     // This doesn't delete from database.
     UnloadAllRespawnInfos();
@@ -136,10 +143,10 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId, Difficulty SpawnMode) :
 _creatureToMoveLock(false), _gameObjectsToMoveLock(false), _dynamicObjectsToMoveLock(false), _areaTriggersToMoveLock(false),
 i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
 m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_mapRefIter(m_mapRefManager.end()),
-m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
+m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD), m_VisibilityNotifyNearDistance(0.0f), m_VisibilityNotifyMidDistance(0.0f),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
-i_gridExpiry(expiry), m_terrain(sTerrainMgr.LoadTerrain(id)), m_forceEnabledNavMeshFilterFlags(0), m_forceDisabledNavMeshFilterFlags(0),
-i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0), _vignetteUpdateTimer(5200, 5200)
+i_gridExpiry(expiry), _lastUpdateDuration(0), _islandUpdateInProgress(false), _collectingIslandCells(false), _batchingMovementRelay(false), m_terrain(sTerrainMgr.LoadTerrain(id)), m_forceEnabledNavMeshFilterFlags(0), m_forceDisabledNavMeshFilterFlags(0),
+i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0), _vignetteUpdateTimer(5200, 5200), _terrainPreloadTimer(1000, 1000)
 {
     for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
     {
@@ -157,6 +164,12 @@ i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _r
 
     _weatherUpdateTimer.SetInterval(time_t(1 * IN_MILLISECONDS));
 
+    if (uint32 islandUpdateThreads = sWorld->getIntConfig(CONFIG_MAP_UPDATE_ISLAND_THREADS); islandUpdateThreads && !Instanceable())
+    {
+        _updateIslands = std::make_unique<MapUpdateIslands>();
+        _islandUpdatePool = std::make_unique<Trinity::ThreadPool>(islandUpdateThreads);
+    }
+
     GetGuidSequenceGenerator(HighGuid::Transport).Set(sObjectMgr->GetGenerator<HighGuid::Transport>().GetNextAfterMaxUsed());
 
     _poolData = sPoolMgr->InitPoolsForMap(this);
@@ -173,6 +186,8 @@ void Map::InitVisibilityDistance()
     //init visibility for continents
     m_VisibleDistance = sWorld->getFloatConfig(CONFIG_MAX_VISIBILITY_DISTANCE_CONTINENT);
     m_VisibilityNotifyPeriod = sWorld->getIntConfig(CONFIG_VISIBILITY_NOTIFY_PERIOD_CONTINENT);
+    m_VisibilityNotifyNearDistance = sWorld->getFloatConfig(CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_CONTINENT);
+    m_VisibilityNotifyMidDistance = sWorld->getFloatConfig(CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_CONTINENT);
 }
 
 // Template specialization of utility methods
@@ -284,6 +299,10 @@ void Map::DeleteFromWorld(Player* player)
 //But object data is not loaded here
 void Map::EnsureGridCreated(GridCoord const& p)
 {
+    if (getNGrid(p.x_coord, p.y_coord))
+        return;
+
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
     if (!getNGrid(p.x_coord, p.y_coord))
     {
         TC_LOG_DEBUG("maps", "Creating grid[{}, {}] for map {} instance {}", p.x_coord, p.y_coord, GetId(), i_InstanceId);
@@ -304,6 +323,35 @@ void Map::EnsureGridCreated(GridCoord const& p)
     }
 }
 
+void Map::PreloadTerrainAhead(Player const* player)
+{
+    float speed;
+    if (!player->movespline->Finalized())
+        speed = player->movespline->Velocity();
+    else if (player->isMoving())
+        speed = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN);
+    else
+        return;
+
+    // sample both halfway and at full lookahead distance so fast mounts don't skip over a grid
+    float lookAheadDistance = speed * float(sWorld->getIntConfig(CONFIG_MAP_PRELOAD_LOOKAHEAD));
+    for (float distance : { lookAheadDistance * 0.5f, lookAheadDistance })
+    {
+        float x = player->GetPositionX() + distance * std::cos(player->GetOrientation());
+        float y = player->GetPositionY() + distance * std::sin(player->GetOrientation());
+        if (!Trinity::IsValidMapCoord(x, y))
+            continue;
+
+        GridCoord p = Trinity::ComputeGridCoord(x, y);
+        if (getNGrid(p.x_coord, p.y_coord))
+            continue;
+
+        int32 gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+        int32 gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+        sTerrainMgr.QueuePreload(m_terrain, gx, gy);
+    }
+}
+
 //Load NGrid and make it active
 void Map::EnsureGridLoadedForActiveObject(Cell const& cell, WorldObject const* object)
 {
@@ -330,6 +378,10 @@ bool Map::EnsureGridLoaded(Cell const& cell)
     NGridType *grid = getNGrid(cell.GridX(), cell.GridY());
 
     ASSERT(grid != nullptr);
+    if (isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
+        return false;
+
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
     if (!isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
     {
         TC_LOG_DEBUG("maps", "Loading grid[{}, {}] for map {} instance {}", cell.GridX(), cell.GridY(), GetId(), i_InstanceId);
@@ -445,30 +497,53 @@ void Map::SetWorldStateValue(int32 worldStateId, int32 value, bool hidden)
         return;
 
     itr->second = value;
+    _initialWorldStatesByArea.clear();
+
+    auto pendingItr = std::ranges::find(_pendingWorldStateUpdates, worldStateId, &std::pair<int32, bool>::first);
+    if (pendingItr != _pendingWorldStateUpdates.end())
+        pendingItr->second = hidden;
+    else
+        _pendingWorldStateUpdates.emplace_back(worldStateId, hidden);
 
-    WorldStateTemplate const* worldStateTemplate = sWorldStateMgr->GetWorldStateTemplate(worldStateId);
-    if (worldStateTemplate)
+    if (WorldStateTemplate const* worldStateTemplate = sWorldStateMgr->GetWorldStateTemplate(worldStateId))
         sScriptMgr->OnWorldStateValueChange(worldStateTemplate, oldValue, value, this);
+}
 
-    // Broadcast update to all players on the map
-    WorldPackets::WorldState::UpdateWorldState updateWorldState;
-    updateWorldState.VariableID = worldStateId;
-    updateWorldState.Value = value;
-    updateWorldState.Hidden = hidden;
-    updateWorldState.Write();
+WorldStateValueList const& Map::GetInitialWorldStatesForArea(uint32 areaId) const
+{
+    auto [itr, inserted] = _initialWorldStatesByArea.try_emplace(areaId);
+    if (inserted)
+    {
+        itr->second.reserve(_worldStateValues.size());
+        for (auto const& [worldStateId, value] : _worldStateValues)
+            if (WorldStateMgr::IsVisibleInArea(sWorldStateMgr->GetWorldStateTemplate(worldStateId), areaId))
+                itr->second.emplace_back(worldStateId, value);
+    }
 
-    for (MapReference const& mapReference : m_mapRefManager)
+    return itr->second;
+}
+
+void Map::SendWorldStateUpdates()
+{
+    if (_pendingWorldStateUpdates.empty())
+        return;
+
+    // values set multiple times since the last update are only sent once, with the latest value
+    for (auto const& [worldStateId, hidden] : _pendingWorldStateUpdates)
     {
-        if (worldStateTemplate && !worldStateTemplate->AreaIds.empty())
-        {
-            bool isInAllowedArea = std::any_of(worldStateTemplate->AreaIds.begin(), worldStateTemplate->AreaIds.end(),
-                [playerAreaId = mapReference.GetSource()->GetAreaId()](uint32 requiredAreaId) { return DB2Manager::IsInArea(playerAreaId, requiredAreaId); });
-            if (!isInAllowedArea)
-                continue;
-        }
+        WorldPackets::WorldState::UpdateWorldState updateWorldState;
+        updateWorldState.VariableID = worldStateId;
+        updateWorldState.Value = GetWorldStateValue(worldStateId);
+        updateWorldState.Hidden = hidden;
+        updateWorldState.Write();
 
-        mapReference.GetSource()->SendDirectMessage(updateWorldState.GetRawPacket());
+        WorldStateTemplate const* worldStateTemplate = sWorldStateMgr->GetWorldStateTemplate(worldStateId);
+        for (MapReference const& mapReference : m_mapRefManager)
+            if (WorldStateMgr::IsVisibleInArea(worldStateTemplate, mapReference.GetSource()->GetAreaId()))
+                mapReference.GetSource()->SendDirectMessage(updateWorldState.GetRawPacket());
     }
+
+    _pendingWorldStateUpdates.clear();
 }
 
 void Map::AddInfiniteAOIVignette(Vignettes::VignetteData* vignette)
@@ -503,6 +578,60 @@ void Map::RemoveInfiniteAOIVignette(Vignettes::VignetteData* vignette)
         SendToPlayers(vignetteUpdate.GetRawPacket());
 }
 
+void Map::SendInfiniteAOIVignetteUpdates()
+{
+    // vignettes without player requirements are written once and the same packet goes to every player on the map (or zone)
+    WorldPackets::Vignette::VignetteUpdate mapWideUpdate;
+    std::unordered_map<uint32 /*zoneId*/, WorldPackets::Vignette::VignetteUpdate> zoneWideUpdates;
+    std::vector<Vignettes::VignetteData const*> playerSpecificUpdates;
+
+    for (Vignettes::VignetteData* vignette : _infiniteAOIVignettes)
+    {
+        if (!vignette->NeedUpdate)
+            continue;
+
+        if (vignette->HasPlayerRequirements())
+            playerSpecificUpdates.push_back(vignette);
+        else if (vignette->Data->GetFlags().HasFlag(VignetteFlags::ZoneInfiniteAOI))
+            vignette->FillPacket(zoneWideUpdates[vignette->ZoneID].Updated);
+        else
+            vignette->FillPacket(mapWideUpdate.Updated);
+
+        vignette->NeedUpdate = false;
+    }
+
+    bool hasMapWideUpdate = !mapWideUpdate.Updated.IDs.empty();
+    if (!hasMapWideUpdate && zoneWideUpdates.empty() && playerSpecificUpdates.empty())
+        return;
+
+    if (hasMapWideUpdate)
+        mapWideUpdate.Write();
+
+    for (auto& [zoneId, zoneWideUpdate] : zoneWideUpdates)
+        zoneWideUpdate.Write();
+
+    for (MapReference const& ref : m_mapRefManager)
+    {
+        Player const* player = ref.GetSource();
+        if (hasMapWideUpdate)
+            player->SendDirectMessage(mapWideUpdate.GetRawPacket());
+
+        if (WorldPackets::Vignette::VignetteUpdate const* zoneWideUpdate = Trinity::Containers::MapGetValuePtr(zoneWideUpdates, player->GetZoneId()))
+            player->SendDirectMessage(zoneWideUpdate->GetRawPacket());
+
+        if (playerSpecificUpdates.empty())
+            continue;
+
+        WorldPackets::Vignette::VignetteUpdate vignetteUpdate;
+        for (Vignettes::VignetteData const* vignette : playerSpecificUpdates)
+            if (Vignettes::CanSee(player, *vignette))
+                vignette->FillPacket(vignetteUpdate.Updated);
+
+        if (!vignetteUpdate.Updated.IDs.empty())
+            player->SendDirectMessage(vignetteUpdate.Write());
+    }
+}
+
 template<class T>
 void Map::InitializeObject(T* /*obj*/) { }
 
@@ -521,6 +650,8 @@ void Map::InitializeObject(GameObject* obj)
 template<class T>
 bool Map::AddToMap(T* obj)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     /// @todo Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
     {
@@ -571,6 +702,8 @@ bool Map::AddToMap(T* obj)
 template<>
 bool Map::AddToMap(Transport* obj)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     //TODO: Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
         return true;
@@ -632,6 +765,12 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
 
             markCell(cell_id);
             CellCoord pair(x, y);
+            if (_collectingIslandCells)
+            {
+                _updateIslands->AddCell(pair);
+                continue;
+            }
+
             Cell cell(pair);
             cell.SetNoCreate();
             Visit(cell, gridVisitor);
@@ -640,6 +779,130 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
     }
 }
 
+void Map::UpdateIslands(uint32 diff)
+{
+    std::vector<MapUpdateIslands::Island> islands = _updateIslands->Build();
+
+    auto updateIsland = [this, diff](MapUpdateIslands::Island const& island)
+    {
+        TC_PROFILE_ZONE("Map::UpdateIslands island");
+        thread_local Trinity::FrameArena islandFrameArena;
+        Trinity::FrameArenaScope frameArenaScope(islandFrameArena);
+
+        Trinity::ObjectUpdater updater(diff);
+        TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> gridObjectUpdate(updater);
+        TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> worldObjectUpdate(updater);
+        for (CellCoord const& cellCoord : island)
+        {
+            Cell cell(cellCoord);
+            cell.SetNoCreate();
+            Visit(cell, gridObjectUpdate);
+            Visit(cell, worldObjectUpdate);
+        }
+    };
+
+    if (islands.size() < 2)
+    {
+        for (MapUpdateIslands::Island const& island : islands)
+            updateIsland(island);
+
+        return;
+    }
+
+    _islandUpdateInProgress = true;
+
+    // islands are sorted largest first, the map thread takes part and picks up the next free island like any pool thread
+    _islandUpdatePool->ParallelFor(islands.size(), islands.size() - 1, [&](std::size_t i) { updateIsland(islands[i]); });
+
+    _islandUpdateInProgress = false;
+}
+
+bool Map::IsAsyncPathfindingEnabled()
+{
+    return sMapMgr->GetPathRequestPool() != nullptr;
+}
+
+void Map::QueuePathRequest(std::shared_ptr<PathRequest> request)
+{
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+    _pathRequests.push_back(std::move(request));
+}
+
+void Map::QueueMovementRelay(Unit const* mover, Player const* skipped, WorldPacket&& packet)
+{
+    _movementRelay.push_back({ .Mover = mover->GetGUID(), .Skipped = skipped ? skipped->GetGUID() : ObjectGuid::Empty, .Packet = std::make_shared<WorldPacket const>(std::move(packet)) });
+}
+
+void Map::FlushMovementRelay()
+{
+    if (_movementRelay.empty())
+        return;
+
+    TC_PROFILE_ZONE("Map::FlushMovementRelay");
+
+    std::vector<MovementRelayPacket> packets;
+    packets.swap(_movementRelay);
+
+    // packets of the same mover keep the order they were received in
+    std::stable_sort(packets.begin(), packets.end(), [](MovementRelayPacket const& left, MovementRelayPacket const& right) { return left.Mover < right.Mover; });
+
+    for (auto begin = packets.begin(); begin != packets.end();)
+    {
+        ObjectGuid moverGuid = begin->Mover;
+        auto end = std::find_if(begin, packets.end(), [&](MovementRelayPacket const& packet) { return packet.Mover != moverGuid; });
+        std::span<MovementRelayPacket const> moverPackets(begin, end);
+        begin = end;
+
+        // movers that left this map since their packets were received
+        Unit* mover = nullptr;
+        if (moverGuid.IsPlayer())
+            mover = GetPlayer(moverGuid);
+        else if (moverGuid.IsPet())
+            mover = GetPet(moverGuid);
+        else
+            mover = GetCreature(moverGuid);
+
+        if (!mover || !mover->IsInWorld())
+            continue;
+
+        auto sendPackets = [moverPackets](Player const* player)
+        {
+            for (MovementRelayPacket const& packet : moverPackets)
+                if (packet.Skipped != player->GetGUID())
+                    player->SendDirectMessage(packet.Packet);
+        };
+
+        // same as Player::SendMessageToSet, a player moved by someone else receives its own movement
+        if (Player* player = mover->ToPlayer())
+            sendPackets(player);
+
+        Trinity::MessageDistDeliverer<decltype(sendPackets)> notifier(mover, sendPackets, mover->GetVisibilityRange());
+        notifier.Deliver(mover->GetVisibilityRange());
+    }
+}
+
+void Map::ProcessPathRequests()
+{
+    if (_pathRequests.empty())
+        return;
+
+    TC_PROFILE_ZONE("Map::ProcessPathRequests");
+
+    std::vector<std::shared_ptr<PathRequest>> requests;
+    requests.swap(_pathRequests);
+
+    // requesters that left this map since queueing have to request again, nothing on this map may be read from other threads
+    for (std::shared_ptr<PathRequest> const& request : requests)
+        if (WorldObject const* source = request->GetSource(); source && (!source->IsInWorld() || source->GetMap() != this))
+            request->Cancel();
+
+    // nothing modifies the map until all paths are calculated, pathfinding only reads terrain and leases its own navmesh queries
+    sMapMgr->GetPathRequestPool()->ParallelFor(requests.size(), sWorld->getIntConfig(CONFIG_MAP_PATHFINDING_THREADS), [&requests](std::size_t i)
+    {
+        requests[i]->Calculate();
+    });
+}
+
 void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 {
     // Nothing to do if no change
@@ -657,20 +920,34 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(uint32 t_diff)
 {
+    TC_PROFILE_ZONE("Map::Update");
+    Trinity::FrameArenaScope frameArenaScope(_frameArena);
+
+    _lineOfSightCache.Clear();
     _dynamicTree.update(t_diff);
     /// update worldsessions for existing players
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld())
+        TC_PROFILE_ZONE("Map::Update sessions");
+        _batchingMovementRelay = sWorld->getBoolConfig(CONFIG_MAP_BATCH_MOVEMENT_RELAY);
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
         {
-            //player->Update(t_diff);
-            WorldSession* session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(t_diff, updater);
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld())
+            {
+                //player->Update(t_diff);
+                WorldSession* session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(t_diff, updater);
+            }
         }
+        _batchingMovementRelay = false;
     }
 
+    FlushMovementRelay();
+
+    /// calculate paths requested during the previous update
+    ProcessPathRequests();
+
     /// process any due respawns
     if (_respawnCheckTimer <= t_diff)
     {
@@ -681,109 +958,121 @@ void Map::Update(uint32 t_diff)
     else
         _respawnCheckTimer -= t_diff;
 
-    /// update active cells around players and active objects
-    resetMarkedCells();
+    {
+        TC_PROFILE_ZONE("Map::Update objects");
+        /// update active cells around players and active objects
+        resetMarkedCells();
 
-    Trinity::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+        Trinity::ObjectUpdater updater(t_diff);
+        // for creature
+        TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+        // for pets
+        TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
 
-    // the player iterator is stored in the map object
-    // to make sure calls to Map::Remove don't invalidate it
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
-    {
-        Player* player = m_mapRefIter->GetSource();
+        // with islands enabled cells are only collected here and updated in UpdateIslands
+        _collectingIslandCells = _updateIslands != nullptr;
 
-        if (!player || !player->IsInWorld())
-            continue;
+        bool preloadTerrain = _terrainPreloadTimer.Update(t_diff) && sTerrainMgr.IsPreloadingEnabled();
 
-        // update players at tick
-        player->Update(t_diff);
+        // the player iterator is stored in the map object
+        // to make sure calls to Map::Remove don't invalidate it
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->GetSource();
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+            if (!player || !player->IsInWorld())
+                continue;
 
-        // If player is using far sight or mind vision, visit that object too
-        if (WorldObject* viewPoint = player->GetViewpoint())
-            VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+            // update players at tick
+            player->Update(t_diff);
 
-        // Handle updates for creatures in combat with player and are more than 60 yards away
-        if (player->IsInCombat())
-        {
-            std::vector<Unit*> toVisit;
-            for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
-                if (Creature* unit = pair.second->GetOther(player)->ToCreature())
-                    if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.push_back(unit);
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
-        }
+            if (preloadTerrain)
+                PreloadTerrainAhead(player);
 
-        { // Update any creatures that own auras the player has applications of
-            std::unordered_set<Unit*> toVisit;
-            for (std::pair<uint32, AuraApplication*> pair : player->GetAppliedAuras())
-            {
-                if (Unit* caster = pair.second->GetBase()->GetCaster())
-                    if (caster->GetTypeId() != TYPEID_PLAYER && !caster->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.insert(caster);
-            }
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
-        }
+            // everything visited on behalf of this player must be updated by the same thread
+            if (_collectingIslandCells)
+                _updateIslands->BeginGroup();
 
-        { // Update player's summons
-            std::vector<Unit*> toVisit;
+            VisitNearbyCellsOf(player, grid_object_update, world_object_update);
 
-            // Totems
-            for (ObjectGuid const& summonGuid : player->m_SummonSlot)
-                if (!summonGuid.IsEmpty())
-                    if (Creature* unit = GetCreature(summonGuid))
+            // If player is using far sight or mind vision, visit that object too
+            if (WorldObject* viewPoint = player->GetViewpoint())
+                VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+
+            // Handle updates for creatures in combat with player and are more than 60 yards away
+            if (player->IsInCombat())
+            {
+                Trinity::FrameVector<Unit*> toVisit;
+                for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
+                    if (Creature* unit = pair.second->GetOther(player)->ToCreature())
                         if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
                             toVisit.push_back(unit);
+                for (Unit* unit : toVisit)
+                    VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+            }
+
+            { // Update any creatures that own auras the player has applications of
+                Trinity::FrameUnorderedSet<Unit*> toVisit;
+                for (std::pair<uint32, AuraApplication*> pair : player->GetAppliedAuras())
+                {
+                    if (Unit* caster = pair.second->GetBase()->GetCaster())
+                        if (caster->GetTypeId() != TYPEID_PLAYER && !caster->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                            toVisit.insert(caster);
+                }
+                for (Unit* unit : toVisit)
+                    VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+            }
+
+            { // Update player's summons
+                Trinity::FrameVector<Unit*> toVisit;
+
+                // Totems
+                for (ObjectGuid const& summonGuid : player->m_SummonSlot)
+                    if (!summonGuid.IsEmpty())
+                        if (Creature* unit = GetCreature(summonGuid))
+                            if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                                toVisit.push_back(unit);
 
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+                for (Unit* unit : toVisit)
+                    VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+            }
         }
-    }
 
-    // non-player active objects, increasing iterator in the loop in case of object removal
-    for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
-    {
-        WorldObject* obj = *m_activeNonPlayersIter;
-        ++m_activeNonPlayersIter;
+        // non-player active objects, increasing iterator in the loop in case of object removal
+        for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+        {
+            WorldObject* obj = *m_activeNonPlayersIter;
+            ++m_activeNonPlayersIter;
 
-        if (!obj || !obj->IsInWorld())
-            continue;
+            if (!obj || !obj->IsInWorld())
+                continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
-    }
+            if (_collectingIslandCells)
+                _updateIslands->BeginGroup();
 
-    for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
-    {
-        WorldObject* obj = *_transportsUpdateIter;
-        ++_transportsUpdateIter;
-        obj->Update(t_diff);
+            VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+        }
+
+        if (_collectingIslandCells)
+        {
+            _collectingIslandCells = false;
+            UpdateIslands(t_diff);
+        }
     }
 
-    if (_vignetteUpdateTimer.Update(t_diff))
     {
-        for (Vignettes::VignetteData* vignette : _infiniteAOIVignettes)
+        TC_PROFILE_ZONE("Map::Update transports");
+        for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
         {
-            if (vignette->NeedUpdate)
-            {
-                WorldPackets::Vignette::VignetteUpdate vignetteUpdate;
-                vignette->FillPacket(vignetteUpdate.Updated);
-                vignetteUpdate.Write();
-                for (MapReference const& ref : m_mapRefManager)
-                    if (Vignettes::CanSee(ref.GetSource(), *vignette))
-                        ref.GetSource()->SendDirectMessage(vignetteUpdate.GetRawPacket());
-
-                vignette->NeedUpdate = false;
-            }
+            WorldObject* obj = *_transportsUpdateIter;
+            ++_transportsUpdateIter;
+            obj->Update(t_diff);
         }
     }
 
+    if (_vignetteUpdateTimer.Update(t_diff))
+        SendInfiniteAOIVignetteUpdates();
+
     SendObjectUpdates();
 
     ///- Process necessary scripts
@@ -816,6 +1105,11 @@ void Map::Update(uint32 t_diff)
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    SendWorldStateUpdates();
+
+    for (MapReference const& ref : m_mapRefManager)
+        ref.GetSource()->GetSession()->FlushSocketSendQueues();
+
     TC_METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         TC_METRIC_TAG("map_id", std::to_string(GetId())),
         TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
@@ -823,22 +1117,67 @@ void Map::Update(uint32 t_diff)
     TC_METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         TC_METRIC_TAG("map_id", std::to_string(GetId())),
         TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_los_cache_hits", _lineOfSightCache.GetHits(),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_los_cache_misses", _lineOfSightCache.GetMisses(),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _lineOfSightCache.ResetCounters();
 }
 
 struct ResetNotifier
 {
+    explicit ResetNotifier(std::unordered_set<WorldObject const*> const& deferredViewPoints) : i_deferredViewPoints(deferredViewPoints) { }
+
+    std::unordered_set<WorldObject const*> const& i_deferredViewPoints;
+
     template<class T>inline void resetNotify(GridRefManager<T> &m)
     {
         for (typename GridRefManager<T>::iterator iter=m.begin(); iter != m.end(); ++iter)
-            iter->GetSource()->ResetAllNotifies();
+            if (!i_deferredViewPoints.contains(iter->GetSource()))
+                iter->GetSource()->ResetAllNotifies();
     }
     template<class T> void Visit(GridRefManager<T> &) { }
     void Visit(CreatureMapType &m) { resetNotify<Creature>(m);}
     void Visit(PlayerMapType &m) { resetNotify<Player>(m);}
 };
 
+Optional<float> Map::GetVisibilityNotifySearchRadius(Player* player) const
+{
+    // only movement of the player itself may be handled by searching near it, moving further than the near distance
+    // or anything else changing visibility (phases, stealth, view point) requires searching the whole visibility distance
+    if (m_VisibilityNotifyNearDistance > 0.0f && player->m_seer == player && !player->isNeedNotify(NOTIFY_VISIBILITY_FULL_RANGE)
+        && player->GetExactDist2dSq(player->m_lastFullRangeVisibilityNotifyPosition) < m_VisibilityNotifyNearDistance * m_VisibilityNotifyNearDistance)
+    {
+        uint32 pass = ++player->m_visibilityNotifyPass;
+        if (pass % sWorld->getIntConfig(CONFIG_VISIBILITY_NOTIFY_FAR_INTERVAL))
+        {
+            if (m_VisibilityNotifyMidDistance > m_VisibilityNotifyNearDistance && !(pass % sWorld->getIntConfig(CONFIG_VISIBILITY_NOTIFY_MID_INTERVAL)))
+                return m_VisibilityNotifyMidDistance;
+
+            return m_VisibilityNotifyNearDistance;
+        }
+    }
+
+    player->m_visibilityNotifyPass = 0;
+    player->m_lastFullRangeVisibilityNotifyPosition.Relocate(player);
+    return {};
+}
+
 void Map::ProcessRelocationNotifies(const uint32 diff)
 {
+    TC_PROFILE_ZONE("Map::ProcessRelocationNotifies");
+    Trinity::VisibilityNotifyBudget budget;
+    if (uint32 maxPlayers = sWorld->getIntConfig(CONFIG_VISIBILITY_NOTIFY_MAX_PLAYERS))
+        budget.RemainingPlayers = maxPlayers;
+
+    // grids with deferred players are processed again by the next update
+    std::unordered_set<NGridType const*> deferredGrids;
+
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end(); ++i)
     {
         NGridType *grid = i->GetSource();
@@ -850,6 +1189,7 @@ void Map::ProcessRelocationNotifies(const uint32 diff)
         if (!grid->getGridInfoRef()->getRelocationTimer().TPassed())
             continue;
 
+        std::size_t deferredCount = budget.DeferredViewPoints.size();
         uint32 gx = grid->getX(), gy = grid->getY();
 
         CellCoord cell_min(gx*MAX_NUMBER_OF_CELLS, gy*MAX_NUMBER_OF_CELLS);
@@ -867,16 +1207,19 @@ void Map::ProcessRelocationNotifies(const uint32 diff)
                 Cell cell(pair);
                 cell.SetNoCreate();
 
-                Trinity::DelayedUnitRelocation cell_relocation(cell, pair, *this, MAX_VISIBILITY_DISTANCE);
+                Trinity::DelayedUnitRelocation cell_relocation(cell, pair, *this, MAX_VISIBILITY_DISTANCE, budget);
                 TypeContainerVisitor<Trinity::DelayedUnitRelocation, GridTypeMapContainer  > grid_object_relocation(cell_relocation);
                 TypeContainerVisitor<Trinity::DelayedUnitRelocation, WorldTypeMapContainer > world_object_relocation(cell_relocation);
                 Visit(cell, grid_object_relocation);
                 Visit(cell, world_object_relocation);
             }
         }
+
+        if (budget.DeferredViewPoints.size() != deferredCount)
+            deferredGrids.insert(grid);
     }
 
-    ResetNotifier reset;
+    ResetNotifier reset(budget.DeferredViewPoints);
     TypeContainerVisitor<ResetNotifier, GridTypeMapContainer >  grid_notifier(reset);
     TypeContainerVisitor<ResetNotifier, WorldTypeMapContainer > world_notifier(reset);
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end(); ++i)
@@ -889,7 +1232,8 @@ void Map::ProcessRelocationNotifies(const uint32 diff)
         if (!grid->getGridInfoRef()->getRelocationTimer().TPassed())
             continue;
 
-        grid->getGridInfoRef()->getRelocationTimer().TReset(diff, m_VisibilityNotifyPeriod);
+        if (!deferredGrids.contains(grid))
+            grid->getGridInfoRef()->getRelocationTimer().TReset(diff, m_VisibilityNotifyPeriod);
 
         uint32 gx = grid->getX(), gy = grid->getY();
 
@@ -943,6 +1287,8 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
 template<class T>
 void Map::RemoveFromMap(T *obj, bool remove)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     bool const inWorld = obj->IsInWorld() && obj->GetTypeId() >= TYPEID_UNIT && obj->GetTypeId() <= TYPEID_GAMEOBJECT;
     obj->RemoveFromWorld();
     if (obj->isActiveObject())
@@ -964,6 +1310,8 @@ void Map::RemoveFromMap(T *obj, bool remove)
 template<>
 void Map::RemoveFromMap(Transport* obj, bool remove)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     if (obj->IsInWorld())
     {
         obj->RemoveFromWorld();
@@ -1026,10 +1374,13 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
 {
     ASSERT(player);
 
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     Cell old_cell(player->GetPositionX(), player->GetPositionY());
     Cell new_cell(x, y);
 
     player->Relocate(x, y, z, orientation);
+    player->UpdateGridPosition();
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
 
@@ -1046,7 +1397,8 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     }
 
     player->UpdatePositionData();
-    player->UpdateObjectVisibility(false);
+    // unlike other visibility changes, movement may be handled by searching only near the player
+    player->AddToNotify(NOTIFY_VISIBILITY_CHANGED);
 }
 
 void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail)
@@ -1071,6 +1423,7 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     else
     {
         creature->Relocate(x, y, z, ang);
+        creature->UpdateGridPosition();
         if (creature->IsVehicle())
             creature->GetVehicleKit()->RelocatePassengers();
         creature->UpdateObjectVisibility(false);
@@ -1103,6 +1456,7 @@ void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float
     else
     {
         go->Relocate(x, y, z, orientation);
+        go->UpdateGridPosition();
         go->AfterRelocation();
         RemoveGameObjectFromMoveList(go);
     }
@@ -1132,6 +1486,7 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
     else
     {
         dynObj->Relocate(x, y, z, orientation);
+        dynObj->UpdateGridPosition();
         dynObj->UpdatePositionData();
         dynObj->UpdateObjectVisibility(false);
         RemoveDynamicObjectFromMoveList(dynObj);
@@ -1162,6 +1517,7 @@ void Map::AreaTriggerRelocation(AreaTrigger* at, float x, float y, float z, floa
     else
     {
         at->Relocate(x, y, z, orientation);
+        at->UpdateGridPosition();
         at->UpdateShape();
         at->UpdateObjectVisibility(false);
         RemoveAreaTriggerFromMoveList(at);
@@ -1172,6 +1528,8 @@ void Map::AreaTriggerRelocation(AreaTrigger* at, float x, float y, float z, floa
 
 void Map::AddCreatureToMoveList(Creature* c, float x, float y, float z, float ang)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     if (_creatureToMoveLock) //can this happen?
         return;
 
@@ -1191,6 +1549,8 @@ void Map::RemoveCreatureFromMoveList(Creature* c)
 
 void Map::AddGameObjectToMoveList(GameObject* go, float x, float y, float z, float ang)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     if (_gameObjectsToMoveLock) //can this happen?
         return;
 
@@ -1210,6 +1570,8 @@ void Map::RemoveGameObjectFromMoveList(GameObject* go)
 
 void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj, float x, float y, float z, float ang)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     if (_dynamicObjectsToMoveLock) //can this happen?
         return;
 
@@ -1229,6 +1591,8 @@ void Map::RemoveDynamicObjectFromMoveList(DynamicObject* dynObj)
 
 void Map::AddAreaTriggerToMoveList(AreaTrigger* at, float x, float y, float z, float ang)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     if (_areaTriggersToMoveLock) //can this happen?
         return;
 
@@ -1248,6 +1612,7 @@ void Map::RemoveAreaTriggerFromMoveList(AreaTrigger* at)
 
 void Map::MoveAllCreaturesInMoveList()
 {
+    TC_PROFILE_ZONE("Map::MoveAllCreaturesInMoveList");
     _creatureToMoveLock = true;
     for (std::vector<Creature*>::iterator itr = _creaturesToMove.begin(); itr != _creaturesToMove.end(); ++itr)
     {
@@ -1270,6 +1635,7 @@ void Map::MoveAllCreaturesInMoveList()
         {
             // update pos
             c->Relocate(c->_newPosition);
+            c->UpdateGridPosition();
             if (c->IsVehicle())
                 c->GetVehicleKit()->RelocatePassengers();
             //CreatureRelocationNotify(c, new_cell, new_cell.cellCoord());
@@ -1327,6 +1693,7 @@ void Map::MoveAllGameObjectsInMoveList()
         {
             // update pos
             go->Relocate(go->_newPosition);
+            go->UpdateGridPosition();
             go->AfterRelocation();
         }
         else
@@ -1371,6 +1738,7 @@ void Map::MoveAllDynamicObjectsInMoveList()
         {
             // update pos
             dynObj->Relocate(dynObj->_newPosition);
+            dynObj->UpdateGridPosition();
             dynObj->UpdatePositionData();
             dynObj->UpdateObjectVisibility(false);
         }
@@ -1410,6 +1778,7 @@ void Map::MoveAllAreaTriggersInMoveList()
         {
             // update pos
             at->Relocate(at->_newPosition);
+            at->UpdateGridPosition();
             at->UpdateShape();
             at->UpdateObjectVisibility(false);
         }
@@ -1532,6 +1901,7 @@ bool Map::CreatureRespawnRelocation(Creature* c, bool diffGridOnly)
     if (CreatureCellRelocation(c, resp_cell))
     {
         c->Relocate(resp_x, resp_y, resp_z, resp_o);
+        c->UpdateGridPosition();
         c->GetMotionMaster()->Initialize(); // prevent possible problems with default move generators
         //CreatureRelocationNotify(c, resp_cell, resp_cell.GetCellCoord());
         c->UpdatePositionData();
@@ -1560,6 +1930,7 @@ bool Map::GameObjectRespawnRelocation(GameObject* go, bool diffGridOnly)
     if (GameObjectCellRelocation(go, resp_cell))
     {
         go->Relocate(resp_x, resp_y, resp_z, resp_o);
+        go->UpdateGridPosition();
         go->UpdatePositionData();
         go->UpdateObjectVisibility(false);
         return true;
@@ -1617,7 +1988,9 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
         GetMultiPersonalPhaseTracker().UnloadGrid(ngrid);
 
         {
-            ObjectGridUnloader worker;
+            // deleting the objects of crowded grids is expensive, leave it to the following updates
+            bool reclaimLater = !unloadAll && sWorld->getIntConfig(CONFIG_MAP_GRID_UNLOAD_RECLAIM_OBJECTS);
+            ObjectGridUnloader worker(reclaimLater ? &_unloadedObjects : nullptr);
             TypeContainerVisitor<ObjectGridUnloader, GridTypeMapContainer> visitor(worker);
             ngrid.VisitAllGrids(visitor);
         }
@@ -1659,6 +2032,8 @@ void Map::UnloadAll()
     _creaturesToMove.clear();
     _gameObjectsToMove.clear();
 
+    ReclaimUnloadedObjects(_unloadedObjects.size());
+
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
     {
         NGridType &grid(*i->GetSource());
@@ -1726,6 +2101,11 @@ float Map::GetGridHeight(PhaseShift const& phaseShift, float x, float y)
     return m_terrain->GetGridHeight(phaseShift, GetId(), x, y);
 }
 
+void Map::GetGridHeights(PhaseShift const& phaseShift, std::span<Position const> points, std::span<float> heights)
+{
+    m_terrain->GetGridHeights(phaseShift, GetId(), points, heights);
+}
+
 float Map::GetStaticHeight(PhaseShift const& phaseShift, float x, float y, float z, bool checkVMap, float maxSearchDist)
 {
     return m_terrain->GetStaticHeight(phaseShift, GetId(), x, y, z, checkVMap, maxSearchDist);
@@ -1762,6 +2142,42 @@ bool Map::isInLineOfSight(PhaseShift const& phaseShift, float x1, float y1, floa
     return true;
 }
 
+std::optional<bool> Map::FindCachedLineOfSight(WorldObject const* source, WorldObject const* target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, LineOfSightCache::Ray const& ray)
+{
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+    return _lineOfSightCache.Find(source->GetGUID(), target->GetGUID(), checks, ignoreFlags, ray);
+}
+
+void Map::CacheLineOfSight(WorldObject const* source, WorldObject const* target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, LineOfSightCache::Ray const& ray, bool result)
+{
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+    _lineOfSightCache.Store(source->GetGUID(), target->GetGUID(), checks, ignoreFlags, ray, result);
+}
+
+void Map::InvalidateLineOfSightCache()
+{
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+    _lineOfSightCache.Clear();
+}
+
+void Map::isInLineOfSight(PhaseShift const& phaseShift, Position const& origin, std::span<Position const> targets, std::span<bool> results, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    ASSERT(targets.size() == results.size());
+    std::ranges::fill(results, true);
+
+    G3D::Vector3 start(origin.GetPositionX(), origin.GetPositionY(), origin.GetPositionZ());
+    Trinity::FrameVector<G3D::Vector3> ends;
+    ends.reserve(targets.size());
+    for (Position const& target : targets)
+        ends.emplace_back(target.GetPositionX(), target.GetPositionY(), target.GetPositionZ());
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+        VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(PhasingHandler::GetTerrainMapId(phaseShift, GetId(), m_terrain.get(), start.x, start.y),
+            start, ends, results, ignoreFlags);
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT))
+        _dynamicTree.isInLineOfSight(start, ends, results, phaseShift);
+}
+
 bool Map::getObjectHitPos(PhaseShift const& phaseShift, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -1943,10 +2359,44 @@ inline void Map::setNGrid(NGridType *grid, uint32 x, uint32 y)
     i_grids[x][y] = grid;
 }
 
+void Map::BuildObjectUpdatesInParallel(UpdateDataMapType& update_players)
+{
+    TC_PROFILE_ZONE("Map::BuildObjectUpdatesInParallel");
+
+    std::vector<Object*> objects;
+    objects.reserve(_updateObjects.size());
+    for (Object* obj : _updateObjects)
+    {
+        ASSERT(obj->IsInWorld());
+        objects.push_back(obj);
+    }
+
+    _updateObjects.clear();
+
+    // building updates only reads the grids and visible players and clears the changes mask of the object itself
+    // every chunk is built into its own map so blocks can be merged in a fixed order afterwards
+    std::size_t chunkCount = std::min<std::size_t>(objects.size(), sWorld->getIntConfig(CONFIG_MAP_OBJECT_UPDATE_THREADS) + 1);
+    std::vector<UpdateDataMapType> chunkUpdates(chunkCount);
+    sMapMgr->GetObjectUpdatePool()->ParallelFor(chunkCount, chunkCount - 1, [&objects, &chunkUpdates, chunkCount](std::size_t chunk)
+    {
+        std::size_t end = objects.size() * (chunk + 1) / chunkCount;
+        for (std::size_t i = objects.size() * chunk / chunkCount; i < end; ++i)
+            objects[i]->BuildUpdate(chunkUpdates[chunk]);
+    });
+
+    for (UpdateDataMapType& chunk : chunkUpdates)
+        for (auto& [player, updateData] : chunk)
+            update_players.try_emplace(player, player->GetMapId()).first->second.Merge(std::move(updateData));
+}
+
 void Map::SendObjectUpdates()
 {
+    TC_PROFILE_ZONE("Map::SendObjectUpdates");
     UpdateDataMapType update_players;
 
+    if (sMapMgr->GetObjectUpdatePool() && _updateObjects.size() >= sWorld->getIntConfig(CONFIG_MAP_OBJECT_UPDATE_MIN_OBJECTS))
+        BuildObjectUpdatesInParallel(update_players);
+
     while (!_updateObjects.empty())
     {
         Object* obj = *_updateObjects.begin();
@@ -2073,6 +2523,8 @@ size_t Map::DespawnAll(SpawnObjectType type, ObjectGuid::LowType spawnId)
 
 bool Map::AddRespawnInfo(RespawnInfo const& info)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     if (!info.spawnId)
     {
         TC_LOG_ERROR("maps", "Attempt to insert respawn info for zero spawn id (type {})", uint32(info.type));
@@ -2143,6 +2595,8 @@ void Map::UnloadAllRespawnInfos() // delete everything from memory
 
 void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     // Delete from all relevant containers to ensure consistency
     ASSERT(info);
 
@@ -2207,7 +2661,10 @@ void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gr
 
 void Map::ProcessRespawns()
 {
+    TC_PROFILE_ZONE("Map::ProcessRespawns");
     time_t now = GameTime::GetGameTime();
+    // all respawn row changes of this check are written in one transaction instead of one statement per entry
+    CharacterDatabaseTransaction dbTrans = Instanceable() ? nullptr : CharacterDatabase.BeginTransaction();
     while (!_respawnTimes->empty())
     {
         RespawnInfoWithHandle* next = _respawnTimes->top();
@@ -2224,7 +2681,7 @@ void Map::ProcessRespawns()
             sPoolMgr->UpdatePool(GetPoolData(), poolId, next->type, next->spawnId);
 
             // step 3: get rid of the actual entry
-            RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
+            RemoveRespawnTime(next->type, next->spawnId, dbTrans, true);
             delete next;
         }
         else if (CheckRespawn(next)) // see if we're allowed to respawn
@@ -2237,23 +2694,26 @@ void Map::ProcessRespawns()
             DoRespawn(next->type, next->spawnId, next->gridId);
 
             // step 3: get rid of the actual entry
-            RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
+            RemoveRespawnTime(next->type, next->spawnId, dbTrans, true);
             delete next;
         }
         else if (!next->respawnTime)
         { // just remove this respawn entry without rescheduling
             _respawnTimes->pop();
             ASSERT_NOTNULL(GetRespawnMapForType(next->type))->erase(next->spawnId);
-            RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
+            RemoveRespawnTime(next->type, next->spawnId, dbTrans, true);
             delete next;
         }
         else
         { // new respawn time, update heap position
             ASSERT(now < next->respawnTime); // infinite loop guard
             _respawnTimes->decrease(next->handle);
-            SaveRespawnInfoDB(*next);
+            SaveRespawnInfoDB(*next, dbTrans);
         }
     }
+
+    if (dbTrans && dbTrans->GetSize())
+        CharacterDatabase.CommitTransaction(dbTrans);
 }
 
 void Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::LowType spawnId, uint32& respawnDelay, uint32 mode) const
@@ -2521,6 +2981,7 @@ void Map::UpdateSpawnGroupConditions()
 
 ObjectGuidGenerator& Map::GetGuidSequenceGenerator(HighGuid high)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
     return _guidGenerators.try_emplace(high, high).first->second;
 }
 
@@ -2542,6 +3003,9 @@ void Map::DelayedUpdate(uint32 t_diff)
 
     RemoveAllObjectsInRemoveList();
 
+    // before grid states are updated, objects of grids unloaded now are deleted starting next update
+    ReclaimUnloadedObjects(sWorld->getIntConfig(CONFIG_MAP_GRID_UNLOAD_RECLAIM_OBJECTS));
+
     // Don't unload grids if it's battleground, since we may have manually added GOs, creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattlegroundOrArena())
@@ -2561,6 +3025,8 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 {
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     obj->SetDestroyedObject(true);
     obj->CleanupsBeforeDelete(false);                            // remove or simplify at least cross referenced links
 
@@ -2575,6 +3041,8 @@ void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
     if (obj->GetTypeId() != TYPEID_UNIT)
         return;
 
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     std::map<WorldObject*, bool>::iterator itr = i_objectsToSwitch.find(obj);
     if (itr == i_objectsToSwitch.end())
         i_objectsToSwitch.insert(itr, std::make_pair(obj, on));
@@ -2584,6 +3052,19 @@ void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
         ABORT();
 }
 
+void Map::ReclaimUnloadedObjects(std::size_t maxCount)
+{
+    if (!maxCount)
+        maxCount = _unloadedObjects.size();
+
+    // objects are already out of world and grid, nothing can reach them anymore
+    std::size_t count = std::min(maxCount, _unloadedObjects.size());
+    for (std::size_t i = _unloadedObjects.size() - count; i < _unloadedObjects.size(); ++i)
+        delete _unloadedObjects[i];
+
+    _unloadedObjects.resize(_unloadedObjects.size() - count);
+}
+
 void Map::RemoveAllObjectsInRemoveList()
 {
     while (!i_objectsToSwitch.empty())
@@ -2712,16 +3193,20 @@ bool Map::ActiveObjectsNearGrid(NGridType const& ngrid) const
 
 void Map::AddWorldObject(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
     i_worldObjects.insert(obj);
 }
 
 void Map::RemoveWorldObject(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
     i_worldObjects.erase(obj);
 }
 
 void Map::AddToActive(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     m_activeNonPlayers.insert(obj);
 
     Optional<Position> respawnLocation;
@@ -2761,6 +3246,8 @@ void Map::AddToActive(WorldObject* obj)
 
 void Map::RemoveFromActive(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     // Map::Update for active object in proccess
     if (m_activeNonPlayersIter != m_activeNonPlayers.end())
     {
@@ -2831,7 +3318,8 @@ template TC_GAME_API void Map::RemoveFromMap(Conversation*, bool);
 InstanceMap::InstanceMap(uint32 id, time_t expiry, uint32 InstanceId, Difficulty SpawnMode, TeamId InstanceTeam, InstanceLock* instanceLock,
     Optional<uint32> lfgDungeonsId)
   : Map(id, expiry, InstanceId, SpawnMode),
-    i_data(nullptr), i_script_id(0), i_instanceLock(instanceLock), i_lfgDungeonsId(lfgDungeonsId)
+    i_data(nullptr), i_script_id(0), i_instanceLock(instanceLock), i_lfgDungeonsId(lfgDungeonsId),
+    _hibernateTimer(sWorld->getIntConfig(CONFIG_INSTANCE_HIBERNATE_DELAY)), _hibernated(false)
 {
     //lets initialize visibility distance for dungeons
     InstanceMap::InitVisibilityDistance();
@@ -2863,6 +3351,8 @@ void InstanceMap::InitVisibilityDistance()
     //init visibility distance for instances
     m_VisibleDistance = sWorld->getFloatConfig(CONFIG_MAX_VISIBILITY_DISTANCE_INSTANCE);
     m_VisibilityNotifyPeriod = sWorld->getIntConfig(CONFIG_VISIBILITY_NOTIFY_PERIOD_INSTANCE);
+    m_VisibilityNotifyNearDistance = sWorld->getFloatConfig(CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_INSTANCE);
+    m_VisibilityNotifyMidDistance = sWorld->getFloatConfig(CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_INSTANCE);
 }
 
 /*
@@ -2936,6 +3426,8 @@ bool InstanceMap::AddPlayerToMap(Player* player, bool initPlayer /*= true*/)
     TC_LOG_DEBUG("maps", "MAP: Player '{}' entered instance '{}' of map '{}'", player->GetName(), GetInstanceId(), GetMapName());
     // initialize unload state
     m_unloadTimer = 0;
+    _hibernateTimer = 0;
+    _hibernated = false;
 
     // this will acquire the same mutex so it cannot be in the previous block
     Map::AddPlayerToMap(player, initPlayer);
@@ -2967,6 +3459,17 @@ void InstanceMap::Update(uint32 t_diff)
         Reset(InstanceResetMethod::Expire);
         i_instanceExpireEvent = sInstanceLockMgr.GetNextResetTime({ GetEntry(), GetMapDifficulty() });
     }
+
+    if (_hibernateTimer && !HavePlayers())
+    {
+        if (_hibernateTimer <= t_diff)
+        {
+            _hibernateTimer = 0;
+            Hibernate();
+        }
+        else
+            _hibernateTimer -= t_diff;
+    }
 }
 
 void InstanceMap::RemovePlayerFromMap(Player* player, bool remove)
@@ -2978,7 +3481,10 @@ void InstanceMap::RemovePlayerFromMap(Player* player, bool remove)
 
     // if last player set unload timer
     if (!m_unloadTimer && m_mapRefManager.size() == 1)
+    {
         m_unloadTimer = (i_instanceLock && i_instanceLock->IsExpired()) ? MIN_UNLOAD_DELAY : std::max(sWorld->getIntConfig(CONFIG_INSTANCE_UNLOAD_DELAY), (uint32)MIN_UNLOAD_DELAY);
+        _hibernateTimer = sWorld->getIntConfig(CONFIG_INSTANCE_HIBERNATE_DELAY);
+    }
 
     if (i_scenario)
         i_scenario->OnPlayerExit(player);
@@ -2986,6 +3492,62 @@ void InstanceMap::RemovePlayerFromMap(Player* player, bool remove)
     Map::RemovePlayerFromMap(player, remove);
 }
 
+void InstanceMap::Hibernate()
+{
+    // only spawns can be restored, everything else is recreated by scripts when the grids load again
+    for (auto const& [spawnId, creature] : GetCreatureBySpawnIdStore())
+    {
+        if (!creature->IsAlive())
+            continue;
+
+        CreatureData const* data = creature->GetCreatureData();
+        bool damaged = creature->GetHealth() < creature->GetMaxHealth();
+        bool moved = data && data->spawnPoint.GetExactDist(creature) > 0.5f;
+        if (damaged || moved)
+            _hibernatedCreatures[spawnId] = { .Health = creature->GetHealth(), .Pos = creature->GetPosition() };
+    }
+
+    uint32 unloadedGrids = 0;
+    uint32 remainingGrids = 0;
+    for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
+    {
+        NGridType& grid(*i->GetSource());
+        ++i;
+        if (!grid.getUnloadLock() && UnloadGrid(grid, false))
+            ++unloadedGrids;
+        else
+            ++remainingGrids;
+    }
+
+    // creatures in grids that could not be unloaded keep their live state
+    for (auto const& [spawnId, creature] : GetCreatureBySpawnIdStore())
+        _hibernatedCreatures.erase(spawnId);
+
+    _hibernated = true;
+
+    TC_LOG_DEBUG("maps", "MAP: Instance {} of map '{}' hibernated, unloaded {} grids ({} kept loaded), saved state of {} creatures",
+        GetInstanceId(), GetMapName(), unloadedGrids, remainingGrids, _hibernatedCreatures.size());
+}
+
+void InstanceMap::RestoreHibernatedState(Creature* creature)
+{
+    auto itr = _hibernatedCreatures.find(creature->GetSpawnId());
+    if (itr == _hibernatedCreatures.end())
+        return;
+
+    HibernatedCreatureState const& state = itr->second;
+    if (creature->IsAlive())
+    {
+        creature->SetHealth(std::min(state.Health, creature->GetMaxHealth()));
+
+        // the grid loader adds the creature to the cell of its spawn point
+        if (Trinity::ComputeCellCoord(state.Pos.GetPositionX(), state.Pos.GetPositionY()) == Trinity::ComputeCellCoord(creature->GetPositionX(), creature->GetPositionY()))
+            creature->Relocate(state.Pos);
+    }
+
+    _hibernatedCreatures.erase(itr);
+}
+
 void InstanceMap::CreateInstanceData()
 {
     if (i_data != nullptr)
@@ -3127,10 +3689,16 @@ void InstanceMap::UpdateInstanceLock(UpdateBossStateSaveDataEvent const& updateS
 
         MapDb2Entries entries{ GetEntry(), GetMapDifficulty() };
 
+        // without encounter locks every lock stores the full instance data, serialize it only once
+        bool usesEncounterLocks = GetMapDifficulty()->IsUsingEncounterLocks();
+        std::string saveData;
+        if (entries.IsInstanceIdBound() || !usesEncounterLocks)
+            saveData = i_data->GetSaveData();
+
         CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
         if (entries.IsInstanceIdBound())
-            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), i_data->GetSaveData(),
+            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), saveData,
                 instanceCompletedEncounters, updateSaveDataEvent.DungeonEncounter, i_data->GetEntranceLocationForCompletedEncounters(instanceCompletedEncounters)));
 
         for (MapReference& mapReference : m_mapRefManager)
@@ -3152,7 +3720,7 @@ void InstanceMap::UpdateInstanceLock(UpdateBossStateSaveDataEvent const& updateS
             bool isNewLock = !playerLock || playerLock->IsNew() || playerLock->IsExpired();
 
             InstanceLock const* newLock = sInstanceLockMgr.UpdateInstanceLockForPlayer(trans, player->GetGUID(), entries,
-                InstanceLockUpdateEvent(GetInstanceId(), i_data->UpdateBossStateSaveData(oldData ? *oldData : "", updateSaveDataEvent),
+                InstanceLockUpdateEvent(GetInstanceId(), usesEncounterLocks ? i_data->UpdateBossStateSaveData(oldData ? *oldData : "", updateSaveDataEvent) : saveData,
                     instanceCompletedEncounters, updateSaveDataEvent.DungeonEncounter, i_data->GetEntranceLocationForCompletedEncounters(playerCompletedEncounters)));
 
             if (isNewLock)
@@ -3177,10 +3745,15 @@ void InstanceMap::UpdateInstanceLock(UpdateAdditionalSaveDataEvent const& update
 
         MapDb2Entries entries{ GetEntry(), GetMapDifficulty() };
 
+        bool usesEncounterLocks = GetMapDifficulty()->IsUsingEncounterLocks();
+        std::string saveData;
+        if (entries.IsInstanceIdBound() || !usesEncounterLocks)
+            saveData = i_data->GetSaveData();
+
         CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
         if (entries.IsInstanceIdBound())
-            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), i_data->GetSaveData(),
+            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), saveData,
                 instanceCompletedEncounters, nullptr, {}));
 
         for (MapReference& mapReference : m_mapRefManager)
@@ -3198,7 +3771,7 @@ void InstanceMap::UpdateInstanceLock(UpdateAdditionalSaveDataEvent const& update
             bool isNewLock = !playerLock || playerLock->IsNew() || playerLock->IsExpired();
 
             InstanceLock const* newLock = sInstanceLockMgr.UpdateInstanceLockForPlayer(trans, player->GetGUID(), entries,
-                InstanceLockUpdateEvent(GetInstanceId(), i_data->UpdateAdditionalSaveData(oldData ? *oldData : "", updateSaveDataEvent),
+                InstanceLockUpdateEvent(GetInstanceId(), usesEncounterLocks ? i_data->UpdateAdditionalSaveData(oldData ? *oldData : "", updateSaveDataEvent) : saveData,
                     instanceCompletedEncounters, nullptr, {}));
 
             if (isNewLock)
@@ -3425,6 +3998,8 @@ void BattlegroundMap::InitVisibilityDistance()
     //init visibility distance for BG/Arenas
     m_VisibleDistance        = sWorld->getFloatConfig(IsBattleArena() ? CONFIG_MAX_VISIBILITY_DISTANCE_ARENA : CONFIG_MAX_VISIBILITY_DISTANCE_BATTLEGROUND);
     m_VisibilityNotifyPeriod = sWorld->getIntConfig(IsBattleArena() ? CONFIG_VISIBILITY_NOTIFY_PERIOD_ARENA : CONFIG_VISIBILITY_NOTIFY_PERIOD_BATTLEGROUND);
+    m_VisibilityNotifyNearDistance = sWorld->getFloatConfig(IsBattleArena() ? CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_ARENA : CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_BATTLEGROUND);
+    m_VisibilityNotifyMidDistance = sWorld->getFloatConfig(IsBattleArena() ? CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_ARENA : CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_BATTLEGROUND);
 }
 
 std::string const& BattlegroundMap::GetScriptName() const
@@ -3803,6 +4378,8 @@ void Map::DeleteCorpseData()
 
 void Map::AddCorpse(Corpse* corpse)
 {
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     corpse->SetMap(this);
 
     _corpsesByCell[corpse->GetCellCoord().GetId()].insert(corpse);
@@ -3816,6 +4393,8 @@ void Map::RemoveCorpse(Corpse* corpse)
 {
     ASSERT(corpse);
 
+    std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
+
     corpse->UpdateObjectVisibilityOnDestroy();
     if (corpse->IsInGrid())
         RemoveFromMap(corpse, false);
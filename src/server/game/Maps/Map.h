@@ -21,11 +21,14 @@
 #include "Define.h"
 
 #include "Cell.h"
+#include "CpuTime.h"
 #include "DatabaseEnvFwd.h"
 #include "DynamicTree.h"
+#include "FrameArena.h"
 #include "GridDefines.h"
 #include "GridRefManager.h"
 #include "GroupInstanceReference.h"
+#include "LineOfSightCache.h"
 #include "MapDefines.h"
 #include "MapReference.h"
 #include "MapRefManager.h"
@@ -42,7 +45,10 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <span>
+#include <unordered_map>
 #include <unordered_set>
 
 class Battleground;
@@ -55,13 +61,16 @@ class InstanceLock;
 class InstanceMap;
 class InstanceScript;
 class InstanceScenario;
+class MapUpdateIslands;
 class Object;
+class PathRequest;
 class PhaseShift;
 class Player;
 class SpawnedPoolData;
 class TempSummon;
 class TerrainInfo;
 class Unit;
+class UpdateData;
 class Weather;
 class WorldObject;
 class WorldPacket;
@@ -80,7 +89,7 @@ enum Difficulty : uint8;
 enum WeatherState : uint32;
 enum class ItemContext : uint8;
 
-namespace Trinity { struct ObjectUpdater; }
+namespace Trinity { class ThreadPool; struct ObjectUpdater; }
 namespace Vignettes { struct VignetteData; }
 namespace VMAP { enum class ModelIgnoreFlags : uint32; }
 
@@ -187,7 +196,7 @@ inline bool CompareRespawnInfo::operator()(RespawnInfo const* a, RespawnInfo con
 template <typename ObjectType>
 struct MapStoredObjectsUnorderedMap
 {
-    using Container = std::unordered_map<ObjectGuid, ObjectType*>;
+    using Container = Trinity::Containers::FlatHashMap<ObjectGuid, ObjectType*>;
     using KeyType = ObjectGuid;
     using ValueType = ObjectType*;
 
@@ -250,9 +259,33 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
         virtual void Update(uint32);
 
+        // Time spent in the last Update made by MapUpdater, used as cost estimate when scheduling the next one
+        Microseconds GetLastUpdateDuration() const { return _lastUpdateDuration; }
+        void SetLastUpdateDuration(Microseconds duration) { _lastUpdateDuration = duration; }
+        Trinity::CpuTimeCounter& GetCpuTimeCounter() { return _cpuTime; }
+
+        // Map wide containers must be modified under this lock while UpdateIslands runs on several threads, returns an empty lock otherwise
+        std::unique_lock<std::recursive_mutex> LockForIslandUpdate()
+        {
+            if (!_islandUpdateInProgress)
+                return {};
+
+            return std::unique_lock<std::recursive_mutex>(_islandUpdateLock);
+        }
+
+        // Paths queued during an update are calculated in parallel before objects are updated again
+        static bool IsAsyncPathfindingEnabled();
+        void QueuePathRequest(std::shared_ptr<PathRequest> request);
+
+        // Movement received while sessions are updated is relayed after all sessions were updated, one receiver search per mover
+        bool IsMovementRelayBatched() const { return _batchingMovementRelay; }
+        void QueueMovementRelay(Unit const* mover, Player const* skipped, WorldPacket&& packet);
+
         float GetVisibilityRange() const { return m_VisibleDistance; }
         //function for setting up visibility distance for maps on per-type/per-Id basis
         virtual void InitVisibilityDistance();
+        // radius searched by the next relocation visibility update of player, nullopt for the whole visibility distance
+        Optional<float> GetVisibilityNotifySearchRadius(Player* player) const;
 
         void PlayerRelocation(Player*, float x, float y, float z, float orientation);
         void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail = true);
@@ -319,6 +352,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         float GetMinHeight(PhaseShift const& phaseShift, float x, float y);
         float GetGridHeight(PhaseShift const& phaseShift, float x, float y);
+        void GetGridHeights(PhaseShift const& phaseShift, std::span<Position const> points, std::span<float> heights);
         float GetStaticHeight(PhaseShift const& phaseShift, float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH);
         float GetStaticHeight(PhaseShift const& phaseShift, Position const& pos, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) { return GetStaticHeight(phaseShift, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), checkVMap, maxSearchDist); }
         float GetHeight(PhaseShift const& phaseShift, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) { return std::max<float>(GetStaticHeight(phaseShift, x, y, z, vmap, maxSearchDist), GetGameObjectFloor(phaseShift, x, y, z, maxSearchDist)); }
@@ -335,6 +369,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void MoveAllDynamicObjectsInMoveList();
         void MoveAllAreaTriggersInMoveList();
         void RemoveAllObjectsInRemoveList();
+        void ReclaimUnloadedObjects(std::size_t maxCount);
         virtual void RemoveAllPlayers();
 
         // used only in MoveAllCreaturesInMoveList and ObjectGridUnloader
@@ -492,9 +527,15 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         BattlegroundMap const* ToBattlegroundMap() const { if (IsBattlegroundOrArena()) return reinterpret_cast<BattlegroundMap const*>(this); return nullptr; }
 
         bool isInLineOfSight(PhaseShift const& phaseShift, float x1, float y1, float z1, float x2, float y2, float z2, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        // sets results[i] to whether targets[i] is in line of sight of origin, cheaper than one call per target for many targets around the same origin
+        void isInLineOfSight(PhaseShift const& phaseShift, Position const& origin, std::span<Position const> targets, std::span<bool> results, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        // results of WorldObject::IsWithinLOSInMap during the current Update, see LineOfSightCache
+        std::optional<bool> FindCachedLineOfSight(WorldObject const* source, WorldObject const* target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, LineOfSightCache::Ray const& ray);
+        void CacheLineOfSight(WorldObject const* source, WorldObject const* target, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, LineOfSightCache::Ray const& ray, bool result);
+        void InvalidateLineOfSightCache();
         void Balance() { _dynamicTree.balance(); }
-        void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); }
-        void InsertGameObjectModel(GameObjectModel const& model) { _dynamicTree.insert(model); }
+        void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); InvalidateLineOfSightCache(); }
+        void InsertGameObjectModel(GameObjectModel const& model) { _dynamicTree.insert(model); InvalidateLineOfSightCache(); }
         bool ContainsGameObjectModel(GameObjectModel const& model) const { return _dynamicTree.contains(model);}
         float GetGameObjectFloor(PhaseShift const& phaseShift, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
         {
@@ -565,11 +606,13 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         void AddUpdateObject(Object* obj)
         {
+            std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
             _updateObjects.insert(obj);
         }
 
         void RemoveUpdateObject(Object* obj)
         {
+            std::unique_lock<std::recursive_mutex> lock = LockForIslandUpdate();
             _updateObjects.erase(obj);
         }
 
@@ -618,6 +661,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         bool IsGridLoaded(GridCoord const&) const;
         void EnsureGridCreated(GridCoord const&);
+        void PreloadTerrainAhead(Player const* player);
         bool EnsureGridLoaded(Cell const&);
         void EnsureGridLoadedForActiveObject(Cell const&, WorldObject const* object);
 
@@ -636,6 +680,11 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void ScriptsProcess();
 
         void SendObjectUpdates();
+        void BuildObjectUpdatesInParallel(std::unordered_map<Player*, UpdateData>& update_players);
+
+        void UpdateIslands(uint32 diff);
+        void ProcessPathRequests();
+        void FlushMovementRelay();
 
     protected:
         virtual void LoadGridObjects(NGridType* grid, Cell const& cell);
@@ -652,6 +701,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         MapRefManager::iterator m_mapRefIter;
 
         int32 m_VisibilityNotifyPeriod;
+        float m_VisibilityNotifyNearDistance;
+        float m_VisibilityNotifyMidDistance;
 
         typedef std::set<WorldObject*> ActiveNonPlayers;
         ActiveNonPlayers m_activeNonPlayers;
@@ -674,6 +725,31 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         GameObject* _FindGameObject(WorldObject* pWorldObject, ObjectGuid::LowType guid) const;
 
         time_t i_gridExpiry;
+        Microseconds _lastUpdateDuration;
+        Trinity::CpuTimeCounter _cpuTime;
+
+        // temporaries of a single Update, see Trinity::FrameAllocator
+        Trinity::FrameArena _frameArena;
+
+        // opt-in parallel update of independent regions of continents, see MapUpdateIslands
+        std::unique_ptr<MapUpdateIslands> _updateIslands;
+        std::unique_ptr<Trinity::ThreadPool> _islandUpdatePool;
+        std::recursive_mutex _islandUpdateLock;
+        bool _islandUpdateInProgress;
+        bool _collectingIslandCells;
+
+        std::vector<std::shared_ptr<PathRequest>> _pathRequests;
+        LineOfSightCache _lineOfSightCache;
+
+        struct MovementRelayPacket
+        {
+            ObjectGuid Mover;
+            ObjectGuid Skipped;
+            std::shared_ptr<WorldPacket const> Packet;
+        };
+
+        std::vector<MovementRelayPacket> _movementRelay;
+        bool _batchingMovementRelay;
 
         std::shared_ptr<TerrainInfo> m_terrain;
         uint16 m_forceEnabledNavMeshFilterFlags;
@@ -688,6 +764,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         bool i_scriptLock;
         std::set<WorldObject*> i_objectsToRemove;
+        std::vector<WorldObject*> _unloadedObjects;         // removed from unloaded grids, deleted by ReclaimUnloadedObjects
         std::map<WorldObject*, bool> i_objectsToSwitch;
         std::set<WorldObject*> i_worldObjects;
 
@@ -835,11 +912,17 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         /*********************************************************/
     public:
         int32 GetWorldStateValue(int32 worldStateId) const;
+        // the value changes immediately, players receive one update per changed world state at the end of the map update
         void SetWorldStateValue(int32 worldStateId, int32 value, bool hidden);
         WorldStateValueContainer const& GetWorldStateValues() const { return _worldStateValues; }
+        WorldStateValueList const& GetInitialWorldStatesForArea(uint32 areaId) const;
 
     private:
+        void SendWorldStateUpdates();
+
         WorldStateValueContainer _worldStateValues;
+        mutable Trinity::Containers::FlatHashMap<uint32 /*areaId*/, WorldStateValueList> _initialWorldStatesByArea;    // cleared when any value changes
+        std::vector<std::pair<int32 /*worldStateId*/, bool /*hidden*/>> _pendingWorldStateUpdates;
 
         /*********************************************************/
         /***                   Vignettes                       ***/
@@ -850,8 +933,11 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::vector<Vignettes::VignetteData*> const& GetInfiniteAOIVignettes() const { return _infiniteAOIVignettes; }
 
     private:
+        void SendInfiniteAOIVignetteUpdates();
+
         std::vector<Vignettes::VignetteData*> _infiniteAOIVignettes;
         PeriodicTimer _vignetteUpdateTimer;
+        PeriodicTimer _terrainPreloadTimer;
 };
 
 enum class InstanceResetMethod : uint8
@@ -902,8 +988,19 @@ class TC_GAME_API InstanceMap : public Map
         Group* GetOwningGroup() const { return i_owningGroupRef.getTarget(); }
         void TrySetOwningGroup(Group* group);
 
+        // unloads all grids of an instance without players, keeping the state of creatures that differs from their spawn
+        void Hibernate();
+        bool IsHibernated() const { return _hibernated; }
+        void RestoreHibernatedState(Creature* creature);
+
         std::string GetDebugInfo() const override;
     private:
+        struct HibernatedCreatureState
+        {
+            uint64 Health;
+            Position Pos;
+        };
+
         Optional<SystemTimePoint> i_instanceExpireEvent;
         InstanceScript* i_data;
         uint32 i_script_id;
@@ -911,6 +1008,10 @@ class TC_GAME_API InstanceMap : public Map
         InstanceLock* i_instanceLock;
         GroupInstanceReference i_owningGroupRef;
         Optional<uint32> i_lfgDungeonsId;
+
+        uint32 _hibernateTimer;
+        bool _hibernated;
+        std::unordered_map<ObjectGuid::LowType, HibernatedCreatureState> _hibernatedCreatures;
 };
 
 class TC_GAME_API BattlegroundMap : public Map
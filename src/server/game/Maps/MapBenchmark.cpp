@@ -0,0 +1,134 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapBenchmark.h"
+#include "Chat.h"
+#include "GameTime.h"
+#include "Log.h"
+#include "Map.h"
+#include "MapManager.h"
+#include "ObjectAccessor.h"
+#include "Optional.h"
+#include "Player.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+Optional<MapBenchmark::Request> PendingRequest;
+
+constexpr std::size_t MaxReportedZones = 15;
+
+double ToMilliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+std::vector<std::string> Run(MapBenchmark::Request const& request)
+{
+    std::vector<std::string> report;
+    Map* map = sMapMgr->FindMap(request.MapId, request.InstanceId);
+    if (!map)
+    {
+        report.push_back(Trinity::StringFormat("Map {} instance {} is not loaded", request.MapId, request.InstanceId));
+        return report;
+    }
+
+    // the flight recorder keeps the profiler running, its recordings must survive
+    bool startedProfiler = !sProfiler->IsEnabled();
+    if (startedProfiler)
+        sProfiler->Start();
+
+    // only the world thread is seeded, map update islands run on other threads
+    SetRandomSeed(request.Seed);
+
+    Trinity::Profiler::Clock::time_point benchmarkStart = Trinity::Profiler::Clock::now();
+    std::vector<std::chrono::steady_clock::duration> tickTimes;
+    tickTimes.reserve(request.Ticks);
+    for (uint32 i = 0; i < request.Ticks; ++i)
+    {
+        std::chrono::steady_clock::time_point tickStart = std::chrono::steady_clock::now();
+        map->Update(request.Diff);
+        map->DelayedUpdate(request.Diff);
+        tickTimes.push_back(std::chrono::steady_clock::now() - tickStart);
+    }
+
+    std::vector<Trinity::ProfilerZoneSummary> zones = sProfiler->SummarizeZones(benchmarkStart);
+    std::string traceFileName = Trinity::StringFormat("mapbench_{}_{}.json", request.MapId, GameTime::GetGameTime());
+    bool wroteTrace = sProfiler->WriteChromeTrace(traceFileName, benchmarkStart);
+    if (startedProfiler)
+        sProfiler->Stop();
+
+    // the fixed sequence must not leak into regular updates
+    ResetRandomSeed();
+
+    std::chrono::steady_clock::duration total = std::chrono::steady_clock::duration::zero();
+    for (std::chrono::steady_clock::duration tickTime : tickTimes)
+        total += tickTime;
+
+    std::ranges::sort(tickTimes);
+    auto percentile = [&](double value) { return ToMilliseconds(tickTimes[std::min(tickTimes.size() - 1, std::size_t(value * double(tickTimes.size())))]); };
+
+    report.push_back(Trinity::StringFormat("{} ({}) instance {}: {} ticks of {} ms with seed {}, total {:.2f} ms",
+        map->GetMapName(), map->GetId(), map->GetInstanceId(), request.Ticks, request.Diff, request.Seed, ToMilliseconds(total)));
+    report.push_back(Trinity::StringFormat("Tick: p50 {:.3f} ms, p95 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms",
+        percentile(0.50), percentile(0.95), percentile(0.99), ToMilliseconds(tickTimes.back())));
+
+    for (std::size_t i = 0; i < std::min(zones.size(), MaxReportedZones); ++i)
+        report.push_back(Trinity::StringFormat("{}: {:.3f} ms in {} zones, max {:.3f} ms",
+            zones[i].Name, ToMilliseconds(zones[i].Total), zones[i].Count, ToMilliseconds(zones[i].Max)));
+
+    if (wroteTrace)
+        report.push_back(Trinity::StringFormat("Profiler trace written to {}", traceFileName));
+
+    return report;
+}
+}
+
+namespace MapBenchmark
+{
+bool Schedule(Request const& request)
+{
+    if (PendingRequest)
+        return false;
+
+    PendingRequest = request;
+    PendingRequest->Ticks = std::clamp(request.Ticks, 1u, MaxTicks);
+    return true;
+}
+
+void RunPending()
+{
+    if (!PendingRequest)
+        return;
+
+    Request request = *PendingRequest;
+    PendingRequest.reset();
+
+    std::vector<std::string> report = Run(request);
+    Player* requester = !request.Requester.IsEmpty() ? ObjectAccessor::FindConnectedPlayer(request.Requester) : nullptr;
+    for (std::string const& line : report)
+    {
+        TC_LOG_INFO("server.mapbench", "{}", line);
+        if (requester)
+            ChatHandler(requester->GetSession()).SendSysMessage(line);
+    }
+}
+}
@@ -0,0 +1,50 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MAP_BENCHMARK_H
+#define TRINITYCORE_MAP_BENCHMARK_H
+
+#include "Define.h"
+#include "ObjectGuid.h"
+
+/**
+ * Runs extra ticks of one map back to back with a fixed update diff and a seeded random number
+ * generator and reports the tick times and the time spent in the profiler zones of Map::Update.
+ * Game time does not advance while the ticks run.
+ */
+namespace MapBenchmark
+{
+    struct Request
+    {
+        uint32 MapId = 0;
+        uint32 InstanceId = 0;
+        uint32 Ticks = 0;
+        uint32 Diff = 0;
+        uint32 Seed = 0;
+        ObjectGuid Requester;   // receives the results, they are logged either way
+    };
+
+    static constexpr uint32 MaxTicks = 1000;
+
+    /// Returns false when a benchmark is already pending
+    TC_GAME_API bool Schedule(Request const& request);
+
+    /// Called by the world thread at the end of every World::Update, maps are not updating at that point
+    TC_GAME_API void RunPending();
+}
+
+#endif // TRINITYCORE_MAP_BENCHMARK_H
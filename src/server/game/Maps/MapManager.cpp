@@ -28,10 +28,13 @@
 #include "InstanceLockMgr.h"
 #include "Log.h"
 #include "Map.h"
+#include "ObjectMgr.h"
 #include "OutdoorPvPMgr.h"
 #include "Player.h"
 #include "ScenarioMgr.h"
 #include "ScriptMgr.h"
+#include "TerrainMgr.h"
+#include "ThreadPool.h"
 #include "World.h"
 #include "WorldStateMgr.h"
 
@@ -54,7 +57,16 @@ void MapManager::Initialize()
     int num_threads(sWorld->getIntConfig(CONFIG_NUMTHREADS));
     // Start mtmaps if needed.
     if (num_threads > 0)
-        m_updater.activate(num_threads);
+        m_updater.activate(num_threads, sWorld->getIntConfig(CONFIG_MAP_UPDATE_PROCESSOR_AFFINITY));
+
+    if (uint32 pathfindingThreads = sWorld->getIntConfig(CONFIG_MAP_PATHFINDING_THREADS))
+        _pathRequestPool = std::make_unique<Trinity::ThreadPool>(pathfindingThreads);
+
+    if (uint32 objectUpdateThreads = sWorld->getIntConfig(CONFIG_MAP_OBJECT_UPDATE_THREADS))
+        _objectUpdatePool = std::make_unique<Trinity::ThreadPool>(objectUpdateThreads);
+
+    if (uint32 gridLoadThreads = sWorld->getIntConfig(CONFIG_MAP_GRID_LOAD_THREADS))
+        _gridLoadPool = std::make_unique<Trinity::ThreadPool>(gridLoadThreads);
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -343,7 +355,14 @@ void MapManager::Update(uint32 diff)
         if (m_updater.activated())
             m_updater.schedule_update(*iter->second, uint32(i_timer.GetCurrent()));
         else
-            iter->second->Update(uint32(i_timer.GetCurrent()));
+        {
+            TimePoint start = std::chrono::steady_clock::now();
+            {
+                Trinity::CpuTimeScope cpuTime(iter->second->GetCpuTimeCounter());
+                iter->second->Update(uint32(i_timer.GetCurrent()));
+            }
+            iter->second->SetLastUpdateDuration(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start));
+        }
 
         ++iter;
     }
@@ -366,6 +385,10 @@ bool MapManager::DestroyMap(Map* map)
     sBattlefieldMgr->DestroyBattlefieldsForMap(map);
     sScriptMgr->OnDestroyMap(map);
 
+    // grids are still loaded, the next group entering doesn't have to load them again
+    if (map->IsDungeon())
+        PrewarmInstanceMap(map->GetId());
+
     map->UnloadAll();
 
     // Free up the instance id and allow it to be reused for normal dungeons, bgs and arenas
@@ -376,6 +399,22 @@ bool MapManager::DestroyMap(Map* map)
     return true;
 }
 
+void MapManager::PrewarmInstanceMap(uint32 mapId, float x, float y)
+{
+    uint32 prewarmTime = sWorld->getIntConfig(CONFIG_INSTANCE_PREWARM_TIME);
+    if (!prewarmTime)
+        return;
+
+    if (std::shared_ptr<TerrainInfo> terrain = sTerrainMgr.LoadTerrain(mapId))
+        sTerrainMgr.KeepWarm(terrain, x, y, Seconds(prewarmTime));
+}
+
+void MapManager::PrewarmInstanceMap(uint32 mapId)
+{
+    if (AreaTriggerStruct const* entrance = sObjectMgr->GetMapEntranceTrigger(mapId))
+        PrewarmInstanceMap(mapId, entrance->target_X, entrance->target_Y);
+}
+
 bool MapManager::IsValidMAP(uint32 mapId)
 {
     return sMapStore.LookupEntry(mapId) != nullptr;
@@ -399,6 +438,10 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    _pathRequestPool = nullptr;
+    _objectUpdatePool = nullptr;
+    _gridLoadPool = nullptr;
+
     Map::DeleteStateMachine();
 }
 
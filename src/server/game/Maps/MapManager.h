@@ -39,6 +39,8 @@ class Map;
 class Player;
 enum Difficulty : uint8;
 
+namespace Trinity { class ThreadPool; }
+
 class TC_GAME_API MapManager
 {
         MapManager();
@@ -117,8 +119,22 @@ class TC_GAME_API MapManager
         void RegisterInstanceId(uint32 instanceId);
         void FreeInstanceId(uint32 instanceId);
 
+        // keeps terrain of an instance map loaded around the given position (or its entrance) for Instance.PrewarmTime,
+        // so the next instance created for it does not wait for terrain files
+        void PrewarmInstanceMap(uint32 mapId, float x, float y);
+        void PrewarmInstanceMap(uint32 mapId);
+
         MapUpdater * GetMapUpdater() { return &m_updater; }
 
+        // helper threads shared by all maps for Map::ProcessPathRequests, null when paths are calculated synchronously
+        Trinity::ThreadPool* GetPathRequestPool() const { return _pathRequestPool.get(); }
+
+        // helper threads shared by all maps for Map::SendObjectUpdates, null when updates are built by the map thread only
+        Trinity::ThreadPool* GetObjectUpdatePool() const { return _objectUpdatePool.get(); }
+
+        // helper threads shared by all maps for ObjectGridLoader, null when grid objects are constructed by the map thread only
+        Trinity::ThreadPool* GetGridLoadPool() const { return _gridLoadPool.get(); }
+
         template<typename Worker>
         void DoForAllMaps(Worker&& worker);
 
@@ -155,6 +171,9 @@ class TC_GAME_API MapManager
         std::unique_ptr<InstanceIds> _freeInstanceIds;
         uint32 _nextInstanceId;
         MapUpdater m_updater;
+        std::unique_ptr<Trinity::ThreadPool> _pathRequestPool;
+        std::unique_ptr<Trinity::ThreadPool> _objectUpdatePool;
+        std::unique_ptr<Trinity::ThreadPool> _gridLoadPool;
 
         // atomic op counter for active scripts amount
         std::atomic<std::size_t> _scheduledScripts;
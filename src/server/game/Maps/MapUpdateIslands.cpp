@@ -0,0 +1,113 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapUpdateIslands.h"
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+uint32 GetGridId(CellCoord const& cell)
+{
+    return (cell.y_coord / MAX_NUMBER_OF_CELLS) * MAX_NUMBER_OF_GRIDS + cell.x_coord / MAX_NUMBER_OF_CELLS;
+}
+}
+
+MapUpdateIslands::MapUpdateIslands() : _groupGridId(GridCount)
+{
+    std::iota(_parents.begin(), _parents.end(), 0);
+}
+
+void MapUpdateIslands::BeginGroup()
+{
+    _groupGridId = GridCount;
+}
+
+void MapUpdateIslands::AddCell(CellCoord const& cell)
+{
+    uint32 gridId = GetGridId(cell);
+    _usedGrids.set(gridId);
+    _cells.push_back(cell);
+
+    if (_groupGridId != GridCount)
+        Join(_groupGridId, gridId);
+    else
+        _groupGridId = gridId;
+}
+
+std::vector<MapUpdateIslands::Island> MapUpdateIslands::Build()
+{
+    // join grids that are too close to be updated separately
+    for (uint32 gridId = 0; gridId < GridCount; ++gridId)
+    {
+        if (!_usedGrids[gridId])
+            continue;
+
+        int32 gridX = gridId % MAX_NUMBER_OF_GRIDS;
+        int32 gridY = gridId / MAX_NUMBER_OF_GRIDS;
+        for (int32 y = std::max<int32>(gridY - IslandGridDistance, 0); y <= std::min<int32>(gridY + IslandGridDistance, MAX_NUMBER_OF_GRIDS - 1); ++y)
+            for (int32 x = std::max<int32>(gridX - IslandGridDistance, 0); x <= std::min<int32>(gridX + IslandGridDistance, MAX_NUMBER_OF_GRIDS - 1); ++x)
+                if (_usedGrids[y * MAX_NUMBER_OF_GRIDS + x])
+                    Join(gridId, y * MAX_NUMBER_OF_GRIDS + x);
+    }
+
+    std::vector<Island> islands;
+    std::array<uint16, GridCount> islandIndexes;
+    islandIndexes.fill(uint16(GridCount));
+    for (CellCoord const& cell : _cells)
+    {
+        uint32 root = FindRoot(GetGridId(cell));
+        if (islandIndexes[root] == GridCount)
+        {
+            islandIndexes[root] = uint16(islands.size());
+            islands.emplace_back();
+        }
+
+        islands[islandIndexes[root]].push_back(cell);
+    }
+
+    std::sort(islands.begin(), islands.end(), [](Island const& left, Island const& right) { return left.size() > right.size(); });
+
+    // reset for next update, only parents of used grids were ever changed
+    for (uint32 gridId = 0; gridId < GridCount; ++gridId)
+        if (_usedGrids[gridId])
+            _parents[gridId] = uint16(gridId);
+
+    _usedGrids.reset();
+    _cells.clear();
+    _groupGridId = GridCount;
+    return islands;
+}
+
+uint32 MapUpdateIslands::FindRoot(uint32 gridId)
+{
+    while (_parents[gridId] != gridId)
+    {
+        _parents[gridId] = _parents[_parents[gridId]];
+        gridId = _parents[gridId];
+    }
+
+    return gridId;
+}
+
+void MapUpdateIslands::Join(uint32 gridId1, uint32 gridId2)
+{
+    uint32 root1 = FindRoot(gridId1);
+    uint32 root2 = FindRoot(gridId2);
+    if (root1 != root2)
+        _parents[std::max(root1, root2)] = uint16(std::min(root1, root2));
+}
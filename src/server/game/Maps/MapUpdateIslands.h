@@ -0,0 +1,60 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MAP_UPDATE_ISLANDS_H
+#define TRINITYCORE_MAP_UPDATE_ISLANDS_H
+
+#include "GridDefines.h"
+#include <array>
+#include <bitset>
+#include <vector>
+
+/*
+ * Partitions the cells visited during one Map::Update into islands that can be updated independently.
+ * Cells are grouped per grid, grids closer than IslandGridDistance to each other and grids
+ * visited on behalf of the same source (player, its viewpoint, far away combat targets...) end up in the same island.
+ * As MAX_VISIBILITY_DISTANCE is one grid, objects of two islands can never see each other.
+ */
+class TC_GAME_API MapUpdateIslands
+{
+public:
+    using Island = std::vector<CellCoord>;
+
+    static constexpr uint32 IslandGridDistance = 2;
+
+    MapUpdateIslands();
+
+    // cells added until next call belong to the same island
+    void BeginGroup();
+    void AddCell(CellCoord const& cell);
+
+    // returns islands ordered by number of cells, largest first and resets the builder
+    std::vector<Island> Build();
+
+private:
+    static constexpr uint32 GridCount = MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS;
+
+    uint32 FindRoot(uint32 gridId);
+    void Join(uint32 gridId1, uint32 gridId2);
+
+    std::array<uint16, GridCount> _parents;
+    std::bitset<GridCount> _usedGrids;
+    std::vector<CellCoord> _cells;
+    uint32 _groupGridId;
+};
+
+#endif // TRINITYCORE_MAP_UPDATE_ISLANDS_H
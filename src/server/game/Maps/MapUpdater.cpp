@@ -19,8 +19,8 @@
 #include "DatabaseEnv.h"
 #include "Map.h"
 #include "Metric.h"
-
-#include <mutex>
+#include "ProcessPriority.h"
+#include <algorithm>
 
 class MapUpdateRequest
 {
@@ -37,38 +37,66 @@ class MapUpdateRequest
         {
         }
 
+        Microseconds GetEstimatedCost() const { return m_map.GetLastUpdateDuration(); }
+
         void call()
         {
             TC_METRIC_TIMER("map_update_time_diff", TC_METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-            m_map.Update (m_diff);
+            TimePoint start = std::chrono::steady_clock::now();
+            {
+                Trinity::CpuTimeScope cpuTime(m_map.GetCpuTimeCounter());
+                m_map.Update(m_diff);
+            }
+            m_map.SetLastUpdateDuration(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start));
             m_updater.update_finished();
         }
 };
 
-void MapUpdater::activate(size_t num_threads)
+MapUpdater::MapUpdater() : _queuedRequests(0), _cancelationToken(false), pending_requests(0)
+{
+}
+
+MapUpdater::~MapUpdater() = default;
+
+void MapUpdater::activate(size_t num_threads, uint32 affinity /*= 0*/)
 {
+    for (size_t i = 0; i < num_threads; ++i)
+        _workerQueues.push_back(std::make_unique<WorkerQueue>());
+
     for (size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i, affinity));
     }
 }
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
     wait();
 
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _cancelationToken = true;
+    }
+
+    _workCondition.notify_all();
 
     for (auto& thread : _workerThreads)
     {
         thread.join();
     }
+
+    for (std::unique_ptr<WorkerQueue>& queue : _workerQueues)
+        for (MapUpdateRequest* request : queue->Requests)
+            delete request;
+
+    _workerThreads.clear();
+    _workerQueues.clear();
 }
 
 void MapUpdater::wait()
 {
+    dispatch_scheduled();
+
     std::unique_lock<std::mutex> lock(_lock);
 
     while (pending_requests > 0)
@@ -83,7 +111,8 @@ void MapUpdater::schedule_update(Map& map, uint32 diff)
 
     ++pending_requests;
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff));
+    // only collected here, workers are fed in dispatch_scheduled once all maps of this tick are known
+    _scheduledRequests.push_back(new MapUpdateRequest(map, *this, diff));
 }
 
 bool MapUpdater::activated()
@@ -91,6 +120,70 @@ bool MapUpdater::activated()
     return _workerThreads.size() > 0;
 }
 
+void MapUpdater::dispatch_scheduled()
+{
+    if (_scheduledRequests.empty())
+        return;
+
+    // longest processing time first, previous update duration of each map is used as cost estimate
+    std::stable_sort(_scheduledRequests.begin(), _scheduledRequests.end(), [](MapUpdateRequest const* left, MapUpdateRequest const* right)
+    {
+        return left->GetEstimatedCost() > right->GetEstimatedCost();
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _queuedRequests += _scheduledRequests.size();
+    }
+
+    // assign each request to the currently least loaded worker, maps that were never measured are spread evenly
+    std::vector<Microseconds> workerLoads(_workerQueues.size(), Microseconds::zero());
+    for (MapUpdateRequest* request : _scheduledRequests)
+    {
+        size_t workerIndex = std::distance(workerLoads.begin(), std::min_element(workerLoads.begin(), workerLoads.end()));
+        workerLoads[workerIndex] += std::max(request->GetEstimatedCost(), Microseconds(1));
+
+        std::lock_guard<std::mutex> lock(_workerQueues[workerIndex]->Lock);
+        _workerQueues[workerIndex]->Requests.push_back(request);
+    }
+
+    _scheduledRequests.clear();
+
+    _workCondition.notify_all();
+}
+
+bool MapUpdater::pop_request(size_t workerIndex, MapUpdateRequest*& request)
+{
+    // own queue first, most expensive request at the front
+    {
+        WorkerQueue& queue = *_workerQueues[workerIndex];
+        std::lock_guard<std::mutex> lock(queue.Lock);
+        if (!queue.Requests.empty())
+        {
+            request = queue.Requests.front();
+            queue.Requests.pop_front();
+            --_queuedRequests;
+            return true;
+        }
+    }
+
+    // steal the cheapest request of another worker, leaving its expensive ones to the owner
+    for (size_t i = 1; i < _workerQueues.size(); ++i)
+    {
+        WorkerQueue& queue = *_workerQueues[(workerIndex + i) % _workerQueues.size()];
+        std::lock_guard<std::mutex> lock(queue.Lock);
+        if (!queue.Requests.empty())
+        {
+            request = queue.Requests.back();
+            queue.Requests.pop_back();
+            --_queuedRequests;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void MapUpdater::update_finished()
 {
     std::lock_guard<std::mutex> lock(_lock);
@@ -100,8 +193,10 @@ void MapUpdater::update_finished()
     _condition.notify_all();
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::WorkerThread(size_t workerIndex, uint32 affinity)
 {
+    SetCurrentThreadAffinity("maps", affinity);
+
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
@@ -111,10 +206,18 @@ void MapUpdater::WorkerThread()
     {
         MapUpdateRequest* request = nullptr;
 
-        _queue.WaitAndPop(request);
+        if (!pop_request(workerIndex, request))
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            while (!_queuedRequests && !_cancelationToken)
+                _workCondition.wait(lock);
 
-        if (_cancelationToken)
-            return;
+            if (_cancelationToken)
+                return;
+
+            continue;
+        }
 
         request->call();
 
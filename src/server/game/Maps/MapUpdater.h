@@ -19,20 +19,29 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <thread>
-#include <condition_variable>
-#include "ProducerConsumerQueue.h"
+#include <vector>
 
 class MapUpdateRequest;
 class Map;
 
+/*
+ * Updates maps in parallel using a work stealing pool.
+ * Requests are collected by schedule_update and distributed when wait() is called,
+ * longest previous Map::Update duration first, so that the most expensive maps
+ * are started as early as possible and cheap ones fill the gaps at the end of the tick.
+ */
 class TC_GAME_API MapUpdater
 {
     public:
 
-        MapUpdater() : _cancelationToken(false), pending_requests(0) {}
-        ~MapUpdater() { };
+        MapUpdater();
+        ~MapUpdater();
 
         friend class MapUpdateRequest;
 
@@ -40,7 +49,7 @@ class TC_GAME_API MapUpdater
 
         void wait();
 
-        void activate(size_t num_threads);
+        void activate(size_t num_threads, uint32 affinity = 0);
 
         void deactivate();
 
@@ -48,18 +57,31 @@ class TC_GAME_API MapUpdater
 
     private:
 
-        ProducerConsumerQueue<MapUpdateRequest*> _queue;
+        struct WorkerQueue
+        {
+            std::mutex Lock;
+            std::deque<MapUpdateRequest*> Requests;
+        };
+
+        std::vector<MapUpdateRequest*> _scheduledRequests;
+        std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+        std::atomic<size_t> _queuedRequests;
 
         std::vector<std::thread> _workerThreads;
         std::atomic<bool> _cancelationToken;
 
         std::mutex _lock;
         std::condition_variable _condition;
+        std::condition_variable _workCondition;
         size_t pending_requests;
 
+        void dispatch_scheduled();
+
+        bool pop_request(size_t workerIndex, MapUpdateRequest*& request);
+
         void update_finished();
 
-        void WorkerThread();
+        void WorkerThread(size_t workerIndex, uint32 affinity);
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
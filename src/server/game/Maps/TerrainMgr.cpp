@@ -19,6 +19,7 @@
 #include "DB2Stores.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "GameTime.h"
 #include "GridMap.h"
 #include "Log.h"
 #include "Memory.h"
@@ -26,11 +27,14 @@
 #include "PhasingHandler.h"
 #include "Random.h"
 #include "ScriptMgr.h"
+#include "ThreadPool.h"
 #include "Util.h"
 #include "VMapFactory.h"
 #include "VMapManager2.h"
 #include "World.h"
 #include <G3D/g3dmath.h>
+#include <algorithm>
+#include <array>
 
 TerrainInfo::TerrainInfo(uint32 mapId) : _mapId(mapId), _parentTerrain(nullptr), _cleanupTimer(randtime(CleanupInterval / 2, CleanupInterval))
 {
@@ -163,6 +167,65 @@ void TerrainInfo::LoadMapAndVMap(int32 gx, int32 gy)
     LoadMapAndVMapImpl(gx, gy);
 }
 
+bool TerrainInfo::RequestPreload(int32 gx, int32 gy)
+{
+    if (_loadedGrids[GetBitsetIndex(gx, gy)])
+        return false;
+
+    std::lock_guard<std::mutex> lock(_preloadMutex);
+    if (_preloadRequested[GetBitsetIndex(gx, gy)])
+        return false;
+
+    _preloadRequested[GetBitsetIndex(gx, gy)] = true;
+    return true;
+}
+
+static void WarmFileCache(std::string const& fileName)
+{
+    // reading the file once moves it into os page cache, the actual load on map thread then doesn't block on disk
+    auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(fileName.c_str(), "rb"));
+    if (!file)
+        return;
+
+    std::array<char, 64 * 1024> buffer;
+    while (fread(buffer.data(), 1, buffer.size(), file.get()) == buffer.size())
+        ;
+}
+
+void TerrainInfo::PreloadGridFiles(int32 gx, int32 gy)
+{
+    if (_gridFileExists[GetBitsetIndex(gx, gy)])
+    {
+        std::string fileName = Trinity::StringFormat("{}maps/{:04}_{:02}_{:02}.map", sWorld->GetDataPath(), GetId(), gx, gy);
+        std::unique_ptr<GridMap> gridMap = std::make_unique<GridMap>();
+        if (gridMap->loadData(fileName.c_str(), sWorld->getBoolConfig(CONFIG_MAP_MEMORY_MAPPING)) == GridMap::LoadResult::Ok)
+        {
+            std::lock_guard<std::mutex> lock(_preloadMutex);
+            _preloadedGridMap[gx][gy] = std::move(gridMap);
+        }
+    }
+
+    // vmap and mmap tiles are inserted into trees shared with map update threads, only their files can be prepared here
+    if (VMAP::VMapFactory::createOrGetVMapManager()->isMapLoadingEnabled())
+    {
+        WarmFileCache(Trinity::StringFormat("{}vmaps/{:04}/{:04}_{:02}_{:02}.vmtile", sWorld->GetDataPath(), GetId(), GetId(), gy, gx));
+        WarmFileCache(Trinity::StringFormat("{}vmaps/{:04}/{:04}_{:02}_{:02}.vmtileidx", sWorld->GetDataPath(), GetId(), GetId(), gy, gx));
+    }
+
+    if (DisableMgr::IsPathfindingEnabled(GetId()))
+        WarmFileCache(Trinity::StringFormat("{}mmaps/{:04}{:02}{:02}.mmtile", sWorld->GetDataPath(), GetId(), gx, gy));
+
+    for (std::shared_ptr<TerrainInfo> const& childTerrain : _childTerrain)
+        childTerrain->PreloadGridFiles(gx, gy);
+}
+
+std::unique_ptr<GridMap> TerrainInfo::TakePreloadedGridMap(int32 gx, int32 gy)
+{
+    std::lock_guard<std::mutex> lock(_preloadMutex);
+    _preloadRequested[GetBitsetIndex(gx, gy)] = false;
+    return std::move(_preloadedGridMap[gx][gy]);
+}
+
 void TerrainInfo::LoadMMapInstance(uint32 mapId, uint32 instanceId)
 {
     LoadMMapInstanceImpl(mapId, instanceId);
@@ -190,18 +253,27 @@ void TerrainInfo::LoadMMapInstanceImpl(uint32 mapId, uint32 instanceId)
 
 void TerrainInfo::LoadMap(int32 gx, int32 gy)
 {
+    std::unique_ptr<GridMap> preloadedGridMap = TakePreloadedGridMap(gx, gy);
+
     if (_gridMap[gx][gy])
         return;
 
     if (!_gridFileExists[GetBitsetIndex(gx, gy)])
         return;
 
+    if (preloadedGridMap)
+    {
+        TC_LOG_DEBUG("maps", "Using preloaded map {:04}_{:02}_{:02}", GetId(), gx, gy);
+        _gridMap[gx][gy] = std::move(preloadedGridMap);
+        return;
+    }
+
     // map file name
     std::string fileName = Trinity::StringFormat("{}maps/{:04}_{:02}_{:02}.map", sWorld->GetDataPath(), GetId(), gx, gy);
     TC_LOG_DEBUG("maps", "Loading map {}", fileName);
     // loading data
     std::unique_ptr<GridMap> gridMap = std::make_unique<GridMap>();
-    GridMap::LoadResult gridMapLoadResult = gridMap->loadData(fileName.c_str());
+    GridMap::LoadResult gridMapLoadResult = gridMap->loadData(fileName.c_str(), sWorld->getBoolConfig(CONFIG_MAP_MEMORY_MAPPING));
     if (gridMapLoadResult == GridMap::LoadResult::Ok)
         _gridMap[gx][gy] = std::move(gridMap);
     else
@@ -264,6 +336,7 @@ void TerrainInfo::UnloadMMapInstance(uint32 mapId, uint32 instanceId)
 void TerrainInfo::UnloadMapImpl(int32 gx, int32 gy)
 {
     _gridMap[gx][gy] = nullptr;
+    TakePreloadedGridMap(gx, gy);
     VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(GetId(), gx, gy);
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(GetId(), gx, gy);
 
@@ -682,6 +755,40 @@ float TerrainInfo::GetGridHeight(PhaseShift const& phaseShift, uint32 mapId, flo
     return VMAP_INVALID_HEIGHT_VALUE;
 }
 
+void TerrainInfo::GetGridHeights(PhaseShift const& phaseShift, uint32 mapId, std::span<Position const> points, std::span<float> heights)
+{
+    ASSERT(points.size() == heights.size());
+
+    // consecutive points on the same grid are sampled in a single call
+    std::size_t runStart = 0;
+    GridMap* runGrid = nullptr;
+    auto flushRun = [&](std::size_t runEnd)
+    {
+        if (runStart == runEnd)
+            return;
+
+        if (runGrid)
+            runGrid->getHeights(points.subspan(runStart, runEnd - runStart), heights.subspan(runStart, runEnd - runStart));
+        else
+            std::ranges::fill(heights.subspan(runStart, runEnd - runStart), VMAP_INVALID_HEIGHT_VALUE);
+    };
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        float x = points[i].GetPositionX();
+        float y = points[i].GetPositionY();
+        GridMap* grid = GetGrid(PhasingHandler::GetTerrainMapId(phaseShift, mapId, this, x, y), x, y);
+        if (grid != runGrid)
+        {
+            flushRun(i);
+            runStart = i;
+            runGrid = grid;
+        }
+    }
+
+    flushRun(points.size());
+}
+
 float TerrainInfo::GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/)
 {
     // find raw .map surface under Z coordinates
@@ -785,6 +892,63 @@ void TerrainMgr::InitializeParentMapData(std::unordered_map<uint32, std::vector<
     _parentMapData = mapData;
 }
 
+void TerrainMgr::InitializePreloading(uint32 threadCount)
+{
+    if (threadCount)
+        _preloadThreadPool = std::make_unique<Trinity::ThreadPool>(threadCount);
+}
+
+void TerrainMgr::QueuePreload(std::shared_ptr<TerrainInfo> const& terrain, int32 gx, int32 gy)
+{
+    if (!_preloadThreadPool)
+        return;
+
+    if (!terrain->RequestPreload(gx, gy))
+        return;
+
+    _preloadThreadPool->PostWork([weakTerrain = std::weak_ptr<TerrainInfo>(terrain), gx, gy]()
+    {
+        if (std::shared_ptr<TerrainInfo> terrain = weakTerrain.lock())
+            terrain->PreloadGridFiles(gx, gy);
+    });
+}
+
+void TerrainMgr::KeepWarm(std::shared_ptr<TerrainInfo> const& terrain, float x, float y, Milliseconds duration)
+{
+    if (!Trinity::IsValidMapCoord(x, y))
+        return;
+
+    WarmTerrain& warmTerrain = _warmTerrains[terrain->GetId()];
+    warmTerrain.Terrain = terrain;
+    warmTerrain.ExpiryTime = std::max(warmTerrain.ExpiryTime, GameTime::Now() + duration);
+
+    GridCoord center = Trinity::ComputeGridCoord(x, y);
+    for (int32 dx = -1; dx <= 1; ++dx)
+    {
+        for (int32 dy = -1; dy <= 1; ++dy)
+        {
+            int32 gridX = int32(center.x_coord) + dx;
+            int32 gridY = int32(center.y_coord) + dy;
+            if (gridX < 0 || gridX >= MAX_NUMBER_OF_GRIDS || gridY < 0 || gridY >= MAX_NUMBER_OF_GRIDS)
+                continue;
+
+            int32 gx = (MAX_NUMBER_OF_GRIDS - 1) - gridX;
+            int32 gy = (MAX_NUMBER_OF_GRIDS - 1) - gridY;
+            if (advstd::ranges::contains(warmTerrain.ReferencedGrids, std::make_pair(gx, gy)))
+                continue;
+
+            // grids are only loaded by map threads, here only take a reference to those that are still loaded
+            if (terrain->IsGridLoaded(gx, gy))
+            {
+                terrain->LoadMapAndVMap(gx, gy);
+                warmTerrain.ReferencedGrids.emplace_back(gx, gy);
+            }
+            else
+                QueuePreload(terrain, gx, gy);
+        }
+    }
+}
+
 std::shared_ptr<TerrainInfo> TerrainMgr::LoadTerrain(uint32 mapId)
 {
     MapEntry const* entry = sMapStore.LookupEntry(mapId);
@@ -813,11 +977,30 @@ std::shared_ptr<TerrainInfo> TerrainMgr::LoadTerrain(uint32 mapId)
 
 void TerrainMgr::UnloadAll()
 {
+    if (_preloadThreadPool)
+    {
+        _preloadThreadPool->Stop();
+        _preloadThreadPool->Join();
+        _preloadThreadPool = nullptr;
+    }
+
+    _warmTerrains.clear();
     _terrainMaps.clear();
 }
 
 void TerrainMgr::Update(uint32 diff)
 {
+    std::erase_if(_warmTerrains, [now = GameTime::Now()](std::pair<uint32 const, WarmTerrain> const& warmTerrain)
+    {
+        if (warmTerrain.second.ExpiryTime > now)
+            return false;
+
+        for (auto [gx, gy] : warmTerrain.second.ReferencedGrids)
+            warmTerrain.second.Terrain->UnloadMap(gx, gy);
+
+        return true;
+    });
+
     // global garbage collection
     for (auto& [mapId, terrainRef] : _terrainMaps)
         if (std::shared_ptr<TerrainInfo> terrain = terrainRef.lock())
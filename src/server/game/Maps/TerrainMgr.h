@@ -19,6 +19,7 @@
 #define TERRAIN_MGR_H
 
 #include "Define.h"
+#include "Duration.h"
 #include "GridDefines.h"
 #include "MapDefines.h"
 #include "Position.h"
@@ -27,6 +28,7 @@
 #include <bitset>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -34,6 +36,8 @@ class DynamicMapTree;
 class GridMap;
 class PhaseShift;
 
+namespace Trinity { class ThreadPool; }
+
 class TC_GAME_API TerrainInfo
 {
 public:
@@ -58,6 +62,13 @@ public:
     void LoadMapAndVMap(int32 gx, int32 gy);
     void LoadMMapInstance(uint32 mapId, uint32 instanceId);
 
+    // returns false if grid is already loaded or a preload for it was already requested
+    bool RequestPreload(int32 gx, int32 gy);
+    // called from preload threads, prepares grid files so that LoadMapAndVMap does not have to wait for disk reads
+    void PreloadGridFiles(int32 gx, int32 gy);
+
+    bool IsGridLoaded(int32 gx, int32 gy) const { return _loadedGrids[GetBitsetIndex(gx, gy)]; }
+
 private:
     void LoadMapAndVMapImpl(int32 gx, int32 gy);
     void LoadMMapInstanceImpl(uint32 mapId, uint32 instanceId);
@@ -65,6 +76,8 @@ private:
     void LoadVMap(int32 gx, int32 gy);
     void LoadMMap(int32 gx, int32 gy);
 
+    std::unique_ptr<GridMap> TakePreloadedGridMap(int32 gx, int32 gy);
+
 public:
     void UnloadMap(int32 gx, int32 gy);
     void UnloadMMapInstance(uint32 mapId, uint32 instanceId);
@@ -91,6 +104,7 @@ public:
 
     float GetMinHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y);
     float GetGridHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y);
+    void GetGridHeights(PhaseShift const& phaseShift, uint32 mapId, std::span<Position const> points, std::span<float> heights);
     float GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH);
     float GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, Position const& pos, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) { return GetStaticHeight(phaseShift, mapId, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), checkVMap, maxSearchDist); }
 
@@ -114,6 +128,10 @@ private:
     std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> _loadedGrids;
     std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> _gridFileExists; // cache what grids are available for this map (not including parent/child maps)
 
+    std::mutex _preloadMutex;
+    std::unique_ptr<GridMap> _preloadedGridMap[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+    std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> _preloadRequested;
+
     static constexpr Milliseconds CleanupInterval = 1min;
 
     // global garbage collection timer
@@ -133,6 +151,14 @@ public:
     static TerrainMgr& Instance();
 
     void InitializeParentMapData(std::unordered_map<uint32, std::vector<uint32>> const& mapData);
+    void InitializePreloading(uint32 threadCount);
+
+    bool IsPreloadingEnabled() const { return _preloadThreadPool != nullptr; }
+    // loads terrain files for grid on background thread ahead of Map::EnsureGridCreated
+    void QueuePreload(std::shared_ptr<TerrainInfo> const& terrain, int32 gx, int32 gy);
+
+    // keeps terrain and its loaded grids around x, y in memory for duration even without any map using them, missing grids are preloaded
+    void KeepWarm(std::shared_ptr<TerrainInfo> const& terrain, float x, float y, Milliseconds duration);
 
     std::shared_ptr<TerrainInfo> LoadTerrain(uint32 mapId);
     void UnloadAll();
@@ -160,6 +186,17 @@ private:
 
     // parent map links
     std::unordered_map<uint32, std::vector<uint32>> _parentMapData;
+
+    std::unique_ptr<Trinity::ThreadPool> _preloadThreadPool;
+
+    struct WarmTerrain
+    {
+        std::shared_ptr<TerrainInfo> Terrain;
+        std::vector<std::pair<int32, int32>> ReferencedGrids;
+        TimePoint ExpiryTime;
+    };
+
+    std::unordered_map<uint32, WarmTerrain> _warmTerrains;
 };
 
 #define sTerrainMgr TerrainMgr::Instance()
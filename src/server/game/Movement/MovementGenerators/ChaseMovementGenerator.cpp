@@ -19,6 +19,7 @@
 #include "Creature.h"
 #include "CreatureAI.h"
 #include "G3DPosition.hpp"
+#include "Map.h"
 #include "MotionMaster.h"
 #include "MoveSpline.h"
 #include "MoveSplineInit.h"
@@ -71,13 +72,17 @@ ChaseMovementGenerator::ChaseMovementGenerator(Unit *target, Optional<ChaseRange
     Flags = MOVEMENTGENERATOR_FLAG_INITIALIZATION_PENDING;
     BaseUnitState = UNIT_STATE_CHASE;
 }
-ChaseMovementGenerator::~ChaseMovementGenerator() = default;
+ChaseMovementGenerator::~ChaseMovementGenerator()
+{
+    CancelPathRequest();
+}
 
 void ChaseMovementGenerator::Initialize(Unit* /*owner*/)
 {
     RemoveFlag(MOVEMENTGENERATOR_FLAG_INITIALIZATION_PENDING | MOVEMENTGENERATOR_FLAG_DEACTIVATED);
     AddFlag(MOVEMENTGENERATOR_FLAG_INITIALIZED | MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
 
+    CancelPathRequest();
     _path = nullptr;
     _lastTargetPosition.reset();
 }
@@ -104,6 +109,7 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
     if (owner->HasUnitState(UNIT_STATE_NOT_MOVE) || owner->IsMovementPreventedByCasting() || HasLostTarget(owner, target))
     {
         owner->StopMoving();
+        CancelPathRequest();
         _lastTargetPosition.reset();
         if (Creature* cOwner = owner->ToCreature())
             cOwner->SetCannotReachTarget(false);
@@ -130,6 +136,7 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
         if (HasFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED) && PositionOkay(owner, target, _movingTowards ? Optional<float>() : minTarget, _movingTowards ? maxTarget : Optional<float>(), angle))
         {
             RemoveFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+            CancelPathRequest();
             _path = nullptr;
             if (Creature* cOwner = owner->ToCreature())
                 cOwner->SetCannotReachTarget(false);
@@ -152,6 +159,24 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
         DoMovementInform(owner, target);
     }
 
+    // a path requested by an earlier update, keep following the current spline until it is calculated
+    if (_pathRequest)
+    {
+        if (!_pathRequest->IsCompleted() && !_pathRequest->IsCancelled())
+            return true;
+
+        std::shared_ptr<PathRequest> request = std::move(_pathRequest);
+        _path = request->TakePath();
+        // if the target jumped away in the meantime we just calculate again
+        if (_path && _lastTargetPosition && target->GetExactDistSq(*_lastTargetPosition) <= PATH_REQUEST_MAX_TARGET_DRIFT * PATH_REQUEST_MAX_TARGET_DRIFT)
+        {
+            LaunchPath(owner, target, request->GetResult(), _pathRequestShortensPath, maxTarget);
+            return true;
+        }
+
+        _lastTargetPosition.reset();
+    }
+
     // if the target moved, we have to consider whether to adjust
     if (!_lastTargetPosition || target->GetPosition() != _lastTargetPosition.value() || mutualChase != _mutualChase)
     {
@@ -165,6 +190,7 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
             {
                 cOwner->SetCannotReachTarget(true);
                 cOwner->StopMoving();
+                CancelPathRequest();
                 _path = nullptr;
                 return true;
             }
@@ -195,50 +221,73 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
             if (owner->IsHovering())
                 owner->UpdateAllowedPositionZ(x, y, z);
 
-            bool success = _path->CalculatePath(x, y, z, owner->CanFly());
-            if (!success || (_path->GetPathType() & (PATHFIND_NOPATH /* | PATHFIND_INCOMPLETE*/)))
+            if (Map::IsAsyncPathfindingEnabled())
             {
-                if (cOwner)
-                    cOwner->SetCannotReachTarget(true);
-                owner->StopMoving();
+                _pathRequest = std::make_shared<PathRequest>(std::move(_path), G3D::Vector3(x, y, z), owner->CanFly());
+                _pathRequestShortensPath = shortenPath;
+                owner->GetMap()->QueuePathRequest(_pathRequest);
                 return true;
             }
 
-            if (shortenPath)
-                _path->ShortenPathUntilDist(PositionToVector3(target), maxTarget);
+            bool success = _path->CalculatePath(x, y, z, owner->CanFly());
+            LaunchPath(owner, target, success, shortenPath, maxTarget);
+        }
+    }
 
-            if (cOwner)
-                cOwner->SetCannotReachTarget(false);
+    // and then, finally, we're done for the tick
+    return true;
+}
 
-            bool walk = false;
-            if (cOwner && !cOwner->IsPet())
-            {
-                switch (cOwner->GetMovementTemplate().GetChase())
-                {
-                    case CreatureChaseMovementType::CanWalk:
-                        walk = owner->IsWalking();
-                        break;
-                    case CreatureChaseMovementType::AlwaysWalk:
-                        walk = true;
-                        break;
-                    default:
-                        break;
-                }
-            }
+void ChaseMovementGenerator::LaunchPath(Unit* owner, Unit* target, bool calculated, bool shortenPath, float maxTarget)
+{
+    Creature* const cOwner = owner->ToCreature();
+    if (!calculated || (_path->GetPathType() & (PATHFIND_NOPATH /* | PATHFIND_INCOMPLETE*/)))
+    {
+        if (cOwner)
+            cOwner->SetCannotReachTarget(true);
+        owner->StopMoving();
+        return;
+    }
 
-            owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
-            AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+    if (shortenPath)
+        _path->ShortenPathUntilDist(PositionToVector3(target), maxTarget);
 
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(_path->GetPath());
-            init.SetWalk(walk);
-            init.SetFacing(target);
-            init.Launch();
+    if (cOwner)
+        cOwner->SetCannotReachTarget(false);
+
+    bool walk = false;
+    if (cOwner && !cOwner->IsPet())
+    {
+        switch (cOwner->GetMovementTemplate().GetChase())
+        {
+            case CreatureChaseMovementType::CanWalk:
+                walk = owner->IsWalking();
+                break;
+            case CreatureChaseMovementType::AlwaysWalk:
+                walk = true;
+                break;
+            default:
+                break;
         }
     }
 
-    // and then, finally, we're done for the tick
-    return true;
+    owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
+    AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(_path->GetPath());
+    init.SetWalk(walk);
+    init.SetFacing(target);
+    init.Launch();
+}
+
+void ChaseMovementGenerator::CancelPathRequest()
+{
+    if (!_pathRequest)
+        return;
+
+    _pathRequest->Cancel();
+    _pathRequest = nullptr;
 }
 
 void ChaseMovementGenerator::Deactivate(Unit* owner)
@@ -26,6 +26,7 @@
 #include "Timer.h"
 
 class PathGenerator;
+class PathRequest;
 class Unit;
 
 class ChaseMovementGenerator : public MovementGenerator, public AbstractFollower
@@ -45,11 +46,17 @@ class ChaseMovementGenerator : public MovementGenerator, public AbstractFollower
 
     private:
         static constexpr uint32 RANGE_CHECK_INTERVAL = 100; // time (ms) until we attempt to recalculate
+        static constexpr float PATH_REQUEST_MAX_TARGET_DRIFT = 5.0f; // distance the target may move before a deferred path is discarded
+
+        void LaunchPath(Unit* owner, Unit* target, bool calculated, bool shortenPath, float maxTarget);
+        void CancelPathRequest();
 
         Optional<ChaseRange> const _range;
         Optional<ChaseAngle> const _angle;
 
         std::unique_ptr<PathGenerator> _path;
+        std::shared_ptr<PathRequest> _pathRequest;
+        bool _pathRequestShortensPath = false;
         Optional<Position> _lastTargetPosition;
         TimeTracker _rangeCheckTimer;
         bool _movingTowards = true;
@@ -18,6 +18,7 @@
 #include "FollowMovementGenerator.h"
 #include "Creature.h"
 #include "CreatureAI.h"
+#include "Map.h"
 #include "MoveSpline.h"
 #include "MoveSplineInit.h"
 #include "Optional.h"
@@ -46,7 +47,10 @@ FollowMovementGenerator::FollowMovementGenerator(Unit* target, float range, Opti
     if (duration)
         _duration.emplace(*duration);
 }
-FollowMovementGenerator::~FollowMovementGenerator() = default;
+FollowMovementGenerator::~FollowMovementGenerator()
+{
+    CancelPathRequest();
+}
 
 static bool PositionOkay(Unit* owner, Unit* target, float range, Optional<ChaseAngle> angle = {})
 {
@@ -63,6 +67,7 @@ void FollowMovementGenerator::Initialize(Unit* owner)
 
     owner->StopMoving();
     UpdatePetSpeed(owner);
+    CancelPathRequest();
     _path = nullptr;
     _lastTargetPosition.reset();
 }
@@ -98,6 +103,7 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
 
     if (owner->HasUnitState(UNIT_STATE_NOT_MOVE) || owner->IsMovementPreventedByCasting())
     {
+        CancelPathRequest();
         _path = nullptr;
         owner->StopMoving();
         _lastTargetPosition.reset();
@@ -116,6 +122,7 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
         if (HasFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED) && PositionOkay(owner, target, range, _angle))
         {
             RemoveFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+            CancelPathRequest();
             _path = nullptr;
             owner->StopMoving();
             _lastTargetPosition.reset();
@@ -132,6 +139,24 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
         DoMovementInform(owner, target);
     }
 
+    // a path requested by an earlier update, keep following the current spline until it is calculated
+    if (_pathRequest)
+    {
+        if (!_pathRequest->IsCompleted() && !_pathRequest->IsCancelled())
+            return true;
+
+        std::shared_ptr<PathRequest> request = std::move(_pathRequest);
+        _path = request->TakePath();
+        // if the target jumped away in the meantime we just calculate again
+        if (_path && _lastTargetPosition && target->GetExactDistSq(*_lastTargetPosition) <= PATH_REQUEST_MAX_TARGET_DRIFT * PATH_REQUEST_MAX_TARGET_DRIFT)
+        {
+            LaunchPath(owner, target, request->GetResult());
+            return true;
+        }
+
+        _lastTargetPosition.reset();
+    }
+
     if (!_lastTargetPosition || _lastTargetPosition->GetExactDistSq(target->GetPosition()) > 0.0f)
     {
         _lastTargetPosition = target->GetPosition();
@@ -170,27 +195,48 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
                     allowShortcut = true;
             }
 
-            bool success = _path->CalculatePath(x, y, z, allowShortcut);
-            if (!success || (_path->GetPathType() & PATHFIND_NOPATH))
+            if (Map::IsAsyncPathfindingEnabled())
             {
-                owner->StopMoving();
+                _pathRequest = std::make_shared<PathRequest>(std::move(_path), G3D::Vector3(x, y, z), allowShortcut);
+                owner->GetMap()->QueuePathRequest(_pathRequest);
                 return true;
             }
 
-            owner->AddUnitState(UNIT_STATE_FOLLOW_MOVE);
-            AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
-
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(_path->GetPath());
-            if (!_ignoreTargetWalk)
-                init.SetWalk(target->IsWalking());
-            init.SetFacing(target->GetOrientation());
-            init.Launch();
+            bool success = _path->CalculatePath(x, y, z, allowShortcut);
+            LaunchPath(owner, target, success);
         }
     }
     return true;
 }
 
+void FollowMovementGenerator::LaunchPath(Unit* owner, Unit* target, bool calculated)
+{
+    if (!calculated || (_path->GetPathType() & PATHFIND_NOPATH))
+    {
+        owner->StopMoving();
+        return;
+    }
+
+    owner->AddUnitState(UNIT_STATE_FOLLOW_MOVE);
+    AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(_path->GetPath());
+    if (!_ignoreTargetWalk)
+        init.SetWalk(target->IsWalking());
+    init.SetFacing(target->GetOrientation());
+    init.Launch();
+}
+
+void FollowMovementGenerator::CancelPathRequest()
+{
+    if (!_pathRequest)
+        return;
+
+    _pathRequest->Cancel();
+    _pathRequest = nullptr;
+}
+
 void FollowMovementGenerator::Deactivate(Unit* owner)
 {
     AddFlag(MOVEMENTGENERATOR_FLAG_DEACTIVATED);
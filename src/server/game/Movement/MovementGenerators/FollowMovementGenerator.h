@@ -25,6 +25,7 @@
 #include "Timer.h"
 
 class PathGenerator;
+class PathRequest;
 class Unit;
 
 #define FOLLOW_RANGE_TOLERANCE 1.0f
@@ -47,8 +48,11 @@ class FollowMovementGenerator : public MovementGenerator, public AbstractFollowe
 
     private:
         static constexpr uint32 CHECK_INTERVAL = 100;
+        static constexpr float PATH_REQUEST_MAX_TARGET_DRIFT = 5.0f; // distance the target may move before a deferred path is discarded
 
         void UpdatePetSpeed(Unit* owner);
+        void LaunchPath(Unit* owner, Unit* target, bool calculated);
+        void CancelPathRequest();
 
         float const _range;
         Optional<ChaseAngle const> _angle;
@@ -57,6 +61,7 @@ class FollowMovementGenerator : public MovementGenerator, public AbstractFollowe
         TimeTracker _checkTimer;
         Optional<TimeTracker> _duration;
         std::unique_ptr<PathGenerator> _path;
+        std::shared_ptr<PathRequest> _pathRequest;
         Optional<Position> _lastTargetPosition;
 };
 
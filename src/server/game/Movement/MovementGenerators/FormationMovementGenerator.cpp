@@ -141,10 +141,6 @@ void FormationMovementGenerator::LaunchMovement(Creature* owner, Unit* target)
 {
     float relativeAngle = 0.f;
 
-    // Determine our relative angle to our current spline destination point
-    if (!target->movespline->Finalized())
-        relativeAngle = target->GetRelativeAngle(Vector3ToPosition(target->movespline->CurrentDestination()));
-
     // Destination calculation
     /*
         According to sniff data, formation members have a periodic move interal of 1,2s.
@@ -154,6 +150,7 @@ void FormationMovementGenerator::LaunchMovement(Creature* owner, Unit* target)
     */
     Position dest = target->GetPosition();
     float velocity = 0.f;
+    bool generatePath = true;
 
     // Formation leader is moving. Predict our destination
     if (!target->movespline->Finalized())
@@ -164,13 +161,38 @@ void FormationMovementGenerator::LaunchMovement(Creature* owner, Unit* target)
         // Calculate travel distance to get a 1650ms result
         float travelDist = velocity * 1.65f;
 
-        // Move destination ahead...
-        target->MovePositionToFirstCollision(dest, travelDist, relativeAngle);
+        // The leader's prediction is shared by the whole formation
+        FormationLeaderMovement const* leaderMovement = nullptr;
+        if (Creature* leader = target->ToCreature())
+            if (CreatureGroup* formation = leader->GetFormation())
+                if (formation->IsLeader(leader))
+                    leaderMovement = formation->GetLeaderMovement();
+
+        if (leaderMovement)
+        {
+            relativeAngle = leaderMovement->RelativeAngle;
+            dest = leaderMovement->Destination;
+        }
+        else
+        {
+            // Determine our relative angle to our current spline destination point
+            relativeAngle = target->GetRelativeAngle(Vector3ToPosition(target->movespline->CurrentDestination()));
+
+            // Move destination ahead...
+            target->MovePositionToFirstCollision(dest, travelDist, relativeAngle);
+        }
+
         // ... and apply formation shape
+        Position predictedLeaderPosition = dest;
         target->MovePositionToFirstCollision(dest, _range, _angle + relativeAngle);
 
         float distance = owner->GetExactDist(dest);
 
+        // Members keeping their slot without being blocked by obstacles follow the leader's validated path shape, skip pathfinding for them
+        if (leaderMovement && leaderMovement->HasDirectPath && distance <= travelDist * 1.5f
+            && predictedLeaderPosition.GetExactDist2d(dest) >= _range - 0.5f)
+            generatePath = false;
+
         // Calculate catchup speed mod (Limit to a maximum of 50% of our original velocity
         float velocityMod = std::min<float>(distance / travelDist, 1.5f);
 
@@ -190,7 +212,7 @@ void FormationMovementGenerator::LaunchMovement(Creature* owner, Unit* target)
         velocity = target->GetSpeed(MOVE_WALK);
 
     Movement::MoveSplineInit init(owner);
-    init.MoveTo(PositionToVector3(dest));
+    init.MoveTo(PositionToVector3(dest), generatePath);
     init.SetVelocity(velocity);
     init.Launch();
 
@@ -397,18 +397,27 @@ void CreateMergedPath(Unit const* owner, WaypointPath const* path, uint32 previo
     waypointTransitionSplinePoints->clear();
     auto fillPath = [&]<typename iterator>(iterator itr, iterator end)
     {
-        Optional<PathGenerator> generator;
-        if (generatePath)
-            generator.emplace(owner);
-
         Position source = owner->GetPosition();
+        points->reserve(points->size() + std::distance(itr, end) + 1);
         points->emplace_back(source.GetPositionX(), source.GetPositionY(), source.GetPositionZ());
 
+        // without pathfinding every node maps to exactly one spline point, copy the prebuilt positions as a whole
+        if (!generatePath)
+        {
+            int32 firstTransitionPoint = int32(points->size());
+            points->insert(points->end(), itr, end);
+            for (int32 point = firstTransitionPoint; point < int32(points->size()); ++point)
+                waypointTransitionSplinePoints->push_back(point);
+            return;
+        }
+
+        Optional<PathGenerator> generator(std::in_place, owner);
         while (itr != end)
         {
+            G3D::Vector3 const& destination = *itr;
             if (generator)
             {
-                bool result = generator->CalculatePath(source.GetPositionX(), source.GetPositionY(), source.GetPositionZ(), itr->X, itr->Y, itr->Z);
+                bool result = generator->CalculatePath(source.GetPositionX(), source.GetPositionY(), source.GetPositionZ(), destination.x, destination.y, destination.z);
                 if (result && !(generator->GetPathType() & PATHFIND_NOPATH))
                     points->insert(points->end(), generator->GetPath().begin() + 1, generator->GetPath().end());
                 else
@@ -416,28 +425,38 @@ void CreateMergedPath(Unit const* owner, WaypointPath const* path, uint32 previo
             }
 
             if (!generator)
-                points->emplace_back(itr->X, itr->Y, itr->Z);
+                points->push_back(destination);
 
             waypointTransitionSplinePoints->push_back(points->size() - 1);
 
-            source.Relocate(itr->X, itr->Y, itr->Z);
+            source.Relocate(destination.x, destination.y, destination.z);
             ++itr;
         }
     };
 
+    std::size_t const segmentStart = std::distance(path->Nodes.data(), segment.data());
+    std::span<G3D::Vector3 const> positions(path->Positions.data() + segmentStart, segment.size());
+
     if (isCyclic)
     {
-        // create new cyclic path starting at current node
-        std::vector<WaypointNode> cyclicPath = path->Nodes;
-        std::rotate(cyclicPath.begin(), cyclicPath.begin() + currentNode, cyclicPath.end());
-        fillPath(cyclicPath.begin(), cyclicPath.end());
+        // cyclic path starting at current node, wrapping around to the nodes before it
+        if (!currentNode)
+            fillPath(path->Positions.begin(), path->Positions.end());
+        else
+        {
+            std::vector<G3D::Vector3> cyclicPath;
+            cyclicPath.reserve(path->Positions.size());
+            cyclicPath.insert(cyclicPath.end(), path->Positions.begin() + currentNode, path->Positions.end());
+            cyclicPath.insert(cyclicPath.end(), path->Positions.begin(), path->Positions.begin() + currentNode);
+            fillPath(cyclicPath.begin(), cyclicPath.end());
+        }
         return;
     }
 
     if (!isReturningToStart)
-        fillPath(segment.begin(), segment.end());
+        fillPath(positions.begin(), positions.end());
     else
-        fillPath(segment.rbegin(), segment.rend());
+        fillPath(positions.rbegin(), positions.rend());
 }
 }
 
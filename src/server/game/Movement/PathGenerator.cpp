@@ -33,13 +33,14 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false),
     _forceDestination(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
     _startPosition(PositionToVector3(owner)), _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _navMeshMapId(0)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
     TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::PathGenerator for {}", _source->GetGUID().ToString());
 
     uint32 mapId = PhasingHandler::GetTerrainMapId(_source->GetPhaseShift(), _source->GetMapId(), _source->GetMap()->GetTerrain(), _startPosition.x, _startPosition.y);
+    _navMeshMapId = mapId;
     if (DisableMgr::IsPathfindingEnabled(_source->GetMapId()))
     {
         MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
@@ -83,9 +84,22 @@ bool PathGenerator::CalculatePath(float srcX, float srcY, float srcZ, float dest
         return true;
     }
 
+    // the instance query is shared by everything on this map, lease a private one so paths can be built from any thread
+    MMAP::PooledNavMeshQuery query = MMAP::MMapFactory::createOrGetMMapManager()->AcquireNavMeshQuery(_navMeshMapId);
+    if (!query)
+    {
+        BuildShortcut();
+        _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
+        return true;
+    }
+
+    dtNavMeshQuery const* instanceQuery = std::exchange(_navMeshQuery, query.get());
+
     UpdateFilter();
 
     BuildPolyPath(start, dest);
+
+    _navMeshQuery = instanceQuery;
     return true;
 }
 
@@ -499,15 +513,27 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                            startPoly,          // start polygon
-                            endPoly,            // end polygon
-                            startPoint,         // start position
-                            endPoint,           // end position
-                            &_filter,           // polygon search filter
-                            _pathPolyRefs,     // [out] path
-                            (int*)&_polyLength,
-                            MAX_PATH_LENGTH);   // max number of polygons in output path
+            // many units path between the same polygons (chasing the same target, patrols), reuse their corridor
+            MMAP::NavMeshPathCache* pathCache = MMAP::MMapFactory::createOrGetMMapManager()->GetPathCache(_navMeshMapId);
+            MMAP::NavMeshPathCache::Key cacheKey{ .StartPoly = startPoly, .EndPoly = endPoly, .IncludeFlags = _filter.getIncludeFlags(), .ExcludeFlags = _filter.getExcludeFlags() };
+            if (pathCache && pathCache->Find(cacheKey, _pathPolyRefs, _polyLength, MAX_PATH_LENGTH))
+                dtResult = DT_SUCCESS;
+            else
+            {
+                dtResult = _navMeshQuery->findPath(
+                                startPoly,          // start polygon
+                                endPoly,            // end polygon
+                                startPoint,         // start position
+                                endPoint,           // end position
+                                &_filter,           // polygon search filter
+                                _pathPolyRefs,     // [out] path
+                                (int*)&_polyLength,
+                                MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                // partial paths depend on how far the search got, only complete corridors are shared
+                if (pathCache && dtStatusSucceed(dtResult) && !dtStatusDetail(dtResult, DT_PARTIAL_RESULT) && _polyLength && _pathPolyRefs[_polyLength - 1] == endPoly)
+                    pathCache->Store(cacheKey, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
@@ -1048,3 +1074,24 @@ void PathGenerator::AddFarFromPolyFlags(bool startFarFromPoly, bool endFarFromPo
     if (endFarFromPoly)
         _type = PathType(_type | PATHFIND_FARFROMPOLY_END);
 }
+
+PathRequest::PathRequest(std::unique_ptr<PathGenerator> path, G3D::Vector3 const& destination, bool forceDest) :
+    _path(std::move(path)), _destination(destination), _forceDestination(forceDest), _result(false), _completed(false)
+{
+}
+
+PathRequest::~PathRequest() = default;
+
+WorldObject const* PathRequest::GetSource() const
+{
+    return _path ? _path->GetSource() : nullptr;
+}
+
+void PathRequest::Calculate()
+{
+    if (!_path || _completed)
+        return;
+
+    _result = _path->CalculatePath(_destination.x, _destination.y, _destination.z, _forceDestination);
+    _completed = true;
+}
@@ -23,6 +23,7 @@
 #include "MMapDefines.h"
 #include "MoveSplineInitArgs.h"
 #include <G3D/Vector3.h>
+#include <memory>
 
 class WorldObject;
 
@@ -74,6 +75,8 @@ class TC_GAME_API PathGenerator
         void SetPathLengthLimit(float distance) { _pointPathLimit = std::min<uint32>(uint32(distance/SMOOTH_PATH_STEP_SIZE), MAX_POINT_PATH_LENGTH); }
         void SetUseRaycast(bool useRaycast) { _useRaycast = useRaycast; }
 
+        WorldObject const* GetSource() const { return _source; }
+
         // result getters
         G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
         G3D::Vector3 const& GetEndPosition() const { return _endPosition; }
@@ -107,6 +110,7 @@ class TC_GAME_API PathGenerator
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        uint32 _navMeshMapId;                   // terrain map id of the nav mesh
 
         dtQueryFilter _filter;  // use single filter for all movements, update it when needed
 
@@ -148,4 +152,41 @@ class TC_GAME_API PathGenerator
         void AddFarFromPolyFlags(bool startFarFromPoly, bool endFarFromPoly);
 };
 
+// Path calculation deferred to Map::ProcessPathRequests, see Map::QueuePathRequest
+// The requester keeps following its current spline and picks up the result on a later update
+class TC_GAME_API PathRequest
+{
+    public:
+        PathRequest(std::unique_ptr<PathGenerator> path, G3D::Vector3 const& destination, bool forceDest);
+        ~PathRequest();
+
+        PathRequest(PathRequest const& right) = delete;
+        PathRequest(PathRequest&& right) = delete;
+        PathRequest& operator=(PathRequest const& right) = delete;
+        PathRequest& operator=(PathRequest&& right) = delete;
+
+        WorldObject const* GetSource() const;
+        G3D::Vector3 const& GetDestination() const { return _destination; }
+
+        // called by the map, never concurrently with the requester
+        void Calculate();
+
+        bool IsCompleted() const { return _completed; }
+        bool IsCancelled() const { return !_path; }
+
+        // the requester must cancel before its owner can be deleted, the path generator is destroyed immediately
+        void Cancel() { _path = nullptr; }
+
+        // return value of PathGenerator::CalculatePath, only valid once completed
+        bool GetResult() const { return _result; }
+        std::unique_ptr<PathGenerator> TakePath() { return std::move(_path); }
+
+    private:
+        std::unique_ptr<PathGenerator> _path;
+        G3D::Vector3 _destination;
+        bool _forceDestination;
+        bool _result;
+        bool _completed;
+};
+
 #endif
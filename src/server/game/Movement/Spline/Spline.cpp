@@ -120,7 +120,8 @@ void SplineBase::EvaluateLinear(index_type index, float u, Vector3& result) cons
 void SplineBase::EvaluateCatmullRom( index_type index, float t, Vector3& result) const
 {
     ASSERT(index >= index_lo && index < index_hi);
-    C_Evaluate(&points[index - 1], t, s_catmullRomCoeffs, result);
+    SegmentCoefficients const& coeffs = segmentCoefficients[index - index_lo];
+    result = ((coeffs.a * t + coeffs.b) * t + coeffs.c) * t + coeffs.d;
 }
 
 void SplineBase::EvaluateBezier3(index_type index, float t, Vector3& result) const
@@ -139,7 +140,8 @@ void SplineBase::EvaluateDerivativeLinear(index_type index, float, Vector3& resu
 void SplineBase::EvaluateDerivativeCatmullRom(index_type index, float t, Vector3& result) const
 {
     ASSERT(index >= index_lo && index < index_hi);
-    C_Evaluate_Derivative(&points[index - 1], t, s_catmullRomCoeffs, result);
+    SegmentCoefficients const& coeffs = segmentCoefficients[index - index_lo];
+    result = (coeffs.a * (3.f * t) + coeffs.b * 2.f) * t + coeffs.c;
 }
 
 void SplineBase::EvaluateDerivativeBezier3(index_type index, float t, Vector3& result) const
@@ -160,14 +162,13 @@ float SplineBase::SegLengthCatmullRom(index_type index) const
     ASSERT(index >= index_lo && index < index_hi);
 
     Vector3 curPos, nextPos;
-    const Vector3 * p = &points[index - 1];
-    curPos = nextPos = p[1];
+    curPos = nextPos = points[index];
 
     index_type i = 1;
     float length = 0;
     while (i <= stepsPerSegment)
     {
-        C_Evaluate(p, float(i) / float(stepsPerSegment), s_catmullRomCoeffs, nextPos);
+        EvaluateCatmullRom(index, float(i) / float(stepsPerSegment), nextPos);
         length += (nextPos - curPos).length();
         curPos = nextPos;
         ++i;
@@ -267,6 +268,8 @@ void SplineBase::InitCatmullRom(Vector3 const* controls, index_type count, index
 
     index_lo = lo_index;
     index_hi = high_index + (cyclic ? 1 : 0);
+
+    InitSegmentCoefficients();
 }
 
 void SplineBase::InitBezier3(Vector3 const* controls, index_type count, index_type /*cyclic_point*/)
@@ -282,6 +285,25 @@ void SplineBase::InitBezier3(Vector3 const* controls, index_type count, index_ty
     //mov_assert(points.size() % 3 == 0);
 }
 
+void SplineBase::InitSegmentCoefficients()
+{
+    segmentCoefficients.clear();
+    if (m_mode != ModeCatmullrom || index_hi <= index_lo)
+        return;
+
+    // rows of the basis matrix weight the four control points of a segment for t^3, t^2, t and 1
+    segmentCoefficients.resize(index_hi - index_lo);
+    for (index_type index = index_lo; index < index_hi; ++index)
+    {
+        Vector3 const* p = &points[index - 1];
+        SegmentCoefficients& coeffs = segmentCoefficients[index - index_lo];
+        coeffs.a = p[0] * s_catmullRomCoeffs[0][0] + p[1] * s_catmullRomCoeffs[0][1] + p[2] * s_catmullRomCoeffs[0][2] + p[3] * s_catmullRomCoeffs[0][3];
+        coeffs.b = p[0] * s_catmullRomCoeffs[1][0] + p[1] * s_catmullRomCoeffs[1][1] + p[2] * s_catmullRomCoeffs[1][2] + p[3] * s_catmullRomCoeffs[1][3];
+        coeffs.c = p[0] * s_catmullRomCoeffs[2][0] + p[1] * s_catmullRomCoeffs[2][1] + p[2] * s_catmullRomCoeffs[2][2] + p[3] * s_catmullRomCoeffs[2][3];
+        coeffs.d = p[0] * s_catmullRomCoeffs[3][0] + p[1] * s_catmullRomCoeffs[3][1] + p[2] * s_catmullRomCoeffs[3][2] + p[3] * s_catmullRomCoeffs[3][3];
+    }
+}
+
 SplineBase::SplineBase(): index_lo(0), index_hi(0), m_mode(UninitializedMode), cyclic(false), initialOrientation(0.f)
 {
 }
@@ -293,6 +315,7 @@ void SplineBase::clear()
     index_lo = 0;
     index_hi = 0;
     points.clear();
+    segmentCoefficients.clear();
 }
 
 std::string SplineBase::ToString() const
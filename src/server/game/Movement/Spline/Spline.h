@@ -42,7 +42,14 @@ public:
     };
 
 protected:
+    // cubic polynomial of one segment, evaluated with Horner's method instead of multiplying the basis matrix every call
+    struct SegmentCoefficients
+    {
+        Vector3 a, b, c, d;     // a*t^3 + b*t^2 + c*t + d
+    };
+
     ControlArray points;
+    std::vector<SegmentCoefficients> segmentCoefficients;   // [index - index_lo], only for ModeCatmullrom
 
     index_type index_lo;
     index_type index_hi;
@@ -81,6 +88,8 @@ protected:
     typedef void (SplineBase::*InitMethtod)(Vector3 const*, index_type, index_type);
     static InitMethtod initializers[ModesEnd];
 
+    void InitSegmentCoefficients();
+
     void UninitializedSplineEvaluationMethod(index_type, float, Vector3&) const { ABORT(); }
     float UninitializedSplineSegLenghtMethod(index_type) const { ABORT(); return 0.0f; }
     void UninitializedSplineInitMethod(Vector3 const*, index_type, index_type) { ABORT(); }
@@ -128,6 +137,7 @@ public:
     void init_spline_custom(Init& initializer)
     {
         initializer(m_mode, cyclic, points, index_lo, index_hi);
+        InitSegmentCoefficients();
     }
 
     virtual void clear();
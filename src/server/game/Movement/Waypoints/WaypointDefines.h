@@ -22,6 +22,7 @@
 #include "Duration.h"
 #include "EnumFlag.h"
 #include "Optional.h"
+#include <G3D/Vector3.h>
 #include <vector>
 
 static inline constexpr std::size_t WAYPOINT_PATH_FLAG_FOLLOW_PATH_BACKWARDS_MINIMUM_NODES = 2;
@@ -70,6 +71,7 @@ struct WaypointPath
 
     std::vector<WaypointNode> Nodes;
     std::vector<std::pair<std::size_t, std::size_t>> ContinuousSegments;
+    std::vector<G3D::Vector3> Positions;    // positions of Nodes, stored contiguously to be copied straight into spline point arrays
     uint32 Id = 0;
     WaypointMoveType MoveType = WaypointMoveType::Walk;
     EnumFlag<WaypointPathFlags> Flags = WaypointPathFlags::None;
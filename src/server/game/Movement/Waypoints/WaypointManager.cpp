@@ -359,4 +359,9 @@ void WaypointPath::BuildSegments()
         if (i + 1 != Nodes.size() && Nodes[i].Delay)
             ContinuousSegments.emplace_back(i, 1);
     }
+
+    Positions.clear();
+    Positions.reserve(Nodes.size());
+    for (WaypointNode const& node : Nodes)
+        Positions.emplace_back(node.X, node.Y, node.Z);
 }
@@ -63,7 +63,7 @@ OutdoorPvP::~OutdoorPvP() = default;
 
 void OutdoorPvP::HandlePlayerEnterZone(Player* player, uint32 /*zone*/)
 {
-    m_players[player->GetTeamId()].insert(player->GetGUID());
+    m_players[player->GetTeamId()][player->GetGUID()] = player;
 }
 
 void OutdoorPvP::HandlePlayerLeaveZone(Player* player, uint32 /*zone*/)
@@ -162,9 +162,8 @@ void OutdoorPvP::BroadcastPacket(WorldPacket const* data) const
 {
     // This is faster than sWorld->SendZoneMessage
     for (uint32 team = 0; team < PVP_TEAMS_COUNT; ++team)
-        for (GuidSet::const_iterator itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
-            if (Player* const player = ObjectAccessor::FindPlayer(*itr))
-                player->SendDirectMessage(data);
+        for (auto const& [guid, player] : m_players[team])
+            player->SendDirectMessage(data);
 }
 
 void OutdoorPvP::RegisterZone(uint32 zoneId)
@@ -174,23 +173,20 @@ void OutdoorPvP::RegisterZone(uint32 zoneId)
 
 bool OutdoorPvP::HasPlayer(Player const* player) const
 {
-    GuidSet const& plSet = m_players[player->GetTeamId()];
-    return plSet.find(player->GetGUID()) != plSet.end();
+    return m_players[player->GetTeamId()].contains(player->GetGUID());
 }
 
 void OutdoorPvP::TeamCastSpell(TeamId team, int32 spellId)
 {
     if (spellId > 0)
     {
-        for (GuidSet::iterator itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
-            if (Player* const player = ObjectAccessor::FindPlayer(*itr))
-                player->CastSpell(player, (uint32)spellId, true);
+        for (auto const& [guid, player] : m_players[team])
+            player->CastSpell(player, (uint32)spellId, true);
     }
     else
     {
-        for (GuidSet::iterator itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
-            if (Player* const player = ObjectAccessor::FindPlayer(*itr))
-                player->RemoveAura((uint32)-spellId); // by stack?
+        for (auto const& [guid, player] : m_players[team])
+            player->RemoveAura((uint32)-spellId); // by stack?
     }
 }
 
@@ -245,8 +241,7 @@ template<class Worker>
 void OutdoorPvP::BroadcastWorker(Worker& _worker, uint32 zoneId)
 {
     for (uint32 i = 0; i < PVP_TEAMS_COUNT; ++i)
-        for (GuidSet::iterator itr = m_players[i].begin(); itr != m_players[i].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
-                if (player->GetZoneId() == zoneId)
-                    _worker(player);
+        for (auto const& [guid, player] : m_players[i])
+            if (player->GetZoneId() == zoneId)
+                _worker(player);
 }
@@ -18,6 +18,7 @@
 #ifndef OUTDOOR_PVP_H_
 #define OUTDOOR_PVP_H_
 
+#include "FlatHashMap.h"
 #include "Position.h"
 #include "QuaternionData.h"
 #include "SharedDefines.h"
@@ -203,7 +204,8 @@ class TC_GAME_API OutdoorPvP : public ZoneScript
 
         ControlZoneHandlerMap ControlZoneHandlers;
 
-        GuidSet m_players[2];
+        // players currently in the zones of this outdoorpvp, removed when they leave the zone or the world
+        Trinity::Containers::FlatHashMap<ObjectGuid, Player*> m_players[2];
 
         uint32 m_TypeId;
 
@@ -30,12 +30,19 @@
 void PlayerPersonalPhasesTracker::RegisterTrackedObject(uint32 phaseId, WorldObject* object)
 {
     _spawns[phaseId].Objects.insert(object);
+    _objectPhases[object] = phaseId;
 }
 
 void PlayerPersonalPhasesTracker::UnregisterTrackedObject(WorldObject* object)
 {
-    for (auto& [_, spawns] : _spawns)
-        spawns.Objects.erase(object);
+    auto itr = _objectPhases.find(object);
+    if (itr == _objectPhases.end())
+        return;
+
+    if (PersonalPhaseSpawns* spawns = Trinity::Containers::MapGetValuePtr(_spawns, itr->second))
+        spawns->Objects.erase(object);
+
+    _objectPhases.erase(itr);
 }
 
 void PlayerPersonalPhasesTracker::OnOwnerPhasesChanged(WorldObject const* owner)
@@ -106,7 +113,10 @@ void PlayerPersonalPhasesTracker::SetGridUnloaded(uint32 gridId)
 void PlayerPersonalPhasesTracker::DespawnPhase(Map* map, PersonalPhaseSpawns& spawns)
 {
     for (WorldObject* obj : spawns.Objects)
+    {
         map->AddObjectToRemoveList(obj);
+        _objectPhases.erase(obj);
+    }
 
     spawns.Objects.clear();
     spawns.Grids.clear();
@@ -170,6 +180,10 @@ void MultiPersonalPhaseTracker::RegisterTrackedObject(uint32 phaseId, ObjectGuid
 
 void MultiPersonalPhaseTracker::UnregisterTrackedObject(WorldObject* object)
 {
+    // called for every object removed from the map, most of them never had a personal phase owner
+    if (object->GetPhaseShift().GetPersonalGuid().IsEmpty())
+        return;
+
     if (PlayerPersonalPhasesTracker* playerTracker = Trinity::Containers::MapGetValuePtr(_playerData, object->GetPhaseShift().GetPersonalGuid()))
         playerTracker->UnregisterTrackedObject(object);
 }
@@ -62,6 +62,7 @@ private:
     void DespawnPhase(Map* map, PersonalPhaseSpawns& spawns);
 
     std::unordered_map<uint32 /*phaseId*/, PersonalPhaseSpawns> _spawns;
+    std::unordered_map<WorldObject*, uint32 /*phaseId*/> _objectPhases;
 };
 
 /* Handles personal phase trackers for all owners */
@@ -28,6 +28,7 @@ PhaseShift::~PhaseShift() = default;
 bool PhaseShift::AddPhase(uint32 phaseId, PhaseFlags flags, std::vector<Condition> const* areaConditions, int32 references /*= 1*/)
 {
     auto insertResult = Phases.emplace(phaseId, flags, nullptr);
+    PhaseMask |= GetPhaseMaskBit(phaseId);
     ModifyPhasesReferences(insertResult.first, references);
     if (areaConditions)
         insertResult.first->AreaConditions = areaConditions;
@@ -42,7 +43,11 @@ PhaseShift::EraseResult<PhaseShift::PhaseContainer> PhaseShift::RemovePhase(uint
     {
         ModifyPhasesReferences(itr, -1);
         if (!itr->References)
-            return { Phases.erase(itr), true };
+        {
+            auto next = Phases.erase(itr);
+            UpdatePhaseMask();
+            return { next, true };
+        }
         return { itr, false };
     }
     return { Phases.end(), false };
@@ -98,6 +103,7 @@ void PhaseShift::ClearPhases()
     Flags &= PhaseShiftFlags::AlwaysVisible | PhaseShiftFlags::Inverse;
     PersonalGuid.Clear();
     Phases.clear();
+    PhaseMask = 0;
     NonCosmeticReferences = 0;
     CosmeticReferences = 0;
     PersonalReferences = 0;
@@ -118,8 +124,13 @@ bool PhaseShift::CanSee(PhaseShift const& other) const
     if (Flags.HasFlag(PhaseShiftFlags::NoCosmetic) && other.Flags.HasFlag(PhaseShiftFlags::NoCosmetic))
         excludePhasesWithFlag = PhaseFlags::Cosmetic;
 
+    bool const anyPhaseShared = (PhaseMask & other.PhaseMask) != 0;
+
     if (!Flags.HasFlag(PhaseShiftFlags::Inverse) && !other.Flags.HasFlag(PhaseShiftFlags::Inverse))
     {
+        if (!anyPhaseShared)
+            return false;
+
         ObjectGuid ownerGuid = PersonalGuid;
         ObjectGuid otherPersonalGuid = other.PersonalGuid;
         return Trinity::Containers::Intersects(Phases.begin(), Phases.end(), other.Phases.begin(), other.Phases.end(),
@@ -129,11 +140,14 @@ bool PhaseShift::CanSee(PhaseShift const& other) const
         });
     }
 
-    auto checkInversePhaseShift = [excludePhasesWithFlag](PhaseShift const& phaseShift, PhaseShift const& excludedPhaseShift)
+    auto checkInversePhaseShift = [excludePhasesWithFlag, anyPhaseShared](PhaseShift const& phaseShift, PhaseShift const& excludedPhaseShift)
     {
         if (phaseShift.Flags.HasFlag(PhaseShiftFlags::Unphased) && excludedPhaseShift.Flags.HasFlag(PhaseShiftFlags::InverseUnphased))
             return false;
 
+        if (!anyPhaseShared)
+            return true;
+
         for (PhaseRef const& phase : phaseShift.Phases)
         {
             if (phase.Flags.HasFlag(excludePhasesWithFlag))
@@ -188,6 +202,13 @@ void PhaseShift::UpdateUnphasedFlag()
         Flags |= unphasedFlag;
 }
 
+void PhaseShift::UpdatePhaseMask()
+{
+    PhaseMask = 0;
+    for (PhaseRef const& phaseRef : Phases)
+        PhaseMask |= GetPhaseMaskBit(phaseRef.Id);
+}
+
 void PhaseShift::UpdatePersonalGuid()
 {
     if (!PersonalReferences)
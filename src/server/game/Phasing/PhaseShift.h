@@ -115,6 +115,9 @@ public:
 
     bool CanSee(PhaseShift const& other) const;
 
+    // one bit per (phase id % 64), no shared bit means no shared phase
+    uint64 GetPhaseMask() const { return PhaseMask; }
+
     bool HasPersonalPhase() const;
 
 protected:
@@ -128,12 +131,15 @@ protected:
 
     void ModifyPhasesReferences(PhaseContainer::iterator itr, int32 references);
     void UpdateUnphasedFlag();
+    void UpdatePhaseMask();
+    static constexpr uint64 GetPhaseMaskBit(uint32 phaseId) { return UI64LIT(1) << (phaseId % 64); }
     void UpdatePersonalGuid();
     int32 NonCosmeticReferences = 0;
     int32 CosmeticReferences = 0;
     int32 PersonalReferences = 0;
     int32 DefaultReferences = 0;
     bool IsDbPhaseShift = false;
+    uint64 PhaseMask = 0;
 };
 
 #endif // PhaseShift_h__
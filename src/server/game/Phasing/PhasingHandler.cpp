@@ -403,6 +403,9 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
             ++itr;
     }
 
+    phaseShift.UpdatePhaseMask();
+    suppressedPhaseShift.UpdatePhaseMask();
+
     for (auto itr = phaseShift.VisibleMapIds.begin(); itr != phaseShift.VisibleMapIds.end();)
     {
         if (!sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
@@ -695,6 +698,9 @@ void PhasingHandler::UpdateVisibilityIfNeeded(WorldObject* object, bool updateVi
 {
     if (changed && object->IsInWorld())
     {
+        // cached line of sight results of this object or of its gameobject model were checked in the old phases
+        object->GetMap()->InvalidateLineOfSightCache();
+
         if (Player* player = object->ToPlayer())
             SendToPlayer(player);
 
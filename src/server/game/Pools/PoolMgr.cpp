@@ -322,12 +322,21 @@ void PoolGroup<T>::SpawnObject(SpawnedPoolData& spawns, uint32 limit, uint64 tri
 
         if (!EqualChanced.empty() && rolledObjects.empty())
         {
-            std::copy_if(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(rolledObjects), [triggerFrom, &spawns](PoolObject const& object)
+            // pick count random candidates in a single pass (reservoir sampling)
+            // instead of copying every candidate and shrinking the list afterwards
+            uint32 candidates = 0;
+            for (PoolObject const& obj : EqualChanced)
             {
-                return object.guid == triggerFrom || !spawns.IsSpawnedObject<T>(object.guid);
-            });
+                if (obj.guid != triggerFrom && spawns.IsSpawnedObject<T>(obj.guid))
+                    continue;
+
+                if (candidates < uint32(count))
+                    rolledObjects.push_back(obj);
+                else if (uint32 slot = urand(0, candidates); slot < uint32(count))
+                    rolledObjects[slot] = obj;
 
-            Trinity::Containers::RandomResize(rolledObjects, count);
+                ++candidates;
+            }
         }
 
         // try to spawn rolled objects
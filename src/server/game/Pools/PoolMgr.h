@@ -19,6 +19,7 @@
 #define TRINITY_POOLHANDLER_H
 
 #include "Define.h"
+#include "FlatHashMap.h"
 #include "SpawnData.h"
 #include <map>
 #include <memory>
@@ -48,8 +49,8 @@ class Pool                                                  // for Pool of Pool
 {
 };
 
-typedef std::set<uint64> SpawnedPoolObjects;
-typedef std::map<uint64, uint32> SpawnedPoolPools;
+typedef Trinity::Containers::FlatHashSet<uint64> SpawnedPoolObjects;
+typedef Trinity::Containers::FlatHashMap<uint64, uint32> SpawnedPoolPools;
 
 class TC_GAME_API SpawnedPoolData
 {
@@ -164,7 +165,7 @@ class TC_GAME_API PoolMgr
         typedef std::unordered_map<uint32, PoolGroup<GameObject>> PoolGroupGameObjectMap;
         typedef std::unordered_map<uint32, PoolGroup<Pool>>       PoolGroupPoolMap;
         typedef std::pair<uint64, uint32> SearchPair;
-        typedef std::map<uint64, uint32> SearchMap;
+        typedef Trinity::Containers::FlatHashMap<uint64, uint32> SearchMap;
 
         PoolTemplateDataMap    mPoolTemplate;
         PoolGroupCreatureMap   mPoolCreatureGroups;
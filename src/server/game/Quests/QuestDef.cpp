@@ -317,7 +317,7 @@ void Quest::LoadQuestObjectiveVisualEffect(Field* fields)
 void Quest::LoadConditionalConditionalQuestDescription(Field* fields)
 {
     LocaleConstant locale = GetLocaleByName(fields[4].GetStringView());
-    if (!sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && locale != DEFAULT_LOCALE)
+    if (!sWorld->IsLocaleLoaded(locale))
         return;
 
     if (locale >= TOTAL_LOCALES)
@@ -340,7 +340,7 @@ void Quest::LoadConditionalConditionalQuestDescription(Field* fields)
 void Quest::LoadConditionalConditionalRequestItemsText(Field* fields)
 {
     LocaleConstant locale = GetLocaleByName(fields[4].GetStringView());
-    if (!sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && locale != DEFAULT_LOCALE)
+    if (!sWorld->IsLocaleLoaded(locale))
         return;
 
     if (locale >= TOTAL_LOCALES)
@@ -363,7 +363,7 @@ void Quest::LoadConditionalConditionalRequestItemsText(Field* fields)
 void Quest::LoadConditionalConditionalOfferRewardText(Field* fields)
 {
     LocaleConstant locale = GetLocaleByName(fields[4].GetStringView());
-    if (!sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && locale != DEFAULT_LOCALE)
+    if (!sWorld->IsLocaleLoaded(locale))
         return;
 
     if (locale >= TOTAL_LOCALES)
@@ -386,7 +386,7 @@ void Quest::LoadConditionalConditionalOfferRewardText(Field* fields)
 void Quest::LoadConditionalConditionalQuestCompletionLog(Field* fields)
 {
     LocaleConstant locale = GetLocaleByName(fields[4].GetStringView());
-    if (!sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && locale != DEFAULT_LOCALE)
+    if (!sWorld->IsLocaleLoaded(locale))
         return;
 
     if (locale >= TOTAL_LOCALES)
@@ -638,7 +638,7 @@ void Quest::InitializeQueryData()
 {
     for (uint8 loc = LOCALE_enUS; loc < TOTAL_LOCALES; ++loc)
     {
-        if (!sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && loc != DEFAULT_LOCALE)
+        if (!sWorld->IsLocaleLoaded(LocaleConstant(loc)))
             continue;
 
         QueryData[loc] = BuildQueryData(static_cast<LocaleConstant>(loc), nullptr);
@@ -26,6 +26,7 @@
 #include "CreatureAI.h"
 #include "CreatureAIImpl.h"
 #include "CreatureAISelector.h"
+#include "CpuTime.h"
 #include "DB2Stores.h"
 #include "Errors.h"
 #include "GameObject.h"
@@ -51,6 +52,10 @@
 #include "Vehicle.h"
 #include "Weather.h"
 #include "WorldPacket.h"
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
 #include <unordered_map>
 
 // Trait which indicates whether this script type
@@ -399,13 +404,13 @@ class CreatureGameObjectAreaTriggerConversationScriptRegistrySwapHooks
         AIFunctionMapWorker(T&& worker)
             : _worker(std::forward<T>(worker)) { }
 
-        void Visit(std::unordered_map<ObjectGuid, ObjectType*>& objects)
+        void Visit(Trinity::Containers::FlatHashMap<ObjectGuid, ObjectType*>& objects)
         {
             _worker(objects);
         }
 
         template<typename O>
-        void Visit(std::unordered_map<ObjectGuid, O*>&) { }
+        void Visit(Trinity::Containers::FlatHashMap<ObjectGuid, O*>&) { }
 
     private:
         W _worker;
@@ -605,7 +610,7 @@ class CreatureGameObjectAreaTriggerConversationScriptRegistrySwapHooks
     {
         return [&idsToRemove](Map* map, auto&& visitor)
         {
-            auto evaluator = [&](std::unordered_map<ObjectGuid, ObjectType*>& objects)
+            auto evaluator = [&](Trinity::Containers::FlatHashMap<ObjectGuid, ObjectType*>& objects)
             {
                 for (auto object : objects)
                 {
@@ -628,7 +633,7 @@ class CreatureGameObjectAreaTriggerConversationScriptRegistrySwapHooks
     {
         return [](Map* map, auto&& visitor)
         {
-            auto evaluator = [&](std::unordered_map<ObjectGuid, ObjectType*>& objects)
+            auto evaluator = [&](Trinity::Containers::FlatHashMap<ObjectGuid, ObjectType*>& objects)
             {
                 for (auto object : objects)
                 {
@@ -993,6 +998,89 @@ private:
     bool swapped;
 };
 
+namespace
+{
+// Set by the default implementation of a tracked hook, tells the caller that the script it called does not override it
+thread_local bool ScriptHookDefaultReached = false;
+
+// Hooks called often enough to only be dispatched to the scripts overriding them
+enum class TrackedScriptHook : uint8
+{
+    ServerPacketSend,
+    ServerPacketReceive,
+    WorldUpdate,
+    PlayerSpellCast,
+    PlayerUpdateZone,
+
+    Max
+};
+
+/**
+ * Scripts of one type that may override a hook.
+ * Overrides cannot be detected when scripts register, so every script is called until it reaches
+ * the default implementation of the hook once and is skipped from then on.
+ */
+class ScriptHookOverrides
+{
+public:
+    void Reset(std::vector<ScriptObject*> scripts)
+    {
+        _usesDefault = std::make_unique<std::atomic<bool>[]>(scripts.size());
+        _scripts = std::move(scripts);
+        _overridingCount.store(_scripts.size(), std::memory_order_relaxed);
+    }
+
+    bool IsEmpty() const { return _overridingCount.load(std::memory_order_relaxed) == 0; }
+
+    template<class ScriptType, typename Hook>
+    void Call(Hook&& hook)
+    {
+        for (std::size_t i = 0; i < _scripts.size(); ++i)
+        {
+            if (_usesDefault[i].load(std::memory_order_relaxed))
+                continue;
+
+            // reset after the call as well, hooks dispatched from within the script must not mark it
+            ScriptHookDefaultReached = false;
+            hook(static_cast<ScriptType*>(_scripts[i]));
+            if (std::exchange(ScriptHookDefaultReached, false) && !_usesDefault[i].exchange(true, std::memory_order_relaxed))
+                _overridingCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::vector<ScriptObject*> _scripts;
+    std::unique_ptr<std::atomic<bool>[]> _usesDefault;
+    std::atomic<std::size_t> _overridingCount = 0;
+};
+
+template<class ScriptType>
+std::array<ScriptHookOverrides, size_t(TrackedScriptHook::Max)>& GetScriptHookOverrideLists()
+{
+    static std::array<ScriptHookOverrides, size_t(TrackedScriptHook::Max)> lists;
+    return lists;
+}
+
+template<class ScriptType>
+ScriptHookOverrides& GetScriptHookOverrides(TrackedScriptHook hook)
+{
+    return GetScriptHookOverrideLists<ScriptType>()[size_t(hook)];
+}
+
+// Called whenever scripts of a type are added or removed, every script is assumed to override everything again
+template<class ScriptType, class ScriptStore>
+void ResetScriptHookOverrides(ScriptStore const& store)
+{
+    std::vector<ScriptObject*> scripts;
+    scripts.reserve(store.size());
+    for (auto const& [_, script] : store)
+        scripts.push_back(script.get());
+
+    for (ScriptHookOverrides& overrides : GetScriptHookOverrideLists<ScriptType>())
+        overrides.Reset(scripts);
+}
+}
+
 // Database bound script registry
 template<typename ScriptType>
 class SpecializedScriptRegistry<ScriptType, true>
@@ -1181,6 +1269,7 @@ public:
         this->BeforeReleaseContext(context);
 
         _scripts.erase(context);
+        ResetScriptHookOverrides<ScriptType>(_scripts);
     }
 
     void SwapContext(bool initialize) final override
@@ -1199,6 +1288,7 @@ public:
         this->BeforeUnload();
 
         _scripts.clear();
+        ResetScriptHookOverrides<ScriptType>(_scripts);
     }
 
     void SyncScriptNames() final override
@@ -1227,6 +1317,7 @@ public:
 
         // We're dealing with a code-only script, just add it.
         _scripts.insert(std::make_pair(sScriptMgr->GetCurrentScriptContext(), std::move(script_ptr)));
+        ResetScriptHookOverrides<ScriptType>(_scripts);
     }
 
     ScriptStoreType& GetScripts()
@@ -1256,9 +1347,46 @@ private:
     for (SCR_REG_ITR(T) C = SCR_REG_LST(T).begin(); \
         C != SCR_REG_LST(T).end(); ++C)
 
+namespace
+{
+struct ScriptHookCpuTime
+{
+    explicit ScriptHookCpuTime(char const* scriptType) : ScriptType(scriptType) { }
+
+    char const* ScriptType;
+    Trinity::CpuTimeCounter Counter;
+};
+
+std::mutex ScriptHookCpuTimesLock;
+std::deque<ScriptHookCpuTime> ScriptHookCpuTimes; // deque keeps counters in place while growing
+
+Trinity::CpuTimeCounter& RegisterScriptHookCpuTime(char const* scriptType)
+{
+    std::lock_guard lock(ScriptHookCpuTimesLock);
+    return ScriptHookCpuTimes.emplace_back(scriptType).Counter;
+}
+
+template<class ScriptType>
+Trinity::CpuTimeCounter& GetScriptHookCpuTime(char const* scriptType)
+{
+    static Trinity::CpuTimeCounter& counter = RegisterScriptHookCpuTime(scriptType);
+    return counter;
+}
+}
+
+// Calls a hook on all scripts of a type, counting the time spent towards the script type
 #define FOREACH_SCRIPT(T) \
-    FOR_SCRIPTS(T, itr, end) \
-        itr->second
+    if (!SCR_REG_LST(T).empty()) \
+        if (Trinity::CpuTimeScope scriptHookCpuTime(GetScriptHookCpuTime<T>(#T)); true) \
+            for (SCR_REG_ITR(T) itr = SCR_REG_LST(T).begin(); \
+                itr != SCR_REG_LST(T).end(); ++itr) \
+                itr->second
+
+// Calls a tracked hook on the scripts of a type overriding it, no script overriding it costs a single check
+#define FOREACH_OVERRIDING_SCRIPT(T, H, ...) \
+    if (ScriptHookOverrides& hookOverrides = GetScriptHookOverrides<T>(TrackedScriptHook::H); !hookOverrides.IsEmpty()) \
+        if (Trinity::CpuTimeScope scriptHookCpuTime(GetScriptHookCpuTime<T>(#T)); true) \
+            hookOverrides.Call<T>([&](T* script) { script->__VA_ARGS__; })
 
 // Utility macros for finding specific scripts.
 #define GET_SCRIPT(T, I, V) \
@@ -1271,6 +1399,17 @@ private:
     if (!V) \
         return R;
 
+std::vector<std::pair<char const*, Trinity::CpuTimeCounter*>> ScriptMgr::GetHookCpuTimeCounters() const
+{
+    std::vector<std::pair<char const*, Trinity::CpuTimeCounter*>> counters;
+    std::lock_guard lock(ScriptHookCpuTimesLock);
+    counters.reserve(ScriptHookCpuTimes.size());
+    for (ScriptHookCpuTime& hookCpuTime : ScriptHookCpuTimes)
+        counters.emplace_back(hookCpuTime.ScriptType, &hookCpuTime.Counter);
+
+    return counters;
+}
+
 ScriptObject::ScriptObject(char const* name) noexcept : _name(name)
 {
     sScriptMgr->IncreaseScriptCount();
@@ -1495,22 +1634,23 @@ void ScriptMgr::OnSocketClose(std::shared_ptr<WorldSocket> const& socket)
 
 void ScriptMgr::OnPacketReceive(WorldSession* session, WorldPacket const& packet)
 {
-    if (SCR_REG_LST(ServerScript).empty())
+    if (GetScriptHookOverrides<ServerScript>(TrackedScriptHook::ServerPacketReceive).IsEmpty())
         return;
 
     WorldPacket copy(packet);
-    FOREACH_SCRIPT(ServerScript)->OnPacketReceive(session, copy);
+    copy.rpos(0); // packets decoded on network threads were already read
+    FOREACH_OVERRIDING_SCRIPT(ServerScript, ServerPacketReceive, OnPacketReceive(session, copy));
 }
 
 void ScriptMgr::OnPacketSend(WorldSession* session, WorldPacket const& packet)
 {
     ASSERT(session);
 
-    if (SCR_REG_LST(ServerScript).empty())
+    if (GetScriptHookOverrides<ServerScript>(TrackedScriptHook::ServerPacketSend).IsEmpty())
         return;
 
     WorldPacket copy(packet);
-    FOREACH_SCRIPT(ServerScript)->OnPacketSend(session, copy);
+    FOREACH_OVERRIDING_SCRIPT(ServerScript, ServerPacketSend, OnPacketSend(session, copy));
 }
 
 void ScriptMgr::OnOpenStateChange(bool open)
@@ -1540,7 +1680,7 @@ void ScriptMgr::OnShutdownCancel()
 
 void ScriptMgr::OnWorldUpdate(uint32 diff)
 {
-    FOREACH_SCRIPT(WorldScript)->OnUpdate(diff);
+    FOREACH_OVERRIDING_SCRIPT(WorldScript, WorldUpdate, OnUpdate(diff));
 }
 
 void ScriptMgr::OnHonorCalculation(float& honor, uint8 level, float multiplier)
@@ -2097,7 +2237,7 @@ void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emote
 
 void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnSpellCast(player, spell, skipCheck);
+    FOREACH_OVERRIDING_SCRIPT(PlayerScript, PlayerSpellCast, OnSpellCast(player, spell, skipCheck));
 }
 
 void ScriptMgr::OnPlayerLogin(Player* player, bool firstLogin)
@@ -2137,7 +2277,7 @@ void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, ui
 
 void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newArea)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnUpdateZone(player, newZone, newArea);
+    FOREACH_OVERRIDING_SCRIPT(PlayerScript, PlayerUpdateZone, OnUpdateZone(player, newZone, newArea));
 }
 
 void ScriptMgr::OnQuestStatusChange(Player* player, uint32 questId)
@@ -2434,10 +2574,12 @@ void ServerScript::OnSocketClose(std::shared_ptr<WorldSocket> /*socket*/)
 
 void ServerScript::OnPacketSend(WorldSession* /*session*/, WorldPacket& /*packet*/)
 {
+    ScriptHookDefaultReached = true;
 }
 
 void ServerScript::OnPacketReceive(WorldSession* /*session*/, WorldPacket& /*packet*/)
 {
+    ScriptHookDefaultReached = true;
 }
 
 WorldScript::WorldScript(char const* name) noexcept
@@ -2470,6 +2612,7 @@ void WorldScript::OnShutdownCancel()
 
 void WorldScript::OnUpdate(uint32 /*diff*/)
 {
+    ScriptHookDefaultReached = true;
 }
 
 void WorldScript::OnStartup()
@@ -2979,6 +3122,7 @@ void PlayerScript::OnTextEmote(Player* /*player*/, uint32 /*textEmote*/, uint32
 
 void PlayerScript::OnSpellCast(Player* /*player*/, Spell* /*spell*/, bool /*skipCheck*/)
 {
+    ScriptHookDefaultReached = true;
 }
 
 void PlayerScript::OnLogin(Player* /*player*/, bool /*firstLogin*/)
@@ -3011,6 +3155,7 @@ void PlayerScript::OnBindToInstance(Player* /*player*/, Difficulty /*difficulty*
 
 void PlayerScript::OnUpdateZone(Player* /*player*/, uint32 /*newZone*/, uint32 /*newArea*/)
 {
+    ScriptHookDefaultReached = true;
 }
 
 void PlayerScript::OnMapChanged(Player* /*player*/)
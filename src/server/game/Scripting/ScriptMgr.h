@@ -83,6 +83,7 @@ struct QuestObjective;
 struct SceneTemplate;
 struct WorldStateTemplate;
 
+namespace Trinity { struct CpuTimeCounter; }
 namespace Trinity::ChatCommands { struct ChatCommandBuilder; }
 
 enum BattlegroundTypeId : uint32;
@@ -238,10 +239,12 @@ class TC_GAME_API ServerScript : public ScriptObject
 
         // Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading
         // and modifying it is safe.
+        // Only dispatched to overriding scripts, overrides must not call the base implementation.
         virtual void OnPacketSend(WorldSession* session, WorldPacket& packet);
 
         // Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so
         // reading and modifying it is safe. Make sure to check WorldSession pointer before usage, it might be null in case of auth packets
+        // Only dispatched to overriding scripts, overrides must not call the base implementation.
         virtual void OnPacketReceive(WorldSession* session, WorldPacket& packet);
 };
 
@@ -271,6 +274,7 @@ class TC_GAME_API WorldScript : public ScriptObject
         virtual void OnShutdownCancel();
 
         // Called on every world tick (don't execute too heavy code here).
+        // Only dispatched to overriding scripts, overrides must not call the base implementation.
         virtual void OnUpdate(uint32 diff);
 
         // Called when the world is started.
@@ -754,6 +758,7 @@ class TC_GAME_API PlayerScript : public ScriptObject
         virtual void OnTextEmote(Player* player, uint32 textEmote, uint32 emoteNum, ObjectGuid guid);
 
         // Called in Spell::Cast.
+        // Only dispatched to overriding scripts, overrides must not call the base implementation.
         virtual void OnSpellCast(Player* player, Spell* spell, bool skipCheck);
 
         // Called when a player logs in.
@@ -778,6 +783,7 @@ class TC_GAME_API PlayerScript : public ScriptObject
         virtual void OnBindToInstance(Player* player, Difficulty difficulty, uint32 mapId, bool permanent, uint8 extendState);
 
         // Called when a player switches to a new zone
+        // Only dispatched to overriding scripts, overrides must not call the base implementation.
         virtual void OnUpdateZone(Player* player, uint32 newZone, uint32 newArea);
 
         // Called when a player changes to a new map (after moving to new map)
@@ -1037,6 +1043,9 @@ class TC_GAME_API ScriptMgr
 
         uint32 GetScriptCount() const { return _scriptCount; }
 
+        /// CPU time spent in the hooks of each script type that was called at least once, by script type name
+        std::vector<std::pair<char const*, Trinity::CpuTimeCounter*>> GetHookCpuTimeCounters() const;
+
         typedef void(*ScriptLoaderCallbackType)();
 
         /// Sets the script loader callback which is invoked to load scripts
@@ -659,6 +659,9 @@ public:
             _build_job.reset();
         }
 
+        // Wait for all background loads, the loaded modules are released with them
+        _pending_script_modules.clear();
+
         // Release all strong references to script modules
         // to trigger unload actions as early as possible,
         // otherwise the worldserver will crash on exit.
@@ -818,6 +821,33 @@ private:
     /// load/unload/reload requests of shared libraries.
     void DispatchModuleChanges()
     {
+        // Swap in all modules which finished loading in the background
+        for (auto itr = _pending_script_modules.begin(); itr != _pending_script_modules.end();)
+        {
+            if (itr->second.wait_for(0s) != std::future_status::ready)
+            {
+                ++itr;
+                continue;
+            }
+
+            fs::path const path = itr->first;
+            Optional<std::shared_ptr<ScriptModule>> module = itr->second.get();
+            itr = _pending_script_modules.erase(itr);
+
+            if (!module)
+            {
+                TC_LOG_ERROR("scripts.hotswap", ">> Failed to load script module \"{}\", "
+                    "keeping the currently running version (if any).",
+                    path.filename().generic_string());
+                continue;
+            }
+
+            if (_running_script_module_names.find(path) != _running_script_module_names.end())
+                ProcessUnloadScriptModule(path, false);
+
+            RegisterScriptModule(path, std::move(*module));
+        }
+
         // When there are no libraries to change return
         if (_libraries_changed.empty())
             return;
@@ -826,57 +856,71 @@ private:
         if (GetMSTimeDiffToNow(_last_time_library_changed) < 500)
             return;
 
+        std::unordered_set<fs::path> deferred;
         for (auto const& path : _libraries_changed)
         {
+            // Retry on a later tick when the previous version is still loading
+            if (_pending_script_modules.find(path) != _pending_script_modules.end())
+            {
+                deferred.insert(path);
+                continue;
+            }
+
             bool const is_running =
                 _running_script_module_names.find(path) != _running_script_module_names.end();
 
-            bool const exists = fs::exists(path);
-
-            if (is_running)
-            {
-                if (exists)
-                    ProcessReloadScriptModule(path);
-                else
-                    ProcessUnloadScriptModule(path);
-            }
-            else if (exists)
-                ProcessLoadScriptModule(path);
+            if (fs::exists(path))
+                ScheduleLoadScriptModule(path);
+            else if (is_running)
+                ProcessUnloadScriptModule(path);
         }
 
-        _libraries_changed.clear();
+        _libraries_changed = std::move(deferred);
     }
 
-    void ProcessLoadScriptModule(fs::path const& path, bool swap_context = true)
+    /// Copies the shared library into the cache and opens it,
+    /// this doesn't touch any state of the reloader and is safe to call
+    /// from any thread.
+    static Optional<std::shared_ptr<ScriptModule>> LoadScriptModuleLibrary(fs::path const& path, fs::path const& cache_path)
     {
-        ASSERT(_running_script_module_names.find(path) == _running_script_module_names.end(),
-               "Can't load a module which is running already!");
-
-        // Copy the shared library into a cache
-        auto cache_path = GenerateUniquePathForLibraryInCache(path);
-
         {
             boost::system::error_code code;
             fs::copy_file(path, cache_path, code);
             if (code)
             {
-                TC_LOG_FATAL("scripts.hotswap", ">> Failed to create cache entry for module "
+                TC_LOG_ERROR("scripts.hotswap", ">> Failed to create cache entry for module "
                     "\"{}\" at \"{}\" with reason (\"{}\")!",
                     path.filename().generic_string(), cache_path.generic_string(),
                     code.message());
-
-                // Find a better solution for this but it's much better
-                // to start the core without scripts
-                std::this_thread::sleep_for(std::chrono::seconds(5));
-                ABORT();
-                return;
+                return {};
             }
 
             TC_LOG_TRACE("scripts.hotswap", ">> Copied the shared library \"{}\" to \"{}\" for caching.",
                 path.filename().generic_string(), cache_path.generic_string());
         }
 
-        auto module = ScriptModule::CreateFromPath(path, cache_path);
+        return ScriptModule::CreateFromPath(path, cache_path);
+    }
+
+    /// Loads the shared library of a changed module in the background,
+    /// the module replaces the running one on the world tick which observes
+    /// the finished load.
+    void ScheduleLoadScriptModule(fs::path const& path)
+    {
+        // The cache path is generated here since the name counter isn't thread safe
+        fs::path cache_path = GenerateUniquePathForLibraryInCache(path);
+
+        _pending_script_modules.emplace(path, std::async(std::launch::async,
+            [path, cache_path = std::move(cache_path)]
+            {
+                return LoadScriptModuleLibrary(path, cache_path);
+            }));
+    }
+
+    /// Loads the module synchronously, used on startup only.
+    void ProcessLoadScriptModule(fs::path const& path, bool swap_context = true)
+    {
+        auto module = LoadScriptModuleLibrary(path, GenerateUniquePathForLibraryInCache(path));
         if (!module)
         {
             TC_LOG_FATAL("scripts.hotswap", ">> Failed to load script module \"{}\"!",
@@ -889,12 +933,22 @@ private:
             return;
         }
 
+        RegisterScriptModule(path, std::move(*module), swap_context);
+    }
+
+    /// Registers a loaded module and its scripts,
+    /// needs to be called from the world thread.
+    void RegisterScriptModule(fs::path const& path, std::shared_ptr<ScriptModule> module, bool swap_context = true)
+    {
+        ASSERT(_running_script_module_names.find(path) == _running_script_module_names.end(),
+               "Can't load a module which is running already!");
+
         // Limit the git revision hash to 7 characters.
-        std::string module_revision((*module)->GetScriptModuleRevisionHash());
+        std::string module_revision(module->GetScriptModuleRevisionHash());
         if (module_revision.size() >= 7)
             module_revision = module_revision.substr(0, 7);
 
-        std::string const module_name = (*module)->GetScriptModule();
+        std::string const module_name = module->GetScriptModule();
         TC_LOG_INFO("scripts.hotswap", ">> Loaded script module \"{}\" (\"{}\" - {}).",
             path.filename().generic_string(), module_name, module_revision);
 
@@ -935,26 +989,20 @@ private:
             module_name);
 
         // Store the module
-        _known_modules_build_directives.insert(std::make_pair(module_name, (*module)->GetBuildDirective()));
+        _known_modules_build_directives.insert(std::make_pair(module_name, module->GetBuildDirective()));
         _running_script_modules.insert(std::make_pair(module_name,
-            std::make_pair(*module, std::move(listener))));
+            std::make_pair(module, std::move(listener))));
         _running_script_module_names.insert(std::make_pair(path, module_name));
 
         // Process the script loading after the module was registered correctly (#17557).
         sScriptMgr->SetScriptContext(module_name);
-        (*module)->AddScripts();
+        module->AddScripts();
         TC_LOG_TRACE("scripts.hotswap", ">> Registered all scripts of module {}.", module_name);
 
         if (swap_context)
             sScriptMgr->SwapScriptContext();
     }
 
-    void ProcessReloadScriptModule(fs::path const& path)
-    {
-        ProcessUnloadScriptModule(path, false);
-        ProcessLoadScriptModule(path);
-    }
-
     void ProcessUnloadScriptModule(fs::path const& path, bool finish = true)
     {
         auto const itr = _running_script_module_names.find(path);
@@ -1405,6 +1453,9 @@ private:
     > _running_script_modules;
     // Container which maps the path of a shared library to it's module name
     std::unordered_map<fs::path, std::string /*module name*/>  _running_script_module_names;
+    // Modules which are loaded in the background and swapped in once ready
+    std::unordered_map<fs::path /*path*/,
+        std::future<Optional<std::shared_ptr<ScriptModule>>>> _pending_script_modules;
     // Container which maps the module name to it's last known build directive
     std::unordered_map<std::string /*module name*/, std::string /*build directive*/> _known_modules_build_directives;
 
@@ -0,0 +1,414 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoadGenerator.h"
+#include "GameTime.h"
+#include "Log.h"
+#include "Map.h"
+#include "MapManager.h"
+#include "MemoryAccounting.h"
+#include "MovementPackets.h"
+#include "Player.h"
+#include "Random.h"
+#include "RealmList.h"
+#include "StringFormat.h"
+#include "World.h"
+#include "WorldSession.h"
+#include <algorithm>
+#include <array>
+#include <map>
+#include <vector>
+
+namespace
+{
+enum class BotState : uint8
+{
+    Connecting,             // waiting for World::AddSession_
+    EnumeratingCharacters,  // CMSG_ENUM_CHARACTERS queued
+    LoggingIn,              // CMSG_PLAYER_LOGIN queued
+    InWorld
+};
+
+struct Bot
+{
+    uint32 AccountId = 0;
+    BotState State = BotState::Connecting;
+    Milliseconds StateTime = 0ms;
+    Milliseconds MoveTimer = 0ms;
+    Milliseconds ChatTimer = 0ms;
+    std::vector<Position> Waypoints;
+    std::size_t NextWaypoint = 0;
+    bool StartedSegment = false;
+    uint32 ChatCount = 0;
+};
+
+struct MapUpdateStats
+{
+    std::string Name;
+    Microseconds Total = Microseconds::zero();
+    Microseconds Max = Microseconds::zero();
+    uint64 Updates = 0;
+};
+
+// bots that make no progress for this long outside of the world are dropped
+constexpr Milliseconds StateTimeout = 60s;
+constexpr Milliseconds MoveInterval = 500ms;
+constexpr std::size_t WaypointCount = 8;
+
+bool Running = false;
+LoadGenerator::Settings CurrentSettings;
+std::vector<Bot> Bots;
+TimePoint StartTime;
+uint32 DroppedBots = 0;
+
+std::vector<uint32> WorldUpdateTimes;   // microseconds
+std::map<std::pair<uint32, uint32>, MapUpdateStats> MapUpdateTimes;
+std::array<Trinity::MemoryDomainStats, size_t(Trinity::MemoryDomain::Max)> StartMemory;
+
+void QueueClientPacket(WorldSession* session, WorldPacket&& packet)
+{
+    packet.SetReceiveTime(std::chrono::steady_clock::now());
+    session->QueuePacket(new ReceivedWorldPacket(std::move(packet)));
+}
+
+void BuildWaypoints(Bot& bot, Player const* player)
+{
+    bot.Waypoints.clear();
+    float startAngle = frand(0.0f, 2.0f * float(M_PI));
+    for (std::size_t i = 0; i < WaypointCount; ++i)
+    {
+        float angle = startAngle + 2.0f * float(M_PI) * float(i) / float(WaypointCount);
+        float x = player->GetPositionX() + CurrentSettings.WalkRadius * std::cos(angle);
+        float y = player->GetPositionY() + CurrentSettings.WalkRadius * std::sin(angle);
+        float z = player->GetPositionZ();
+        player->UpdateGroundPositionZ(x, y, z);
+        bot.Waypoints.emplace_back(x, y, z);
+    }
+
+    bot.NextWaypoint = 0;
+    bot.StartedSegment = false;
+}
+
+void SendMovement(Bot& bot, WorldSession* session, Player* player)
+{
+    Position const& target = bot.Waypoints[bot.NextWaypoint];
+    float step = player->GetSpeed(MOVE_RUN) * float(MoveInterval.count()) / float(IN_MILLISECONDS);
+    float distance = player->GetExactDist2d(target);
+
+    MovementInfo movementInfo;
+    movementInfo.guid = player->GetGUID();
+    movementInfo.time = GameTime::GetGameTimeMS();
+    movementInfo.AddMovementFlag(MOVEMENTFLAG_FORWARD);
+
+    float orientation = player->GetAbsoluteAngle(target);
+    if (distance <= step)
+    {
+        movementInfo.pos.Relocate(target.GetPositionX(), target.GetPositionY(), target.GetPositionZ(), orientation);
+        bot.NextWaypoint = (bot.NextWaypoint + 1) % bot.Waypoints.size();
+    }
+    else
+    {
+        float x = player->GetPositionX() + step * std::cos(orientation);
+        float y = player->GetPositionY() + step * std::sin(orientation);
+        float z = player->GetPositionZ();
+        player->UpdateGroundPositionZ(x, y, z);
+        movementInfo.pos.Relocate(x, y, z, orientation);
+    }
+
+    // same payload as WorldPackets::Movement::ClientPlayerMovement::Read expects
+    WorldPacket packet(bot.StartedSegment ? CMSG_MOVE_HEARTBEAT : CMSG_MOVE_START_FORWARD);
+    packet << movementInfo;
+    QueueClientPacket(session, std::move(packet));
+    bot.StartedSegment = true;
+}
+
+void SendChat(Bot& bot, WorldSession* session, Player const* player)
+{
+    std::string text = Trinity::StringFormat("loadgen {}", ++bot.ChatCount);
+
+    // same payload as WorldPackets::Chat::ChatMessage::Read expects
+    WorldPacket packet(CMSG_CHAT_MESSAGE_SAY);
+    packet << int32(player->GetTeam() == ALLIANCE ? LANG_COMMON : LANG_ORCISH);
+    packet.WriteBits(text.length(), 11);
+    packet.WriteBit(false);     // IsSecure
+    packet.FlushBits();
+    packet.WriteString(text);
+    QueueClientPacket(session, std::move(packet));
+}
+
+Milliseconds RandomChatDelay()
+{
+    Milliseconds interval = std::chrono::duration_cast<Milliseconds>(CurrentSettings.ChatInterval);
+    return randtime(interval / 2, interval + interval / 2);
+}
+
+void SetState(Bot& bot, BotState state)
+{
+    bot.State = state;
+    bot.StateTime = 0ms;
+}
+
+// returns false when the bot must be dropped
+bool UpdateBot(Bot& bot, Milliseconds diff)
+{
+    bot.StateTime += diff;
+
+    WorldSession* session = sWorld->FindSession(bot.AccountId);
+    if (!session || !session->IsSimulated())
+    {
+        if (bot.State != BotState::Connecting || bot.StateTime >= StateTimeout)
+            return false;
+
+        return true;
+    }
+
+    switch (bot.State)
+    {
+        case BotState::Connecting:
+            QueueClientPacket(session, WorldPacket(CMSG_ENUM_CHARACTERS));
+            SetState(bot, BotState::EnumeratingCharacters);
+            break;
+        case BotState::EnumeratingCharacters:
+        {
+            if (session->GetLegitCharacters().empty())
+                break;
+
+            WorldPacket packet(CMSG_PLAYER_LOGIN);
+            packet << *session->GetLegitCharacters().begin();
+            packet << float(0.0f);     // FarClip
+            QueueClientPacket(session, std::move(packet));
+            SetState(bot, BotState::LoggingIn);
+            break;
+        }
+        case BotState::LoggingIn:
+        {
+            Player* player = session->GetPlayer();
+            if (!player || !player->IsInWorld() || session->PlayerLoading())
+                break;
+
+            // replies of the client to SMSG_RESUME_COMMS and SMSG_MOVE_SET_ACTIVE_MOVER
+            WorldPacket queuedMessagesEnd(CMSG_QUEUED_MESSAGES_END);
+            queuedMessagesEnd << uint32(GameTime::GetGameTimeMS());
+            QueueClientPacket(session, std::move(queuedMessagesEnd));
+
+            WorldPacket initActiveMoverComplete(CMSG_MOVE_INIT_ACTIVE_MOVER_COMPLETE);
+            initActiveMoverComplete << uint32(GameTime::GetGameTimeMS());
+            QueueClientPacket(session, std::move(initActiveMoverComplete));
+
+            BuildWaypoints(bot, player);
+            bot.MoveTimer = MoveInterval;
+            bot.ChatTimer = RandomChatDelay();
+            SetState(bot, BotState::InWorld);
+            break;
+        }
+        case BotState::InWorld:
+        {
+            Player* player = session->GetPlayer();
+            if (!player)
+                return false;
+
+            // no loading screen to finish, confirm far teleports right away
+            if (player->IsBeingTeleportedFar())
+            {
+                if (bot.StateTime >= MoveInterval)
+                {
+                    QueueClientPacket(session, WorldPacket(CMSG_WORLD_PORT_RESPONSE));
+                    bot.StateTime = 0ms;
+                }
+                bot.Waypoints.clear();
+                break;
+            }
+
+            if (!player->IsInWorld() || player->IsBeingTeleported())
+                break;
+
+            if (bot.Waypoints.empty())
+                BuildWaypoints(bot, player);
+
+            if (bot.MoveTimer <= diff)
+            {
+                SendMovement(bot, session, player);
+                bot.MoveTimer = MoveInterval;
+            }
+            else
+                bot.MoveTimer -= diff;
+
+            if (bot.ChatTimer <= diff)
+            {
+                SendChat(bot, session, player);
+                bot.ChatTimer = RandomChatDelay();
+            }
+            else
+                bot.ChatTimer -= diff;
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (bot.State != BotState::InWorld && bot.StateTime >= StateTimeout)
+    {
+        TC_LOG_ERROR("server.loadgen", "Bot of account {} made no progress in {} ms, dropping it", bot.AccountId, uint32(bot.StateTime.count()));
+        session->KickPlayer("LoadGenerator stalled bot");
+        return false;
+    }
+
+    return true;
+}
+
+uint32 Percentile(std::vector<uint32>& values, double percentile)
+{
+    if (values.empty())
+        return 0;
+
+    std::size_t index = std::min(values.size() - 1, std::size_t(percentile * double(values.size())));
+    std::ranges::nth_element(values, values.begin() + index);
+    return values[index];
+}
+}
+
+namespace LoadGenerator
+{
+uint32 Start(Settings const& settings)
+{
+    if (Running)
+        Stop();
+
+    CurrentSettings = settings;
+    Bots.clear();
+    WorldUpdateTimes.clear();
+    MapUpdateTimes.clear();
+    DroppedBots = 0;
+    StartTime = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < StartMemory.size(); ++i)
+        StartMemory[i] = Trinity::MemoryAccounting::GetStats(Trinity::MemoryDomain(i));
+
+    uint32 build = 0;
+    if (std::shared_ptr<Realm const> currentRealm = sRealmList->GetCurrentRealm())
+        build = currentRealm->Build;
+
+    ClientBuild::VariantId buildVariant = { .Platform = ClientBuild::Platform::Win_x64, .Arch = ClientBuild::Arch::x64, .Type = ClientBuild::Type::Retail };
+
+    for (uint32 accountId = settings.FirstAccountId; accountId < settings.FirstAccountId + settings.BotCount; ++accountId)
+    {
+        if (sWorld->FindSession(accountId))
+            continue;
+
+        WorldSession* session = new WorldSession(accountId, Trinity::StringFormat("LOADGEN{}", accountId), 0, nullptr, SEC_PLAYER,
+            uint8(sWorld->getIntConfig(CONFIG_EXPANSION)), 0, "Wn64", Minutes::zero(), build, buildVariant, LOCALE_enUS, 0, false);
+        session->SetSimulated();
+        session->LoadPermissions();
+        sWorld->AddSession(session);
+
+        Bots.push_back({ .AccountId = accountId });
+    }
+
+    Running = true;
+    TC_LOG_INFO("server.loadgen", "Load generator started {} bots from account {}", Bots.size(), settings.FirstAccountId);
+    return uint32(Bots.size());
+}
+
+void Stop()
+{
+    if (!Running)
+        return;
+
+    for (Bot const& bot : Bots)
+        if (WorldSession* session = sWorld->FindSession(bot.AccountId))
+            if (session->IsSimulated())
+                session->KickPlayer("LoadGenerator::Stop");
+
+    TC_LOG_INFO("server.loadgen", "Load generator stopped\n{}", BuildReport());
+    Bots.clear();
+    Running = false;
+}
+
+bool IsRunning()
+{
+    return Running;
+}
+
+void Update(uint32 diff)
+{
+    if (!Running)
+        return;
+
+    std::erase_if(Bots, [diff](Bot& bot)
+    {
+        if (UpdateBot(bot, Milliseconds(diff)))
+            return false;
+
+        ++DroppedBots;
+        return true;
+    });
+}
+
+void OnWorldUpdate(Microseconds duration)
+{
+    if (!Running)
+        return;
+
+    WorldUpdateTimes.push_back(uint32(duration.count()));
+
+    sMapMgr->DoForAllMaps([](Map* map)
+    {
+        MapUpdateStats& stats = MapUpdateTimes[{ map->GetId(), map->GetInstanceId() }];
+        if (stats.Name.empty())
+            stats.Name = Trinity::StringFormat("{} ({}) instance {}", map->GetMapName(), map->GetId(), map->GetInstanceId());
+
+        Microseconds mapDuration = map->GetLastUpdateDuration();
+        stats.Total += mapDuration;
+        stats.Max = std::max(stats.Max, mapDuration);
+        ++stats.Updates;
+    });
+}
+
+std::string BuildReport()
+{
+    std::array<uint32, size_t(BotState::InWorld) + 1> botStates = { };
+    for (Bot const& bot : Bots)
+        ++botStates[size_t(bot.State)];
+
+    std::string report = Trinity::StringFormat("Bots: {} in world, {} logging in, {} dropped, running for {} s\n",
+        botStates[size_t(BotState::InWorld)], Bots.size() - botStates[size_t(BotState::InWorld)], DroppedBots,
+        std::chrono::duration_cast<Seconds>(std::chrono::steady_clock::now() - StartTime).count());
+
+    std::vector<uint32> updateTimes = WorldUpdateTimes;
+    report += Trinity::StringFormat("World update ({} ticks): p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms\n", updateTimes.size(),
+        Percentile(updateTimes, 0.50) / 1000.0, Percentile(updateTimes, 0.95) / 1000.0, Percentile(updateTimes, 0.99) / 1000.0,
+        Percentile(updateTimes, 1.0) / 1000.0);
+
+    std::vector<MapUpdateStats const*> maps;
+    for (auto const& [key, stats] : MapUpdateTimes)
+        maps.push_back(&stats);
+
+    std::ranges::sort(maps, std::ranges::greater(), [](MapUpdateStats const* stats) { return stats->Total; });
+    for (MapUpdateStats const* stats : maps)
+        report += Trinity::StringFormat("Map {}: avg {:.2f} ms, max {:.2f} ms over {} updates\n", stats->Name,
+            stats->Total.count() / 1000.0 / double(std::max<uint64>(stats->Updates, 1)), stats->Max.count() / 1000.0, stats->Updates);
+
+    for (std::size_t i = 0; i < StartMemory.size(); ++i)
+    {
+        Trinity::MemoryDomainStats stats = Trinity::MemoryAccounting::GetStats(Trinity::MemoryDomain(i));
+        report += Trinity::StringFormat("Memory {}: {} KB live ({:+} KB since start), {} allocations since start\n",
+            Trinity::MemoryAccounting::GetDomainName(Trinity::MemoryDomain(i)), stats.LiveBytes / 1024,
+            (stats.LiveBytes - StartMemory[i].LiveBytes) / 1024, stats.Allocations - StartMemory[i].Allocations);
+    }
+
+    return report;
+}
+}
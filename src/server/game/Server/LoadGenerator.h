@@ -0,0 +1,56 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LOAD_GENERATOR_H
+#define TRINITYCORE_LOAD_GENERATOR_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <string>
+
+/**
+ * Headless bots for load testing: simulated sessions without a socket log in the first character
+ * of their account, walk a circle around the login position and chat, their packets go through
+ * the regular receive queue and opcode handlers.
+ * All functions must be called from the world thread.
+ */
+namespace LoadGenerator
+{
+    struct Settings
+    {
+        uint32 FirstAccountId = 0;
+        uint32 BotCount = 0;
+        float WalkRadius = 20.0f;
+        Seconds ChatInterval = 30s;
+    };
+
+    /// Returns the number of bots started, accounts that already have a session are skipped
+    TC_GAME_API uint32 Start(Settings const& settings);
+    TC_GAME_API void Stop();
+    TC_GAME_API bool IsRunning();
+
+    /// Called by the world thread before the sessions are updated
+    TC_GAME_API void Update(uint32 diff);
+
+    /// Called by the world thread at the end of every World::Update, maps are not updating at that point
+    TC_GAME_API void OnWorldUpdate(Microseconds duration);
+
+    /// World update percentiles, per map update times and memory domains since Start()
+    TC_GAME_API std::string BuildReport();
+}
+
+#endif // TRINITYCORE_LOAD_GENERATOR_H
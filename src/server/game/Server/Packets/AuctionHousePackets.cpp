@@ -652,11 +652,14 @@ WorldPacket const* AuctionReplicateResponse::Write()
     _worldPacket << uint32(ChangeNumberGlobal);
     _worldPacket << uint32(ChangeNumberCursor);
     _worldPacket << uint32(ChangeNumberTombstone);
-    _worldPacket << Size<uint32>(Items);
+    _worldPacket << uint32(Items.size() + SerializedItemCount);
 
     for (AuctionItem const& item : Items)
         _worldPacket << item;
 
+    if (!SerializedItems.empty())
+        _worldPacket.append(SerializedItems.data(), SerializedItems.size());
+
     return &_worldPacket;
 }
 
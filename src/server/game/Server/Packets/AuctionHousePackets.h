@@ -23,6 +23,7 @@
 #include "DBCEnums.h"
 #include "ItemPacketsCommon.h"
 #include "ObjectGuid.h"
+#include <span>
 
 struct AuctionsBucketKey;
 struct AuctionPosting;
@@ -133,6 +134,8 @@ namespace WorldPackets
             Optional<ObjectGuid> Creator;
         };
 
+        ByteBuffer& operator<<(ByteBuffer& data, AuctionItem const& auctionItem);
+
         struct AuctionBidderNotification
         {
             void Initialize(int32 auctionHouseId, ::AuctionPosting const* auction, ::Item const* item);
@@ -525,6 +528,8 @@ namespace WorldPackets
             uint32 ChangeNumberTombstone = 0;
             uint32 Result = 0;
             std::vector<AuctionItem> Items;
+            std::span<uint8 const> SerializedItems; // already serialized AuctionItem structures, written after Items
+            uint32 SerializedItemCount = 0;
         };
 
         class AuctionWonNotification final : public ServerPacket
@@ -45,15 +45,8 @@ WorldPacket const* SpellNonMeleeDamageLog::Write()
     *this << CastID;
     *this << int32(SpellID);
     *this << Visual;
-    *this << int32(Damage);
-    *this << int32(OriginalDamage);
-    *this << int32(Overkill);
-    *this << uint8(SchoolMask);
-    *this << int32(Absorbed);
-    *this << int32(Resisted);
-    *this << int32(ShieldBlock);
-    *this << Size<uint32>(WorldTextViewers);
-    *this << Size<uint32>(Supporters);
+    AppendFixed(int32(Damage), int32(OriginalDamage), int32(Overkill), uint8(SchoolMask), int32(Absorbed), int32(Resisted),
+        int32(ShieldBlock), uint32(WorldTextViewers.size()), uint32(Supporters.size()));
 
     for (Spells::SpellSupportInfo const& supportInfo : Supporters)
         *this << supportInfo;
@@ -201,14 +194,8 @@ ByteBuffer& operator<<(ByteBuffer& data, PeriodicalAuraLogEffectDebugInfo const&
 
 ByteBuffer& operator<<(ByteBuffer& data, PeriodicAuraLogEffect const& effect)
 {
-    data << int32(effect.Effect);
-    data << int32(effect.Amount);
-    data << int32(effect.OriginalDamage);
-    data << int32(effect.OverHealOrKill);
-    data << int32(effect.SchoolMaskOrPower);
-    data << int32(effect.AbsorbedOrAmplitude);
-    data << int32(effect.Resisted);
-    data << Size<uint32>(effect.Supporters);
+    data.AppendFixed(int32(effect.Effect), int32(effect.Amount), int32(effect.OriginalDamage), int32(effect.OverHealOrKill),
+        int32(effect.SchoolMaskOrPower), int32(effect.AbsorbedOrAmplitude), int32(effect.Resisted), uint32(effect.Supporters.size()));
 
     for (Spells::SpellSupportInfo const& supportInfo : effect.Supporters)
         data << supportInfo;
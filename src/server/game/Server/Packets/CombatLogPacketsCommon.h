@@ -140,6 +140,13 @@ namespace WorldPackets
                 _fullLogPacket << val;
             }
 
+            template <ByteBufferNumeric... T>
+            void AppendFixed(T... values)
+            {
+                _worldPacket.AppendFixed(values...);
+                _fullLogPacket.AppendFixed(values...);
+            }
+
             void WriteLogDataBit()
             {
                 _worldPacket.WriteBit(false);
@@ -32,6 +32,33 @@ void CallHandlerWrapper(WorldSession* session, WorldPacket& packet)
     (session->*HandlerFunction)(nicePacket);
     session->LogUnprocessedTail(nicePacket.GetRawPacket());
 }
+
+template<class PacketClass>
+std::unique_ptr<WorldPackets::ClientPacket> DecodeWrapper(WorldPacket& packet)
+{
+    std::unique_ptr<std::remove_cv_t<PacketClass>> nicePacket = std::make_unique<std::remove_cv_t<PacketClass>>(std::move(packet));
+    try
+    {
+        nicePacket->Read();
+    }
+    catch (...)
+    {
+        // hand the data back, the handler reads it again and fails with the usual error handling
+        packet = *nicePacket->GetRawPacket();
+        packet.rpos(0);
+        return nullptr;
+    }
+
+    return nicePacket;
+}
+
+template<class PacketClass, void(WorldSession::* HandlerFunction)(PacketClass&)>
+void CallDecodedHandlerWrapper(WorldSession* session, WorldPackets::ClientPacket& packet)
+{
+    std::remove_cv_t<PacketClass>& nicePacket = static_cast<std::remove_cv_t<PacketClass>&>(packet);
+    (session->*HandlerFunction)(nicePacket);
+    session->LogUnprocessedTail(nicePacket.GetRawPacket());
+}
 }
 
 OpcodeTable opcodeTable;
@@ -88,6 +115,20 @@ void OpcodeTable::ValidateAndSetClientOpcode(OpcodeClient opcode, char const* na
     });
 }
 
+void OpcodeTable::SetClientOpcodeDecoder(OpcodeClient opcode, ClientOpcodeHandler::DecodeFunction decode, ClientOpcodeHandler::DecodedHandlerFunction callDecoded)
+{
+    std::ptrdiff_t index = GetOpcodeArrayIndex(opcode);
+    if (index < 0 || index >= std::ssize(_internalTableClient) || !_internalTableClient[index])
+    {
+        TC_LOG_ERROR("network", "Tried to set decoder for opcode {} without handler", opcode);
+        return;
+    }
+
+    ClientOpcodeHandler* handler = _internalTableClient[index].get();
+    handler->Decode = decode;
+    handler->CallDecoded = callDecoded;
+}
+
 bool OpcodeTable::ValidateServerOpcode(OpcodeServer opcode, char const* name, ConnectionType conIdx) const
 {
     if (opcode == UNKNOWN_OPCODE)
@@ -1033,6 +1074,54 @@ void OpcodeTable::InitializeClientOpcodes()
     DEFINE_HANDLER(CMSG_WORLD_PORT_RESPONSE,                                STATUS_TRANSFER,  PROCESS_THREADUNSAFE, &WorldSession::HandleMoveWorldportAckOpcode);
     DEFINE_HANDLER(CMSG_WRAP_ITEM,                                          STATUS_LOGGEDIN,  PROCESS_THREADUNSAFE, &WorldSession::HandleWrapItem);
 
+    // packets read on network threads when Network.EarlyPacketDecode is enabled, their Read() must not touch any game state
+#define DEFINE_DECODER(opcode, handler) \
+    SetClientOpcodeDecoder(opcode, &DecodeWrapper<typename get_packet_class<decltype(handler)>::type>, &CallDecodedHandlerWrapper<typename get_packet_class<decltype(handler)>::type, handler>)
+
+    DEFINE_DECODER(CMSG_CAST_SPELL,                                         &WorldSession::HandleCastSpellOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_CHANNEL,                               &WorldSession::HandleChatMessageChannelOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_GUILD,                                 &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_INSTANCE_CHAT,                         &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_OFFICER,                               &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_PARTY,                                 &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_RAID,                                  &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_RAID_WARNING,                          &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_SAY,                                   &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_WHISPER,                               &WorldSession::HandleChatMessageWhisperOpcode);
+    DEFINE_DECODER(CMSG_CHAT_MESSAGE_YELL,                                  &WorldSession::HandleChatMessageOpcode);
+    DEFINE_DECODER(CMSG_MOVE_CHANGE_TRANSPORT,                              &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_DOUBLE_JUMP,                                   &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_FALL_LAND,                                     &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_FALL_RESET,                                    &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_HEARTBEAT,                                     &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_JUMP,                                          &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_SET_ADV_FLY,                                   &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_SET_FACING,                                    &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_SET_FACING_HEARTBEAT,                          &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_SET_FLY,                                       &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_SET_PITCH,                                     &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_SET_RUN_MODE,                                  &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_SET_WALK_MODE,                                 &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_ASCEND,                                  &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_BACKWARD,                                &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_DESCEND,                                 &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_FORWARD,                                 &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_PITCH_DOWN,                              &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_PITCH_UP,                                &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_STRAFE_LEFT,                             &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_STRAFE_RIGHT,                            &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_SWIM,                                    &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_TURN_LEFT,                               &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_START_TURN_RIGHT,                              &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_STOP,                                          &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_STOP_ASCEND,                                   &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_STOP_PITCH,                                    &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_STOP_STRAFE,                                   &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_STOP_SWIM,                                     &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_STOP_TURN,                                     &WorldSession::HandleMovementOpcodes);
+    DEFINE_DECODER(CMSG_MOVE_UPDATE_FALL_SPEED,                             &WorldSession::HandleMovementOpcodes);
+
+#undef DEFINE_DECODER
 #undef DEFINE_HANDLER
 }
 
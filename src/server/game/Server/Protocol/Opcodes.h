@@ -18,6 +18,7 @@
 #ifndef TRINITYCORE_OPCODES_H
 #define TRINITYCORE_OPCODES_H
 
+#include "CpuTime.h"
 #include "Define.h"
 #include "StringFormatFwd.h"
 #include <array>
@@ -2264,14 +2265,28 @@ enum PacketProcessing
 class WorldPacket;
 class WorldSession;
 
+namespace WorldPackets
+{
+    class ClientPacket;
+}
+
 struct ClientOpcodeHandler
 {
     using HandlerFunction = void (*)(WorldSession* session, WorldPacket& packet);
+    using DecodeFunction = std::unique_ptr<WorldPackets::ClientPacket> (*)(WorldPacket& packet);
+    using DecodedHandlerFunction = void (*)(WorldSession* session, WorldPackets::ClientPacket& packet);
 
     char const* Name;
     SessionStatus Status;
     HandlerFunction Call;
     PacketProcessing ProcessingPlace;
+
+    // only set for opcodes whose packets can be read on network threads before being queued
+    DecodeFunction Decode;
+    DecodedHandlerFunction CallDecoded;
+
+    // time spent in the handler, packets are handled by world and map threads concurrently
+    mutable Trinity::CpuTimeCounter CpuTime;
 };
 
 struct ServerOpcodeHandler
@@ -2335,9 +2350,18 @@ public:
         return _internalTableServer[GetOpcodeArrayIndex(index)].get();
     }
 
+    template <typename Visitor>
+    void VisitClientHandlers(Visitor&& visitor) const
+    {
+        for (std::unique_ptr<ClientOpcodeHandler> const& handler : _internalTableClient)
+            if (handler)
+                visitor(*handler);
+    }
+
 private:
     bool ValidateClientOpcode(OpcodeClient opcode, char const* name) const;
     void ValidateAndSetClientOpcode(OpcodeClient opcode, char const* name, SessionStatus status, ClientOpcodeHandler::HandlerFunction call, PacketProcessing processing);
+    void SetClientOpcodeDecoder(OpcodeClient opcode, ClientOpcodeHandler::DecodeFunction decode, ClientOpcodeHandler::DecodedHandlerFunction callDecoded);
 
     bool ValidateServerOpcode(OpcodeServer opcode, char const* name, ConnectionType conIdx) const;
     void ValidateAndSetServerOpcode(OpcodeServer opcode, char const* name, SessionStatus status, ConnectionType conIdx);
@@ -59,6 +59,15 @@ struct PacketHeader
 
 #pragma pack(pop)
 
+namespace
+{
+constexpr uint32 ClientToServerDirection = 0x47534d43; // CMSG
+constexpr uint32 ServerToClientDirection = 0x47534d53; // SMSG
+
+// fixed part of PacketHeader, optional data size is stored per packet
+constexpr std::size_t PacketHeaderFixedSize = offsetof(PacketHeader, OptionalData);
+}
+
 PacketLog::PacketLog() : _file(nullptr)
 {
     std::call_once(_initializeFlag, &PacketLog::Initialize, this);
@@ -117,7 +126,7 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
     std::lock_guard<std::mutex> lock(_logPacketLock);
 
     PacketHeader header;
-    header.Direction = direction == CLIENT_TO_SERVER ? 0x47534d43 : 0x47534d53;
+    header.Direction = direction == CLIENT_TO_SERVER ? ClientToServerDirection : ServerToClientDirection;
     header.ConnectionId = connectionType;
     header.ArrivalTicks = getMSTime();
 
@@ -153,3 +162,69 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
 
     fflush(_file);
 }
+
+PacketLogReader::PacketLogReader() : _file(nullptr), _build(0)
+{
+}
+
+PacketLogReader::~PacketLogReader()
+{
+    if (_file)
+        fclose(_file);
+}
+
+bool PacketLogReader::Open(std::string const& fileName)
+{
+    if (_file)
+        fclose(_file);
+
+    _file = fopen(fileName.c_str(), "rb");
+    if (!_file)
+        return false;
+
+    LogHeader header;
+    if (fread(&header, sizeof(header), 1, _file) != 1
+        || header.Signature[0] != 'P' || header.Signature[1] != 'K' || header.Signature[2] != 'T'
+        || header.FormatVersion != 0x0301
+        || (header.OptionalDataSize && fseek(_file, header.OptionalDataSize, SEEK_CUR) != 0))
+    {
+        fclose(_file);
+        _file = nullptr;
+        return false;
+    }
+
+    _build = header.Build;
+    return true;
+}
+
+bool PacketLogReader::ReadNext(PacketLogEntry& entry)
+{
+    if (!_file)
+        return false;
+
+    PacketHeader header;
+    if (fread(&header, PacketHeaderFixedSize, 1, _file) != 1)
+        return false;
+
+    if (header.Direction != ClientToServerDirection && header.Direction != ServerToClientDirection)
+        return false;
+
+    if (header.Length < sizeof(header.Opcode))
+        return false;
+
+    if (header.OptionalDataSize && fseek(_file, header.OptionalDataSize, SEEK_CUR) != 0)
+        return false;
+
+    if (fread(&header.Opcode, sizeof(header.Opcode), 1, _file) != 1)
+        return false;
+
+    entry.PacketDirection = header.Direction == ClientToServerDirection ? CLIENT_TO_SERVER : SERVER_TO_CLIENT;
+    entry.ConnectionId = header.ConnectionId;
+    entry.ArrivalTicks = header.ArrivalTicks;
+    entry.Opcode = header.Opcode;
+    entry.Data.resize(header.Length - sizeof(header.Opcode));
+    if (!entry.Data.empty() && fread(entry.Data.data(), 1, entry.Data.size(), _file) != entry.Data.size())
+        return false;
+
+    return true;
+}
@@ -20,6 +20,8 @@
 
 #include "Common.h"
 #include <mutex>
+#include <string>
+#include <vector>
 
 enum Direction
 {
@@ -65,5 +67,36 @@ class TC_GAME_API PacketLog
         FILE* _file;
 };
 
+struct PacketLogEntry
+{
+    Direction PacketDirection = CLIENT_TO_SERVER;
+    uint32 ConnectionId = 0;
+    uint32 ArrivalTicks = 0;
+    uint32 Opcode = 0;
+    std::vector<uint8> Data;    // payload following the opcode
+};
+
+/// Reads packet captures in PKT 3.1 format, as written by PacketLog
+class TC_GAME_API PacketLogReader
+{
+    public:
+        PacketLogReader();
+        ~PacketLogReader();
+
+        PacketLogReader(PacketLogReader const&) = delete;
+        PacketLogReader(PacketLogReader&&) = delete;
+        PacketLogReader& operator=(PacketLogReader const&) = delete;
+        PacketLogReader& operator=(PacketLogReader&&) = delete;
+
+        bool Open(std::string const& fileName);
+        bool ReadNext(PacketLogEntry& entry);
+
+        uint32 GetBuild() const { return _build; }
+
+    private:
+        FILE* _file;
+        uint32 _build;
+};
+
 #define sPacketLog PacketLog::instance()
 #endif
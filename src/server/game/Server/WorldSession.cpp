@@ -132,7 +132,7 @@ WorldSession::WorldSession(uint32 id, std::string&& name, uint32 battlenetAccoun
     m_playerRecentlyLogout(false),
     m_playerSave(false),
     m_sessionDbcLocale(sWorld->GetAvailableDbcLocale(locale)),
-    m_sessionDbLocaleIndex(locale),
+    m_sessionDbLocaleIndex(sWorld->IsLocaleLoaded(locale) ? locale : DEFAULT_LOCALE),
     _timezoneOffset(timezoneOffset),
     m_latency(0),
     _tutorials(),
@@ -143,6 +143,7 @@ WorldSession::WorldSession(uint32 id, std::string&& name, uint32 battlenetAccoun
     _RBACData(nullptr),
     expireTime(60000), // 1 min after socket loss, session is deleted
     forceExit(false),
+    _simulated(false),
     _timeSyncClockDeltaQueue(std::make_unique<boost::circular_buffer<std::pair<int64, uint32>>>(6)),
     _timeSyncClockDelta(0),
     _pendingTimeSyncRequests(),
@@ -182,9 +183,8 @@ WorldSession::~WorldSession()
 
     delete _RBACData;
 
-    ///- empty incoming packet queue
-    WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    ///- empty incoming packet queue (packets still in _recvQueue are deleted by its destructor)
+    for (ReceivedWorldPacket* packet : _recvQueuePending)
         delete packet;
 
     LoginDatabase.PExecute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
@@ -192,6 +192,9 @@ WorldSession::~WorldSession()
 
 bool WorldSession::PlayerDisconnected() const
 {
+    if (_simulated)
+        return forceExit;
+
     return !(m_Socket[CONNECTION_TYPE_REALM] && m_Socket[CONNECTION_TYPE_REALM]->IsOpen() &&
              m_Socket[CONNECTION_TYPE_INSTANCE] && m_Socket[CONNECTION_TYPE_INSTANCE]->IsOpen());
 }
@@ -215,18 +218,40 @@ std::string WorldSession::GetPlayerInfo() const
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/)
 {
+    if (WorldSocket* socket = GetSocketForSendPacket(packet, forced))
+        socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (WorldSocket* socket = GetSocketForSendPacket(packet.get(), false))
+        socket->SendPacket(packet);
+}
+
+void WorldSession::FlushSocketSendQueues()
+{
+    for (std::shared_ptr<WorldSocket> const& socket : m_Socket)
+        if (socket)
+            socket->FlushSendQueue();
+}
+
+WorldSocket* WorldSession::GetSocketForSendPacket(WorldPacket const* packet, bool forced)
+{
+    if (_simulated)
+        return nullptr;
+
     if (!opcodeTable.IsValid(static_cast<OpcodeServer>(packet->GetOpcode())))
     {
         char const* specialName = packet->GetOpcode() == UNKNOWN_OPCODE ? "UNKNOWN_OPCODE" : "INVALID_OPCODE";
         TC_LOG_ERROR("network.opcode", "Prevented sending of {} (0x{:04X}) to {}", specialName, packet->GetOpcode(), GetPlayerInfo());
-        return;
+        return nullptr;
     }
 
     ServerOpcodeHandler const* handler = opcodeTable[static_cast<OpcodeServer>(packet->GetOpcode())];
     if (!handler)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of opcode {} with non existing handler to {}", packet->GetOpcode(), GetPlayerInfo());
-        return;
+        return nullptr;
     }
 
     // Default connection index defined in Opcodes.cpp table
@@ -238,7 +263,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (packet->GetConnection() != CONNECTION_TYPE_INSTANCE && IsInstanceOnlyOpcode(packet->GetOpcode()))
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending of instance only opcode {} with connection type {} to {}", packet->GetOpcode(), uint32(packet->GetConnection()), GetPlayerInfo());
-            return;
+            return nullptr;
         }
 
         conIdx = packet->GetConnection();
@@ -247,7 +272,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     if (!m_Socket[conIdx])
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of {} to non existent socket {} to {}", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())), uint32(conIdx), GetPlayerInfo());
-        return;
+        return nullptr;
     }
 
     if (!forced)
@@ -255,7 +280,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (handler->Status == STATUS_UNHANDLED)
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending disabled opcode {} to {}", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())), GetPlayerInfo());
-            return;
+            return nullptr;
         }
     }
 
@@ -296,7 +321,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     sScriptMgr->OnPacketSend(this, *packet);
 
     TC_LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
-    m_Socket[conIdx]->SendPacket(*packet);
+    return m_Socket[conIdx].get();
 }
 
 void WorldSession::AddInstanceConnection(WorldSession* session, std::weak_ptr<WorldSocket> sockRef, ConnectToKey key)
@@ -317,10 +342,36 @@ void WorldSession::AddInstanceConnection(WorldSession* session, std::weak_ptr<Wo
     session->HandleContinuePlayerLogin();
 }
 
+ReceivedWorldPacket::ReceivedWorldPacket(WorldPacket&& packet) : WorldPacket(std::move(packet))
+{
+    RecvQueueLink.store(nullptr, std::memory_order_relaxed);
+}
+
+ReceivedWorldPacket::~ReceivedWorldPacket() = default;
+
+void ReceivedWorldPacket::Decode(ClientOpcodeHandler const* handler)
+{
+    if (handler->Decode)
+        _decodedPacket = handler->Decode(*this);
+}
+
+void ReceivedWorldPacket::CallHandler(WorldSession* session, ClientOpcodeHandler const* handler)
+{
+    if (_decodedPacket)
+        handler->CallDecoded(session, *_decodedPacket);
+    else
+        handler->Call(session, *this);
+}
+
+WorldPacket const& ReceivedWorldPacket::GetRawPacket() const
+{
+    return _decodedPacket ? *_decodedPacket->GetRawPacket() : *this;
+}
+
 /// Add an incoming packet to the queue
-void WorldSession::QueuePacket(WorldPacket* new_packet)
+void WorldSession::QueuePacket(ReceivedWorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueue.Enqueue(new_packet);
 }
 
 /// Logging helper for unexpected opcodes
@@ -352,20 +403,31 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     ///- Retrieve packets from the receive queue and call the appropriate handlers
     /// not process packets if socket already closed
-    WorldPacket* packet = nullptr;
+    ReceivedWorldPacket* packet = nullptr;
     //! Delete packet after processing by default
     bool deletePacket = true;
-    std::vector<WorldPacket*> requeuePackets;
+    std::vector<ReceivedWorldPacket*> requeuePackets;
     uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime();
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 100;
+    uint32 const packetTimeBudget = sWorld->getIntConfig(CONFIG_SESSION_UPDATE_PACKET_TIME_BUDGET);
+    uint32 const packetProcessingStart = packetTimeBudget ? getMSTime() : 0;
+
+    while (_recvQueue.Dequeue(packet))
+        _recvQueuePending.push_back(packet);
 
-    while (m_Socket[CONNECTION_TYPE_REALM] && _recvQueue.next(packet, updater))
+    TC_METRIC_VALUE("session_recv_queue_depth", uint64(_recvQueuePending.size()));
+
+    while ((m_Socket[CONNECTION_TYPE_REALM] || (_simulated && !forceExit)) && !_recvQueuePending.empty() && updater.Process(_recvQueuePending.front()))
     {
+        packet = _recvQueuePending.front();
+        _recvQueuePending.pop_front();
+
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
         TC_METRIC_DETAILED_TIMER("worldsession_update_opcode_time", TC_METRIC_TAG("opcode", opHandle->Name));
+        Trinity::CpuTimeScope opcodeCpuTime(opHandle->CpuTime);
 
         try
         {
@@ -389,8 +451,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     {
                         if(AntiDOS.EvaluateOpcode(*packet, currentTime))
                         {
-                            sScriptMgr->OnPacketReceive(this, *packet);
-                            opHandle->Call(this, *packet);
+                            sScriptMgr->OnPacketReceive(this, packet->GetRawPacket());
+                            packet->CallHandler(this, opHandle);
                         }
                         else
                             processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -404,8 +466,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     else if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                     {
                         // not expected _player or must checked in packet hanlder
-                        sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        sScriptMgr->OnPacketReceive(this, packet->GetRawPacket());
+                        packet->CallHandler(this, opHandle);
                     }
                     else
                         processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -417,8 +479,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         LogUnexpectedOpcode(packet, "STATUS_TRANSFER", "the player is still in world");
                     else if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                     {
-                        sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        sScriptMgr->OnPacketReceive(this, packet->GetRawPacket());
+                        packet->CallHandler(this, opHandle);
                     }
                     else
                         processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -438,8 +500,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
                     if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                     {
-                        sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        sScriptMgr->OnPacketReceive(this, packet->GetRawPacket());
+                        packet->CallHandler(this, opHandle);
                     }
                     else
                         processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -493,11 +555,15 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         //Any leftover will be processed in next update
         if (processedPackets > MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
             break;
+
+        //same for packets that took too long to handle
+        if (packetTimeBudget && GetMSTimeDiffToNow(packetProcessingStart) >= packetTimeBudget)
+            break;
     }
 
     TC_METRIC_VALUE("processed_packets", processedPackets);
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _recvQueuePending.insert(_recvQueuePending.begin(), requeuePackets.begin(), requeuePackets.end());
 
     if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
     {
@@ -547,8 +613,11 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             }
         }
 
-        if (!m_Socket[CONNECTION_TYPE_REALM])
+        if (!m_Socket[CONNECTION_TYPE_REALM] && (!_simulated || forceExit))
             return false;                                       //Will remove this session from the world session map
+
+        // players in world are flushed again at the end of their Map::Update
+        FlushSocketSendQueues();
     }
 
     return true;
@@ -722,6 +791,9 @@ void WorldSession::KickPlayer(std::string const& reason)
             forceExit = true;
         }
     }
+
+    if (_simulated)
+        forceExit = true;
 }
 
 bool WorldSession::ValidateHyperlinksAndMaybeKick(std::string const& str)
@@ -803,7 +875,7 @@ void WorldSession::ResetTimeOutTime(bool onlyActive)
 
 bool WorldSession::IsConnectionIdle() const
 {
-    return m_timeOutTime < GameTime::GetGameTime() && !m_inQueue;
+    return !_simulated && m_timeOutTime < GameTime::GetGameTime() && !m_inQueue;
 }
 
 void WorldSession::Handle_NULL(WorldPackets::Null& null)
@@ -819,6 +891,13 @@ void WorldSession::Handle_EarlyProccess(WorldPackets::Null& null)
 
 void WorldSession::SendConnectToInstance(WorldPackets::Auth::ConnectToSerial serial)
 {
+    // there is no client to open the instance connection
+    if (_simulated)
+    {
+        HandleContinuePlayerLogin();
+        return;
+    }
+
     boost::system::error_code ignored_error;
     boost::asio::ip::address instanceAddress;
     if (std::shared_ptr<Realm const> currentRealm = sRealmList->GetCurrentRealm())
@@ -29,15 +29,17 @@
 #include "DatabaseEnvFwd.h"
 #include "Duration.h"
 #include "IteratorPair.h"
-#include "LockedQueue.h"
+#include "MPSCQueue.h"
 #include "ObjectGuid.h"
 #include "Opcodes.h"
 #include "Optional.h"
 #include "RaceMask.h"
 #include "SharedDefines.h"
+#include "WorldPacket.h"
 #include <boost/circular_buffer_fwd.hpp>
 #include <array>
 #include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -52,7 +54,6 @@ class MessageBuffer;
 class Player;
 class Unit;
 class Warden;
-class WorldPacket;
 class WorldSession;
 class WorldSocket;
 struct AuctionPosting;
@@ -964,6 +965,26 @@ struct PacketCounter
 };
 
 /// Player session in the World
+/// Client packet waiting in the receive queue of its session
+class TC_GAME_API ReceivedWorldPacket : public WorldPacket
+{
+public:
+    explicit ReceivedWorldPacket(WorldPacket&& packet);
+    ~ReceivedWorldPacket();
+
+    /// Reads the packet ahead of its handler if the opcode allows it, leaves it untouched otherwise
+    void Decode(ClientOpcodeHandler const* handler);
+    void CallHandler(WorldSession* session, ClientOpcodeHandler const* handler);
+
+    /// Packet data as received, also for already decoded packets
+    WorldPacket const& GetRawPacket() const;
+
+    std::atomic<ReceivedWorldPacket*> RecvQueueLink;
+
+private:
+    std::unique_ptr<WorldPackets::ClientPacket> _decodedPacket;
+};
+
 class TC_GAME_API WorldSession
 {
     public:
@@ -977,9 +998,17 @@ class TC_GAME_API WorldSession
         bool PlayerRecentlyLoggedOut() const { return m_playerRecentlyLogout; }
         bool PlayerDisconnected() const;
 
+        // sessions without a socket driven by LoadGenerator, outgoing packets are dropped
+        bool IsSimulated() const { return _simulated; }
+        void SetSimulated() { _simulated = true; }
+
         bool IsAddonRegistered(std::string_view prefix) const;
 
         void SendPacket(WorldPacket const* packet, bool forced = false);
+        /// sends a packet shared between many recipients, its storage is referenced by the socket instead of copied
+        void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
+        /// releases packets held by the sockets when Network.TickAlignedFlush is enabled
+        void FlushSocketSendQueues();
 
         void SendNotification(char const* format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(uint32 stringId, ...);
@@ -1052,7 +1081,7 @@ class TC_GAME_API WorldSession
         // May kick player on false depending on world config (handler should abort)
         bool DisallowHyperlinksAndMaybeKick(std::string const& str);
 
-        void QueuePacket(WorldPacket* new_packet);
+        void QueuePacket(ReceivedWorldPacket* new_packet);
         bool Update(uint32 diff, PacketFilter& updater);
 
         /// Handle the authentication waiting queue (to be completed)
@@ -1955,12 +1984,20 @@ class TC_GAME_API WorldSession
         // logging helper
         void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char *reason);
 
+        // validates outgoing packet and selects its connection, nullptr if it must not be sent
+        WorldSocket* GetSocketForSendPacket(WorldPacket const* packet, bool forced);
+
         // EnumData helpers
         bool IsLegitCharacterForAccount(ObjectGuid lowGUID)
         {
             return _legitCharacters.find(lowGUID) != _legitCharacters.end();
         }
 
+    public:
+        GuidSet const& GetLegitCharacters() const { return _legitCharacters; }
+
+    private:
+
         // this stores the GUIDs of the characters who can login
         // characters who failed on Player::BuildEnumData shouldn't login
         GuidSet _legitCharacters;
@@ -2007,10 +2044,13 @@ class TC_GAME_API WorldSession
         bool _filterAddonMessages;
         uint32 recruiterId;
         bool isRecruiter;
-        LockedQueue<WorldPacket*> _recvQueue;
+        // filled by network threads, drained into _recvQueuePending by the thread running Update
+        MPSCQueue<ReceivedWorldPacket, &ReceivedWorldPacket::RecvQueueLink> _recvQueue;
+        std::deque<ReceivedWorldPacket*> _recvQueuePending;
         rbac::RBACData* _RBACData;
         uint32 expireTime;
         bool forceExit;
+        bool _simulated;
 
         std::unique_ptr<boost::circular_buffer<std::pair<int64, uint32>>> _timeSyncClockDeltaQueue; // first member: clockDelta. Second member: latency of the packet exchange that was used to compute that clockDelta.
         int64 _timeSyncClockDelta;
@@ -27,6 +27,7 @@
 #include "HMAC.h"
 #include "IPLocation.h"
 #include "IpBanCheckConnectionInitializer.h"
+#include "Metric.h"
 #include "PacketLog.h"
 #include "ProtobufJSON.h"
 #include "RealmList.h"
@@ -50,7 +51,7 @@ struct CompressedWorldPacket
 
 #pragma pack(pop)
 
-uint32 const WorldSocket::MinSizeForCompression = 0x400;
+uint32 const WorldSocket::MinSizeForZeroCopySend = 0x100;
 
 std::array<uint8, 32> const WorldSocket::AuthCheckSeed = { 0xDE, 0x3A, 0x2A, 0x8E, 0x6B, 0x89, 0x52, 0x66, 0x88, 0x9D, 0x7E, 0x7A, 0x77, 0x1D, 0x5D, 0x1F,
     0x4E, 0xD9, 0x0C, 0x23, 0x9B, 0xCD, 0x0E, 0xDC, 0xD2, 0xE8, 0x04, 0x3A, 0x68, 0x64, 0xC7, 0xB0 };
@@ -63,7 +64,9 @@ std::array<uint8, 32> const WorldSocket::EncryptionKeySeed = { 0x71, 0xC9, 0xED,
 
 WorldSocket::WorldSocket(Trinity::Net::IoContextTcpSocket&& socket) : BaseSocket(std::move(socket)),
     _type(CONNECTION_TYPE_REALM), _key(0), _serverChallenge(), _sessionKey(), _encryptKey(), _OverSpeedPings(0),
-    _worldSession(nullptr), _authed(false), _canRequestHotfixes(true), _headerBuffer(sizeof(IncomingPacketHeader)), _sendBufferSize(4096), _compressionStream(nullptr)
+    _worldSession(nullptr), _authed(false), _canRequestHotfixes(true), _headerBuffer(sizeof(IncomingPacketHeader)), _sendBufferSize(4096),
+    _holdSendQueue(false), _sendQueueFlushRequested(false), _compressionStream(nullptr),
+    _minSizeForCompression(std::numeric_limits<uint32>::max())
 {
 }
 
@@ -188,6 +191,7 @@ bool WorldSocket::InitializeCompression()
     _compressionStream->opaque = (voidpf)nullptr;
     _compressionStream->avail_in = 0;
     _compressionStream->next_in = nullptr;
+    _minSizeForCompression = sWorld->getIntConfig(CONFIG_COMPRESSION_MIN_PACKET_SIZE);
     int32 z_res = deflateInit2(_compressionStream, sWorld->getIntConfig(CONFIG_COMPRESSION), Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
     if (z_res != Z_OK)
     {
@@ -201,17 +205,39 @@ bool WorldSocket::InitializeCompression()
 
 bool WorldSocket::Update()
 {
+    // held packets are written once the update that generated them has finished
+    bool const writeQueued = !_holdSendQueue.load(std::memory_order_relaxed) || _sendQueueFlushRequested.exchange(false, std::memory_order_acq_rel);
+
     EncryptablePacket* queued;
-    MessageBuffer buffer(_sendBufferSize);
-    while (_bufferQueue.Dequeue(queued))
+    MessageBuffer buffer(writeQueued ? _sendBufferSize : 0);
+    while (writeQueued && _bufferQueue.Dequeue(queued))
     {
-        uint32 packetSize = queued->size() + 4 /*opcode*/;
-        if (packetSize > MinSizeForCompression && queued->NeedsEncryption())
+        uint32 packetSize = queued->GetPacket().size() + 4 /*opcode*/;
+        if (packetSize > _minSizeForCompression && queued->NeedsEncryption())
             packetSize = deflateBound(_compressionStream, packetSize) + sizeof(CompressedWorldPacket);
+        else if (!queued->IsShared() && queued->size() >= MinSizeForZeroCopySend)
+        {
+            // Large uncompressed packets are not copied, their storage is queued right after the header
+            EncryptPendingPackets();
+            if (buffer.GetRemainingSpace() < sizeof(PacketHeader) + 4 /*opcode*/)
+            {
+                QueuePacket(std::move(buffer));
+                buffer.Resize(_sendBufferSize);
+            }
+
+            MessageBuffer payload = WritePacketHeaderToBuffer(*queued, buffer);
+            QueuePacket(std::move(buffer));
+            QueuePacket(std::move(payload));
+            buffer.Resize(_sendBufferSize);
+
+            delete queued;
+            continue;
+        }
 
         // Flush current buffer if too small for next packet
         if (buffer.GetRemainingSpace() < packetSize + sizeof(PacketHeader))
         {
+            EncryptPendingPackets();
             QueuePacket(std::move(buffer));
             buffer.Resize(_sendBufferSize);
         }
@@ -222,12 +248,14 @@ bool WorldSocket::Update()
         {
             MessageBuffer packetBuffer(packetSize + sizeof(PacketHeader));
             WritePacketToBuffer(*queued, packetBuffer);
+            EncryptPendingPackets();
             QueuePacket(std::move(packetBuffer));
         }
 
         delete queued;
     }
 
+    EncryptPendingPackets();
     if (buffer.GetActiveSize() > 0)
         QueuePacket(std::move(buffer));
 
@@ -327,6 +355,7 @@ void WorldSocket::SetWorldSession(WorldSession* session)
     std::lock_guard<std::mutex> sessionGuard(_worldSessionLock);
     _worldSession = session;
     _authed = true;
+    _holdSendQueue = sWorld->getBoolConfig(CONFIG_NETWORK_TICK_ALIGNED_FLUSH);
 }
 
 bool WorldSocket::ReadHeaderHandler()
@@ -500,8 +529,12 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
             // Our Idle timer will reset on any non PING opcodes on login screen, allowing us to catch people idling.
             _worldSession->ResetTimeOutTime(false);
 
-            // Copy the packet to the heap before enqueuing
-            _worldSession->QueuePacket(new WorldPacket(std::move(packet)));
+            // Move the packet to the heap before enqueuing
+            ReceivedWorldPacket* receivedPacket = new ReceivedWorldPacket(std::move(packet));
+            if (sWorld->getBoolConfig(CONFIG_NETWORK_EARLY_PACKET_DECODE))
+                receivedPacket->Decode(handler);
+
+            _worldSession->QueuePacket(receivedPacket);
             break;
         }
     }
@@ -525,6 +558,8 @@ void WorldSocket::SendPacketAndLogOpcode(WorldPacket const& packet)
 {
     TC_LOG_TRACE("network.opcode", "S->C: {} {}", GetRemoteIpAddress(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet.GetOpcode())));
     SendPacket(packet);
+    // sent by the socket itself, not part of any world update
+    FlushSendQueue();
 }
 
 void WorldSocket::SendPacket(WorldPacket const& packet)
@@ -538,8 +573,20 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
 }
 
-void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBuffer& buffer)
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort(), GetConnectionType());
+
+    _bufferQueue.Enqueue(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
+}
+
+void WorldSocket::WritePacketToBuffer(EncryptablePacket const& encryptablePacket, MessageBuffer& buffer)
 {
+    WorldPacket const& packet = encryptablePacket.GetPacket();
     uint32 opcode = packet.GetOpcode();
     uint32 packetSize = packet.size();
 
@@ -549,7 +596,7 @@ void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBu
     uint8* dataPos = buffer.GetWritePointer();
     buffer.WriteCompleted(sizeof(opcode));
 
-    if (packetSize > MinSizeForCompression && packet.NeedsEncryption())
+    if (packetSize > _minSizeForCompression && encryptablePacket.NeedsEncryption())
     {
         CompressedWorldPacket cmp;
         cmp.UncompressedSize = packetSize + sizeof(opcode);
@@ -567,6 +614,9 @@ void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBu
         buffer.WriteCompleted(compressedSize);
         packetSize = compressedSize + sizeof(CompressedWorldPacket);
 
+        TC_METRIC_VALUE("network_compression_saved_bytes", int64(cmp.UncompressedSize) - int64(packetSize),
+            TC_METRIC_TAG("opcode", opcodeTable[static_cast<OpcodeServer>(opcode)]->Name));
+
         opcode = SMSG_COMPRESSED_PACKET;
     }
     else if (!packet.empty())
@@ -575,11 +625,39 @@ void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBu
     memcpy(dataPos, &opcode, sizeof(opcode));
     packetSize += sizeof(opcode);
 
+    // encrypted together with the rest of the buffer before it is queued
+    memcpy(headerPos + offsetof(PacketHeader, Size), &packetSize, sizeof(packetSize));
+    _pendingEncryption.push_back({ .Data = { dataPos, packetSize }, .Tag = reinterpret_cast<Trinity::Crypto::AES::Tag*>(headerPos + offsetof(PacketHeader, Tag)) });
+}
+
+void WorldSocket::EncryptPendingPackets()
+{
+    if (_pendingEncryption.empty())
+        return;
+
+    _authCrypt.EncryptSend(_pendingEncryption);
+    _pendingEncryption.clear();
+}
+
+MessageBuffer WorldSocket::WritePacketHeaderToBuffer(EncryptablePacket& packet, MessageBuffer& buffer)
+{
+    uint32 opcode = packet.GetOpcode();
+
+    uint8* headerPos = buffer.GetWritePointer();
+    buffer.WriteCompleted(sizeof(PacketHeader));
+    uint8* opcodePos = buffer.GetWritePointer();
+    buffer.Write(&opcode, sizeof(opcode));
+
+    MessageBuffer payload(std::move(packet).Release());
+
     PacketHeader header;
-    header.Size = packetSize;
-    _authCrypt.EncryptSend(dataPos, header.Size, header.Tag);
+    header.Size = payload.GetActiveSize() + sizeof(opcode);
+
+    std::array<std::span<uint8>, 2> data = { { { opcodePos, sizeof(opcode) }, { payload.GetReadPointer(), payload.GetActiveSize() } } };
+    _authCrypt.EncryptSend(data, header.Tag);
 
     memcpy(headerPos, &header, sizeof(PacketHeader));
+    return payload;
 }
 
 uint32 WorldSocket::CompressPacket(uint8* buffer, WorldPacket const& packet)
@@ -688,7 +766,7 @@ void WorldSocket::HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSess
     stmt->setInt32(0, int32(sRealmList->GetCurrentRealmId().Realm));
     stmt->setString(1, joinTicket->gameaccount());
 
-    QueueQuery(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback([this, authSession = std::move(authSession), joinTicket = std::move(joinTicket)](PreparedQueryResult result) mutable
+    QueueQuery(LoginDatabase.AsyncQuery(stmt, DatabaseQueuePriority::High).WithPreparedCallback([this, authSession = std::move(authSession), joinTicket = std::move(joinTicket)](PreparedQueryResult result) mutable
     {
         HandleAuthSessionCallback(std::move(authSession), std::move(joinTicket), std::move(result));
     }));
@@ -901,6 +979,7 @@ void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::
         static_pointer_cast<WorldSocket>(shared_from_this()), account.Game.Security, account.Game.Expansion, mutetime,
         account.Game.OS, account.Game.TimezoneOffset, account.Game.Build, buildVariant, account.Game.Locale,
         account.Game.Recruiter, account.Game.IsRectuiter);
+    _holdSendQueue = sWorld->getBoolConfig(CONFIG_NETWORK_TICK_ALIGNED_FLUSH);
 
     // Initialize Warden system only if it is enabled by config
     if (wardenActive)
@@ -938,7 +1017,7 @@ void WorldSocket::HandleAuthContinuedSession(std::shared_ptr<WorldPackets::Auth:
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_INFO_CONTINUED_SESSION);
     stmt->setUInt32(0, accountId);
 
-    QueueQuery(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback([this, authSession = std::move(authSession)](PreparedQueryResult result) mutable
+    QueueQuery(LoginDatabase.AsyncQuery(stmt, DatabaseQueuePriority::High).WithPreparedCallback([this, authSession = std::move(authSession)](PreparedQueryResult result) mutable
     {
         HandleAuthContinuedSessionCallback(std::move(authSession), std::move(result));
     }));
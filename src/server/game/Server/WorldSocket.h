@@ -50,11 +50,22 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : WorldPacket(packet->GetOpcode(), packet->GetConnection()),
+        _sharedPacket(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
     bool NeedsEncryption() const { return _encrypt; }
 
+    /// packet contents, either owned copy or storage shared with other sockets
+    WorldPacket const& GetPacket() const { return _sharedPacket ? *_sharedPacket : *this; }
+    bool IsShared() const { return _sharedPacket != nullptr; }
+
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WorldPacket const> _sharedPacket;
     bool _encrypt;
 };
 
@@ -89,7 +100,7 @@ struct IncomingPacketHeader : PacketHeader
 
 class TC_GAME_API WorldSocket final : public Trinity::Net::Socket<>
 {
-    static uint32 const MinSizeForCompression;
+    static uint32 const MinSizeForZeroCopySend;
 
     static std::array<uint8, 32> const AuthCheckSeed;
     static std::array<uint8, 32> const SessionKeySeed;
@@ -111,6 +122,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
 
     ConnectionType GetConnectionType() const { return _type; }
 
@@ -118,6 +130,9 @@ public:
     void SetWorldSession(WorldSession* session);
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
+    /// Allows the network thread to write packets held since the last flush (Network.TickAlignedFlush)
+    void FlushSendQueue() { _sendQueueFlushRequested.store(true, std::memory_order_release); }
+
     void OnClose() override;
     Trinity::Net::SocketReadCallbackResult ReadHandler() override;
 
@@ -143,7 +158,11 @@ private:
     void LogOpcodeText(OpcodeClient opcode, std::unique_lock<std::mutex> const& guard) const;
     /// sends and logs network.opcode without accessing WorldSession
     void SendPacketAndLogOpcode(WorldPacket const& packet);
+    /// packet is encrypted by the next EncryptPendingPackets call, which must happen before buffer is queued
     void WritePacketToBuffer(EncryptablePacket const& packet, MessageBuffer& buffer);
+    void EncryptPendingPackets();
+    /// writes only header and opcode to buffer, packet storage is encrypted in place and returned to be sent as is
+    MessageBuffer WritePacketHeaderToBuffer(EncryptablePacket& packet, MessageBuffer& buffer);
     uint32 CompressPacket(uint8* buffer, WorldPacket const& packet);
 
     void HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession);
@@ -176,8 +195,12 @@ private:
     MessageBuffer _packetBuffer;
     MPSCQueue<EncryptablePacket, &EncryptablePacket::SocketQueueLink> _bufferQueue;
     std::size_t _sendBufferSize;
+    std::vector<WorldPacketCrypt::SendBatchEntry> _pendingEncryption;
+    std::atomic<bool> _holdSendQueue;
+    std::atomic<bool> _sendQueueFlushRequested;
 
     z_stream* _compressionStream;
+    uint32 _minSizeForCompression;
 
     QueryCallbackProcessor _queryProcessor;
     std::string _ipCountry;
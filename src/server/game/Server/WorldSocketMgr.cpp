@@ -53,6 +53,8 @@ bool WorldSocketMgr::StartNetwork(Trinity::Asio::IoContext& ioContext, std::stri
 {
     _tcpNoDelay = sConfigMgr->GetBoolDefault("Network.TcpNodelay", true);
 
+    _reusePortListeners = sConfigMgr->GetBoolDefault("Network.ReusePortListeners", false);
+
     int const max_connections = TRINITY_MAX_LISTEN_CONNECTIONS;
     TC_LOG_DEBUG("misc", "Max allowed socket connections {}", max_connections);
 
@@ -70,7 +72,7 @@ bool WorldSocketMgr::StartNetwork(Trinity::Asio::IoContext& ioContext, std::stri
     if (!BaseSocketMgr::StartNetwork(ioContext, bindIp, port, threadCount))
         return false;
 
-    _acceptor->AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
+    AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
     {
         OnSocketOpen(std::move(sock), threadIndex);
     });
@@ -82,14 +82,14 @@ uint32 Battlenet::Services::GameUtilitiesService::HandleRealmListRequest(std::un
     if (Variant const* subRegion = Trinity::Containers::MapGetValuePtr(params, "Command_RealmListRequest_v1"))
         subRegionId = subRegion->string_value();
 
-    std::vector<uint8> compressed = sRealmList->GetRealmList(_session->GetClientBuild(), _session->GetSecurity(), subRegionId);
+    RealmList::CompressedJson realmList = sRealmList->GetRealmList(_session->GetClientBuild(), _session->GetSecurity(), subRegionId);
 
-    if (compressed.empty())
+    if (!realmList)
         return ERROR_UTIL_SERVER_FAILED_TO_SERIALIZE_RESPONSE;
 
     Attribute* attribute = response->add_attribute();
     attribute->set_name("Param_RealmList");
-    attribute->mutable_value()->set_blob_value(compressed.data(), compressed.size());
+    attribute->mutable_value()->set_blob_value(realmList->data(), realmList->size());
 
     JSON::RealmList::RealmCharacterCountList realmCharacterCounts;
     for (auto const& characterCount : _session->GetRealmCharacterCounts())
@@ -101,6 +101,7 @@ uint32 Battlenet::Services::GameUtilitiesService::HandleRealmListRequest(std::un
 
     std::string json = "JSONRealmCharacterCountList:" + JSON::Serialize(realmCharacterCounts);
 
+    std::vector<uint8> compressed;
     uLongf compressedLength = compressBound(json.length());
     compressed.resize(4 + compressedLength);
     *reinterpret_cast<uint32*>(compressed.data()) = json.length() + 1;
@@ -721,6 +721,7 @@ AuraEffect::AuraEffect(Aura* base, SpellEffectInfo const& spellEfffectInfo, int3
 m_base(base), m_spellInfo(base->GetSpellInfo()), m_effectInfo(spellEfffectInfo), m_spellmod(nullptr),
 m_baseAmount(baseAmount ? *baseAmount : spellEfffectInfo.CalcBaseValue(caster, base->GetType() == UNIT_AURA_TYPE ? base->GetOwner()->ToUnit() : nullptr, base->GetCastItemId(), base->GetCastItemLevel())),
 _amount(), _periodicTimer(0), _period(0), _ticksDone(0),
+_sameEffectStackRuleGroup(sSpellMgr->GetSameEffectStackRuleSpellGroup(m_spellInfo, spellEfffectInfo.ApplyAuraName)),
 m_canBeRecalculated(true), m_isPeriodic(false)
 {
     CalculatePeriodic(caster, true, false);
@@ -3756,6 +3757,8 @@ void AuraEffect::HandleAuraModStat(AuraApplication const* aurApp, uint8 mode, bo
     if (std::abs(spellGroupVal) >= std::abs(GetAmount()))
         return;
 
+    // all stat auras update the values shared by every stat only once
+    DeferredStatUpdateScope deferredStatUpdates(target);
     for (int32 i = STAT_STRENGTH; i < MAX_STATS; ++i)
     {
         // -1 or -2 is all stats (misc < -2 checked in function beginning)
@@ -3882,23 +3885,27 @@ void AuraEffect::HandleModTotalPercentStat(AuraApplication const* aurApp, uint8
     if (target->getDeathState() == CORPSE)
         zeroHealth = (target->GetHealth() == 0);
 
-    for (int32 i = STAT_STRENGTH; i < MAX_STATS; ++i)
+    // health is restored from the updated maximum below, apply the deferred updates before
     {
-        if (GetMiscValueB() & 1 << i || !GetMiscValueB()) // 0 is also used for all stats
+        DeferredStatUpdateScope deferredStatUpdates(target);
+        for (int32 i = STAT_STRENGTH; i < MAX_STATS; ++i)
         {
-            float amount = target->GetTotalAuraMultiplier(SPELL_AURA_MOD_TOTAL_STAT_PERCENTAGE, [i](AuraEffect const* aurEff) -> bool
+            if (GetMiscValueB() & 1 << i || !GetMiscValueB()) // 0 is also used for all stats
             {
-                if (aurEff->GetMiscValueB() & 1 << i || !aurEff->GetMiscValueB())
-                    return true;
-                return false;
-            });
+                float amount = target->GetTotalAuraMultiplier(SPELL_AURA_MOD_TOTAL_STAT_PERCENTAGE, [i](AuraEffect const* aurEff) -> bool
+                {
+                    if (aurEff->GetMiscValueB() & 1 << i || !aurEff->GetMiscValueB())
+                        return true;
+                    return false;
+                });
 
-            if (target->GetPctModifierValue(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT) == amount)
-                continue;
+                if (target->GetPctModifierValue(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT) == amount)
+                    continue;
 
-            target->SetStatPctModifier(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT, amount);
-            if (target->GetTypeId() == TYPEID_PLAYER || target->IsPet())
-                target->UpdateStatBuffMod(Stats(i));
+                target->SetStatPctModifier(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT, amount);
+                if (target->GetTypeId() == TYPEID_PLAYER || target->IsPet())
+                    target->UpdateStatBuffMod(Stats(i));
+            }
         }
     }
 
@@ -4584,6 +4591,7 @@ void AuraEffect::HandleModRating(AuraApplication const* aurApp, uint8 mode, bool
     if (target->GetTypeId() != TYPEID_PLAYER)
         return;
 
+    DeferredStatUpdateScope deferredStatUpdates(target);
     for (uint32 rating = 0; rating < MAX_COMBAT_RATING; ++rating)
         if (GetMiscValue() & (1 << rating))
             target->ToPlayer()->ApplyRatingMod(CombatRating(rating), GetAmount(), apply);
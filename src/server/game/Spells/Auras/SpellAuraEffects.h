@@ -56,6 +56,8 @@ class TC_GAME_API AuraEffect
         int32 GetMiscValueB() const { return GetSpellEffectInfo().MiscValueB; }
         int32 GetMiscValue() const { return GetSpellEffectInfo().MiscValue; }
         AuraType GetAuraType() const { return GetSpellEffectInfo().ApplyAuraName; }
+        // SpellGroup with SPELL_GROUP_STACK_RULE_EXCLUSIVE_SAME_EFFECT for this aura type, resolved once instead of on every modifier query
+        uint32 GetSameEffectStackRuleGroup() const { return _sameEffectStackRuleGroup; }
         int32 GetAmount() const { return _amount; }
         void SetAmount(int32 amount) { _amount = amount; m_canBeRecalculated = false; }
 
@@ -124,6 +126,8 @@ class TC_GAME_API AuraEffect
         int32 _period;          // time between consecutive ticks
         uint32 _ticksDone;      // ticks counter
 
+        uint32 _sameEffectStackRuleGroup;
+
         bool m_canBeRecalculated;
         bool m_isPeriodic;
 
@@ -17,6 +17,7 @@
 
 #include "SpellAuras.h"
 #include "CellImpl.h"
+#include "CombatLogPackets.h"
 #include "Common.h"
 #include "Containers.h"
 #include "DynamicObject.h"
@@ -480,7 +481,8 @@ m_applyTime(GameTime::GetGameTime()), m_owner(createInfo._owner), m_timeCla(0),
 m_casterLevel(createInfo.Caster ? createInfo.Caster->GetLevel() : m_spellInfo->SpellLevel), m_procCharges(0), m_stackAmount(createInfo.StackAmount),
 m_isRemoved(false), m_isSingleTarget(false), m_isUsingCharges(false), m_dropEvent(nullptr),
 m_procCooldown(TimePoint::min()),
-m_lastProcAttemptTime(GameTime::Now() - Seconds(10)), m_lastProcSuccessTime(GameTime::Now() - Seconds(120)), m_scriptRef(this, NoopAuraDeleter())
+m_lastProcAttemptTime(GameTime::Now() - Seconds(10)), m_lastProcSuccessTime(GameTime::Now() - Seconds(120)), _isBatchingPeriodicAuraLogs(false),
+m_scriptRef(this, NoopAuraDeleter())
 {
     if (!m_spellInfo->HasAttribute(SPELL_ATTR6_DO_NOT_CONSUME_RESOURCES))
     {
@@ -547,6 +549,36 @@ Aura::~Aura()
     _DeleteRemovedApplications();
 }
 
+WorldPackets::CombatLog::SpellPeriodicAuraLog* Aura::GetPendingPeriodicAuraLog(Unit const* target)
+{
+    if (!_isBatchingPeriodicAuraLogs)
+        return nullptr;
+
+    auto itr = std::ranges::find(_pendingPeriodicAuraLogs, target->GetGUID(), [](std::unique_ptr<WorldPackets::CombatLog::SpellPeriodicAuraLog> const& log) { return log->TargetGUID; });
+    if (itr != _pendingPeriodicAuraLogs.end())
+        return itr->get();
+
+    WorldPackets::CombatLog::SpellPeriodicAuraLog* log = _pendingPeriodicAuraLogs.emplace_back(std::make_unique<WorldPackets::CombatLog::SpellPeriodicAuraLog>()).get();
+    log->TargetGUID = target->GetGUID();
+    log->CasterGUID = GetCasterGUID();
+    log->SpellID = GetId();
+    return log;
+}
+
+void Aura::SendPendingPeriodicAuraLogs()
+{
+    for (std::unique_ptr<WorldPackets::CombatLog::SpellPeriodicAuraLog> const& log : _pendingPeriodicAuraLogs)
+    {
+        if (Unit* target = ObjectAccessor::GetUnit(*m_owner, log->TargetGUID))
+        {
+            log->LogData.Initialize(target);
+            target->SendCombatLogMessage(log.get());
+        }
+    }
+
+    _pendingPeriodicAuraLogs.clear();
+}
+
 void Aura::SetSpellVisual(SpellCastVisual const& spellVisual)
 {
     m_spellVisual = spellVisual;
@@ -664,6 +696,7 @@ void Aura::UpdateTargetMap(Unit* caster, bool apply)
     // fill up to date target list
     //                 target, effMask
     std::unordered_map<Unit*, uint32> targets;
+    targets.reserve(m_applications.size());
 
     FillTargetMap(targets, caster);
 
@@ -841,8 +874,12 @@ void Aura::UpdateOwner(uint32 diff, WorldObject* owner)
         m_updateTargetMapInterval -= diff;
 
     // update aura effects
+    _isBatchingPeriodicAuraLogs = true;
     for (AuraEffect* effect : GetAuraEffects())
         effect->Update(diff, caster);
+    _isBatchingPeriodicAuraLogs = false;
+
+    SendPendingPeriodicAuraLogs();
 
     // remove spellmods after effects update
     if (modSpell)
@@ -2557,6 +2594,8 @@ void UnitAura::FillTargetMap(std::unordered_map<Unit*, uint32>& targets, Unit* c
     if (unitOwner->HasAuraState(AURA_STATE_BANISHED, GetSpellInfo(), caster))
         return;
 
+    // reused for all effects
+    std::vector<Unit*> units;
     for (SpellEffectInfo const& spellEffectInfo : GetSpellInfo()->GetEffects())
     {
         if (!HasEffect(spellEffectInfo.EffectIndex))
@@ -2566,7 +2605,7 @@ void UnitAura::FillTargetMap(std::unordered_map<Unit*, uint32>& targets, Unit* c
         if (spellEffectInfo.IsEffect(SPELL_EFFECT_APPLY_AURA))
             continue;
 
-        std::vector<Unit*> units;
+        units.clear();
         ConditionContainer* condList = spellEffectInfo.ImplicitTargetConditions.get();
 
         float radius = spellEffectInfo.CalcRadius(ref);
@@ -2703,6 +2742,8 @@ void DynObjAura::FillTargetMap(std::unordered_map<Unit*, uint32>& targets, Unit*
     Unit* dynObjOwnerCaster = dynObjOwner->GetCaster();
     float radius = dynObjOwner->GetRadius();
 
+    // reused for all effects
+    std::vector<Unit*> units;
     for (SpellEffectInfo const& spellEffectInfo : GetSpellInfo()->GetEffects())
     {
         if (!HasEffect(spellEffectInfo.EffectIndex))
@@ -2713,7 +2754,7 @@ void DynObjAura::FillTargetMap(std::unordered_map<Unit*, uint32>& targets, Unit*
         if (spellEffectInfo.TargetB.GetReferenceType() == TARGET_REFERENCE_TYPE_DEST)
             selectionType = spellEffectInfo.TargetB.GetCheckType();
 
-        std::vector<Unit*> units;
+        units.clear();
         ConditionContainer* condList = spellEffectInfo.ImplicitTargetConditions.get();
 
         Trinity::WorldObjectSpellAreaTargetCheck check(radius, dynObjOwner, dynObjOwnerCaster, dynObjOwnerCaster, m_spellInfo, selectionType, condList, TARGET_OBJECT_TYPE_UNIT);
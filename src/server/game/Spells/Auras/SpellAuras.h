@@ -32,6 +32,11 @@ struct SpellProcEntry;
 
 namespace WorldPackets
 {
+    namespace CombatLog
+    {
+        class SpellPeriodicAuraLog;
+    }
+
     namespace Spells
     {
         struct AuraInfo;
@@ -377,6 +382,10 @@ class TC_GAME_API Aura
 
         Trinity::unique_weak_ptr<Aura> GetWeakPtr() const { return m_scriptRef; }
 
+        // Periodic ticks of all effects during UpdateOwner share one combat log packet per target
+        // returns nullptr outside of UpdateOwner, log must be sent immediately then
+        WorldPackets::CombatLog::SpellPeriodicAuraLog* GetPendingPeriodicAuraLog(Unit const* target);
+
         Aura(Aura const&) = delete;
         Aura(Aura&&) = delete;
 
@@ -386,6 +395,7 @@ class TC_GAME_API Aura
     private:
         AuraScript* GetScriptByType(std::type_info const& type) const;
         void _DeleteRemovedApplications();
+        void SendPendingPeriodicAuraLogs();
 
     protected:
         SpellInfo const* const m_spellInfo;
@@ -424,6 +434,9 @@ class TC_GAME_API Aura
     private:
         std::vector<AuraApplication*> _removedApplications;
 
+        bool _isBatchingPeriodicAuraLogs;
+        std::vector<std::unique_ptr<WorldPackets::CombatLog::SpellPeriodicAuraLog>> _pendingPeriodicAuraLogs;
+
         AuraEffectVector _effects;
 
         struct NoopAuraDeleter { void operator()(Aura*) const { /*noop - not managed*/ } };
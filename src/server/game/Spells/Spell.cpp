@@ -33,6 +33,7 @@
 #include "DatabaseEnv.h"
 #include "DisableMgr.h"
 #include "DynamicObject.h"
+#include "FrameArena.h"
 #include "G3DPosition.hpp"
 #include "GameObjectAI.h"
 #include "GridNotifiersImpl.h"
@@ -68,6 +69,7 @@
 #include "VMapManager2.h"
 #include "World.h"
 #include "WorldSession.h"
+#include <algorithm>
 #include <numeric>
 #include <sstream>
 
@@ -1415,18 +1417,25 @@ void Spell::SelectImplicitAreaTargets(SpellEffectInfo const& spellEffectInfo, Sp
     CallScriptObjectAreaTargetSelectHandlers(targets, spellEffectInfo.EffectIndex, targetType);
 
     if (targetType.GetTarget() == TARGET_UNIT_SRC_AREA_FURTHEST_ENEMY)
-        targets.sort(Trinity::ObjectDistanceOrderPred(referer, false));
+    {
+        uint32 maxTargets = m_spellValue->MaxAffectedTargets;
+        if (maxTargets && targets.size() > maxTargets)
+        {
+            // only the furthest maxTargets are kept, no need to order the rest
+            Trinity::FrameVector<WorldObject*> furthest(targets.begin(), targets.end());
+            std::ranges::partial_sort(furthest, furthest.begin() + maxTargets, Trinity::ObjectDistanceOrderPred(referer, false));
+            targets.assign(furthest.begin(), furthest.begin() + maxTargets);
+        }
+        else
+            targets.sort(Trinity::ObjectDistanceOrderPred(referer, false));
+    }
 
     if (!targets.empty())
     {
         // Other special target selection goes here
         if (uint32 maxTargets = m_spellValue->MaxAffectedTargets)
-        {
             if (targetType.GetTarget() != TARGET_UNIT_SRC_AREA_FURTHEST_ENEMY)
                 Trinity::Containers::RandomResize(targets, maxTargets);
-            else if (targets.size() > maxTargets)
-                targets.resize(maxTargets);
-        }
 
         for (WorldObject* itr : targets)
         {
@@ -2183,7 +2192,8 @@ WorldObject* Spell::SearchNearbyTarget(SpellEffectInfo const& spellEffectInfo, f
     return target;
 }
 
-void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, SpellEffectInfo const& spellEffectInfo, float range, Position const* position, WorldObject* referer,
+template <typename Container>
+void Spell::SearchAreaTargets(Container& targets, SpellEffectInfo const& spellEffectInfo, float range, Position const* position, WorldObject* referer,
     SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionContainer const* condList,
     Trinity::WorldObjectSpellAreaTargetSearchReason searchReason)
 {
@@ -2194,7 +2204,14 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, SpellEffectInfo
     float extraSearchRadius = range > 0.0f ? EXTRA_CELL_SEARCH_RADIUS : 0.0f;
     Trinity::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList, objectType, searchReason);
     Trinity::WorldObjectListSearcher searcher(PhasingHandler::GetAlwaysVisiblePhaseShift(), targets, check, containerTypeMask);
-    SearchTargets(searcher, containerTypeMask, m_caster, position, range + extraSearchRadius);
+    if (range > 0.0f)
+    {
+        // extra search radius also covers target combat reach, no need to check objects farther away than that
+        Trinity::WorldObjectInRangeSearcher inRangeSearcher(searcher, position->GetPositionX(), position->GetPositionY(), range + extraSearchRadius);
+        SearchTargets(inRangeSearcher, containerTypeMask, m_caster, position, range + extraSearchRadius);
+    }
+    else
+        SearchTargets(searcher, containerTypeMask, m_caster, position, range + extraSearchRadius);
 }
 
 void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType,
@@ -2239,16 +2256,17 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     }();
 
     WorldObject* chainSource = m_spellInfo->HasAttribute(SPELL_ATTR2_CHAIN_FROM_CASTER) ? m_caster : target;
-    std::list<WorldObject*> tempTargets;
+    // contiguous storage, every jump scans all remaining candidates
+    Trinity::FrameVector<WorldObject*> tempTargets;
     SearchAreaTargets(tempTargets, spellEffectInfo, searchRadius, chainSource, m_caster, objectType, selectType, spellEffectInfo.ImplicitTargetConditions.get(),
         Trinity::WorldObjectSpellAreaTargetSearchReason::Chain);
-    tempTargets.remove(target);
+    std::erase(tempTargets, target);
 
     // remove targets which are always invalid for chain spells
     // for some spells allow only chain targets in front of caster (swipe for example)
     if (m_spellInfo->HasAttribute(SPELL_ATTR5_MELEE_CHAIN_TARGETING))
     {
-        tempTargets.remove_if([&](WorldObject* object)
+        std::erase_if(tempTargets, [&](WorldObject* object)
         {
             return !m_caster->HasInArc(static_cast<float>(M_PI), object);
         });
@@ -2257,12 +2275,12 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     while (chainTargets)
     {
         // try to get unit for next chain jump
-        std::list<WorldObject*>::iterator foundItr = tempTargets.end();
+        Trinity::FrameVector<WorldObject*>::iterator foundItr = tempTargets.end();
         // get unit with highest hp deficit in dist
         if (isChainHeal)
         {
             uint32 maxHPDeficit = 0;
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            for (Trinity::FrameVector<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
             {
                 if (Unit* unit = (*itr)->ToUnit())
                 {
@@ -2278,7 +2296,7 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
         // get closest object
         else
         {
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            for (Trinity::FrameVector<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
             {
                 bool isBestDistanceMatch = foundItr != tempTargets.end() ? chainSource->GetDistanceOrder(*itr, *foundItr) : chainSource->IsWithinDist(*itr, jumpRadius);
                 if (!isBestDistanceMatch)
@@ -3987,6 +4005,9 @@ void Spell::DoProcessTargetContainer(Container& targetContainer)
 
 void Spell::handle_immediate()
 {
+    // damage and heal logs of all targets are sent by the caster, find their receivers once
+    CombatLogBatch combatLogBatch;
+
     // start channeling if applicable
     if (m_spellInfo->IsChanneled())
     {
@@ -4084,6 +4105,9 @@ uint64 Spell::handle_delayed(uint64 t_offset)
         return 0;
     }
 
+    // damage and heal logs of all targets are sent by the caster, find their receivers once
+    CombatLogBatch combatLogBatch;
+
     // when spell has a single missile we hit all targets (except caster) at the same time
     bool single_missile = m_targets.HasDst();
     bool ignoreTargetInfoTimeDelay = single_missile;
@@ -138,7 +138,7 @@ struct SpellHistory::PersistenceHelper<Pet>
     }
 };
 
-SpellHistory::SpellHistory(Unit* owner) : _owner(owner), _schoolLockouts()
+SpellHistory::SpellHistory(Unit* owner) : _owner(owner), _schoolLockouts(), _nextExpiry(TimePoint::min())
 {
 }
 
@@ -160,6 +160,8 @@ void SpellHistory::LoadFromDB(PreparedQueryResult cooldownsResult, PreparedQuery
                 _spellCooldowns[spellId] = cooldown;
                 if (cooldown.CategoryId)
                     _categoryCooldowns[cooldown.CategoryId] = &_spellCooldowns[spellId];
+
+                ScheduleExpiry(std::min(cooldown.CooldownEnd, cooldown.CategoryEnd));
             }
 
         } while (cooldownsResult->NextRow());
@@ -173,7 +175,10 @@ void SpellHistory::LoadFromDB(PreparedQueryResult cooldownsResult, PreparedQuery
             uint32 categoryId = 0;
             ChargeEntry charges;
             if (StatementInfo::ReadCharge(fields, &categoryId, &charges))
+            {
                 _categoryCharges[categoryId].push_back(charges);
+                ScheduleExpiry(charges.RechargeEnd);
+            }
 
         } while (chargesResult->NextRow());
     }
@@ -221,12 +226,19 @@ void SpellHistory::SaveToDB(CharacterDatabaseTransaction trans)
 void SpellHistory::Update()
 {
     TimePoint now = time_point_cast<Duration>(GameTime::GetTime<Clock>());
+    if (now < _nextExpiry)
+        return;
+
+    _nextExpiry = TimePoint::max();
     for (auto itr = _categoryCooldowns.begin(); itr != _categoryCooldowns.end();)
     {
         if (itr->second->CategoryEnd < now)
             itr = _categoryCooldowns.erase(itr);
         else
+        {
+            ScheduleExpiry(itr->second->CategoryEnd);
             ++itr;
+        }
     }
 
     for (auto itr = _spellCooldowns.begin(); itr != _spellCooldowns.end();)
@@ -234,12 +246,20 @@ void SpellHistory::Update()
         if (itr->second.CooldownEnd < now)
             itr = EraseCooldown(itr);
         else
+        {
+            ScheduleExpiry(itr->second.CooldownEnd);
             ++itr;
+        }
     }
 
     for (auto& [chargeCategoryId, chargeRefreshTimes] : _categoryCharges)
+    {
         while (!chargeRefreshTimes.empty() && chargeRefreshTimes.front().RechargeEnd <= now)
             chargeRefreshTimes.pop_front();
+
+        if (!chargeRefreshTimes.empty())
+            ScheduleExpiry(chargeRefreshTimes.front().RechargeEnd);
+    }
 }
 
 void SpellHistory::HandleCooldowns(SpellInfo const* spellInfo, Item const* item, Spell* spell /*= nullptr*/)
@@ -588,6 +608,8 @@ void SpellHistory::AddCooldown(uint32 spellId, uint32 itemId, TimePoint cooldown
 
         if (categoryId)
             _categoryCooldowns[categoryId] = &cooldownEntry;
+
+        ScheduleExpiry(std::min(cooldownEnd, categoryEnd));
     }
 }
 
@@ -616,6 +638,8 @@ void SpellHistory::ModifySpellCooldown(CooldownStorageType::iterator& itr, Durat
             itr->second.CooldownEnd = itr->second.CategoryEnd;
     }
 
+    ScheduleExpiry(std::min(itr->second.CooldownEnd, itr->second.CategoryEnd));
+
     if (Player* playerOwner = GetPlayerOwner())
     {
         WorldPackets::Spells::ModifyCooldown modifyCooldown;
@@ -645,6 +669,8 @@ void SpellHistory::UpdateCooldownRecoveryRate(CooldownStorageType::iterator& itr
     if (itr->second.CategoryId)
         itr->second.CategoryEnd = now + duration_cast<Duration>((itr->second.CategoryEnd - now) * modChange);
 
+    ScheduleExpiry(std::min(itr->second.CooldownEnd, itr->second.CategoryEnd));
+
     if (Player* playerOwner = GetPlayerOwner())
     {
         WorldPackets::Spells::UpdateCooldown updateCooldown;
@@ -869,7 +895,7 @@ bool SpellHistory::ConsumeCharge(uint32 chargeCategoryId)
         else
             recoveryStart = charges.back().RechargeEnd;
 
-        charges.emplace_back(recoveryStart, Milliseconds(chargeRecovery));
+        ScheduleExpiry(charges.emplace_back(recoveryStart, Milliseconds(chargeRecovery)).RechargeEnd);
         return true;
     }
 
@@ -897,6 +923,9 @@ void SpellHistory::ModifyChargeRecoveryTime(uint32 chargeCategoryId, Duration co
     while (!itr->second.empty() && itr->second.front().RechargeEnd < now)
         itr->second.pop_front();
 
+    if (!itr->second.empty())
+        ScheduleExpiry(itr->second.front().RechargeEnd);
+
     SendSetSpellCharges(chargeCategoryId, itr->second);
 }
 
@@ -919,6 +948,7 @@ void SpellHistory::UpdateChargeRecoveryRate(uint32 chargeCategoryId, float modCh
     chargeItr->RechargeEnd = now + duration_cast<Duration>((chargeItr->RechargeEnd - now) * modChange);
 
     TimePoint prevEnd = chargeItr->RechargeEnd;
+    ScheduleExpiry(prevEnd);
 
     while (++chargeItr != itr->second.end())
     {
@@ -1194,6 +1224,8 @@ void SpellHistory::RestoreCooldownStateAfterDuel()
             auto [itr, inserted] = _spellCooldowns.try_emplace(spellId, cooldown);
             if (!inserted && !itr->second.OnHold /*don't override if pre-existing cooldown is on hold*/)
                 itr->second = cooldown;
+
+            ScheduleExpiry(std::min(itr->second.CooldownEnd, itr->second.CategoryEnd));
         }
 
         // update the client: restore old cooldowns
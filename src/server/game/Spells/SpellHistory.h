@@ -220,6 +220,13 @@ private:
         return _spellCooldowns.erase(itr);
     }
 
+    // Update() skips all storage scans until this point in time is reached, every change that can bring an expiry closer must go through here
+    void ScheduleExpiry(TimePoint expiry)
+    {
+        if (expiry < _nextExpiry)
+            _nextExpiry = expiry;
+    }
+
     void SendSetSpellCharges(uint32 chargeCategoryId, ChargeEntryCollection const& chargeCollection) const;
 
     Unit* _owner;
@@ -230,6 +237,7 @@ private:
     ChargeStorageType _categoryCharges;
     GlobalCooldownStorageType _globalCooldowns;
     Optional<TimePoint> _pauseTime;
+    TimePoint _nextExpiry;
 
     template<class T>
     struct PersistenceHelper { };
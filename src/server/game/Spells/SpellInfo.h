@@ -388,19 +388,10 @@ class TC_GAME_API SpellInfo
         float LaunchDelay = 0.0f;
         float MinDuration = 0.0f;
         uint32 StackAmount = 0;
-        std::array<int32, MAX_SPELL_TOTEMS> Totem = {};
-        std::array<uint16, MAX_SPELL_TOTEMS> TotemCategory = {};
-        std::array<int32, MAX_SPELL_REAGENTS> Reagent = {};
-        std::array<int16, MAX_SPELL_REAGENTS> ReagentCount = {};
-        std::vector<SpellReagentsCurrencyEntry const*> ReagentsCurrency;
         int32 EquippedItemClass = -1;
         int32 EquippedItemSubClassMask = 0;
         int32 EquippedItemInventoryTypeMask = 0;
-        uint32 IconFileDataId = 0;
-        uint32 ActiveIconFileDataId = 0;
         uint32 ContentTuningId = 0;
-        uint32 ShowFutureSpellPlayerConditionID = 0;
-        LocalizedString const* SpellName = nullptr;
         float ConeAngle = 0.0f;
         float Width = 0.0f;
         uint32 MaxTargetLevel = 0;
@@ -413,7 +404,6 @@ class TC_GAME_API SpellInfo
         uint32 SchoolMask = 0;
         uint32 ChargeCategoryId = 0;
         std::unordered_set<uint32> Labels;
-        std::vector<Milliseconds> EmpowerStageThresholds;
 
         // SpellScalingEntry
         struct ScalingInfo
@@ -432,6 +422,19 @@ class TC_GAME_API SpellInfo
             int32 NumNonDiminishedTargets = 0;  // The amount of targets that still take the full amount before the damage decreases by the Square Root AOE formula
         } SqrtDamageAndHealingDiminishing;
 
+        // Kept behind the fields checked on every cast and proc so that those share as few cache lines as possible,
+        // these are only read for spells using them or when building packets
+        std::array<int32, MAX_SPELL_TOTEMS> Totem = {};
+        std::array<uint16, MAX_SPELL_TOTEMS> TotemCategory = {};
+        std::array<int32, MAX_SPELL_REAGENTS> Reagent = {};
+        std::array<int16, MAX_SPELL_REAGENTS> ReagentCount = {};
+        std::vector<SpellReagentsCurrencyEntry const*> ReagentsCurrency;
+        uint32 IconFileDataId = 0;
+        uint32 ActiveIconFileDataId = 0;
+        uint32 ShowFutureSpellPlayerConditionID = 0;
+        LocalizedString const* SpellName = nullptr;
+        std::vector<Milliseconds> EmpowerStageThresholds;
+
         explicit SpellInfo(SpellNameEntry const* spellName, ::Difficulty difficulty, SpellInfoLoadHelper const& data);
         explicit SpellInfo(SpellNameEntry const* spellName, ::Difficulty difficulty, std::vector<SpellEffectEntry> const& effects);
         SpellInfo(SpellInfo const&) = delete;
@@ -63,6 +63,34 @@ namespace
         >
     > mSpellInfoMap;
 
+    // DIFFICULTY_NONE entries by spell id, most lookups are for them and avoid hashing the composite key
+    std::vector<SpellInfo const*> mSpellInfoByIdNoDifficulty;
+
+    void IndexSpellInfoStore()
+    {
+        mSpellInfoByIdNoDifficulty.clear();
+
+        uint32 maxSpellId = 0;
+        std::size_t spellCount = 0;
+        for (SpellInfo const& spellInfo : mSpellInfoMap)
+        {
+            if (spellInfo.Difficulty != DIFFICULTY_NONE)
+                continue;
+
+            maxSpellId = std::max(maxSpellId, spellInfo.Id);
+            ++spellCount;
+        }
+
+        // spell ids are mostly compact, do not let a few outliers turn this into a mostly empty array
+        if (!spellCount || maxSpellId / 8 > spellCount)
+            return;
+
+        mSpellInfoByIdNoDifficulty.resize(maxSpellId + 1);
+        for (SpellInfo const& spellInfo : mSpellInfoMap)
+            if (spellInfo.Difficulty == DIFFICULTY_NONE)
+                mSpellInfoByIdNoDifficulty[spellInfo.Id] = &spellInfo;
+    }
+
     class ServersideSpellName
     {
     public:
@@ -410,7 +438,7 @@ void SpellMgr::GetSetOfSpellsInSpellGroup(SpellGroup group_id, std::set<uint32>&
     }
 }
 
-bool SpellMgr::AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uint32 auraType, int32 amount, std::map<SpellGroup, int32>& groups) const
+SpellGroup SpellMgr::GetSameEffectStackRuleSpellGroup(SpellInfo const* spellInfo, uint32 auraType) const
 {
     uint32 spellId = spellInfo->GetFirstRankSpell()->Id;
     auto spellGroupBounds = GetSpellSpellGroupMapBounds(spellId);
@@ -425,23 +453,32 @@ bool SpellMgr::AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uin
             if (!found->second.count(auraType))
                 continue;
 
-            // Put the highest amount in the map
-            auto groupItr = groups.find(group);
-            if (groupItr == groups.end())
-                groups.emplace(group, amount);
-            else
-            {
-                int32 curr_amount = groups[group];
-                // Take absolute value because this also counts for the highest negative aura
-                if (std::abs(curr_amount) < std::abs(amount))
-                    groupItr->second = amount;
-            }
-            // return because a spell should be in only one SPELL_GROUP_STACK_RULE_EXCLUSIVE_SAME_EFFECT group per auraType
-            return true;
+            // a spell should be in only one SPELL_GROUP_STACK_RULE_EXCLUSIVE_SAME_EFFECT group per auraType
+            return group;
         }
     }
+
+    return SPELL_GROUP_NONE;
+}
+
+bool SpellMgr::AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uint32 auraType, int32 amount, std::map<SpellGroup, int32>& groups) const
+{
+    SpellGroup group = GetSameEffectStackRuleSpellGroup(spellInfo, auraType);
     // Not in a SPELL_GROUP_STACK_RULE_EXCLUSIVE_SAME_EFFECT group, so return false
-    return false;
+    if (group == SPELL_GROUP_NONE)
+        return false;
+
+    AddSameEffectStackRuleSpellGroupAmount(group, amount, groups);
+    return true;
+}
+
+void SpellMgr::AddSameEffectStackRuleSpellGroupAmount(SpellGroup group, int32 amount, std::map<SpellGroup, int32>& groups)
+{
+    // Put the highest amount in the map
+    auto [groupItr, inserted] = groups.try_emplace(group, amount);
+    // Take absolute value because this also counts for the highest negative aura
+    if (!inserted && std::abs(groupItr->second) < std::abs(amount))
+        groupItr->second = amount;
 }
 
 SpellGroupStackRule SpellMgr::CheckSpellGroupStackRules(SpellInfo const* spellInfo1, SpellInfo const* spellInfo2) const
@@ -691,6 +728,11 @@ CreatureImmunities const* SpellMgr::GetCreatureImmunities(int32 creatureImmuniti
 
 SpellInfo const* SpellMgr::GetSpellInfo(uint32 spellId, Difficulty difficulty) const
 {
+    // index holds exact matches only, misses still go through the fallback chain below
+    if (difficulty == DIFFICULTY_NONE && spellId < mSpellInfoByIdNoDifficulty.size())
+        if (SpellInfo const* spellInfo = mSpellInfoByIdNoDifficulty[spellId])
+            return spellInfo;
+
     auto itr = mSpellInfoMap.find(boost::make_tuple(spellId, difficulty));
     if (itr != mSpellInfoMap.end())
         return &*itr;
@@ -2712,12 +2754,15 @@ void SpellMgr::LoadSpellInfoStore()
         mSpellInfoMap.emplace(spellNameEntry, key.second, data);
     }
 
+    IndexSpellInfoStore();
+
     TC_LOG_INFO("server.loading", ">> Loaded SpellInfo store in {} ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
 void SpellMgr::UnloadSpellInfoStore()
 {
     mSpellInfoMap.clear();
+    mSpellInfoByIdNoDifficulty.clear();
     mServersideSpellNames.clear();
 }
 
@@ -2969,6 +3014,8 @@ void SpellMgr::LoadSpellInfoServerside()
         } while (spellsResult->NextRow());
     }
 
+    IndexSpellInfoStore();
+
     TC_LOG_INFO("server.loading", ">> Loaded {} serverside spells {} ms", mServersideSpellNames.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
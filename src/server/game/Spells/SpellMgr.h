@@ -696,7 +696,9 @@ class TC_GAME_API SpellMgr
         void GetSetOfSpellsInSpellGroup(SpellGroup group_id, std::set<uint32>& foundSpells, std::set<SpellGroup>& usedGroups) const;
 
         // Spell Group Stack Rules table
+        SpellGroup GetSameEffectStackRuleSpellGroup(SpellInfo const* spellInfo, uint32 auraType) const;
         bool AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uint32 auraType, int32 amount, std::map<SpellGroup, int32>& groups) const;
+        static void AddSameEffectStackRuleSpellGroupAmount(SpellGroup group, int32 amount, std::map<SpellGroup, int32>& groups);
         SpellGroupStackRule CheckSpellGroupStackRules(SpellInfo const* spellInfo1, SpellInfo const* spellInfo2) const;
         SpellGroupStackRule GetSpellGroupStackRule(SpellGroup groupid) const;
 
@@ -143,7 +143,20 @@ uint32 SpellScriptBase::EffectHook::GetAffectedEffectsMask(SpellInfo const* spel
 
 bool SpellScriptBase::EffectHook::IsEffectAffected(SpellInfo const* spellInfo, uint8 effIndex) const
 {
-    return (GetAffectedEffectsMask(spellInfo) & 1 << effIndex) != 0;
+    // same result as testing GetAffectedEffectsMask but without checking every effect of the spell
+    if (_effIndex == EFFECT_ALL)
+        return CheckEffect(spellInfo, effIndex);
+
+    if (_effIndex == EFFECT_FIRST_FOUND)
+    {
+        for (uint8 i = 0; i < effIndex; ++i)
+            if (CheckEffect(spellInfo, i))
+                return false;
+
+        return CheckEffect(spellInfo, effIndex);
+    }
+
+    return _effIndex == effIndex && CheckEffect(spellInfo, effIndex);
 }
 
 std::string SpellScriptBase::EffectHook::EffIndexToString() const
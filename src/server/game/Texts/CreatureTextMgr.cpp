@@ -160,7 +160,7 @@ void CreatureTextMgr::LoadCreatureTextLocales()
         std::string_view localeName = fields[3].GetStringView();
 
         LocaleConstant locale    = GetLocaleByName(localeName);
-        if (!IsValidLocale(locale) || locale == LOCALE_enUS)
+        if (!IsValidLocale(locale) || locale == LOCALE_enUS || !sWorld->IsLocaleLoaded(locale))
             continue;
 
         CreatureTextLocale& data = mLocaleTextMap[CreatureTextId(creatureId, groupId, id)];
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CpuAccounting.h"
+#include "CpuTime.h"
+#include "Map.h"
+#include "MapManager.h"
+#include "Metric.h"
+#include "Opcodes.h"
+#include "ScriptMgr.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+
+namespace
+{
+std::atomic<TimePoint> LastResetTime(std::chrono::steady_clock::now());
+
+// counter -> cpu time at the previous LogMetrics call, only touched by the metric status logger
+std::unordered_map<Trinity::CpuTimeCounter const*, uint64> LastLoggedCpuTimes;
+
+template <typename Visitor>
+void VisitCounters(Visitor&& visitor)
+{
+    sMapMgr->DoForAllMaps([&](Map* map)
+    {
+        visitor(CpuAccounting::SourceType::Map, map->GetCpuTimeCounter(), [map]
+        {
+            return Trinity::StringFormat("{} ({}) instance {}", map->GetMapName(), map->GetId(), map->GetInstanceId());
+        });
+    });
+
+    for (auto const& [scriptType, counter] : sScriptMgr->GetHookCpuTimeCounters())
+        visitor(CpuAccounting::SourceType::ScriptHook, *counter, [scriptType = scriptType] { return std::string(scriptType); });
+
+    opcodeTable.VisitClientHandlers([&](ClientOpcodeHandler const& handler)
+    {
+        visitor(CpuAccounting::SourceType::Opcode, handler.CpuTime, [&handler] { return std::string(handler.Name); });
+    });
+}
+}
+
+namespace CpuAccounting
+{
+std::vector<Source> GetSources()
+{
+    std::vector<Source> sources;
+    VisitCounters([&](SourceType type, Trinity::CpuTimeCounter const& counter, auto&& nameGetter)
+    {
+        uint64 cpuTime = counter.CpuTime.load(std::memory_order_relaxed);
+        if (!cpuTime)
+            return;
+
+        sources.push_back({ .Type = type, .Name = nameGetter(), .CpuTime = cpuTime, .Calls = counter.Calls.load(std::memory_order_relaxed) });
+    });
+
+    std::ranges::sort(sources, std::ranges::greater(), &Source::CpuTime);
+    return sources;
+}
+
+void Reset()
+{
+    VisitCounters([](SourceType /*type*/, Trinity::CpuTimeCounter& counter, auto&& /*nameGetter*/)
+    {
+        counter.Reset();
+    });
+
+    LastResetTime.store(std::chrono::steady_clock::now(), std::memory_order_relaxed);
+}
+
+Milliseconds GetTimeSinceReset()
+{
+    return std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - LastResetTime.load(std::memory_order_relaxed));
+}
+
+void LogMetrics()
+{
+    std::unordered_map<Trinity::CpuTimeCounter const*, uint64> loggedCpuTimes;
+    VisitCounters([&](SourceType type, Trinity::CpuTimeCounter const& counter, auto&& nameGetter)
+    {
+        uint64 cpuTime = counter.CpuTime.load(std::memory_order_relaxed);
+        if (!cpuTime)
+            return;
+
+        loggedCpuTimes[&counter] = cpuTime;
+        auto itr = LastLoggedCpuTimes.find(&counter);
+        if (itr != LastLoggedCpuTimes.end() && itr->second == cpuTime)
+            return;
+
+        TC_METRIC_VALUE("cpu_time_us", uint64(cpuTime / 1000), TC_METRIC_TAG("type", std::string(GetSourceTypeName(type))), TC_METRIC_TAG("name", nameGetter()));
+    });
+
+    LastLoggedCpuTimes = std::move(loggedCpuTimes);
+}
+
+std::string_view GetSourceTypeName(SourceType type)
+{
+    switch (type)
+    {
+        case SourceType::Map:
+            return "map";
+        case SourceType::ScriptHook:
+            return "script";
+        case SourceType::Opcode:
+            return "opcode";
+        default:
+            break;
+    }
+
+    return "unknown";
+}
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_CPU_ACCOUNTING_H
+#define TRINITYCORE_CPU_ACCOUNTING_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Collects the thread CPU time counters of map updates, script hooks and opcode handlers
+namespace CpuAccounting
+{
+    enum class SourceType : uint8
+    {
+        Map,
+        ScriptHook,
+        Opcode
+    };
+
+    struct Source
+    {
+        SourceType Type;
+        std::string Name;
+        uint64 CpuTime;     // nanoseconds
+        uint64 Calls;
+    };
+
+    /// Everything that used CPU time since startup or the last Reset(), most expensive first
+    TC_GAME_API std::vector<Source> GetSources();
+    TC_GAME_API void Reset();
+    TC_GAME_API Milliseconds GetTimeSinceReset();
+
+    /// Sends the counters that changed since the previous call to the metric database
+    TC_GAME_API void LogMetrics();
+
+    TC_GAME_API std::string_view GetSourceTypeName(SourceType type);
+}
+
+#endif // TRINITYCORE_CPU_ACCOUNTING_H
@@ -0,0 +1,200 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlightRecorder.h"
+#include "CpuAccounting.h"
+#include "CpuTime.h"
+#include "GameTime.h"
+#include "Log.h"
+#include "Map.h"
+#include "MapManager.h"
+#include "Optional.h"
+#include "Profiler.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include "World.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+
+namespace
+{
+struct MapUpdateInfo
+{
+    Map* Instance;
+    Microseconds Duration;
+};
+
+bool Enabled = false;
+bool ProfilerStartedByRecorder = false;
+Microseconds Threshold = Microseconds::zero();
+Seconds Window = Seconds::zero();
+
+TimePoint NextDumpTime = TimePoint::min();
+uint32 DumpCount = 0;
+
+// cpu time per source at the start of the current window, dumps report the difference
+std::map<std::pair<CpuAccounting::SourceType, std::string>, uint64> WindowStartCpuTimes;
+Optional<TimePoint> WindowStartTime;
+
+constexpr std::size_t MaxReportedSources = 25;
+constexpr std::size_t MaxReportedMaps = 10;
+
+void StartWindow(TimePoint now)
+{
+    WindowStartCpuTimes.clear();
+    for (CpuAccounting::Source& source : CpuAccounting::GetSources())
+        WindowStartCpuTimes[{ source.Type, std::move(source.Name) }] = source.CpuTime;
+
+    WindowStartTime = now;
+}
+
+void WriteReport(std::ofstream& report, Microseconds duration, TimePoint now)
+{
+    report << Trinity::StringFormat("World update took {} ms (threshold {} ms) at {}\n\n",
+        duration.count() / 1000, Threshold.count() / 1000, TimeToTimestampStr(GameTime::GetGameTime()));
+
+    struct WindowSource
+    {
+        CpuAccounting::Source const* Source;
+        uint64 CpuTime;
+    };
+
+    std::vector<CpuAccounting::Source> sources = CpuAccounting::GetSources();
+    std::vector<WindowSource> windowSources;
+    windowSources.reserve(sources.size());
+    for (CpuAccounting::Source const& source : sources)
+    {
+        uint64 cpuTime = source.CpuTime;
+        auto itr = WindowStartCpuTimes.find({ source.Type, source.Name });
+        // counters are reset by .server perf reset, treat anything lower as new usage
+        if (itr != WindowStartCpuTimes.end() && itr->second <= cpuTime)
+            cpuTime -= itr->second;
+
+        if (cpuTime)
+            windowSources.push_back({ .Source = &source, .CpuTime = cpuTime });
+    }
+
+    std::ranges::sort(windowSources, std::ranges::greater(), &WindowSource::CpuTime);
+    if (windowSources.size() > MaxReportedSources)
+        windowSources.resize(MaxReportedSources);
+
+    report << Trinity::StringFormat("Most expensive sources of the last {} ms (thread cpu time):\n",
+        std::chrono::duration_cast<Milliseconds>(now - *WindowStartTime).count());
+    for (WindowSource const& windowSource : windowSources)
+        report << Trinity::StringFormat("  {:>8} us  {:<6} {}\n", windowSource.CpuTime / 1000,
+            CpuAccounting::GetSourceTypeName(windowSource.Source->Type), windowSource.Source->Name);
+
+    if (!Trinity::CpuTimeScope::IsEnabled())
+        report << "  (CpuAccounting.Enable is disabled)\n";
+
+    std::vector<MapUpdateInfo> maps;
+    sMapMgr->DoForAllMaps([&](Map* map)
+    {
+        maps.push_back({ .Instance = map, .Duration = map->GetLastUpdateDuration() });
+    });
+
+    std::ranges::sort(maps, std::ranges::greater(), &MapUpdateInfo::Duration);
+    if (maps.size() > MaxReportedMaps)
+        maps.resize(MaxReportedMaps);
+
+    report << "\nSlowest map updates of this tick:\n";
+    for (MapUpdateInfo const& info : maps)
+    {
+        Map* map = info.Instance;
+        MapStoredObjectTypesContainer& store = map->GetObjectsStore();
+        report << Trinity::StringFormat("  {:>8} us{} {} ({}) instance {}: players {}, active objects {}, creatures {}, pets {}, gameobjects {}, "
+            "dynamicobjects {}, areatriggers {}, corpses {}, conversations {}, sceneobjects {}\n",
+            info.Duration.count(), info.Duration >= Threshold ? " *" : "  ", map->GetMapName(), map->GetId(), map->GetInstanceId(),
+            map->GetPlayers().size(), map->GetActiveNonPlayersCount(), store.Size<Creature>(), store.Size<Pet>(), store.Size<GameObject>(),
+            store.Size<DynamicObject>(), store.Size<AreaTrigger>(), store.Size<Corpse>(), store.Size<Conversation>(), store.Size<SceneObject>());
+    }
+}
+
+void Dump(Microseconds duration, TimePoint now)
+{
+    std::string fileName = Trinity::StringFormat("{}spike_{}_{}", sLog->GetLogsDir(), GameTime::GetGameTime(), ++DumpCount);
+
+    std::ofstream report(fileName + ".txt", std::ios::out | std::ios::trunc);
+    if (report)
+        WriteReport(report, duration, now);
+
+    bool traceWritten = sProfiler->WriteChromeTrace(fileName + ".json", now - duration - Window);
+    if (!report.good() || !traceWritten)
+    {
+        TC_LOG_ERROR("misc", "FlightRecorder: World update took {} ms, failed to write spike dump {}", duration.count() / 1000, fileName);
+        return;
+    }
+
+    TC_LOG_WARN("misc", "FlightRecorder: World update took {} ms, wrote spike dump {}.txt/.json", duration.count() / 1000, fileName);
+}
+}
+
+namespace FlightRecorder
+{
+void LoadConfig()
+{
+    Enabled = sWorld->getBoolConfig(CONFIG_FLIGHT_RECORDER);
+    Threshold = Milliseconds(sWorld->getIntConfig(CONFIG_FLIGHT_RECORDER_THRESHOLD));
+    Window = Seconds(sWorld->getIntConfig(CONFIG_FLIGHT_RECORDER_SECONDS));
+
+    if (Enabled && !sProfiler->IsEnabled())
+    {
+        sProfiler->Start();
+        ProfilerStartedByRecorder = true;
+    }
+    else if (!Enabled && ProfilerStartedByRecorder)
+    {
+        sProfiler->Stop();
+        ProfilerStartedByRecorder = false;
+    }
+
+    WindowStartTime.reset();
+}
+
+bool IsEnabled()
+{
+    return Enabled;
+}
+
+void OnWorldUpdate(Microseconds duration)
+{
+    if (!Enabled)
+        return;
+
+    TimePoint now = std::chrono::steady_clock::now();
+    // no cpu time snapshot to compare with yet
+    if (!WindowStartTime)
+    {
+        StartWindow(now);
+        return;
+    }
+
+    // don't let the dump of one spike cover the window of the next one
+    if (duration >= Threshold && now >= NextDumpTime)
+    {
+        Dump(duration, now);
+        now = std::chrono::steady_clock::now();
+        NextDumpTime = now + Window;
+        StartWindow(now);
+        return;
+    }
+
+    if (now - *WindowStartTime >= Window)
+        StartWindow(now);
+}
+}
@@ -0,0 +1,38 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_FLIGHT_RECORDER_H
+#define TRINITYCORE_FLIGHT_RECORDER_H
+
+#include "Define.h"
+#include "Duration.h"
+
+/**
+ * Keeps the profiler recording continuously and dumps the last seconds of profiler zones,
+ * the most expensive CPU accounting sources and the object counts of the slowest maps
+ * whenever a world update exceeds FlightRecorder.Threshold
+ */
+namespace FlightRecorder
+{
+    TC_GAME_API void LoadConfig();
+    TC_GAME_API bool IsEnabled();
+
+    /// Called by the world thread at the end of every World::Update, maps are not updating at that point
+    TC_GAME_API void OnWorldUpdate(Microseconds duration);
+}
+
+#endif // TRINITYCORE_FLIGHT_RECORDER_H
@@ -22,6 +22,7 @@
 #include "CryptoHash.h"
 #include "GameTime.h"
 #include "Log.h"
+#include "Random.h"
 #include "SmartEnum.h"
 #include "Util.h"
 #include "WardenPackets.h"
@@ -30,7 +31,7 @@
 #include "WorldSession.h"
 #include <charconv>
 
-Warden::Warden() : _session(nullptr), _checkTimer(10 * IN_MILLISECONDS), _clientResponseTimer(0),
+Warden::Warden() : _session(nullptr), _checkTimer(urand(5 * IN_MILLISECONDS, 15 * IN_MILLISECONDS)), _clientResponseTimer(0),
                    _dataSent(false), _initialized(false)
 {
 }
@@ -129,6 +130,12 @@ void Warden::Update(uint32 diff)
     }
 }
 
+void Warden::ScheduleNextCheck(uint32 holdOff)
+{
+    uint32 spread = holdOff / 10;
+    _checkTimer = urand(holdOff - spread, holdOff + spread);
+}
+
 void Warden::DecryptData(uint8* buffer, uint32 length)
 {
     _inputCrypto.UpdateData(buffer, length);
@@ -115,6 +115,9 @@ class TC_GAME_API Warden
         // If nullptr is passed, the default action from config is executed
         char const* ApplyPenalty(WardenCheck const* check);
 
+        // Arms the check timer with up to 10% jitter so sessions that logged in together do not keep requesting checks on the same tick
+        void ScheduleNextCheck(uint32 holdOff);
+
         WorldSession* _session;
         std::array<uint8, 16> _inputKey = {};
         std::array<uint8, 16> _outputKey = {};
@@ -527,7 +527,7 @@ void WardenWin::HandleCheckResult(ByteBuffer &buff)
 
     // Set hold off timer, minimum timer should at least be 1 second
     uint32 holdOff = sWorld->getIntConfig(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF);
-    _checkTimer = (holdOff < 1 ? 1 : holdOff) * IN_MILLISECONDS;
+    ScheduleNextCheck((holdOff < 1 ? 1 : holdOff) * IN_MILLISECONDS);
 }
 
 size_t WardenWin::DEBUG_ForceSpecificChecks(std::vector<uint16> const& checks)
@@ -43,6 +43,7 @@
 #include "Config.h"
 #include "Containers.h"
 #include "ConversationDataStore.h"
+#include "CpuTime.h"
 #include "CreatureAIRegistry.h"
 #include "CreatureGroups.h"
 #include "CreatureTextMgr.h"
@@ -50,6 +51,7 @@
 #include "DatabaseEnv.h"
 #include "DetourMemoryFunctions.h"
 #include "DisableMgr.h"
+#include "FlightRecorder.h"
 #include "GameEventMgr.h"
 #include "GameObjectModel.h"
 #include "GameTables.h"
@@ -65,12 +67,14 @@
 #include "LFGMgr.h"
 #include "Language.h"
 #include "LanguageMgr.h"
+#include "LoadGenerator.h"
 #include "Log.h"
 #include "LootItemStorage.h"
 #include "LootMgr.h"
 #include "M2Stores.h"
 #include "MMapFactory.h"
 #include "Map.h"
+#include "MapBenchmark.h"
 #include "MapManager.h"
 #include "MapUtils.h"
 #include "Metric.h"
@@ -82,6 +86,7 @@
 #include "Player.h"
 #include "PlayerDump.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "QuestPools.h"
 #include "RealmList.h"
 #include "ScenarioMgr.h"
@@ -94,6 +99,7 @@
 #include "SupportMgr.h"
 #include "TaxiPathGraph.h"
 #include "TerrainMgr.h"
+#include "ThreadPool.h"
 #include "TraitMgr.h"
 #include "TransportMgr.h"
 #include "Unit.h"
@@ -106,6 +112,7 @@
 #include "WhoListStorage.h"
 #include "WorldSession.h"
 #include "WorldStateMgr.h"
+#include <array>
 #include <zlib.h>
 
 TC_GAME_API std::atomic<bool> World::m_stopEvent(false);
@@ -151,6 +158,7 @@ World::World()
 
     m_defaultDbcLocale = LOCALE_enUS;
     m_availableDbcLocaleMask = 0;
+    m_loadedLocaleMask = 1 << DEFAULT_LOCALE;
 
     mail_timer = 0;
     mail_timer_expires = 0;
@@ -653,6 +661,7 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "OffhandCheckAtSpellUnlearn"sv, .DefaultValue = true, .Index = CONFIG_OFFHAND_CHECK_AT_SPELL_UNLEARN },
         { .Name = "Respawn.DynamicEscortNPC"sv, .DefaultValue = false, .Index = CONFIG_RESPAWN_DYNAMIC_ESCORTNPC },
         { .Name = "mmap.enablePathFinding"sv, .DefaultValue = true, .Index = CONFIG_ENABLE_MMAPS },
+        { .Name = "map.enableMemoryMapping"sv, .DefaultValue = false, .Index = CONFIG_MAP_MEMORY_MAPPING },
         { .Name = "vmap.enableIndoorCheck"sv, .DefaultValue = true, .Index = CONFIG_VMAP_INDOOR_CHECK },
         { .Name = "PlayerStart.AllSpells"sv, .DefaultValue = false, .Index = CONFIG_START_ALL_SPELLS },
         { .Name = "ResetDuelCooldowns"sv, .DefaultValue = false, .Index = CONFIG_RESET_DUEL_COOLDOWNS },
@@ -693,6 +702,12 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "AllowLoggingIPAddressesInDatabase"sv, .DefaultValue = true, .Index = CONFIG_ALLOW_LOGGING_IP_ADDRESSES_IN_DATABASE },
         { .Name = "Loot.EnableAELoot"sv, .DefaultValue = true, .Index = CONFIG_ENABLE_AE_LOOT },
         { .Name = "Load.Locales"sv, .DefaultValue = true, .Index = CONFIG_LOAD_LOCALES },
+        { .Name = "Visibility.BroadcastToClientViewers"sv, .DefaultValue = false, .Index = CONFIG_VISIBILITY_BROADCAST_TO_CLIENT_VIEWERS },
+        { .Name = "MapUpdate.BatchMovementRelay"sv, .DefaultValue = false, .Index = CONFIG_MAP_BATCH_MOVEMENT_RELAY },
+        { .Name = "Network.EarlyPacketDecode"sv, .DefaultValue = false, .Index = CONFIG_NETWORK_EARLY_PACKET_DECODE },
+        { .Name = "Network.TickAlignedFlush"sv, .DefaultValue = false, .Index = CONFIG_NETWORK_TICK_ALIGNED_FLUSH },
+        { .Name = "CpuAccounting.Enable"sv, .DefaultValue = true, .Index = CONFIG_CPU_ACCOUNTING },
+        { .Name = "FlightRecorder.Enable"sv, .DefaultValue = false, .Index = CONFIG_FLIGHT_RECORDER },
     } };
 
     static constexpr ConfigOptionLoadDefinitionArray<uint32, INT_CONFIG_VALUE_COUNT> ints =
@@ -700,8 +715,12 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "Server.LoginInfo"sv, .DefaultValue = 0, .Index = CONFIG_ENABLE_SINFO_LOGIN },
         { .Name = "XP.Boost.Daymask"sv, .DefaultValue = 0, .Index = CONFIG_XP_BOOST_DAYMASK },
         { .Name = "Compression"sv, .DefaultValue = 1, .Index = CONFIG_COMPRESSION, .Min = Z_BEST_SPEED, .Max = Z_BEST_COMPRESSION },
+        { .Name = "Compression.MinPacketSize"sv, .DefaultValue = 0x400, .Index = CONFIG_COMPRESSION_MIN_PACKET_SIZE, .Min = 0x100 },
         { .Name = "PersistentCharacterCleanFlags"sv, .DefaultValue = 0, .Index = CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS },
         { .Name = "Auction.ReplicateItemsCooldown"sv, .DefaultValue = 900, .Index = CONFIG_AUCTION_REPLICATE_DELAY },
+        { .Name = "Auction.ReplicateSnapshotInterval"sv, .DefaultValue = 60, .Index = CONFIG_AUCTION_REPLICATE_SNAPSHOT_INTERVAL, .Max = 3600 },
+        { .Name = "FlightRecorder.Threshold"sv, .DefaultValue = 1000, .Index = CONFIG_FLIGHT_RECORDER_THRESHOLD, .Min = 1 },
+        { .Name = "FlightRecorder.Seconds"sv, .DefaultValue = 10, .Index = CONFIG_FLIGHT_RECORDER_SECONDS, .Min = 1, .Max = 60 },
         { .Name = "Auction.SearchDelay"sv, .DefaultValue = 300, .Index = CONFIG_AUCTION_SEARCH_DELAY, .Min = 100, .Max = 10000 },
         { .Name = "Auction.TaintedSearchDelay"sv, .DefaultValue = 3000, .Index = CONFIG_AUCTION_TAINTED_SEARCH_DELAY, .Min = 100, .Max = 10000 },
         { .Name = "ChatLevelReq.Channel"sv, .DefaultValue = 1, .Index = CONFIG_CHAT_CHANNEL_LEVEL_REQ },
@@ -717,6 +736,7 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "PreserveCustomChannelInterval"sv, .DefaultValue = 5, .Index = CONFIG_PRESERVE_CUSTOM_CHANNEL_INTERVAL },
         { .Name = "PlayerSaveInterval"sv, .DefaultValue = 15 * MINUTE * IN_MILLISECONDS, .Index = CONFIG_INTERVAL_SAVE },
         { .Name = "DisconnectToleranceInterval"sv, .DefaultValue = 0, .Index = CONFIG_INTERVAL_DISCONNECT_TOLERANCE },
+        { .Name = "PlayerSave.CoalesceDelay"sv, .DefaultValue = 0, .Index = CONFIG_PLAYER_SAVE_COALESCE_DELAY },
         { .Name = "PlayerSave.Stats.MinLevel"sv, .DefaultValue = 0, .Index = CONFIG_MIN_LEVEL_STAT_SAVE, .Max = STRONG_MAX_LEVEL },
         { .Name = "GridCleanUpDelay"sv, .DefaultValue = 5 * MINUTE * IN_MILLISECONDS, .Index = CONFIG_INTERVAL_GRIDCLEAN, .Min = MIN_GRID_DELAY },
         { .Name = "MapUpdateInterval"sv, .DefaultValue = 10, .Index = CONFIG_INTERVAL_MAPUPDATE, .Min = MIN_MAP_UPDATE_DELAY },
@@ -763,6 +783,8 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "ResetSchedule.WeekDay"sv, .DefaultValue = 2, .Index = CONFIG_RESET_SCHEDULE_WEEK_DAY, .Min = 0, .Max = 6 },
         { .Name = "ResetSchedule.Hour"sv, .DefaultValue = 8, .Index = CONFIG_RESET_SCHEDULE_HOUR, .Min = 0, .Max = 23 },
         { .Name = "Instance.UnloadDelay"sv, .DefaultValue = 30 * MINUTE * IN_MILLISECONDS, .Index = CONFIG_INSTANCE_UNLOAD_DELAY },
+        { .Name = "Instance.PrewarmTime"sv, .DefaultValue = 120, .Index = CONFIG_INSTANCE_PREWARM_TIME, .Max = 3600 },
+        { .Name = "Instance.HibernateDelay"sv, .DefaultValue = 2 * MINUTE * IN_MILLISECONDS, .Index = CONFIG_INSTANCE_HIBERNATE_DELAY },
         { .Name = "Quests.DailyResetTime"sv, .DefaultValue = 3, .Index = CONFIG_DAILY_QUEST_RESET_TIME_HOUR, .Min = 0, .Max = 23 },
         { .Name = "Quests.WeeklyResetWDay"sv, .DefaultValue = 3, .Index = CONFIG_WEEKLY_QUEST_RESET_TIME_WDAY, .Min = 0, .Max = 6 },
         { .Name = "MaxPrimaryTradeSkill"sv, .DefaultValue = 2, .Index = CONFIG_MAX_PRIMARY_TRADE_SKILL },
@@ -838,6 +860,9 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "Visibility.Notify.Period.InInstances"sv, .DefaultValue = DEFAULT_VISIBILITY_NOTIFY_PERIOD, .Index = CONFIG_VISIBILITY_NOTIFY_PERIOD_INSTANCE },
         { .Name = "Visibility.Notify.Period.InBG"sv, .DefaultValue = DEFAULT_VISIBILITY_NOTIFY_PERIOD, .Index = CONFIG_VISIBILITY_NOTIFY_PERIOD_BATTLEGROUND },
         { .Name = "Visibility.Notify.Period.InArenas"sv, .DefaultValue = DEFAULT_VISIBILITY_NOTIFY_PERIOD, .Index = CONFIG_VISIBILITY_NOTIFY_PERIOD_ARENA },
+        { .Name = "Visibility.Notify.MidInterval"sv, .DefaultValue = 2, .Index = CONFIG_VISIBILITY_NOTIFY_MID_INTERVAL, .Min = 1 },
+        { .Name = "Visibility.Notify.FarInterval"sv, .DefaultValue = 4, .Index = CONFIG_VISIBILITY_NOTIFY_FAR_INTERVAL, .Min = 1 },
+        { .Name = "Visibility.Notify.MaxPlayersPerUpdate"sv, .DefaultValue = 0, .Index = CONFIG_VISIBILITY_NOTIFY_MAX_PLAYERS },
         { .Name = "CharDelete.Method"sv, .DefaultValue = 0, .Index = CONFIG_CHARDELETE_METHOD },
         { .Name = "CharDelete.MinLevel"sv, .DefaultValue = 0, .Index = CONFIG_CHARDELETE_MIN_LEVEL },
         { .Name = "CharDelete.DeathKnight.MinLevel"sv, .DefaultValue = 0, .Index = CONFIG_CHARDELETE_DEATH_KNIGHT_MIN_LEVEL },
@@ -859,6 +884,20 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "PvPToken.ItemID"sv, .DefaultValue = 29434, .Index = CONFIG_PVP_TOKEN_ID },
         { .Name = "PvPToken.ItemCount"sv, .DefaultValue = 1, .Index = CONFIG_PVP_TOKEN_COUNT, .Min = 1 },
         { .Name = "MapUpdate.Threads"sv, .DefaultValue = 1, .Index = CONFIG_NUMTHREADS, .Min = 1 },
+        { .Name = "MapUpdate.UseProcessors"sv, .DefaultValue = 0, .Index = CONFIG_MAP_UPDATE_PROCESSOR_AFFINITY, .Reloadable = false },
+        { .Name = "MapUpdate.IslandThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAP_UPDATE_ISLAND_THREADS, .Min = 0, .Max = 64 },
+        { .Name = "MapUpdate.PreloadThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAP_PRELOAD_THREADS, .Min = 0, .Max = 16, .Reloadable = false },
+        { .Name = "MapUpdate.PreloadLookAhead"sv, .DefaultValue = 10, .Index = CONFIG_MAP_PRELOAD_LOOKAHEAD, .Min = 1, .Max = 60 },
+        { .Name = "MapUpdate.PathfindingThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAP_PATHFINDING_THREADS, .Min = 0, .Max = 64, .Reloadable = false },
+        { .Name = "MapUpdate.ObjectUpdateThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAP_OBJECT_UPDATE_THREADS, .Min = 0, .Max = 64, .Reloadable = false },
+        { .Name = "MapUpdate.ObjectUpdateMinObjects"sv, .DefaultValue = 256, .Index = CONFIG_MAP_OBJECT_UPDATE_MIN_OBJECTS, .Min = 1 },
+        { .Name = "MapUpdate.GridLoadThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAP_GRID_LOAD_THREADS, .Min = 0, .Max = 64, .Reloadable = false },
+        { .Name = "MapUpdate.GridLoadMinObjects"sv, .DefaultValue = 128, .Index = CONFIG_MAP_GRID_LOAD_MIN_OBJECTS, .Min = 1 },
+        { .Name = "MapUpdate.GridUnloadReclaimObjects"sv, .DefaultValue = 500, .Index = CONFIG_MAP_GRID_UNLOAD_RECLAIM_OBJECTS },
+        { .Name = "MapUpdate.CreatureLod.ReducedInterval"sv, .DefaultValue = 400, .Index = CONFIG_CREATURE_UPDATE_LOD_REDUCED_INTERVAL, .Max = 5000 },
+        { .Name = "MapUpdate.CreatureLod.DormantInterval"sv, .DefaultValue = 2000, .Index = CONFIG_CREATURE_UPDATE_LOD_DORMANT_INTERVAL, .Max = 30000 },
+        { .Name = "Load.Threads"sv, .DefaultValue = 0, .Index = CONFIG_LOAD_THREADS, .Min = 0, .Max = 16, .Reloadable = false },
+        { .Name = "SessionUpdate.PacketTimeBudget"sv, .DefaultValue = 0, .Index = CONFIG_SESSION_UPDATE_PACKET_TIME_BUDGET, .Min = 0, .Max = 1000 },
         { .Name = "Command.LookupMaxResults"sv, .DefaultValue = 0, .Index = CONFIG_MAX_RESULTS_LOOKUP_COMMANDS },
         { .Name = "Warden.NumInjectionChecks"sv, .DefaultValue = 9, .Index = CONFIG_WARDEN_NUM_INJECT_CHECKS },
         { .Name = "Warden.NumLuaSandboxChecks"sv, .DefaultValue = 1, .Index = CONFIG_WARDEN_NUM_LUA_CHECKS },
@@ -928,6 +967,14 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "Visibility.Distance.Instances"sv, .DefaultValue = DEFAULT_VISIBILITY_INSTANCE, .Index = CONFIG_MAX_VISIBILITY_DISTANCE_INSTANCE, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
         { .Name = "Visibility.Distance.BG"sv, .DefaultValue = DEFAULT_VISIBILITY_BGARENAS, .Index = CONFIG_MAX_VISIBILITY_DISTANCE_BATTLEGROUND, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
         { .Name = "Visibility.Distance.Arenas"sv, .DefaultValue = DEFAULT_VISIBILITY_BGARENAS, .Index = CONFIG_MAX_VISIBILITY_DISTANCE_ARENA, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.NearDistance.OnContinents"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_CONTINENT, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.NearDistance.InInstances"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_INSTANCE, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.NearDistance.InBG"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_BATTLEGROUND, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.NearDistance.InArenas"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_ARENA, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.MidDistance.OnContinents"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_CONTINENT, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.MidDistance.InInstances"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_INSTANCE, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.MidDistance.InBG"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_BATTLEGROUND, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Notify.MidDistance.InArenas"sv, .DefaultValue = 0.0f, .Index = CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_ARENA, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
         { .Name = "Respawn.DynamicRateCreature"sv, .DefaultValue = 10.0f, .Index = CONFIG_RESPAWN_DYNAMICRATE_CREATURE, .Min = 0.0f },
         { .Name = "Respawn.DynamicRateGameObject"sv, .DefaultValue = 10.0f, .Index = CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT, .Min = 0.0f },
         { .Name = "Stats.Limits.Dodge"sv, .DefaultValue = 95.0f, .Index = CONFIG_STATS_LIMITS_DODGE },
@@ -1041,6 +1088,29 @@ void World::LoadConfigSettings(bool reload)
     ///- Get string for new logins (newly created characters)
     SetNewCharString(sConfigMgr->GetStringDefault("PlayerStart.String"sv, ""sv));
 
+    ///- Locales of localization strings kept in memory, the default locale is always available
+    m_loadedLocaleMask = 1 << DEFAULT_LOCALE;
+    if (m_bool_configs[CONFIG_LOAD_LOCALES])
+    {
+        std::string localeList = sConfigMgr->GetStringDefault("Load.Locales.List"sv, ""sv);
+        for (std::string_view localeName : Trinity::Tokenize(localeList, ' ', false))
+        {
+            LocaleConstant locale = GetLocaleByName(localeName);
+            if (!IsValidLocale(locale))
+            {
+                TC_LOG_ERROR("server.loading", "Load.Locales.List contains unknown locale '{}', skipped.", localeName);
+                continue;
+            }
+
+            m_loadedLocaleMask |= 1 << locale;
+        }
+
+        if (localeList.empty())
+            for (uint8 locale = LOCALE_enUS; locale < TOTAL_LOCALES; ++locale)
+                if (IsValidLocale(LocaleConstant(locale)))
+                    m_loadedLocaleMask |= 1 << locale;
+    }
+
     for (uint8 i = 0; i < MAX_MOVE_TYPE; ++i)
         playerBaseMoveSpeed[i] = baseMoveSpeed[i] * rate_values[RATE_MOVESPEED];
 
@@ -1064,6 +1134,9 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_SOCKET_TIMEOUTTIME] /= 1000;
     m_int_configs[CONFIG_SOCKET_TIMEOUTTIME_ACTIVE] /= 1000;
 
+    Trinity::CpuTimeScope::SetEnabled(m_bool_configs[CONFIG_CPU_ACCOUNTING]);
+    FlightRecorder::LoadConfig();
+
     // must be after CONFIG_CHARACTERS_PER_REALM
     if (m_int_configs[CONFIG_CHARACTERS_PER_ACCOUNT] < m_int_configs[CONFIG_CHARACTERS_PER_REALM])
     {
@@ -1189,12 +1262,14 @@ void World::LoadConfigSettings(bool reload)
 
     bool enableLOS = sConfigMgr->GetBoolDefault("vmap.enableLOS"sv, true);
     bool enableHeight = sConfigMgr->GetBoolDefault("vmap.enableHeight"sv, true);
+    bool packTriangles = sConfigMgr->GetBoolDefault("vmap.packTriangles"sv, false);
 
     if (!enableHeight)
         TC_LOG_ERROR("server.loading", "VMap height checking disabled! Creatures movements and other various things WILL be broken! Expect no support.");
 
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableLineOfSightCalc(enableLOS);
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableHeightCalc(enableHeight);
+    VMAP::VMapFactory::createOrGetVMapManager()->setPackTriangles(packTriangles);
     TC_LOG_INFO("server.loading", "VMap support included. LineOfSight: {}, getHeight: {}, indoorCheck: {}", enableLOS, enableHeight, m_bool_configs[CONFIG_VMAP_INDOOR_CHECK]);
     TC_LOG_INFO("server.loading", "VMap data directory is: {}vmaps", m_dataPath);
 
@@ -1353,6 +1428,7 @@ bool World::SetInitialWorldSettings()
     }
 
     sTerrainMgr.InitializeParentMapData(mapData);
+    sTerrainMgr.InitializePreloading(getIntConfig(CONFIG_MAP_PRELOAD_THREADS));
 
     vmmgr2->InitializeThreadUnsafe(mapData);
 
@@ -1416,15 +1492,35 @@ bool World::SetInitialWorldSettings()
     uint32 oldMSTime = getMSTime();
     if (m_bool_configs[CONFIG_LOAD_LOCALES])
     {
-        sObjectMgr->LoadCreatureLocales();
-        sObjectMgr->LoadGameObjectLocales();
-        sObjectMgr->LoadQuestTemplateLocale();
-        sObjectMgr->LoadQuestOfferRewardLocale();
-        sObjectMgr->LoadQuestRequestItemsLocale();
-        sObjectMgr->LoadQuestObjectivesLocale();
-        sObjectMgr->LoadPageTextLocales();
-        sObjectMgr->LoadGossipMenuItemsLocales();
-        sObjectMgr->LoadPointOfInterestLocales();
+        // each of these only fills its own locale store, they can run in any order and concurrently
+        static constexpr std::array<void(ObjectMgr::*)(), 9> LocaleLoaders =
+        {
+            &ObjectMgr::LoadCreatureLocales,
+            &ObjectMgr::LoadGameObjectLocales,
+            &ObjectMgr::LoadQuestTemplateLocale,
+            &ObjectMgr::LoadQuestOfferRewardLocale,
+            &ObjectMgr::LoadQuestRequestItemsLocale,
+            &ObjectMgr::LoadQuestObjectivesLocale,
+            &ObjectMgr::LoadPageTextLocales,
+            &ObjectMgr::LoadGossipMenuItemsLocales,
+            &ObjectMgr::LoadPointOfInterestLocales
+        };
+
+        if (uint32 loadThreads = m_int_configs[CONFIG_LOAD_THREADS])
+        {
+            // overlaps waiting on one query with parsing the result of another, WorldDatabase.SynchThreads
+            // limits how many queries are actually executed at the same time
+            Trinity::ThreadPool loadPool(std::min<std::size_t>(loadThreads, LocaleLoaders.size()));
+            for (void(ObjectMgr::*loader)() : LocaleLoaders)
+                loadPool.PostWork([loader] { (sObjectMgr->*loader)(); });
+
+            loadPool.Join();
+        }
+        else
+        {
+            for (void(ObjectMgr::*loader)() : LocaleLoaders)
+                (sObjectMgr->*loader)();
+        }
     }
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
@@ -1896,8 +1992,16 @@ bool World::SetInitialWorldSettings()
     sGarrisonMgr.Initialize();
 
     ///- Handle outdated emails (delete/return)
+    // only touches the character database, with Load.Threads it runs while scripts are loaded
     TC_LOG_INFO("server.loading", "Returning old mails...");
-    sObjectMgr->ReturnOrDeleteOldMails(false);
+    std::unique_ptr<Trinity::ThreadPool> maintenancePool;
+    if (m_int_configs[CONFIG_LOAD_THREADS])
+    {
+        maintenancePool = std::make_unique<Trinity::ThreadPool>(1);
+        maintenancePool->PostWork([] { sObjectMgr->ReturnOrDeleteOldMails(false); });
+    }
+    else
+        sObjectMgr->ReturnOrDeleteOldMails(false);
 
     TC_LOG_INFO("server.loading", "Loading Autobroadcasts...");
     LoadAutobroadcasts();
@@ -1946,9 +2050,23 @@ bool World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Initialize query data...");
     sObjectMgr->InitializeQueriesData(QUERY_DATA_ALL);
 
+    if (getBoolConfig(CONFIG_CACHE_DATA_QUERIES))
+    {
+        TC_LOG_INFO("server.loading", "Serializing hotfix records...");
+        sDB2Manager.InitializeHotfixRecordData(m_availableDbcLocaleMask);
+    }
+
     TC_LOG_INFO("server.loading", "Initialize commands...");
     Trinity::ChatCommands::LoadCommandMap();
 
+    // background maintenance reads game time, it must be done before the timers change
+    if (maintenancePool)
+    {
+        uint32 waitMSTime = getMSTime();
+        maintenancePool->Join();
+        TC_LOG_INFO("server.loading", ">> Waited {} ms for background maintenance to finish", GetMSTimeDiffToNow(waitMSTime));
+    }
+
     ///- Initialize game time and timers
     TC_LOG_INFO("server.loading", "Initialize game time and timers");
     GameTime::UpdateGameTimers();
@@ -1982,6 +2100,8 @@ bool World::SetInitialWorldSettings()
 
     m_timers[WUPDATE_CHANNEL_SAVE].SetInterval(getIntConfig(CONFIG_PRESERVE_CUSTOM_CHANNEL_INTERVAL) * MINUTE * IN_MILLISECONDS);
 
+    m_timers[WUPDATE_EXPIRED_CHARACTER_BANS].SetInterval(MINUTE * IN_MILLISECONDS);
+
     //to set mailtimer to return mails every day between 4 and 5 am
     //mailtimer is increased when updating auctions
     //one second is 1000 -(tested on win system)
@@ -2131,6 +2251,8 @@ void World::LoadAutobroadcasts()
 void World::Update(uint32 diff)
 {
     TC_METRIC_TIMER("world_update_time_total");
+    TC_PROFILE_ZONE("World::Update");
+    TimePoint updateStart = std::chrono::steady_clock::now();
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
     time_t currentGameTime = GameTime::GetGameTime();
@@ -2205,6 +2327,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_AUCTIONS].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update expired auctions"));
+        TC_PROFILE_ZONE("Update expired auctions");
         m_timers[WUPDATE_AUCTIONS].Reset();
 
         ///- Update mails (return old mails with item, or delete them)
@@ -2222,6 +2345,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_AUCTIONS_PENDING].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update pending auctions"));
+        TC_PROFILE_ZONE("Update pending auctions");
         m_timers[WUPDATE_AUCTIONS_PENDING].Reset();
 
         sAuctionMgr->UpdatePendingAuctions();
@@ -2230,6 +2354,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_BLACKMARKET].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update pending black market auctions"));
+        TC_PROFILE_ZONE("Update pending black market auctions");
         m_timers[WUPDATE_BLACKMARKET].Reset();
 
         ///- Update blackmarket, refresh auctions if necessary
@@ -2251,6 +2376,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_AHBOT].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update AHBot"));
+        TC_PROFILE_ZONE("Update AHBot");
         sAuctionBot->Update();
         m_timers[WUPDATE_AHBOT].Reset();
     }
@@ -2269,6 +2395,8 @@ void World::Update(uint32 diff)
     {
         /// <li> Handle session updates when the timer has passed
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update sessions"));
+        TC_PROFILE_ZONE("Update sessions");
+        LoadGenerator::Update(diff);
         UpdateSessions(diff);
     }
 
@@ -2309,10 +2437,21 @@ void World::Update(uint32 diff)
         }
     }
 
+    /// <li> Deactivate expired character bans
+    /// character enumeration already ignores them, this only keeps the table up to date
+    if (m_timers[WUPDATE_EXPIRED_CHARACTER_BANS].Passed())
+    {
+        m_timers[WUPDATE_EXPIRED_CHARACTER_BANS].Reset();
+
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
+        CharacterDatabase.Execute(stmt);
+    }
+
     /// <li> Handle all other objects
     ///- Update objects when the timer has passed (maps, transport, creatures, ...)
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update maps"));
+        TC_PROFILE_ZONE("Update maps");
         sMapMgr->Update(diff);
     }
 
@@ -2333,16 +2472,19 @@ void World::Update(uint32 diff)
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update battlegrounds"));
+        TC_PROFILE_ZONE("Update battlegrounds");
         sBattlegroundMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update outdoor pvp"));
+        TC_PROFILE_ZONE("Update outdoor pvp");
         sOutdoorPvPMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update battlefields"));
+        TC_PROFILE_ZONE("Update battlefields");
         sBattlefieldMgr->Update(diff);
     }
 
@@ -2356,16 +2498,19 @@ void World::Update(uint32 diff)
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update groups"));
+        TC_PROFILE_ZONE("Update groups");
         sGroupMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update LFG"));
+        TC_PROFILE_ZONE("Update LFG");
         sLFGMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Process query callbacks"));
+        TC_PROFILE_ZONE("Process query callbacks");
         // execute callbacks from sql queries that were queued recently
         ProcessQueryCallbacks();
     }
@@ -2436,6 +2581,13 @@ void World::Update(uint32 diff)
         sMetric->Update();
         TC_METRIC_VALUE("update_time_diff", diff);
     }
+
+    Microseconds updateDuration = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - updateStart);
+    FlightRecorder::OnWorldUpdate(updateDuration);
+    LoadGenerator::OnWorldUpdate(updateDuration);
+
+    // outside of the measured update, the extra ticks would show up as a spike
+    MapBenchmark::RunPending();
 }
 
 void World::ForceGameEventUpdate()
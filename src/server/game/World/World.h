@@ -96,6 +96,7 @@ enum WorldTimers
     WUPDATE_CHECK_FILECHANGES,
     WUPDATE_WHO_LIST,
     WUPDATE_CHANNEL_SAVE,
+    WUPDATE_EXPIRED_CHARACTER_BANS,
     WUPDATE_COUNT
 };
 
@@ -167,6 +168,7 @@ enum WorldBoolConfigs : uint32
     CONFIG_QUEST_ENABLE_QUEST_TRACKER,
     CONFIG_WARDEN_ENABLED,
     CONFIG_ENABLE_MMAPS,
+    CONFIG_MAP_MEMORY_MAPPING,
     CONFIG_WINTERGRASP_ENABLE,
     CONFIG_TOLBARAD_ENABLE,
     CONFIG_EVENT_ANNOUNCE,
@@ -199,6 +201,12 @@ enum WorldBoolConfigs : uint32
     CONFIG_BATTLEGROUNDMAP_LOAD_GRIDS,
     CONFIG_ENABLE_AE_LOOT,
     CONFIG_LOAD_LOCALES,
+    CONFIG_VISIBILITY_BROADCAST_TO_CLIENT_VIEWERS,
+    CONFIG_MAP_BATCH_MOVEMENT_RELAY,
+    CONFIG_NETWORK_EARLY_PACKET_DECODE,
+    CONFIG_NETWORK_TICK_ALIGNED_FLUSH,
+    CONFIG_CPU_ACCOUNTING,
+    CONFIG_FLIGHT_RECORDER,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -230,6 +238,14 @@ enum WorldFloatConfigs : uint32
     CONFIG_MAX_VISIBILITY_DISTANCE_INSTANCE,
     CONFIG_MAX_VISIBILITY_DISTANCE_BATTLEGROUND,
     CONFIG_MAX_VISIBILITY_DISTANCE_ARENA,
+    CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_CONTINENT,
+    CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_INSTANCE,
+    CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_BATTLEGROUND,
+    CONFIG_VISIBILITY_NOTIFY_NEAR_DISTANCE_ARENA,
+    CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_CONTINENT,
+    CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_INSTANCE,
+    CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_BATTLEGROUND,
+    CONFIG_VISIBILITY_NOTIFY_MID_DISTANCE_ARENA,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -353,6 +369,13 @@ enum WorldIntConfigs : uint32
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_UPDATE_PROCESSOR_AFFINITY,
+    CONFIG_MAP_UPDATE_ISLAND_THREADS,
+    CONFIG_MAP_PRELOAD_THREADS,
+    CONFIG_MAP_PRELOAD_LOOKAHEAD,
+    CONFIG_MAP_PATHFINDING_THREADS,
+    CONFIG_MAP_OBJECT_UPDATE_THREADS,
+    CONFIG_MAP_OBJECT_UPDATE_MIN_OBJECTS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
@@ -439,6 +462,23 @@ enum WorldIntConfigs : uint32
     CONFIG_VISIBILITY_NOTIFY_PERIOD_INSTANCE,
     CONFIG_VISIBILITY_NOTIFY_PERIOD_BATTLEGROUND,
     CONFIG_VISIBILITY_NOTIFY_PERIOD_ARENA,
+    CONFIG_VISIBILITY_NOTIFY_MID_INTERVAL,
+    CONFIG_VISIBILITY_NOTIFY_FAR_INTERVAL,
+    CONFIG_VISIBILITY_NOTIFY_MAX_PLAYERS,
+    CONFIG_LOAD_THREADS,
+    CONFIG_SESSION_UPDATE_PACKET_TIME_BUDGET,
+    CONFIG_COMPRESSION_MIN_PACKET_SIZE,
+    CONFIG_PLAYER_SAVE_COALESCE_DELAY,
+    CONFIG_MAP_GRID_LOAD_THREADS,
+    CONFIG_MAP_GRID_LOAD_MIN_OBJECTS,
+    CONFIG_AUCTION_REPLICATE_SNAPSHOT_INTERVAL,
+    CONFIG_FLIGHT_RECORDER_THRESHOLD,
+    CONFIG_FLIGHT_RECORDER_SECONDS,
+    CONFIG_INSTANCE_PREWARM_TIME,
+    CONFIG_INSTANCE_HIBERNATE_DELAY,
+    CONFIG_MAP_GRID_UNLOAD_RECLAIM_OBJECTS,
+    CONFIG_CREATURE_UPDATE_LOD_REDUCED_INTERVAL,
+    CONFIG_CREATURE_UPDATE_LOD_DORMANT_INTERVAL,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -762,6 +802,9 @@ class TC_GAME_API World
 
         LocaleConstant GetAvailableDbcLocale(LocaleConstant locale) const { if (m_availableDbcLocaleMask & (1 << locale)) return locale; else return m_defaultDbcLocale; }
 
+        // localization strings of other locales are not loaded from the database (Load.Locales, Load.Locales.List)
+        bool IsLocaleLoaded(LocaleConstant locale) const { return (m_loadedLocaleMask & (1 << locale)) != 0; }
+
         // used World DB version
         void LoadDBVersion();
         char const* GetDBVersion() const { return m_DBVersion.c_str(); }
@@ -858,6 +901,7 @@ class TC_GAME_API World
         AccountTypes m_allowedSecurityLevel;
         LocaleConstant m_defaultDbcLocale;                     // from config for one from loaded DBC locales
         uint32 m_availableDbcLocaleMask;                       // by loaded DBC
+        uint32 m_loadedLocaleMask;                             // by Load.Locales and Load.Locales.List
         bool m_allowMovement;
         std::vector<std::string> _motd;
         std::string m_dataPath;
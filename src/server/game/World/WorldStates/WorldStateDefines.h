@@ -19,8 +19,9 @@
 #define WorldStateDefines_h__
 
 #include "Define.h"
-#include <unordered_map>
-#include <unordered_set>
+#include "FlatHashMap.h"
+#include "FlatSet.h"
+#include <vector>
 
 struct WorldStateTemplate
 {
@@ -28,10 +29,11 @@ struct WorldStateTemplate
     int32 DefaultValue = 0;
     uint32 ScriptId = 0;
 
-    std::unordered_set<uint32> MapIds;
-    std::unordered_set<uint32> AreaIds;
+    Trinity::Containers::FlatSet<uint32> MapIds;
+    Trinity::Containers::FlatSet<uint32> AreaIds;
 };
 
-using WorldStateValueContainer = std::unordered_map<int32 /*worldStateId*/, int32 /*value*/>;
+using WorldStateValueContainer = Trinity::Containers::FlatHashMap<int32 /*worldStateId*/, int32 /*value*/>;
+using WorldStateValueList = std::vector<std::pair<int32 /*worldStateId*/, int32 /*value*/>>;
 
 #endif // WorldStateDefines_h__
@@ -27,6 +27,7 @@
 #include "Util.h"
 #include "World.h"
 #include "WorldStatePackets.h"
+#include <unordered_map>
 
 namespace
 {
@@ -103,7 +104,7 @@ void WorldStateMgr::LoadFromDB()
                     continue;
                 }
 
-                if (worldState.MapIds.find(areaTableEntry->ContinentID) == worldState.MapIds.end())
+                if (!worldState.MapIds.contains(areaTableEntry->ContinentID))
                 {
                     TC_LOG_ERROR("sql.sql", "Table `world_state` contains a world state {} with AreaID ({}) not on any of required maps, area ignored",
                         id, *areaId);
@@ -191,7 +192,7 @@ int32 WorldStateMgr::GetValue(int32 worldStateId, Map const* map) const
         return 0;
     }
 
-    if (!map || (!worldStateTemplate->MapIds.count(map->GetId()) && !worldStateTemplate->MapIds.count(WORLDSTATE_ANY_MAP)))
+    if (!map || (!worldStateTemplate->MapIds.contains(map->GetId()) && !worldStateTemplate->MapIds.contains(WORLDSTATE_ANY_MAP)))
         return 0;
 
     return map->GetWorldStateValue(worldStateId);
@@ -221,7 +222,7 @@ void WorldStateMgr::SetValue(int32 worldStateId, int32 value, bool hidden, Map*
         return;
     }
 
-    if (!map || (!worldStateTemplate->MapIds.count(map->GetId()) && !worldStateTemplate->MapIds.count(WORLDSTATE_ANY_MAP)))
+    if (!map || (!worldStateTemplate->MapIds.contains(map->GetId()) && !worldStateTemplate->MapIds.contains(WORLDSTATE_ANY_MAP)))
         return;
 
     map->SetWorldStateValue(worldStateId, value, hidden);
@@ -247,33 +248,32 @@ void WorldStateMgr::SetValueAndSaveInDb(int32 worldStateId, int32 value, bool hi
 WorldStateValueContainer WorldStateMgr::GetInitialWorldStatesForMap(Map const* map) const
 {
     WorldStateValueContainer initialValues;
-    if (WorldStateValueContainer const* valuesTemplate = Trinity::Containers::MapGetValuePtr(_worldStatesByMap, map->GetId()))
-        initialValues.insert(valuesTemplate->begin(), valuesTemplate->end());
-
-    if (WorldStateValueContainer const* valuesTemplate = Trinity::Containers::MapGetValuePtr(_worldStatesByMap, WORLDSTATE_ANY_MAP))
-        initialValues.insert(valuesTemplate->begin(), valuesTemplate->end());
+    for (int32 mapId : { int32(map->GetId()), WORLDSTATE_ANY_MAP })
+        if (WorldStateValueContainer const* valuesTemplate = Trinity::Containers::MapGetValuePtr(_worldStatesByMap, mapId))
+            for (std::pair<int32, int32> const& value : *valuesTemplate)
+                initialValues.insert(value);
 
     return initialValues;
 }
 
 void WorldStateMgr::FillInitialWorldStates(WorldPackets::WorldState::InitWorldStates& initWorldStates, Map const* map, uint32 playerAreaId) const
 {
+    WorldStateValueList const& mapValues = map->GetInitialWorldStatesForArea(playerAreaId);
+    initWorldStates.Worldstates.reserve(_realmWorldStateValues.size() + mapValues.size());
+
     for (auto const& [worldStateId, value] : _realmWorldStateValues)
         initWorldStates.Worldstates.emplace_back(worldStateId, value);
 
-    for (auto const& [worldStateId, value] : map->GetWorldStateValues())
-    {
-        WorldStateTemplate const* worldStateTemplate = GetWorldStateTemplate(worldStateId);
-        if (worldStateTemplate && !worldStateTemplate->AreaIds.empty())
-        {
-            bool isInAllowedArea = std::any_of(worldStateTemplate->AreaIds.begin(), worldStateTemplate->AreaIds.end(),
-                [=](uint32 requiredAreaId) { return DB2Manager::IsInArea(playerAreaId, requiredAreaId); });
-            if (!isInAllowedArea)
-                continue;
-        }
-
+    for (auto const& [worldStateId, value] : mapValues)
         initWorldStates.Worldstates.emplace_back(worldStateId, value);
-    }
+}
+
+bool WorldStateMgr::IsVisibleInArea(WorldStateTemplate const* worldStateTemplate, uint32 areaId)
+{
+    if (!worldStateTemplate || worldStateTemplate->AreaIds.empty())
+        return true;
+
+    return std::ranges::any_of(worldStateTemplate->AreaIds, [=](uint32 requiredAreaId) { return DB2Manager::IsInArea(areaId, requiredAreaId); });
 }
 
 WorldStateMgr* WorldStateMgr::instance()
@@ -45,6 +45,9 @@ public:
     WorldStateValueContainer GetInitialWorldStatesForMap(Map const* map) const;
 
     void FillInitialWorldStates(WorldPackets::WorldState::InitWorldStates& initWorldStates, Map const* map, uint32 playerAreaId) const;
+
+    /// World states without area requirements are visible everywhere on their maps
+    static bool IsVisibleInArea(WorldStateTemplate const* worldStateTemplate, uint32 areaId);
 };
 
 #define sWorldStateMgr WorldStateMgr::instance()
@@ -35,18 +35,24 @@ EndScriptData */
 #include "Conversation.h"
 #include "CreatureAI.h"
 #include "DB2Stores.h"
+#include "FlightRecorder.h"
 #include "GameTime.h"
 #include "GridNotifiersImpl.h"
 #include "InstanceScript.h"
+#include "LoadGenerator.h"
 #include "Language.h"
 #include "Log.h"
 #include "M2Stores.h"
+#include "MapBenchmark.h"
 #include "MapManager.h"
 #include "MovementPackets.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "Opcodes.h"
+#include "PacketLog.h"
 #include "PhasingHandler.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "RBAC.h"
 #include "SpellMgr.h"
 #include "SpellPackets.h"
@@ -128,6 +134,13 @@ public:
             { "asan outofbounds",   HandleDebugOutOfBounds,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "guidlimits",         HandleDebugGuidLimitsCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "objectcount",        HandleDebugObjectCountCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "mapbench",           HandleDebugMapBenchCommand,            rbac::RBAC_PERM_COMMAND_DEBUG,   Console::No },
+            { "loadgen start",      HandleDebugLoadGenStartCommand,        rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "loadgen stop",       HandleDebugLoadGenStopCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "loadgen report",     HandleDebugLoadGenReportCommand,       rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "profile start",      HandleDebugProfileStartCommand,        rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "profile stop",       HandleDebugProfileStopCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "replaypackets",      HandleDebugReplayPacketsCommand,       rbac::RBAC_PERM_COMMAND_DEBUG,   Console::No },
             { "questreset",         HandleDebugQuestResetCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "warden force",       HandleDebugWardenForce,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "personalclone",      HandleDebugBecomePersonalClone,        rbac::RBAC_PERM_COMMAND_DEBUG,   Console::No }
@@ -1714,17 +1727,164 @@ public:
         return true;
     }
 
+    // USAGE: .debug mapbench <ticks> [diff ms] [seed]
+    // runs extra ticks of the current map after this world update, do not use on live realms
+    static bool HandleDebugMapBenchCommand(ChatHandler* handler, uint32 ticks, Optional<uint32> diff, Optional<uint32> seed)
+    {
+        Player* player = handler->GetPlayer();
+        MapBenchmark::Request request;
+        request.MapId = player->GetMapId();
+        request.InstanceId = player->GetInstanceId();
+        request.Ticks = ticks;
+        request.Diff = diff.value_or(50);
+        request.Seed = seed.value_or(1);
+        request.Requester = player->GetGUID();
+
+        if (!MapBenchmark::Schedule(request))
+        {
+            handler->SendSysMessage("A map benchmark is already pending");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        handler->PSendSysMessage("Running %u ticks of %u ms at the end of this world update", std::clamp(ticks, 1u, MapBenchmark::MaxTicks), request.Diff);
+        return true;
+    }
+
+    // USAGE: .debug loadgen start <first account id> <count> [walk radius] [chat interval seconds]
+    // every account needs a character, the first one of each account is logged in
+    static bool HandleDebugLoadGenStartCommand(ChatHandler* handler, uint32 firstAccountId, uint32 count, Optional<float> walkRadius, Optional<uint32> chatInterval)
+    {
+        LoadGenerator::Settings settings;
+        settings.FirstAccountId = firstAccountId;
+        settings.BotCount = count;
+        if (walkRadius)
+            settings.WalkRadius = *walkRadius;
+        if (chatInterval)
+            settings.ChatInterval = Seconds(std::max(*chatInterval, 1u));
+
+        uint32 started = LoadGenerator::Start(settings);
+        handler->PSendSysMessage("Started %u bots, use .debug loadgen report to show the results", started);
+        return true;
+    }
+
+    static bool HandleDebugLoadGenStopCommand(ChatHandler* handler)
+    {
+        if (!LoadGenerator::IsRunning())
+        {
+            handler->SendSysMessage("Load generator is not running");
+            return true;
+        }
+
+        handler->SendSysMessage(LoadGenerator::BuildReport());
+        LoadGenerator::Stop();
+        return true;
+    }
+
+    static bool HandleDebugLoadGenReportCommand(ChatHandler* handler)
+    {
+        if (!LoadGenerator::IsRunning())
+        {
+            handler->SendSysMessage("Load generator is not running");
+            return true;
+        }
+
+        handler->SendSysMessage(LoadGenerator::BuildReport());
+        return true;
+    }
+
+    static bool HandleDebugProfileStartCommand(ChatHandler* handler)
+    {
+        sProfiler->Start();
+        handler->SendSysMessage("Profiler started, use .debug profile stop [file] to write the trace");
+        return true;
+    }
+
+    static bool HandleDebugProfileStopCommand(ChatHandler* handler, Optional<std::string> fileName)
+    {
+        if (!sProfiler->IsEnabled())
+        {
+            handler->SendSysMessage("Profiler is not running");
+            return true;
+        }
+
+        // the flight recorder needs the profiler to keep recording
+        if (!FlightRecorder::IsEnabled())
+            sProfiler->Stop();
+
+        std::string traceFileName = fileName ? *fileName : Trinity::StringFormat("profile_{}.json", GameTime::GetGameTime());
+        if (!sProfiler->WriteChromeTrace(traceFileName))
+        {
+            handler->PSendSysMessage("Failed to write profiler trace to %s", traceFileName.c_str());
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        handler->PSendSysMessage("Wrote %zu profiler zones to %s", sProfiler->GetRecordedZoneCount(), traceFileName.c_str());
+        return true;
+    }
+
+    // Feeds client packets of a PacketLogFile capture into the own session, handler cost is reported by
+    // the worldsession_update_opcode_time metric and .debug profile
+    static bool HandleDebugReplayPacketsCommand(ChatHandler* handler, std::string fileName)
+    {
+        PacketLogReader reader;
+        if (!reader.Open(fileName))
+        {
+            handler->PSendSysMessage("Failed to open packet capture %s", fileName.c_str());
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        WorldSession* session = handler->GetSession();
+        uint32 queued = 0;
+        uint32 skipped = 0;
+        PacketLogEntry entry;
+        while (reader.ReadNext(entry))
+        {
+            if (entry.PacketDirection != CLIENT_TO_SERVER)
+                continue;
+
+            OpcodeClient opcode = static_cast<OpcodeClient>(entry.Opcode);
+            ClientOpcodeHandler const* opcodeHandler = opcodeTable.IsValid(opcode) ? opcodeTable[opcode] : nullptr;
+
+            // only in game traffic is replayed, logging out would end the replay
+            if (!opcodeHandler || opcodeHandler->Status != STATUS_LOGGEDIN || opcode == CMSG_LOGOUT_REQUEST || opcode == CMSG_LOGOUT_INSTANT
+                || entry.ConnectionId >= MAX_CONNECTION_TYPES)
+            {
+                ++skipped;
+                continue;
+            }
+
+            // same layout as packets read by WorldSocket, the opcode precedes the payload
+            std::vector<uint8> storage(sizeof(entry.Opcode) + entry.Data.size());
+            std::memcpy(storage.data(), &entry.Opcode, sizeof(entry.Opcode));
+            if (!entry.Data.empty())
+                std::memcpy(storage.data() + sizeof(entry.Opcode), entry.Data.data(), entry.Data.size());
+
+            WorldPacket packet(std::move(storage), ConnectionType(entry.ConnectionId));
+            packet.read_skip<uint32>();
+            packet.SetOpcode(opcode);
+
+            session->QueuePacket(new ReceivedWorldPacket(std::move(packet)));
+            ++queued;
+        }
+
+        handler->PSendSysMessage("Queued %u packets from %s for replay, skipped %u not in game packets", queued, fileName.c_str(), skipped);
+        return true;
+    }
+
     class CreatureCountWorker
     {
     public:
-        void Visit(std::unordered_map<ObjectGuid, Creature*> const& creatureMap)
+        void Visit(Trinity::Containers::FlatHashMap<ObjectGuid, Creature*> const& creatureMap)
         {
             for (auto const& [_, creature] : creatureMap)
                 ++creatureCountsById[creature->GetEntry()];
         }
 
         template<class T>
-        static void Visit(std::unordered_map<ObjectGuid, T*> const&) { }
+        static void Visit(Trinity::Containers::FlatHashMap<ObjectGuid, T*> const&) { }
 
         std::vector<std::pair<uint32, uint32>> GetTopCreatureCount(std::size_t count) const
         {
@@ -873,6 +873,7 @@ public:
     {
         TC_LOG_INFO("misc", "Re-Loading Page Text...");
         sObjectMgr->LoadPageTexts();
+        sObjectMgr->InitializeQueriesData(QUERY_DATA_PAGE_TEXTS);
         handler->SendGlobalGMSysMessage("DB table `page_text` reloaded.");
         return true;
     }
@@ -1032,6 +1033,7 @@ public:
     {
         TC_LOG_INFO("misc", "Re-Loading Page Text Locale... ");
         sObjectMgr->LoadPageTextLocales();
+        sObjectMgr->InitializeQueriesData(QUERY_DATA_PAGE_TEXTS);
         handler->SendGlobalGMSysMessage("DB table `page_text_locale` reloaded.");
         return true;
     }
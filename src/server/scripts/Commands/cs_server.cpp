@@ -26,12 +26,14 @@ EndScriptData */
 #include "Chat.h"
 #include "ChatCommand.h"
 #include "Config.h"
+#include "CpuAccounting.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "GameTime.h"
 #include "GitRevision.h"
 #include "Language.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "MySQLThreading.h"
 #include "RBAC.h"
 #include "RealmList.h"
@@ -91,6 +93,12 @@ public:
             { "closed",   rbac::RBAC_PERM_COMMAND_SERVER_SET_CLOSED,   true, &HandleServerSetClosedCommand,   "" },
         };
 
+        static std::vector<ChatCommand> serverPerfCommandTable =
+        {
+            { "top",   rbac::RBAC_PERM_COMMAND_SERVER_DEBUG, true, &HandleServerPerfTopCommand,   "" },
+            { "reset", rbac::RBAC_PERM_COMMAND_SERVER_DEBUG, true, &HandleServerPerfResetCommand, "" },
+        };
+
         static std::vector<ChatCommand> serverCommandTable =
         {
             { "corpses",      rbac::RBAC_PERM_COMMAND_SERVER_CORPSES,      true, &HandleServerCorpsesCommand, "" },
@@ -99,7 +107,9 @@ public:
             { "idlerestart",  rbac::RBAC_PERM_COMMAND_SERVER_IDLERESTART,  true, nullptr,                     "", serverIdleRestartCommandTable },
             { "idleshutdown", rbac::RBAC_PERM_COMMAND_SERVER_IDLESHUTDOWN, true, nullptr,                     "", serverIdleShutdownCommandTable },
             { "info",         rbac::RBAC_PERM_COMMAND_SERVER_INFO,         true, &HandleServerInfoCommand,    "" },
+            { "memory",       rbac::RBAC_PERM_COMMAND_SERVER_DEBUG,        true, &HandleServerMemoryCommand,  "" },
             { "motd",         rbac::RBAC_PERM_COMMAND_SERVER_MOTD,         true, &HandleServerMotdCommand,    "" },
+            { "perf",         rbac::RBAC_PERM_COMMAND_SERVER_DEBUG,        true, nullptr,                     "", serverPerfCommandTable },
             { "plimit",       rbac::RBAC_PERM_COMMAND_SERVER_PLIMIT,       true, &HandleServerPLimitCommand,  "" },
             { "restart",      rbac::RBAC_PERM_COMMAND_SERVER_RESTART,      true, nullptr,                     "", serverRestartCommandTable },
             { "shutdown",     rbac::RBAC_PERM_COMMAND_SERVER_SHUTDOWN,     true, nullptr,                     "", serverShutdownCommandTable },
@@ -272,6 +282,46 @@ public:
 
         return true;
     }
+    static bool HandleServerMemoryCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        uint32 uptime = std::max<uint32>(GameTime::GetUptime(), 1);
+        for (uint8 i = 0; i < uint8(Trinity::MemoryDomain::Max); ++i)
+        {
+            Trinity::MemoryDomain domain = Trinity::MemoryDomain(i);
+            Trinity::MemoryDomainStats stats = Trinity::MemoryAccounting::GetStats(domain);
+            std::string_view name = Trinity::MemoryAccounting::GetDomainName(domain);
+            handler->PSendSysMessage("%.*s: %lld KiB live, %llu allocations (%llu/s, %llu KiB/s since startup)", int(name.length()), name.data(),
+                (long long)(stats.LiveBytes / 1024), (unsigned long long)stats.Allocations,
+                (unsigned long long)(stats.Allocations / uptime), (unsigned long long)(stats.AllocatedBytes / 1024 / uptime));
+        }
+
+        return true;
+    }
+
+    static bool HandleServerPerfTopCommand(ChatHandler* handler, Optional<uint32> count)
+    {
+        std::vector<CpuAccounting::Source> sources = CpuAccounting::GetSources();
+        double elapsed = std::max(double(CpuAccounting::GetTimeSinceReset().count()) * 1000000.0, 1.0);
+
+        handler->PSendSysMessage("CPU time since the last reset (%s ago):", secsToTimeString(CpuAccounting::GetTimeSinceReset().count() / IN_MILLISECONDS).c_str());
+        for (std::size_t i = 0; i < std::min<std::size_t>(sources.size(), count.value_or(10)); ++i)
+        {
+            CpuAccounting::Source const& source = sources[i];
+            std::string_view type = CpuAccounting::GetSourceTypeName(source.Type);
+            handler->PSendSysMessage("%5.1f%% of a core, %llu ms in %llu calls - %.*s %s", double(source.CpuTime) * 100.0 / elapsed,
+                (unsigned long long)(source.CpuTime / 1000000), (unsigned long long)source.Calls, int(type.length()), type.data(), source.Name.c_str());
+        }
+
+        return true;
+    }
+
+    static bool HandleServerPerfResetCommand(ChatHandler* handler)
+    {
+        CpuAccounting::Reset();
+        handler->SendSysMessage("CPU time counters reset.");
+        return true;
+    }
+
     // Display the 'Message of the day' for the realm
     static bool HandleServerMotdCommand(ChatHandler* handler, char const* /*args*/)
     {
@@ -960,7 +960,7 @@ class spell_warl_rain_of_fire : public AuraScript
 
         for (AreaTrigger* rainOfFireAreaTrigger : rainOfFireAreaTriggers)
         {
-            GuidUnorderedSet const& insideTargets = rainOfFireAreaTrigger->GetInsideUnits();
+            Trinity::Containers::FlatSet<ObjectGuid> const& insideTargets = rainOfFireAreaTrigger->GetInsideUnits();
             targetsInRainOfFire.insert(insideTargets.begin(), insideTargets.end());
         }
 
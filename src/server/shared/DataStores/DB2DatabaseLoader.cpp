@@ -27,10 +27,15 @@ static char const* nullStr = "";
 
 char* DB2DatabaseLoader::Load(bool custom, uint32& records, char**& indexTable, std::vector<char*>& stringPool, uint32& minId)
 {
+    // Must be queried before the streamed result below, it keeps the connection busy until all rows are read
+    uint32 maxId = 0;
+    if (PreparedQueryResult maxIdResult = HotfixDatabase.Query(HotfixDatabase.GetPreparedStatement(HotfixDatabaseStatements(_loadInfo->Statement + HOTFIX_MAX_ID_STMT_OFFSET))))
+        maxId = uint32((*maxIdResult)[0].GetUInt64());
+
     // Even though this query is executed only once, prepared statement is used to send data from mysql server in binary format
     HotfixDatabasePreparedStatement* stmt = HotfixDatabase.GetPreparedStatement(_loadInfo->Statement);
     stmt->setBool(0, !custom);
-    PreparedQueryResult result = HotfixDatabase.Query(stmt);
+    PreparedQueryResult result = HotfixDatabase.QueryStreamed(stmt);
     if (!result)
         return nullptr;
 
@@ -41,14 +46,8 @@ char* DB2DatabaseLoader::Load(bool custom, uint32& records, char**& indexTable,
     uint32 indexField = _loadInfo->Meta->GetDbIndexField();
     uint32 recordSize = _loadInfo->Meta->GetRecordSize();
 
-    // we store flat holders pool as single memory block
-    std::size_t stringFields = _loadInfo->GetStringFieldCount(false);
-
     // Resize index table
-    uint32 indexTableSize = records;
-    if (PreparedQueryResult maxIdResult = HotfixDatabase.Query(HotfixDatabase.GetPreparedStatement(HotfixDatabaseStatements(_loadInfo->Statement + HOTFIX_MAX_ID_STMT_OFFSET))))
-        if (uint32((*maxIdResult)[0].GetUInt64()) > records)
-            indexTableSize = uint32((*maxIdResult)[0].GetUInt64());
+    uint32 indexTableSize = std::max(records, maxId);
 
     if (indexTableSize > records)
     {
@@ -59,11 +58,9 @@ char* DB2DatabaseLoader::Load(bool custom, uint32& records, char**& indexTable,
         indexTable = tmpIdxTable;
     }
 
-    char* tempDataTable = new char[result->GetRowCount() * recordSize];
-    memset(tempDataTable, 0, result->GetRowCount() * recordSize);
-    uint32* newIndexes = new uint32[result->GetRowCount()];
-    if (stringFields)
-        stringPool.reserve(std::max<uint64>(stringPool.capacity(), stringPool.size() + stringFields * result->GetRowCount() + 1));
+    // row count is not known up front for streamed results
+    std::vector<char> tempDataTable;
+    std::vector<uint32> newIndexes;
 
     std::size_t newRecords = 0;
 
@@ -79,7 +76,8 @@ char* DB2DatabaseLoader::Load(bool custom, uint32& records, char**& indexTable,
         char* dataValue = indexTable[indexValue];
         if (!dataValue)
         {
-            newIndexes[newRecords] = indexValue;
+            newIndexes.push_back(indexValue);
+            tempDataTable.resize((newRecords + 1) * recordSize);
             dataValue = &tempDataTable[newRecords++ * recordSize];
             isNew = true;
         }
@@ -158,15 +156,11 @@ char* DB2DatabaseLoader::Load(bool custom, uint32& records, char**& indexTable,
     } while (result->NextRow());
 
     if (!newRecords)
-    {
-        delete[] tempDataTable;
-        delete[] newIndexes;
         return nullptr;
-    }
 
     // Compact new data table to only contain new records not previously loaded from file
     char* dataTable = new char[newRecords * recordSize];
-    memcpy(dataTable, tempDataTable, newRecords * recordSize);
+    memcpy(dataTable, tempDataTable.data(), newRecords * recordSize);
 
     // insert new records to index table
     for (std::size_t i = 0; i < newRecords; ++i)
@@ -176,9 +170,6 @@ char* DB2DatabaseLoader::Load(bool custom, uint32& records, char**& indexTable,
         minId = std::min(minId, newId);
     }
 
-    delete[] tempDataTable;
-    delete[] newIndexes;
-
     records = indexTableSize;
 
     return dataTable;
@@ -21,6 +21,85 @@
 #include "DB2FileSystemSource.h"
 #include "DB2Meta.h"
 #include "StringFormat.h"
+#include <boost/filesystem/operations.hpp>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+namespace
+{
+constexpr uint32 DB2SnapshotMagic = 'T' | ('C' << 8) | ('D' << 16) | ('S' << 24);
+constexpr uint32 DB2SnapshotVersion = 1;
+
+struct DB2SnapshotHeader
+{
+    uint32 Magic = DB2SnapshotMagic;
+    uint32 Version = DB2SnapshotVersion;
+    uint32 PointerSize = sizeof(char const*);
+    uint32 MetaLayoutHash = 0;
+    uint32 RecordSize = 0;
+    uint32 TableHash = 0;
+    uint32 LayoutHash = 0;
+    uint32 FieldCount = 0;
+    uint32 MinId = 0;
+    uint32 IndexTableSize = 0;
+    uint32 RecordCount = 0;
+    uint32 SourceCount = 0;
+    uint64 StringPoolSize = 0;
+};
+
+// Calls worker with the offset of every string pointer in a record, laid out as in DB2Meta::GetRecordSize
+template<typename Worker>
+void ForEachStringPointer(DB2Meta const* meta, Worker&& worker)
+{
+    std::size_t offset = meta->HasIndexFieldInData() ? 0 : 4;
+    for (uint32 i = 0; i < meta->FieldCount; ++i)
+    {
+        for (uint8 j = 0; j < meta->Fields[i].ArraySize; ++j)
+        {
+            if (i >= meta->FileFieldCount && int32(i) == meta->ParentIndexField)
+            {
+                offset += 4;
+                continue;
+            }
+
+            switch (meta->Fields[i].Type)
+            {
+                case FT_BYTE:
+                    offset += 1;
+                    break;
+                case FT_SHORT:
+                    offset += 2;
+                    break;
+                case FT_FLOAT:
+                case FT_INT:
+                    offset += 4;
+                    break;
+                case FT_LONG:
+                    offset += 8;
+                    break;
+                case FT_STRING:
+                    for (std::size_t locale = 0; locale < TOTAL_LOCALES; ++locale)
+                        worker(offset + locale * sizeof(char const*));
+                    offset += sizeof(LocalizedString);
+                    break;
+                case FT_STRING_NOT_LOCALIZED:
+                    worker(offset);
+                    offset += sizeof(char const*);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+struct FileCloser
+{
+    void operator()(FILE* file) const { fclose(file); }
+};
+}
 
 DB2StorageBase::DB2StorageBase(char const* fileName, DB2LoadInfo const* loadInfo)
     : _tableHash(0), _layoutHash(0), _fileName(fileName), _fieldCount(0), _loadInfo(loadInfo), _dataTable(nullptr), _dataTableEx(),
@@ -143,3 +222,164 @@ void DB2StorageBase::LoadStringsFromDB(LocaleConstant locale)
     loader.LoadStrings(true, locale, _indexTableSize, _indexTable, _stringPool);
     _stringPool.shrink_to_fit();
 }
+
+bool DB2StorageBase::LoadSnapshot(std::string const& fileName, std::vector<DB2SnapshotSource> const& sources)
+{
+    ASSERT(!_indexTable, "%s snapshot must be loaded instead of the db2 file", _fileName.c_str());
+
+    std::unique_ptr<FILE, FileCloser> file(fopen(fileName.c_str(), "rb"));
+    if (!file)
+        return false;
+
+    auto read = [&](void* buffer, std::size_t size) { return !size || fread(buffer, size, 1, file.get()) == 1; };
+
+    DB2SnapshotHeader header;
+    DB2SnapshotHeader const expected;
+    uint32 recordSize = _loadInfo->Meta->GetRecordSize();
+    if (!read(&header, sizeof(header))
+        || header.Magic != expected.Magic || header.Version != expected.Version || header.PointerSize != expected.PointerSize
+        || header.MetaLayoutHash != _loadInfo->Meta->LayoutHash || header.RecordSize != recordSize
+        || header.RecordCount > header.IndexTableSize || header.SourceCount != sources.size())
+        return false;
+
+    for (DB2SnapshotSource const& source : sources)
+    {
+        DB2SnapshotSource stored;
+        if (!read(&stored.Locale, sizeof(stored.Locale)) || !read(&stored.FileSize, sizeof(stored.FileSize)) || !read(&stored.LastWriteTime, sizeof(stored.LastWriteTime)))
+            return false;
+
+        if (stored != source)
+            return false;
+    }
+
+    std::unique_ptr<uint32[]> ids = std::make_unique<uint32[]>(header.RecordCount);
+    std::unique_ptr<char[]> dataTable = std::make_unique<char[]>(std::size_t(header.RecordCount) * recordSize);
+    std::unique_ptr<char[]> stringPool = std::make_unique<char[]>(header.StringPoolSize);
+    if (!read(ids.get(), header.RecordCount * sizeof(uint32))
+        || !read(dataTable.get(), std::size_t(header.RecordCount) * recordSize)
+        || !read(stringPool.get(), header.StringPoolSize))
+        return false;
+
+    // string offsets are stored + 1, 0 is a null pointer
+    if (header.StringPoolSize && stringPool[header.StringPoolSize - 1] != '\0')
+        return false;
+
+    std::unique_ptr<char*[]> indexTable = std::make_unique<char*[]>(header.IndexTableSize);
+    for (uint32 i = 0; i < header.RecordCount; ++i)
+    {
+        if (ids[i] >= header.IndexTableSize)
+            return false;
+
+        char* record = &dataTable[std::size_t(i) * recordSize];
+        bool valid = true;
+        ForEachStringPointer(_loadInfo->Meta, [&](std::size_t offset)
+        {
+            std::uintptr_t stringOffset;
+            memcpy(&stringOffset, record + offset, sizeof(stringOffset));
+            char const* str = nullptr;
+            if (stringOffset > header.StringPoolSize)
+                valid = false;
+            else if (stringOffset)
+                str = &stringPool[stringOffset - 1];
+
+            memcpy(record + offset, &str, sizeof(str));
+        });
+
+        if (!valid)
+            return false;
+
+        indexTable[ids[i]] = record;
+    }
+
+    _tableHash = header.TableHash;
+    _layoutHash = header.LayoutHash;
+    _fieldCount = header.FieldCount;
+    _minId = header.MinId;
+    _indexTableSize = header.IndexTableSize;
+    _indexTable = indexTable.release();
+    _dataTable = dataTable.release();
+    _stringPool.push_back(stringPool.release());
+    return true;
+}
+
+bool DB2StorageBase::SaveSnapshot(std::string const& fileName, std::vector<DB2SnapshotSource> const& sources) const
+{
+    uint32 recordSize = _loadInfo->Meta->GetRecordSize();
+
+    DB2SnapshotHeader header;
+    header.MetaLayoutHash = _loadInfo->Meta->LayoutHash;
+    header.RecordSize = recordSize;
+    header.TableHash = _tableHash;
+    header.LayoutHash = _layoutHash;
+    header.FieldCount = _fieldCount;
+    header.MinId = _minId;
+    header.IndexTableSize = _indexTableSize;
+    header.SourceCount = sources.size();
+
+    std::vector<uint32> ids;
+    std::vector<char> records;
+    // all empty strings share the first byte
+    std::vector<char> strings(1, '\0');
+    std::unordered_map<char const*, std::uintptr_t> stringOffsets;
+    for (uint32 id = 0; id < _indexTableSize; ++id)
+    {
+        char const* record = _indexTable[id];
+        if (!record)
+            continue;
+
+        ids.push_back(id);
+        std::size_t recordOffset = records.size();
+        records.insert(records.end(), record, record + recordSize);
+        ForEachStringPointer(_loadInfo->Meta, [&](std::size_t offset)
+        {
+            char const* str;
+            memcpy(&str, record + offset, sizeof(str));
+            std::uintptr_t stringOffset = 0;
+            if (str && !*str)
+                stringOffset = 1;
+            else if (str)
+            {
+                auto [itr, inserted] = stringOffsets.try_emplace(str, strings.size() + 1);
+                if (inserted)
+                    strings.insert(strings.end(), str, str + strlen(str) + 1);
+
+                stringOffset = itr->second;
+            }
+
+            memcpy(&records[recordOffset + offset], &stringOffset, sizeof(stringOffset));
+        });
+    }
+
+    header.RecordCount = ids.size();
+    header.StringPoolSize = strings.size();
+
+    // write to a temporary file first, a crash while saving must not leave a truncated snapshot behind
+    std::string tempFileName = fileName + ".tmp";
+    {
+        std::unique_ptr<FILE, FileCloser> file(fopen(tempFileName.c_str(), "wb"));
+        if (!file)
+            return false;
+
+        auto write = [&](void const* buffer, std::size_t size) { return !size || fwrite(buffer, size, 1, file.get()) == 1; };
+
+        bool written = write(&header, sizeof(header));
+        for (DB2SnapshotSource const& source : sources)
+            written = written && write(&source.Locale, sizeof(source.Locale)) && write(&source.FileSize, sizeof(source.FileSize)) && write(&source.LastWriteTime, sizeof(source.LastWriteTime));
+
+        written = written && write(ids.data(), ids.size() * sizeof(uint32))
+            && write(records.data(), records.size())
+            && write(strings.data(), strings.size());
+
+        if (!written || fflush(file.get()) != 0)
+        {
+            file.reset();
+            boost::system::error_code error;
+            boost::filesystem::remove(tempFileName, error);
+            return false;
+        }
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::rename(tempFileName, fileName, error);
+    return !error;
+}
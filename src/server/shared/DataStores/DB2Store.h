@@ -26,6 +26,16 @@
 class ByteBuffer;
 struct DB2LoadInfo;
 
+/// Identifies one source file of a snapshot, the snapshot is only used when all of them are unchanged
+struct DB2SnapshotSource
+{
+    uint32 Locale = 0;
+    uint64 FileSize = 0;
+    int64 LastWriteTime = 0;
+
+    friend bool operator==(DB2SnapshotSource const& left, DB2SnapshotSource const& right) = default;
+};
+
 /// Interface class for common access
 class TC_SHARED_API DB2StorageBase
 {
@@ -54,6 +64,10 @@ public:
     void LoadFromDB();
     void LoadStringsFromDB(LocaleConstant locale);
 
+    // Snapshots hold the state after Load and LoadStringsFrom, database data must still be loaded afterwards
+    bool LoadSnapshot(std::string const& fileName, std::vector<DB2SnapshotSource> const& sources);
+    bool SaveSnapshot(std::string const& fileName, std::vector<DB2SnapshotSource> const& sources) const;
+
 protected:
     uint32 _tableHash;
     uint32 _layoutHash;
@@ -16,21 +16,59 @@
  */
 
 #include "IPLocation.h"
-#include "BigNumber.h"
 #include "Config.h"
 #include "Errors.h"
 #include "IpAddress.h"
 #include "Log.h"
+#include "Optional.h"
 #include "Util.h"
 #include <algorithm>
 #include <fstream>
+#include <limits>
+#include <unordered_map>
 
 IpLocationStore::IpLocationStore() = default;
 IpLocationStore::~IpLocationStore() = default;
 
+namespace
+{
+// parses a decimal number of up to 128 bits into big endian bytes, ipv4 values are converted to ipv6 v4 mapped addresses
+Optional<std::array<uint8, 16>> ParseDecimalIpAddress(std::string_view str)
+{
+    if (str.empty())
+        return {};
+
+    std::array<uint8, 16> bytes = { };
+    for (char c : str)
+    {
+        if (c < '0' || c > '9')
+            return {};
+
+        uint32 carry = c - '0';
+        for (std::size_t i = bytes.size(); i > 0; --i)
+        {
+            carry += bytes[i - 1] * 10u;
+            bytes[i - 1] = uint8(carry & 0xFF);
+            carry >>= 8;
+        }
+
+        if (carry)
+            return {};
+    }
+
+    if (std::all_of(bytes.begin(), bytes.begin() + 12, [](uint8 b) { return b == 0; }))
+        bytes[10] = bytes[11] = 0xFF;
+
+    return bytes;
+}
+}
+
 void IpLocationStore::Load()
 {
-    _ipLocationStore.clear();
+    _locations.clear();
+    _ipRangeStarts.clear();
+    _ipRangeEnds.clear();
+    _ipRangeLocations.clear();
     TC_LOG_INFO("server.loading", "Loading IP Location Database...");
 
     std::string databaseFilePath = sConfigMgr->GetStringDefault("IPLocationFile", "");
@@ -51,25 +89,19 @@ void IpLocationStore::Load()
         return;
     }
 
+    struct IpRange
+    {
+        IpAddressBytes From;
+        IpAddressBytes To;
+        uint16 Location;
+    };
+
     std::string ipFrom;
     std::string ipTo;
     std::string countryCode;
     std::string countryName;
-    BigNumber bnParser;
-    BigNumber ipv4Max(0xFFFFFFFF);
-    BigNumber ipv6MappedMask(0xFFFF);
-    ipv6MappedMask <<= 32;
-
-    auto parseStringToIPv6 = [&](std::string const& str) -> Optional<std::array<uint8, 16>>
-    {
-        bnParser.SetDecStr(str);
-        if (!bnParser.SetDecStr(str))
-            return {};
-        // convert ipv4 to ipv6 v4 mapped value
-        if (bnParser <= ipv4Max)
-            bnParser += ipv6MappedMask;
-        return bnParser.ToByteArray<16>(false);
-    };
+    std::vector<IpRange> ranges;
+    std::unordered_map<std::string, uint16> locationsByCountryCode;
 
     while (databaseFile.good())
     {
@@ -98,24 +130,41 @@ void IpLocationStore::Load()
         // Convert country code to lowercase
         strToLower(countryCode);
 
-        Optional<std::array<uint8, 16>> from = parseStringToIPv6(ipFrom);
+        Optional<IpAddressBytes> from = ParseDecimalIpAddress(ipFrom);
         if (!from)
             continue;
 
-        Optional<std::array<uint8, 16>> to = parseStringToIPv6(ipTo);
+        Optional<IpAddressBytes> to = ParseDecimalIpAddress(ipTo);
         if (!to)
             continue;
 
-        _ipLocationStore.emplace_back(*from, *to, std::move(countryCode), std::move(countryName));
+        auto [location, inserted] = locationsByCountryCode.try_emplace(countryCode, uint16(_locations.size()));
+        if (inserted)
+        {
+            ASSERT(_locations.size() < std::numeric_limits<uint16>::max(), "Too many countries in ip database file");
+            _locations.emplace_back(std::move(countryCode), std::move(countryName));
+        }
+
+        ranges.push_back({ .From = *from, .To = *to, .Location = location->second });
     }
 
-    std::ranges::sort(_ipLocationStore, {}, &IpLocationRecord::IpFrom);
-    ASSERT(std::ranges::is_sorted(_ipLocationStore, [](IpLocationRecord const& a, IpLocationRecord const& b) { return a.IpFrom < b.IpTo; }),
+    std::ranges::sort(ranges, {}, &IpRange::From);
+    ASSERT(std::ranges::is_sorted(ranges, [](IpRange const& a, IpRange const& b) { return a.From < b.To; }),
         "Overlapping IP ranges detected in database file");
 
     databaseFile.close();
 
-    TC_LOG_INFO("server.loading", ">> Loaded {} ip location entries.", _ipLocationStore.size());
+    _ipRangeStarts.reserve(ranges.size());
+    _ipRangeEnds.reserve(ranges.size());
+    _ipRangeLocations.reserve(ranges.size());
+    for (IpRange const& range : ranges)
+    {
+        _ipRangeStarts.push_back(range.From);
+        _ipRangeEnds.push_back(range.To);
+        _ipRangeLocations.push_back(range.Location);
+    }
+
+    TC_LOG_INFO("server.loading", ">> Loaded {} ip location entries for {} countries.", _ipRangeStarts.size(), _locations.size());
 }
 
 IpLocationRecord const* IpLocationStore::GetLocationRecord(std::string const& ipAddress) const
@@ -125,7 +174,7 @@ IpLocationRecord const* IpLocationStore::GetLocationRecord(std::string const& ip
     if (error)
         return nullptr;
 
-    std::array<uint8, 16> bytes = [&]() -> std::array<uint8, 16>
+    IpAddressBytes bytes = [&]() -> IpAddressBytes
     {
         if (address.is_v6())
             return address.to_v6().to_bytes();
@@ -133,14 +182,16 @@ IpLocationRecord const* IpLocationStore::GetLocationRecord(std::string const& ip
             return Trinity::Net::make_address_v6(Trinity::Net::v4_mapped, address.to_v4()).to_bytes();
         return {};
     }();
-    auto itr = std::ranges::upper_bound(_ipLocationStore, bytes, {}, &IpLocationRecord::IpTo);
-    if (itr == _ipLocationStore.end())
+
+    auto itr = std::ranges::upper_bound(_ipRangeEnds, bytes);
+    if (itr == _ipRangeEnds.end())
         return nullptr;
 
-    if (bytes < itr->IpFrom)
+    std::size_t index = std::distance(_ipRangeEnds.begin(), itr);
+    if (bytes < _ipRangeStarts[index])
         return nullptr;
 
-    return &(*itr);
+    return &_locations[_ipRangeLocations[index]];
 }
 
 IpLocationStore* IpLocationStore::Instance()
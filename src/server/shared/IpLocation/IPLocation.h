@@ -25,12 +25,10 @@
 
 struct IpLocationRecord
 {
-    IpLocationRecord() : IpFrom(), IpTo() { }
-    IpLocationRecord(std::array<uint8, 16> ipFrom, std::array<uint8, 16> ipTo, std::string&& countryCode, std::string&& countryName)
-        : IpFrom(ipFrom), IpTo(ipTo), CountryCode(std::move(countryCode)), CountryName(std::move(countryName)) { }
+    IpLocationRecord() = default;
+    IpLocationRecord(std::string&& countryCode, std::string&& countryName)
+        : CountryCode(std::move(countryCode)), CountryName(std::move(countryName)) { }
 
-    std::array<uint8, 16> IpFrom;
-    std::array<uint8, 16> IpTo;
     std::string CountryCode;
     std::string CountryName;
 };
@@ -50,7 +48,15 @@ class TC_SHARED_API IpLocationStore
         IpLocationRecord const* GetLocationRecord(std::string const& ipAddress) const;
 
     private:
-        std::vector<IpLocationRecord> _ipLocationStore;
+        using IpAddressBytes = std::array<uint8, 16>;
+
+        // one record per country, ranges only keep an index into it
+        std::vector<IpLocationRecord> _locations;
+
+        // sorted, non overlapping ranges split into separate arrays so the binary search only touches range ends
+        std::vector<IpAddressBytes> _ipRangeStarts;
+        std::vector<IpAddressBytes> _ipRangeEnds;
+        std::vector<uint16> _ipRangeLocations;
 };
 
 #define sIPLocation IpLocationStore::Instance()
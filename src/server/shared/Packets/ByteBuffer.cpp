@@ -18,6 +18,8 @@
 #include "ByteBuffer.h"
 #include "Errors.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
+#include "MPMCQueue.h"
 #include <utf8.h>
 #include <algorithm>
 #include <sstream>
@@ -33,6 +35,93 @@ ByteBufferInvalidValueException::ByteBufferInvalidValueException(char const* typ
 {
 }
 
+namespace
+{
+// Packets are allocated on map and world threads but mostly destroyed on network threads after being copied
+// into the send buffer, a shared pool lets the storage travel back to the threads creating packets
+class ByteBufferStoragePool
+{
+public:
+    struct SizeClass
+    {
+        std::size_t Capacity;
+        std::size_t MaxPooled;
+    };
+
+    static constexpr std::array<SizeClass, 4> SizeClasses =
+    { {
+        { .Capacity = 256, .MaxPooled = 8192 },
+        { .Capacity = 1024, .MaxPooled = 4096 },
+        { .Capacity = 4096, .MaxPooled = 1024 },
+        { .Capacity = 16384, .MaxPooled = 256 },
+    } };
+
+    ByteBufferStoragePool()
+    {
+        for (std::size_t i = 0; i < SizeClasses.size(); ++i)
+            _pools[i] = std::make_unique<MPMCQueue<std::vector<uint8>>>(SizeClasses[i].MaxPooled);
+    }
+
+    static ByteBufferStoragePool& Instance()
+    {
+        // intentionally leaked, buffers can be destroyed during static destruction
+        static ByteBufferStoragePool* instance = new ByteBufferStoragePool();
+        return *instance;
+    }
+
+    std::vector<uint8> Acquire(std::size_t reserve)
+    {
+        std::vector<uint8> storage;
+        if (!reserve || reserve > SizeClasses.back().Capacity)
+        {
+            storage.reserve(reserve);
+            return storage;
+        }
+
+        // smallest class that fits the requested size
+        std::size_t index = 0;
+        while (SizeClasses[index].Capacity < reserve)
+            ++index;
+
+        if (_pools[index]->Pop(storage))
+            Trinity::MemoryAccounting::TrackDeallocation(Trinity::MemoryDomain::PacketPool, storage.capacity());
+        else
+            storage.reserve(SizeClasses[index].Capacity);
+
+        return storage;
+    }
+
+    void Recycle(std::vector<uint8>&& storage)
+    {
+        std::size_t capacity = storage.capacity();
+        if (capacity < SizeClasses.front().Capacity || capacity > SizeClasses.back().Capacity * 4)
+            return;
+
+        // largest class that is fully covered by the capacity
+        std::size_t index = SizeClasses.size() - 1;
+        while (SizeClasses[index].Capacity > capacity)
+            --index;
+
+        storage.clear();
+        if (_pools[index]->TryPush(std::move(storage)))
+            Trinity::MemoryAccounting::TrackAllocation(Trinity::MemoryDomain::PacketPool, capacity);
+    }
+
+private:
+    std::array<std::unique_ptr<MPMCQueue<std::vector<uint8>>>, SizeClasses.size()> _pools;
+};
+}
+
+std::vector<uint8> ByteBuffer::AcquireStorage(size_t reserve)
+{
+    return ByteBufferStoragePool::Instance().Acquire(reserve);
+}
+
+void ByteBuffer::RecycleStorage(std::vector<uint8>&& storage)
+{
+    ByteBufferStoragePool::Instance().Recycle(std::move(storage));
+}
+
 ByteBuffer& ByteBuffer::operator>>(float& value)
 {
     read(&value, 1);
@@ -89,11 +178,17 @@ void ByteBuffer::append(uint8 const* src, size_t cnt)
 {
     ASSERT(src, "Attempted to put a NULL-pointer in ByteBuffer (pos: " SZFMTD " size: " SZFMTD ")", _wpos, size());
     ASSERT(cnt, "Attempted to put a zero-sized value in ByteBuffer (pos: " SZFMTD " size: " SZFMTD ")", _wpos, size());
-    ASSERT((size() + cnt) < 100000000);
+
+    std::memcpy(GrowForWrite(cnt), src, cnt);
+}
+
+uint8* ByteBuffer::GrowForWrite(size_t bytes)
+{
+    ASSERT((size() + bytes) < 100000000);
 
     FlushBits();
 
-    size_t const newSize = _wpos + cnt;
+    size_t const newSize = _wpos + bytes;
     if (_storage.capacity() < newSize) // custom memory allocation rules
     {
         if (newSize < 100)
@@ -108,8 +203,10 @@ void ByteBuffer::append(uint8 const* src, size_t cnt)
 
     if (_storage.size() < newSize)
         _storage.resize(newSize);
-    std::memcpy(&_storage[_wpos], src, cnt);
+
+    uint8* dest = &_storage[_wpos];
     _wpos = newSize;
+    return dest;
 }
 
 void ByteBuffer::put(size_t pos, uint8 const* src, size_t cnt)
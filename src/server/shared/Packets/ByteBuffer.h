@@ -72,9 +72,8 @@ class TC_SHARED_API ByteBuffer
         // constructor
         explicit ByteBuffer() : ByteBuffer(DEFAULT_SIZE, Reserve{}) { }
 
-        explicit ByteBuffer(size_t size, Reserve) : _rpos(0), _wpos(0), _bitpos(InitialBitPos), _curbitval(0)
+        explicit ByteBuffer(size_t size, Reserve) : _rpos(0), _wpos(0), _bitpos(InitialBitPos), _curbitval(0), _storage(AcquireStorage(size))
         {
-            _storage.reserve(size);
         }
 
         explicit ByteBuffer(size_t size, Resize) : _rpos(0), _wpos(size), _bitpos(InitialBitPos), _curbitval(0)
@@ -115,7 +114,10 @@ class TC_SHARED_API ByteBuffer
             return *this;
         }
 
-        virtual ~ByteBuffer() = default;
+        virtual ~ByteBuffer()
+        {
+            RecycleStorage(std::move(_storage));
+        }
 
         void clear()
         {
@@ -133,6 +135,21 @@ class TC_SHARED_API ByteBuffer
             append(reinterpret_cast<uint8 const*>(&value), sizeof(value));
         }
 
+        /**
+         * Appends a fixed layout sequence of values after a single capacity check
+         * instead of one check (and possible reallocation) per value
+         *
+         *     data.AppendFixed(int32(SpellID), int32(Damage), uint8(SchoolMask));
+         */
+        template <ByteBufferNumeric... T>
+        void AppendFixed(T... values)
+        {
+            static_assert(sizeof...(T) > 0);
+
+            uint8* dest = GrowForWrite((sizeof(T) + ...));
+            ((WriteUnchecked(dest, values), dest += sizeof(T)), ...);
+        }
+
         bool HasUnfinishedBitPack() const
         {
             return _bitpos != 8;
@@ -189,19 +206,22 @@ class TC_SHARED_API ByteBuffer
 
             if (bits > int32(_bitpos))
             {
-                // first write to fill bit buffer
-                _curbitval |= value >> (bits - _bitpos);
+                // first fill the bit buffer, then collect as many full bytes as possible
+                // and append all of them at once
+                std::array<uint8, sizeof(uint64) + 1> bytes;
+                std::size_t byteCount = 0;
+                bytes[byteCount++] = _curbitval | uint8(value >> (bits - _bitpos));
                 bits -= _bitpos;
                 _bitpos = 8; // required "unneccessary" write to avoid double flushing
-                append(&_curbitval, sizeof(_curbitval));
 
-                // then append as many full bytes as possible
                 while (bits >= 8)
                 {
                     bits -= 8;
-                    append<uint8>(value >> bits);
+                    bytes[byteCount++] = uint8(value >> bits);
                 }
 
+                append(bytes.data(), byteCount);
+
                 // store remaining bits in the bit buffer
                 _bitpos = 8 - bits;
                 _curbitval = (value & ((UI64LIT(1) << bits) - 1)) << _bitpos;
@@ -622,6 +642,20 @@ class TC_SHARED_API ByteBuffer
     protected:
         [[noreturn]] void OnInvalidPosition(size_t pos, size_t valueSize) const;
 
+        // reuses storage of destroyed buffers from a shared size class pool
+        static std::vector<uint8> AcquireStorage(size_t reserve);
+        static void RecycleStorage(std::vector<uint8>&& storage);
+
+        // flushes pending bits, makes room for bytes at wpos and returns where to write them
+        uint8* GrowForWrite(size_t bytes);
+
+        template <ByteBufferNumeric T>
+        static void WriteUnchecked(uint8* dest, T value)
+        {
+            EndianConvert(value);
+            std::memcpy(dest, &value, sizeof(value));
+        }
+
         size_t _rpos, _wpos;
         uint8 _bitpos;
         uint8 _curbitval;
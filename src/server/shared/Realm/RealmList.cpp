@@ -193,6 +193,10 @@ void RealmList::UpdateRealms()
         _realms.swap(newRealms);
         _removedRealms.swap(existingRealms);
 
+        std::lock_guard<std::mutex> cacheLock(_cacheMutex);
+        _realmEntryCache.clear();
+        _realmListCache.clear();
+
         if (_currentRealmId)
             if (std::shared_ptr<Realm> realm = Trinity::Containers::MapGetValuePtr(_realms, *_currentRealmId))
                 _currentRealmId = realm->Id;    // fill other fields of realm id
@@ -279,54 +283,90 @@ void RealmList::FillRealmEntry(Realm const& realm, uint32 clientBuild, AccountTy
     realmEntry->set_cfglanguagesid(1);
 }
 
-std::vector<uint8> RealmList::GetRealmEntryJSON(Battlenet::RealmHandle const& id, uint32 build, AccountTypes accountSecurityLevel) const
+RealmList::CompressedJson RealmList::GetRealmEntryJSON(Battlenet::RealmHandle const& id, uint32 build, AccountTypes accountSecurityLevel) const
 {
-    std::vector<uint8> compressed;
-    if (std::shared_ptr<Realm const> realm = GetRealm(id))
+    std::shared_lock<std::shared_mutex> lock(_realmsMutex);
+    std::tuple<uint32, uint32, AccountTypes> key(id.GetAddress(), build, accountSecurityLevel);
     {
-        if (realm->PopulationLevel != RealmPopulationState::Offline && realm->Build == build && accountSecurityLevel >= realm->AllowedSecurityLevel)
-        {
-            JSON::RealmList::RealmEntry realmEntry;
-            FillRealmEntry(*realm, build, accountSecurityLevel, &realmEntry);
+        std::lock_guard<std::mutex> cacheLock(_cacheMutex);
+        auto itr = _realmEntryCache.find(key);
+        if (itr != _realmEntryCache.end())
+            return itr->second;
+    }
 
-            std::string json = "JamJSONRealmEntry:" + JSON::Serialize(realmEntry);
-            CompressJson(json, &compressed);
-        }
+    std::shared_ptr<Realm> realm = Trinity::Containers::MapGetValuePtr(_realms, id);
+    if (!realm)
+        return nullptr;
+
+    CompressedJson payload;
+    if (realm->PopulationLevel != RealmPopulationState::Offline && realm->Build == build && accountSecurityLevel >= realm->AllowedSecurityLevel)
+    {
+        JSON::RealmList::RealmEntry realmEntry;
+        FillRealmEntry(*realm, build, accountSecurityLevel, &realmEntry);
+
+        std::string json = "JamJSONRealmEntry:" + JSON::Serialize(realmEntry);
+        std::vector<uint8> compressed;
+        if (CompressJson(json, &compressed))
+            payload = std::make_shared<std::vector<uint8> const>(std::move(compressed));
     }
 
-    return compressed;
+    std::lock_guard<std::mutex> cacheLock(_cacheMutex);
+    if (_realmEntryCache.size() >= MaxCachedPayloads)
+        return payload;
+
+    return _realmEntryCache.try_emplace(key, std::move(payload)).first->second;
 }
 
-std::vector<uint8> RealmList::GetRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const
+RealmList::CompressedJson RealmList::GetRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const
+{
+    std::shared_lock<std::shared_mutex> lock(_realmsMutex);
+    std::tuple<uint32, AccountTypes, std::string> key(build, accountSecurityLevel, subRegion);
+    {
+        std::lock_guard<std::mutex> cacheLock(_cacheMutex);
+        auto itr = _realmListCache.find(key);
+        if (itr != _realmListCache.end())
+            return itr->second;
+    }
+
+    CompressedJson payload = BuildRealmList(build, accountSecurityLevel, subRegion);
+
+    // subregion is sent by the client, don't let unknown values grow the cache
+    std::lock_guard<std::mutex> cacheLock(_cacheMutex);
+    if (!_subRegions.contains(subRegion) || _realmListCache.size() >= MaxCachedPayloads)
+        return payload;
+
+    return _realmListCache.try_emplace(std::move(key), std::move(payload)).first->second;
+}
+
+RealmList::CompressedJson RealmList::BuildRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const
 {
     JSON::RealmList::RealmListUpdates realmList;
+    for (auto const& [_, realm] : _realms)
     {
-        std::shared_lock<std::shared_mutex> lock(_realmsMutex);
-        for (auto const& [_, realm] : _realms)
-        {
-            if (realm->Id.GetSubRegionAddress() != subRegion)
-                continue;
+        if (realm->Id.GetSubRegionAddress() != subRegion)
+            continue;
 
-            JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
-            FillRealmEntry(*realm, build, accountSecurityLevel, state->mutable_update());
-            state->set_deleting(false);
-        }
+        JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
+        FillRealmEntry(*realm, build, accountSecurityLevel, state->mutable_update());
+        state->set_deleting(false);
+    }
 
-        for (auto const& [id, _] : _removedRealms)
-        {
-            if (id.GetSubRegionAddress() != subRegion)
-                continue;
+    for (auto const& [id, _] : _removedRealms)
+    {
+        if (id.GetSubRegionAddress() != subRegion)
+            continue;
 
-            JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
-            state->set_wowrealmaddress(id.GetAddress());
-            state->set_deleting(true);
-        }
+        JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
+        state->set_wowrealmaddress(id.GetAddress());
+        state->set_deleting(true);
     }
 
     std::string json = "JSONRealmListUpdates:" + JSON::Serialize(realmList);
     std::vector<uint8> compressed;
-    CompressJson(json, &compressed);
-    return compressed;
+    if (!CompressJson(json, &compressed))
+        return nullptr;
+
+    return std::make_shared<std::vector<uint8> const>(std::move(compressed));
 }
 
 uint32 RealmList::JoinRealm(uint32 realmAddress, uint32 build, ClientBuild::VariantId const& buildVariant, boost::asio::ip::address const& clientAddress,
@@ -26,7 +26,9 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -46,6 +48,7 @@ class TC_SHARED_API RealmList
 {
 public:
     typedef std::map<Battlenet::RealmHandle, std::shared_ptr<Realm>> RealmMap;
+    using CompressedJson = std::shared_ptr<std::vector<uint8> const>;
 
     static RealmList* Instance();
 
@@ -65,8 +68,9 @@ public:
     std::shared_ptr<Realm const> GetCurrentRealm() const;
 
     void WriteSubRegions(bgs::protocol::game_utilities::v1::GetAllValuesForAttributeResponse* response) const;
-    std::vector<uint8> GetRealmEntryJSON(Battlenet::RealmHandle const& id, uint32 build, AccountTypes accountSecurityLevel) const;
-    std::vector<uint8> GetRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const;
+    // both are built and compressed once per realm list update for every distinct set of arguments, null if not available
+    CompressedJson GetRealmEntryJSON(Battlenet::RealmHandle const& id, uint32 build, AccountTypes accountSecurityLevel) const;
+    CompressedJson GetRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const;
     uint32 JoinRealm(uint32 realmAddress, uint32 build, ClientBuild::VariantId const& buildVariant, boost::asio::ip::address const& clientAddress,
         std::array<uint8, 32> const& clientSecret, LocaleConstant locale, std::string const& os, Minutes timezoneOffset, std::string const& accountName,
         AccountTypes accountSecurityLevel, bgs::protocol::game_utilities::v1::ClientResponse* response) const;
@@ -79,6 +83,9 @@ private:
         std::vector<boost::asio::ip::address>&& addresses,
         uint16 port, uint8 icon, RealmFlags flag, uint8 timezone, AccountTypes allowedSecurityLevel, RealmPopulationState population);
     void FillRealmEntry(Realm const& realm, uint32 clientBuild, AccountTypes accountSecurityLevel, JSON::RealmList::RealmEntry* realmEntry) const;
+    CompressedJson BuildRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const;
+
+    static constexpr std::size_t MaxCachedPayloads = 256;
 
     mutable std::shared_mutex _realmsMutex;
     RealmMap _realms;
@@ -88,6 +95,11 @@ private:
     std::unique_ptr<Trinity::Asio::DeadlineTimer> _updateTimer;
     std::unique_ptr<Trinity::Net::Resolver> _resolver;
     Optional<Battlenet::RealmHandle> _currentRealmId;
+
+    // cleared by UpdateRealms, entries are only added while holding a shared lock on _realmsMutex
+    mutable std::mutex _cacheMutex;
+    mutable std::map<std::tuple<uint32, uint32, AccountTypes>, CompressedJson> _realmEntryCache;
+    mutable std::map<std::tuple<uint32, AccountTypes, std::string>, CompressedJson> _realmListCache;
 };
 
 #define sRealmList RealmList::Instance()
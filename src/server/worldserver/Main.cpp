@@ -24,16 +24,20 @@
 #include "BigNumber.h"
 #include "CliRunnable.h"
 #include "Configuration/Config.h"
+#include "CpuAccounting.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "DeadlineTimer.h"
 #include "GitRevision.h"
+#include "GuildMgr.h"
 #include "InstanceLockMgr.h"
 #include "IoContext.h"
 #include "IpNetwork.h"
+#include "LargePages.h"
 #include "Locales.h"
 #include "MapManager.h"
 #include "Memory.h"
+#include "MemoryAccounting.h"
 #include "Metric.h"
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
@@ -290,6 +294,8 @@ int main(int argc, char** argv)
     // Set process priority according to configuration settings
     SetProcessPriority("server.worldserver", sConfigMgr->GetIntDefault(CONFIG_PROCESSOR_AFFINITY, 0), sConfigMgr->GetBoolDefault(CONFIG_HIGH_PRIORITY, false));
 
+    Trinity::LargePages::SetEnabled(sConfigMgr->GetBoolDefault("LargePages.Enable", false));
+
     // Start the databases
     if (!StartDB())
         return 1;
@@ -333,6 +339,15 @@ int main(int argc, char** argv)
         TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        CpuAccounting::LogMetrics();
+
+        for (uint8 i = 0; i < uint8(Trinity::MemoryDomain::Max); ++i)
+        {
+            Trinity::MemoryDomainStats stats = Trinity::MemoryAccounting::GetStats(Trinity::MemoryDomain(i));
+            std::string domain(Trinity::MemoryAccounting::GetDomainName(Trinity::MemoryDomain(i)));
+            TC_METRIC_VALUE("memory_live_bytes", stats.LiveBytes, TC_METRIC_TAG("domain", domain));
+            TC_METRIC_VALUE("memory_allocations", stats.Allocations, TC_METRIC_TAG("domain", domain));
+        }
     });
 
     realm = nullptr;
@@ -406,6 +421,7 @@ int main(int argc, char** argv)
     {
         sWorld->KickAll();                                       // save and kick all players
         sWorld->UpdateSessions(1);                             // real players unload required UpdateSessions call
+        sGuildMgr->SaveGuilds();                               // flush guild logs not yet written by the periodic save
 
         mgr->StopNetwork();
 
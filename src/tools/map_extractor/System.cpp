@@ -27,6 +27,7 @@
 #include "MapDefines.h"
 #include "MapUtils.h"
 #include "StringFormat.h"
+#include "ThreadPool.h"
 #include "Util.h"
 #include "adt.h"
 #include "wdt.h"
@@ -34,10 +35,12 @@
 #include <boost/filesystem/directory.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <atomic>
 #include <bitset>
 #include <deque>
 #include <fstream>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <cstdio>
 #include <cstdlib>
@@ -116,6 +119,7 @@ uint32 CONF_Locale = 0;
 char const* CONF_Product = "wow";
 char const* CONF_Region = "eu";
 bool CONF_UseRemoteCasc = false;
+uint32 CONF_Threads = std::max(std::thread::hardware_concurrency(), 1u);
 
 #define CASC_LOCALES_COUNT 17
 
@@ -172,6 +176,7 @@ void Usage(char const* prg)
         "-p which installed product to open (wow/wowt/wow_beta)\n"\
         "-c use remote casc\n"\
         "-r set remote casc region - standard: eu\n"\
+        "-t number of threads converting map tiles - standard: all hardware threads\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"\n", prg, prg);
     exit(1);
 }
@@ -188,6 +193,7 @@ void HandleArgs(int argc, char* arg[])
         // l - dbc locale
         // c - use remote casc
         // r - set casc remote region - standard: eu
+        // t - number of threads converting map tiles
         if (arg[c][0] != '-')
             Usage(arg[0]);
 
@@ -250,6 +256,12 @@ void HandleArgs(int argc, char* arg[])
                 else
                     Usage(arg[0]);
                 break;
+            case 't':
+                if (c + 1 < argc)                            // all ok
+                    CONF_Threads = std::max(atoi(arg[c++ + 1]), 1);
+                else
+                    Usage(arg[0]);
+                break;
             case 'h':
                 Usage(arg[0]);
                 break;
@@ -426,24 +438,24 @@ float selectUInt16StepStore(float maxDiff)
 {
     return 65535 / maxDiff;
 }
-// Temporary grid data store
-uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+// Temporary grid data store, one per thread converting tiles
+thread_local uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
 
-float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
 
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-map_liquidHeaderTypeFlags liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint8 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID][8];
+thread_local uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local map_liquidHeaderTypeFlags liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint8 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID][8];
 
-int16 flight_box_max[3][3];
-int16 flight_box_min[3][3];
+thread_local int16 flight_box_max[3][3];
+thread_local int16 flight_box_min[3][3];
 
 LiquidVertexFormatType adt_MH2O::GetLiquidVertexFormat(adt_liquid_instance const* liquidInstance) const
 {
@@ -1080,8 +1092,6 @@ bool IsDeepWaterIgnored(uint32 mapId, uint32 x, uint32 y)
 
 void ExtractMaps(uint32 build)
 {
-    std::string outputFileName;
-
     printf("Extracting maps...\n");
 
     ReadMapDBC();
@@ -1093,6 +1103,7 @@ void ExtractMaps(uint32 build)
     CreateDir(output_path / "maps");
 
     printf("Convert map files\n");
+    Trinity::ThreadPool threadPool(CONF_Threads);
     for (std::size_t z = 0; z < map_ids.size(); ++z)
     {
         printf("Extract %s (" SZFMTD "/" SZFMTD ")                  \n", map_ids[z].Name.c_str(), z + 1, map_ids.size());
@@ -1104,30 +1115,40 @@ void ExtractMaps(uint32 build)
             FileChunk* mphd = wdt.GetChunk("MPHD");
             FileChunk* main = wdt.GetChunk("MAIN");
             FileChunk* maid = wdt.GetChunk("MAID");
+            std::vector<uint32> tiles;
             for (uint32 y = 0; y < WDT_MAP_SIZE; ++y)
-            {
                 for (uint32 x = 0; x < WDT_MAP_SIZE; ++x)
+                    if (main->As<wdt_MAIN>()->adt_list[y][x].flag & 0x1)
+                        tiles.push_back(y * WDT_MAP_SIZE + x);
+
+            // tiles are independent of each other, every worker converts them on its own copy of the temporary grid data
+            // and reads through the shared storage handle (CascLib serializes access to it internally)
+            std::vector<uint8> converted(tiles.size());
+            std::atomic<std::size_t> doneTiles = 0;
+            threadPool.ParallelFor(tiles.size(), CONF_Threads - 1, [&](std::size_t i)
+            {
+                uint32 y = tiles[i] / WDT_MAP_SIZE;
+                uint32 x = tiles[i] % WDT_MAP_SIZE;
+                std::string outputFileName = Trinity::StringFormat("{}/maps/{:04}_{:02}_{:02}.map", output_path.string(), map_ids[z].Id, y, x);
+                bool ignoreDeepWater = IsDeepWaterIgnored(map_ids[z].Id, y, x);
+                if (mphd && mphd->As<wdt_MPHD>()->flags & 0x200)
                 {
-                    if (!(main->As<wdt_MAIN>()->adt_list[y][x].flag & 0x1))
-                        continue;
-
-                    outputFileName = Trinity::StringFormat("{}/maps/{:04}_{:02}_{:02}.map", output_path.string(), map_ids[z].Id, y, x);
-                    bool ignoreDeepWater = IsDeepWaterIgnored(map_ids[z].Id, y, x);
-                    if (mphd && mphd->As<wdt_MPHD>()->flags & 0x200)
-                    {
-                        existingTiles[y * WDT_MAP_SIZE + x] = ConvertADT(maid->As<wdt_MAID>()->adt_files[y][x].rootADT, map_ids[z].Name, outputFileName, y, x, build, ignoreDeepWater);
-                    }
-                    else
-                    {
-                        std::string storagePath = Trinity::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].Directory, map_ids[z].Directory, x, y);
-                        existingTiles[y * WDT_MAP_SIZE + x] = ConvertADT(storagePath, map_ids[z].Name, outputFileName, y, x, build, ignoreDeepWater);
-                    }
+                    converted[i] = ConvertADT(maid->As<wdt_MAID>()->adt_files[y][x].rootADT, map_ids[z].Name, outputFileName, y, x, build, ignoreDeepWater);
+                }
+                else
+                {
+                    std::string storagePath = Trinity::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].Directory, map_ids[z].Directory, x, y);
+                    converted[i] = ConvertADT(storagePath, map_ids[z].Name, outputFileName, y, x, build, ignoreDeepWater);
                 }
 
                 // draw progress bar
+                std::size_t done = ++doneTiles;
                 if (PrintProgress)
-                    printf("Processing........................%d%%\r", (100 * (y + 1)) / WDT_MAP_SIZE);
-            }
+                    printf("Processing........................%d%%\r", int(100 * done / tiles.size()));
+            });
+
+            for (std::size_t i = 0; i < tiles.size(); ++i)
+                existingTiles[tiles[i]] = converted[i] != 0;
         }
 
         if (FILE* tileList = fopen(Trinity::StringFormat("{}/maps/{:04}.tilelist", output_path.string(), map_ids[z].Id).c_str(), "wb"))
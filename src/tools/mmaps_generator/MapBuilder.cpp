@@ -30,6 +30,7 @@
 #include <DetourNavMeshBuilder.h>
 #include <boost/filesystem/directory.hpp>
 #include <climits>
+#include <zlib.h>
 
 namespace FileExtensions
 {
@@ -67,7 +68,7 @@ namespace MMAP
 
     MapBuilder::MapBuilder(Optional<float> maxWalkableAngle, Optional<float> maxWalkableAngleNotSteep, bool skipLiquid,
         bool skipContinents, bool skipJunkMaps, bool skipBattlegrounds,
-        bool debugOutput, bool bigBaseUnit, int mapid, char const* offMeshFilePath, unsigned int threads) :
+        bool debugOutput, bool bigBaseUnit, bool compressTiles, int mapid, char const* offMeshFilePath, unsigned int threads) :
         m_terrainBuilder     (nullptr),
         m_debugOutput        (debugOutput),
         m_threads            (threads),
@@ -78,10 +79,13 @@ namespace MMAP
         m_maxWalkableAngle   (maxWalkableAngle),
         m_maxWalkableAngleNotSteep (maxWalkableAngleNotSteep),
         m_bigBaseUnit        (bigBaseUnit),
+        m_compressTiles      (compressTiles),
         m_mapid              (mapid),
         m_totalTiles         (0u),
         m_totalTilesProcessed(0u),
         m_rcContext          (nullptr),
+        m_tileInputHasher    (Trinity::StringFormat("{} {} {} {} {} {}", MMAP_VERSION, DT_NAVMESH_VERSION, skipLiquid, bigBaseUnit,
+            maxWalkableAngle.value_or(-1.0f), maxWalkableAngleNotSteep.value_or(-1.0f))),
         _cancelationToken    (false)
     {
         m_terrainBuilder = new TerrainBuilder(skipLiquid);
@@ -446,12 +450,16 @@ namespace MMAP
     /**************************************************************************/
     void TileBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
     {
-        if(shouldSkipTile(mapID, tileX, tileY))
+        TileInputHash inputHash = m_mapBuilder->m_tileInputHasher.GetTileHash(mapID, tileX, tileY, m_mapBuilder->m_offMeshConnections);
+        if (shouldSkipTile(mapID, tileX, tileY, inputHash))
         {
             ++m_mapBuilder->m_totalTilesProcessed;
             return;
         }
 
+        // a tile interrupted while being written must not be skipped by the next run
+        TileInputHasher::RemoveStoredHash(mapID, tileX, tileY);
+
         printf("%u%% [Map %04i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
 
         MeshData meshData;
@@ -491,7 +499,8 @@ namespace MMAP
         m_terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_mapBuilder->m_offMeshConnections);
 
         // build navmesh tile
-        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        if (buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh))
+            TileInputHasher::StoreHash(mapID, tileX, tileY, inputHash);
 
         ++m_mapBuilder->m_totalTilesProcessed;
     }
@@ -579,7 +588,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
+    bool TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
         MeshData &meshData, float bmin[3], float bmax[3],
         dtNavMesh* navMesh)
     {
@@ -746,7 +755,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
         rcMergePolyMeshes(m_rcContext, pmmerge, nmerge, *iv.polyMesh);
 
@@ -757,7 +766,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
         rcMergePolyMeshDetails(m_rcContext, dmmerge, nmerge, *iv.polyMeshDetail);
 
@@ -817,6 +826,7 @@ namespace MMAP
         // will hold final navmesh
         unsigned char* navData = nullptr;
         int navDataSize = 0;
+        bool written = false;
 
         do
         {
@@ -888,6 +898,28 @@ namespace MMAP
             MmapTileHeader header;
             header.usesLiquids = m_terrainBuilder->usesLiquids();
             header.size = uint32(navDataSize);
+
+            std::vector<Bytef> compressed;
+            if (m_mapBuilder->m_compressTiles)
+            {
+                // uncompressed tile size followed by the zlib stream, the server decompresses it straight into detour owned memory
+                uLongf compressedSize = compressBound(navDataSize);
+                compressed.resize(sizeof(uint32) + compressedSize);
+                uint32 tileSize = uint32(navDataSize);
+                memcpy(compressed.data(), &tileSize, sizeof(uint32));
+                if (compress2(compressed.data() + sizeof(uint32), &compressedSize, navData, navDataSize, Z_BEST_COMPRESSION) != Z_OK)
+                {
+                    printf("%s Failed to compress tile!\n", tileString.c_str());
+                    fclose(file);
+                    navMesh->removeTile(tileRef, nullptr, nullptr);
+                    break;
+                }
+
+                compressed.resize(sizeof(uint32) + compressedSize);
+                header.flags |= MMAP_TILE_FLAG_COMPRESSED;
+                header.size = uint32(compressed.size());
+            }
+
             fwrite(&header, sizeof(MmapTileHeader), 1, file);
 
             /*
@@ -896,8 +928,11 @@ namespace MMAP
             */
 
             // write data
-            fwrite(navData, sizeof(unsigned char), navDataSize, file);
-            fclose(file);
+            if (header.flags & MMAP_TILE_FLAG_COMPRESSED)
+                fwrite(compressed.data(), sizeof(Bytef), compressed.size(), file);
+            else
+                fwrite(navData, sizeof(unsigned char), navDataSize, file);
+            written = fclose(file) == 0;
 
             // now that tile is written to disk, we can unload it
             navMesh->removeTile(tileRef, nullptr, nullptr);
@@ -917,6 +952,8 @@ namespace MMAP
             iv.generateObjFile(mapID, tileX, tileY, meshData);
             iv.writeIV(mapID, tileX, tileY);
         }
+
+        return written;
     }
 
     /**************************************************************************/
@@ -1012,8 +1049,12 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
+    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, TileInputHash const& inputHash) const
     {
+        TileInputHash storedHash;
+        if (!TileInputHasher::ReadStoredHash(mapID, tileX, tileY, storedHash) || storedHash != inputHash)
+            return false;
+
         std::string fileName = Trinity::StringFormat("mmaps/{:04}{:02}{:02}.mmtile", mapID, tileY, tileX);
         FILE* file = fopen(fileName.c_str(), "rb");
         if (!file)
@@ -1031,6 +1072,9 @@ namespace MMAP
         if (header.mmapVersion != MMAP_VERSION)
             return false;
 
+        if (((header.flags & MMAP_TILE_FLAG_COMPRESSED) != 0) != m_mapBuilder->m_compressTiles)
+            return false;
+
         return true;
     }
 
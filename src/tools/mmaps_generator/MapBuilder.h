@@ -19,9 +19,10 @@
 #define _MAP_BUILDER_H
 
 #include "FlatSet.h"
+#include "MPMCQueue.h"
 #include "Optional.h"
-#include "ProducerConsumerQueue.h"
 #include "TerrainBuilder.h"
+#include "TileInputHasher.h"
 #include <DetourNavMesh.h>
 #include <Recast.h>
 #include <atomic>
@@ -101,8 +102,8 @@ namespace MMAP
             void WaitCompletion();
 
             void buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh);
-            // move map building
-            void buildMoveMapTile(uint32 mapID,
+            // move map building, returns true when the tile was written
+            bool buildMoveMapTile(uint32 mapID,
                 uint32 tileX,
                 uint32 tileY,
                 MeshData& meshData,
@@ -110,7 +111,7 @@ namespace MMAP
                 float bmax[3],
                 dtNavMesh* navMesh);
 
-            bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const;
+            bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, TileInputHash const& inputHash) const;
 
         private:
             bool m_bigBaseUnit;
@@ -136,6 +137,7 @@ namespace MMAP
                 bool skipBattlegrounds,
                 bool debugOutput,
                 bool bigBaseUnit,
+                bool compressTiles,
                 int mapid,
                 char const* offMeshFilePath,
                 unsigned int threads);
@@ -191,6 +193,7 @@ namespace MMAP
             Optional<float> m_maxWalkableAngle;
             Optional<float> m_maxWalkableAngleNotSteep;
             bool m_bigBaseUnit;
+            bool m_compressTiles;
 
             int32 m_mapid;
 
@@ -200,8 +203,10 @@ namespace MMAP
             // build performance - not really used for now
             rcContext* m_rcContext;
 
+            TileInputHasher m_tileInputHasher;
+
             std::vector<TileBuilder*> m_tileBuilders;
-            ProducerConsumerQueue<TileInfo> _queue;
+            MPMCQueue<TileInfo> _queue;
             std::atomic<bool> _cancelationToken;
     };
 }
@@ -0,0 +1,204 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TileInputHasher.h"
+#include "MapUtils.h"
+#include "Memory.h"
+#include "ModelInstance.h"
+#include "PathCommon.h"
+#include "StringFormat.h"
+#include "TerrainBuilder.h"
+#include "VMapDefinitions.h"
+#include <array>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    int32 getParentMapId(uint32 mapID)
+    {
+        if (MMAP::MapEntry const* map = Trinity::Containers::MapGetValuePtr(MMAP::sMapStore, mapID))
+            return map->ParentMapID;
+
+        return -1;
+    }
+
+    std::string getHashFileName(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        return Trinity::StringFormat("mmaps/{:04}{:02}{:02}.mmhash", mapID, tileY, tileX);
+    }
+
+    // same names as TerrainBuilder::loadMap
+    std::string getMapFileName(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        return Trinity::StringFormat("maps/{:04}_{:02}_{:02}.map", mapID, tileY, tileX);
+    }
+
+    // same names as StaticMapTree, tileX and tileY are in vmap order
+    std::string getVMapTileFileName(uint32 mapID, uint32 tileX, uint32 tileY, std::string_view extension)
+    {
+        return Trinity::StringFormat("vmaps/{:04}/{:04}_{:02}_{:02}.{}", mapID, mapID, tileY, tileX, extension);
+    }
+
+    bool fileExists(std::string const& fileName)
+    {
+        return Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(fileName.c_str(), "rb")) != nullptr;
+    }
+}
+
+namespace MMAP
+{
+    TileInputHasher::TileInputHasher(std::string settings) : m_settings(std::move(settings))
+    {
+    }
+
+    TileInputHash TileInputHasher::GetTileHash(uint32 mapID, uint32 tileX, uint32 tileY, std::span<OffMeshData const> offMeshConnections)
+    {
+        Trinity::Crypto::SHA1 sha;
+        sha.UpdateData(m_settings);
+        sha.UpdateData(Trinity::StringFormat("{} {} {}", mapID, tileX, tileY));
+
+        HashTerrain(sha, mapID, tileX, tileY);
+        // TileBuilder::buildTile loads vmaps with swapped coordinates
+        HashVMap(sha, mapID, tileY, tileX);
+
+        for (OffMeshData const& offMesh : offMeshConnections)
+        {
+            if (offMesh.MapId != mapID || offMesh.TileX != tileX || offMesh.TileY != tileY)
+                continue;
+
+            sha.UpdateData(Trinity::StringFormat("{} {} {} {} {} {} {} {} {} {}", offMesh.From[0], offMesh.From[1], offMesh.From[2],
+                offMesh.To[0], offMesh.To[1], offMesh.To[2], offMesh.Bidirectional, offMesh.Radius, offMesh.AreaId, offMesh.Flags));
+        }
+
+        sha.Finalize();
+        return sha.GetDigest();
+    }
+
+    void TileInputHasher::HashTerrain(Trinity::Crypto::SHA1& sha, uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        // TerrainBuilder::loadMap reads the edges of all 4 neighbours
+        std::array<std::pair<uint32, uint32>, 5> const tiles =
+        { {
+            { tileX, tileY }, { tileX + 1, tileY }, { tileX - 1, tileY }, { tileX, tileY + 1 }, { tileX, tileY - 1 }
+        } };
+
+        for (auto [x, y] : tiles)
+        {
+            std::string fileName = getMapFileName(mapID, x, y);
+            for (int32 parentMapId = getParentMapId(mapID); parentMapId != -1 && !fileExists(fileName); parentMapId = getParentMapId(parentMapId))
+                fileName = getMapFileName(parentMapId, x, y);
+
+            HashFile(sha, fileName);
+        }
+    }
+
+    void TileInputHasher::HashVMap(Trinity::Crypto::SHA1& sha, uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        HashFile(sha, Trinity::StringFormat("vmaps/{:04}/{:04}.vmtree", mapID, mapID));
+        HashFile(sha, getVMapTileFileName(mapID, tileX, tileY, "vmtileidx"));
+
+        uint32 tileMapId = mapID;
+        std::string fileName = getVMapTileFileName(mapID, tileX, tileY, "vmtile");
+        for (int32 parentMapId = getParentMapId(mapID); parentMapId != -1 && !fileExists(fileName); parentMapId = getParentMapId(parentMapId))
+        {
+            tileMapId = parentMapId;
+            fileName = getVMapTileFileName(parentMapId, tileX, tileY, "vmtile");
+        }
+
+        HashFile(sha, fileName);
+        if (tileMapId != mapID)
+            HashFile(sha, Trinity::StringFormat("vmaps/{:04}/{:04}.vmtree", tileMapId, tileMapId));
+
+        // models referenced by the tile
+        auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(fileName.c_str(), "rb"));
+        if (!file)
+            return;
+
+        char magic[8];
+        uint32 numSpawns = 0;
+        if (fread(magic, sizeof(magic), 1, file.get()) != 1 || memcmp(magic, VMAP::VMAP_MAGIC, sizeof(magic)) != 0
+            || fread(&numSpawns, sizeof(numSpawns), 1, file.get()) != 1)
+            return;
+
+        for (uint32 i = 0; i < numSpawns; ++i)
+        {
+            VMAP::ModelSpawn spawn;
+            if (!VMAP::ModelSpawn::readFromFile(file.get(), spawn))
+                break;
+
+            HashModelFile(sha, "vmaps/" + spawn.name);
+        }
+    }
+
+    void TileInputHasher::HashFile(Trinity::Crypto::SHA1& sha, std::string const& fileName)
+    {
+        sha.UpdateData(fileName);
+
+        auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(fileName.c_str(), "rb"));
+        if (!file)
+        {
+            sha.UpdateData("<missing>");
+            return;
+        }
+
+        std::array<uint8, 64 * 1024> buffer;
+        while (std::size_t read = fread(buffer.data(), 1, buffer.size(), file.get()))
+            sha.UpdateData(buffer.data(), read);
+    }
+
+    void TileInputHasher::HashModelFile(Trinity::Crypto::SHA1& sha, std::string const& fileName)
+    {
+        {
+            std::lock_guard lock(m_modelHashesLock);
+            if (TileInputHash const* hash = Trinity::Containers::MapGetValuePtr(m_modelHashes, fileName))
+            {
+                sha.UpdateData(*hash);
+                return;
+            }
+        }
+
+        Trinity::Crypto::SHA1 modelSha;
+        HashFile(modelSha, fileName);
+        modelSha.Finalize();
+
+        std::lock_guard lock(m_modelHashesLock);
+        sha.UpdateData(m_modelHashes.try_emplace(fileName, modelSha.GetDigest()).first->second);
+    }
+
+    bool TileInputHasher::ReadStoredHash(uint32 mapID, uint32 tileX, uint32 tileY, TileInputHash& hash)
+    {
+        auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(getHashFileName(mapID, tileX, tileY).c_str(), "rb"));
+        if (!file)
+            return false;
+
+        return fread(hash.data(), hash.size(), 1, file.get()) == 1;
+    }
+
+    void TileInputHasher::StoreHash(uint32 mapID, uint32 tileX, uint32 tileY, TileInputHash const& hash)
+    {
+        std::string fileName = getHashFileName(mapID, tileX, tileY);
+        auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(fileName.c_str(), "wb"));
+        if (!file || fwrite(hash.data(), hash.size(), 1, file.get()) != 1)
+            printf("[Map %04u] Failed to write %s, tile [%02u,%02u] will be rebuilt by the next run\n", mapID, fileName.c_str(), tileX, tileY);
+    }
+
+    void TileInputHasher::RemoveStoredHash(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        std::remove(getHashFileName(mapID, tileX, tileY).c_str());
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MMAP_TILE_INPUT_HASHER_H
+#define _MMAP_TILE_INPUT_HASHER_H
+
+#include "CryptoHash.h"
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+namespace MMAP
+{
+    struct OffMeshData;
+
+    using TileInputHash = Trinity::Crypto::SHA1::Digest;
+
+    // Hashes every input file read while building a tile (terrain of the tile and its neighbours,
+    // vmap tree, tile and models) together with the generator settings.
+    // Tiles whose stored hash matches are skipped, so interrupted runs resume and
+    // runs after a client patch only rebuild tiles whose data changed
+    class TileInputHasher
+    {
+        public:
+            // settings must contain every generator option that changes the produced tiles
+            explicit TileInputHasher(std::string settings);
+
+            TileInputHash GetTileHash(uint32 mapID, uint32 tileX, uint32 tileY, std::span<OffMeshData const> offMeshConnections);
+
+            static bool ReadStoredHash(uint32 mapID, uint32 tileX, uint32 tileY, TileInputHash& hash);
+            static void StoreHash(uint32 mapID, uint32 tileX, uint32 tileY, TileInputHash const& hash);
+            static void RemoveStoredHash(uint32 mapID, uint32 tileX, uint32 tileY);
+
+        private:
+            static void HashFile(Trinity::Crypto::SHA1& sha, std::string const& fileName);
+            void HashModelFile(Trinity::Crypto::SHA1& sha, std::string const& fileName);
+            void HashTerrain(Trinity::Crypto::SHA1& sha, uint32 mapID, uint32 tileX, uint32 tileY);
+            void HashVMap(Trinity::Crypto::SHA1& sha, uint32 mapID, uint32 tileX, uint32 tileY);
+
+            std::string m_settings;
+
+            // models are shared by many tiles
+            std::mutex m_modelHashesLock;
+            std::unordered_map<std::string, TileInputHash> m_modelHashes;
+    };
+}
+
+#endif
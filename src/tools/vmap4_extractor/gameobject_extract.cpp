@@ -21,11 +21,13 @@
 #include "ExtractorDB2LoadInfo.h"
 #include "model.h"
 #include "StringFormat.h"
+#include "ThreadPool.h"
 #include "vmapexport.h"
 #include "VMapDefinitions.h"
 #include <CascLib.h>
 #include <algorithm>
 #include <cstdio>
+#include <vector>
 #include "advstd.h"
 
 bool ExtractSingleModel(std::string& fname)
@@ -49,14 +51,14 @@ bool ExtractSingleModel(std::string& fname)
     output += "/";
     output += name;
 
-    if (FileExists(output.c_str()))
-        return true;
-
-    Model mdl(originalName);
-    if (!mdl.open())
-        return false;
+    return ExtractFileOnce(output, [&]
+    {
+        Model mdl(originalName);
+        if (!mdl.open())
+            return false;
 
-    return mdl.ConvertToVMAPModel(output.c_str());
+        return mdl.ConvertToVMAPModel(output.c_str());
+    });
 }
 
 extern std::shared_ptr<CASC::Storage> CascStorage;
@@ -105,6 +107,14 @@ void ExtractGameobjectModels()
 
     fwrite(VMAP::RAW_VMAP_MAGIC, 1, 8, model_list);
 
+    struct GameObjectModel
+    {
+        uint32 DisplayId;
+        std::string FileName;
+        bool Extracted = false;
+    };
+
+    std::vector<GameObjectModel> models;
     for (uint32 rec = 0; rec < db2.GetRecordCount(); ++rec)
     {
         DB2Record record = db2.GetRecord(rec);
@@ -115,32 +125,41 @@ void ExtractGameobjectModels()
         if (!fileId)
             continue;
 
-        std::string fileName = Trinity::StringFormat("FILE{:08X}.xxx", fileId);
-        bool result = false;
+        models.push_back({ .DisplayId = record.GetId(), .FileName = Trinity::StringFormat("FILE{:08X}.xxx", fileId) });
+    }
+
+    // models are extracted in parallel already, groups of each wmo are loaded by the thread converting its root
+    ParallelWmoGroupLoading = false;
+    WorkerPool->ParallelFor(models.size(), WorkerThreads - 1, [&](std::size_t i)
+    {
+        std::string& fileName = models[i].FileName;
         std::array<char, 4> headerRaw;
         if (!GetHeaderMagic(fileName, &headerRaw))
-            continue;
+            return;
 
         std::string_view header(headerRaw.data(), headerRaw.size());
         if (header == "REVM")
-            result = ExtractSingleWmo(fileName);
+            models[i].Extracted = ExtractSingleWmo(fileName);
         else if (header == "MD20" || header == "MD21")
-            result = ExtractSingleModel(fileName);
+            models[i].Extracted = ExtractSingleModel(fileName);
         else if (header == "BLP2")
-            continue;   // broken db2 data
+            return;     // broken db2 data
         else
             ABORT_MSG("%s header: 0x%X%X%X%X - " STRING_VIEW_FMT, fileName.c_str(),
                 uint32(headerRaw[3]), uint32(headerRaw[2]), uint32(headerRaw[1]), uint32(headerRaw[0]),
                 STRING_VIEW_FMT_ARG(header));
+    });
+    ParallelWmoGroupLoading = true;
+
+    for (GameObjectModel const& model : models)
+    {
+        if (!model.Extracted)
+            continue;
 
-        if (result)
-        {
-            uint32 displayId = record.GetId();
-            uint32 path_length = fileName.length();
-            fwrite(&displayId, sizeof(uint32), 1, model_list);
-            fwrite(&path_length, sizeof(uint32), 1, model_list);
-            fwrite(fileName.c_str(), sizeof(char), path_length, model_list);
-        }
+        uint32 path_length = model.FileName.length();
+        fwrite(&model.DisplayId, sizeof(uint32), 1, model_list);
+        fwrite(&path_length, sizeof(uint32), 1, model_list);
+        fwrite(model.FileName.c_str(), sizeof(char), path_length, model_list);
     }
 
     fclose(model_list);
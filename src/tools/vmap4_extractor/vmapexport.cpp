@@ -25,6 +25,7 @@
 #include "MapDefines.h"
 #include "MapUtils.h"
 #include "StringFormat.h"
+#include "ThreadPool.h"
 #include "Util.h"
 #include "VMapDefinitions.h"
 #include "wdtfile.h"
@@ -34,8 +35,11 @@
 #include <boost/filesystem/operations.hpp>
 #include <algorithm>
 #include <fstream>
+#include <future>
 #include <list>
 #include <map>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -75,6 +79,10 @@ char const* CascRegion = "eu";
 bool UseRemoteCasc = false;
 uint32 DbcLocale = 0;
 std::unordered_map<std::string, WMODoodadData> WmoDoodads;
+std::mutex WmoDoodadsLock;
+uint32 WorkerThreads = std::max(std::thread::hardware_concurrency(), 1u);
+std::unique_ptr<Trinity::ThreadPool> WorkerPool;
+bool ParallelWmoGroupLoading = true;
 
 // Constants
 
@@ -192,29 +200,32 @@ bool FileExists(char const* file)
     return false;
 }
 
-bool ExtractSingleWmo(std::string& fname)
-{
-    // Copy files from archive
-    std::string originalName = fname;
-
-    char* plain_name = GetPlainName(&fname[0]);
-    NormalizeFileName(plain_name, strlen(plain_name));
-    std::string szLocalFile = Trinity::StringFormat("{}/{}", szWorkDirWmo, plain_name);
+std::mutex ExtractedFilesLock;
+std::unordered_map<std::string, std::shared_future<bool>> ExtractedFiles;
 
-    if (FileExists(szLocalFile.c_str()))
-        return true;
+bool ExtractFileOnce(std::string const& localFile, std::function<bool()> const& extract)
+{
+    std::promise<bool> promise;
+    {
+        std::unique_lock lock(ExtractedFilesLock);
+        auto [itr, inserted] = ExtractedFiles.try_emplace(localFile);
+        if (!inserted)
+        {
+            std::shared_future<bool> result = itr->second;
+            lock.unlock();
+            return result.get();
+        }
 
-    int p = 0;
-    // Select root wmo files
-    char const* rchr = strrchr(plain_name, '_');
-    if (rchr != nullptr)
-        for (int i = 0; i < 4; ++i)
-            if (isdigit(rchr[i]))
-                p++;
+        itr->second = promise.get_future().share();
+    }
 
-    if (p == 3)
-        return true;
+    bool result = FileExists(localFile.c_str()) || extract();
+    promise.set_value(result);
+    return result;
+}
 
+bool ConvertWmo(std::string const& originalName, char const* plain_name, std::string const& szLocalFile)
+{
     bool file_ok = true;
     WMORoot froot(originalName);
     if (!froot.open())
@@ -229,7 +240,12 @@ bool ExtractSingleWmo(std::string& fname)
         return false;
     }
     froot.ConvertToVMAPRootWmo(output);
-    WMODoodadData& doodads = WmoDoodads[plain_name];
+    WMODoodadData* doodadsPtr;
+    {
+        std::lock_guard lock(WmoDoodadsLock);
+        doodadsPtr = &WmoDoodads[plain_name];
+    }
+    WMODoodadData& doodads = *doodadsPtr;
     std::swap(doodads, froot.DoodadData);
     int Wmo_nVertices = 0;
     uint32 groupCount = 0;
@@ -237,25 +253,33 @@ bool ExtractSingleWmo(std::string& fname)
     std::vector<WMOGroup> groups;
     groups.reserve(froot.groupFileDataIDs.size());
     for (std::size_t i = 0; i < froot.groupFileDataIDs.size(); ++i)
+        groups.emplace_back(Trinity::StringFormat("FILE{:08X}.xxx", froot.groupFileDataIDs[i]));
+
+    // group files are parsed independently of each other, only writing them into the output has to happen in order
+    std::vector<uint8> opened(groups.size());
+    WorkerPool->ParallelFor(groups.size(), ParallelWmoGroupLoading ? WorkerThreads - 1 : 0, [&](std::size_t i)
     {
-        std::string s = Trinity::StringFormat("FILE{:08X}.xxx", froot.groupFileDataIDs[i]);
-        WMOGroup& fgroup = groups.emplace_back(s);
-        if (!fgroup.open(&froot))
-        {
-            printf("Could not open all Group file for: %s\n", plain_name);
-            file_ok = false;
-            break;
-        }
+        opened[i] = groups[i].open(&froot);
+    });
+
+    // keep converting up to and including the first group that failed to load
+    std::size_t groupsToConvert = groups.size();
+    if (auto failed = std::ranges::find(opened, 0); failed != opened.end())
+    {
+        printf("Could not open all Group file for: %s\n", plain_name);
+        file_ok = false;
+        groupsToConvert = std::distance(opened.begin(), failed) + 1;
     }
 
-    for (WMOGroup& fgroup : groups)
+    for (std::size_t i = 0; i < groupsToConvert; ++i)
     {
+        WMOGroup& fgroup = groups[i];
         if (fgroup.ShouldSkip(&froot))
             continue;
 
         if (fgroup.mogpFlags2 & 0x80
             && fgroup.parentOrFirstChildSplitGroupIndex >= 0
-            && size_t(fgroup.parentOrFirstChildSplitGroupIndex) < groups.size())
+            && size_t(fgroup.parentOrFirstChildSplitGroupIndex) < groupsToConvert)
             fgroup.groupWMOID = groups[fgroup.parentOrFirstChildSplitGroupIndex].groupWMOID;
 
         Wmo_nVertices += fgroup.ConvertToVMAPGroupWmo(output, preciseVectorData);
@@ -285,6 +309,29 @@ bool ExtractSingleWmo(std::string& fname)
     return true;
 }
 
+bool ExtractSingleWmo(std::string& fname)
+{
+    // Copy files from archive
+    std::string originalName = fname;
+
+    char* plain_name = GetPlainName(&fname[0]);
+    NormalizeFileName(plain_name, strlen(plain_name));
+
+    int p = 0;
+    // Select root wmo files
+    char const* rchr = strrchr(plain_name, '_');
+    if (rchr != nullptr)
+        for (int i = 0; i < 4; ++i)
+            if (isdigit(rchr[i]))
+                p++;
+
+    if (p == 3)
+        return true;
+
+    std::string szLocalFile = Trinity::StringFormat("{}/{}", szWorkDirWmo, plain_name);
+    return ExtractFileOnce(szLocalFile, [&] { return ConvertWmo(originalName, plain_name, szLocalFile); });
+}
+
 bool IsLiquidIgnored(uint32 liquidTypeId)
 {
     if (LiquidTypeEntry const* liquidType = Trinity::Containers::MapGetValuePtr(LiquidTypes, liquidTypeId))
@@ -518,6 +565,13 @@ bool processArgv(int argc, char ** argv, const char *versionString)
             else
                 result = false;
         }
+        else if (strcmp("-t", argv[i]) == 0)
+        {
+            if (i + 1 < argc && strlen(argv[i + 1]))
+                WorkerThreads = std::max(atoi(argv[++i]), 1);
+            else
+                result = false;
+        }
         else if (strcmp("-dl", argv[i]) == 0)
         {
             if (i + 1 < argc && strlen(argv[i + 1]))
@@ -547,6 +601,7 @@ bool processArgv(int argc, char ** argv, const char *versionString)
         printf("   -p  <product>: which installed product to open (wow/wowt/wow_beta)\n");
         printf("   -c  use remote casc\n");
         printf("   -r  set remote casc region - standard: eu\n");
+        printf("   -t  <threads>: number of threads extracting models - standard: all hardware threads\n");
         printf("   -dl dbc locale\n");
         printf("   -? : This message.\n");
     }
@@ -603,6 +658,8 @@ int main(int argc, char ** argv)
     if (!RetardCheck())
         return 1;
 
+    WorkerPool = std::make_unique<Trinity::ThreadPool>(WorkerThreads);
+
     // some simple check if working dir is dirty
     boost::filesystem::path sdir_bin = boost::filesystem::path(szWorkDirWmo) / "dir_bin";
     {
@@ -668,6 +725,7 @@ int main(int argc, char ** argv)
         ParsMapFiles();
     }
 
+    WorkerPool.reset();
     CascStorage.reset();
 
     printf("\n");
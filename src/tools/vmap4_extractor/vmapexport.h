@@ -19,9 +19,17 @@
 #define VMAPEXPORT_H
 
 #include "Define.h"
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
+namespace Trinity
+{
+class ThreadPool;
+}
+
 // flags of each spawn
 enum ModelInstanceFlags
 {
@@ -40,11 +48,18 @@ struct WMODoodadData;
 
 extern const char * szWorkDirWmo;
 extern std::unordered_map<std::string, WMODoodadData> WmoDoodads;
+extern std::mutex WmoDoodadsLock;
+extern uint32 WorkerThreads;
+extern std::unique_ptr<Trinity::ThreadPool> WorkerPool;
+extern bool ParallelWmoGroupLoading;
 
 uint32 GenerateUniqueObjectId(uint32 clientId, uint16 clientDoodadId, bool isWmo);
 
 bool FileExists(const char * file);
 
+// Calls extract only for the first caller asking for localFile, everyone else gets its result (waiting for it if it is still being extracted by another thread)
+bool ExtractFileOnce(std::string const& localFile, std::function<bool()> const& extract);
+
 bool ExtractSingleWmo(std::string& fname);
 bool ExtractSingleModel(std::string& fname);
 
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "BoundingIntervalHierarchy.h"
+#include <set>
+
+namespace
+{
+struct BoxBounds
+{
+    void operator()(G3D::AABox const& box, G3D::AABox& out) const { out = box; }
+};
+
+std::vector<G3D::AABox> MakeBoxes()
+{
+    std::vector<G3D::AABox> boxes;
+    for (int x = 0; x < 10; ++x)
+        for (int y = 0; y < 10; ++y)
+            boxes.emplace_back(G3D::Vector3(x * 10.0f, y * 10.0f, 0.0f), G3D::Vector3(x * 10.0f + 2.0f, y * 10.0f + 2.0f, 2.0f));
+    return boxes;
+}
+}
+
+TEST_CASE("Box query reports every overlapping primitive once", "[BIH]")
+{
+    std::vector<G3D::AABox> boxes = MakeBoxes();
+    BIH tree;
+    tree.build(boxes, BoxBounds());
+
+    G3D::AABox query(G3D::Vector3(15.0f, 15.0f, -1.0f), G3D::Vector3(41.0f, 31.0f, 1.0f));
+    std::vector<uint32> found;
+    auto collect = [&](uint32 entry) { found.push_back(entry); };
+    tree.intersectBox(query, collect);
+
+    std::set<uint32> unique(found.begin(), found.end());
+    REQUIRE(unique.size() == found.size());
+
+    for (uint32 i = 0; i < boxes.size(); ++i)
+        if (boxes[i].intersects(query))
+            REQUIRE(unique.contains(i));
+}
+
+TEST_CASE("Box query outside of the tree reports nothing", "[BIH]")
+{
+    std::vector<G3D::AABox> boxes = MakeBoxes();
+    BIH tree;
+    tree.build(boxes, BoxBounds());
+
+    std::vector<uint32> found;
+    auto collect = [&](uint32 entry) { found.push_back(entry); };
+    tree.intersectBox(G3D::AABox(G3D::Vector3(500.0f, 500.0f, 0.0f), G3D::Vector3(510.0f, 510.0f, 1.0f)), collect);
+    REQUIRE(found.empty());
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "BoundingIntervalHierarchyWrapper.h"
+#include <set>
+
+namespace
+{
+struct TestModel
+{
+    G3D::AABox Bounds;
+};
+
+struct TestModelBounds
+{
+    static void getBounds(TestModel const& model, G3D::AABox& out) { out = model.Bounds; }
+    void operator()(TestModel const* model, G3D::AABox& out) const { getBounds(*model, out); }
+};
+
+std::set<TestModel const*> FindInBox(BIHWrap<TestModel, TestModelBounds>& tree, G3D::AABox const& box)
+{
+    std::set<TestModel const*> found;
+    // box queries may report models of overlapping tree leaves
+    auto collect = [&](TestModel const& model)
+    {
+        if (model.Bounds.intersects(box))
+            found.insert(&model);
+    };
+    tree.intersectBox(box, collect);
+    return found;
+}
+}
+
+TEST_CASE("Models are found before and after balancing", "[BIHWrap]")
+{
+    TestModel first{ G3D::AABox(G3D::Vector3(0.0f, 0.0f, 0.0f), G3D::Vector3(2.0f, 2.0f, 2.0f)) };
+    TestModel second{ G3D::AABox(G3D::Vector3(10.0f, 0.0f, 0.0f), G3D::Vector3(12.0f, 2.0f, 2.0f)) };
+    G3D::AABox const query(G3D::Vector3(-1.0f, -1.0f, -1.0f), G3D::Vector3(5.0f, 5.0f, 5.0f));
+
+    BIHWrap<TestModel, TestModelBounds> tree;
+    tree.insert(first);
+    tree.insert(second);
+    REQUIRE(!tree.isBalanced());
+    REQUIRE(FindInBox(tree, query) == std::set<TestModel const*>{ &first });
+
+    tree.balance();
+    REQUIRE(tree.isBalanced());
+    REQUIRE(FindInBox(tree, query) == std::set<TestModel const*>{ &first });
+
+    // moving a model is a remove followed by an insert
+    tree.remove(second);
+    second.Bounds = G3D::AABox(G3D::Vector3(3.0f, 3.0f, 0.0f), G3D::Vector3(4.0f, 4.0f, 2.0f));
+    tree.insert(second);
+    REQUIRE(FindInBox(tree, query) == std::set<TestModel const*>{ &first, &second });
+
+    tree.remove(first);
+    REQUIRE(FindInBox(tree, query) == std::set<TestModel const*>{ &second });
+
+    tree.balance();
+    REQUIRE(FindInBox(tree, query) == std::set<TestModel const*>{ &second });
+}
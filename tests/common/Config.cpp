@@ -116,3 +116,43 @@ TEST_CASE("Environment variables", "[Config]")
 
     std::remove(filePath.c_str());
 }
+
+TEST_CASE("Reload", "[Config]")
+{
+    std::string filePath = CreateConfigWithMap({ { "Reload.Int", "5" }, { "Reload.Bool", "0" } });
+
+    std::string err;
+    REQUIRE(sConfigMgr->LoadInitial(filePath, std::vector<std::string>(), err));
+
+    ConfigValue<int32> intValue("Reload.Int", 1);
+    ConfigValue<bool> boolValue("Reload.Bool", true);
+    REQUIRE(intValue.Get() == 5);
+    REQUIRE(boolValue.Get() == false);
+
+    uint32 version = sConfigMgr->GetVersion();
+    {
+        std::ofstream iniStream(filePath, std::ios::trunc);
+        iniStream << "[test]\nReload.Int = 6\n";
+    }
+
+    std::vector<std::string> errors;
+    REQUIRE(sConfigMgr->Reload(errors));
+    REQUIRE(sConfigMgr->GetVersion() != version);
+
+    SECTION("Handles resolve again after reload")
+    {
+        REQUIRE(intValue.Get() == 6);
+        REQUIRE(boolValue.Get() == true);
+    }
+
+    SECTION("Failed reload keeps the values")
+    {
+        std::remove(filePath.c_str());
+        version = sConfigMgr->GetVersion();
+        REQUIRE(!sConfigMgr->Reload(errors));
+        REQUIRE(sConfigMgr->GetVersion() == version);
+        REQUIRE(sConfigMgr->GetIntDefault("Reload.Int", 1) == 6);
+    }
+
+    std::remove(filePath.c_str());
+}
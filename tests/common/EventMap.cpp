@@ -376,6 +376,65 @@ TEST_CASE("Delay grouped events", "[EventMap]")
     REQUIRE(eventMap.GetTimeUntilEvent(EVENT_3) == 4s);
 }
 
+TEST_CASE("Execution order", "[EventMap]")
+{
+    EventMap eventMap;
+
+    SECTION("Events are executed by time, not by schedule order")
+    {
+        eventMap.ScheduleEvent(EVENT_3, 3s);
+        eventMap.ScheduleEvent(EVENT_1, 1s);
+        eventMap.ScheduleEvent(EVENT_2, 2s);
+
+        eventMap.Update(3000);
+
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+        REQUIRE(eventMap.Empty());
+    }
+
+    SECTION("Events with the same time are executed in schedule order")
+    {
+        eventMap.ScheduleEvent(EVENT_2, 1s);
+        eventMap.ScheduleEvent(EVENT_1, 1s);
+        eventMap.ScheduleEvent(EVENT_3, 1s);
+
+        eventMap.Update(1000);
+
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+    }
+
+    SECTION("Delayed group events are executed after other events with the same time")
+    {
+        eventMap.ScheduleEvent(EVENT_1, 1s, GROUP_1);
+        eventMap.ScheduleEvent(EVENT_2, 2s);
+        eventMap.ScheduleEvent(EVENT_3, 1s, GROUP_1);
+
+        eventMap.DelayEvents(1s, GROUP_1);
+        eventMap.Update(2000);
+
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+    }
+
+    SECTION("More events than inline storage")
+    {
+        for (uint32 i = 20; i > 0; --i)
+            eventMap.ScheduleEvent(i, Milliseconds(i * 100));
+
+        eventMap.Update(2000);
+
+        for (uint32 i = 1; i <= 20; ++i)
+            REQUIRE(eventMap.ExecuteEvent() == i);
+
+        REQUIRE(eventMap.Empty());
+    }
+}
+
 TEST_CASE("Reset map", "[EventMap]")
 {
     EventMap eventMap;
@@ -0,0 +1,130 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "FlatHashMap.h"
+#include <string>
+
+TEST_CASE("Insertion", "[FlatHashMap]")
+{
+    Trinity::Containers::FlatHashSet<int> flat;
+
+    REQUIRE(flat.insert(5).second == true);
+    REQUIRE(flat.insert(3).second == true);
+    REQUIRE(flat.insert(9).second == true);
+
+    REQUIRE(flat.insert(5).second == false);
+    REQUIRE(flat.insert(3).second == false);
+
+    REQUIRE(flat.size() == 3);
+    REQUIRE(flat.contains(5));
+    REQUIRE(flat.contains(9));
+    REQUIRE(!flat.contains(7));
+    REQUIRE(flat.find(7) == flat.end());
+    REQUIRE(*flat.find(3) == 3);
+}
+
+TEST_CASE("Mapped values", "[FlatHashMap]")
+{
+    Trinity::Containers::FlatHashMap<int, std::string> flat;
+
+    flat[1] = "one";
+    REQUIRE(flat.try_emplace(2, "two").second == true);
+    REQUIRE(flat.try_emplace(2, "second two").second == false);
+    REQUIRE(flat.emplace(3, "three").second == true);
+
+    REQUIRE(flat.size() == 3);
+    REQUIRE(flat[1] == "one");
+    REQUIRE(flat.find(2)->second == "two");
+    REQUIRE(flat[4].empty());
+    REQUIRE(flat.size() == 4);
+}
+
+TEST_CASE("Erase", "[FlatHashMap]")
+{
+    Trinity::Containers::FlatHashSet<int> flat;
+    for (int i = 0; i < 100; ++i)
+        flat.insert(i);
+
+    REQUIRE(flat.erase(50) == 1);
+    REQUIRE(flat.erase(50) == 0);
+    REQUIRE(flat.size() == 99);
+    REQUIRE(!flat.contains(50));
+
+    // erasing leaves tombstones that keep probe sequences of other keys intact
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(flat.contains(i) == (i != 50));
+
+    REQUIRE(flat.insert(50).second == true);
+    REQUIRE(flat.size() == 100);
+}
+
+TEST_CASE("Erase while iterating", "[FlatHashMap]")
+{
+    Trinity::Containers::FlatHashMap<int, int> flat;
+    for (int i = 0; i < 1000; ++i)
+        flat[i] = i * 2;
+
+    std::size_t visited = 0;
+    for (auto itr = flat.begin(); itr != flat.end();)
+    {
+        ++visited;
+        if (itr->first % 2)
+            itr = flat.erase(itr);
+        else
+            ++itr;
+    }
+
+    REQUIRE(visited == 1000);
+    REQUIRE(flat.size() == 500);
+    for (auto const& [key, value] : flat)
+    {
+        REQUIRE(key % 2 == 0);
+        REQUIRE(value == key * 2);
+    }
+}
+
+TEST_CASE("Rehash", "[FlatHashMap]")
+{
+    Trinity::Containers::FlatHashSet<int> flat;
+    flat.reserve(100);
+    std::size_t capacity = flat.capacity();
+    REQUIRE(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i)
+        flat.insert(i);
+
+    REQUIRE(flat.capacity() == capacity);
+
+    // churn must not grow the table, tombstones are dropped by rehashing in place
+    for (int i = 100; i < 100000; ++i)
+    {
+        flat.erase(i - 100);
+        flat.insert(i);
+    }
+
+    REQUIRE(flat.size() == 100);
+    REQUIRE(flat.capacity() <= capacity * 2);
+    for (int i = 99900; i < 100000; ++i)
+        REQUIRE(flat.contains(i));
+
+    flat.clear();
+    REQUIRE(flat.empty());
+    REQUIRE(flat.begin() == flat.end());
+    REQUIRE(!flat.contains(99950));
+}
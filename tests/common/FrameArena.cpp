@@ -0,0 +1,67 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "FrameArena.h"
+
+TEST_CASE("Allocations are aligned and reused after reset", "[FrameArena]")
+{
+    Trinity::FrameArena arena(256);
+
+    void* first = arena.Allocate(3, 1);
+    void* aligned = arena.Allocate(16, 16);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 16 == 0);
+    REQUIRE(arena.GetAllocatedBytes() == 19);
+
+    // does not fit into a block
+    void* big = arena.Allocate(1024, 8);
+    REQUIRE(big != nullptr);
+
+    arena.Reset();
+    REQUIRE(arena.GetAllocatedBytes() == 0);
+    REQUIRE(arena.Allocate(3, 1) == first);
+}
+
+TEST_CASE("Allocator uses arena of current scope", "[FrameArena]")
+{
+    Trinity::FrameArena arena;
+
+    Trinity::FrameVector<int> heapVector;
+    heapVector.push_back(1);
+    REQUIRE(arena.GetAllocatedBytes() == 0);
+
+    {
+        Trinity::FrameArenaScope scope(arena);
+        REQUIRE(Trinity::FrameArena::GetCurrent() == &arena);
+
+        Trinity::FrameVector<int> frameVector;
+        for (int i = 0; i < 100; ++i)
+            frameVector.push_back(i);
+
+        Trinity::FrameUnorderedSet<int> frameSet(frameVector.begin(), frameVector.end());
+        REQUIRE(frameSet.size() == 100);
+        REQUIRE(arena.GetAllocatedBytes() > 100 * sizeof(int));
+
+        // containers created before the scope keep using the heap
+        heapVector.push_back(2);
+    }
+
+    REQUIRE(Trinity::FrameArena::GetCurrent() == nullptr);
+    REQUIRE(arena.GetAllocatedBytes() == 0);
+    REQUIRE(heapVector.size() == 2);
+}
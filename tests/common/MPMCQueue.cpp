@@ -0,0 +1,125 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MPMCQueue.h"
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Bounded capacity", "[MPMCQueue]")
+{
+    MPMCQueue<int> queue(4);
+
+    REQUIRE(queue.Empty());
+    REQUIRE(queue.TryPush(1));
+    REQUIRE(queue.TryPush(2));
+    REQUIRE(queue.TryPush(3));
+    REQUIRE(queue.TryPush(4));
+    REQUIRE(!queue.TryPush(5));
+    REQUIRE(queue.Size() == 4);
+
+    int value = 0;
+    REQUIRE(queue.Pop(value));
+    REQUIRE(value == 1);
+    REQUIRE(queue.TryPush(5));
+
+    for (int expected : { 2, 3, 4, 5 })
+    {
+        REQUIRE(queue.Pop(value));
+        REQUIRE(value == expected);
+    }
+
+    REQUIRE(!queue.Pop(value));
+    REQUIRE(queue.Empty());
+}
+
+TEST_CASE("Cancel wakes up consumers", "[MPMCQueue]")
+{
+    MPMCQueue<int*> queue(8);
+    queue.Push(new int(1));
+    queue.Push(new int(2));
+
+    int* value = nullptr;
+    queue.WaitAndPop(value);
+    REQUIRE(value);
+    REQUIRE(*value == 1);
+    delete value;
+    value = nullptr;
+
+    int* second = nullptr;
+    std::thread consumer([&]
+    {
+        int* first = nullptr;
+        queue.WaitAndPop(first);
+        delete first;
+
+        queue.WaitAndPop(second);
+    });
+
+    queue.Cancel();
+    consumer.join();
+
+    REQUIRE(!second);
+    REQUIRE(!queue.Pop(value));
+}
+
+TEST_CASE("Multiple producers and consumers", "[MPMCQueue]")
+{
+    constexpr int ProducerCount = 4;
+    constexpr int ConsumerCount = 4;
+    constexpr int ItemsPerProducer = 20000;
+
+    MPMCQueue<int> queue(64);
+    std::atomic<long long> sum = 0;
+    std::atomic<int> consumed = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < ConsumerCount; ++i)
+    {
+        threads.emplace_back([&]
+        {
+            while (true)
+            {
+                int value = 0;
+                queue.WaitAndPop(value);
+                if (value < 0)
+                    return;
+
+                sum += value;
+                ++consumed;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < ProducerCount; ++i)
+        producers.emplace_back([&] { for (int value = 1; value <= ItemsPerProducer; ++value) queue.Push(value); });
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    for (int i = 0; i < ConsumerCount; ++i)
+        queue.Push(-1);
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    REQUIRE(consumed == ProducerCount * ItemsPerProducer);
+    REQUIRE(sum == ProducerCount * (long long)ItemsPerProducer * (ItemsPerProducer + 1) / 2);
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "NavMeshPathCache.h"
+
+using MMAP::NavMeshPathCache;
+
+TEST_CASE("Cached corridors are found by poly pair and filter", "[NavMeshPathCache]")
+{
+    NavMeshPathCache cache;
+    dtPolyRef const corridor[] = { 1, 2, 3, 4 };
+    cache.Store({ .StartPoly = 1, .EndPoly = 4, .IncludeFlags = 0x1 }, corridor, 4);
+
+    dtPolyRef path[8] = { };
+    uint32 pathSize = 0;
+    REQUIRE(cache.Find({ .StartPoly = 1, .EndPoly = 4, .IncludeFlags = 0x1 }, path, pathSize, 8));
+    REQUIRE(pathSize == 4);
+    REQUIRE(path[3] == 4);
+
+    REQUIRE(!cache.Find({ .StartPoly = 1, .EndPoly = 4, .IncludeFlags = 0x3 }, path, pathSize, 8));
+    REQUIRE(!cache.Find({ .StartPoly = 4, .EndPoly = 1, .IncludeFlags = 0x1 }, path, pathSize, 8));
+
+    // does not fit into the output
+    REQUIRE(!cache.Find({ .StartPoly = 1, .EndPoly = 4, .IncludeFlags = 0x1 }, path, pathSize, 3));
+
+    cache.Clear();
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(!cache.Find({ .StartPoly = 1, .EndPoly = 4, .IncludeFlags = 0x1 }, path, pathSize, 8));
+}
+
+TEST_CASE("Least recently used corridor is evicted", "[NavMeshPathCache]")
+{
+    NavMeshPathCache cache(2);
+    dtPolyRef const corridor[] = { 1, 2 };
+    cache.Store({ .StartPoly = 1, .EndPoly = 2 }, corridor, 2);
+    cache.Store({ .StartPoly = 3, .EndPoly = 4 }, corridor, 2);
+
+    dtPolyRef path[2];
+    uint32 pathSize = 0;
+    REQUIRE(cache.Find({ .StartPoly = 1, .EndPoly = 2 }, path, pathSize, 2));
+
+    cache.Store({ .StartPoly = 5, .EndPoly = 6 }, corridor, 2);
+    REQUIRE(cache.GetSize() == 2);
+    REQUIRE(cache.Find({ .StartPoly = 1, .EndPoly = 2 }, path, pathSize, 2));
+    REQUIRE(!cache.Find({ .StartPoly = 3, .EndPoly = 4 }, path, pathSize, 2));
+    REQUIRE(cache.Find({ .StartPoly = 5, .EndPoly = 6 }, path, pathSize, 2));
+}
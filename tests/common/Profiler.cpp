@@ -0,0 +1,97 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Profiler.h"
+#include <thread>
+
+TEST_CASE("Zones are only recorded while enabled", "[Profiler]")
+{
+    sProfiler->Stop();
+    {
+        TC_PROFILE_ZONE("disabled");
+    }
+
+    sProfiler->Start();
+    REQUIRE(sProfiler->GetRecordedZoneCount() == 0);
+    {
+        TC_PROFILE_ZONE("outer");
+        TC_PROFILE_ZONE("inner");
+    }
+    std::thread([] { TC_PROFILE_ZONE("other thread"); }).join();
+    sProfiler->Stop();
+
+    REQUIRE(sProfiler->GetRecordedZoneCount() == 3);
+
+    std::string trace = sProfiler->BuildChromeTrace();
+    REQUIRE(trace.find(R"("name":"outer","ph":"X")") != std::string::npos);
+    REQUIRE(trace.find(R"("name":"inner","ph":"X")") != std::string::npos);
+    REQUIRE(trace.find(R"("name":"other thread","ph":"X")") != std::string::npos);
+    REQUIRE(trace.find("disabled") == std::string::npos);
+}
+
+TEST_CASE("Ring buffer keeps the most recent zones", "[Profiler]")
+{
+    sProfiler->Start();
+    for (std::size_t i = 0; i < Trinity::Profiler::EventsPerThread + 10; ++i)
+    {
+        TC_PROFILE_ZONE("zone");
+    }
+    sProfiler->Stop();
+
+    REQUIRE(sProfiler->GetRecordedZoneCount() == Trinity::Profiler::EventsPerThread);
+}
+
+TEST_CASE("Trace export can be limited to recent zones", "[Profiler]")
+{
+    using Clock = Trinity::Profiler::Clock;
+
+    sProfiler->Start();
+    Clock::time_point now = Clock::now();
+    sProfiler->RecordZone("old", now, now + std::chrono::seconds(1));
+    sProfiler->RecordZone("recent", now + std::chrono::seconds(10), now + std::chrono::seconds(11));
+
+    std::string trace = sProfiler->BuildChromeTrace(now + std::chrono::seconds(5));
+    sProfiler->Stop();
+
+    REQUIRE(trace.find(R"("name":"recent","ph":"X")") != std::string::npos);
+    REQUIRE(trace.find("old") == std::string::npos);
+}
+
+TEST_CASE("Zone summaries add up zones of the same name", "[Profiler]")
+{
+    using Clock = Trinity::Profiler::Clock;
+
+    sProfiler->Start();
+    Clock::time_point now = Clock::now();
+    sProfiler->RecordZone("old", now, now + std::chrono::seconds(1));
+    sProfiler->RecordZone("short", now + std::chrono::seconds(10), now + std::chrono::seconds(11));
+    sProfiler->RecordZone("long", now + std::chrono::seconds(10), now + std::chrono::seconds(12));
+    sProfiler->RecordZone("short", now + std::chrono::seconds(12), now + std::chrono::seconds(14));
+
+    std::vector<Trinity::ProfilerZoneSummary> zones = sProfiler->SummarizeZones(now + std::chrono::seconds(5));
+    sProfiler->Stop();
+
+    REQUIRE(zones.size() == 2);
+    REQUIRE(std::string_view(zones[0].Name) == "short");
+    REQUIRE(zones[0].Count == 2);
+    REQUIRE(zones[0].Total == std::chrono::seconds(3));
+    REQUIRE(zones[0].Max == std::chrono::seconds(2));
+    REQUIRE(std::string_view(zones[1].Name) == "long");
+    REQUIRE(zones[1].Count == 1);
+}
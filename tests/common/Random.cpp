@@ -0,0 +1,43 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Random.h"
+#include <array>
+
+TEST_CASE("Seeded random sequences repeat", "[Random]")
+{
+    auto roll = []
+    {
+        std::array<uint32, 16> values;
+        for (uint32& value : values)
+            value = urand(0, 1000000);
+        return values;
+    };
+
+    SetRandomSeed(12345);
+    std::array<uint32, 16> first = roll();
+    float firstFloat = frand(0.0f, 1.0f);
+
+    SetRandomSeed(12345);
+    REQUIRE(roll() == first);
+    REQUIRE(frand(0.0f, 1.0f) == firstFloat);
+
+    SetRandomSeed(54321);
+    REQUIRE(roll() != first);
+}
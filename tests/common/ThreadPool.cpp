@@ -0,0 +1,64 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ThreadPool.h"
+#include <atomic>
+#include <vector>
+
+TEST_CASE("Submit returns the result of the work", "[ThreadPool]")
+{
+    Trinity::ThreadPool pool(2);
+
+    std::future<int> result = pool.Submit([] { return 42; });
+    REQUIRE(result.get() == 42);
+
+    pool.Join();
+}
+
+TEST_CASE("ParallelFor visits every index once", "[ThreadPool]")
+{
+    Trinity::ThreadPool pool(4);
+
+    SECTION("More indexes than threads")
+    {
+        std::vector<std::atomic<int>> visits(1000);
+        pool.ParallelFor(visits.size(), 4, [&](std::size_t i) { ++visits[i]; });
+
+        for (std::atomic<int> const& visit : visits)
+            REQUIRE(visit == 1);
+    }
+
+    SECTION("Without helpers")
+    {
+        std::vector<int> visits(10);
+        pool.ParallelFor(visits.size(), 0, [&](std::size_t i) { ++visits[i]; });
+
+        for (int visit : visits)
+            REQUIRE(visit == 1);
+    }
+
+    SECTION("Nothing to do")
+    {
+        bool called = false;
+        pool.ParallelFor(0, 4, [&](std::size_t) { called = true; });
+        REQUIRE(!called);
+    }
+
+    pool.Join();
+}
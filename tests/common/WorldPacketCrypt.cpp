@@ -0,0 +1,60 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "WorldPacketCrypt.h"
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("WorldPacketCrypt: Batch encryption matches single packets")
+{
+    WorldPacketCrypt::Key key;
+    for (std::size_t i = 0; i < key.size(); ++i)
+        key[i] = uint8(i * 7 + 3);
+
+    WorldPacketCrypt single;
+    WorldPacketCrypt batched;
+    single.Init(key);
+    batched.Init(key);
+
+    std::vector<std::vector<uint8>> singlePackets = { std::vector<uint8>(4, 0x11), std::vector<uint8>(100, 0x22), std::vector<uint8>(1500, 0x33) };
+    std::vector<std::vector<uint8>> batchedPackets = singlePackets;
+    std::vector<std::array<uint8, Trinity::Crypto::AES::TAG_SIZE_BYTES>> singleTags(singlePackets.size());
+    std::vector<std::array<uint8, Trinity::Crypto::AES::TAG_SIZE_BYTES>> batchedTags(singlePackets.size());
+
+    std::vector<WorldPacketCrypt::SendBatchEntry> batch;
+    for (std::size_t i = 0; i < singlePackets.size(); ++i)
+    {
+        REQUIRE(single.EncryptSend(singlePackets[i].data(), singlePackets[i].size(), *reinterpret_cast<Trinity::Crypto::AES::Tag*>(singleTags[i].data())));
+        batch.push_back({ .Data = batchedPackets[i], .Tag = reinterpret_cast<Trinity::Crypto::AES::Tag*>(batchedTags[i].data()) });
+    }
+
+    REQUIRE(batched.EncryptSend(batch));
+
+    REQUIRE(singlePackets == batchedPackets);
+    REQUIRE(singleTags == batchedTags);
+    REQUIRE(batchedPackets[0] != std::vector<uint8>(4, 0x11));
+
+    // both continue with the same counter
+    std::vector<uint8> singleNext(16, 0x44), batchedNext(16, 0x44);
+    Trinity::Crypto::AES::Tag singleNextTag, batchedNextTag;
+    REQUIRE(single.EncryptSend(singleNext.data(), singleNext.size(), singleNextTag));
+    REQUIRE(batched.EncryptSend(batchedNext.data(), batchedNext.size(), batchedNextTag));
+    REQUIRE(singleNext == batchedNext);
+    REQUIRE(std::ranges::equal(singleNextTag, batchedNextTag));
+}
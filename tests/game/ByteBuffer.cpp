@@ -0,0 +1,101 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ByteBuffer.h"
+#include <algorithm>
+
+TEST_CASE("ByteBuffer::AppendFixed", "[ByteBuffer]")
+{
+    ByteBuffer expected;
+    expected << int32(-5);
+    expected << uint8(7);
+    expected << uint64(0x0102030405060708);
+    expected << float(1.5f);
+
+    SECTION("matches individual appends")
+    {
+        ByteBuffer buffer;
+        buffer.AppendFixed(int32(-5), uint8(7), uint64(0x0102030405060708), float(1.5f));
+
+        REQUIRE(buffer.wpos() == expected.wpos());
+        REQUIRE(std::equal(buffer.data(), buffer.data() + buffer.wpos(), expected.data()));
+    }
+
+    SECTION("flushes pending bits first")
+    {
+        ByteBuffer bits;
+        bits.WriteBit(true);
+        bits.AppendFixed(int32(-5), uint8(7), uint64(0x0102030405060708), float(1.5f));
+
+        REQUIRE(bits.wpos() == expected.wpos() + 1);
+        REQUIRE(bits.data()[0] == 0x80);
+        REQUIRE(std::equal(bits.data() + 1, bits.data() + bits.wpos(), expected.data()));
+    }
+}
+
+TEST_CASE("ByteBuffer::WriteBits", "[ByteBuffer]")
+{
+    // every combination of bit offset and value width must produce the same bytes as writing single bits
+    uint64 const value = UI64LIT(0xA5C3F00F1E2D3C4B);
+    for (int32 offset = 0; offset < 8; ++offset)
+    {
+        for (int32 bits = 1; bits < 64; ++bits)
+        {
+            ByteBuffer packed;
+            ByteBuffer single;
+            for (int32 i = 0; i < offset; ++i)
+            {
+                packed.WriteBit(i & 1);
+                single.WriteBit(i & 1);
+            }
+
+            packed.WriteBits(value, bits);
+            for (int32 i = bits - 1; i >= 0; --i)
+                single.WriteBit((value >> i) & 1);
+
+            packed.WriteBit(true);
+            single.WriteBit(true);
+            packed.FlushBits();
+            single.FlushBits();
+
+            INFO("offset " << offset << " bits " << bits);
+            REQUIRE(packed.wpos() == single.wpos());
+            REQUIRE(std::equal(packed.data(), packed.data() + packed.wpos(), single.data()));
+        }
+    }
+}
+
+TEST_CASE("ByteBuffer storage reuse", "[ByteBuffer]")
+{
+    for (std::size_t reserve : { std::size_t(0), std::size_t(100), std::size_t(1000), std::size_t(5000), std::size_t(100000) })
+    {
+        for (int32 i = 0; i < 4; ++i)
+        {
+            ByteBuffer buffer(reserve, ByteBuffer::Reserve{});
+
+            INFO("reserve " << reserve);
+            REQUIRE(buffer.empty());
+            REQUIRE(buffer.wpos() == 0);
+
+            buffer << uint32(i);
+            buffer.append(std::vector<uint8>(reserve + 1).data(), reserve + 1);
+            REQUIRE(buffer.size() == reserve + 5);
+        }
+    }
+}
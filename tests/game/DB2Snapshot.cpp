@@ -0,0 +1,130 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "DB2DatabaseLoader.h"
+#include "DB2Meta.h"
+#include "DummyData.h"
+#include <boost/filesystem/operations.hpp>
+#include <cstring>
+
+namespace
+{
+#pragma pack(push, 1)
+struct SnapshotTestEntry
+{
+    uint32 ID;
+    LocalizedString Name;
+    int32 Value;
+    char const* Tag;
+};
+#pragma pack(pop)
+
+constexpr DB2MetaField SnapshotTestMetaFields[] =
+{
+    { FT_INT, 1, false },
+    { FT_STRING, 1, true },
+    { FT_INT, 1, true },
+    { FT_STRING_NOT_LOCALIZED, 1, true },
+};
+
+constexpr DB2Meta SnapshotTestMeta = { 0, 0, -1, 4, 4, 0x12345678, SnapshotTestMetaFields };
+
+constexpr DB2FieldMeta SnapshotTestFields[] =
+{
+    { false, FT_INT, "ID" },
+    { true, FT_STRING, "Name" },
+    { true, FT_INT, "Value" },
+    { true, FT_STRING_NOT_LOCALIZED, "Tag" },
+};
+
+DB2LoadInfo const SnapshotTestLoadInfo(SnapshotTestFields, std::extent_v<decltype(SnapshotTestFields)>, &SnapshotTestMeta, HotfixDatabaseStatements(0));
+}
+
+TEST_CASE("DB2 snapshot restores records and strings", "[DB2Snapshot]")
+{
+    std::string fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("db2snapshot-%%%%-%%%%.snapshot")).string();
+    std::vector<DB2SnapshotSource> sources(1);
+    sources[0].Locale = LOCALE_enUS;
+    sources[0].FileSize = 1024;
+    sources[0].LastWriteTime = 1700000000;
+
+    DB2Storage<SnapshotTestEntry> source("SnapshotTest.db2", &SnapshotTestLoadInfo);
+    UnitTestDataLoader::DB2<SnapshotTestEntry, &SnapshotTestEntry::ID> entries(source);
+    {
+        auto loader = entries.Loader();
+
+        SnapshotTestEntry& first = loader.Add();
+        first.ID = 3;
+        first.Name.Str.fill("");
+        first.Name.Str[LOCALE_enUS] = "Hearthstone";
+        first.Name.Str[LOCALE_esES] = "Piedra de hogar";
+        first.Value = -7;
+        first.Tag = "tagged";
+
+        SnapshotTestEntry& second = loader.Add();
+        second.ID = 10;
+        second.Name.Str.fill(nullptr);
+        second.Name.Str[LOCALE_enUS] = "Hearthstone";
+        second.Value = 42;
+        second.Tag = "";
+    }
+
+    REQUIRE(source.SaveSnapshot(fileName, sources));
+
+    SECTION("matching sources")
+    {
+        DB2Storage<SnapshotTestEntry> loaded("SnapshotTest.db2", &SnapshotTestLoadInfo);
+        REQUIRE(loaded.LoadSnapshot(fileName, sources));
+        REQUIRE(loaded.GetNumRows() == 11);
+        REQUIRE(!loaded.HasRecord(4));
+
+        SnapshotTestEntry const* first = loaded.LookupEntry(3);
+        REQUIRE(first);
+        REQUIRE(first->ID == 3);
+        REQUIRE(first->Value == -7);
+        REQUIRE(strcmp(first->Name[LOCALE_enUS], "Hearthstone") == 0);
+        REQUIRE(strcmp(first->Name[LOCALE_esES], "Piedra de hogar") == 0);
+        REQUIRE(strcmp(first->Name[LOCALE_deDE], "") == 0);
+        REQUIRE(strcmp(first->Tag, "tagged") == 0);
+
+        SnapshotTestEntry const* second = loaded.LookupEntry(10);
+        REQUIRE(second);
+        REQUIRE(second->Value == 42);
+        REQUIRE(second->Name[LOCALE_deDE] == nullptr);
+        REQUIRE(strcmp(second->Tag, "") == 0);
+    }
+
+    SECTION("changed source file")
+    {
+        sources[0].LastWriteTime += 1;
+        DB2Storage<SnapshotTestEntry> loaded("SnapshotTest.db2", &SnapshotTestLoadInfo);
+        REQUIRE(!loaded.LoadSnapshot(fileName, sources));
+        REQUIRE(loaded.GetNumRows() == 0);
+    }
+
+    SECTION("additional locale")
+    {
+        sources.emplace_back().Locale = LOCALE_esES;
+        DB2Storage<SnapshotTestEntry> loaded("SnapshotTest.db2", &SnapshotTestLoadInfo);
+        REQUIRE(!loaded.LoadSnapshot(fileName, sources));
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::remove(fileName, error);
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "GridObject.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace
+{
+struct TestGridObject : GridObject<TestGridObject>
+{
+    TestGridObject(float x, float y) : X(x), Y(y) { }
+
+    float GetPositionX() const { return X; }
+    float GetPositionY() const { return Y; }
+
+    float X;
+    float Y;
+};
+
+std::vector<TestGridObject*> FindInRange(GridRefManager<TestGridObject> const& container, float x, float y, float radius)
+{
+    std::vector<TestGridObject*> result;
+    container.GetPositionIndex().VisitInRange(x, y, radius, [&](TestGridObject* object)
+    {
+        result.push_back(object);
+        return true;
+    });
+    std::ranges::sort(result, {}, &TestGridObject::X);
+    return result;
+}
+}
+
+TEST_CASE("GridPositionIndex finds objects within radius", "[GridPositionIndex]")
+{
+    GridRefManager<TestGridObject> container;
+    std::vector<std::unique_ptr<TestGridObject>> objectStorage;
+    std::vector<TestGridObject*> objects;
+    for (int32 i = 0; i < 100; ++i)
+    {
+        objects.push_back(objectStorage.emplace_back(std::make_unique<TestGridObject>(float(i), 0.0f)).get());
+        objects.back()->AddToGrid(container);
+    }
+
+    std::vector<TestGridObject*> found = FindInRange(container, 70.0f, 0.0f, 2.0f);
+    REQUIRE(found == std::vector<TestGridObject*>{ objects[68], objects[69], objects[70], objects[71], objects[72] });
+
+    SECTION("removed objects are not found")
+    {
+        objects[70]->RemoveFromGrid();
+        objects[0]->RemoveFromGrid();
+        found = FindInRange(container, 70.0f, 0.0f, 2.0f);
+        REQUIRE(found == std::vector<TestGridObject*>{ objects[68], objects[69], objects[71], objects[72] });
+        REQUIRE(FindInRange(container, 0.0f, 0.0f, 0.5f).empty());
+        REQUIRE(FindInRange(container, 99.0f, 0.0f, 0.5f) == std::vector<TestGridObject*>{ objects[99] });
+    }
+
+    SECTION("relocated objects are found at their new position")
+    {
+        objects[5]->X = 70.0f;
+        objects[5]->Y = 1.0f;
+        objects[5]->UpdateGridPosition();
+        found = FindInRange(container, 70.0f, 0.0f, 2.0f);
+        REQUIRE(found.size() == 6);
+        REQUIRE(std::ranges::find(found, objects[5]) != found.end());
+        REQUIRE(FindInRange(container, 5.0f, 0.0f, 0.5f).empty());
+    }
+
+    SECTION("search stops when worker returns false")
+    {
+        uint32 visited = 0;
+        REQUIRE(!container.GetPositionIndex().VisitInRange(50.0f, 0.0f, 100.0f, [&](TestGridObject*) { return ++visited < 3; }));
+        REQUIRE(visited == 3);
+    }
+
+    // objects are destroyed while still linked, GridObject destructor removes them from the index
+    objectStorage.clear();
+    REQUIRE(FindInRange(container, 50.0f, 0.0f, 100.0f).empty());
+}
@@ -84,3 +84,20 @@ TEST_CASE("|Hachievement validation", "[Hyperlinks]")
 
     REQUIRE(true  == CheckAllLinks("|cffffff00|Hachievement:4298:Player-0-000000FD:1:12:20:12:0:0:0:0|h[Heroico: Prueba del Campe\xc3\xb3n]|h|r"));
 }
+
+TEST_CASE("Repeated link validation", "[Hyperlinks]")
+{
+    UnitTestDataLoader::LoadItemTemplates();
+    std::string_view const miscolored = "|cffa335ee|Hitem:6948::::::::60:::::|h[Hearthstone]|h|r";
+
+    sWorld->setIntConfig(CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY, 1);
+    REQUIRE(false == CheckAllLinks(miscolored));
+    REQUIRE(false == CheckAllLinks(miscolored));
+    REQUIRE(true  == CheckAllLinks("|cffffffff|Hitem:6948::::::::60:::::|h[Hearthstone]|h|r |cffffffff|Hitem:6948::::::::60:::::|h[Hearthstone]|h|r"));
+
+    // validation results of a link depend on the configured severity
+    sWorld->setIntConfig(CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY, uint32(-1));
+    REQUIRE(true  == CheckAllLinks(miscolored));
+    sWorld->setIntConfig(CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY, 1);
+    REQUIRE(false == CheckAllLinks(miscolored));
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "LineOfSightCache.h"
+
+TEST_CASE("Cached line of sight is found for unchanged rays", "[LineOfSightCache]")
+{
+    LineOfSightCache cache;
+    ObjectGuid const source = ObjectGuid::Create<HighGuid::Player>(1);
+    ObjectGuid const target = ObjectGuid::Create<HighGuid::Player>(2);
+    LineOfSightCache::Ray const ray{ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+
+    REQUIRE(!cache.Find(source, target, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing, ray));
+    cache.Store(source, target, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing, ray, false);
+
+    std::optional<bool> cached = cache.Find(source, target, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing, ray);
+    REQUIRE(cached);
+    REQUIRE(!*cached);
+
+    // other direction, other checks
+    REQUIRE(!cache.Find(target, source, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing, ray));
+    REQUIRE(!cache.Find(source, target, LINEOFSIGHT_CHECK_VMAP, VMAP::ModelIgnoreFlags::Nothing, ray));
+    REQUIRE(!cache.Find(source, target, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2, ray));
+
+    REQUIRE(cache.GetHits() == 1);
+    REQUIRE(cache.GetMisses() == 4);
+}
+
+TEST_CASE("Moving either object misses", "[LineOfSightCache]")
+{
+    LineOfSightCache cache;
+    ObjectGuid const source = ObjectGuid::Create<HighGuid::Player>(1);
+    ObjectGuid const target = ObjectGuid::Create<HighGuid::Player>(2);
+    cache.Store(source, target, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f }, true);
+
+    REQUIRE(!cache.Find(source, target, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing, { 1.5f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f }));
+    REQUIRE(!cache.Find(source, target, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 7.0f }));
+
+    cache.Clear();
+    REQUIRE(cache.GetSize() == 0);
+    cache.ResetCounters();
+    REQUIRE(cache.GetMisses() == 0);
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MapUpdateIslands.h"
+
+TEST_CASE("Distant groups form separate islands", "[MapUpdateIslands]")
+{
+    MapUpdateIslands builder;
+
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(10, 10));
+    builder.AddCell(CellCoord(11, 10));
+
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(200, 200));
+
+    std::vector<MapUpdateIslands::Island> islands = builder.Build();
+    REQUIRE(islands.size() == 2);
+    REQUIRE(islands[0].size() == 2);
+    REQUIRE(islands[1].size() == 1);
+}
+
+TEST_CASE("Nearby grids are merged", "[MapUpdateIslands]")
+{
+    MapUpdateIslands builder;
+
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(10, 10));
+
+    // two grids away
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(10 + 2 * MAX_NUMBER_OF_CELLS, 10));
+
+    REQUIRE(builder.Build().size() == 1);
+
+    // builder is reset after Build
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(10, 10));
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(10 + 3 * MAX_NUMBER_OF_CELLS, 10));
+
+    REQUIRE(builder.Build().size() == 2);
+}
+
+TEST_CASE("Cells of one group stay together", "[MapUpdateIslands]")
+{
+    MapUpdateIslands builder;
+
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(10, 10));
+    builder.AddCell(CellCoord(400, 400));
+
+    builder.BeginGroup();
+    builder.AddCell(CellCoord(200, 200));
+
+    std::vector<MapUpdateIslands::Island> islands = builder.Build();
+    REQUIRE(islands.size() == 2);
+    REQUIRE(islands[0].size() == 2);
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "PacketLog.h"
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+void Append(std::vector<uint8>& data, uint32 value)
+{
+    for (uint32 i = 0; i < 4; ++i)
+        data.push_back(uint8(value >> (i * 8)));
+}
+
+void AppendPacket(std::vector<uint8>& data, uint32 direction, uint32 connection, uint32 ticks, uint32 opcode, std::vector<uint8> const& payload)
+{
+    Append(data, direction);
+    Append(data, connection);
+    Append(data, ticks);
+    Append(data, 20);                       // optional data: socket address and port
+    Append(data, 4 + payload.size());
+    data.insert(data.end(), 20, 0);
+    Append(data, opcode);
+    data.insert(data.end(), payload.begin(), payload.end());
+}
+}
+
+TEST_CASE("PacketLogReader", "[PacketLog]")
+{
+    std::vector<uint8> capture = { 'P', 'K', 'T', 0x01, 0x03, 'T' };
+    Append(capture, 55000);                 // build
+    capture.insert(capture.end(), { 'e', 'n', 'U', 'S' });
+    capture.insert(capture.end(), 40, 0);   // session key
+    Append(capture, 0);                     // start unixtime
+    Append(capture, 0);                     // start ticks
+    Append(capture, 0);                     // optional data size
+
+    AppendPacket(capture, 0x47534d43, 1, 100, 0x123456, { 1, 2, 3 });
+    AppendPacket(capture, 0x47534d53, 0, 150, 0x654321, { });
+
+    std::filesystem::path fileName = std::filesystem::temp_directory_path() / "tc_packetlogreader_test.pkt";
+    {
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<char const*>(capture.data()), capture.size());
+    }
+
+    PacketLogReader reader;
+    REQUIRE(reader.Open(fileName.string()));
+    REQUIRE(reader.GetBuild() == 55000);
+
+    PacketLogEntry entry;
+    REQUIRE(reader.ReadNext(entry));
+    REQUIRE(entry.PacketDirection == CLIENT_TO_SERVER);
+    REQUIRE(entry.ConnectionId == 1);
+    REQUIRE(entry.ArrivalTicks == 100);
+    REQUIRE(entry.Opcode == 0x123456);
+    REQUIRE(entry.Data == std::vector<uint8>{ 1, 2, 3 });
+
+    REQUIRE(reader.ReadNext(entry));
+    REQUIRE(entry.PacketDirection == SERVER_TO_CLIENT);
+    REQUIRE(entry.Opcode == 0x654321);
+    REQUIRE(entry.Data.empty());
+
+    REQUIRE(!reader.ReadNext(entry));
+
+    std::filesystem::remove(fileName);
+}
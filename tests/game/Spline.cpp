@@ -0,0 +1,104 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "Spline.h"
+#include <array>
+
+using Movement::Vector3;
+
+namespace
+{
+Vector3 CatmullRom(Vector3 const* p, float t)
+{
+    return ((p[1] * 2.f) + (p[2] - p[0]) * t + (p[0] * 2.f - p[1] * 5.f + p[2] * 4.f - p[3]) * t * t + (p[1] * 3.f - p[0] - p[2] * 3.f + p[3]) * t * t * t) * 0.5f;
+}
+
+Vector3 CatmullRomDerivative(Vector3 const* p, float t)
+{
+    return ((p[2] - p[0]) + (p[0] * 2.f - p[1] * 5.f + p[2] * 4.f - p[3]) * 2.f * t + (p[1] * 3.f - p[0] - p[2] * 3.f + p[3]) * 3.f * t * t) * 0.5f;
+}
+
+void RequireNear(Vector3 const& actual, Vector3 const& expected)
+{
+    REQUIRE(actual.x == Approx(expected.x).margin(1e-3));
+    REQUIRE(actual.y == Approx(expected.y).margin(1e-3));
+    REQUIRE(actual.z == Approx(expected.z).margin(1e-3));
+}
+
+void CheckSegments(Movement::Spline<int32> const& spline)
+{
+    for (int32 index = spline.first(); index < spline.last(); ++index)
+    {
+        Vector3 const* p = &spline.getPoints()[index - 1];
+        for (float t : { 0.f, 0.25f, 0.5f, 0.8f, 1.f })
+        {
+            Vector3 position, derivative;
+            spline.evaluate_percent(index, t, position);
+            spline.evaluate_derivative(index, t, derivative);
+            RequireNear(position, CatmullRom(p, t));
+            RequireNear(derivative, CatmullRomDerivative(p, t));
+        }
+    }
+}
+
+std::array<Vector3, 5> const Path =
+{
+    Vector3(-8913.2f, 554.6f, 93.8f),
+    Vector3(-8921.7f, 560.1f, 94.1f),
+    Vector3(-8935.0f, 571.3f, 95.6f),
+    Vector3(-8940.4f, 590.8f, 97.0f),
+    Vector3(-8932.9f, 602.5f, 96.2f)
+};
+}
+
+TEST_CASE("Catmull-Rom segments match the basis matrix", "[Spline]")
+{
+    Movement::Spline<int32> spline;
+
+    SECTION("Open spline")
+    {
+        spline.init_spline(Path.data(), Path.size(), Movement::SplineBase::ModeCatmullrom, 1.2f);
+        REQUIRE(spline.last() - spline.first() == int32(Path.size() - 1));
+        CheckSegments(spline);
+
+        Vector3 end;
+        spline.evaluate_percent(spline.last() - 1, 1.f, end);
+        RequireNear(end, Path.back());
+    }
+
+    SECTION("Cyclic spline")
+    {
+        spline.init_cyclic_spline(Path.data(), Path.size(), Movement::SplineBase::ModeCatmullrom, 0);
+        REQUIRE(spline.last() - spline.first() == int32(Path.size()));
+        CheckSegments(spline);
+    }
+
+    SECTION("Segment lengths")
+    {
+        spline.init_spline(Path.data(), Path.size(), Movement::SplineBase::ModeCatmullrom);
+        for (int32 index = spline.first(); index < spline.last(); ++index)
+        {
+            Vector3 const* p = &spline.getPoints()[index - 1];
+            float expected = 0.f;
+            for (int32 step = 1; step <= 3; ++step)
+                expected += (CatmullRom(p, float(step) / 3.f) - CatmullRom(p, float(step - 1) / 3.f)).length();
+
+            REQUIRE(spline.SegLength(index) == Approx(expected).margin(1e-3));
+        }
+    }
+}
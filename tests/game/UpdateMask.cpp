@@ -0,0 +1,65 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "UpdateMask.h"
+
+TEST_CASE("UpdateMask blocks mask follows non empty blocks", "[UpdateMask]")
+{
+    using Mask = UpdateMask<100>;
+
+    Mask mask({ 0x00000001u, 0x00000000u, 0x80000000u, 0x0000000Fu });
+    REQUIRE(mask.GetBlocksMask(0) == 0b1101u);
+    REQUIRE(mask[0]);
+    REQUIRE(!mask[1]);
+    REQUIRE(mask[95]);
+    REQUIRE(mask.IsAnySet());
+
+    mask.Reset(0);
+    REQUIRE(mask.GetBlocksMask(0) == 0b1100u);
+
+    mask.Set(40);
+    REQUIRE(mask.GetBlocksMask(0) == 0b1110u);
+
+    mask.ResetAll();
+    REQUIRE(!mask.IsAnySet());
+}
+
+TEST_CASE("UpdateMask intersection clears emptied blocks", "[UpdateMask]")
+{
+    using Mask = UpdateMask<1100>;
+
+    Mask changes;
+    changes.Set(3);
+    changes.Set(64);
+    changes.Set(1090);
+
+    Mask allowed;
+    allowed.SetAll();
+    allowed.Reset(64);
+
+    Mask visible = changes & allowed;
+    REQUIRE(visible[3]);
+    REQUIRE(!visible[64]);
+    REQUIRE(visible[1090]);
+    REQUIRE(visible.GetBlocksMask(0) == 0b1u);
+    REQUIRE(visible.GetBlocksMask(1) == (1u << (1090 / 32 - 32)));
+    REQUIRE(visible.GetBlock(2) == 0);
+
+    visible &= Mask();
+    REQUIRE(!visible.IsAnySet());
+}